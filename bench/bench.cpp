@@ -31,6 +31,9 @@
 #include <boost/json/basic_parser_impl.hpp>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -38,6 +41,19 @@
 #include <cstdio>
 #include <vector>
 
+#if defined(__linux__)
+# include <sched.h>
+# if defined(__has_include)
+#  if __has_include(<linux/perf_event.h>)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define BENCH_HAS_PERF_EVENTS
+#  endif
+# endif
+#endif
+
 #include "test_suite.hpp"
 
 /*  References
@@ -47,6 +63,23 @@
     http://seriot.ch/parsing_json.php
 */
 
+#ifdef BOOST_NO_EXCEPTIONS
+namespace boost {
+// the -fno-exceptions build routes every throw
+// here; the benchmark never exercises failing
+// inputs, so reaching this is a bug
+void
+throw_exception(
+    std::exception const&,
+    boost::source_location const&)
+{
+    std::fprintf(stderr,
+        "Exceptions are not supported!");
+    std::abort();
+}
+} // boost
+#endif
+
 namespace boost {
 namespace json {
 
@@ -56,6 +89,7 @@ using clock_type = std::chrono::steady_clock;
 std::stringstream strout;
 parse_options popts;
 bool with_file_io = false;
+array g_results;
 
 #if defined(__clang__)
 string_view toolset = "clang";
@@ -75,6 +109,17 @@ string_view arch = "x64" SSE2_ARCH_SUFFIX;
 #error Unknown architecture.
 #endif
 
+// results are tagged with the exception
+// configuration so runs of the normal and
+// -fno-exceptions builds of this program can
+// be checked for throughput parity with
+// check_regression.py --parity
+#ifndef BOOST_NO_EXCEPTIONS
+string_view exceptions_config = "except";
+#else
+string_view exceptions_config = "noexcept";
+#endif
+
 //----------------------------------------------------------
 
 struct file_item
@@ -123,13 +168,345 @@ load_file(char const* path)
     return s;
 }
 
+//----------------------------------------------------------
+//
+// Synthetic document generation
+//
+// The sample corpus covers three fixed shapes; production
+// documents rarely look like any of them. A seeded generator
+// produces parameterized workloads so throughput can be
+// characterized as a function of document shape: key
+// cardinality, string length distribution, number ratio, and
+// nesting depth. Generated documents appear on the command
+// line as pseudo-files:
+//
+//   gen:nodes=10000,keys=64,depth=6,strmin=4,strmax=24,numratio=0.5,seed=1
+//
+// The same spec always produces the same document, so runs
+// on different machines and branches stay comparable.
+
+struct gen_params
+{
+    std::size_t nodes = 10000;   // approximate element count
+    std::size_t keys = 64;       // distinct keys in the pool
+    std::size_t depth = 6;       // maximum nesting depth
+    std::size_t strmin = 4;      // shortest generated string
+    std::size_t strmax = 24;     // longest generated string
+    double numratio = 0.5;       // fraction of leaves that are numbers
+    std::uint64_t seed = 1;
+};
+
+class doc_generator
+{
+    gen_params p_;
+    std::uint64_t state_;
+    std::size_t budget_;
+    std::vector<std::string> keys_;
+
+    // xorshift64*; fast, seedable, and identical
+    // everywhere, unlike std::rand
+    std::uint64_t
+    next() noexcept
+    {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 2685821657736338717ULL;
+    }
+
+    value
+    make_leaf(storage_ptr const& sp)
+    {
+        // the last child of a container can
+        // arrive with the budget already spent
+        if(budget_ > 0)
+            --budget_;
+        auto const r = next();
+        if( static_cast<double>(r % 1024) / 1024 < p_.numratio )
+        {
+            // mix integer and floating point so number
+            // parsing sees both code paths
+            if(r & 1)
+                return value(
+                    static_cast<std::int64_t>(next() % 1000000), sp);
+            return value(
+                static_cast<double>(next() % 1000000) / 1000, sp);
+        }
+        auto const n = p_.strmin + next() %
+            (p_.strmax - p_.strmin + 1);
+        string s(sp);
+        s.reserve(n);
+        for(std::size_t i = 0; i < n; ++i)
+            s.push_back(
+                "abcdefghijklmnopqrstuvwxyz 0123456789"[next() % 37]);
+        return value(std::move(s), sp);
+    }
+
+    value
+    make_node(std::size_t depth, storage_ptr const& sp)
+    {
+        if(depth >= p_.depth || budget_ == 0)
+            return make_leaf(sp);
+        auto fanout = 1 + next() % 8;
+        if(fanout > budget_)
+            fanout = budget_;
+        if(next() & 1)
+        {
+            // consecutive pool entries from a random
+            // start keep keys distinct within one object
+            if(fanout > p_.keys)
+                fanout = p_.keys;
+            auto const first = next() % p_.keys;
+            object o(sp);
+            o.reserve(fanout);
+            for(std::size_t i = 0; i < fanout; ++i)
+                o.emplace(
+                    keys_[(first + i) % p_.keys],
+                    make_node(depth + 1, sp));
+            return value(std::move(o), sp);
+        }
+        array a(sp);
+        a.reserve(fanout);
+        for(std::size_t i = 0; i < fanout; ++i)
+            a.emplace_back(make_node(depth + 1, sp));
+        return value(std::move(a), sp);
+    }
+
+public:
+    explicit
+    doc_generator(gen_params const& p)
+        : p_(p)
+        , state_(p.seed ? p.seed : 1)
+        , budget_(p.nodes)
+    {
+        keys_.reserve(p_.keys);
+        for(std::size_t i = 0; i < p_.keys; ++i)
+        {
+            char buf[24];
+            std::snprintf(
+                buf, sizeof(buf), "key%04zu", i);
+            keys_.push_back(buf);
+        }
+    }
+
+    value
+    generate(storage_ptr sp = {})
+    {
+        budget_ = p_.nodes;
+        array a(sp);
+        while(budget_ > 0)
+            a.emplace_back(make_node(1, sp));
+        return value(std::move(a), sp);
+    }
+};
+
+bool
+parse_gen_spec(
+    char const* s, gen_params& p)
+{
+    // s points past "gen:"; fields are
+    // name=value separated by commas
+    while(*s)
+    {
+        char const* eq = std::strchr(s, '=');
+        if(! eq)
+            return false;
+        string_view const name(s, eq - s);
+        char* end = nullptr;
+        if(name == "numratio")
+            p.numratio = std::strtod(eq + 1, &end);
+        else
+        {
+            auto const v = std::strtoull(eq + 1, &end, 10);
+            if(name == "nodes")
+                p.nodes = v;
+            else if(name == "keys")
+                p.keys = v;
+            else if(name == "depth")
+                p.depth = v;
+            else if(name == "strmin")
+                p.strmin = v;
+            else if(name == "strmax")
+                p.strmax = v;
+            else if(name == "seed")
+                p.seed = v;
+            else
+                return false;
+        }
+        if(end == eq + 1)
+            return false;
+        s = end;
+        if(*s == ',')
+            ++s;
+        else if(*s)
+            return false;
+    }
+    return p.keys > 0 && p.nodes > 0 &&
+        p.strmin <= p.strmax &&
+        p.numratio >= 0 && p.numratio <= 1;
+}
+
+//----------------------------------------------------------
+
 struct sample
 {
     std::size_t calls;
     std::size_t millis;
     std::size_t mbs;
+    std::uint64_t cycles;
+    std::uint64_t cache_misses;
+    std::uint64_t branch_misses;
+};
+
+double
+median_of(std::vector<double> v)
+{
+    if(v.empty())
+        return 0;
+    std::sort(v.begin(), v.end());
+    auto const n = v.size();
+    if(n % 2 == 1)
+        return v[n / 2];
+    return (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+// median absolute deviation; a robust spread
+// estimate that a single outlier trial cannot
+// inflate the way a standard deviation can
+double
+mad_of(std::vector<double> const& v, double med)
+{
+    std::vector<double> dev;
+    dev.reserve(v.size());
+    for(double x : v)
+        dev.push_back(std::fabs(x - med));
+    return median_of(std::move(dev));
+}
+
+// Pin the calling thread to one CPU so that
+// migrations do not perturb the measurements.
+bool
+pin_thread(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(
+        0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+//----------------------------------------------------------
+//
+// Hardware counters (Linux perf events)
+//
+
+#ifdef BENCH_HAS_PERF_EVENTS
+
+class perf_counters
+{
+    int fds_[3] = { -1, -1, -1 };
+    std::uint64_t values_[3] = {};
+
+    static
+    int
+    open_counter(
+        std::uint32_t type,
+        std::uint64_t config)
+    {
+        perf_event_attr pe;
+        std::memset(&pe, 0, sizeof(pe));
+        pe.size = sizeof(pe);
+        pe.type = type;
+        pe.config = config;
+        pe.disabled = 1;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        return static_cast<int>(syscall(
+            SYS_perf_event_open,
+            &pe, 0, -1, -1, 0));
+    }
+
+public:
+    perf_counters()
+    {
+        fds_[0] = open_counter(PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_CPU_CYCLES);
+        fds_[1] = open_counter(PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_CACHE_MISSES);
+        fds_[2] = open_counter(PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_BRANCH_MISSES);
+    }
+
+    ~perf_counters()
+    {
+        for(int fd : fds_)
+            if(fd >= 0)
+                close(fd);
+    }
+
+    // counters may be unavailable, e.g. under a
+    // restrictive perf_event_paranoid setting
+    bool
+    available() const noexcept
+    {
+        return fds_[0] >= 0;
+    }
+
+    void
+    start()
+    {
+        for(int fd : fds_)
+        {
+            if(fd < 0)
+                continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    void
+    stop()
+    {
+        for(int i = 0; i < 3; ++i)
+        {
+            values_[i] = 0;
+            if(fds_[i] < 0)
+                continue;
+            ioctl(fds_[i],
+                PERF_EVENT_IOC_DISABLE, 0);
+            if(read(fds_[i], &values_[i],
+                    sizeof(values_[i])) !=
+                static_cast<long>(
+                    sizeof(values_[i])))
+                values_[i] = 0;
+        }
+    }
+
+    std::uint64_t cycles() const noexcept { return values_[0]; }
+    std::uint64_t cache_misses() const noexcept { return values_[1]; }
+    std::uint64_t branch_misses() const noexcept { return values_[2]; }
 };
 
+#else
+
+class perf_counters
+{
+public:
+    bool available() const noexcept { return false; }
+    void start() {}
+    void stop() {}
+    std::uint64_t cycles() const noexcept { return 0; }
+    std::uint64_t cache_misses() const noexcept { return 0; }
+    std::uint64_t branch_misses() const noexcept { return 0; }
+};
+
+#endif
+
 // Returns the number of invocations per second
 template<
     class Rep,
@@ -149,7 +526,7 @@ run_for(std::chrono::duration<Rep, Period> interval, F&& f)
     return { n, static_cast<std::size_t>(
         std::chrono::duration_cast<
             std::chrono::milliseconds>(
-                elapsed).count()), 0 };
+                elapsed).count()), 0, 0, 0, 0 };
 }
 
 std::size_t
@@ -179,6 +556,7 @@ bench(
     file_list const& vf,
     impl_list const& vi, std::size_t Trials)
 {
+    perf_counters pc;
     std::vector<sample> trial;
     for(unsigned i = 0; i < vf.size(); ++i)
     {
@@ -197,72 +575,83 @@ bench(
 
                 return clock_type::duration();
             };
-            // helps with the caching, which reduces noise
+            // warm caches, the branch predictor,
+            // and any frequency scaling before
+            // the first measured trial
             f();
-
             repeat = 1000;
+            run_for(std::chrono::milliseconds(500), f);
+
             for(unsigned k = 0; k < Trials; ++k)
             {
+                pc.start();
                 auto result = run_for(std::chrono::seconds(5), f);
+                pc.stop();
                 result.calls *= repeat;
                 result.mbs = megabytes_per_second(
                     vf[i], result.calls, result.millis);
+                result.cycles = pc.cycles();
+                result.cache_misses = pc.cache_misses();
+                result.branch_misses = pc.branch_misses();
                 print_prefix(dout, vf[i], *vi[j], verb )
                     << "," << result.calls
                     << "," << result.millis
-                    << "," << result.mbs
-                    << "\n";
+                    << "," << result.mbs;
+                if(pc.available())
+                    dout
+                        << "," << result.cycles
+                        << "," << result.cache_misses
+                        << "," << result.branch_misses;
+                dout << "\n";
                 trial.push_back(result);
                 // adjust repeat to avoid overlong tests
                 repeat = 250 * result.calls / result.millis;
             }
 
-            // clean up the samples
-            std::sort(
-                trial.begin(),
-                trial.end(),
-                []( sample const& lhs,
-                    sample const& rhs)
-                {
-                    return lhs.mbs < rhs.mbs;
-                });
-            if(Trials >= 6)
-            {
-                // discard worst 2
-                trial.erase(
-                    trial.begin(),
-                    trial.begin() + 2);
-                // discard best 1
-                trial.resize( trial.size() - 1 );
-
-            }
-            else if(Trials > 3)
+            // robust summary: the median is
+            // insensitive to outlier trials, and
+            // the MAD reports the spread so a
+            // regression can be told apart from
+            // the noise floor
+            std::vector<double> mbs;
+            mbs.reserve(trial.size());
+            for(auto const& t : trial)
+                mbs.push_back(
+                    static_cast<double>(t.mbs));
+            double const med = median_of(mbs);
+            double const spread = mad_of(mbs, med);
+            print_prefix(strout, vf[i], *vi[j], verb)
+                << "," << med << "," << spread << "\n";
+
+            object r;
+            r["test"] = verb;
+            r["file"] = vf[i].name;
+            r["impl"] = vi[j]->name();
+            r["trials"] = trial.size();
+            r["mbs_median"] = med;
+            r["mbs_mad"] = spread;
+            if(pc.available())
             {
-                trial.erase(
-                    trial.begin(),
-                    trial.begin() + Trials - 3);
-            }
-            // average
-            auto const calls =
-                std::accumulate(
-                trial.begin(), trial.end(),
-                std::size_t{},
-                []( std::size_t lhs,
-                    sample const& rhs)
+                std::vector<double> cyc;
+                std::vector<double> cmiss;
+                std::vector<double> bmiss;
+                for(auto const& t : trial)
                 {
-                    return lhs + rhs.calls;
-                });
-            auto const millis =
-                std::accumulate(
-                trial.begin(), trial.end(),
-                std::size_t{},
-                []( std::size_t lhs,
-                    sample const& rhs)
-                {
-                    return lhs + rhs.millis;
-                });
-            auto const mbs = megabytes_per_second(vf[i], calls, millis);
-            print_prefix(strout, vf[i], *vi[j], verb) << "," << mbs << "\n";
+                    double const bytes =
+                        static_cast<double>(
+                            vf[i].text.size()) *
+                        t.calls;
+                    cyc.push_back(t.cycles / bytes);
+                    cmiss.push_back(
+                        t.cache_misses / bytes);
+                    bmiss.push_back(
+                        t.branch_misses / bytes);
+                }
+                r["cycles_per_byte"] = median_of(cyc);
+                r["cache_misses_per_byte"] = median_of(cmiss);
+                r["branch_misses_per_byte"] = median_of(bmiss);
+            }
+            g_results.push_back(std::move(r));
         }
     }
 }
@@ -978,6 +1367,224 @@ struct nlohmann_impl : public any_impl
 };
 #endif // BOOST_JSON_HAS_NLOHMANN_JSON
 
+//----------------------------------------------------------
+//
+// Microbenchmarks
+//
+// Each function performs `repeat` iterations of one
+// subsystem operation and returns the elapsed time,
+// so a regression can be bisected to a phase instead
+// of only showing up in the end-to-end numbers.
+
+// defeats dead code elimination
+volatile std::size_t micro_sink;
+
+clock_type::duration
+micro_object_find(std::size_t repeat)
+{
+    object o;
+    std::vector<std::string> keys;
+    for(int i = 0; i < 64; ++i)
+    {
+        char buf[16];
+        std::snprintf(
+            buf, sizeof(buf), "key%02d", i);
+        keys.push_back(buf);
+        o[buf] = i;
+    }
+    std::size_t found = 0;
+    auto const start = clock_type::now();
+    while(repeat--)
+        for(auto const& k : keys)
+            found += o.find(k) != o.end();
+    auto const elapsed =
+        clock_type::now() - start;
+    micro_sink = found;
+    return elapsed;
+}
+
+clock_type::duration
+micro_value_stack_push(std::size_t repeat)
+{
+    value_stack st;
+    std::size_t total = 0;
+    auto const start = clock_type::now();
+    while(repeat--)
+    {
+        st.reset();
+        for(std::int64_t i = 0; i < 64; ++i)
+            st.push_int64(i);
+        st.push_array(64);
+        auto jv = st.release();
+        total += jv.get_array().size();
+    }
+    auto const elapsed =
+        clock_type::now() - start;
+    micro_sink = total;
+    return elapsed;
+}
+
+clock_type::duration
+micro_serializer_escape(std::size_t repeat)
+{
+    std::string raw;
+    for(int i = 0; i < 64; ++i)
+        raw += "plain text \"quoted\"\n\tand\\mixed";
+    value jv = string_view(raw);
+    serializer sr;
+    char buf[4096];
+    std::size_t total = 0;
+    auto const start = clock_type::now();
+    while(repeat--)
+    {
+        sr.reset(&jv);
+        while(! sr.done())
+            total += sr.read(
+                buf, sizeof(buf)).size();
+    }
+    auto const elapsed =
+        clock_type::now() - start;
+    micro_sink = total;
+    return elapsed;
+}
+
+// serialize throughput as a function of the
+// destination buffer size; small MTU-sized
+// frames exercise the suspend/resume path,
+// which should not cost much more per byte
+// than one large read
+clock_type::duration
+micro_serialize_buf(
+    std::size_t repeat,
+    std::size_t buf_size)
+{
+    std::string raw(512, 'x');
+    array ja;
+    for(int i = 0; i < 64; ++i)
+        ja.push_back(string_view(raw));
+    value const jv(std::move(ja));
+    serializer sr;
+    char buf[65536];
+    std::size_t total = 0;
+    auto const start = clock_type::now();
+    while(repeat--)
+    {
+        sr.reset(&jv);
+        while(! sr.done())
+            total += sr.read(
+                buf, buf_size).size();
+    }
+    auto const elapsed =
+        clock_type::now() - start;
+    micro_sink = total;
+    return elapsed;
+}
+
+clock_type::duration
+micro_serialize_buf512(std::size_t repeat)
+{
+    return micro_serialize_buf(repeat, 512);
+}
+
+clock_type::duration
+micro_serialize_buf1400(std::size_t repeat)
+{
+    return micro_serialize_buf(repeat, 1400);
+}
+
+clock_type::duration
+micro_serialize_buf4096(std::size_t repeat)
+{
+    return micro_serialize_buf(repeat, 4096);
+}
+
+clock_type::duration
+micro_serialize_buf65536(std::size_t repeat)
+{
+    return micro_serialize_buf(repeat, 65536);
+}
+
+void
+bench_micro(std::size_t Trials)
+{
+    struct micro_item
+    {
+        string_view name;
+        clock_type::duration (*fn)(std::size_t);
+        std::size_t units; // operations per call
+    };
+    static micro_item const items[] = {
+        { "object::find", &micro_object_find, 64 },
+        { "value_stack push", &micro_value_stack_push, 64 },
+        { "serializer escape", &micro_serializer_escape, 1 },
+        { "serialize 512B buffers", &micro_serialize_buf512, 1 },
+        { "serialize 1400B buffers", &micro_serialize_buf1400, 1 },
+        { "serialize 4KB buffers", &micro_serialize_buf4096, 1 },
+        { "serialize 64KB buffers", &micro_serialize_buf65536, 1 },
+    };
+
+    perf_counters pc;
+    for(auto const& item : items)
+    {
+        std::size_t repeat = 1000;
+        auto const f = [&]
+        {
+            return item.fn(repeat);
+        };
+        f();
+        run_for(std::chrono::milliseconds(500), f);
+
+        std::vector<double> mops;
+        std::vector<double> cpo;
+        for(unsigned k = 0; k < Trials; ++k)
+        {
+            pc.start();
+            auto result = run_for(std::chrono::seconds(5), f);
+            pc.stop();
+            result.calls *= repeat;
+            double const ops = static_cast<double>(
+                result.calls) * item.units;
+            // millions of operations per second
+            double const m =
+                ops / result.millis / 1000;
+            dout << "Micro " << item.name <<
+                "," << toolset << " " << arch <<
+                ",boost" <<
+                "," << result.calls <<
+                "," << result.millis <<
+                "," << m;
+            if(pc.available())
+                dout << "," << result.cycles
+                    << "," << result.cache_misses
+                    << "," << result.branch_misses;
+            dout << "\n";
+            mops.push_back(m);
+            if(pc.available())
+                cpo.push_back(
+                    pc.cycles() / ops);
+            repeat = 250 * result.calls / result.millis;
+        }
+
+        double const med = median_of(mops);
+        double const spread = mad_of(mops, med);
+        strout << "Micro " << item.name <<
+            "," << toolset << " " << arch <<
+            ",boost" <<
+            "," << med << "," << spread << "\n";
+
+        object r;
+        r["test"] = "Micro";
+        r["name"] = item.name;
+        r["impl"] = "boost";
+        r["trials"] = mops.size();
+        r["mops_median"] = med;
+        r["mops_mad"] = spread;
+        if(pc.available())
+            r["cycles_per_op"] = median_of(cpo);
+        g_results.push_back(std::move(r));
+    }
+}
+
 } // json
 } // boost
 
@@ -989,6 +1596,8 @@ std::string s_tests = "ps";
 std::string s_impls = "bdrcn";
 std::size_t s_trials = 6;
 std::string s_branch = "";
+std::string s_json_path = "";
+int s_cpu = -1;
 
 static bool parse_option( char const* s )
 {
@@ -1031,6 +1640,21 @@ static bool parse_option( char const* s )
         s_branch = s;
         break;
 
+    case 'j':
+        s_json_path = s;
+        break;
+
+    case 'c':
+        {
+            int k = std::atoi( s );
+
+            if( k >= 0 )
+                s_cpu = k;
+            else
+                return false;
+        }
+        break;
+
     case 'm':
         switch( *s )
         {
@@ -1112,6 +1736,10 @@ static bool do_test( file_list const & vf, impl_list const & vi, char test )
         bench("Serialize", vf, vi, s_trials);
         break;
 
+    case 'm':
+        bench_micro(s_trials);
+        break;
+
     default:
         std::cerr << "Unknown test type: '" << test << "'\n";
         return false;
@@ -1130,8 +1758,9 @@ main(
         std::cerr <<
             "Usage: bench [options...] <file>...\n"
             "\n"
-            "Options:  -t:[p][s]            Test parsing, serialization or both\n"
-            "                                 (default both)\n"
+            "Options:  -t:[p][s][m]         Test parsing, serialization,\n"
+            "                                 microbenchmarks, or any combination\n"
+            "                                 (default parse and serialize)\n"
             "          -i:[b][d][r][c][n]   Test the specified implementations\n"
             "                                 (b: Boost.JSON, pool storage)\n"
             "                                 (d: Boost.JSON, default storage)\n"
@@ -1154,6 +1783,16 @@ main(
             "                                 (n: none)\n"
             "                                 (default imprecise)\n"
             "          -f                   Include file IO into consideration when testing parsers\n"
+            "          -c:<cpu>             Pin the benchmark to the given CPU\n"
+            "          -j:<file>            Also write results as JSON to <file>\n"
+            "\n"
+            "In place of a file, gen:<spec> synthesizes a seeded document whose\n"
+            "shape is controlled by comma-separated name=value fields:\n"
+            "nodes, keys, depth, strmin, strmax, numratio, seed. For example:\n"
+            "\n"
+            "    bench gen:nodes=10000,keys=64,depth=6,numratio=0.8,seed=1\n"
+            "\n"
+            "Generated documents are incompatible with the -f option.\n"
         ;
 
         return 4;
@@ -1170,13 +1809,32 @@ main(
             if( !parse_option( s+1 ) )
                 std::cerr << "Unrecognized or incorrect option: '" << s << "'\n";
         }
+        else if( std::strncmp( s, "gen:", 4 ) == 0 )
+        {
+            gen_params gp;
+            if( parse_gen_spec( s + 4, gp ) )
+            {
+                doc_generator g( gp );
+                vf.emplace_back( file_item{
+                    argv[i], serialize( g.generate() ) } );
+            }
+            else
+            {
+                std::cerr << "Malformed generator spec: '" << s << "'\n";
+            }
+        }
         else
         {
             vf.emplace_back( file_item{ argv[i], load_file( s ) } );
         }
     }
 
+    if( s_cpu >= 0 && ! pin_thread( s_cpu ) )
+        std::cerr << "Could not pin to CPU " << s_cpu << "\n";
+
+#ifndef BOOST_NO_EXCEPTIONS
     try
+#endif
     {
         impl_list vi;
 
@@ -1187,11 +1845,24 @@ main(
             do_test( vf, vi, ch );
 
         dout << "\n" << strout.str();
+
+        if( ! s_json_path.empty() )
+        {
+            object doc;
+            doc["toolset"] = toolset;
+            doc["arch"] = arch;
+            doc["exceptions"] = exceptions_config;
+            doc["results"] = std::move(g_results);
+            std::ofstream os( s_json_path );
+            os << doc << "\n";
+        }
     }
+#ifndef BOOST_NO_EXCEPTIONS
     catch(system_error const& se)
     {
         dout << se.what() << std::endl;
     }
+#endif
 
     return 0;
 }
@@ -0,0 +1,422 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+/*  Micro-benchmark for number conversions.
+
+    bench.cpp measures whole documents, where number
+    conversion is mixed with scanning, allocation, and
+    structure handling. This target times the two
+    conversion primitives in isolation:
+
+        detail::charconv::from_chars   (text to double)
+        detail::format_double          (double to text)
+
+    plus the integer formatters and the full text to
+    double to text round trip, sweeping digit counts,
+    exponent forms, and special values. Results are
+    reported in nanoseconds per conversion with the
+    distribution over the trials, so changes to the
+    conversion fast paths can be evaluated directly
+    instead of being inferred from document throughput.
+
+    Usage:
+
+        bench-numbers [-n:<trials>] [-r:<repeat>]
+
+    <trials> measured samples per case (default 9),
+    <repeat> passes over the batch per sample
+    (default 8).
+*/
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/charconv/from_chars.hpp>
+#include <boost/json/detail/format.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+using clock_type = std::chrono::steady_clock;
+
+// accumulators defeating dead code elimination
+double sink_d = 0;
+unsigned sink_u = 0;
+
+std::size_t batch_size = 4096;
+
+struct number_case
+{
+    std::string name;
+    std::vector<std::string> texts;
+};
+
+// distribution of one case's samples
+struct dist
+{
+    double mn;
+    double p50;
+    double p90;
+    double mx;
+};
+
+dist
+distribution(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    auto const at = [&](double q)
+    {
+        return v[static_cast<std::size_t>(
+            q * (v.size() - 1) + 0.5)];
+    };
+    return { v.front(), at(0.5),
+        at(0.9), v.back() };
+}
+
+void
+report(
+    char const* verb,
+    std::string const& name,
+    dist const& d)
+{
+    std::printf(
+        "%-10s %-16s ns/conv"
+        " min=%7.2f p50=%7.2f"
+        " p90=%7.2f max=%7.2f\n",
+        verb, name.c_str(),
+        d.mn, d.p50, d.p90, d.mx);
+}
+
+std::string
+random_digits(
+    std::mt19937_64& rng, int n)
+{
+    std::string s;
+    s += static_cast<char>(
+        '1' + rng() % 9);
+    for(int i = 1; i < n; ++i)
+        s += static_cast<char>(
+            '0' + rng() % 10);
+    return s;
+}
+
+/*  One batch per case, generated once with a
+    fixed seed so runs are comparable. Digit
+    counts cover the small fast path through
+    the full 17 significant digits, exponent
+    forms cover both the in-range fast path
+    and the large exponents which take the
+    slow path, and the specials include the
+    boundary values known to be hard for
+    binary-decimal conversion.
+*/
+std::vector<number_case>
+make_parse_cases()
+{
+    std::vector<number_case> v;
+    std::mt19937_64 rng(42);
+    for(int digits : {1, 5, 9, 17})
+    {
+        number_case c;
+        c.name = "fixed-" +
+            std::to_string(digits) + "d";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+        {
+            auto s = random_digits(
+                rng, digits);
+            if(digits > 1)
+                s.insert(1, 1, '.');
+            c.texts.push_back(s);
+        }
+        v.push_back(std::move(c));
+    }
+    for(int digits : {5, 19})
+    {
+        number_case c;
+        c.name = "int-" +
+            std::to_string(digits) + "d";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+            c.texts.push_back(
+                random_digits(rng, digits));
+        v.push_back(std::move(c));
+    }
+    {
+        number_case c;
+        c.name = "sci-small";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+        {
+            auto s = random_digits(rng, 7);
+            s.insert(1, 1, '.');
+            s += 'e';
+            s += std::to_string(
+                static_cast<int>(
+                    rng() % 40) - 20);
+            c.texts.push_back(s);
+        }
+        v.push_back(std::move(c));
+    }
+    {
+        number_case c;
+        c.name = "sci-large";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+        {
+            auto s = random_digits(rng, 17);
+            s.insert(1, 1, '.');
+            s += 'e';
+            s += std::to_string(
+                static_cast<int>(
+                    rng() % 600) - 300);
+            c.texts.push_back(s);
+        }
+        v.push_back(std::move(c));
+    }
+    {
+        number_case c;
+        c.name = "subnormal";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+        {
+            auto s = random_digits(rng, 10);
+            s.insert(1, 1, '.');
+            s += "e-310";
+            c.texts.push_back(s);
+        }
+        v.push_back(std::move(c));
+    }
+    {
+        static char const* const specials[] = {
+            "0", "-0.0", "1", "0.1", "0.5",
+            "1e308", "-1.7976931348623157e308",
+            "5e-324", "2.2250738585072011e-308",
+            "3.141592653589793", "1e-999", "1e999"
+        };
+        number_case c;
+        c.name = "specials";
+        for(std::size_t i = 0;
+            i < batch_size; ++i)
+            c.texts.push_back(specials[
+                i % (sizeof(specials) /
+                    sizeof(specials[0]))]);
+        v.push_back(std::move(c));
+    }
+    return v;
+}
+
+template<class F>
+std::vector<double>
+run_case(
+    std::size_t trials,
+    std::size_t repeat,
+    std::size_t batch,
+    F const& f)
+{
+    // warm caches and the branch predictor
+    // before the first measured sample
+    f();
+    std::vector<double> samples;
+    samples.reserve(trials);
+    for(std::size_t k = 0; k < trials; ++k)
+    {
+        auto const t0 = clock_type::now();
+        for(std::size_t r = 0;
+            r < repeat; ++r)
+            f();
+        auto const t1 = clock_type::now();
+        samples.push_back(
+            static_cast<double>(
+                std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(
+                        t1 - t0).count()) /
+            (static_cast<double>(repeat) *
+                static_cast<double>(batch)));
+    }
+    return samples;
+}
+
+} // namespace json
+} // namespace boost
+
+int
+main(int argc, char** argv)
+{
+    using namespace boost::json;
+
+    std::size_t trials = 9;
+    std::size_t repeat = 8;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strncmp(
+                argv[i], "-n:", 3) == 0)
+            trials = std::strtoul(
+                argv[i] + 3, nullptr, 10);
+        else if(std::strncmp(
+                argv[i], "-r:", 3) == 0)
+            repeat = std::strtoul(
+                argv[i] + 3, nullptr, 10);
+        else
+        {
+            std::fprintf(stderr,
+                "Usage: bench-numbers"
+                " [-n:<trials>]"
+                " [-r:<repeat>]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if(trials == 0 || repeat == 0)
+        return EXIT_FAILURE;
+
+    auto const cases = make_parse_cases();
+    std::printf(
+        "%zu trials, %zu x %zu"
+        " conversions per trial\n",
+        trials, repeat, batch_size);
+
+    // text to double
+    for(auto const& c : cases)
+    {
+        auto const samples = run_case(
+            trials, repeat, c.texts.size(),
+            [&c]
+            {
+                for(auto const& s : c.texts)
+                {
+                    double d;
+                    detail::charconv::from_chars(
+                        s.data(),
+                        s.data() + s.size(), d);
+                    sink_d += d;
+                }
+            });
+        report("parse", c.name,
+            distribution(samples));
+    }
+
+    // double to text, over the values the
+    // parse cases produce
+    for(auto const& c : cases)
+    {
+        std::vector<double> vals;
+        vals.reserve(c.texts.size());
+        for(auto const& s : c.texts)
+        {
+            double d = 0;
+            detail::charconv::from_chars(
+                s.data(),
+                s.data() + s.size(), d);
+            vals.push_back(d);
+        }
+        auto const samples = run_case(
+            trials, repeat, vals.size(),
+            [&vals]
+            {
+                char buf[
+                    detail::max_number_chars + 1];
+                for(double d : vals)
+                    sink_u +=
+                        detail::format_double(
+                            buf, d, true);
+            });
+        report("format", c.name,
+            distribution(samples));
+
+        auto const rt = run_case(
+            trials, repeat, vals.size(),
+            [&vals]
+            {
+                char buf[
+                    detail::max_number_chars + 1];
+                for(double d : vals)
+                {
+                    auto const n =
+                        detail::format_double(
+                            buf, d, true);
+                    double e;
+                    detail::charconv::from_chars(
+                        buf, buf + n, e);
+                    sink_d += e;
+                }
+            });
+        report("roundtrip", c.name,
+            distribution(rt));
+    }
+
+    // the integer formatters
+    {
+        std::mt19937_64 rng(42);
+        for(int digits : {1, 10, 19})
+        {
+            std::vector<std::uint64_t> vals;
+            vals.reserve(batch_size);
+            for(std::size_t i = 0;
+                i < batch_size; ++i)
+            {
+                auto const s = random_digits(
+                    rng, digits);
+                vals.push_back(std::strtoull(
+                    s.c_str(), nullptr, 10));
+            }
+            auto const name = "uint64-" +
+                std::to_string(digits) + "d";
+            auto const samples = run_case(
+                trials, repeat, vals.size(),
+                [&vals]
+                {
+                    char buf[
+                        detail::max_number_chars + 1];
+                    for(auto u : vals)
+                        sink_u +=
+                            detail::format_uint64(
+                                buf, u);
+                });
+            report("format", name,
+                distribution(samples));
+
+            std::vector<std::int64_t> ivals;
+            ivals.reserve(vals.size());
+            for(auto u : vals)
+                ivals.push_back(
+                    (u & 1) != 0 ?
+                    -static_cast<std::int64_t>(
+                        u >> 1) :
+                    static_cast<std::int64_t>(
+                        u >> 1));
+            auto const iname = "int64-" +
+                std::to_string(digits) + "d";
+            auto const isamples = run_case(
+                trials, repeat, ivals.size(),
+                [&ivals]
+                {
+                    char buf[
+                        detail::max_number_chars + 1];
+                    for(auto i : ivals)
+                        sink_u +=
+                            detail::format_int64(
+                                buf, i);
+                });
+            report("format", iname,
+                distribution(isamples));
+        }
+    }
+
+    // keep the accumulators observable
+    std::fprintf(stderr,
+        "checksum %g %u\n", sink_d, sink_u);
+    return EXIT_SUCCESS;
+}
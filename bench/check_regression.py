@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Official repository: https://github.com/boostorg/json
+#
+"""Compare bench results against a per-machine baseline.
+
+Reads the JSON emitted by `bench -j:<file>` and compares each
+(test, file, impl) entry's median throughput against a recorded
+baseline for this machine. Baselines are keyed by a fingerprint
+of the host, CPU model, toolset, and architecture so results from
+different machines never gate each other. Exits nonzero with a
+report when any entry regresses beyond the threshold.
+
+With --parity, the results are instead compared against a second
+results file from the same machine, such as a run of the
+-fno-exceptions build against the normal one, and the check fails
+when --results falls behind --parity beyond the threshold.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import platform
+import socket
+import sys
+
+
+def cpu_model():
+    try:
+        with open('/proc/cpuinfo') as f:
+            for line in f:
+                if line.startswith('model name'):
+                    return line.split(':', 1)[1].strip()
+    except OSError:
+        pass
+    return platform.processor() or platform.machine()
+
+
+def fingerprint(results):
+    parts = [
+        socket.gethostname(),
+        cpu_model(),
+        results.get('toolset', ''),
+        results.get('arch', ''),
+    ]
+    digest = hashlib.sha256(
+        '|'.join(parts).encode()).hexdigest()[:16]
+    return digest, parts
+
+
+def entry_key(r):
+    # microbenchmarks have a name, corpus entries a file
+    return (r.get('test', ''),
+            os.path.basename(r.get('file', r.get('name', ''))),
+            r.get('impl', ''))
+
+
+def entry_value(r):
+    return r.get('mbs_median', r.get('mops_median', 0))
+
+
+def check_parity(results, args):
+    with open(args.parity) as f:
+        other = json.load(f)
+
+    this_cfg = results.get('exceptions', '?')
+    other_cfg = other.get('exceptions', '?')
+    print('parity: %s (results) vs %s (reference)' % (
+        this_cfg, other_cfg))
+
+    ref = {entry_key(r): entry_value(r)
+           for r in other['results']}
+
+    failures = []
+    for r in results['results']:
+        key = entry_key(r)
+        if key not in ref or ref[key] <= 0:
+            continue
+        cur = entry_value(r)
+        change = (cur - ref[key]) / ref[key]
+        status = 'ok'
+        if change < -args.threshold:
+            status = 'BEHIND'
+            failures.append(key)
+        print('%-10s %-24s %-20s %10.1f -> %10.1f  %+6.1f%%  %s' % (
+            key[0], key[1], key[2],
+            ref[key], cur, 100 * change, status))
+
+    if failures:
+        print('\n%d entr%s behind the %s build beyond %.0f%%' % (
+            len(failures),
+            'y is' if len(failures) == 1 else 'ies are',
+            other_cfg, 100 * args.threshold))
+        return 1
+    print('\nparity holds within %.0f%%' % (100 * args.threshold))
+    return 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument('--results', required=True,
+                    help='JSON file written by bench -j:<file>')
+    ap.add_argument('--baseline-dir',
+                    help='directory holding per-machine baselines')
+    ap.add_argument('--threshold', type=float, default=0.05,
+                    help='allowed fractional drop (default 0.05)')
+    ap.add_argument('--update', action='store_true',
+                    help='record the results as the new baseline')
+    ap.add_argument('--parity', metavar='OTHER',
+                    help='second results file to compare against '
+                         'instead of a recorded baseline')
+    args = ap.parse_args()
+
+    with open(args.results) as f:
+        results = json.load(f)
+
+    if args.parity:
+        return check_parity(results, args)
+
+    if not args.baseline_dir:
+        ap.error('--baseline-dir is required '
+                 'unless --parity is given')
+
+    digest, parts = fingerprint(results)
+    path = os.path.join(
+        args.baseline_dir, digest + '.json')
+
+    if args.update:
+        os.makedirs(args.baseline_dir, exist_ok=True)
+        with open(path, 'w') as f:
+            json.dump({
+                'machine': parts,
+                'results': results['results'],
+            }, f, indent=1)
+        print('baseline written: %s' % path)
+        return 0
+
+    if not os.path.exists(path):
+        print('no baseline for this machine (%s)' % ' | '.join(parts))
+        print('record one with --update '
+              '(cmake target: bench-baseline)')
+        return 2
+
+    with open(path) as f:
+        baseline = json.load(f)
+    base = {entry_key(r): entry_value(r)
+            for r in baseline['results']}
+
+    failures = []
+    for r in results['results']:
+        key = entry_key(r)
+        if key not in base or base[key] <= 0:
+            continue
+        cur = entry_value(r)
+        change = (cur - base[key]) / base[key]
+        status = 'ok'
+        if change < -args.threshold:
+            status = 'REGRESSED'
+            failures.append(key)
+        print('%-10s %-24s %-20s %10.1f -> %10.1f  %+6.1f%%  %s' % (
+            key[0], key[1], key[2],
+            base[key], cur, 100 * change, status))
+
+    if failures:
+        print('\n%d entr%s regressed beyond %.0f%%' % (
+            len(failures),
+            'y' if len(failures) == 1 else 'ies',
+            100 * args.threshold))
+        return 1
+    print('\nno regressions beyond %.0f%%' % (100 * args.threshold))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
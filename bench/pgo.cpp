@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+/*  Training run for profile-guided builds.
+
+    This program exercises the hot paths of the
+    library over each file named on the command
+    line, covering the combinations which matter
+    for branch profiles: one-shot and chunked
+    parsing, precise and imprecise numbers, and
+    serialization of the resulting trees. It is
+    run by the `boost_json_pgo` CMake target over
+    the sample corpus in bench/data to produce
+    the profile consumed by the optimized build;
+    it is not a benchmark and measures nothing.
+*/
+
+#include <boost/json.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace json = boost::json;
+
+static
+std::string
+load_file(char const* path)
+{
+    FILE* f = fopen(path, "rb");
+    if(! f)
+        return {};
+    fseek(f, 0, SEEK_END);
+    auto const size = ftell(f);
+    std::string s;
+    s.resize(size);
+    fseek(f, 0, SEEK_SET);
+    auto const nread =
+        fread(&s[0], 1, size, f);
+    s.resize(nread);
+    fclose(f);
+    return s;
+}
+
+static
+void
+train(json::string_view sv)
+{
+    // one-shot parse, default options;
+    // this takes the full-buffer fast path
+    json::error_code ec;
+    auto jv = json::parse(sv, ec);
+    if(ec.failed())
+        return;
+
+    // the resumable parser, fed in chunks
+    {
+        json::stream_parser p;
+        std::size_t const chunk = 4096;
+        for(std::size_t i = 0; i < sv.size();
+            i += chunk)
+        {
+            p.write(sv.data() + i,
+                (std::min)(chunk,
+                    sv.size() - i), ec);
+            if(ec.failed())
+                break;
+        }
+        if(! ec.failed())
+        {
+            p.finish(ec);
+            if(! ec.failed())
+                p.release();
+        }
+    }
+
+    // precise number conversion
+    {
+        json::parse_options opt;
+        opt.numbers =
+            json::number_precision::precise;
+        json::parse(sv, ec, {}, opt);
+    }
+
+    // serialization, compact and pretty
+    auto const s1 = json::serialize(jv);
+    json::serialize_options sopt;
+    sopt.pretty = true;
+    auto const s2 = json::serialize(jv, sopt);
+
+    // round-trip the serialized forms
+    json::parse(s1, ec);
+    json::parse(s2, ec);
+}
+
+int
+main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::cerr <<
+            "Usage: pgo <file.json>...\n";
+        return EXIT_FAILURE;
+    }
+    for(int i = 1; i < argc; ++i)
+    {
+        auto const s = load_file(argv[i]);
+        if(s.empty())
+        {
+            std::cerr << "pgo: cannot read "
+                << argv[i] << "\n";
+            return EXIT_FAILURE;
+        }
+        train(s);
+    }
+    return EXIT_SUCCESS;
+}
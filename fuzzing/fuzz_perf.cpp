@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2020 Paul Dreik (github@pauldreik.se)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Performance fuzzing: instead of looking for
+// crashes, this target treats excessive parse
+// cost per input byte as a failure, so the
+// fuzzer searches for algorithmic worst cases
+// (clustered keys, deep nesting, pathological
+// numbers). Slow inputs are reported the same
+// way crashes are and should be minimized and
+// checked into bench/data as adversarial
+// corpus files.
+
+#include <boost/json/parse.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace boost::json;
+
+// inputs below this size make the
+// per-byte ratio meaningless
+static const size_t min_size = 64;
+
+// the allowed cost in nanoseconds per input
+// byte; the default is roughly two orders of
+// magnitude above a typical parse, so only
+// genuinely pathological inputs trip it.
+// override with BOOST_JSON_FUZZ_NS_PER_BYTE
+// when calibrating for a particular machine.
+static double
+threshold_ns_per_byte()
+{
+    static double const v = []
+    {
+        char const* s = std::getenv(
+            "BOOST_JSON_FUZZ_NS_PER_BYTE");
+        if(s)
+            return std::atof(s);
+        return 2000.0;
+    }();
+    return v;
+}
+
+extern "C"
+int
+LLVMFuzzerTestOneInput(
+    const uint8_t* data, size_t size)
+{
+    if(size < min_size)
+        return 0;
+    try
+    {
+        string_view s{reinterpret_cast<
+            const char*>(data), size};
+        auto const t0 = std::chrono::
+            steady_clock::now();
+        error_code ec;
+        value jv = parse( s, ec );
+        auto const t1 = std::chrono::
+            steady_clock::now();
+        double const ns_per_byte =
+            static_cast<double>(
+                std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(
+                        t1 - t0).count()) /
+            static_cast<double>(size);
+        if(ns_per_byte >
+            threshold_ns_per_byte())
+        {
+            std::fprintf(stderr,
+                "slow input: %.1f ns/byte "
+                "over %zu bytes (limit %.1f)\n",
+                ns_per_byte, size,
+                threshold_ns_per_byte());
+            std::abort();
+        }
+    }
+    catch(...)
+    {
+    }
+    return 0;
+}
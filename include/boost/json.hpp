@@ -14,34 +14,79 @@
 
 #include <boost/json/array.hpp>
 #include <boost/json/basic_parser.hpp>
+#include <boost/json/big_number.hpp>
+#include <boost/json/cbor.hpp>
+#include <boost/json/compare.hpp>
 #include <boost/json/conversion.hpp>
+#include <boost/json/disposer.hpp>
 #include <boost/json/error.hpp>
+#include <boost/json/escape.hpp>
+#include <boost/json/estimate.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/filter.hpp>
 #include <boost/json/fwd.hpp>
 #include <boost/json/kind.hpp>
+#include <boost/json/lazy_value.hpp>
+#include <boost/json/literals.hpp>
 #include <boost/json/memory_resource.hpp>
+#include <boost/json/metrics.hpp>
 #include <boost/json/monotonic_resource.hpp>
+#include <boost/json/msgpack.hpp>
+#include <boost/json/multi_parser.hpp>
+#include <boost/json/ndjson.hpp>
 #include <boost/json/null_resource.hpp>
+#include <boost/json/number_array.hpp>
 #include <boost/json/object.hpp>
+#include <boost/json/packed_value.hpp>
 #include <boost/json/parse.hpp>
+#include <boost/json/parse_batch.hpp>
 #include <boost/json/parse_into.hpp>
+#include <boost/json/parse_numbers.hpp>
 #include <boost/json/parse_options.hpp>
+#include <boost/json/parse_parallel.hpp>
 #include <boost/json/parser.hpp>
+#include <boost/json/patch.hpp>
+#include <boost/json/path_query.hpp>
 #include <boost/json/pilfer.hpp>
+#include <boost/json/pointer.hpp>
+#include <boost/json/pooled_resource.hpp>
+#include <boost/json/raw_number.hpp>
+#include <boost/json/reformat.hpp>
+#include <boost/json/reparse.hpp>
+#include <boost/json/reserved_resource.hpp>
+#include <boost/json/scan.hpp>
 #include <boost/json/serialize.hpp>
+#include <boost/json/serialize_into.hpp>
+#include <boost/json/serialized_template.hpp>
 #include <boost/json/serializer.hpp>
 #include <boost/json/set_pointer_options.hpp>
+#include <boost/json/shared_value.hpp>
+#include <boost/json/small_document.hpp>
+#include <boost/json/snapshot.hpp>
+#include <boost/json/sorted_view.hpp>
+#include <boost/json/static_object.hpp>
 #include <boost/json/static_resource.hpp>
 #include <boost/json/storage_ptr.hpp>
+#include <boost/json/stream_extractor.hpp>
 #include <boost/json/stream_parser.hpp>
 #include <boost/json/string.hpp>
+#include <boost/json/string_builder.hpp>
+#include <boost/json/string_table.hpp>
 #include <boost/json/string_view.hpp>
 #include <boost/json/system_error.hpp>
+#include <boost/json/thread_local_resource.hpp>
+#include <boost/json/trace.hpp>
+#include <boost/json/tracing_resource.hpp>
+#include <boost/json/unescape.hpp>
+#include <boost/json/validate.hpp>
 #include <boost/json/value.hpp>
 #include <boost/json/value_from.hpp>
 #include <boost/json/value_ref.hpp>
 #include <boost/json/value_stack.hpp>
 #include <boost/json/value_to.hpp>
+#include <boost/json/value_transaction.hpp>
 #include <boost/json/visit.hpp>
+#include <boost/json/writer.hpp>
 
 // Intentionally excluded
 //#include <boost/json/basic_parser_impl.hpp>
@@ -14,7 +14,10 @@
 #include <boost/json/kind.hpp>
 #include <boost/json/pilfer.hpp>
 #include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
 #include <boost/json/detail/array.hpp>
+#include <boost/json/detail/value.hpp>
+#include <cstdint>
 #include <cstdlib>
 #include <initializer_list>
 #include <iterator>
@@ -86,6 +89,7 @@ class array
     class revert_construct;
     class revert_insert;
     friend class value;
+    friend struct detail::access;
 
     storage_ptr sp_;        // must come first
     kind k_ = kind::array;  // must come second
@@ -273,6 +277,57 @@ public:
         std::size_t count,
         storage_ptr sp = {});
 
+    /** Constructor.
+
+        The array is constructed with `count`
+        numbers copied from the contiguous
+        range starting at `first`, using the
+        specified memory resource. The storage
+        is allocated once and the elements are
+        constructed in place, which is faster
+        than inserting numbers one at a time.
+
+        @par Complexity
+        Linear in `count`
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @par Constraints
+
+        @code
+        std::is_same_v<T, double> ||
+        std::is_same_v<T, std::int64_t> ||
+        std::is_same_v<T, std::uint64_t>
+        @endcode
+
+        @param first A pointer to the first
+        number to insert.
+
+        @param count The number of elements
+        to insert.
+
+        @param sp A pointer to the @ref memory_resource
+        to use. The container will acquire shared
+        ownership of the memory resource.
+
+        @tparam T The type of the numbers.
+    */
+    template<
+        class T
+    #ifndef BOOST_JSON_DOCS
+        ,class = typename std::enable_if<
+            std::is_same<T, double>::value ||
+            std::is_same<T, std::int64_t>::value ||
+            std::is_same<T, std::uint64_t>::value>::type
+    #endif
+    >
+    array(
+        T const* first,
+        std::size_t count,
+        storage_ptr sp = {});
+
     /** Constructor.
 
         The array is constructed with the elements
@@ -783,6 +838,99 @@ public:
     value*
     if_contains(std::size_t pos) noexcept;
 
+    /** Invoke a function for each element.
+
+        This function invokes `f` once for each
+        element of the array in order, passing a
+        reference to the element. It is equivalent
+        to a range-based for loop over the array,
+        except that while one element is being
+        visited, the payload of an upcoming element
+        is prefetched into cache. Elements of kind
+        @ref array, @ref object, and @ref string
+        store their contents in a separately
+        allocated region; touching that region from
+        `f` otherwise stalls on a dependent load,
+        which dominates traversal time for large
+        arrays whose payloads are scattered in
+        memory.
+
+        @par Complexity
+        Linear in `size()`.
+
+        @par Exception Safety
+        `f(value&)` may throw; elements already
+        visited stay visited.
+
+        @param f The function to invoke.
+    */
+    /** @{ */
+    template<class F>
+    void
+    for_each(F&& f);
+
+    template<class F>
+    void
+    for_each(F&& f) const;
+    /** @} */
+
+    /** Copy the elements of a matching kind to a buffer.
+
+        These functions scan the elements in order
+        and copy the underlying number or character
+        range of every element of the corresponding
+        kind into `dest`, skipping elements of any
+        other kind, until all elements have been
+        visited or `dest_size` results have been
+        written. The single kind test per element
+        replaces the `is_double()` plus
+        `get_double()` pair otherwise needed in a
+        caller's loop, and the loop body carries no
+        function calls, allowing extraction from
+        large homogeneous arrays to vectorize.
+
+        For `copy_strings`, each result is a
+        @ref string_view into the corresponding
+        element; the views are valid until the
+        element is changed or destroyed. An array
+        can never produce more results than
+        `size()`, so a destination with that
+        capacity is always sufficient.
+
+        @par Complexity
+        Linear in `size()`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @return The number of results written
+        to `dest`.
+
+        @param dest The destination to write to.
+
+        @param dest_size The maximum number of
+        results to write.
+    */
+    /** @{ */
+    BOOST_JSON_DECL
+    std::size_t
+    copy_doubles(
+        double* dest,
+        std::size_t dest_size) const noexcept;
+
+    BOOST_JSON_DECL
+    std::size_t
+    copy_int64s(
+        std::int64_t* dest,
+        std::size_t dest_size) const noexcept;
+
+    BOOST_JSON_DECL
+    std::size_t
+    copy_strings(
+        string_view* dest,
+        std::size_t dest_size) const noexcept;
+    /** @} */
+
     //------------------------------------------------------
     //
     // Iterators
@@ -1050,8 +1198,12 @@ public:
 
         This increases the @ref capacity() to a value
         that is greater than or equal to `new_capacity`.
-        If `new_capacity > capacity()`, new memory is
-        allocated. Otherwise, the call has no effect.
+        If `new_capacity > capacity()`, exactly
+        `new_capacity` elements of storage are
+        allocated; the geometric growth applied by
+        insertions does not participate, so callers
+        which know the final size in advance incur
+        no slack. Otherwise, the call has no effect.
         The number of elements and therefore the
         @ref size() of the container is not changed.
     \n
@@ -1080,7 +1232,11 @@ public:
 
         This performs a non-binding request to reduce the
         capacity to the current size. The request may or
-        may not be fulfilled. If reallocation occurs, all
+        may not be fulfilled. In particular, no attempt
+        is made when the memory resource does not benefit
+        from deallocation, such as @ref monotonic_resource,
+        since reallocating there can only consume more
+        storage. If reallocation occurs, all
         iterators including any past-the-end iterators,
         and all references to the elements are invalidated.
         Otherwise, no iterators or references are
@@ -1390,6 +1546,70 @@ public:
         const_iterator first,
         const_iterator last) noexcept;
 
+    /** Remove all elements matching a predicate.
+
+        Remove every element for which `pred`
+        returns `true`, compacting the
+        surviving elements in one pass.
+        Removing the same elements one by one
+        with @ref erase relocates the whole
+        tail once per call; this performs one
+        traversal regardless of how many
+        elements match. The relative order of
+        the remaining elements is preserved.
+        Iterators and references from the
+        first removed element to @ref end()
+        are invalidated.
+
+        @par Complexity
+        Linear in @ref size().
+
+        @par Exception Safety
+        Basic guarantee.
+        If the predicate throws, the elements
+        for which it already returned `true`
+        have been removed and the array
+        remains valid.
+
+        @return The number of elements removed.
+
+        @param pred A callable invocable with
+        `value&` and returning `bool`.
+    */
+    template<class Pred>
+    std::size_t
+    remove_if(Pred&& pred);
+
+    /** Remove an element and return it.
+
+        The element at `pos` is removed from the
+        container and returned. The element is
+        transferred by pilfering; no deep copy is
+        made regardless of the size of the subtree,
+        and the result shares ownership of the
+        memory resource. Closing the gap left by
+        the element relocates the elements after
+        it, which invalidates iterators and
+        references from `pos` to @ref end().
+
+        @par Complexity
+        Constant plus linear in
+        `std::distance(begin() + pos, end())`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw system_error `pos >= size()`
+
+        @param pos A zero-based index of the
+        element to remove.
+
+        @return The removed element.
+    */
+    BOOST_JSON_DECL
+    value
+    extract(std::size_t pos);
+
     /** Add an element to the end.
 
         This appends a copy of `v` to the container's
@@ -1466,6 +1686,53 @@ public:
     value&
     emplace_back(Arg&& arg);
 
+    /** Append numbers from a contiguous range.
+
+        Appends `count` elements to the end of
+        the container, copied from the
+        contiguous range starting at `first`.
+        The storage is grown at most once and
+        the elements are constructed in place,
+        which is faster than inserting numbers
+        one at a time.
+        If `capacity() < size() + count`,
+        a reallocation occurs first, and all
+        iterators and references are
+        invalidated.
+
+        @par Complexity
+        Linear in `count`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param first A pointer to the first
+        number to append.
+
+        @param count The number of elements
+        to append.
+    */
+    BOOST_JSON_DECL
+    void
+    append(
+        double const* first,
+        std::size_t count);
+
+    /// @copydoc append(double const*, std::size_t)
+    BOOST_JSON_DECL
+    void
+    append(
+        std::int64_t const* first,
+        std::size_t count);
+
+    /// @copydoc append(double const*, std::size_t)
+    BOOST_JSON_DECL
+    void
+    append(
+        std::uint64_t const* first,
+        std::size_t count);
+
     /** Remove the last element
 
         The last element of the container is erased.
@@ -1712,6 +1979,11 @@ private:
     reserve_impl(
         std::size_t new_capacity);
 
+    BOOST_JSON_DECL
+    void
+    reserve_exact(
+        std::size_t new_capacity);
+
     BOOST_JSON_DECL
     value&
     push_back(
@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_ASIO_HPP
+#define BOOST_JSON_ASIO_HPP
+
+/*
+
+This header adapts the library to Boost.Asio
+streams. It is not included by <boost/json.hpp>
+so that the library keeps no dependency on
+Asio; include it only in programs which already
+use Asio.
+
+*/
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/serializer.hpp>
+#include <boost/json/stream_parser.hpp>
+#include <boost/json/value.hpp>
+
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/write.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// chunks are read directly into this much
+// scratch and fed to the parser in place
+std::size_t constexpr asio_buffer_size = 65536;
+
+template<class AsyncReadStream>
+class async_parse_op
+{
+    AsyncReadStream& stream_;
+    stream_parser& p_;
+    std::unique_ptr<char[]> buf_;
+
+public:
+    async_parse_op(
+        AsyncReadStream& stream,
+        stream_parser& p)
+        : stream_(stream)
+        , p_(p)
+    {
+    }
+
+    template<class Self>
+    void
+    operator()(
+        Self& self,
+        error_code ec = {},
+        std::size_t n = 0)
+    {
+        if(! buf_)
+        {
+            // first invocation
+            buf_.reset(new char[
+                asio_buffer_size]);
+            stream_.async_read_some(
+                asio::buffer(buf_.get(),
+                    asio_buffer_size),
+                std::move(self));
+            return;
+        }
+
+        if(ec == asio::error::eof)
+        {
+            error_code jec;
+            p_.finish(jec);
+            if(jec)
+                return self.complete(jec, value());
+            return self.complete(
+                error_code(), p_.release());
+        }
+        if(ec)
+            return self.complete(ec, value());
+
+        error_code jec;
+        p_.write(buf_.get(), n, jec);
+        if(jec)
+            return self.complete(jec, value());
+        if(p_.done())
+            return self.complete(
+                error_code(), p_.release());
+
+        stream_.async_read_some(
+            asio::buffer(buf_.get(),
+                asio_buffer_size),
+            std::move(self));
+    }
+};
+
+template<class AsyncWriteStream>
+class async_serialize_op
+{
+    AsyncWriteStream& stream_;
+    serializer& sr_;
+    std::unique_ptr<char[]> buf_;
+    std::size_t total_ = 0;
+
+public:
+    async_serialize_op(
+        AsyncWriteStream& stream,
+        serializer& sr)
+        : stream_(stream)
+        , sr_(sr)
+    {
+    }
+
+    template<class Self>
+    void
+    operator()(
+        Self& self,
+        error_code ec = {},
+        std::size_t n = 0)
+    {
+        total_ += n;
+        if(ec)
+            return self.complete(ec, total_);
+        if(buf_ && sr_.done())
+            return self.complete(
+                error_code(), total_);
+        if(! buf_)
+            buf_.reset(new char[
+                asio_buffer_size]);
+        string_view const sv = sr_.read(
+            buf_.get(), asio_buffer_size);
+        asio::async_write(stream_,
+            asio::buffer(sv.data(), sv.size()),
+            std::move(self));
+    }
+};
+
+} // detail
+
+/** Parse one JSON text asynchronously from a stream.
+
+    This composed operation reads from the
+    stream and feeds each chunk straight into
+    the supplied parser, with no intermediate
+    queueing, until the parser reports a
+    complete document or the stream reaches
+    end of file. The completion handler is
+    invoked with the result of
+    `p.release()`.
+
+    If the document ends before the stream
+    does, bytes read past it in the final
+    chunk are discarded; use a framing layer
+    when several documents share a stream.
+
+    The caller is responsible for ensuring
+    that `stream` and `p` remain valid until
+    the handler is invoked.
+
+    @par Example
+    @code
+    stream_parser p;
+    value jv = co_await async_parse(
+        socket, p, asio::use_awaitable );
+    @endcode
+
+    @param stream The stream to read from. The
+    type must meet the requirements of
+    Asio's `AsyncReadStream`.
+
+    @param p The parser to use. Call
+    @ref stream_parser::reset first to select
+    the storage for the resulting value.
+
+    @param token The completion token to use.
+    The completion signature is
+    `void( error_code, value )`.
+*/
+template<
+    class AsyncReadStream,
+    class CompletionToken>
+auto
+async_parse(
+    AsyncReadStream& stream,
+    stream_parser& p,
+    CompletionToken&& token) ->
+    decltype(asio::async_compose<
+        CompletionToken,
+        void(error_code, value)>(
+            detail::async_parse_op<
+                AsyncReadStream>(stream, p),
+            token, stream))
+{
+    return asio::async_compose<
+        CompletionToken,
+        void(error_code, value)>(
+            detail::async_parse_op<
+                AsyncReadStream>(stream, p),
+            token, stream);
+}
+
+/** Serialize a value asynchronously to a stream.
+
+    This composed operation repeatedly fills a
+    buffer from the supplied serializer and
+    writes it to the stream until serialization
+    is complete. The completion handler is
+    invoked with the number of bytes written.
+
+    The caller is responsible for ensuring
+    that `stream` and `sr` remain valid, and
+    that the value bound to `sr` is not
+    modified, until the handler is invoked.
+
+    @par Example
+    @code
+    serializer sr;
+    sr.reset( &jv );
+    std::size_t n = co_await async_serialize(
+        socket, sr, asio::use_awaitable );
+    @endcode
+
+    @param stream The stream to write to. The
+    type must meet the requirements of
+    Asio's `AsyncWriteStream`.
+
+    @param sr The serializer to use. Call
+    @ref serializer::reset first to select
+    the value to serialize.
+
+    @param token The completion token to use.
+    The completion signature is
+    `void( error_code, std::size_t )`.
+*/
+template<
+    class AsyncWriteStream,
+    class CompletionToken>
+auto
+async_serialize(
+    AsyncWriteStream& stream,
+    serializer& sr,
+    CompletionToken&& token) ->
+    decltype(asio::async_compose<
+        CompletionToken,
+        void(error_code, std::size_t)>(
+            detail::async_serialize_op<
+                AsyncWriteStream>(stream, sr),
+            token, stream))
+{
+    return asio::async_compose<
+        CompletionToken,
+        void(error_code, std::size_t)>(
+            detail::async_serialize_op<
+                AsyncWriteStream>(stream, sr),
+            token, stream);
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -20,10 +20,114 @@
 #include <boost/json/detail/stream.hpp>
 #include <boost/json/detail/utf8.hpp>
 #include <boost/json/detail/sbo_buffer.hpp>
+#include <atomic>
+#include <utility>
 
 namespace boost {
 namespace json {
 
+/** The result type of a handler event.
+
+    Handler event functions may return this type
+    instead of `bool` to give the parser additional
+    instructions. A directive constructed from a
+    `bool` behaves exactly like the `bool` itself:
+    `true` continues the parse and `false` stops it
+    with the error set by the handler. The value
+    returned by @ref skip additionally instructs
+    the parser to fast-forward over the current
+    value without generating events for it.
+
+    @see @ref basic_parser
+*/
+class parse_directive
+{
+    enum kind : unsigned char
+    {
+        stop_,
+        continue_,
+        skip_
+    };
+
+    kind v_;
+
+    constexpr
+    explicit
+    parse_directive(kind v) noexcept
+        : v_(v)
+    {
+    }
+
+public:
+    /** Constructor.
+
+        A directive constructed from `true` continues
+        the parse; one constructed from `false` stops
+        it, exactly as if the handler had returned
+        the `bool` directly.
+
+        @param ok `true` to continue the parse.
+    */
+    constexpr
+    parse_directive(bool ok) noexcept
+        : v_(ok ? continue_ : stop_)
+    {
+    }
+
+    /** Return `true` unless the directive stops the parse.
+    */
+    constexpr
+    operator bool() const noexcept
+    {
+        return v_ != stop_;
+    }
+
+    /** Return a directive which skips the current value.
+
+        When returned from `on_object_begin`,
+        `on_array_begin`, or `on_key`, the parser
+        fast-forwards over the skipped value using
+        purely structural scanning and emits no
+        events for its contents. The directive is
+        equivalent to returning `true` from any
+        other event function.
+    */
+    static
+    constexpr
+    parse_directive
+    skip() noexcept
+    {
+        return parse_directive(skip_);
+    }
+
+    /** Return `true` if the directive requests a skip.
+    */
+    constexpr
+    bool
+    skip_requested() const noexcept
+    {
+        return v_ == skip_;
+    }
+};
+
+namespace detail {
+
+constexpr
+bool
+wants_skip(bool) noexcept
+{
+    return false;
+}
+
+constexpr
+bool
+wants_skip(parse_directive d) noexcept
+{
+    return d.skip_requested();
+}
+
+} // detail
+
 /** An incremental SAX parser for serialized JSON.
 
     This implements a SAX-style parser, invoking a
@@ -80,6 +184,19 @@ namespace json {
     the error code to a suitable value. This error
     code will be returned by the write function to
     the caller.
+\n
+    Event functions may alternatively return
+    @ref parse_directive, which converts to and
+    from `bool`. Returning
+    `parse_directive::skip()` from `on_object_begin`,
+    `on_array_begin`, or `on_key` causes the parser
+    to fast-forward over the corresponding value
+    using purely structural scanning: no events are
+    generated for the skipped contents, and numbers,
+    escape sequences, and UTF-8 within them are not
+    validated. Balanced `on_object_end` or
+    `on_array_end` events with a count of zero are
+    still delivered for skipped containers.
 \n
     Handlers are required to declare the maximum
     limits on various elements. If these limits
@@ -260,7 +377,175 @@ namespace json {
 
     @headerfile <boost/json/basic_parser.hpp>
 */
+/** Parser options fixed at compile time.
+
+    This type can be used as the second template
+    parameter of @ref basic_parser to select the
+    non-standard extensions and the number mode
+    at compile time instead of at run time. The
+    flag checks inside the parse loops become
+    constants, so the branches for the unused
+    configurations are removed entirely. This
+    suits deployments which use exactly one
+    configuration; programs that choose options
+    dynamically should keep the default, which
+    stores @ref parse_options and dispatches at
+    run time.
+
+    The structure is layout-compatible with the
+    subset of @ref parse_options that the parser
+    reads: the fixed flags are static constants
+    supplied by the template parameters, while
+    `max_depth` remains an ordinary member.
+    When the parser is constructed, only the
+    dynamic members are taken from the
+    @ref parse_options argument; the flags it
+    carries are ignored in favor of the template
+    parameters.
+
+    The `InlineDepth` parameter sizes the
+    storage the parser embeds for its suspend
+    stack: a parser whose `max_depth` does not
+    exceed it never allocates that stack from
+    the heap. Deployments whose documents
+    reliably nest deeper than the default can
+    raise both together to keep parser
+    construction and parsing allocation-free.
+
+    @see @ref basic_parser, @ref parse_options.
+*/
+template<
+    bool AllowComments = false,
+    bool AllowTrailingCommas = false,
+    bool AllowInvalidUTF8 = false,
+    bool AllowInfinityAndNan = false,
+    number_precision Numbers =
+        number_precision::imprecise,
+    std::size_t InlineDepth = 32>
+struct static_options
+{
+    /// Non-standard extension option
+    static constexpr bool allow_comments =
+        AllowComments;
+
+    /// Non-standard extension option
+    static constexpr bool allow_trailing_commas =
+        AllowTrailingCommas;
+
+    /// Non-standard extension option
+    static constexpr bool allow_invalid_utf8 =
+        AllowInvalidUTF8;
+
+    /// Non-standard extension option
+    static constexpr bool allow_infinity_and_nan =
+        AllowInfinityAndNan;
+
+    /// Number conversion mode
+    static constexpr number_precision numbers =
+        Numbers;
+
+    /// Nesting depth covered by the parser's inline suspend stack
+    static constexpr std::size_t inline_depth =
+        InlineDepth;
+
+    /// Maximum nesting level of structures
+    std::size_t max_depth = 32;
+
+    constexpr
+    static_options() = default;
+
+    /// Adopt the dynamic members of `opt`.
+    constexpr
+    static_options(
+        parse_options const& opt) noexcept
+        : max_depth(opt.max_depth)
+    {
+    }
+};
+
+namespace detail {
+
+// the nesting depth covered by the parser's
+// inline suspend stack: taken from the options
+// type when it provides one, otherwise the
+// default maximum depth
+template<class Options, class = void>
+struct parser_inline_depth
+{
+    static constexpr std::size_t value = 32;
+};
+
+template<class Options>
+struct parser_inline_depth<Options,
+    decltype(void(Options::inline_depth))>
+{
+    static constexpr std::size_t value =
+        Options::inline_depth;
+};
+
+// forwards the measured size of a string
+// token to handlers which provide the
+// optional member on_string_reserve, and
+// does nothing for handlers which do not
+template<class Handler, class = void>
+struct handler_string_reserve
+{
+    static
+    void
+    call(Handler&, std::size_t) noexcept
+    {
+    }
+};
+
 template<class Handler>
+struct handler_string_reserve<Handler,
+    decltype(void(std::declval<Handler&>().
+        on_string_reserve(std::size_t(0))))>
+{
+    static
+    void
+    call(Handler& h, std::size_t n)
+    {
+        h.on_string_reserve(n);
+    }
+};
+
+} // detail
+
+#ifdef BOOST_JSON_PARSE_STATS
+/** Counters describing the work performed by a parser.
+
+    This type is only available when the
+    library is built with the macro
+    `BOOST_JSON_PARSE_STATS` defined, which
+    adds the counters to @ref basic_parser.
+    The counters accumulate across documents
+    and are never cleared by `reset`, which
+    suits periodic scraping by an external
+    metrics collector.
+*/
+struct parse_stats
+{
+    /// Total bytes of input consumed
+    std::uint64_t bytes = 0;
+
+    /// Bytes scanned inside strings and keys
+    std::uint64_t string_bytes = 0;
+
+    /// Number tokens converted
+    std::uint64_t numbers = 0;
+
+    /// Times the parser suspended on incomplete input
+    std::uint64_t suspends = 0;
+
+    /// Bytes allocated by the value stack, if any
+    std::uint64_t stack_bytes = 0;
+};
+#endif
+
+template<
+    class Handler,
+    class Options = parse_options>
 class basic_parser
 {
     enum class state : char
@@ -274,13 +559,33 @@ class basic_parser
         sur4,  sur5,  sur6,
         obj1,  obj2,  obj3,  obj4,
         obj5,  obj6,  obj7,  obj8,
-        obj9,  obj10, obj11,
+        obj9,  obj10, obj11, obj12,
         arr1,  arr2,  arr3,
-        arr4,  arr5,  arr6,
+        arr4,  arr5,  arr6,  arr7,
         num1,  num2,  num3,  num4,
         num5,  num6,  num7,  num8,
         exp1,  exp2,  exp3,
-        val1,  val2, val3
+        val1,  val2, val3,
+        skp1
+    };
+
+    // micro states for parse_skip; the current
+    // state lives in skip_st_, and skip_ret_
+    // holds the state to return to after a
+    // string or comment excursion
+    enum skip_state : unsigned char
+    {
+        skip_start = 0, // start of the skipped value
+        skip_obj,       // inside a skipped object
+        skip_arr,       // inside a skipped array
+        skip_val,       // inside a skipped container value
+        skip_str,       // inside a string
+        skip_esc,       // after a backslash in a string
+        skip_lit,       // inside a scalar
+        skip_cmt,       // after '/'
+        skip_line,      // inside a line comment
+        skip_blk,       // inside a block comment
+        skip_blk2       // after '*' in a block comment
     };
 
     struct number
@@ -295,11 +600,32 @@ class basic_parser
     template< bool StackEmpty_, char First_ >
     struct parse_number_helper;
 
+    // bytes the suspend stack needs for a
+    // document nested `depth` levels deep
+    static constexpr
+    std::size_t
+    stack_bytes(std::size_t depth) noexcept
+    {
+        return
+            sizeof(state) + // document parsing state
+            (sizeof(state) +
+                sizeof(std::size_t)) * depth + // array and object state + size
+            sizeof(state) + // value parsing state
+            sizeof(std::size_t) + // string size
+            sizeof(state); // comment state
+    }
+
     // optimization: must come first
     Handler h_;
 
     number num_;
     error_code ec_;
+    // inline storage for the suspend stack;
+    // documents no deeper than the options'
+    // inline depth never heap-allocate it
+    unsigned char st_buf_[stack_bytes(
+        detail::parser_inline_depth<
+            Options>::value)];
     detail::stack st_;
     detail::utf8_sequence seq_;
     unsigned u1_;
@@ -309,11 +635,23 @@ class basic_parser
     bool clean_ = true; // write_some exited cleanly
     const char* end_;
     detail::sbo_buffer<16 + 16 + 1 + 1> num_buf_;
-    parse_options opt_;
+    Options opt_;
     // how many levels deeper the parser can go
     std::size_t depth_ = opt_.max_depth;
     unsigned char cur_lit_ = 0;
     unsigned char lit_offset_ = 0;
+    // the handler requested that the
+    // next member value be skipped
+    bool skip_next_ = false;
+    unsigned char skip_st_ = 0;
+    unsigned char skip_ret_ = 0;
+    // cooperative cancellation; checked once
+    // per value when set, never cleared by
+    // reset
+    std::atomic<bool> const* cancel_ = nullptr;
+#ifdef BOOST_JSON_PARSE_STATS
+    parse_stats stats_;
+#endif
 
     inline void reserve();
     inline const char* sentinel();
@@ -432,6 +770,11 @@ class basic_parser
         /*std::integral_constant<bool, AllowTrailing_>*/ bool allow_trailing,
         /*std::integral_constant<bool, AllowBadUTF8_>*/ bool allow_bad_utf8);
 
+    template<bool StackEmpty_>
+    const char* parse_skip(const char* p,
+        std::integral_constant<bool, StackEmpty_> stack_empty,
+        skip_state entry);
+
     template<int Literal>
     const char* parse_literal(const char* p,
         std::integral_constant<int, Literal> literal);
@@ -559,6 +902,26 @@ public:
         return h_;
     }
 
+#ifdef BOOST_JSON_PARSE_STATS
+    /** Return the instrumentation counters.
+
+        This function is only available when
+        the library is built with the macro
+        `BOOST_JSON_PARSE_STATS` defined.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    parse_stats const&
+    stats() const noexcept
+    {
+        return stats_;
+    }
+#endif
+
     /** Return the last error.
 
         This returns the last error code which
@@ -617,6 +980,82 @@ public:
     void
     reset() noexcept;
 
+    /** Set the cancellation flag checked during parsing.
+
+        When `flag` is not null, the parser reads
+        it once for every JSON value it begins,
+        and if the flag is `true` the parse stops
+        with @ref error::canceled. Another thread,
+        such as a deadline timer, may set the flag
+        at any time to make a call to
+        @ref write_some in progress return early
+        instead of parsing its buffer to
+        completion. The flag is read with relaxed
+        ordering and is never written or cleared
+        by the parser; the caller must clear it
+        before reusing the parser after a call to
+        @ref reset. The error is sticky, like any
+        other parse error.
+
+        The check costs one predictable branch
+        per value when no flag is installed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param flag A pointer to the flag to
+        check, which must remain valid until it
+        is replaced or the parser is destroyed,
+        or `nullptr` to disable cancellation.
+    */
+    void
+    cancel_token(
+        std::atomic<bool> const* flag) noexcept
+    {
+        cancel_ = flag;
+    }
+
+    /** Return the installed cancellation flag.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::atomic<bool> const*
+    cancel_token() const noexcept
+    {
+        return cancel_;
+    }
+
+    /** Return excess temporary storage to the memory resource.
+
+        Dynamically allocated temporary memory is
+        retained at its high-water mark across calls
+        to @ref reset, so that parsing many documents
+        with one parser performs no allocations in
+        the steady state. This function releases that
+        memory, returning the parser to its
+        construction-time state. The parsing state
+        must have been discarded first with a call
+        to @ref reset.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    void
+    shrink_to_fit() noexcept
+    {
+        st_.shrink_to_fit();
+    }
+
     /** Indicate a parsing failure.
 
         This changes the state of the parser to indicate
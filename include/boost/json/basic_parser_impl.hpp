@@ -15,8 +15,12 @@
 #include <boost/json/basic_parser.hpp>
 #include <boost/json/error.hpp>
 #include <boost/json/detail/buffer.hpp>
+#include <boost/json/detail/charconv/detail/compute_float64.hpp>
 #include <boost/json/detail/charconv/from_chars.hpp>
 #include <boost/json/detail/sse2.hpp>
+#include <boost/json/detail/uescape.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/integral.hpp>
 #include <cmath>
 #include <limits>
 #include <cstring>
@@ -45,6 +49,12 @@
 
 namespace boost {
 namespace json {
+
+#ifdef BOOST_JSON_PARSE_STATS
+# define BOOST_JSON_STAT(expr) do { expr; } while(false)
+#else
+# define BOOST_JSON_STAT(expr) do { } while(false)
+#endif
 namespace detail {
 
 inline
@@ -199,9 +209,9 @@ enum json_literal
 
 //----------------------------------------------------------
 
-template< class Handler >
+template< class Handler, class Options >
 template< bool StackEmpty_, char First_ >
-struct basic_parser<Handler>::
+struct basic_parser<Handler, Options>::
 parse_number_helper
 {
     basic_parser* parser;
@@ -222,23 +232,19 @@ parse_number_helper
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 void
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 reserve()
 {
-    if(BOOST_JSON_LIKELY(
-        ! st_.empty()))
-        return;
-    // Reserve the largest stack we need,
-    // to avoid reallocation during suspend.
-    st_.reserve(
-        sizeof(state) + // document parsing state
-        (sizeof(state) +
-            sizeof(std::size_t)) * depth() + // array and object state + size
-        sizeof(state) + // value parsing state
-        sizeof(std::size_t) + // string size
-        sizeof(state)); // comment state
+    // Precommit the largest stack a document of
+    // max_depth can suspend with, so that every
+    // push afterwards is an unchecked pointer
+    // bump. When max_depth fits in the inline
+    // buffer this is a no-op; otherwise capacity
+    // is retained, so it is an allocation once
+    // per parser, not per parse.
+    st_.reserve(stack_bytes(opt_.max_depth));
 }
 
 //----------------------------------------------------------
@@ -248,9 +254,9 @@ reserve()
 // this is used as it is distinct from all valid values
 // for data in write
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 sentinel()
 {
     // the "+1" ensures that the returned pointer is unique even if
@@ -259,9 +265,9 @@ sentinel()
         const char*>(this) + 1;
 }
 
-template<class Handler>
+template<class Handler, class Options>
 bool
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 incomplete(
     const detail::const_stream_wrapper& cs)
 {
@@ -275,24 +281,23 @@ incomplete(
 // They return the canary value to indicate suspension
 // or failure.
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 suspend_or_fail(state st)
 {
     if(BOOST_JSON_LIKELY(
         ! ec_ && more_))
     {
         // suspend
-        reserve();
         st_.push_unchecked(st);
     }
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 suspend_or_fail(
     state st,
     std::size_t n)
@@ -301,7 +306,6 @@ suspend_or_fail(
         ! ec_ && more_))
     {
         // suspend
-        reserve();
         st_.push_unchecked(n);
         st_.push_unchecked(st);
     }
@@ -309,9 +313,9 @@ suspend_or_fail(
 }
 
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 fail(const char* p) noexcept
 {
     BOOST_ASSERT( p != sentinel() );
@@ -319,9 +323,9 @@ fail(const char* p) noexcept
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 fail(
     const char* p,
     error ev,
@@ -333,9 +337,9 @@ fail(
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 maybe_suspend(
     const char* p,
     state st)
@@ -345,15 +349,15 @@ maybe_suspend(
     if(BOOST_JSON_LIKELY(more_))
     {
         // suspend
-        reserve();
+        BOOST_JSON_STAT(++stats_.suspends);
         st_.push_unchecked(st);
     }
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 maybe_suspend(
     const char* p,
     state st,
@@ -364,16 +368,16 @@ maybe_suspend(
     if(BOOST_JSON_LIKELY(more_))
     {
         // suspend
-        reserve();
+        BOOST_JSON_STAT(++stats_.suspends);
         st_.push_unchecked(n);
         st_.push_unchecked(st);
     }
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 maybe_suspend(
     const char* p,
     state st,
@@ -384,16 +388,16 @@ maybe_suspend(
     if(BOOST_JSON_LIKELY(more_))
     {
         // suspend
+        BOOST_JSON_STAT(++stats_.suspends);
         num_ = num;
-        reserve();
         st_.push_unchecked(st);;
     }
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 suspend(
     const char* p,
     state st)
@@ -401,14 +405,14 @@ suspend(
     BOOST_ASSERT( p != sentinel() );
     end_ = p;
     // suspend
-    reserve();
+    BOOST_JSON_STAT(++stats_.suspends);
     st_.push_unchecked(st);
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 suspend(
     const char* p,
     state st,
@@ -417,18 +421,18 @@ suspend(
     BOOST_ASSERT( p != sentinel() );
     end_ = p;
     // suspend
+    BOOST_JSON_STAT(++stats_.suspends);
     num_ = num;
-    reserve();
     st_.push_unchecked(st);
     return sentinel();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_/*,
     bool Terminal_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_comment(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     /*std::integral_constant<bool, Terminal_>*/ bool terminal)
@@ -520,6 +524,21 @@ do_com4:
                     return fail(cs.begin());
                 return maybe_suspend(cs.begin(), state::com4);
             }
+            // license banners are full of asterisk
+            // runs; consume them here so the scan
+            // above restarts at most once per run
+            // instead of once per asterisk
+            while(BOOST_JSON_UNLIKELY(*cs == '*'))
+            {
+                ++cs;
+                if(BOOST_JSON_UNLIKELY(! cs))
+                {
+                    if(BOOST_JSON_UNLIKELY(! h_.on_comment_part(
+                        {start, cs.used(start)}, ec_)))
+                        return fail(cs.begin());
+                    return maybe_suspend(cs.begin(), state::com4);
+                }
+            }
         }
         while(*cs != '/');
     }
@@ -530,10 +549,10 @@ do_com4:
     return cs.begin();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<bool StackEmpty_>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_document(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty)
 {
@@ -619,20 +638,30 @@ do_doc4:
     return cs.begin();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_,
     bool AllowComments_/*,
     bool AllowTrailing_,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_value(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<bool, AllowComments_> allow_comments,
     /*std::integral_constant<bool, AllowTrailing_>*/ bool allow_trailing,
     /*std::integral_constant<bool, AllowBadUTF8_>*/ bool allow_bad_utf8)
 {
+    // cooperative cancellation, checked once
+    // per value so an expired deadline stops
+    // a large parse mid-document
+    if(BOOST_JSON_UNLIKELY(cancel_ &&
+        cancel_->load(std::memory_order_relaxed)))
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc
+            = BOOST_CURRENT_LOCATION;
+        return fail(p, error::canceled, &loc);
+    }
     if(stack_empty || st_.empty())
     {
 loop:
@@ -659,7 +688,7 @@ loop:
         case 'f':
             return parse_literal( p, mp11::mp_int<detail::false_literal>() );
         case 'I':
-            if( !opt_.allow_infinity_and_nan )
+            if(BOOST_JSON_UNLIKELY( !opt_.allow_infinity_and_nan ))
             {
                 BOOST_STATIC_CONSTEXPR source_location loc
                     = BOOST_CURRENT_LOCATION;
@@ -667,7 +696,7 @@ loop:
             }
             return parse_literal( p, mp11::mp_int<detail::infinity_literal>() );
         case 'N':
-            if( !opt_.allow_infinity_and_nan )
+            if(BOOST_JSON_UNLIKELY( !opt_.allow_infinity_and_nan ))
             {
                 BOOST_STATIC_CONSTEXPR source_location loc
                     = BOOST_CURRENT_LOCATION;
@@ -681,7 +710,7 @@ loop:
         case '{':
             return parse_object(p, std::true_type(), allow_comments, allow_trailing, allow_bad_utf8);
         case '/':
-            if(! allow_comments)
+            if(BOOST_JSON_UNLIKELY(! allow_comments))
             {
                 BOOST_STATIC_CONSTEXPR source_location loc
                     = BOOST_CURRENT_LOCATION;
@@ -713,13 +742,13 @@ loop:
     return resume_value(p, allow_comments, allow_trailing, allow_bad_utf8);
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool AllowComments_/*,
     bool AllowTrailing_,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 resume_value(const char* p,
     std::integral_constant<bool, AllowComments_> allow_comments,
     /*std::integral_constant<bool, AllowTrailing_>*/ bool allow_trailing,
@@ -748,6 +777,7 @@ resume_value(const char* p,
     case state::arr1: case state::arr2:
     case state::arr3: case state::arr4:
     case state::arr5: case state::arr6:
+    case state::arr7:
         return parse_array(p, std::false_type(), allow_comments, allow_trailing, allow_bad_utf8);
 
     case state::obj1: case state::obj2:
@@ -755,9 +785,12 @@ resume_value(const char* p,
     case state::obj5: case state::obj6:
     case state::obj7: case state::obj8:
     case state::obj9: case state::obj10:
-    case state::obj11:
+    case state::obj11: case state::obj12:
         return parse_object(p, std::false_type(), allow_comments, allow_trailing, allow_bad_utf8);
 
+    case state::skp1:
+        return parse_skip(p, std::false_type(), skip_start);
+
     case state::num1: case state::num2:
     case state::num3: case state::num4:
     case state::num5: case state::num6:
@@ -799,10 +832,10 @@ resume_value(const char* p,
     }
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<int Literal>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_literal(const char* p,
     std::integral_constant<int, Literal> literal)
 {
@@ -990,13 +1023,13 @@ parse_literal(const char* p,
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_,
     bool IsKey_/*,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_string(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<bool, IsKey_> is_key,
@@ -1026,13 +1059,13 @@ parse_string(const char* p,
     return parse_unescaped(p, std::true_type(), is_key, allow_bad_utf8);
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_,
     bool IsKey_/*,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_unescaped(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<bool, IsKey_> is_key,
@@ -1130,6 +1163,23 @@ parse_unescaped(const char* p,
         }
         else if(BOOST_JSON_LIKELY(*cs == '\\'))
         {
+            // When the closing quote is already
+            // in the buffer, measure the whole
+            // token once so the handler can
+            // allocate for the unescaped string
+            // exactly once instead of growing
+            // as the parts arrive.
+            {
+                auto const n = detail::
+                    unescaped_size(cs.begin(), end_);
+                auto const max_size = is_key?
+                    Handler::max_key_size :
+                    Handler::max_string_size;
+                if( n != std::size_t(-1) &&
+                    n <= max_size - total)
+                    detail::handler_string_reserve<
+                        Handler>::call(h_, total + n);
+            }
             // flush unescaped run from input
             if(BOOST_JSON_LIKELY(size))
             {
@@ -1152,9 +1202,21 @@ parse_unescaped(const char* p,
     }
 
     {
-        bool r = is_key?
-            h_.on_key( {start, size}, total, ec_ ):
-            h_.on_string( {start, size}, total, ec_ );
+        BOOST_JSON_STAT(
+            stats_.string_bytes += total);
+        bool r;
+        if(is_key)
+        {
+            auto const dir = h_.on_key(
+                {start, size}, total, ec_ );
+            skip_next_ = detail::wants_skip(dir);
+            r = dir;
+        }
+        else
+        {
+            r = h_.on_string(
+                {start, size}, total, ec_ );
+        }
 
         if(BOOST_JSON_UNLIKELY(!r))
         {
@@ -1166,13 +1228,13 @@ parse_unescaped(const char* p,
     return cs.begin();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_/*,
     bool IsKey_,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_escaped(
     const char* p,
     std::size_t total,
@@ -1637,9 +1699,21 @@ do_str2:
             }
             total += temp.size();
             {
-                bool r = is_key
-                    ? h_.on_key(temp.get(), total, ec_)
-                    : h_.on_string(temp.get(), total, ec_);
+                BOOST_JSON_STAT(
+                    stats_.string_bytes += total);
+                bool r;
+                if(is_key)
+                {
+                    auto const dir = h_.on_key(
+                        temp.get(), total, ec_);
+                    skip_next_ = detail::wants_skip(dir);
+                    r = dir;
+                }
+                else
+                {
+                    r = h_.on_string(
+                        temp.get(), total, ec_);
+                }
 
                 if(BOOST_JSON_UNLIKELY(!r))
                 {
@@ -1724,14 +1798,14 @@ do_str8:
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_,
     bool AllowComments_/*,
     bool AllowTrailing_,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_object(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<bool, AllowComments_> allow_comments,
@@ -1755,11 +1829,12 @@ parse_object(const char* p,
         case state::obj4: goto do_obj4;
         case state::obj5: goto do_obj5;
         case state::obj6: goto do_obj6;
-        case state::obj7: goto do_obj7;
+        case state::obj7: goto do_obj7r;
         case state::obj8: goto do_obj8;
         case state::obj9: goto do_obj9;
         case state::obj10: goto do_obj10;
         case state::obj11: goto do_obj11;
+        case state::obj12: goto do_obj12;
         }
     }
     BOOST_ASSERT(*cs == '{');
@@ -1770,10 +1845,14 @@ parse_object(const char* p,
         return fail(cs.begin(), error::too_deep, &loc);
     }
     --depth_;
-    if(BOOST_JSON_UNLIKELY(
-        ! h_.on_object_begin(ec_)))
-        return fail(cs.begin());
-    ++cs;
+    {
+        auto const dir = h_.on_object_begin(ec_);
+        if(BOOST_JSON_UNLIKELY( ! dir ))
+            return fail(cs.begin());
+        ++cs;
+        if(BOOST_JSON_UNLIKELY(detail::wants_skip(dir)))
+            goto do_obj12;
+    }
     // object:
     //     '{' *ws '}'
     //     '{' *ws string *ws ':' *ws value *ws *[ ',' *ws string *ws ':' *ws value *ws ] '}'
@@ -1832,8 +1911,21 @@ do_obj6:
         cs = detail::count_whitespace(cs.begin(), cs.end());
         if(BOOST_JSON_UNLIKELY(! cs))
             return maybe_suspend(cs.begin(), state::obj6, size);
-do_obj7:
-        cs = parse_value(cs.begin(), stack_empty, allow_comments, allow_trailing, allow_bad_utf8);
+        if(BOOST_JSON_UNLIKELY(skip_next_))
+        {
+            skip_next_ = false;
+            cs = parse_skip(cs.begin(), stack_empty, skip_start);
+        }
+        else
+        {
+do_obj7r:
+            // resuming dispatches on the
+            // suspended frame instead of on
+            // skip_next_, which an inner object
+            // may have set again for a member
+            // of its own
+            cs = parse_value(cs.begin(), stack_empty, allow_comments, allow_trailing, allow_bad_utf8);
+        }
         if(BOOST_JSON_UNLIKELY(incomplete(cs)))
             return suspend_or_fail(state::obj7, size);
 do_obj8:
@@ -1888,18 +1980,31 @@ do_obj11:
     ++depth_;
     ++cs;
     return cs.begin();
+
+do_obj12:
+    // the handler requested that the entire
+    // object be skipped; the closing brace is
+    // consumed by parse_skip
+    cs = parse_skip(cs.begin(), stack_empty, skip_obj);
+    if(BOOST_JSON_UNLIKELY(incomplete(cs)))
+        return suspend_or_fail(state::obj12, size);
+    if(BOOST_JSON_UNLIKELY(
+        ! h_.on_object_end(size, ec_)))
+        return fail(cs.begin());
+    ++depth_;
+    return cs.begin();
 }
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 template<
     bool StackEmpty_,
     bool AllowComments_/*,
     bool AllowTrailing_,
     bool AllowBadUTF8_*/>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_array(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<bool, AllowComments_> allow_comments,
@@ -1923,6 +2028,7 @@ parse_array(const char* p,
         case state::arr4: goto do_arr4;
         case state::arr5: goto do_arr5;
         case state::arr6: goto do_arr6;
+        case state::arr7: goto do_arr7;
         }
     }
     BOOST_ASSERT(*cs == '[');
@@ -1933,10 +2039,14 @@ parse_array(const char* p,
         return fail(cs.begin(), error::too_deep, &loc);
     }
     --depth_;
-    if(BOOST_JSON_UNLIKELY(
-        ! h_.on_array_begin(ec_)))
-        return fail(cs.begin());
-    ++cs;
+    {
+        auto const dir = h_.on_array_begin(ec_);
+        if(BOOST_JSON_UNLIKELY( ! dir ))
+            return fail(cs.begin());
+        ++cs;
+        if(BOOST_JSON_UNLIKELY(detail::wants_skip(dir)))
+            goto do_arr7;
+    }
     // array:
     //     '[' *ws ']'
     //     '[' *ws value *ws *[ ',' *ws value *ws ] ']'
@@ -2004,14 +2114,265 @@ do_arr6:
     ++depth_;
     ++cs;
     return cs.begin();
+
+do_arr7:
+    // the handler requested that the entire
+    // array be skipped; the closing bracket
+    // is consumed by parse_skip
+    cs = parse_skip(cs.begin(), stack_empty, skip_arr);
+    if(BOOST_JSON_UNLIKELY(incomplete(cs)))
+        return suspend_or_fail(state::arr7, size);
+    if(BOOST_JSON_UNLIKELY(
+        ! h_.on_array_end(size, ec_)))
+        return fail(cs.begin());
+    ++depth_;
+    return cs.begin();
 }
 
 //----------------------------------------------------------
 
-template<class Handler>
+/*  Fast-forward over one value without generating
+    events. Only structure is tracked: container
+    nesting, string boundaries, and comment
+    boundaries. Numbers, escape sequences, and
+    UTF-8 within the skipped content are not
+    validated. The scanner borrows depth_ for its
+    own nesting so that max_depth is still
+    enforced; levels it opens are closed again
+    before returning. Across suspensions, the
+    micro state lives in skip_st_ and skip_ret_,
+    and the nesting count travels through the
+    size channel of the parse stack.
+*/
+template<class Handler, class Options>
+template<bool StackEmpty_>
+const char*
+basic_parser<Handler, Options>::
+parse_skip(const char* p,
+    std::integral_constant<bool, StackEmpty_> stack_empty,
+    skip_state entry)
+{
+    detail::const_stream_wrapper cs(p, end_);
+    std::size_t depth;
+    if(! stack_empty && ! st_.empty())
+    {
+        // resume
+        state st;
+        st_.pop(st);
+        st_.pop(depth);
+        BOOST_ASSERT(st == state::skp1);
+    }
+    else
+    {
+        depth = 0;
+        skip_st_ = entry;
+    }
+    while(BOOST_JSON_LIKELY(cs))
+    {
+        char const c = *cs;
+        switch(skip_st_)
+        {
+        case skip_start:
+            // at the start of the skipped value
+            if(c == '{' || c == '[')
+            {
+                if(BOOST_JSON_UNLIKELY(! depth_))
+                {
+                    BOOST_STATIC_CONSTEXPR source_location loc
+                        = BOOST_CURRENT_LOCATION;
+                    return fail(cs.begin(), error::too_deep, &loc);
+                }
+                --depth_;
+                ++depth;
+                skip_st_ = skip_val;
+            }
+            else if(c == '\x22')
+            {
+                skip_ret_ = skip_start;
+                skip_st_ = skip_str;
+            }
+            else if(
+                c == ' '  || c == '\t' ||
+                c == '\n' || c == '\r')
+            {
+                // consume
+            }
+            else if(c == '/' && opt_.allow_comments)
+            {
+                skip_ret_ = skip_start;
+                skip_st_ = skip_cmt;
+            }
+            else if(
+                c == ',' || c == ':' ||
+                c == '}' || c == ']')
+            {
+                BOOST_STATIC_CONSTEXPR source_location loc
+                    = BOOST_CURRENT_LOCATION;
+                return fail(cs.begin(), error::syntax, &loc);
+            }
+            else
+            {
+                skip_st_ = skip_lit;
+            }
+            break;
+
+        case skip_obj:
+        case skip_arr:
+            // inside the skipped container; depth
+            // counts levels opened by the scanner
+            if(c == '\x22')
+            {
+                skip_ret_ = skip_st_;
+                skip_st_ = skip_str;
+            }
+            else if(c == '{' || c == '[')
+            {
+                if(BOOST_JSON_UNLIKELY(! depth_))
+                {
+                    BOOST_STATIC_CONSTEXPR source_location loc
+                        = BOOST_CURRENT_LOCATION;
+                    return fail(cs.begin(), error::too_deep, &loc);
+                }
+                --depth_;
+                ++depth;
+            }
+            else if(c == '}' || c == ']')
+            {
+                if(depth == 0)
+                {
+                    // closing the skipped container
+                    // itself; the caller balances depth_
+                    if(BOOST_JSON_UNLIKELY(c !=
+                        (skip_st_ == skip_obj ? '}' : ']')))
+                    {
+                        BOOST_STATIC_CONSTEXPR source_location loc
+                            = BOOST_CURRENT_LOCATION;
+                        return fail(cs.begin(), error::syntax, &loc);
+                    }
+                    ++cs;
+                    return cs.begin();
+                }
+                --depth;
+                ++depth_;
+            }
+            else if(c == '/' && opt_.allow_comments)
+            {
+                skip_ret_ = skip_st_;
+                skip_st_ = skip_cmt;
+            }
+            break;
+
+        case skip_val:
+            // inside a skipped container value
+            if(c == '\x22')
+            {
+                skip_ret_ = skip_val;
+                skip_st_ = skip_str;
+            }
+            else if(c == '{' || c == '[')
+            {
+                if(BOOST_JSON_UNLIKELY(! depth_))
+                {
+                    BOOST_STATIC_CONSTEXPR source_location loc
+                        = BOOST_CURRENT_LOCATION;
+                    return fail(cs.begin(), error::too_deep, &loc);
+                }
+                --depth_;
+                ++depth;
+            }
+            else if(c == '}' || c == ']')
+            {
+                --depth;
+                ++depth_;
+                if(depth == 0)
+                {
+                    ++cs;
+                    return cs.begin();
+                }
+            }
+            else if(c == '/' && opt_.allow_comments)
+            {
+                skip_ret_ = skip_val;
+                skip_st_ = skip_cmt;
+            }
+            break;
+
+        case skip_str:
+            if(c == '\\')
+            {
+                skip_st_ = skip_esc;
+            }
+            else if(c == '\x22')
+            {
+                if(skip_ret_ == skip_start)
+                {
+                    // the skipped value is this string
+                    ++cs;
+                    return cs.begin();
+                }
+                skip_st_ = skip_ret_;
+            }
+            break;
+
+        case skip_esc:
+            skip_st_ = skip_str;
+            break;
+
+        case skip_lit:
+            // a scalar; ends at the next delimiter,
+            // which is left unconsumed
+            if( c == ',' || c == '}' || c == ']' ||
+                c == ' ' || c == '\t' ||
+                c == '\n' || c == '\r' ||
+                (c == '/' && opt_.allow_comments))
+                return cs.begin();
+            break;
+
+        case skip_cmt:
+            if(c == '/')
+            {
+                skip_st_ = skip_line;
+            }
+            else if(c == '*')
+            {
+                skip_st_ = skip_blk;
+            }
+            else
+            {
+                BOOST_STATIC_CONSTEXPR source_location loc
+                    = BOOST_CURRENT_LOCATION;
+                return fail(cs.begin(), error::syntax, &loc);
+            }
+            break;
+
+        case skip_line:
+            if(c == '\n')
+                skip_st_ = skip_ret_;
+            break;
+
+        case skip_blk:
+            if(c == '*')
+                skip_st_ = skip_blk2;
+            break;
+
+        case skip_blk2:
+            if(c == '/')
+                skip_st_ = skip_ret_;
+            else if(c != '*')
+                skip_st_ = skip_blk;
+            break;
+        }
+        ++cs;
+    }
+    return maybe_suspend(cs.begin(), state::skp1, depth);
+}
+
+//----------------------------------------------------------
+
+template<class Handler, class Options>
 template<bool StackEmpty_, char First_, number_precision Numbers_>
 const char*
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 parse_number(const char* p,
     std::integral_constant<bool, StackEmpty_> stack_empty,
     std::integral_constant<char, First_> first,
@@ -2050,6 +2411,7 @@ parse_number(const char* p,
         num.frac = false;
         num.exp = 0;
         num.bias = 0;
+        BOOST_JSON_STAT(++stats_.numbers);
 
         // fast path
         if( cs.remain() >= 16 + 1 + 16 ) // digits . digits
@@ -2059,7 +2421,14 @@ parse_number(const char* p,
             if( nonzero_first ||
                 (negative && *cs != '0') )
             {
-                n1 = detail::count_digits( cs.begin() );
+                // the fused kernel classifies and
+                // converts from a single pass over
+                // the digits
+                num.mant = 0;
+                BOOST_IF_CONSTEXPR( !no_parsing )
+                    n1 = detail::parse_digits( num.mant, cs.begin() );
+                else
+                    n1 = detail::count_digits( cs.begin() );
                 BOOST_ASSERT(n1 >= 0 && n1 <= 16);
 
                 if( negative && n1 == 0 && opt_.allow_infinity_and_nan )
@@ -2076,11 +2445,6 @@ parse_number(const char* p,
                     return fail(cs.begin(), error::syntax, &loc);
                 }
 
-                BOOST_IF_CONSTEXPR( !no_parsing )
-                    num.mant = detail::parse_unsigned( 0, cs.begin(), n1 );
-                else
-                    num.mant = 0;
-
                 cs += n1;
 
                 // integer or floating-point with
@@ -2117,7 +2481,16 @@ parse_number(const char* p,
 
             ++cs;
 
-            int n2 = detail::count_digits( cs.begin() );
+            // the digits are folded into a copy of
+            // the mantissa so that the slow path
+            // keeps the unmodified value when the
+            // combined count overflows
+            int n2;
+            std::uint64_t mant2 = num.mant;
+            BOOST_IF_CONSTEXPR( !no_parsing )
+                n2 = detail::parse_digits( mant2, cs.begin() );
+            else
+                n2 = detail::count_digits( cs.begin() );
             BOOST_ASSERT(n2 >= 0 && n2 <= 16);
 
             if( n2 == 0 )
@@ -2135,7 +2508,7 @@ parse_number(const char* p,
             }
 
             BOOST_IF_CONSTEXPR( !no_parsing )
-                num.mant = detail::parse_unsigned( num.mant, cs.begin(), n2 );
+                num.mant = mant2;
 
             BOOST_ASSERT(num.bias == 0);
 
@@ -2155,6 +2528,29 @@ parse_number(const char* p,
                 goto do_num8;
             }
 
+#if (FLT_EVAL_METHOD == 0) || (FLT_EVAL_METHOD == 1)
+            // simple decimal: with at most 15
+            // digits the mantissa is exact, and
+            // dividing by a power of ten rounds
+            // correctly in one step (Clinger),
+            // so the result matches charconv
+            // without re-scanning the text
+            BOOST_IF_CONSTEXPR( !no_parsing )
+            {
+                if( n1 + n2 <= 15 )
+                {
+                    double d = static_cast<double>(num.mant) /
+                        detail::charconv::detail::powers_of_ten[n2];
+                    if( num.neg )
+                        d = -d;
+                    if(BOOST_JSON_UNLIKELY(
+                        ! h_.on_double(d, {begin, cs.used(begin)}, ec_)))
+                        return fail(cs.begin());
+                    return cs.begin();
+                }
+            }
+#endif
+
             goto finish_dub;
         }
     }
@@ -2789,22 +3185,24 @@ finish_dub:
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 template<class... Args>
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 basic_parser(
     parse_options const& opt,
     Args&&... args)
     : h_(std::forward<Args>(args)...)
+    , st_(storage_ptr(),
+        st_buf_, sizeof(st_buf_))
     , opt_(opt)
 {
 }
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 void
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 reset() noexcept
 {
     ec_ = {};
@@ -2815,9 +3213,9 @@ reset() noexcept
     num_buf_.clear();
 }
 
-template<class Handler>
+template<class Handler, class Options>
 void
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 fail(error_code ec) noexcept
 {
     if(! ec)
@@ -2835,9 +3233,9 @@ fail(error_code ec) noexcept
 
 //----------------------------------------------------------
 
-template<class Handler>
+template<class Handler, class Options>
 std::size_t
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 write_some(
     bool more,
     char const* data,
@@ -2860,6 +3258,16 @@ write_some(
         ec = ec_;
         return 0;
     }
+    // check before resuming, so a buffer
+    // arriving after the deadline is not
+    // parsed at all
+    if(BOOST_JSON_UNLIKELY(cancel_ &&
+        cancel_->load(std::memory_order_relaxed)))
+    {
+        BOOST_JSON_FAIL(ec_, error::canceled);
+        ec = ec_;
+        return 0;
+    }
     clean_ = false;
     more_ = more;
     end_ = data + size;
@@ -2868,6 +3276,11 @@ write_some(
     {
         // first time
         depth_ = opt_.max_depth;
+        skip_next_ = false;
+        // one-shot writes can never suspend,
+        // and do not need the stack at all
+        if(more)
+            reserve();
         if(BOOST_JSON_UNLIKELY(
             ! h_.on_document_begin(ec_)))
         {
@@ -2917,12 +3330,14 @@ write_some(
     }
     ec = ec_;
     clean_ = true;
+    BOOST_JSON_STAT(stats_.bytes +=
+        static_cast<std::uint64_t>(p - data));
     return p - data;
 }
 
-template<class Handler>
+template<class Handler, class Options>
 std::size_t
-basic_parser<Handler>::
+basic_parser<Handler, Options>::
 write_some(
     bool more,
     char const* data,
@@ -2937,6 +3352,8 @@ write_some(
 
 #endif
 
+#undef BOOST_JSON_STAT
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,299 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_BIG_NUMBER_HPP
+#define BOOST_JSON_BIG_NUMBER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstdint>
+#include <string>
+
+namespace boost {
+namespace json {
+
+/** An integer of arbitrary size.
+
+    This type holds the value of a JSON integer
+    which may exceed the range of the built-in
+    integral types. Integers with up to 38
+    significant digits are stored inline as a
+    sign and a 128-bit magnitude, converted from
+    the decimal text eight digits at a time with
+    the same SWAR kernel family used by the
+    parser; larger integers fall back to storing
+    the original text. In both representations
+    the value is exact: no digits are lost, as
+    happens when such numbers are converted to
+    `double` by @ref parse.
+
+    Use @ref parse_big_number to construct an
+    instance from decimal text. To capture
+    out-of-range numbers losslessly from a JSON
+    document, parse with @ref raw_number fields
+    through @ref parse_into, then convert the
+    captured text:
+
+    @code
+    raw_number id;               // via parse_into
+    error_code ec;
+    auto n = parse_big_number( id.text, ec );
+    if( n.fits_uint64() )
+        settle( n.to_uint64() );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Const member functions of a
+    shared instance may be called concurrently.
+
+    @see @ref parse_big_number, @ref raw_number.
+*/
+class big_number
+{
+    std::uint64_t lo_ = 0;
+    std::uint64_t hi_ = 0;
+    std::string text_;
+    bool neg_ = false;
+
+    friend BOOST_JSON_DECL
+    big_number
+    parse_big_number(
+        string_view s, error_code& ec);
+
+public:
+    /** Default constructor.
+
+        The value is zero.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    big_number() = default;
+
+    /** Return `true` if the value is stored inline.
+
+        Values with up to 38 significant digits
+        are stored as a sign and a 128-bit
+        magnitude; @ref low64 and @ref high64
+        return the magnitude. Larger values keep
+        their original text, returned by
+        @ref text.
+    */
+    bool
+    is_inline() const noexcept
+    {
+        return text_.empty();
+    }
+
+    /** Return `true` if the value is negative.
+    */
+    bool
+    is_negative() const noexcept
+    {
+        return neg_;
+    }
+
+    /** Return the low 64 bits of the inline magnitude.
+
+        @par Preconditions
+        `this->is_inline() == true`
+    */
+    std::uint64_t
+    low64() const noexcept
+    {
+        BOOST_ASSERT( is_inline() );
+        return lo_;
+    }
+
+    /** Return the high 64 bits of the inline magnitude.
+
+        @par Preconditions
+        `this->is_inline() == true`
+    */
+    std::uint64_t
+    high64() const noexcept
+    {
+        BOOST_ASSERT( is_inline() );
+        return hi_;
+    }
+
+    /** Return the stored text of a non-inline value.
+
+        The text is the number exactly as it was
+        given to @ref parse_big_number, including
+        the sign.
+
+        @par Preconditions
+        `this->is_inline() == false`
+    */
+    string_view
+    text() const noexcept
+    {
+        BOOST_ASSERT( ! is_inline() );
+        return text_;
+    }
+
+    /** Return `true` if the value fits in `std::uint64_t`.
+    */
+    bool
+    fits_uint64() const noexcept
+    {
+        return is_inline() &&
+            ! neg_ && hi_ == 0;
+    }
+
+    /** Return `true` if the value fits in `std::int64_t`.
+    */
+    bool
+    fits_int64() const noexcept
+    {
+        if( ! is_inline() || hi_ != 0 )
+            return false;
+        if( neg_ )
+            return lo_ <= UINT64_C(0x8000000000000000);
+        return lo_ <= UINT64_C(0x7FFFFFFFFFFFFFFF);
+    }
+
+    /** Return the value as `std::uint64_t`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Throws @ref system_error if
+        @ref fits_uint64 returns `false`.
+    */
+    BOOST_JSON_DECL
+    std::uint64_t
+    to_uint64() const;
+
+    /** Return the value as `std::int64_t`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Throws @ref system_error if
+        @ref fits_int64 returns `false`.
+    */
+    BOOST_JSON_DECL
+    std::int64_t
+    to_int64() const;
+
+    /** Return the value as decimal text.
+
+        The result is a valid JSON integer which
+        @ref parse_big_number converts back to an
+        equal value.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_JSON_DECL
+    std::string
+    to_string() const;
+
+    /** Return `true` if two numbers are equal.
+
+        Both representations are canonical, so
+        equality of value and equality of
+        representation coincide.
+    */
+    friend
+    bool
+    operator==(
+        big_number const& lhs,
+        big_number const& rhs) noexcept
+    {
+        return
+            lhs.neg_ == rhs.neg_ &&
+            lhs.lo_ == rhs.lo_ &&
+            lhs.hi_ == rhs.hi_ &&
+            lhs.text_ == rhs.text_;
+    }
+
+    /** Return `true` if two numbers are not equal.
+    */
+    friend
+    bool
+    operator!=(
+        big_number const& lhs,
+        big_number const& rhs) noexcept
+    {
+        return !( lhs == rhs );
+    }
+};
+
+/** Return decimal text parsed as a @ref big_number.
+
+    This function converts the JSON integer in
+    `s` to a @ref big_number. The text must
+    match the grammar of a JSON number without
+    a fraction or exponent part: an optional
+    minus sign followed by either a single zero
+    or a digit sequence with no leading zero.
+    Any other input fails with
+    @ref error::syntax. Negative zero parses as
+    zero.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The parsed number, or a
+    default-constructed @ref big_number if any
+    error occurred.
+
+    @param s The text to parse.
+
+    @param ec Set to the error, if any occurred.
+
+    @see @ref big_number, @ref raw_number.
+*/
+/** @{ */
+BOOST_JSON_DECL
+big_number
+parse_big_number(
+    string_view s,
+    error_code& ec);
+
+BOOST_JSON_DECL
+big_number
+parse_big_number(
+    string_view s,
+    std::error_code& ec);
+/** @} */
+
+/** Return decimal text parsed as a @ref big_number.
+
+    This overload behaves identically to
+    @ref parse_big_number(string_view,error_code&)
+    except that an exception is thrown on
+    invalid input.
+
+    @par Exception Safety
+    Strong guarantee.
+    Throws @ref system_error on invalid input.
+    Calls to allocate may throw.
+
+    @return The parsed number.
+
+    @param s The text to parse.
+*/
+BOOST_JSON_DECL
+big_number
+parse_big_number(
+    string_view s);
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,302 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_CBOR_HPP
+#define BOOST_JSON_CBOR_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/binary.hpp>
+#include <boost/json/detail/stack.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <string>
+
+namespace boost {
+namespace json {
+
+/** A serializer which emits CBOR.
+
+    This class traverses an instance of a library
+    type and emits the equivalent CBOR (RFC 8949)
+    encoding. It can serialize to caller-provided
+    buffers of any size, and may be used to
+    incrementally serialize large values without
+    the use of temporary buffers; the same
+    `reset`/`read`/`done` interface as
+    @ref serializer is provided.
+
+    All emitted items use definite lengths, and
+    integer arguments are encoded in the shortest
+    form, so the output is deterministically
+    encoded. Strings are written as text strings
+    (major type 3), and numbers preserve the kind
+    stored in the @ref value: `std::int64_t` and
+    `std::uint64_t` map to the integer major
+    types, while `double` is always written as a
+    64-bit float.
+
+    @par Example
+
+    This demonstrates how a @ref value may be
+    serialized to CBOR in pieces.
+
+    @code
+
+    cbor_serializer sr;
+    sr.reset( &jv );
+    while( ! sr.done() )
+    {
+        char buf[ 4000 ];
+        string_view sv = sr.read( buf );
+        write_frame( sv.data(), sv.size() );
+    }
+
+    @endcode
+
+    @see
+        @ref parse_cbor,
+        @ref serialize_cbor,
+        @ref serializer.
+*/
+class cbor_serializer
+{
+    detail::stack st_;
+    detail::binary_frame cur_;
+    value const* pj_ = nullptr;
+    char const* pay_ = nullptr;
+    std::size_t pay_n_ = 0;
+    char buf_[16];
+    unsigned char buf_n_ = 0;
+    unsigned char buf_i_ = 0;
+    bool has_cur_ = false;
+    bool done_ = true;
+
+    inline void stage(unsigned char b) noexcept;
+    inline void stage_head(
+        unsigned char major, std::uint64_t n) noexcept;
+    inline void emit(value const& jv);
+
+public:
+    /** Default constructor.
+
+        This constructs a serializer with no value.
+        The value @ref done returns `true`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    cbor_serializer() = default;
+
+    /** Returns `true` if the serialization is complete.
+
+        This function returns `true` when all of the
+        characters in the serialized representation of
+        the value have been read.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    bool
+    done() const noexcept
+    {
+        return done_;
+    }
+
+    /** Reset the serializer for a new element.
+
+        This function prepares the serializer to emit
+        a new serialized CBOR item representing `*p`.
+        Any internally allocated memory is preserved
+        and re-used for the new output.
+
+        @param p A pointer to the element to serialize.
+        Ownership is not transferred; the caller is
+        responsible for ensuring that the lifetime of
+        the object extends until it is no longer needed.
+    */
+    BOOST_JSON_DECL
+    void
+    reset(value const* p) noexcept;
+
+    /** Read the next buffer of serialized CBOR.
+
+        This function attempts to fill the caller
+        provided buffer starting at `dest` with up to
+        `size` bytes of the serialized item. If the
+        buffer is not large enough to hold the entire
+        output, subsequent calls will continue where
+        the last one left off.
+
+        @par Preconditions
+        @code
+        this->done() == false
+        @endcode
+
+        @par Complexity
+        Linear in `size`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return A @ref string_view containing the
+        bytes written to `dest`.
+
+        @param dest A pointer to valid memory of at
+        least `size` bytes.
+
+        @param size The maximum number of bytes to write.
+    */
+    BOOST_JSON_DECL
+    string_view
+    read(char* dest, std::size_t size);
+
+    /** Read the next buffer of serialized CBOR.
+
+        This is a convenience overload which writes
+        into an array of `char`.
+
+        @return A @ref string_view containing the
+        bytes written to `dest`.
+
+        @param dest The buffer to write into.
+    */
+    template<std::size_t N>
+    string_view
+    read(char(&dest)[N])
+    {
+        return this->read(dest, N);
+    }
+};
+
+/** Return a value parsed from a CBOR item.
+
+    This function parses an entire buffer holding
+    a single serialized CBOR (RFC 8949) item and
+    returns the equivalent @ref value. Input which
+    does not hold exactly one complete item
+    results in an error.
+
+    The encoding is mapped to JSON types as
+    follows: unsigned and negative integers become
+    `std::int64_t` when representable, with larger
+    unsigned values stored as `std::uint64_t`;
+    half- and single-precision floats are widened
+    to `double`; byte strings are stored as
+    strings, without transformation; `undefined`
+    is stored as null; and tags are ignored, with
+    the tagged item parsed in place. Map keys must
+    be strings, and negative integers below
+    `INT64_MIN` fail with
+    @ref error::number_too_large. Both definite
+    and indefinite lengths are accepted. Items
+    nested more than 32 levels deep fail with
+    @ref error::too_deep, mirroring the default
+    @ref parse_options::max_depth.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value holding the parsed result,
+    or null if any error occurred.
+
+    @param s The buffer to parse.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the new
+    value and all of its elements will use. If
+    this parameter is omitted, the default memory
+    resource is used.
+
+    @see
+        @ref parse,
+        @ref serialize_cbor.
+*/
+/** @{ */
+BOOST_JSON_DECL
+value
+parse_cbor(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp = {});
+
+BOOST_JSON_DECL
+value
+parse_cbor(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp = {});
+/** @} */
+
+/** Return a value parsed from a CBOR item.
+
+    This overload behaves identically to the
+    overloads taking an error code, except that a
+    `boost::system::system_error` is thrown on
+    failure instead.
+
+    @return A value holding the parsed result.
+
+    @param s The buffer to parse.
+
+    @param sp The memory resource that the new
+    value and all of its elements will use. If
+    this parameter is omitted, the default memory
+    resource is used.
+
+    @throw system_error Thrown on failure.
+*/
+BOOST_JSON_DECL
+value
+parse_cbor(
+    string_view s,
+    storage_ptr sp = {});
+
+/** Return the CBOR encoding of a value.
+
+    This function serializes `jv` as a single
+    CBOR item and returns it as a `std::string`,
+    using the encoding described by
+    @ref cbor_serializer.
+
+    @par Complexity
+    Linear in the size of the serialized output.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return The serialized bytes.
+
+    @param jv The value to serialize.
+
+    @see
+        @ref cbor_serializer,
+        @ref parse_cbor.
+*/
+BOOST_JSON_DECL
+std::string
+serialize_cbor(value const& jv);
+
+} // namespace json
+} // namespace boost
+
+#endif
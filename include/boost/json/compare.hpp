@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_COMPARE_HPP
+#define BOOST_JSON_COMPARE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** Return true if two values are equal.
+
+    This function behaves like `lhs == rhs`, except
+    that when `threads` is greater than one and both
+    values are containers, their elements are
+    partitioned into contiguous chunks which are
+    compared concurrently on that many threads of
+    execution. Objects compare equal regardless of
+    the order of their elements. This is useful for
+    diffing large documents, where a serial
+    comparison walks the entire tree on one core.
+
+    @par Complexity
+    Linear in the size of the smaller tree.
+
+    @par Exception Safety
+    Strong guarantee.
+    Exceptions from launching threads of execution
+    are propagated.
+
+    @return `true` if the trees are equal.
+
+    @param lhs The first value to compare.
+
+    @param rhs The second value to compare.
+
+    @param threads The maximum number of threads to
+    use. If this parameter is omitted, the
+    comparison is performed on the calling thread
+    only.
+*/
+BOOST_JSON_DECL
+bool
+equal(
+    value const& lhs,
+    value const& rhs,
+    unsigned threads = 1);
+
+/** Return true if two values are equal.
+
+    This function behaves like the overload taking
+    a thread count, except that the chunk
+    comparisons are submitted to `ex` instead of
+    transient threads of execution. Use this with
+    a shared @ref thread_pool to keep repeated
+    comparisons from oversubscribing the machine.
+
+    @par Complexity
+    Linear in the size of the smaller tree.
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @return `true` if the trees are equal.
+
+    @param lhs The first value to compare.
+
+    @param rhs The second value to compare.
+
+    @param ex The executor to run chunk
+    comparisons on.
+
+    @see
+        @ref executor,
+        @ref thread_pool.
+*/
+BOOST_JSON_DECL
+bool
+equal(
+    value const& lhs,
+    value const& rhs,
+    executor& ex);
+
+/** Return a seeded hash of a value.
+
+    This function computes a structural hash of
+    `jv`, folded into `seed`. Equal values produce
+    equal hashes for the same seed, and distinct
+    seeds produce independent hash streams, which
+    allows callers to keep per-document hash caches
+    and compare subtrees by hash before recursing:
+    hashes which differ prove the trees unequal
+    without walking them.
+
+    @par Complexity
+    Linear in the size of the tree.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The hash of the value.
+
+    @param jv The value to hash.
+
+    @param seed The seed to fold the hash into.
+
+    @see
+        @ref equal,
+        [Boost.ContainerHash](https://boost.org/libs/container_hash).
+*/
+BOOST_JSON_DECL
+std::size_t
+hash_value(
+    value const& jv,
+    std::size_t seed) noexcept;
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_BINARY_HPP
+#define BOOST_JSON_DETAIL_BINARY_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// Helpers shared by the CBOR and MessagePack
+// codecs. Both formats store multi-byte integer
+// arguments in network byte order.
+
+inline
+void
+store_be16(char* p, std::uint16_t v) noexcept
+{
+    p[0] = static_cast<char>(v >> 8);
+    p[1] = static_cast<char>(v);
+}
+
+inline
+void
+store_be32(char* p, std::uint32_t v) noexcept
+{
+    p[0] = static_cast<char>(v >> 24);
+    p[1] = static_cast<char>(v >> 16);
+    p[2] = static_cast<char>(v >> 8);
+    p[3] = static_cast<char>(v);
+}
+
+inline
+void
+store_be64(char* p, std::uint64_t v) noexcept
+{
+    store_be32(p, static_cast<
+        std::uint32_t>(v >> 32));
+    store_be32(p + 4, static_cast<
+        std::uint32_t>(v));
+}
+
+inline
+std::uint16_t
+load_be16(char const* p) noexcept
+{
+    return static_cast<std::uint16_t>(
+        (static_cast<unsigned char>(p[0]) << 8) |
+         static_cast<unsigned char>(p[1]));
+}
+
+inline
+std::uint32_t
+load_be32(char const* p) noexcept
+{
+    return
+        (static_cast<std::uint32_t>(
+            static_cast<unsigned char>(p[0])) << 24) |
+        (static_cast<std::uint32_t>(
+            static_cast<unsigned char>(p[1])) << 16) |
+        (static_cast<std::uint32_t>(
+            static_cast<unsigned char>(p[2])) << 8) |
+         static_cast<std::uint32_t>(
+            static_cast<unsigned char>(p[3]));
+}
+
+inline
+std::uint64_t
+load_be64(char const* p) noexcept
+{
+    return (static_cast<std::uint64_t>(
+        load_be32(p)) << 32) | load_be32(p + 4);
+}
+
+// one level of an in-progress traversal of a
+// value being serialized; object iteration
+// alternates between the key and the mapped
+// value of each element.
+struct binary_frame
+{
+    void const* it;
+    void const* end;
+    bool object;
+    bool key_done;
+};
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
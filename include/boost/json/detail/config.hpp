@@ -130,6 +130,37 @@
 # endif
 #endif
 
+#if ! defined(BOOST_JSON_NO_AVX2) && \
+    ! defined(BOOST_JSON_USE_AVX2)
+# if defined(__AVX2__)
+#  define BOOST_JSON_USE_AVX2
+# endif
+#endif
+
+#if ! defined(BOOST_JSON_NO_AVX512) && \
+    ! defined(BOOST_JSON_USE_AVX512)
+# if defined(__AVX512BW__)
+#  define BOOST_JSON_USE_AVX512
+# endif
+#endif
+
+/*  Binaries built for baseline x86-64 can still
+    run on processors with wider vector units; on
+    compilers which support per-function target
+    attributes we compile the AVX2 and AVX-512
+    kernels anyway and select them at run time.
+    When the build already targets AVX2 or better
+    the compile-time kernels are used directly.
+*/
+#if ! defined(BOOST_JSON_NO_RUNTIME_DISPATCH) && \
+    ! defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+# if ( defined(__GNUC__) || defined(__clang__) ) && \
+     ( defined(__x86_64__) || defined(__amd64__) ) && \
+     ! defined(__AVX2__)
+#  define BOOST_JSON_USE_RUNTIME_DISPATCH
+# endif
+#endif
+
 #ifndef BOOST_SYMBOL_VISIBLE
 #define BOOST_SYMBOL_VISIBLE
 #endif
@@ -213,7 +244,10 @@
 // them or else previously built libraries won't match.
 #ifndef  BOOST_JSON_MAX_STRING_SIZE
 # define BOOST_JSON_NO_MAX_STRING_SIZE
-# define BOOST_JSON_MAX_STRING_SIZE  0x7ffffffe
+// the two top bits of the 32-bit size field of
+// long strings hold the "unescaped" and "raw
+// number" marks; see detail/string_impl.hpp
+# define BOOST_JSON_MAX_STRING_SIZE  0x3ffffffe
 #endif
 #ifndef  BOOST_JSON_MAX_STRUCTURED_SIZE
 # define BOOST_JSON_NO_MAX_STRUCTURED_SIZE
@@ -234,6 +268,33 @@
 # endif
 #endif
 
+// The percentage by which array capacity grows
+// when an insertion must reallocate; 50 yields
+// the usual 1.5x geometric growth. A smaller
+// value trades more reallocations for less
+// slack, which matters with arena resources
+// where the vacated block cannot be reused.
+// The user can define the macro themselves when
+// building the library or including src.hpp.
+#ifndef  BOOST_JSON_ARRAY_GROWTH_PERCENT
+# define BOOST_JSON_ARRAY_GROWTH_PERCENT 50
+#endif
+
+// When defined, the library is built with the
+// compact lookup tables: the ryu double
+// formatter computes its powers of five from a
+// small table instead of storing the full one,
+// shrinking .rodata by several hundred KB at the
+// cost of a few percent of double formatting
+// speed. This suits short-lived processes where
+// cold-start page faults dominate. The user can
+// define the macro themselves when building the
+// library or including src.hpp.
+#ifdef BOOST_JSON_COMPACT_TABLES
+# ifndef BOOST_JSON_RYU_OPTIMIZE_SIZE
+#  define BOOST_JSON_RYU_OPTIMIZE_SIZE
+# endif
+#endif
 
 #if ! defined(BOOST_JSON_BIG_ENDIAN) && ! defined(BOOST_JSON_LITTLE_ENDIAN)
 // Copied from Boost.Endian
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_CPUID_HPP
+#define BOOST_JSON_DETAIL_CPUID_HPP
+
+#include <boost/json/detail/config.hpp>
+
+#ifdef BOOST_JSON_USE_RUNTIME_DISPATCH
+
+#include <cpuid.h>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+struct cpu_features
+{
+    bool avx2 = false;
+    bool avx512bw = false;
+};
+
+inline
+cpu_features
+detect_cpu_features() noexcept
+{
+    cpu_features f;
+
+    unsigned a, b, c, d;
+    __cpuid( 0, a, b, c, d );
+    if( a < 7 )
+        return f;
+
+    // the OS must have enabled saving of the
+    // wide registers before they may be used
+    __cpuid( 1, a, b, c, d );
+    if( ( c & ( 1u << 27 ) ) == 0 ) // OSXSAVE
+        return f;
+
+    std::uint32_t lo, hi;
+    __asm__ volatile(
+        "xgetbv" : "=a"(lo), "=d"(hi) : "c"(0) );
+    std::uint64_t const xcr0 =
+        lo | ( std::uint64_t(hi) << 32 );
+    bool const ymm = ( xcr0 & 0x06 ) == 0x06;
+    bool const zmm = ( xcr0 & 0xe6 ) == 0xe6;
+    if( ! ymm )
+        return f;
+
+    __cpuid_count( 7, 0, a, b, c, d );
+    f.avx2 = ( b & ( 1u << 5 ) ) != 0;
+    f.avx512bw = zmm &&
+        ( b & ( 1u << 16 ) ) != 0 && // AVX512F
+        ( b & ( 1u << 30 ) ) != 0;   // AVX512BW
+    return f;
+}
+
+inline
+cpu_features const&
+cpu() noexcept
+{
+    static cpu_features const f =
+        detect_cpu_features();
+    return f;
+}
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_JSON_DEFAULT_RESOURCE_HPP
 
 #include <boost/json/detail/config.hpp>
+#include <atomic>
 #include <new>
 
 namespace boost {
@@ -41,10 +42,15 @@ default_resource final
 # endif
 #endif
 
+    // the installed default, or null to
+    // use the built-in resource
+    static std::atomic<
+        memory_resource*> current_;
+
 public:
     static
     memory_resource*
-    get() noexcept
+    builtin() noexcept
     {
     #ifdef BOOST_JSON_WEAK_CONSTINIT
         static default_resource instance_;
@@ -54,6 +60,28 @@ public:
                 &instance_));
     }
 
+    static
+    memory_resource*
+    get() noexcept
+    {
+        auto const mr = current_.load(
+            std::memory_order_acquire);
+        if(mr)
+            return mr;
+        return builtin();
+    }
+
+    static
+    memory_resource*
+    set(memory_resource* mr) noexcept
+    {
+        auto const prev = current_.exchange(
+            mr, std::memory_order_acq_rel);
+        if(prev)
+            return prev;
+        return builtin();
+    }
+
     ~default_resource();
 
     void*
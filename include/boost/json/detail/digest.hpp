@@ -10,14 +10,46 @@
 #ifndef BOOST_JSON_DETAIL_DIGEST_HPP
 #define BOOST_JSON_DETAIL_DIGEST_HPP
 
+#include <boost/json/detail/config.hpp>
+#include <cstring>
+
+/*  The key digest is selected at compile time.
+
+    Defining BOOST_JSON_DIGEST(first, last, salt)
+    replaces the digest with a caller-supplied
+    expression evaluating to std::size_t; every
+    translation unit of a program must use the
+    same definition. Otherwise, when the target
+    supports it, contiguous keys are hashed with
+    the hardware CRC32-C instruction eight bytes
+    at a time; define BOOST_JSON_NO_CRC32 to
+    suppress this and keep the portable
+    multiplicative hash everywhere.
+
+    Consumers of the digest spread its bits over
+    the whole word: the bucket index uses the low
+    bits, the existence filter bits 16-21, and
+    the probe fragment the top byte. Any
+    replacement must distribute well across all
+    of them, and must incorporate the salt.
+*/
+#if ! defined(BOOST_JSON_DIGEST) && \
+    ! defined(BOOST_JSON_NO_CRC32) && \
+    defined(__SSE4_2__) && \
+    BOOST_JSON_ARCH == 64
+# define BOOST_JSON_USE_CRC32
+# include <nmmintrin.h>
+#endif
+
 namespace boost {
 namespace json {
 namespace detail {
 
 // Calculate salted digest of string
+// with the portable multiplicative hash
 template<class ForwardIterator>
 std::size_t
-digest(
+digest_fnv1a(
     ForwardIterator b,
     ForwardIterator e,
     std::size_t salt) noexcept
@@ -35,6 +67,80 @@ digest(
     return hash;
 }
 
+#ifdef BOOST_JSON_USE_CRC32
+
+// Calculate salted digest of string with the
+// CRC32-C instruction, eight bytes per step
+inline
+std::size_t
+digest_crc32(
+    char const* b,
+    char const* e,
+    std::size_t salt) noexcept
+{
+    std::size_t const len =
+        static_cast<std::size_t>(e - b);
+    std::uint64_t crc = salt;
+    char const* p = b;
+    std::size_t n = len;
+    while(n >= 8)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        crc = _mm_crc32_u64(crc, v);
+        p += 8;
+        n -= 8;
+    }
+    if(n)
+    {
+        // the tail is zero padded; mixing the
+        // length below keeps keys which differ
+        // only by trailing NULs distinct
+        std::uint64_t v = 0;
+        std::memcpy(&v, p, n);
+        crc = _mm_crc32_u64(crc, v);
+    }
+    // the instruction leaves the upper half
+    // zero; multiply by an odd constant to
+    // spread the entropy over the bits used
+    // by the filter and the probe fragment
+    std::uint64_t x = crc ^ salt ^
+        (static_cast<std::uint64_t>(len) << 32);
+    x *= 0xD6E8FEB86659FD93ULL;
+    x ^= x >> 32;
+    return static_cast<std::size_t>(x);
+}
+
+#endif
+
+// Calculate salted digest of string
+template<class ForwardIterator>
+std::size_t
+digest(
+    ForwardIterator b,
+    ForwardIterator e,
+    std::size_t salt) noexcept
+{
+#if defined(BOOST_JSON_DIGEST)
+    return BOOST_JSON_DIGEST(b, e, salt);
+#else
+    return digest_fnv1a(b, e, salt);
+#endif
+}
+
+#if ! defined(BOOST_JSON_DIGEST) && \
+    defined(BOOST_JSON_USE_CRC32)
+inline
+std::size_t
+digest(
+    char const* b,
+    char const* e,
+    std::size_t salt) noexcept
+{
+    return digest_crc32(b, e, salt);
+}
+#endif
+
 } // detail
 } // namespace json
 } // namespace boost
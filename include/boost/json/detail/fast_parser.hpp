@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_FAST_PARSER_HPP
+#define BOOST_JSON_DETAIL_FAST_PARSER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <vector>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+/*  Record the offsets of the unescaped string
+    delimiters and of the structural characters
+    appearing outside strings. Returns false,
+    setting ec, if the buffer ends inside a
+    string.
+*/
+BOOST_JSON_DECL
+bool
+build_index(
+    string_view s,
+    std::vector<std::size_t>& idx,
+    error_code& ec);
+
+/*  Two-stage parse of a complete JSON text.
+
+    Stage one scans the whole buffer with SIMD and
+    builds an index of the positions of unescaped
+    string delimiters and structural characters.
+    Stage two walks the index, validating atoms and
+    feeding a value_stack.
+
+    The caller is responsible for ensuring that the
+    options do not request comments, trailing commas,
+    infinity literals, or validation-only numbers;
+    those fall back to the incremental parser.
+*/
+BOOST_JSON_DECL
+value
+fast_parse(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt);
+
+/** Overload taking a previously built index for `s`.
+*/
+BOOST_JSON_DECL
+value
+fast_parse(
+    string_view s,
+    std::vector<std::size_t> const& idx,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt);
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
@@ -14,8 +14,10 @@
 #include <boost/json/string_view.hpp>
 #include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
+#include <boost/json/parse_options.hpp>
 #include <boost/json/string.hpp>
 #include <boost/json/value_stack.hpp>
+#include <string>
 
 namespace boost {
 namespace json {
@@ -41,6 +43,12 @@ struct handler
     explicit
     handler(Args&&... args);
 
+    inline void blobs(
+        blob_callback cb,
+        void* user,
+        string_view const* keys,
+        std::size_t n) noexcept;
+
     inline bool on_document_begin(error_code& ec);
     inline bool on_document_end(error_code& ec);
     inline bool on_object_begin(error_code& ec);
@@ -51,6 +59,7 @@ struct handler
     inline bool on_key(string_view s, std::size_t n, error_code& ec);
     inline bool on_string_part(string_view s, std::size_t n, error_code& ec);
     inline bool on_string(string_view s, std::size_t n, error_code& ec);
+    inline void on_string_reserve(std::size_t n);
     inline bool on_number_part(string_view, error_code&);
     inline bool on_int64(std::int64_t i, string_view, error_code& ec);
     inline bool on_uint64(std::uint64_t u, string_view, error_code& ec);
@@ -59,6 +68,26 @@ struct handler
     inline bool on_null(error_code& ec);
     inline bool on_comment_part(string_view, error_code&);
     inline bool on_comment(string_view, error_code&);
+
+private:
+    // when cb_ is set, string values of
+    // members whose key is in keys_ are
+    // streamed to the callback instead of
+    // being accumulated; the member is built
+    // with a null value. keys_ is the caller's
+    // array and is not copied.
+    blob_callback cb_ = nullptr;
+    void* user_ = nullptr;
+    string_view const* keys_ = nullptr;
+    std::size_t nkeys_ = 0;
+
+    // accumulates keys split across buffers,
+    // for matching against keys_
+    std::string key_;
+
+    // the value following a matched key
+    // streams if it turns out to be a string
+    bool pending_ = false;
 };
 
 } // detail
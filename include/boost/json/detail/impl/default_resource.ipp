@@ -28,6 +28,10 @@ default_resource::instance_;
 # endif
 #endif
 
+BOOST_JSON_REQUIRE_CONST_INIT
+std::atomic<memory_resource*>
+default_resource::current_{nullptr};
+
 // this is here so that ~memory_resource
 // is emitted in the library instead of
 // the user's TU.
@@ -62,6 +66,20 @@ do_is_equal(
 }
 
 } // detail
+
+memory_resource*
+get_default_resource() noexcept
+{
+    return detail::default_resource::get();
+}
+
+memory_resource*
+set_default_resource(
+    memory_resource* mr) noexcept
+{
+    return detail::default_resource::set(mr);
+}
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,1154 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_IMPL_FAST_PARSER_IPP
+#define BOOST_JSON_DETAIL_IMPL_FAST_PARSER_IPP
+
+#include <boost/json/detail/fast_parser.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/detail/charconv/from_chars.hpp>
+#include <boost/json/detail/charconv/detail/compute_float64.hpp>
+#include <boost/json/detail/charconv/detail/fast_float/ascii_number.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <boost/json/detail/uescape.hpp>
+#include <boost/json/detail/utf8.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+namespace {
+
+inline
+int
+ctz64(std::uint64_t m) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(m);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, m);
+    return static_cast<int>(index);
+#else
+    int n = 0;
+    while((m & 1) == 0)
+    {
+        m >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// bitmask of the bytes in p[0..63] equal to ch,
+// least significant bit first
+inline
+std::uint64_t
+mask_eq64(char const* p, char ch) noexcept
+{
+#ifdef BOOST_JSON_USE_SSE2
+    __m128i const q = _mm_set1_epi8(ch);
+    std::uint64_t m = static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p)), q)));
+    m |= static_cast<std::uint64_t>(static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p + 16)), q)))) << 16;
+    m |= static_cast<std::uint64_t>(static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p + 32)), q)))) << 32;
+    m |= static_cast<std::uint64_t>(static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p + 48)), q)))) << 48;
+    return m;
+#else
+    std::uint64_t m = 0;
+    for(int i = 0; i < 64; ++i)
+        if(p[i] == ch)
+            m |= std::uint64_t(1) << i;
+    return m;
+#endif
+}
+
+// running xor of all lower bits; a bit is set if
+// an odd number of bits at or below it are set
+inline
+std::uint64_t
+prefix_xor(std::uint64_t m) noexcept
+{
+    m ^= m << 1;
+    m ^= m << 2;
+    m ^= m << 4;
+    m ^= m << 8;
+    m ^= m << 16;
+    m ^= m << 32;
+    return m;
+}
+
+// bitmask of the characters preceded by an
+// unescaped backslash, carrying state across blocks
+inline
+std::uint64_t
+escaped_mask(
+    std::uint64_t backslash,
+    std::uint64_t& prev_escaped) noexcept
+{
+    std::uint64_t const even_bits = 0x5555555555555555ULL;
+    backslash &= ~prev_escaped;
+    std::uint64_t const follows =
+        (backslash << 1) | prev_escaped;
+    std::uint64_t const odd_starts =
+        backslash & ~even_bits & ~follows;
+    std::uint64_t const seq = odd_starts + backslash;
+    prev_escaped = (seq < backslash) ? 1 : 0;
+    return (even_bits ^ (seq << 1)) & follows;
+}
+
+// walks the structural index and feeds a value_stack
+template<bool AllowBadUTF8>
+class fast_parser
+{
+    char const* base_;
+    char const* end_;
+    std::vector<std::size_t> const& idx_;
+    std::size_t i_ = 0;
+    value_stack& st_;
+    parse_options const& opt_;
+
+    struct frame
+    {
+        std::size_t count;
+        bool is_object;
+    };
+
+    // elements of a number run awaiting their
+    // push; doubles keep the span of their text
+    // and are converted in batches, so the
+    // significand and exponent math runs as a
+    // tight loop over the gathered spans instead
+    // of being re-entered per element.
+    static std::size_t constexpr run_batch = 32;
+
+    struct run_elem
+    {
+        union
+        {
+            std::int64_t i;
+            std::uint64_t u;
+            double d;
+        };
+        char const* begin;
+        std::size_t size;
+        char kind; // 0=int64 1=uint64 2=double
+    };
+
+    bool
+    at_index(char const* p) const noexcept
+    {
+        return i_ < idx_.size() &&
+            idx_[i_] == static_cast<
+                std::size_t>(p - base_);
+    }
+
+    inline
+    bool
+    parse_string(
+        char const*& p,
+        bool is_key,
+        error_code& ec);
+
+    inline
+    bool
+    parse_number(
+        char const*& p,
+        error_code& ec);
+
+    inline
+    bool
+    parse_run_number(
+        char const*& p,
+        run_elem& e,
+        error_code& ec);
+
+    inline
+    void
+    flush_run(
+        run_elem* first,
+        std::size_t n);
+
+    inline
+    bool
+    parse_literal(
+        char const*& p,
+        char const* s,
+        std::size_t n,
+        error_code& ec);
+
+public:
+    fast_parser(
+        string_view s,
+        std::vector<std::size_t> const& idx,
+        value_stack& st,
+        parse_options const& opt) noexcept
+        : base_(s.data())
+        , end_(s.data() + s.size())
+        , idx_(idx)
+        , st_(st)
+        , opt_(opt)
+    {
+    }
+
+    inline
+    bool
+    run(error_code& ec);
+};
+
+template<bool AllowBadUTF8>
+bool
+fast_parser<AllowBadUTF8>::
+parse_string(
+    char const*& p,
+    bool is_key,
+    error_code& ec)
+{
+    if(BOOST_JSON_UNLIKELY(
+        ! at_index(p) || i_ + 1 >= idx_.size()))
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    std::size_t const close = idx_[i_ + 1];
+    if(BOOST_JSON_UNLIKELY(base_[close] != '\x22'))
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    i_ += 2;
+
+    char const* q = p + 1;
+    char const* const qe = base_ + close;
+    char const* start = q;
+    std::size_t size = 0;
+    while(q != qe)
+    {
+        q = count_valid<AllowBadUTF8>(q, qe);
+        if(q == qe)
+            break;
+        if(BOOST_JSON_UNLIKELY(*q != '\\'))
+        {
+            // control character or invalid utf-8
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        if(q > start)
+        {
+            st_.push_chars({start, static_cast<
+                std::size_t>(q - start)});
+            size += q - start;
+        }
+        BOOST_ASSERT(qe - q >= 2);
+        ++q;
+        char ch;
+        switch(*q)
+        {
+        case '\x22': ch = '\x22'; break;
+        case '\\': ch = '\\'; break;
+        case '/': ch = '/'; break;
+        case 'b': ch = '\x08'; break;
+        case 'f': ch = '\x0c'; break;
+        case 'n': ch = '\x0a'; break;
+        case 'r': ch = '\x0d'; break;
+        case 't': ch = '\x09'; break;
+        case 'u':
+        {
+            // runs of whole, valid escapes are
+            // decoded in bulk through a small
+            // buffer; an irregular escape ends
+            // the run and falls through to the
+            // scalar decoder, which reports it
+            {
+                char const* r = q - 1;
+                for(;;)
+                {
+                    char buf[64];
+                    char* d = buf;
+                    char const* const r2 =
+                        parse_uescape_run(
+                            r, qe, d, buf + sizeof(buf));
+                    if(d != buf)
+                    {
+                        st_.push_chars({buf, static_cast<
+                            std::size_t>(d - buf)});
+                        size += d - buf;
+                    }
+                    if(r2 == r)
+                        break;
+                    r = r2;
+                }
+                if(r != q - 1)
+                {
+                    if(! (qe - r >= 2 &&
+                        r[0] == '\\' && r[1] == 'u'))
+                    {
+                        // the whole run decoded
+                        q = r;
+                        start = q;
+                        continue;
+                    }
+                    q = r + 1;
+                }
+            }
+            ++q;
+            if(BOOST_JSON_UNLIKELY(qe - q < 4))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::expected_hex_digit);
+                return false;
+            }
+            int const d1 = hex_digit(static_cast<
+                unsigned char>(q[0]));
+            int const d2 = hex_digit(static_cast<
+                unsigned char>(q[1]));
+            int const d3 = hex_digit(static_cast<
+                unsigned char>(q[2]));
+            int const d4 = hex_digit(static_cast<
+                unsigned char>(q[3]));
+            if(BOOST_JSON_UNLIKELY(
+                (d1 | d2 | d3 | d4) == -1))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::expected_hex_digit);
+                return false;
+            }
+            unsigned cp =
+                (d1 << 12) + (d2 << 8) +
+                (d3 << 4) + d4;
+            q += 4;
+            if(cp >= 0xd800 && cp <= 0xdfff)
+            {
+                if(BOOST_JSON_UNLIKELY(cp > 0xdbff))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::illegal_leading_surrogate);
+                    return false;
+                }
+                if(BOOST_JSON_UNLIKELY(
+                    qe - q < 6 ||
+                    q[0] != '\\' || q[1] != 'u'))
+                {
+                    BOOST_JSON_FAIL(ec, error::syntax);
+                    return false;
+                }
+                q += 2;
+                int const e1 = hex_digit(static_cast<
+                    unsigned char>(q[0]));
+                int const e2 = hex_digit(static_cast<
+                    unsigned char>(q[1]));
+                int const e3 = hex_digit(static_cast<
+                    unsigned char>(q[2]));
+                int const e4 = hex_digit(static_cast<
+                    unsigned char>(q[3]));
+                if(BOOST_JSON_UNLIKELY(
+                    (e1 | e2 | e3 | e4) == -1))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::expected_hex_digit);
+                    return false;
+                }
+                unsigned const u2 =
+                    (e1 << 12) + (e2 << 8) +
+                    (e3 << 4) + e4;
+                if(BOOST_JSON_UNLIKELY(
+                    u2 < 0xdc00 || u2 > 0xdfff))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::illegal_trailing_surrogate);
+                    return false;
+                }
+                q += 4;
+                cp = ((cp - 0xd800) << 10) +
+                    (u2 - 0xdc00) + 0x10000;
+            }
+            char utf8[4];
+            std::size_t len;
+            if(cp < 0x80)
+            {
+                utf8[0] = static_cast<char>(cp);
+                len = 1;
+            }
+            else if(cp < 0x800)
+            {
+                utf8[0] = static_cast<char>(
+                    (cp >> 6) | 0xc0);
+                utf8[1] = static_cast<char>(
+                    (cp & 0x3f) | 0x80);
+                len = 2;
+            }
+            else if(cp < 0x10000)
+            {
+                utf8[0] = static_cast<char>(
+                    (cp >> 12) | 0xe0);
+                utf8[1] = static_cast<char>(
+                    ((cp >> 6) & 0x3f) | 0x80);
+                utf8[2] = static_cast<char>(
+                    (cp & 0x3f) | 0x80);
+                len = 3;
+            }
+            else
+            {
+                utf8[0] = static_cast<char>(
+                    (cp >> 18) | 0xf0);
+                utf8[1] = static_cast<char>(
+                    ((cp >> 12) & 0x3f) | 0x80);
+                utf8[2] = static_cast<char>(
+                    ((cp >> 6) & 0x3f) | 0x80);
+                utf8[3] = static_cast<char>(
+                    (cp & 0x3f) | 0x80);
+                len = 4;
+            }
+            st_.push_chars({utf8, len});
+            size += len;
+            start = q;
+            continue;
+        }
+        default:
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        }
+        st_.push_chars({&ch, 1});
+        ++size;
+        ++q;
+        start = q;
+    }
+
+    std::size_t const tail =
+        static_cast<std::size_t>(qe - start);
+    size += tail;
+    if(is_key)
+    {
+        if(BOOST_JSON_UNLIKELY(
+            size > string::max_size()))
+        {
+            BOOST_JSON_FAIL(ec, error::key_too_large);
+            return false;
+        }
+        st_.push_key({start, tail});
+    }
+    else
+    {
+        if(BOOST_JSON_UNLIKELY(
+            size > string::max_size()))
+        {
+            BOOST_JSON_FAIL(ec, error::string_too_large);
+            return false;
+        }
+        // when no escape was processed the
+        // characters need none on output either
+        st_.push_string(
+            {start, tail}, size == tail);
+    }
+    p = qe + 1;
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+fast_parser<AllowBadUTF8>::
+parse_run_number(
+    char const*& p,
+    run_elem& e,
+    error_code& ec)
+{
+    char const* const begin = p;
+    char const* const limit = i_ < idx_.size() ?
+        base_ + idx_[i_] : end_;
+
+    bool neg = false;
+    if(*p == '-')
+    {
+        neg = true;
+        ++p;
+    }
+    if(BOOST_JSON_UNLIKELY(p == limit ||
+        static_cast<unsigned char>(*p - '0') > 9))
+    {
+        BOOST_JSON_FAIL(ec, p == end_ ?
+            error::incomplete : error::syntax);
+        return false;
+    }
+
+    char const* const ds = p;
+    std::uint64_t m = 0;
+    if(*p == '0')
+    {
+        ++p;
+        if(BOOST_JSON_UNLIKELY(p != limit &&
+            static_cast<unsigned char>(*p - '0') <= 9))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+    }
+    else
+    {
+        // scan and convert in one pass;
+        // parse_digits examines 16 bytes at a
+        // time and the accumulated value is
+        // used when the token turns out to be
+        // an integer of twenty digits or fewer
+        while(limit - p >= 16)
+        {
+            int const n = parse_digits(m, p);
+            p += n;
+            if(n < 16)
+                break;
+        }
+        while(p != limit && static_cast<
+            unsigned char>(*p - '0') <= 9)
+        {
+            m = m * 10 + static_cast<
+                unsigned char>(*p - '0');
+            ++p;
+        }
+    }
+    std::size_t const n1 = p - ds;
+
+    bool is_int = true;
+    if(p != limit && *p == '.')
+    {
+        ++p;
+        char const* const fs = p;
+        while(limit - p >= 16)
+        {
+            int const n = count_digits(p);
+            p += n;
+            if(n < 16)
+                break;
+        }
+        while(p != limit && static_cast<
+            unsigned char>(*p - '0') <= 9)
+            ++p;
+        if(BOOST_JSON_UNLIKELY(p == fs))
+        {
+            BOOST_JSON_FAIL(ec, p == end_ ?
+                error::incomplete : error::syntax);
+            return false;
+        }
+        is_int = false;
+    }
+    if(p != limit && (*p | 32) == 'e')
+    {
+        ++p;
+        if(p != limit && (*p == '+' || *p == '-'))
+            ++p;
+        char const* const es = p;
+        while(p != limit && static_cast<
+            unsigned char>(*p - '0') <= 9)
+            ++p;
+        if(BOOST_JSON_UNLIKELY(p == es))
+        {
+            BOOST_JSON_FAIL(ec, p == end_ ?
+                error::incomplete : error::syntax);
+            return false;
+        }
+        is_int = false;
+    }
+
+    if(is_int)
+    {
+        if(n1 <= 18)
+        {
+            std::int64_t const i = static_cast<
+                std::int64_t>(m);
+            e.kind = 0;
+            e.i = neg ? -i : i;
+            return true;
+        }
+        if(n1 <= 20)
+        {
+            bool overflow = false;
+            if(n1 == 20)
+            {
+                // the fused accumulation may have
+                // wrapped; rebuild from the first
+                // nineteen digits, which always fit
+                m = parse_unsigned(0, ds, 19);
+                unsigned const d = ds[19] - '0';
+                if(m > (UINT64_MAX - d) / 10)
+                    overflow = true;
+                else
+                    m = m * 10 + d;
+            }
+            if(! overflow)
+            {
+                if(neg)
+                {
+                    if(m <= 9223372036854775808ULL)
+                    {
+                        e.kind = 0;
+                        e.i = static_cast<
+                            std::int64_t>(~m + 1);
+                        return true;
+                    }
+                }
+                else if(m <= INT64_MAX)
+                {
+                    e.kind = 0;
+                    e.i = static_cast<
+                        std::int64_t>(m);
+                    return true;
+                }
+                else
+                {
+                    e.kind = 1;
+                    e.u = m;
+                    return true;
+                }
+            }
+        }
+        // integer too large; fall
+        // through to double
+    }
+
+    e.kind = 2;
+    e.begin = begin;
+    e.size = static_cast<
+        std::size_t>(p - begin);
+    return true;
+}
+
+template<bool AllowBadUTF8>
+void
+fast_parser<AllowBadUTF8>::
+flush_run(
+    run_elem* first,
+    std::size_t n)
+{
+    namespace ff =
+        charconv::detail::fast_float;
+
+    // stage one: re-scan each gathered span
+    // once, extracting the decimal significand
+    // and exponent
+    ff::parsed_number_string pns[run_batch];
+    for(std::size_t i = 0; i < n; ++i)
+        if(first[i].kind == 2)
+            pns[i] = ff::parse_number_string(
+                first[i].begin,
+                first[i].begin + first[i].size,
+                ff::parse_options());
+
+    // stage two: the binary conversions run
+    // back to back, keeping the power tables
+    // hot across elements
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(first[i].kind != 2)
+            continue;
+        bool ok = false;
+        if(BOOST_JSON_LIKELY(
+            pns[i].valid &&
+            ! pns[i].too_many_digits &&
+            pns[i].exponent >= -325 &&
+            pns[i].exponent <= 308))
+        {
+            first[i].d =
+                charconv::detail::compute_float64(
+                    pns[i].exponent, pns[i].mantissa,
+                    pns[i].negative, ok);
+        }
+        if(BOOST_JSON_UNLIKELY(! ok))
+        {
+            // truncated significand or a
+            // hard-to-round case; resolve it
+            // with the full conversion
+            auto const r = charconv::from_chars(
+                first[i].begin,
+                first[i].begin + first[i].size,
+                first[i].d);
+            BOOST_ASSERT(
+                r.ec != std::errc::invalid_argument);
+            (void)r;
+        }
+    }
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        switch(first[i].kind)
+        {
+        case 0:
+            st_.push_int64(first[i].i);
+            break;
+        case 1:
+            st_.push_uint64(first[i].u);
+            break;
+        default:
+            st_.push_double(first[i].d);
+            break;
+        }
+    }
+}
+
+template<bool AllowBadUTF8>
+bool
+fast_parser<AllowBadUTF8>::
+parse_number(
+    char const*& p,
+    error_code& ec)
+{
+    run_elem e;
+    if(BOOST_JSON_UNLIKELY(
+        ! parse_run_number(p, e, ec)))
+        return false;
+    flush_run(&e, 1);
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+fast_parser<AllowBadUTF8>::
+parse_literal(
+    char const*& p,
+    char const* s,
+    std::size_t n,
+    error_code& ec)
+{
+    if(BOOST_JSON_UNLIKELY(
+        static_cast<std::size_t>(end_ - p) < n))
+    {
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(
+        std::memcmp(p, s, n) != 0))
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    p += n;
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+fast_parser<AllowBadUTF8>::
+run(error_code& ec)
+{
+    std::vector<frame> frames;
+    frames.reserve(opt_.max_depth < 256 ?
+        opt_.max_depth : 256);
+    char const* p = count_whitespace(base_, end_);
+
+expect_value:
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    switch(*p)
+    {
+    case '{':
+        if(BOOST_JSON_UNLIKELY(! at_index(p)))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        if(BOOST_JSON_UNLIKELY(
+            frames.size() >= opt_.max_depth))
+        {
+            BOOST_JSON_FAIL(ec, error::too_deep);
+            return false;
+        }
+        frames.push_back({0, true});
+        ++p;
+        ++i_;
+        p = count_whitespace(p, end_);
+        if(p != end_ && *p == '}')
+        {
+            if(BOOST_JSON_UNLIKELY(! at_index(p)))
+            {
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return false;
+            }
+            ++p;
+            ++i_;
+            st_.push_object(0);
+            frames.pop_back();
+            goto have_value;
+        }
+        goto expect_key;
+
+    case '[':
+        if(BOOST_JSON_UNLIKELY(! at_index(p)))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        if(BOOST_JSON_UNLIKELY(
+            frames.size() >= opt_.max_depth))
+        {
+            BOOST_JSON_FAIL(ec, error::too_deep);
+            return false;
+        }
+        frames.push_back({0, false});
+        ++p;
+        ++i_;
+        p = count_whitespace(p, end_);
+        if(p != end_ && *p == ']')
+        {
+            if(BOOST_JSON_UNLIKELY(! at_index(p)))
+            {
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return false;
+            }
+            ++p;
+            ++i_;
+            st_.push_array(0);
+            frames.pop_back();
+            goto have_value;
+        }
+        goto expect_value;
+
+    case '\x22':
+        if(BOOST_JSON_UNLIKELY(
+            ! parse_string(p, false, ec)))
+            return false;
+        goto have_value;
+
+    case 't':
+        if(BOOST_JSON_UNLIKELY(
+            ! parse_literal(p, "true", 4, ec)))
+            return false;
+        st_.push_bool(true);
+        goto have_value;
+
+    case 'f':
+        if(BOOST_JSON_UNLIKELY(
+            ! parse_literal(p, "false", 5, ec)))
+            return false;
+        st_.push_bool(false);
+        goto have_value;
+
+    case 'n':
+        if(BOOST_JSON_UNLIKELY(
+            ! parse_literal(p, "null", 4, ec)))
+            return false;
+        st_.push_null();
+        goto have_value;
+
+    default:
+        if(*p == '-' || static_cast<
+            unsigned char>(*p - '0') <= 9)
+        {
+            if(! frames.empty() &&
+                ! frames.back().is_object)
+            {
+                // batch a run of comma-separated
+                // numbers without going through
+                // the dispatch above. common in
+                // geometry-style documents.
+                frame& f = frames.back();
+                run_elem batch[run_batch];
+                std::size_t nb = 0;
+                for(;;)
+                {
+                    if(BOOST_JSON_UNLIKELY(
+                        ! parse_run_number(
+                            p, batch[nb], ec)))
+                        return false;
+                    ++nb;
+                    char const* const q =
+                        count_whitespace(p, end_);
+                    if(q == end_ || *q != ',' ||
+                        ! at_index(q))
+                        break;
+                    char const* const r =
+                        count_whitespace(q + 1, end_);
+                    if(r == end_ || (*r != '-' &&
+                        static_cast<unsigned char>(
+                            *r - '0') > 9))
+                        break;
+                    // the run continues; consume
+                    // the comma and count the
+                    // completed element here
+                    ++f.count;
+                    ++i_;
+                    p = r;
+                    if(nb == run_batch)
+                    {
+                        flush_run(batch, nb);
+                        nb = 0;
+                    }
+                }
+                flush_run(batch, nb);
+                goto have_value;
+            }
+            if(BOOST_JSON_UNLIKELY(
+                ! parse_number(p, ec)))
+                return false;
+            goto have_value;
+        }
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+    }
+
+have_value:
+    if(frames.empty())
+    {
+        p = count_whitespace(p, end_);
+        if(BOOST_JSON_UNLIKELY(
+            p != end_ || i_ != idx_.size()))
+        {
+            BOOST_JSON_FAIL(ec, error::extra_data);
+            return false;
+        }
+        return true;
+    }
+    {
+        frame& f = frames.back();
+        ++f.count;
+        p = count_whitespace(p, end_);
+        if(BOOST_JSON_UNLIKELY(p == end_))
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return false;
+        }
+        if(BOOST_JSON_UNLIKELY(! at_index(p)))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        if(f.is_object)
+        {
+            if(*p == ',')
+            {
+                ++p;
+                ++i_;
+                goto expect_key;
+            }
+            if(BOOST_JSON_LIKELY(*p == '}'))
+            {
+                ++p;
+                ++i_;
+                if(BOOST_JSON_UNLIKELY(f.count >
+                    object::max_size()))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::object_too_large);
+                    return false;
+                }
+                st_.push_object(f.count);
+                frames.pop_back();
+                goto have_value;
+            }
+        }
+        else
+        {
+            if(*p == ',')
+            {
+                ++p;
+                ++i_;
+                p = count_whitespace(p, end_);
+                goto expect_value;
+            }
+            if(BOOST_JSON_LIKELY(*p == ']'))
+            {
+                ++p;
+                ++i_;
+                if(BOOST_JSON_UNLIKELY(f.count >
+                    array::max_size()))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::array_too_large);
+                    return false;
+                }
+                st_.push_array(f.count);
+                frames.pop_back();
+                goto have_value;
+            }
+        }
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+
+expect_key:
+    p = count_whitespace(p, end_);
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(*p != '\x22'))
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(
+        ! parse_string(p, true, ec)))
+        return false;
+    p = count_whitespace(p, end_);
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(
+        *p != ':' || ! at_index(p)))
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    ++p;
+    ++i_;
+    p = count_whitespace(p, end_);
+    goto expect_value;
+}
+
+} // (anon)
+
+bool
+build_index(
+    string_view s,
+    std::vector<std::size_t>& idx,
+    error_code& ec)
+{
+    std::uint64_t prev_escaped = 0;
+    std::uint64_t prev_in_string = 0;
+    char const* const base = s.data();
+    std::size_t const n = s.size();
+    std::size_t i = 0;
+    while(i < n)
+    {
+        char buf[64];
+        char const* p;
+        if(n - i >= 64)
+        {
+            p = base + i;
+        }
+        else
+        {
+            std::memset(buf, 0, sizeof(buf));
+            std::memcpy(buf, base + i, n - i);
+            p = buf;
+        }
+
+        std::uint64_t const bs = mask_eq64(p, '\\');
+        std::uint64_t qt = mask_eq64(p, '\x22');
+        qt &= ~escaped_mask(bs, prev_escaped);
+
+        std::uint64_t const in_string =
+            prefix_xor(qt) ^ prev_in_string;
+        prev_in_string = static_cast<std::uint64_t>(
+            static_cast<std::int64_t>(in_string) >> 63);
+
+        std::uint64_t m =
+            mask_eq64(p, '{') | mask_eq64(p, '}') |
+            mask_eq64(p, '[') | mask_eq64(p, ']') |
+            mask_eq64(p, ':') | mask_eq64(p, ',');
+        m &= ~in_string;
+        m |= qt;
+        while(m)
+        {
+            idx.push_back(i + ctz64(m));
+            m &= m - 1;
+        }
+
+        i += 64;
+    }
+
+    if(prev_in_string)
+    {
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    return true;
+}
+
+value
+fast_parse(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    std::vector<std::size_t> idx;
+    if(! build_index(s, idx, ec))
+        return nullptr;
+    return fast_parse(
+        s, idx, ec, std::move(sp), opt);
+}
+
+value
+fast_parse(
+    string_view s,
+    std::vector<std::size_t> const& idx,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    unsigned char temp[
+        BOOST_JSON_STACK_BUFFER_SIZE];
+    value_stack st(
+        storage_ptr(), temp, sizeof(temp));
+    st.on_duplicate_key(opt.on_duplicate_key);
+    st.reset(std::move(sp));
+
+    // every element pushed on the stack is
+    // announced by at least one structural
+    // character, so the index bounds the
+    // number of values buffered at once.
+    // reserving up front means containers
+    // are built without growing the stack.
+    st.reserve(idx.size() + 1);
+
+    bool ok;
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        if(opt.allow_invalid_utf8)
+        {
+            fast_parser<true> pr(s, idx, st, opt);
+            ok = pr.run(ec);
+        }
+        else
+        {
+            fast_parser<false> pr(s, idx, st, opt);
+            ok = pr.run(ec);
+        }
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(system_error const& e)
+    {
+        // thrown by the duplicate key policy
+        if(e.code() != error::duplicate_key)
+            throw;
+        ec = e.code();
+        ok = false;
+    }
+#endif
+    if(! ok)
+        return nullptr;
+    return st.release();
+}
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
@@ -56,32 +56,89 @@ inline void format_digit( char * dest, unsigned v )
     *dest = static_cast<char>( v + '0' );
 }
 
+// number of decimal digits in v; valid for v >= 1
+inline unsigned decimal_digits( std::uint64_t v ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    // log10 approximated from the bit width,
+    // then corrected with one table lookup
+    static std::uint64_t const pow10[] = {
+        1, 10, 100, 1000,
+        10000, 100000, 1000000, 10000000,
+        100000000, 1000000000,
+        10000000000ULL, 100000000000ULL,
+        1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL,
+        10000000000000000ULL, 100000000000000000ULL,
+        1000000000000000000ULL, 10000000000000000000ULL };
+    unsigned const t = static_cast<unsigned>(
+        (64 - __builtin_clzll(v | 1)) * 1233 ) >> 12;
+    return t + 1 - (v < pow10[t]);
+#else
+    unsigned n = 1;
+    while( v >= 10000 )
+    {
+        v /= 10000;
+        n += 4;
+    }
+    if( v >= 1000 )
+        return n + 3;
+    if( v >= 100 )
+        return n + 2;
+    if( v >= 10 )
+        return n + 1;
+    return n;
+#endif
+}
+
 unsigned
 format_uint64(
     char* dest,
     std::uint64_t v) noexcept
 {
-    if(v < 10)
+    // values below 10000 dominate IDs and
+    // counters; emit them straight from the
+    // lookup table without the division loop
+    if( v < 10 )
     {
         *dest = static_cast<char>( '0' + v );
         return 1;
     }
+    if( v < 100 )
+    {
+        format_two_digits( dest, static_cast<unsigned>(v) );
+        return 2;
+    }
+    if( v < 10000 )
+    {
+        unsigned const u = static_cast<unsigned>(v);
+        if( u < 1000 )
+        {
+            format_digit( dest, u / 100 );
+            format_two_digits( dest + 1, u % 100 );
+            return 3;
+        }
+        format_four_digits( dest, u );
+        return 4;
+    }
 
-    char buffer[ 24 ];
-
-    char * p = buffer + 24;
+    // the digit count sizes the output
+    // exactly, so the digits are written
+    // directly into place back to front
+    unsigned const n = decimal_digits( v );
+    char * p = dest + n;
 
     while( v >= 1000 )
     {
         p -= 4;
-        format_four_digits( p, v % 10000 );
+        format_four_digits( p, static_cast<unsigned>(v % 10000) );
         v /= 10000;
     }
 
     if( v >= 10 )
     {
         p -= 2;
-        format_two_digits( p, v % 100 );
+        format_two_digits( p, static_cast<unsigned>(v % 100) );
         v /= 100;
     }
 
@@ -91,9 +148,7 @@ format_uint64(
         format_digit( p, static_cast<unsigned>(v) );
     }
 
-    unsigned const n = static_cast<unsigned>( buffer + 24 - p );
-    std::memcpy( dest, p, n );
-
+    BOOST_ASSERT( p == dest );
     return n;
 }
 
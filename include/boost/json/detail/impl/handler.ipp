@@ -11,6 +11,7 @@
 #define BOOST_JSON_DETAIL_IMPL_HANDLER_HPP
 
 #include <boost/json/detail/handler.hpp>
+#include <boost/json/system_error.hpp>
 #include <utility>
 
 namespace boost {
@@ -24,11 +25,29 @@ handler(Args&&... args)
 {
 }
 
+void
+handler::
+blobs(
+    blob_callback cb,
+    void* user,
+    string_view const* keys,
+    std::size_t n) noexcept
+{
+    cb_ = cb;
+    user_ = user;
+    keys_ = keys;
+    nkeys_ = n;
+}
+
 bool
 handler::
 on_document_begin(
     error_code&)
 {
+    // discard blob state left over from
+    // a parse which failed mid-string
+    pending_ = false;
+    key_.clear();
     return true;
 }
 
@@ -45,6 +64,8 @@ handler::
 on_object_begin(
     error_code&)
 {
+    // only string values stream
+    pending_ = false;
     return true;
 }
 
@@ -52,9 +73,27 @@ bool
 handler::
 on_object_end(
     std::size_t n,
-    error_code&)
+    error_code& ec)
 {
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+    {
+        st.push_object(n);
+    }
+    catch(system_error const& e)
+    {
+        // the duplicate key policy failed the
+        // object; report it through the parser
+        // instead of unwinding out of write()
+        if(e.code() != error::duplicate_key)
+            throw;
+        ec = e.code();
+        return false;
+    }
+#else
     st.push_object(n);
+    (void)ec;
+#endif
     return true;
 }
 
@@ -63,6 +102,7 @@ handler::
 on_array_begin(
     error_code&)
 {
+    pending_ = false;
     return true;
 }
 
@@ -70,9 +110,28 @@ bool
 handler::
 on_array_end(
     std::size_t n,
-    error_code&)
+    error_code& ec)
 {
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+    {
+        st.push_array(n);
+    }
+    catch(system_error const& e)
+    {
+        // the duplicate key policy failed a
+        // pair-array transform; report it
+        // through the parser instead of
+        // unwinding out of write()
+        if(e.code() != error::duplicate_key)
+            throw;
+        ec = e.code();
+        return false;
+    }
+#else
     st.push_array(n);
+    (void)ec;
+#endif
     return true;
 }
 
@@ -84,9 +143,11 @@ on_key_part(
     error_code&)
 {
     st.push_chars(s);
+    if(cb_)
+        key_.append(s.data(), s.size());
     return true;
 }
-        
+
 bool
 handler::
 on_key(
@@ -95,16 +156,41 @@ on_key(
     error_code&)
 {
     st.push_key(s);
+    if(cb_)
+    {
+        string_view k = s;
+        if(! key_.empty())
+        {
+            key_.append(
+                s.data(), s.size());
+            k = key_;
+        }
+        for(std::size_t i = 0;
+                i < nkeys_; ++i)
+        {
+            if(k == keys_[i])
+            {
+                pending_ = true;
+                break;
+            }
+        }
+        key_.clear();
+    }
     return true;
 }
-        
+
 bool
 handler::
 on_string_part(
     string_view s,
-    std::size_t, 
+    std::size_t,
     error_code&)
 {
+    if(pending_)
+    {
+        cb_(user_, s, false);
+        return true;
+    }
     st.push_chars(s);
     return true;
 }
@@ -113,19 +199,40 @@ bool
 handler::
 on_string(
     string_view s,
-    std::size_t, 
+    std::size_t,
     error_code&)
 {
+    if(pending_)
+    {
+        // a null stands in for the
+        // streamed string
+        cb_(user_, s, true);
+        st.push_null();
+        pending_ = false;
+        return true;
+    }
     st.push_string(s);
     return true;
 }
 
+void
+handler::
+on_string_reserve(
+    std::size_t n)
+{
+    // streamed blobs are never accumulated
+    if(! pending_)
+        st.reserve_chars(n);
+}
+
 bool
 handler::
 on_number_part(
-    string_view,
+    string_view s,
     error_code&)
 {
+    if(st.raw_numbers())
+        st.push_chars(s);
     return true;
 }
 
@@ -133,21 +240,29 @@ bool
 handler::
 on_int64(
     std::int64_t i,
-    string_view,
+    string_view s,
     error_code&)
 {
-    st.push_int64(i);
+    pending_ = false;
+    if(st.raw_numbers())
+        st.push_raw_number(s);
+    else
+        st.push_int64(i);
     return true;
 }
-        
+
 bool
 handler::
 on_uint64(
     std::uint64_t u,
-    string_view,
+    string_view s,
     error_code&)
 {
-    st.push_uint64(u);
+    pending_ = false;
+    if(st.raw_numbers())
+        st.push_raw_number(s);
+    else
+        st.push_uint64(u);
     return true;
 }
 
@@ -155,10 +270,14 @@ bool
 handler::
 on_double(
     double d,
-    string_view,
+    string_view s,
     error_code&)
 {
-    st.push_double(d);
+    pending_ = false;
+    if(st.raw_numbers())
+        st.push_raw_number(s);
+    else
+        st.push_double(d);
     return true;
 }
         
@@ -168,6 +287,7 @@ on_bool(
     bool b,
     error_code&)
 {
+    pending_ = false;
     st.push_bool(b);
     return true;
 }
@@ -176,6 +296,7 @@ bool
 handler::
 on_null(error_code&)
 {
+    pending_ = false;
     st.push_null();
     return true;
 }
@@ -33,6 +33,7 @@ stack(
     , cap_(buf_size)
     , base_(buf)
     , buf_(buf)
+    , buf_cap_(buf_size)
 {
 }
 
@@ -55,6 +56,23 @@ reserve(std::size_t n)
     cap_ = n;
 }
 
+void
+stack::
+shrink_to_fit() noexcept
+{
+    // capacity is retained at its
+    // high-water mark unless the current
+    // contents fit in the initial buffer
+    if( base_ == buf_ ||
+        size_ > buf_cap_)
+        return;
+    if(size_ > 0)
+        std::memcpy(buf_, base_, size_);
+    sp_->deallocate(base_, cap_);
+    base_ = buf_;
+    cap_ = buf_cap_;
+}
+
 } // detail
 } // namespace json
 } // namespace boost
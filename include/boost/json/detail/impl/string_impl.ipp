@@ -87,8 +87,12 @@ string_impl(
         sp->allocate(s.size() + 1,
             alignof(char)));
     k_.s[s.size()] = 0; // null term
-    std::memcpy(&k_.s[0],
-        s.data(), s.size());
+    if(s.size() <= copy_small_max)
+        copy_small(&k_.s[0],
+            s.data(), s.size());
+    else
+        std::memcpy(&k_.s[0],
+            s.data(), s.size());
 }
 
 // construct a key, unchecked
@@ -114,6 +118,23 @@ string_impl(
         s2.data(), s2.size());
 }
 
+// adopt an existing key allocation, unchecked.
+// the allocation must come from the same arena
+// and outlive this string, which holds when the
+// resource's deallocate is trivial.
+string_impl::
+string_impl(
+    key_t,
+    char* s,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n <= max_size());
+    k_.k = key_string_;
+    k_.n = static_cast<
+        std::uint32_t>(n);
+    k_.s = s;
+}
+
 std::uint32_t
 string_impl::
 growth(
@@ -443,28 +464,29 @@ shrink_to_fit(
     if(s_.k == short_string_)
         return;
     auto const t = p_.t;
-    if(t->size <= sbo_chars_)
+    auto const n = size();
+    if(n <= sbo_chars_)
     {
         s_.k = short_string_;
         std::memcpy(
-            s_.buf, data(), t->size);
+            s_.buf, data(), n);
         s_.buf[sbo_chars_] =
             static_cast<char>(
-                sbo_chars_ - t->size);
-        s_.buf[t->size] = 0;
+                sbo_chars_ - n);
+        s_.buf[n] = 0;
         sp->deallocate(t,
             sizeof(table) +
                 t->capacity + 1,
             alignof(table));
         return;
     }
-    if(t->size >= t->capacity)
+    if(n >= t->capacity)
         return;
 #ifndef BOOST_NO_EXCEPTIONS
     try
     {
 #endif
-        string_impl tmp(t->size, sp);
+        string_impl tmp(n, sp);
         std::memcpy(
             tmp.data(),
             data(),
@@ -10,6 +10,7 @@
 #ifndef BOOST_JSON_DETAIL_OBJECT_HPP
 #define BOOST_JSON_DETAIL_OBJECT_HPP
 
+#include <boost/json/parse_options.hpp>
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/string_view.hpp>
 #include <cstdlib>
@@ -31,6 +32,7 @@ class unchecked_object
     value* data_;
     std::size_t size_;
     storage_ptr const& sp_;
+    duplicate_keys dup_;
 
 public:
     inline
@@ -39,10 +41,13 @@ public:
     unchecked_object(
         value* data,
         std::size_t size, // # of kv-pairs
-        storage_ptr const& sp) noexcept
+        storage_ptr const& sp,
+        duplicate_keys dup =
+            duplicate_keys::last) noexcept
         : data_(data)
         , size_(size)
         , sp_(sp)
+        , dup_(dup)
     {
     }
 
@@ -51,6 +56,7 @@ public:
         : data_(other.data_)
         , size_(other.size_)
         , sp_(other.sp_)
+        , dup_(other.dup_)
     {
         other.data_ = nullptr;
     }
@@ -67,6 +73,12 @@ public:
         return size_;
     }
 
+    duplicate_keys
+    policy() const noexcept
+    {
+        return dup_;
+    }
+
     value*
     release() noexcept
     {
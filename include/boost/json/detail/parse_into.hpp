@@ -15,6 +15,9 @@
 
 #include <boost/json/error.hpp>
 #include <boost/json/conversion.hpp>
+#include <boost/json/raw_number.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/value_to.hpp>
 #include <boost/describe/enum_from_string.hpp>
 
 #include <vector>
@@ -77,9 +80,29 @@ namespace detail {
 template< class Impl, class T, class Parent >
 class converting_handler;
 
+// raw_number has no generic conversion category; it is
+// only meaningful during a parse, where the original
+// character representation is available
+struct raw_number_conversion_tag { };
+
 // get_handler
+//
+// raw_number uses its dedicated capturing handler. Types
+// with a user-provided tag_invoke overload use the
+// dedicated user conversion handler, mirroring the
+// precedence such overloads have in value_to; all other
+// types get the handler for their generic conversion
+// category.
 template< class V, class P >
-using get_handler = converting_handler< generic_conversion_category<V>, V, P >;
+using get_handler = converting_handler<
+    mp11::mp_cond<
+        std::is_same< V, raw_number >,
+        raw_number_conversion_tag,
+        has_user_conversion1< V, value_to_conversion >,
+        user_conversion_tag,
+        mp11::mp_true,
+        generic_conversion_category<V> >,
+    V, P >;
 
 template<error E> class handler_error_base
 {
@@ -97,10 +120,10 @@ public:
     bool on_array_end( error_code& ec ) { BOOST_JSON_FAIL( ec, E ); return false; }
     bool on_string_part( error_code& ec, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
     bool on_string( error_code& ec, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
-    bool on_number_part( error_code& ec ) { BOOST_JSON_FAIL( ec, E ); return false; }
-    bool on_int64( error_code& ec, std::int64_t ) { BOOST_JSON_FAIL( ec, E ); return false; }
-    bool on_uint64( error_code& ec, std::uint64_t ) { BOOST_JSON_FAIL( ec, E ); return false; }
-    bool on_double( error_code& ec, double ) { BOOST_JSON_FAIL( ec, E ); return false; }
+    bool on_number_part( error_code& ec, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
+    bool on_int64( error_code& ec, std::int64_t, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
+    bool on_uint64( error_code& ec, std::uint64_t, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
+    bool on_double( error_code& ec, double, string_view ) { BOOST_JSON_FAIL( ec, E ); return false; }
     bool on_bool( error_code& ec, bool ) { BOOST_JSON_FAIL( ec, E ); return false; }
     bool on_null( error_code& ec ) { BOOST_JSON_FAIL( ec, E ); return false; }
 
@@ -213,24 +236,24 @@ public:
         BOOST_JSON_INVOKE_INNER( on_string(ec, sv) );
     }
 
-    bool on_number_part( error_code& ec )
+    bool on_number_part( error_code& ec, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_number_part(ec) );
+        BOOST_JSON_INVOKE_INNER( on_number_part(ec, sv) );
     }
 
-    bool on_int64( error_code& ec, std::int64_t v )
+    bool on_int64( error_code& ec, std::int64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_int64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_int64(ec, v, sv) );
     }
 
-    bool on_uint64( error_code& ec, std::uint64_t v )
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v, sv) );
     }
 
-    bool on_double( error_code& ec, double v )
+    bool on_double( error_code& ec, double v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_double(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_double(ec, v, sv) );
     }
 
     bool on_bool( error_code& ec, bool v )
@@ -280,12 +303,12 @@ public:
         , value_(v)
     {}
 
-    bool on_number_part( error_code& )
+    bool on_number_part( error_code&, string_view )
     {
         return true;
     }
 
-    bool on_int64( error_code& ec, std::int64_t v )
+    bool on_int64( error_code& ec, std::int64_t v, string_view )
     {
         if( !integral_in_range<V>( v ) )
         {
@@ -299,7 +322,7 @@ public:
         return true;
     }
 
-    bool on_uint64( error_code& ec, std::uint64_t v )
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view )
     {
         if( !integral_in_range<V>( v ) )
         {
@@ -328,12 +351,12 @@ public:
         , value_(v)
     {}
 
-    bool on_number_part( error_code& )
+    bool on_number_part( error_code&, string_view )
     {
         return true;
     }
 
-    bool on_int64( error_code&, std::int64_t v )
+    bool on_int64( error_code&, std::int64_t v, string_view )
     {
         *value_ = static_cast<V>( v );
 
@@ -341,7 +364,7 @@ public:
         return true;
     }
 
-    bool on_uint64( error_code&, std::uint64_t v )
+    bool on_uint64( error_code&, std::uint64_t v, string_view )
     {
         *value_ = static_cast<V>( v );
 
@@ -349,7 +372,7 @@ public:
         return true;
     }
 
-    bool on_double( error_code&, double v )
+    bool on_double( error_code&, double v, string_view )
     {
         *value_ = static_cast<V>( v );
 
@@ -358,6 +381,62 @@ public:
     }
 };
 
+// raw number handler
+template< class V, class P >
+class converting_handler<raw_number_conversion_tag, V, P>
+    : public scalar_handler<P, error::not_number>
+{
+private:
+    V* value_;
+    bool started_ = false;
+
+public:
+    converting_handler( V* v, P* p )
+        : converting_handler::scalar_handler(p)
+        , value_(v)
+    {}
+
+    // the final event's view covers only the
+    // characters after the last part, so the
+    // pieces are appended as they arrive
+    bool on_number_part( error_code&, string_view sv )
+    {
+        if( !started_ )
+        {
+            value_->text.clear();
+            started_ = true;
+        }
+        value_->text.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_int64( error_code&, std::int64_t, string_view sv )
+    {
+        return capture(sv);
+    }
+
+    bool on_uint64( error_code&, std::uint64_t, string_view sv )
+    {
+        return capture(sv);
+    }
+
+    bool on_double( error_code&, double, string_view sv )
+    {
+        return capture(sv);
+    }
+
+private:
+    bool capture( string_view sv )
+    {
+        if( !started_ )
+            value_->text.clear();
+        started_ = false;
+        value_->text.append( sv.data(), sv.size() );
+        this->parent_->signal_value();
+        return true;
+    }
+};
+
 // string handler
 template< class V, class P >
 class converting_handler<string_like_conversion_tag, V, P>
@@ -501,6 +580,166 @@ class converting_handler<no_conversion_tag, V, P>
     static_assert( sizeof(V) == 0, "This type is not supported" );
 };
 
+// user conversion handler
+//
+// A type with a user-provided tag_invoke overload cannot be
+// filled in place, because the overload only accepts a value.
+// Instead, the subtree for the current element is materialized
+// on a value stack and converted as soon as it completes, so
+// at most one element's source tree is resident at a time
+// rather than the whole document's.
+template< class V, class P >
+class converting_handler<user_conversion_tag, V, P>
+{
+private:
+    V* value_;
+    P* parent_;
+
+    value_stack st_;
+    // elements so far in each unfinished
+    // container of the current subtree
+    std::vector<std::size_t> counts_;
+    bool started_ = false;
+
+    void
+    start()
+    {
+        if( !started_ )
+        {
+            st_.reset();
+            started_ = true;
+        }
+    }
+
+    bool
+    complete( error_code& ec )
+    {
+        if( !counts_.empty() )
+        {
+            // a value inside the subtree
+            ++counts_.back();
+            return true;
+        }
+
+        started_ = false;
+        value const jv = st_.release();
+        auto res = try_value_to<V>( jv );
+        if( res.has_error() )
+        {
+            ec = res.error();
+            return false;
+        }
+        *value_ = std::move( *res );
+        parent_->signal_value();
+        return true;
+    }
+
+public:
+    converting_handler( converting_handler const& ) = delete;
+    converting_handler& operator=( converting_handler const& ) = delete;
+
+    converting_handler( V* v, P* p )
+        : value_(v), parent_(p)
+    {}
+
+    bool on_object_begin( error_code& )
+    {
+        start();
+        counts_.push_back( 0 );
+        return true;
+    }
+
+    bool on_object_end( error_code& ec )
+    {
+        st_.push_object( counts_.back() );
+        counts_.pop_back();
+        return complete(ec);
+    }
+
+    bool on_array_begin( error_code& )
+    {
+        start();
+        counts_.push_back( 0 );
+        return true;
+    }
+
+    bool on_array_end( error_code& ec )
+    {
+        if( !started_ )
+            return parent_->signal_end(ec);
+
+        st_.push_array( counts_.back() );
+        counts_.pop_back();
+        return complete(ec);
+    }
+
+    bool on_key_part( error_code&, string_view sv )
+    {
+        st_.push_chars( sv );
+        return true;
+    }
+
+    bool on_key( error_code&, string_view sv )
+    {
+        st_.push_key( sv );
+        return true;
+    }
+
+    bool on_string_part( error_code&, string_view sv )
+    {
+        start();
+        st_.push_chars( sv );
+        return true;
+    }
+
+    bool on_string( error_code& ec, string_view sv )
+    {
+        start();
+        st_.push_string( sv );
+        return complete(ec);
+    }
+
+    bool on_number_part( error_code&, string_view )
+    {
+        return true;
+    }
+
+    bool on_int64( error_code& ec, std::int64_t v, string_view )
+    {
+        start();
+        st_.push_int64( v );
+        return complete(ec);
+    }
+
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view )
+    {
+        start();
+        st_.push_uint64( v );
+        return complete(ec);
+    }
+
+    bool on_double( error_code& ec, double v, string_view )
+    {
+        start();
+        st_.push_double( v );
+        return complete(ec);
+    }
+
+    bool on_bool( error_code& ec, bool v )
+    {
+        start();
+        st_.push_bool( v );
+        return complete(ec);
+    }
+
+    bool on_null( error_code& ec )
+    {
+        start();
+        st_.push_null();
+        return complete(ec);
+    }
+};
+
 // sequence handler
 template< class It >
 bool check_inserter( It l, It r )
@@ -540,6 +779,52 @@ clear_container(
     target.clear();
 }
 
+// request capacity for n elements when the
+// container supports it, so that elements
+// streamed in afterwards do not reallocate
+template<class T>
+auto
+reserve_container_impl( T& target, std::size_t n, int )
+    -> decltype( target.reserve(n), void() )
+{
+    target.reserve(n);
+}
+
+template<class T>
+void
+reserve_container_impl( T&, std::size_t, long )
+{
+}
+
+template<class T>
+void
+reserve_container( T& target, std::size_t n )
+{
+    detail::reserve_container_impl( target, n, 0 );
+}
+
+template<class T>
+auto
+container_size_impl( T const& target, int )
+    -> decltype( std::size_t(target.size()) )
+{
+    return target.size();
+}
+
+template<class T>
+std::size_t
+container_size_impl( T const&, long )
+{
+    return 0;
+}
+
+template<class T>
+std::size_t
+container_size( T const& target )
+{
+    return detail::container_size_impl( target, 0 );
+}
+
 template< class V, class P >
 class converting_handler<sequence_conversion_tag, V, P>
     : public composite_handler<
@@ -594,7 +879,15 @@ public:
             return this->inner_.on_array_begin( ec );
 
         this->inner_active_ = true;
+        // the previous size approximates the next
+        // one when the same container is reused
+        // across calls, keeping the steady state
+        // free of reallocations
+        std::size_t const hint =
+            detail::container_size( *value_ );
         clear_container( *value_, inserter_implementation<V>() );
+        detail::reserve_container( *value_, hint );
+        inserter = detail::inserter(*value_, inserter_implementation<V>());
         return true;
     }
 
@@ -605,8 +898,45 @@ public:
 
         return this->parent_->signal_end(ec);
     }
+
+    void reserve_hint( std::size_t n )
+    {
+        detail::reserve_container( *value_, n );
+        inserter = detail::inserter(*value_, inserter_implementation<V>());
+    }
 };
 
+// insert a parsed member into a map-like
+// container; hinted insertion lets keys which
+// arrive already in order append in amortized
+// constant time, while containers that ignore
+// the hint pay nothing extra
+template<class T, class K, class M>
+auto
+emplace_member_impl( T& target, K&& key, M&& m, int )
+    -> decltype( target.emplace_hint(
+        target.end(), static_cast<K&&>(key), static_cast<M&&>(m) ), void() )
+{
+    target.emplace_hint(
+        target.end(), static_cast<K&&>(key), static_cast<M&&>(m) );
+}
+
+template<class T, class K, class M>
+void
+emplace_member_impl( T& target, K&& key, M&& m, long )
+{
+    target.emplace(
+        static_cast<K&&>(key), static_cast<M&&>(m) );
+}
+
+template<class T, class K, class M>
+void
+emplace_member( T& target, K&& key, M&& m )
+{
+    detail::emplace_member_impl( target,
+        static_cast<K&&>(key), static_cast<M&&>(m), 0 );
+}
+
 // map handler
 template< class V, class P >
 class converting_handler<map_like_conversion_tag, V, P>
@@ -627,7 +957,8 @@ public:
 
     void signal_value()
     {
-        value_->emplace( std::move(key_), std::move(this->next_value_) );
+        detail::emplace_member( *value_,
+            std::move(key_), std::move(this->next_value_) );
 
         key_ = {};
         this->next_value_ = {};
@@ -640,7 +971,12 @@ public:
         if( this->inner_active_ )
             return this->inner_.on_object_begin(ec);
 
+        // see the note in the sequence handler;
+        // maps without reserve() ignore the hint
+        std::size_t const hint =
+            detail::container_size( *value_ );
         clear_container( *value_, inserter_implementation<V>() );
+        detail::reserve_container( *value_, hint );
         return true;
     }
 
@@ -1012,6 +1348,7 @@ private:
 
     handler_tuple< converting_handler, struct_element_list<V> > handlers_;
     int inner_active_ = -1;
+    int next_expected_ = 0;
     std::size_t activated_ = 0;
 
 public:
@@ -1132,11 +1469,35 @@ public:
             key = key_;
         }
 
+        constexpr int N = mp11::mp_size<Dm>::value;
+
+        // documents produced by one writer
+        // usually repeat a single member
+        // order, so the member following the
+        // previous match is tried before
+        // searching
+        if( N > 0 )
+        {
+            bool const hit = mp11::mp_with_index< mp11::mp_size<Dm> >(
+                next_expected_,
+                [&]( auto I )
+                {
+                    using D = mp11::mp_at< Dm, decltype(I) >;
+                    return key == D::name;
+                });
+            if( hit )
+            {
+                inner_active_ = next_expected_;
+                next_expected_ = ( next_expected_ + 1 ) % N;
+                return true;
+            }
+        }
+
         int i = 0;
 
         auto f = [&](char const* name)
         {
-            if( key == name )
+            if( inner_active_ < 0 && key == name )
                 inner_active_ = i;
             ++i;
         };
@@ -1150,6 +1511,7 @@ public:
             return false;
         }
 
+        next_expected_ = ( inner_active_ + 1 ) % N;
         return true;
     }
 
@@ -1163,24 +1525,24 @@ public:
         BOOST_JSON_INVOKE_INNER( on_string(ec, sv) );
     }
 
-    bool on_number_part( error_code& ec )
+    bool on_number_part( error_code& ec, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_number_part(ec) );
+        BOOST_JSON_INVOKE_INNER( on_number_part(ec, sv) );
     }
 
-    bool on_int64( error_code& ec, std::int64_t v )
+    bool on_int64( error_code& ec, std::int64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_int64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_int64(ec, v, sv) );
     }
 
-    bool on_uint64( error_code& ec, std::uint64_t v )
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v, sv) );
     }
 
-    bool on_double( error_code& ec, double v )
+    bool on_double( error_code& ec, double v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_double(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_double(ec, v, sv) );
     }
 
     bool on_bool( error_code& ec, bool v )
@@ -1224,16 +1586,19 @@ struct string_handler_event
 struct int64_handler_event
 {
     std::int64_t value;
+    std::string text;
 };
 
 struct uint64_handler_event
 {
     std::uint64_t value;
+    std::string text;
 };
 
 struct double_handler_event
 {
     double value;
+    std::string text;
 };
 
 struct bool_handler_event
@@ -1302,19 +1667,19 @@ struct event_visitor
     bool
     operator()(int64_handler_event& ev) const
     {
-        return handler.on_int64(ec, ev.value);
+        return handler.on_int64(ec, ev.value, ev.text);
     }
 
     bool
     operator()(uint64_handler_event& ev) const
     {
-        return handler.on_uint64(ec, ev.value);
+        return handler.on_uint64(ec, ev.value, ev.text);
     }
 
     bool
     operator()(double_handler_event& ev) const
     {
-        return handler.on_double(ec, ev.value);
+        return handler.on_double(ec, ev.value, ev.text);
     }
 
     bool
@@ -1501,24 +1866,31 @@ public:
             string_handler_event{ std::move(string_) }, ec );
     }
 
-    bool on_number_part( error_code& )
+    bool on_number_part( error_code&, string_view sv )
     {
+        string_.append(sv);
         return true;
     }
 
-    bool on_int64( error_code& ec, std::int64_t v )
+    bool on_int64( error_code& ec, std::int64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( int64_handler_event{v}, ec );
+        string_.append(sv);
+        BOOST_JSON_INVOKE_INNER(
+            (int64_handler_event{v, std::move(string_)}), ec );
     }
 
-    bool on_uint64( error_code& ec, std::uint64_t v )
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( uint64_handler_event{v}, ec );
+        string_.append(sv);
+        BOOST_JSON_INVOKE_INNER(
+            (uint64_handler_event{v, std::move(string_)}), ec );
     }
 
-    bool on_double( error_code& ec, double v )
+    bool on_double( error_code& ec, double v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( double_handler_event{v}, ec );
+        string_.append(sv);
+        BOOST_JSON_INVOKE_INNER(
+            (double_handler_event{v, std::move(string_)}), ec );
     }
 
     bool on_bool( error_code& ec, bool v )
@@ -1618,24 +1990,24 @@ public:
         BOOST_JSON_INVOKE_INNER( on_string(ec, sv) );
     }
 
-    bool on_number_part( error_code& ec )
+    bool on_number_part( error_code& ec, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_number_part(ec) );
+        BOOST_JSON_INVOKE_INNER( on_number_part(ec, sv) );
     }
 
-    bool on_int64( error_code& ec, std::int64_t v )
+    bool on_int64( error_code& ec, std::int64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_int64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_int64(ec, v, sv) );
     }
 
-    bool on_uint64( error_code& ec, std::uint64_t v )
+    bool on_uint64( error_code& ec, std::uint64_t v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v, sv) );
     }
 
-    bool on_double( error_code& ec, double v )
+    bool on_double( error_code& ec, double v, string_view sv )
     {
-        BOOST_JSON_INVOKE_INNER( on_double(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_double(ec, v, sv) );
     }
 
     bool on_bool( error_code& ec, bool v )
@@ -1690,6 +2062,15 @@ public:
     {
     }
 
+    // forwarded to the top-level handler when it
+    // can use a size hint, otherwise a no-op
+    template<class H = inner_handler_type>
+    auto reserve_hint( std::size_t n )
+        -> decltype( std::declval<H&>().reserve_hint(n) )
+    {
+        inner_.reserve_hint( n );
+    }
+
     void signal_value()
     {
     }
@@ -1759,24 +2140,24 @@ public:
         BOOST_JSON_INVOKE_INNER( on_string(ec, sv) );
     }
 
-    bool on_number_part( string_view, error_code& ec )
+    bool on_number_part( string_view sv, error_code& ec )
     {
-        BOOST_JSON_INVOKE_INNER( on_number_part(ec) );
+        BOOST_JSON_INVOKE_INNER( on_number_part(ec, sv) );
     }
 
-    bool on_int64( std::int64_t v, string_view, error_code& ec )
+    bool on_int64( std::int64_t v, string_view sv, error_code& ec )
     {
-        BOOST_JSON_INVOKE_INNER( on_int64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_int64(ec, v, sv) );
     }
 
-    bool on_uint64( std::uint64_t v, string_view, error_code& ec )
+    bool on_uint64( std::uint64_t v, string_view sv, error_code& ec )
     {
-        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_uint64(ec, v, sv) );
     }
 
-    bool on_double( double v, string_view, error_code& ec )
+    bool on_double( double v, string_view sv, error_code& ec )
     {
-        BOOST_JSON_INVOKE_INNER( on_double(ec, v) );
+        BOOST_JSON_INVOKE_INNER( on_double(ec, v, sv) );
     }
 
     bool on_bool( bool v, error_code& ec )
@@ -1802,6 +2183,98 @@ public:
 #undef BOOST_JSON_INVOKE_INNER
 };
 
+// count the elements of a leading JSON array
+// without validating it, so the target container
+// can be reserved before parsing begins; returns
+// zero when the input does not start with an
+// array or appears empty. A wrong count only
+// affects the reservation, never correctness.
+inline
+std::size_t
+prescan_array_size( string_view sv ) noexcept
+{
+    char const* p = sv.data();
+    char const* const end = p + sv.size();
+    while( p != end && (
+        *p == ' ' || *p == '\t' ||
+        *p == '\n' || *p == '\r' ) )
+        ++p;
+    if( p == end || *p != '[' )
+        return 0;
+    ++p;
+    std::size_t depth = 1;
+    std::size_t count = 0;
+    bool any = false;
+    bool in_string = false;
+    for( ; p != end; ++p )
+    {
+        char const c = *p;
+        if( in_string )
+        {
+            if( c == '\\' )
+            {
+                if( ++p == end )
+                    break;
+            }
+            else if( c == '"' )
+                in_string = false;
+            continue;
+        }
+        switch( c )
+        {
+        case '"':
+            in_string = true;
+            any = true;
+            break;
+        case '[': case '{':
+            ++depth;
+            any = true;
+            break;
+        case ']': case '}':
+            if( --depth == 0 )
+                return any ? count + 1 : 0;
+            break;
+        case ',':
+            if( depth == 1 )
+                ++count;
+            break;
+        case ' ': case '\t':
+        case '\n': case '\r':
+            break;
+        default:
+            any = true;
+            break;
+        }
+    }
+    return any ? count + 1 : 0;
+}
+
+template<class H>
+auto
+apply_reserve_hint_impl( H& h, string_view sv, int )
+    -> decltype( h.reserve_hint(std::size_t(0)) )
+{
+    std::size_t const n =
+        detail::prescan_array_size( sv );
+    if( n != 0 )
+        h.reserve_hint( n );
+}
+
+template<class H>
+void
+apply_reserve_hint_impl( H&, string_view, long )
+{
+}
+
+// scan the input only when the handler can
+// actually use the resulting hint
+template<class H>
+void
+apply_reserve_hint( H& h, string_view sv )
+{
+    detail::apply_reserve_hint_impl( h, sv, 0 );
+}
+
 } // namespace detail
 } // namespace boost
 } // namespace json
@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_PREFETCH_HPP
+#define BOOST_JSON_DETAIL_PREFETCH_HPP
+
+#include <boost/json/detail/config.hpp>
+
+#if defined(_MSC_VER) && ! defined(__clang__) && \
+    (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+#endif
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// hint to bring the line holding p into
+// cache for reading; a no-op where the
+// compiler offers no such intrinsic
+inline
+void
+prefetch(void const* p) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(_MSC_VER) && \
+    (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(
+        static_cast<char const*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_RDTSC_HPP
+#define BOOST_JSON_DETAIL_RDTSC_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER) && \
+    (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+#elif !defined(__i386__) && \
+    !defined(__x86_64__) && \
+    !(defined(__aarch64__) && defined(__GNUC__))
+# include <chrono>
+#endif
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// the cheapest monotonic tick counter
+// available: the time stamp counter on x86,
+// the virtual counter on AArch64, and the
+// steady clock in nanoseconds elsewhere. The
+// tick unit varies by platform; callers may
+// only compare or accumulate differences.
+inline
+std::uint64_t
+rdtsc() noexcept
+{
+#if defined(_MSC_VER) && \
+    (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__i386__) || defined(__x86_64__)
+    std::uint32_t lo, hi;
+    __asm__ volatile(
+        "rdtsc" : "=a"(lo), "=d"(hi));
+    return lo | (std::uint64_t(hi) << 32);
+#elif defined(__aarch64__) && defined(__GNUC__)
+    std::uint64_t t;
+    __asm__ volatile(
+        "mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<
+            std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now()
+            .time_since_epoch()).count());
+#endif
+}
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
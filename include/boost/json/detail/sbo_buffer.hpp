@@ -175,6 +175,33 @@ public:
         return data_;
     }
 
+    struct mutable_region
+    {
+        void* data;
+        std::size_t size;
+    };
+
+    // sink interface, see serializer::read_into
+    mutable_region
+    prepare( std::size_t size )
+    {
+        if( capacity() - size_ < size )
+            grow( size );
+        return { data_ + size_, capacity() - size_ };
+    }
+
+    void
+    commit( std::size_t size ) noexcept
+    {
+        size_ += size;
+    }
+
+    char*
+    data() noexcept
+    {
+        return data_;
+    }
+
     std::size_t
     size() noexcept
     {
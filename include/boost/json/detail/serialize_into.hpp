@@ -0,0 +1,508 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_SERIALIZE_INTO_HPP
+#define BOOST_JSON_DETAIL_SERIALIZE_INTO_HPP
+
+#include <boost/json/conversion.hpp>
+#include <boost/json/serialize_options.hpp>
+#include <boost/json/serializer.hpp>
+#include <boost/json/value_from.hpp>
+#include <boost/json/detail/format.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <boost/describe/enum_to_string.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+/*  Emits JSON text into a sink exposing
+    prepare(n)/commit(n), without building an
+    intermediate value. See serializer::read_into
+    for the sink requirements.
+*/
+template<class Sink>
+class sink_writer
+{
+    Sink& sink_;
+    serialize_options opts_;
+    std::size_t depth_ = 0;
+
+public:
+    sink_writer(
+        Sink& sink,
+        serialize_options const& opts) noexcept
+        : sink_(sink)
+        , opts_(opts)
+    {
+    }
+
+    serialize_options const&
+    options() const noexcept
+    {
+        return opts_;
+    }
+
+    Sink&
+    sink() noexcept
+    {
+        return sink_;
+    }
+
+    void
+    write(char const* s, std::size_t n)
+    {
+        while(n > 0)
+        {
+            auto const b = sink_.prepare(n);
+            std::size_t m = b.size;
+            if(m > n)
+                m = n;
+            std::memcpy(b.data, s, m);
+            sink_.commit(m);
+            s += m;
+            n -= m;
+        }
+    }
+
+    void
+    write(char c)
+    {
+        write(&c, 1);
+    }
+
+    void
+    write_string(string_view sv)
+    {
+        static constexpr char hex[] =
+            "0123456789abcdef";
+        write('\x22'); // '"'
+        char const* p = sv.data();
+        std::size_t remain = sv.size();
+        while(remain > 0)
+        {
+            std::size_t const k =
+                count_unescaped(p, remain);
+            if(k > 0)
+            {
+                write(p, k);
+                p += k;
+                remain -= k;
+                if(remain == 0)
+                    break;
+            }
+            char const ch = *p;
+            ++p;
+            --remain;
+            if( ch != '\x22' && ch != '\\' &&
+                static_cast<unsigned char>(ch) >= 0x20 )
+            {
+                // count_unescaped() scans whole
+                // blocks and reports zero for a
+                // shorter run; the character is
+                // ordinary, copy it through
+                write(ch);
+                continue;
+            }
+            switch(ch)
+            {
+            case '\x22': write("\\\"", 2); break;
+            case '\\':   write("\\\\", 2); break;
+            case '\b':   write("\\b", 2); break;
+            case '\f':   write("\\f", 2); break;
+            case '\n':   write("\\n", 2); break;
+            case '\r':   write("\\r", 2); break;
+            case '\t':   write("\\t", 2); break;
+            default:
+            {
+                char const buf[6] = {
+                    '\\', 'u', '0', '0',
+                    hex[static_cast<
+                        unsigned char>(ch) >> 4],
+                    hex[static_cast<
+                        unsigned char>(ch) & 15] };
+                write(buf, 6);
+                break;
+            }
+            }
+        }
+        write('\x22'); // '"'
+    }
+
+    void
+    write_int64(std::int64_t v)
+    {
+        char buf[max_number_chars];
+        write(buf, format_int64(buf, v));
+    }
+
+    void
+    write_uint64(std::uint64_t v)
+    {
+        char buf[max_number_chars];
+        write(buf, format_uint64(buf, v));
+    }
+
+    void
+    write_double(double v)
+    {
+        char buf[max_number_chars];
+        write(buf, format_double(buf, v,
+            opts_.allow_infinity_and_nan));
+    }
+
+    // pretty-printing helpers; no-ops
+    // in the default compact mode
+    void
+    enter()
+    {
+        if(opts_.pretty)
+        {
+            ++depth_;
+            indent();
+        }
+    }
+
+    void
+    leave()
+    {
+        if(opts_.pretty)
+        {
+            --depth_;
+            indent();
+        }
+    }
+
+    void
+    comma()
+    {
+        write(',');
+        if(opts_.pretty)
+            indent();
+    }
+
+    void
+    colon()
+    {
+        write(':');
+        if(opts_.pretty)
+            write(' ');
+    }
+
+private:
+    void
+    indent()
+    {
+        static char const ws[] =
+            "                                "
+            "                                ";
+        write('\n');
+        std::size_t n = depth_ *
+            opts_.indent_size;
+        while(n > 0)
+        {
+            std::size_t m = n;
+            if(m > sizeof(ws) - 1)
+                m = sizeof(ws) - 1;
+            write(ws, m);
+            n -= m;
+        }
+    }
+};
+
+template< class Sink, class T >
+void
+serialize_into_impl( sink_writer<Sink>& w, T const& from );
+
+//----------------------------------------------------------
+// User-provided conversion
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    user_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    // no direct emitter; build a value using
+    // the user's tag_invoke overload
+    serialize_into_tagged(
+        native_conversion_tag(), w, value_from(from) );
+}
+
+//----------------------------------------------------------
+// Native conversion
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    native_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    serializer sr( w.options() );
+    sr.reset( &from );
+    sr.read_into( w.sink() );
+}
+
+template< class Sink >
+void
+serialize_into_tagged(
+    bool_conversion_tag, sink_writer<Sink>& w, bool from )
+{
+    if( from )
+        w.write("true", 4);
+    else
+        w.write("false", 5);
+}
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    integral_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    if( std::is_signed<T>::value )
+        w.write_int64( static_cast<std::int64_t>(from) );
+    else
+        w.write_uint64( static_cast<std::uint64_t>(from) );
+}
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    floating_point_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    w.write_double( static_cast<double>(from) );
+}
+
+// null-like types
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    null_like_conversion_tag, sink_writer<Sink>& w, T const& )
+{
+    w.write("null", 4);
+}
+
+// string-like types
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    string_like_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    w.write_string( static_cast<string_view>(from) );
+}
+
+// map-like types
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    map_like_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    using std::get;
+    w.write('{');
+    bool first = true;
+    for( auto const& elem : from )
+    {
+        if( first )
+        {
+            w.enter();
+            first = false;
+        }
+        else
+        {
+            w.comma();
+        }
+        w.write_string( get<0>(elem) );
+        w.colon();
+        serialize_into_impl( w, get<1>(elem) );
+    }
+    if( !first )
+        w.leave();
+    w.write('}');
+}
+
+// ranges
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    sequence_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    w.write('[');
+    bool first = true;
+    for( auto const& elem : from )
+    {
+        if( first )
+        {
+            w.enter();
+            first = false;
+        }
+        else
+        {
+            w.comma();
+        }
+        serialize_into_impl( w, elem );
+    }
+    if( !first )
+        w.leave();
+    w.write(']');
+}
+
+// tuple-like types
+template< class Sink, class T >
+struct serialize_tuple_element
+{
+    sink_writer<Sink>& w;
+    T const& from;
+
+    template<std::size_t I>
+    void
+    operator()(mp11::mp_size_t<I>) const
+    {
+        using std::get;
+        if( I != 0 )
+            w.comma();
+        serialize_into_impl( w, get<I>(from) );
+    }
+};
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    tuple_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    constexpr std::size_t n =
+        std::tuple_size<remove_cvref<T>>::value;
+    w.write('[');
+    if( n > 0 )
+        w.enter();
+    mp11::mp_for_each<mp11::mp_iota_c<n>>(
+        serialize_tuple_element< Sink, T >{ w, from });
+    if( n > 0 )
+        w.leave();
+    w.write(']');
+}
+
+// described classes
+template< class Sink, class T >
+struct serialize_described_member
+{
+    using Ds = describe::describe_members<
+        remove_cvref<T>, describe::mod_public | describe::mod_inherited>;
+
+    sink_writer<Sink>& w;
+    T const& from;
+
+    template< class I >
+    void
+    operator()(I) const
+    {
+        using D = mp11::mp_at<Ds, I>;
+        if( I::value != 0 )
+            w.comma();
+        w.write_string( D::name );
+        w.colon();
+        serialize_into_impl( w, from.* D::pointer );
+    }
+};
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    described_class_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    serialize_described_member<Sink, T> member_emitter{ w, from };
+
+    using Ds = typename decltype(member_emitter)::Ds;
+    constexpr std::size_t N = mp11::mp_size<Ds>::value;
+    w.write('{');
+    if( N > 0 )
+        w.enter();
+    mp11::mp_for_each< mp11::mp_iota_c<N> >(member_emitter);
+    if( N > 0 )
+        w.leave();
+    w.write('}');
+}
+
+// described enums
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    described_enum_conversion_tag, sink_writer<Sink>& w, T from )
+{
+#ifdef BOOST_DESCRIBE_CXX14
+    char const* const name = describe::enum_to_string(from, nullptr);
+    if( name )
+    {
+        w.write_string(name);
+        return;
+    }
+#endif
+    using Integer = typename std::underlying_type< remove_cvref<T> >::type;
+    serialize_into_tagged(
+        integral_conversion_tag(), w, static_cast<Integer>(from) );
+}
+
+// optionals
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    optional_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    if( from )
+        serialize_into_impl( w, *from );
+    else
+        w.write("null", 4);
+}
+
+// variants
+template< class Sink >
+struct serialize_into_visitor
+{
+    sink_writer<Sink>& w;
+
+    template<class T>
+    void
+    operator()(T const& t) const
+    {
+        serialize_into_impl( w, t );
+    }
+};
+
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    variant_conversion_tag, sink_writer<Sink>& w, T const& from )
+{
+    visit( serialize_into_visitor<Sink>{ w }, from );
+}
+
+// no suitable conversion implementation
+template< class Sink, class T >
+void
+serialize_into_tagged(
+    no_conversion_tag, sink_writer<Sink>&, T const& )
+{
+    static_assert(
+        !std::is_same<T, T>::value,
+        "No suitable tag_invoke overload found for the type");
+}
+
+template< class Sink, class T >
+void
+serialize_into_impl( sink_writer<Sink>& w, T const& from )
+{
+    using cat = conversion_category<
+        no_context, remove_cvref<T>, value_from_conversion >;
+    serialize_into_tagged( cat(), w, from );
+}
+
+} // namespace detail
+} // namespace json
+} // namespace boost
+
+#endif
@@ -34,6 +34,12 @@ struct BOOST_SYMBOL_VISIBLE
     ~shared_resource();
 
     std::atomic<std::size_t> refs{ 1 };
+
+    // when true, the count is adjusted with
+    // plain loads and stores; all owners must
+    // then be confined to a single thread.
+    // see make_shared_resource_unsync
+    bool unsync = false;
 };
 
 template<class T>
@@ -13,27 +13,195 @@
 #define BOOST_JSON_DETAIL_SSE2_HPP
 
 #include <boost/json/detail/config.hpp>
+#include <boost/json/detail/cpuid.hpp>
 #include <boost/json/detail/utf8.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #ifdef BOOST_JSON_USE_SSE2
 # include <emmintrin.h>
 # include <xmmintrin.h>
+# if defined(BOOST_JSON_USE_AVX2) || defined(BOOST_JSON_USE_AVX512) || \
+     defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+#  include <immintrin.h>
+# endif
 # ifdef _MSC_VER
 #  include <intrin.h>
 # endif
 #endif
 
+/*  When dispatching at run time the wide kernels
+    are compiled with a per-function target even
+    though the translation unit is built for the
+    baseline; otherwise the build already targets
+    the instruction set and no attribute is needed.
+*/
+#ifdef BOOST_JSON_USE_RUNTIME_DISPATCH
+# define BOOST_JSON_TARGET_AVX2 \
+    __attribute__((target("avx2")))
+# define BOOST_JSON_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512bw")))
+#else
+# define BOOST_JSON_TARGET_AVX2
+# define BOOST_JSON_TARGET_AVX512
+#endif
+
+#if defined(BOOST_JSON_USE_AVX2) || \
+    defined(BOOST_JSON_USE_AVX512) || \
+    defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+# define BOOST_JSON_HAS_AVX2_KERNELS
+#endif
+#if defined(BOOST_JSON_USE_AVX512) || \
+    defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+# define BOOST_JSON_HAS_AVX512_KERNELS
+#endif
+
+/*  The SWAR kernels process eight bytes per
+    iteration using only 64-bit integer
+    arithmetic. They are the portable fallback
+    tier for targets without vendor SIMD, and
+    also finish the short tails of the wider
+    kernels. They require little-endian byte
+    order so that the first input byte is the
+    least significant.
+*/
+#if !defined(BOOST_JSON_BIG_ENDIAN) && \
+    ( defined(__GNUC__) || defined(__clang__) || \
+      ( defined(_MSC_VER) && defined(_WIN64) ) )
+# define BOOST_JSON_HAS_SWAR_KERNELS
+#endif
+
 namespace boost {
 namespace json {
 namespace detail {
 
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+
+// index of the first byte of m with any bit
+// set; m must be nonzero
+inline
+std::size_t
+swar_index(std::uint64_t m) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(
+        __builtin_ctzll( m ) ) >> 3;
+#else
+    unsigned long index;
+    _BitScanForward64( &index, m );
+    return static_cast<std::size_t>(
+        index ) >> 3;
+#endif
+}
+
+// the high bit of each byte of the result is
+// set where the byte of v is a quote, a
+// backslash, or a control character below
+// 0x20; bytes with the high bit set are never
+// reported
+inline
+std::uint64_t
+swar_string_stop(std::uint64_t v) noexcept
+{
+    std::uint64_t const hi = v & 0x8080808080808080;
+    std::uint64_t const t  = v & 0x7F7F7F7F7F7F7F7F;
+
+    // adding 0x7F to a seven bit byte sets the
+    // high bit exactly when the byte is
+    // nonzero, so the complement marks equality;
+    // no addition here carries across bytes
+    std::uint64_t const eq1 =
+        ~( ( t ^ 0x2222222222222222 ) + 0x7F7F7F7F7F7F7F7F ); // '"'
+    std::uint64_t const eq2 =
+        ~( ( t ^ 0x5C5C5C5C5C5C5C5C ) + 0x7F7F7F7F7F7F7F7F ); // '\\'
+    // adding 0x60 leaves the high bit clear
+    // exactly when the byte is below 0x20
+    std::uint64_t const lt =
+        ~( t + 0x6060606060606060 );
+
+    return ( eq1 | eq2 | lt ) &
+        ~hi & 0x8080808080808080;
+}
+
+// convert eight ASCII decimal digits, given as
+// the little-endian bytes of v with the first
+// character in the lowest byte, to their value;
+// the caller must ensure every byte is a digit
+inline
+std::uint32_t
+swar_parse_digits(std::uint64_t v) noexcept
+{
+    v -= 0x3030303030303030;
+    // combine adjacent digits pairwise, then
+    // the pairs, then the quads, widening the
+    // lanes at every step
+    v = ( v * 10 ) + ( v >> 8 );
+    v = ( ( ( v & 0x000000FF000000FF ) *
+            0x000F424000000064 ) +
+        ( ( ( v >> 16 ) & 0x000000FF000000FF ) *
+            0x0000271000000001 ) ) >> 32;
+    return static_cast<std::uint32_t>( v );
+}
+
+// convert four ASCII hex digits, given as the
+// little-endian bytes of v with the first
+// character in the lowest byte, to their value,
+// or -1 if any byte is not a hex digit
+inline
+int
+swar_parse_hex4(std::uint32_t v) noexcept
+{
+    // folding to lowercase maps the digits onto
+    // themselves; xor has no carries, so after
+    // removing '0' the digit bytes are 0x00-0x09
+    // and the letter bytes 0x51-0x56
+    std::uint32_t const x =
+        ( v | 0x20202020 ) ^ 0x30303030;
+
+    std::uint32_t const t  = x & 0x7F7F7F7F;
+    std::uint32_t const hi = x & 0x80808080;
+    // adding 0x76 to a seven bit byte leaves the
+    // high bit clear exactly when the byte is
+    // below ten; no addition carries across bytes.
+    // folding also maps 0x10-0x19 onto the digits,
+    // so a digit must carry the 0x20 bit itself
+    std::uint32_t const is_digit =
+        ~( t + 0x76767676 ) & ~hi &
+        ( ( v << 2 ) & 0x80808080 );
+
+    // the letter bytes land in 0x01-0x06 after
+    // this xor, and nothing else lands there
+    std::uint32_t const z  = x ^ 0x50505050;
+    std::uint32_t const zt = z & 0x7F7F7F7F;
+    std::uint32_t const zh = z & 0x80808080;
+    std::uint32_t const is_letter =
+        ~( zt + 0x79797979 ) & ~zh &        // z < 7
+        ( ( zt + 0x7F7F7F7F ) | zh ) &      // z != 0
+        0x80808080;
+
+    if( ( is_digit | is_letter ) != 0x80808080 )
+        return -1;
+
+    // letters sit 0x47 above their value; the
+    // multiply spreads the byte masks without
+    // carries because each byte is zero or one
+    std::uint32_t const n =
+        x - ( ( is_letter >> 7 ) * 0x47 );
+    return static_cast<int>(
+        ( ( n & 0xFF ) << 12 ) |
+        ( ( ( n >> 8 ) & 0xFF ) << 8 ) |
+        ( ( ( n >> 16 ) & 0xFF ) << 4 ) |
+        ( ( n >> 24 ) & 0xFF ) );
+}
+
+#endif
+
 #ifdef BOOST_JSON_USE_SSE2
 
 template<bool AllowBadUTF8>
 inline
 const char*
-count_valid(
+count_valid_sse2(
     char const* p,
     const char* end) noexcept
 {
@@ -83,7 +251,7 @@ count_valid(
 template<>
 inline
 const char*
-count_valid<false>(
+count_valid_sse2<false>(
     char const* p,
     const char* end) noexcept
 {
@@ -144,6 +312,260 @@ count_valid<false>(
     return p;
 }
 
+#ifdef BOOST_JSON_HAS_AVX2_KERNELS
+
+BOOST_JSON_TARGET_AVX2
+inline
+const char*
+count_valid_avx2_lax(
+    char const* p,
+    const char* end) noexcept
+{
+    __m256i const q1 = _mm256_set1_epi8( '\x22' ); // '"'
+    __m256i const q2 = _mm256_set1_epi8( '\\' ); // '\\'
+    __m256i const q3 = _mm256_set1_epi8( 0x1F );
+
+    while(end - p >= 32)
+    {
+        __m256i v1 = _mm256_loadu_si256( (__m256i const*)p );
+        __m256i v2 = _mm256_cmpeq_epi8( v1, q1 ); // quote
+        __m256i v3 = _mm256_cmpeq_epi8( v1, q2 ); // backslash
+        __m256i v4 = _mm256_or_si256( v2, v3 ); // combine quotes and backslash
+        __m256i v5 = _mm256_min_epu8( v1, q3 );
+        __m256i v6 = _mm256_cmpeq_epi8( v5, v1 ); // controls
+        __m256i v7 = _mm256_or_si256( v4, v6 ); // combine with control
+
+        unsigned w = static_cast<unsigned>(
+            _mm256_movemask_epi8( v7 ) );
+
+        if( w != 0 )
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return p + __builtin_ctz( w );
+#else
+            unsigned long index;
+            _BitScanForward( &index, w );
+            return p + index;
+#endif
+        }
+
+        p += 32;
+    }
+
+    return count_valid_sse2<true>(p, end);
+}
+
+/*  Scan for string stop characters while
+    validating UTF-8 in-vector, using the nibble
+    lookup technique of Keiser and Lemire,
+    "Validating UTF-8 In Less Than One
+    Instruction Per Byte". Multi-byte sequences
+    never leave the vector loop; the scalar loop
+    only runs for the trailing bytes, or to
+    locate the exact position of a malformed
+    sequence once a block is known to contain
+    one.
+*/
+BOOST_JSON_TARGET_AVX2
+inline
+const char*
+count_valid_utf8_avx2(
+    char const* start,
+    const char* end) noexcept
+{
+    __m256i const q1 = _mm256_set1_epi8( '\x22' ); // '"'
+    __m256i const q2 = _mm256_set1_epi8( '\\' );
+    __m256i const q3 = _mm256_set1_epi8( 0x1F );
+
+    /*  Error bits, indexed by nibbles of the
+        first two bytes of each sequence:
+        TOO_SHORT 0x01, TOO_LONG 0x02,
+        OVERLONG_3 0x04, TOO_LARGE 0x08,
+        SURROGATE 0x10, OVERLONG_2 0x20,
+        TOO_LARGE_1000 / OVERLONG_4 0x40,
+        TWO_CONTS 0x80. A sequence is malformed
+        when the same bit appears in all three
+        lookups for some position.
+    */
+    // high nibble of byte 1
+    __m256i const tbl1 = _mm256_setr_epi8(
+        0x02, 0x02, 0x02, 0x02,
+        0x02, 0x02, 0x02, 0x02,
+        '\x80', '\x80', '\x80', '\x80',
+        0x21, 0x01, 0x15, 0x49,
+        0x02, 0x02, 0x02, 0x02,
+        0x02, 0x02, 0x02, 0x02,
+        '\x80', '\x80', '\x80', '\x80',
+        0x21, 0x01, 0x15, 0x49 );
+    // low nibble of byte 1
+    __m256i const tbl2 = _mm256_setr_epi8(
+        '\xE7', '\xA3', '\x83', '\x83',
+        '\x8B', '\xCB', '\xCB', '\xCB',
+        '\xCB', '\xCB', '\xCB', '\xCB',
+        '\xCB', '\xDB', '\xCB', '\xCB',
+        '\xE7', '\xA3', '\x83', '\x83',
+        '\x8B', '\xCB', '\xCB', '\xCB',
+        '\xCB', '\xCB', '\xCB', '\xCB',
+        '\xCB', '\xDB', '\xCB', '\xCB' );
+    // high nibble of byte 2
+    __m256i const tbl3 = _mm256_setr_epi8(
+        0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01,
+        '\xE6', '\xAE', '\xBA', '\xBA',
+        0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01,
+        '\xE6', '\xAE', '\xBA', '\xBA',
+        0x01, 0x01, 0x01, 0x01 );
+    // a block ending in a lead byte with its
+    // continuations missing is incomplete
+    __m256i const max_inc = _mm256_setr_epi8(
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xFF', '\xFF', '\xFF',
+        '\xFF', '\xEF', '\xDF', '\xBF' );
+    __m256i const nib = _mm256_set1_epi8( 0x0F );
+
+    char const* p = start;
+    __m256i prev = _mm256_setzero_si256();
+    bool prev_incomplete = false;
+
+    while(end - p >= 32)
+    {
+        __m256i v1 = _mm256_loadu_si256( (__m256i const*)p );
+
+        __m256i v2 = _mm256_cmpeq_epi8( v1, q1 ); // quote
+        __m256i v3 = _mm256_cmpeq_epi8( v1, q2 ); // backslash
+        __m256i v4 = _mm256_or_si256( v2, v3 );
+        __m256i v5 = _mm256_min_epu8( v1, q3 );
+        __m256i v6 = _mm256_cmpeq_epi8( v5, v1 ); // controls
+        __m256i v7 = _mm256_or_si256( v4, v6 );
+
+        unsigned const w = static_cast<unsigned>(
+            _mm256_movemask_epi8( v7 ) );
+
+        if( _mm256_movemask_epi8( v1 ) == 0 )
+        {
+            // all ascii
+            if( prev_incomplete )
+                break; // malformed; rescan below
+
+            if( w != 0 )
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return p + __builtin_ctz( w );
+#else
+                unsigned long index;
+                _BitScanForward( &index, w );
+                return p + index;
+#endif
+            }
+
+            prev = v1;
+            p += 32;
+            continue;
+        }
+
+        // lanes shifted back by 1..3 bytes,
+        // carrying in the previous block
+        __m256i sh = _mm256_permute2x128_si256(
+            prev, v1, 0x21 );
+        __m256i p1 = _mm256_alignr_epi8( v1, sh, 15 );
+        __m256i p2 = _mm256_alignr_epi8( v1, sh, 14 );
+        __m256i p3 = _mm256_alignr_epi8( v1, sh, 13 );
+
+        __m256i n1hi = _mm256_and_si256(
+            _mm256_srli_epi16( p1, 4 ), nib );
+        __m256i n1lo = _mm256_and_si256( p1, nib );
+        __m256i n2hi = _mm256_and_si256(
+            _mm256_srli_epi16( v1, 4 ), nib );
+
+        __m256i sc = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8( tbl1, n1hi ),
+                _mm256_shuffle_epi8( tbl2, n1lo ) ),
+            _mm256_shuffle_epi8( tbl3, n2hi ) );
+
+        // positions which must be the third or
+        // fourth byte of a sequence
+        __m256i m3 = _mm256_subs_epu8(
+            p2, _mm256_set1_epi8( 0x60 ) ); // prev2 >= 0xE0
+        __m256i m4 = _mm256_subs_epu8(
+            p3, _mm256_set1_epi8( 0x70 ) ); // prev3 >= 0xF0
+        __m256i must = _mm256_and_si256(
+            _mm256_or_si256( m3, m4 ),
+            _mm256_set1_epi8( '\x80' ) );
+
+        __m256i err = _mm256_xor_si256( must, sc );
+
+        if( ! _mm256_testz_si256( err, err ) )
+            break; // malformed; rescan below
+
+        if( w != 0 )
+        {
+            // stop character; everything
+            // before it is valid
+#if defined(__GNUC__) || defined(__clang__)
+            return p + __builtin_ctz( w );
+#else
+            unsigned long index;
+            _BitScanForward( &index, w );
+            return p + index;
+#endif
+        }
+
+        __m256i inc = _mm256_subs_epu8( v1, max_inc );
+        prev_incomplete =
+            ! _mm256_testz_si256( inc, inc );
+        prev = v1;
+        p += 32;
+    }
+
+    // back up to the start of any sequence which
+    // straddles the last fully validated block,
+    // then let the scalar loop finish
+    for(int i = 0; i < 3 && p != start; ++i)
+    {
+        unsigned char const c = p[-1];
+        if( c < 0x80 || c >= 0xC0 )
+            break;
+        --p; // continuation byte
+    }
+    if( p != start &&
+        static_cast<unsigned char>( p[-1] ) >= 0xC0 )
+        --p; // lead byte
+
+    return count_valid_sse2<false>( p, end );
+}
+
+#endif
+
+template<bool AllowBadUTF8>
+inline
+const char*
+count_valid(
+    char const* p,
+    const char* end) noexcept
+{
+#if defined(BOOST_JSON_USE_AVX2) || defined(BOOST_JSON_USE_AVX512)
+    return AllowBadUTF8 ?
+        count_valid_avx2_lax(p, end) :
+        count_valid_utf8_avx2(p, end);
+#elif defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+    if( cpu().avx2 )
+        return AllowBadUTF8 ?
+            count_valid_avx2_lax(p, end) :
+            count_valid_utf8_avx2(p, end);
+    return count_valid_sse2<AllowBadUTF8>(p, end);
+#else
+    return count_valid_sse2<AllowBadUTF8>(p, end);
+#endif
+}
+
 #else
 
 template<bool AllowBadUTF8>
@@ -152,6 +574,19 @@ count_valid(
     char const* p,
     char const* end) noexcept
 {
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    while( end - p >= 8 )
+    {
+        std::uint64_t v;
+        std::memcpy( &v, p, 8 );
+        std::uint64_t const m =
+            swar_string_stop( v );
+        if( m != 0 )
+            return p + swar_index( m );
+        p += 8;
+    }
+#endif
+
     while(p != end)
     {
         const unsigned char c = *p;
@@ -170,11 +605,35 @@ count_valid<false>(
     char const* p,
     char const* end) noexcept
 {
-    while(p != end)
+    for(;;)
     {
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+        // clean ascii is skipped eight bytes
+        // at a time; a stop character or a
+        // non-ascii byte falls through to the
+        // validating loop, which comes back
+        // here once the sequence is consumed
+        while( end - p >= 8 )
+        {
+            std::uint64_t v;
+            std::memcpy( &v, p, 8 );
+            std::uint64_t const m =
+                swar_string_stop( v ) |
+                ( v & 0x8080808080808080 );
+            if( m != 0 )
+            {
+                p += swar_index( m );
+                break;
+            }
+            p += 8;
+        }
+#endif
+
+        if(p == end)
+            return p;
         const unsigned char c = *p;
         if(c == '\x22' || c == '\\' || c < 0x20)
-            break;
+            return p;
         if(c < 0x80)
         {
             ++p;
@@ -184,13 +643,11 @@ count_valid<false>(
         uint16_t first = classify_utf8(c);
         uint8_t len = first & 0xFF;
         if(BOOST_JSON_UNLIKELY(end - p < len))
-            break;
+            return p;
         if(BOOST_JSON_UNLIKELY(! is_valid_utf8(p, first)))
-            break;
+            return p;
         p += len;
     }
-
-    return p;
 }
 
 #endif
@@ -202,7 +659,7 @@ count_valid<false>(
 
 inline
 size_t
-count_unescaped(
+count_unescaped_sse2(
     char const* s,
     size_t n) noexcept
 {
@@ -247,15 +704,154 @@ count_unescaped(
     return s - s0;
 }
 
+#ifdef BOOST_JSON_HAS_AVX2_KERNELS
+
+BOOST_JSON_TARGET_AVX2
+inline
+size_t
+count_unescaped_avx2(
+    char const* s,
+    size_t n) noexcept
+{
+    char const * s0 = s;
+
+    while( n >= 32 )
+    {
+        __m256i v1 = _mm256_loadu_si256( (__m256i const*)s );
+        __m256i v2 = _mm256_cmpeq_epi8(
+            v1, _mm256_set1_epi8( '\x22' ) ); // quote
+        __m256i v3 = _mm256_cmpeq_epi8(
+            v1, _mm256_set1_epi8( '\\' ) ); // backslash
+        __m256i v4 = _mm256_or_si256( v2, v3 );
+        __m256i v5 = _mm256_min_epu8(
+            v1, _mm256_set1_epi8( 0x1F ) );
+        __m256i v6 = _mm256_cmpeq_epi8( v5, v1 ); // controls
+        __m256i v7 = _mm256_or_si256( v4, v6 );
+
+        unsigned w = static_cast<unsigned>(
+            _mm256_movemask_epi8( v7 ) );
+
+        if( w != 0 )
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            s += __builtin_ctz( w );
+#else
+            unsigned long index;
+            _BitScanForward( &index, w );
+            s += index;
+#endif
+            return s - s0;
+        }
+
+        s += 32;
+        n -= 32;
+    }
+
+    return ( s - s0 ) + count_unescaped_sse2( s, n );
+}
+
+#endif
+
+#ifdef BOOST_JSON_HAS_AVX512_KERNELS
+
+BOOST_JSON_TARGET_AVX512
+inline
+size_t
+count_unescaped_avx512(
+    char const* s,
+    size_t n) noexcept
+{
+    char const * s0 = s;
+
+    while( n >= 64 )
+    {
+        __m512i v1 = _mm512_loadu_si512( (void const*)s );
+
+        __mmask64 m1 = _mm512_cmpeq_epi8_mask(
+            v1, _mm512_set1_epi8( '\x22' ) ); // quote
+        __mmask64 m2 = _mm512_cmpeq_epi8_mask(
+            v1, _mm512_set1_epi8( '\\' ) ); // backslash
+        __mmask64 m3 = _mm512_cmple_epu8_mask(
+            v1, _mm512_set1_epi8( 0x1F ) ); // controls
+
+        __mmask64 w = m1 | m2 | m3;
+
+        if( w != 0 )
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            s += __builtin_ctzll( w );
+#else
+            unsigned long index;
+            _BitScanForward64( &index, w );
+            s += index;
+#endif
+            return s - s0;
+        }
+
+        s += 64;
+        n -= 64;
+    }
+
+    return ( s - s0 ) + count_unescaped_avx2( s, n );
+}
+
+#endif
+
+inline
+size_t
+count_unescaped(
+    char const* s,
+    size_t n) noexcept
+{
+#if defined(BOOST_JSON_USE_AVX512)
+    return count_unescaped_avx512( s, n );
+#elif defined(BOOST_JSON_USE_AVX2)
+    return count_unescaped_avx2( s, n );
+#elif defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+    using fn_type = size_t (*)(
+        char const*, size_t );
+    static fn_type const fn =
+        cpu().avx512bw ? &count_unescaped_avx512 :
+        cpu().avx2 ? &count_unescaped_avx2 :
+        &count_unescaped_sse2;
+    return fn( s, n );
+#else
+    return count_unescaped_sse2( s, n );
+#endif
+}
+
 #else
 
 inline
 std::size_t
 count_unescaped(
-    char const*,
-    std::size_t) noexcept
+    char const* s,
+    std::size_t n) noexcept
 {
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    char const* const s0 = s;
+
+    while( n >= 8 )
+    {
+        std::uint64_t v;
+        std::memcpy( &v, s, 8 );
+        std::uint64_t const m =
+            swar_string_stop( v );
+        if( m != 0 )
+        {
+            s += swar_index( m );
+            break;
+        }
+        s += 8;
+        n -= 8;
+    }
+
+    return static_cast<std::size_t>( s - s0 );
+#else
+    (void)s;
+    (void)n;
     return 0;
+#endif
 }
 
 #endif
@@ -298,6 +894,33 @@ inline int count_digits( char const* p ) noexcept
 // assumes p..p+15 are valid
 inline int count_digits( char const* p ) noexcept
 {
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    int n = 0;
+
+    for( int i = 0; i < 2; ++i )
+    {
+        std::uint64_t v;
+        std::memcpy( &v, p + n, 8 );
+        std::uint64_t const t =
+            v ^ 0x3030303030303030;
+        // a byte is a digit when xor with '0'
+        // cleared its high nibble and its low
+        // nibble does not carry past nine;
+        // the nibbles are tested separately
+        // so nothing carries across bytes
+        std::uint64_t const bad =
+            ( t & 0xF0F0F0F0F0F0F0F0 ) |
+            ( ( ( t & 0x0F0F0F0F0F0F0F0F ) +
+                0x0606060606060606 ) &
+                0x1010101010101010 );
+        if( bad != 0 )
+            return n + static_cast<int>(
+                swar_index( bad ) );
+        n += 8;
+    }
+
+    return n;
+#else
     int n = 0;
 
     for( ; n < 16; ++n )
@@ -307,6 +930,7 @@ inline int count_digits( char const* p ) noexcept
     }
 
     return n;
+#endif
 }
 
 #endif
@@ -315,6 +939,29 @@ inline int count_digits( char const* p ) noexcept
 
 inline uint64_t parse_unsigned( uint64_t r, char const * p, std::size_t n ) noexcept
 {
+#ifndef BOOST_JSON_BIG_ENDIAN
+    while( n >= 8 )
+    {
+        uint64_t v;
+        std::memcpy( &v, p, 8 );
+
+        v -= 0x3030303030303030;
+
+        // fold digit bytes into pairs, quads,
+        // then a single 8 digit value
+        v = ( v * ( 10 * 256 + 1 ) ) >> 8;
+        v = ( ( v & 0x00FF00FF00FF00FF ) *
+            ( 100 * 65536 + 1 ) ) >> 16;
+        v = ( ( v & 0x0000FFFF0000FFFF ) *
+            ( ( 10000ULL << 32 ) + 1 ) ) >> 32;
+
+        r = r * 100000000 + v;
+
+        p += 8;
+        n -= 8;
+    }
+#endif
+
     while( n >= 4 )
     {
         // faster on on clang for x86,
@@ -365,6 +1012,125 @@ inline uint64_t parse_unsigned( uint64_t r, char const * p, std::size_t n ) noex
     return r;
 }
 
+// parse_digits
+
+#ifdef BOOST_JSON_USE_SSE2
+
+/*  Fused form of count_digits and parse_unsigned:
+    the sixteen bytes at p are classified and the
+    leading run of digits is folded into r from
+    the same load, so the hot integer path reads
+    each byte once instead of scanning and then
+    converting. A full block is converted with
+    widening multiply-accumulates: bytes to digit
+    pairs, pairs to quads, quads to eight-digit
+    halves. Returns the digit count; assumes
+    p..p+15 are valid.
+*/
+inline int parse_digits( std::uint64_t& r, char const* p ) noexcept
+{
+    __m128i v1 = _mm_loadu_si128( (__m128i const*)p );
+    __m128i v2 = _mm_add_epi8(v1, _mm_set1_epi8(70));
+    v2 = _mm_cmplt_epi8(v2, _mm_set1_epi8(118));
+
+    int m = _mm_movemask_epi8(v2);
+
+    if( m == 0 )
+    {
+        __m128i const z = _mm_setzero_si128();
+        __m128i t = _mm_sub_epi8(
+            v1, _mm_set1_epi8( '0' ) );
+        __m128i lo = _mm_unpacklo_epi8( t, z );
+        __m128i hi = _mm_unpackhi_epi8( t, z );
+        // each madd folds adjacent lanes; the
+        // products stay well inside the signed
+        // lane limits at every step
+        __m128i const m10 =
+            _mm_set1_epi32( 0x0001000A );
+        lo = _mm_madd_epi16( lo, m10 );
+        hi = _mm_madd_epi16( hi, m10 );
+        __m128i q = _mm_packs_epi32( lo, hi );
+        q = _mm_madd_epi16(
+            q, _mm_set1_epi32( 0x00010064 ) );
+        q = _mm_packs_epi32( q, q );
+        q = _mm_madd_epi16(
+            q, _mm_set1_epi32( 0x00012710 ) );
+        std::uint64_t const h =
+            static_cast<std::uint32_t>(
+                _mm_cvtsi128_si32( q ) );
+        std::uint64_t const l =
+            static_cast<std::uint32_t>(
+                _mm_cvtsi128_si32(
+                    _mm_srli_si128( q, 4 ) ) );
+        r = r * 10000000000000000ULL +
+            ( h * 100000000 + l );
+        return 16;
+    }
+
+    int n;
+#if defined(__GNUC__) || defined(__clang__)
+    n = __builtin_ffs( m ) - 1;
+#else
+    unsigned long index;
+    _BitScanForward( &index, m );
+    n = static_cast<int>(index);
+#endif
+    r = parse_unsigned( r, p, n );
+    return n;
+}
+
+#else
+
+// fused form of count_digits and parse_unsigned;
+// returns the digit count and folds the digits
+// into r from the same loads. Assumes p..p+15
+// are valid.
+inline int parse_digits( std::uint64_t& r, char const* p ) noexcept
+{
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    int n = 0;
+
+    for( int i = 0; i < 2; ++i )
+    {
+        std::uint64_t v;
+        std::memcpy( &v, p + n, 8 );
+        std::uint64_t const t =
+            v ^ 0x3030303030303030;
+        // same classification as count_digits
+        std::uint64_t const bad =
+            ( t & 0xF0F0F0F0F0F0F0F0 ) |
+            ( ( ( t & 0x0F0F0F0F0F0F0F0F ) +
+                0x0606060606060606 ) &
+                0x1010101010101010 );
+        if( bad != 0 )
+        {
+            int const k = static_cast<int>(
+                swar_index( bad ) );
+            r = parse_unsigned( r, p + n, k );
+            return n + k;
+        }
+        r = r * 100000000 +
+            swar_parse_digits( v );
+        n += 8;
+    }
+
+    return n;
+#else
+    int n = 0;
+
+    for( ; n < 16; ++n )
+    {
+        unsigned char const d = *p++ - '0';
+        if(d > 9) break;
+        r = r * 10 + d;
+    }
+
+    return n;
+#endif
+}
+
+#endif
+
 // KRYSTIAN: this function is unused
 // count_leading
 
@@ -419,20 +1185,54 @@ inline std::size_t count_leading( char const * p, char ch ) noexcept
 
 // count_whitespace
 
-#ifdef BOOST_JSON_USE_SSE2
-
-inline const char* count_whitespace( char const* p, const char* end ) noexcept
+// classifies eight bytes at a time against the
+// four JSON whitespace characters without SIMD;
+// used for buffer tails and on targets without
+// SSE2
+inline const char* count_whitespace_swar( char const* p, char const* end ) noexcept
 {
-    if( p == end )
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    while( end - p >= 8 )
     {
-        return p;
+        uint64_t v;
+        std::memcpy( &v, p, 8 );
+
+        uint64_t const hi = v & 0x8080808080808080;
+        uint64_t const t  = v & 0x7F7F7F7F7F7F7F7F;
+
+        // the high bit of each byte of m is set
+        // where the byte differs from all four
+        // characters; adding 0x7F to a 7 bit
+        // value cannot carry across bytes
+        uint64_t m =
+            ( ( t ^ 0x2020202020202020 ) + 0x7F7F7F7F7F7F7F7F ) & // ' '
+            ( ( t ^ 0x0A0A0A0A0A0A0A0A ) + 0x7F7F7F7F7F7F7F7F ) & // '\n'
+            ( ( t ^ 0x0909090909090909 ) + 0x7F7F7F7F7F7F7F7F ) & // '\t'
+            ( ( t ^ 0x0D0D0D0D0D0D0D0D ) + 0x7F7F7F7F7F7F7F7F );  // '\r'
+        m = ( m & 0x8080808080808080 ) | hi;
+
+        if( m != 0 )
+            return p + swar_index( m );
+
+        p += 8;
     }
+#endif
 
-    if( static_cast<unsigned char>( *p ) > 0x20 )
+    while( p != end )
     {
-        return p;
+        char const c = *p;
+        if( c != ' ' && c != '\n' && c != '\r' && c != '\t' )
+            break;
+        ++p;
     }
 
+    return p;
+}
+
+#ifdef BOOST_JSON_USE_SSE2
+
+inline const char* count_whitespace_sse2( char const* p, const char* end ) noexcept
+{
     __m128i const q1 = _mm_set1_epi8( ' ' );
     __m128i const q2 = _mm_set1_epi8( '\n' );
     __m128i const q3 = _mm_set1_epi8( 4 ); // '\t' | 4 == '\r'
@@ -468,17 +1268,73 @@ inline const char* count_whitespace( char const* p, const char* end ) noexcept
         p += 16;
     }
 
-    while( p != end )
+    return count_whitespace_swar( p, end );
+}
+
+#ifdef BOOST_JSON_HAS_AVX2_KERNELS
+
+BOOST_JSON_TARGET_AVX2
+inline const char* count_whitespace_avx2( char const* p, const char* end ) noexcept
+{
+    __m256i const q1 = _mm256_set1_epi8( ' ' );
+    __m256i const q2 = _mm256_set1_epi8( '\n' );
+    __m256i const q3 = _mm256_set1_epi8( 4 ); // '\t' | 4 == '\r'
+    __m256i const q4 = _mm256_set1_epi8( '\r' );
+
+    while( end - p >= 32 )
     {
-        if( *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' )
+        __m256i v0 = _mm256_loadu_si256( (__m256i const*)p );
+
+        __m256i w0 = _mm256_or_si256(
+            _mm256_cmpeq_epi8( v0, q1 ),
+            _mm256_cmpeq_epi8( v0, q2 ));
+        __m256i v1 = _mm256_or_si256( v0, q3 );
+        __m256i w1 = _mm256_cmpeq_epi8( v1, q4 );
+        __m256i w2 = _mm256_or_si256( w0, w1 );
+
+        unsigned m = ~static_cast<unsigned>(
+            _mm256_movemask_epi8( w2 ) );
+
+        if( m != 0 )
         {
-            return p;
+#if defined(__GNUC__) || defined(__clang__)
+            return p + __builtin_ctz( m );
+#else
+            unsigned long index;
+            _BitScanForward( &index, m );
+            return p + index;
+#endif
         }
 
-        ++p;
+        p += 32;
     }
 
-    return p;
+    return count_whitespace_sse2( p, end );
+}
+
+#endif
+
+inline const char* count_whitespace( char const* p, const char* end ) noexcept
+{
+    if( p == end )
+    {
+        return p;
+    }
+
+    if( static_cast<unsigned char>( *p ) > 0x20 )
+    {
+        return p;
+    }
+
+#if defined(BOOST_JSON_USE_AVX2) || defined(BOOST_JSON_USE_AVX512)
+    return count_whitespace_avx2( p, end );
+#elif defined(BOOST_JSON_USE_RUNTIME_DISPATCH)
+    if( cpu().avx2 )
+        return count_whitespace_avx2( p, end );
+    return count_whitespace_sse2( p, end );
+#else
+    return count_whitespace_sse2( p, end );
+#endif
 }
 
 /*
@@ -530,14 +1386,17 @@ inline std::size_t count_whitespace( char const * p, std::size_t n ) noexcept
 
 inline const char* count_whitespace( char const* p, const char* end ) noexcept
 {
+    if( p == end )
+    {
+        return p;
+    }
 
-    for(; p != end; ++p)
+    if( static_cast<unsigned char>( *p ) > 0x20 )
     {
-        char const c = *p;
-        if( c != ' ' && c != '\n' && c != '\r' && c != '\t' ) break;
+        return p;
     }
 
-    return p;
+    return count_whitespace_swar( p, end );
 }
 
 #endif
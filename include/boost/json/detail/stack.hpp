@@ -25,6 +25,7 @@ class stack
     std::size_t size_ = 0;
     unsigned char* base_ = nullptr;
     unsigned char* buf_ = nullptr;
+    std::size_t buf_cap_ = 0;
 
 public:
     BOOST_JSON_DECL
@@ -53,6 +54,10 @@ public:
     void
     reserve(std::size_t n);
 
+    BOOST_JSON_DECL
+    void
+    shrink_to_fit() noexcept;
+
     template<class T>
     void
     push(T const& t)
@@ -16,6 +16,8 @@
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/detail/value.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 
 namespace boost {
@@ -26,6 +28,57 @@ class string;
 
 namespace detail {
 
+// the longest run copy_small accepts
+constexpr std::size_t copy_small_max = 32;
+
+// Copy a short run of characters with a pair
+// of overlapping fixed-size moves, which the
+// compiler lowers to two register or vector
+// load/store pairs. This avoids the call and
+// length dispatch of memcpy for the small
+// string sizes which dominate parsing.
+inline
+void
+copy_small(
+    char* dest,
+    char const* src,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n <= copy_small_max);
+    if(n > 16)
+    {
+        char a[16];
+        char b[16];
+        std::memcpy(a, src, 16);
+        std::memcpy(b, src + n - 16, 16);
+        std::memcpy(dest, a, 16);
+        std::memcpy(dest + n - 16, b, 16);
+    }
+    else if(n >= 8)
+    {
+        std::uint64_t a;
+        std::uint64_t b;
+        std::memcpy(&a, src, 8);
+        std::memcpy(&b, src + n - 8, 8);
+        std::memcpy(dest, &a, 8);
+        std::memcpy(dest + n - 8, &b, 8);
+    }
+    else if(n >= 4)
+    {
+        std::uint32_t a;
+        std::uint32_t b;
+        std::memcpy(&a, src, 4);
+        std::memcpy(&b, src + n - 4, 4);
+        std::memcpy(dest, &a, 4);
+        std::memcpy(dest + n - 4, &b, 4);
+    }
+    else
+    {
+        while(n--)
+            *dest++ = *src++;
+    }
+}
+
 class string_impl
 {
     struct table
@@ -107,6 +160,24 @@ public:
             min::value : BOOST_JSON_MAX_STRING_SIZE;
     }
 
+    static
+    constexpr
+    std::size_t
+    sbo_chars() noexcept
+    {
+        return sbo_chars_;
+    }
+
+    // a long string's allocation is
+    // table_size() + capacity + 1
+    static
+    constexpr
+    std::size_t
+    table_size() noexcept
+    {
+        return sizeof(table);
+    }
+
     BOOST_JSON_DECL
     string_impl() noexcept;
 
@@ -128,6 +199,13 @@ public:
         string_view s2,
         storage_ptr const& sp);
 
+    // adopt an existing key allocation, unchecked
+    BOOST_JSON_DECL
+    string_impl(
+        key_t,
+        char* s,
+        std::size_t n) noexcept;
+
     BOOST_JSON_DECL
     string_impl(
         char** dest,
@@ -185,13 +263,113 @@ public:
         u.s = nullptr;
     }
 
+    /*  The "unescaped" bit records that the
+        characters need no escaping when
+        serialized; the parser sets it on strings
+        it produced without processing an escape.
+        It lives in the top bit of the size field
+        (sizes are below 2^30) and in a spare bit
+        of the short-string count byte, so every
+        mutation which rewrites the size clears
+        it implicitly. Direct writes through
+        data() do not come through here; the
+        accessors of json::string clear the bit
+        before handing out mutable characters.
+
+        The "raw number" bit marks a string whose
+        characters are the pre-formatted text of
+        a JSON number; the serializer emits such
+        strings verbatim, with no quotes. It is
+        stored alongside the unescaped bit and
+        cleared by the same size rewrites, so a
+        mutated string always falls back to
+        quoted output.
+    */
+    static constexpr std::uint32_t
+        table_unescaped_ = 0x80000000u;
+    static constexpr char
+        sbo_unescaped_ = 0x40;
+    static constexpr std::uint32_t
+        table_raw_number_ = 0x40000000u;
+    static constexpr char
+        sbo_raw_number_ = 0x20;
+
+    bool
+    unescaped() const noexcept
+    {
+        if(s_.k == short_string_)
+            return (s_.buf[sbo_chars_] &
+                sbo_unescaped_) != 0;
+        if(s_.k == kind::string)
+            return (p_.t->size &
+                table_unescaped_) != 0;
+        return false;
+    }
+
+    void
+    unescaped(bool v) noexcept
+    {
+        if(s_.k == short_string_)
+        {
+            if(v)
+                s_.buf[sbo_chars_] |=
+                    sbo_unescaped_;
+            else
+                s_.buf[sbo_chars_] &=
+                    ~sbo_unescaped_;
+        }
+        else if(s_.k == kind::string)
+        {
+            if(v)
+                p_.t->size |= table_unescaped_;
+            else
+                p_.t->size &= ~table_unescaped_;
+        }
+    }
+
+    bool
+    raw_number() const noexcept
+    {
+        if(s_.k == short_string_)
+            return (s_.buf[sbo_chars_] &
+                sbo_raw_number_) != 0;
+        if(s_.k == kind::string)
+            return (p_.t->size &
+                table_raw_number_) != 0;
+        return false;
+    }
+
+    void
+    raw_number(bool v) noexcept
+    {
+        if(s_.k == short_string_)
+        {
+            if(v)
+                s_.buf[sbo_chars_] |=
+                    sbo_raw_number_;
+            else
+                s_.buf[sbo_chars_] &=
+                    ~sbo_raw_number_;
+        }
+        else if(s_.k == kind::string)
+        {
+            if(v)
+                p_.t->size |= table_raw_number_;
+            else
+                p_.t->size &= ~table_raw_number_;
+        }
+    }
+
     std::size_t
     size() const noexcept
     {
         return s_.k == kind::string ?
-            p_.t->size :
+            p_.t->size & ~(table_unescaped_ |
+                table_raw_number_) :
             sbo_chars_ -
-                s_.buf[sbo_chars_];
+                (s_.buf[sbo_chars_] &
+                    ~(sbo_unescaped_ |
+                        sbo_raw_number_));
     }
 
     std::size_t
@@ -221,6 +399,16 @@ public:
         std::size_t new_size,
         std::size_t capacity);
 
+    char const*
+    key_data(
+        std::size_t& n) const noexcept
+    {
+        BOOST_ASSERT(
+            k_.k == key_string_);
+        n = k_.n;
+        return k_.s;
+    }
+
     char const*
     release_key(
         std::size_t& n) noexcept
@@ -234,10 +422,31 @@ public:
         return s;
     }
 
+    /*  Every kind of string_impl owns its character
+        storage; destroy() releases it through the
+        value's memory_resource, and json::string
+        mutates the buffer in place. This is why a
+        "borrowed" kind whose data pointer references
+        the caller's input buffer is not provided:
+        it would deallocate foreign memory here, or
+        require copy-on-write in every mutator of
+        string. Callers who want cheap strings should
+        parse into a monotonic_resource, or use the
+        basic_parser interface, which already passes
+        unescaped fragments as views into the input.
+    */
     void
     destroy(
         storage_ptr const& sp) noexcept
     {
+        // a resource whose deallocate is a
+        // no-op, such as monotonic_resource,
+        // reclaims nothing here; skipping the
+        // virtual call makes teardown of
+        // string-heavy trees cheaper even
+        // when ownership is shared.
+        if(sp.is_deallocate_trivial())
+            return;
         if(s_.k == kind::string)
         {
             sp->deallocate(p_.t,
@@ -253,10 +462,6 @@ public:
         {
             BOOST_ASSERT(
                 s_.k == key_string_);
-            // VFALCO unfortunately the key string
-            // kind increases the cost of the destructor.
-            // This function should be skipped when using
-            // monotonic_resource.
             sp->deallocate(k_.s, k_.n + 1);
         }
     }
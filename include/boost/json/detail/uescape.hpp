@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DETAIL_UESCAPE_HPP
+#define BOOST_JSON_DETAIL_UESCAPE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <boost/json/detail/utf8.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// append a valid 32-bit code point as utf8
+inline
+char*
+append_utf8(
+    char* dest,
+    unsigned cp) noexcept
+{
+    if(cp < 0x80)
+    {
+        dest[0] = static_cast<char>(cp);
+        return dest + 1;
+    }
+    if(cp < 0x800)
+    {
+        dest[0] = static_cast<char>( (cp >> 6)          | 0xc0);
+        dest[1] = static_cast<char>( (cp & 0x3f)        | 0x80);
+        return dest + 2;
+    }
+    if(cp < 0x10000)
+    {
+        dest[0] = static_cast<char>( (cp >> 12)         | 0xe0);
+        dest[1] = static_cast<char>(((cp >> 6) & 0x3f)  | 0x80);
+        dest[2] = static_cast<char>( (cp       & 0x3f)  | 0x80);
+        return dest + 3;
+    }
+    dest[0] = static_cast<char>( (cp >> 18)         | 0xf0);
+    dest[1] = static_cast<char>(((cp >> 12) & 0x3f) | 0x80);
+    dest[2] = static_cast<char>(((cp >> 6)  & 0x3f) | 0x80);
+    dest[3] = static_cast<char>( (cp        & 0x3f) | 0x80);
+    return dest + 4;
+}
+
+// decode four hex digits, or -1
+inline
+int
+parse_hex4(char const* p) noexcept
+{
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+    return swar_parse_hex4(
+        load_little_endian<4>(p));
+#else
+    int v = 0;
+    for(int i = 0; i < 4; ++i)
+    {
+        unsigned char const c =
+            static_cast<unsigned char>(p[i]);
+        if(c >= '0' && c <= '9')
+            v = (v << 4) + (c - '0');
+        else if((c | 0x20) >= 'a' &&
+                (c | 0x20) <= 'f')
+            v = (v << 4) + ((c | 0x20) - 'a' + 10);
+        else
+            return -1;
+    }
+    return v;
+#endif
+}
+
+/*  Decode a run of consecutive, whole \uXXXX
+    escapes starting at p, writing the utf8
+    encoding of each code point to dest and
+    fusing surrogate pairs that span adjacent
+    escapes. The run ends at the first input
+    that is not a complete, valid escape: a
+    truncated or malformed escape and a lone
+    or mismatched surrogate are left entirely
+    unconsumed so the caller's scalar decoder
+    can produce its usual diagnostics. Decoding
+    also stops when fewer than four bytes of
+    output space remain. Returns the new input
+    position, which always sits on the byte
+    following the last escape consumed.
+*/
+inline
+char const*
+parse_uescape_run(
+    char const* p,
+    char const* const end,
+    char*& dest,
+    char* const dest_end) noexcept
+{
+    char* d = dest;
+    while(end - p >= 6 &&
+        dest_end - d >= 4 &&
+        p[0] == '\\' && p[1] == 'u')
+    {
+        int const u1 = parse_hex4(p + 2);
+        if(u1 < 0)
+            break;
+        if(u1 < 0xd800 || u1 > 0xdfff)
+        {
+            d = append_utf8(d,
+                static_cast<unsigned>(u1));
+            p += 6;
+            continue;
+        }
+        if(u1 > 0xdbff)
+            break;
+        // a leading surrogate is consumed only
+        // together with its trailing partner
+        if(end - p < 12 ||
+            p[6] != '\\' || p[7] != 'u')
+            break;
+        int const u2 = parse_hex4(p + 8);
+        if(u2 < 0xdc00 || u2 > 0xdfff)
+            break;
+        d = append_utf8(d, static_cast<unsigned>(
+            ((u1 - 0xd800) << 10) +
+            (u2 - 0xdc00) + 0x10000));
+        p += 12;
+    }
+    dest = d;
+    return p;
+}
+
+/*  Measure the unescaped size of the string
+    token beginning at p, which may start at
+    an escape or at a plain character. The
+    scan stops at the closing double quote
+    and returns the exact number of bytes the
+    token will occupy once unescaped, without
+    writing any output. If the closing quote
+    is not within [p, end), or an escape is
+    truncated or malformed, size_t(-1) is
+    returned and the caller's scalar decoder
+    produces its usual diagnostics.
+*/
+inline
+std::size_t
+unescaped_size(
+    char const* p,
+    char const* const end) noexcept
+{
+    std::size_t n = 0;
+    while(p != end)
+    {
+        // skip a plain run in one go
+        auto const d = count_unescaped(
+            p, end - p);
+        n += d;
+        p += d;
+        if(p == end)
+            break;
+        char const c = *p;
+        if(c == '\x22') // '"'
+            return n;
+        if(c != '\\')
+        {
+            // an unescaped control or a
+            // stray byte; count it and let
+            // the decoder diagnose it
+            ++n;
+            ++p;
+            continue;
+        }
+        if(end - p < 2)
+            break;
+        switch(p[1])
+        {
+        default:
+            return std::size_t(-1);
+        case '\x22': case '\\': case '/':
+        case 'b': case 'f': case 'n':
+        case 'r': case 't':
+            ++n;
+            p += 2;
+            continue;
+        case 'u':
+            break;
+        }
+        if(end - p < 6)
+            break;
+        int const u1 = parse_hex4(p + 2);
+        if(u1 < 0)
+            return std::size_t(-1);
+        if(u1 < 0xd800 || u1 > 0xdfff)
+        {
+            n += u1 < 0x80 ? 1 :
+                u1 < 0x800 ? 2 : 3;
+            p += 6;
+            continue;
+        }
+        if(u1 > 0xdbff)
+            return std::size_t(-1);
+        if(end - p < 12)
+            break;
+        if( p[6] != '\\' || p[7] != 'u' ||
+            parse_hex4(p + 8) < 0)
+            return std::size_t(-1);
+        // a surrogate pair; validation of
+        // the trailing value is left to
+        // the decoder
+        n += 4;
+        p += 12;
+    }
+    return std::size_t(-1);
+}
+
+} // detail
+} // namespace json
+} // namespace boost
+
+#endif
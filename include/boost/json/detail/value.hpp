@@ -241,6 +241,17 @@ struct access
                     std::forward<Args>(args)...));
     }
 
+    // the size of a container's table header;
+    // used by the storage estimator
+    template<class T>
+    static
+    constexpr
+    std::size_t
+    table_size() noexcept
+    {
+        return sizeof(typename T::table);
+    }
+
     template<class Value>
     static
     char const*
@@ -253,6 +264,78 @@ struct access
         return jv.str_.impl_.release_key(len);
     }
 
+    // the "needs no escaping" bit of a string;
+    // set by the parser, tested by the serializer
+    template<class String>
+    static
+    bool
+    unescaped(String const& s) noexcept
+    {
+        return s.impl_.unescaped();
+    }
+
+    template<class String>
+    static
+    void
+    unescaped(String& s, bool v) noexcept
+    {
+        s.impl_.unescaped(v);
+    }
+
+    // the "raw number" bit of a string; marks
+    // pre-formatted numeral text which the
+    // serializer emits verbatim, unquoted
+    template<class String>
+    static
+    bool
+    raw_number(String const& s) noexcept
+    {
+        return s.impl_.raw_number();
+    }
+
+    template<class String>
+    static
+    void
+    raw_number(String& s, bool v) noexcept
+    {
+        s.impl_.raw_number(v);
+    }
+
+    // the storage pointer of a scalar value;
+    // used to fix up elements copied bitwise
+    template<class Value>
+    static
+    storage_ptr&
+    scalar_sp(Value& jv) noexcept
+    {
+        BOOST_ASSERT(
+            jv.kind() < json::kind::string);
+        return jv.sca_.sp;
+    }
+
+    // the storage pointer of any value; every
+    // union alternative stores it first. Used
+    // to install the owning reference into the
+    // root of a single-storage tree.
+    template<class Value>
+    static
+    storage_ptr&
+    sp(Value& jv) noexcept
+    {
+        return jv.sp_;
+    }
+
+    template<class Value>
+    static
+    char const*
+    key_data(
+        Value const& jv,
+        std::size_t& len) noexcept
+    {
+        BOOST_ASSERT(jv.is_string());
+        return jv.str_.impl_.key_data(len);
+    }
+
     using index_t = std::uint32_t;
 
     template<class KeyValuePair>
@@ -112,12 +112,41 @@ value_from_impl( map_like_conversion_tag, value& jv, T&& from, Ctx const& ctx )
             value_from( get<1>(elem), ctx, obj.storage() ));
 }
 
+// scalar-sequence fast path: a contiguous
+// buffer of doubles or 64-bit integers fills
+// the array in one pass through array::append,
+// skipping the per-element value construction
+// and storage_ptr propagation
+template< class T >
+auto
+scalar_sequence_append( array& result, T const& from, int )
+    -> decltype( result.append( from.data(), std::size_t() ), true )
+{
+    result.append(
+        from.data(),
+        static_cast<std::size_t>(from.size()) );
+    return true;
+}
+
+template< class T >
+bool
+scalar_sequence_append( array&, T const&, long )
+{
+    return false;
+}
+
 // ranges
 template< class T, class Ctx >
 void
 value_from_impl( sequence_conversion_tag, value& jv, T&& from, Ctx const& ctx )
 {
     array& result = jv.emplace_array();
+    // a user-supplied context can customize the
+    // conversion of the elements themselves, so
+    // the bulk path only applies without one
+    if( std::is_same<Ctx, no_context>::value &&
+        detail::scalar_sequence_append( result, from, 0 ) )
+        return;
     result.reserve(detail::try_size(from, size_implementation<T>()));
     using ForwardedValue = forwarded_value<T&&>;
     for (auto&& elem : from)
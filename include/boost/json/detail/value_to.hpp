@@ -15,6 +15,7 @@
 #include <boost/json/value.hpp>
 #include <boost/json/conversion.hpp>
 #include <boost/describe/enum_from_string.hpp>
+#include <boost/variant2/variant.hpp>
 
 #ifndef BOOST_NO_CXX17_HDR_OPTIONAL
 # include <optional>
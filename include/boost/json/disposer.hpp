@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_DISPOSER_HPP
+#define BOOST_JSON_DISPOSER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** Incremental destroyer for large values.
+
+    Destroying a large @ref value walks the
+    entire tree at once, which can pause a
+    latency-sensitive thread for milliseconds.
+    A disposer takes ownership of values and
+    tears them down iteratively in bounded
+    slices, so the work can be spread across
+    idle moments of an event loop:
+
+    @code
+    disposer d;
+    d.adopt( std::move( jv ) );
+    while( ! d.done() )
+        d.step( 10000 );    // between events
+    @endcode
+
+    Values whose memory resource does not
+    deallocate, such as a @ref
+    monotonic_resource with unique ownership,
+    are released immediately upon adoption
+    since destroying them does not visit
+    their contents.
+
+    The destructor releases anything still
+    pending, all at once.
+
+    @par Thread Safety
+    Distinct instances may be used
+    concurrently. A disposer may be used from
+    a different thread than the one which
+    created the adopted values, as long as
+    their memory resource is thread-safe.
+*/
+class disposer
+{
+    std::vector<value> work_;
+
+public:
+    /** Destructor.
+
+        Any values still pending are
+        destroyed without slicing.
+    */
+    ~disposer() = default;
+
+    /** Default constructor.
+
+        The disposer starts with no
+        pending work.
+    */
+    disposer() = default;
+
+    /** Take ownership of a value to destroy later.
+
+        The value is left null. If its memory
+        resource is not shared and has a
+        trivial deallocate function, it is
+        released immediately; otherwise it is
+        queued and torn down by later calls
+        to @ref step.
+
+        @param jv The value to dispose of.
+    */
+    BOOST_JSON_DECL
+    void
+    adopt(value&& jv);
+
+    /** Destroy up to `n` nodes of pending work.
+
+        Each scalar, string, array, or object
+        destroyed counts as one node. Arrays
+        and objects are drained one element at
+        a time, so a call performs a bounded
+        amount of work regardless of the size
+        or depth of the adopted values.
+
+        @par Complexity
+        Linear in `n`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate`
+        may throw when nested containers are
+        moved to the internal work list.
+
+        @param n The maximum number of nodes
+        to destroy.
+
+        @return `true` if no work remains.
+    */
+    BOOST_JSON_DECL
+    bool
+    step(std::size_t n);
+
+    /** Return `true` if no work is pending.
+    */
+    bool
+    done() const noexcept
+    {
+        return work_.empty();
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -70,6 +70,15 @@ enum class error
     /// error occured when trying to read input
     input_error,
 
+    /// error occured when trying to write output
+    output_error,
+
+    /// serialized output exceeded the byte budget
+    output_limit,
+
+    /// the parse was canceled
+    canceled,
+
     //
     // generic errors
     //
@@ -83,6 +92,9 @@ enum class error
     /// test failure
     test_failure,
 
+    /// not enough memory to complete the operation
+    not_enough_memory,
+
     //
     // JSON Pointer errors
     //
@@ -153,6 +165,23 @@ enum class error
 
     /// the key does not correspond to a known name
     unknown_name,
+
+    //
+    // JSONPath errors
+    //
+
+    /// the JSONPath query is malformed
+    invalid_path,
+
+    /// an object contains a duplicate key
+    duplicate_key,
+
+    //
+    // JSON Patch errors
+    //
+
+    /// the patch document is malformed
+    invalid_patch,
 };
 
 /** Error conditions corresponding to JSON errors
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_ESCAPE_HPP
+#define BOOST_JSON_ESCAPE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** Replace characters with their JSON escape sequences.
+
+    This function copies the characters of `s` to
+    `dest`, replacing each character which cannot
+    appear in a JSON string with its escape
+    sequence, using the same rules as
+    @ref serialize: quotes and backslashes receive
+    a two character escape, as do the control
+    characters with a short form, while remaining
+    control characters are written as `\\u00XX`.
+    The enclosing quotes are not emitted. Every
+    other character is copied without inspection.
+
+    The exact number of characters required may be
+    computed in advance with @ref escaped_size;
+    alternatively, `6 * s.size()` is always
+    sufficient. The input and output ranges may
+    not overlap.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The number of characters
+    written to `dest`.
+
+    @param s The string to escape.
+
+    @param dest The destination to write to.
+
+    @see @ref escaped_size, @ref unescape.
+*/
+BOOST_JSON_DECL
+std::size_t
+escape(
+    string_view s,
+    char* dest) noexcept;
+
+/** Return the length of a string's escaped form.
+
+    This function returns the number of characters
+    which @ref escape would write for `s`, without
+    producing any output.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The number of characters in
+    the escaped form of `s`.
+
+    @param s The string to measure.
+
+    @see @ref escape.
+*/
+BOOST_JSON_DECL
+std::size_t
+escaped_size(
+    string_view s) noexcept;
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_ESTIMATE_HPP
+#define BOOST_JSON_ESTIMATE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** Estimate the storage a parse of a JSON text would allocate.
+
+    This function scans `doc` with the incremental
+    parser and returns the number of bytes which
+    @ref parse would request from the @ref
+    memory_resource of the returned value,
+    including the padding a resource which
+    satisfies requests from a contiguous buffer
+    inserts for alignment. The text is validated
+    but no @ref value is built and nothing is
+    allocated from a user resource.
+
+    The intended use is sizing the initial buffer
+    of a @ref monotonic_resource from sample
+    documents: a buffer of the returned size
+    parses the sample without growing. The result
+    is computed from the library's real node and
+    table footprints and replays the builder's
+    allocations in order, so for a fresh
+    monotonic resource it is exact, with one
+    caveat: the parser can share the allocation
+    of repeated object keys, and the estimate
+    reproduces that sharing only when such keys
+    contain no escape sequences. Keys repeated in
+    escaped form are charged each time, making
+    the estimate an upper bound.
+
+    The estimate covers only the storage of the
+    resulting value. Temporary storage used
+    during parsing, and the resource's own
+    bookkeeping, are not included.
+
+    @par Complexity
+    Linear in `doc.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The number of bytes a parse would
+    consume, or zero on error.
+
+    @param doc The serialized JSON text to
+    examine.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options the eventual parse
+    would use.
+
+    @see
+        @ref monotonic_resource,
+        @ref parse,
+        @ref validate.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::size_t
+estimate_storage(
+    string_view doc,
+    error_code& ec,
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+std::size_t
+estimate_storage(
+    string_view doc,
+    std::error_code& ec,
+    parse_options const& opt = {});
+/** @} */
+
+/** Estimate the storage a parse of a JSON text would allocate.
+
+    This overload is equivalent to
+    @ref estimate_storage, except that it throws
+    on error.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The number of bytes a parse would
+    consume.
+
+    @throw system_error Thrown on failure.
+
+    @param doc The serialized JSON text to
+    examine.
+
+    @param opt The options the eventual parse
+    would use.
+*/
+BOOST_JSON_DECL
+std::size_t
+estimate_storage(
+    string_view doc,
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,290 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_EXECUTOR_HPP
+#define BOOST_JSON_EXECUTOR_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** An abstract interface for running parallel work.
+
+    The library's parallel algorithms, such as
+    @ref parse_ndjson, @ref serialize_parallel,
+    and @ref equal, divide their input into
+    independent chunks. An executor decides how
+    the chunk functions are invoked: callers
+    which already run a scheduler implement this
+    interface over it, so library-internal
+    threading does not compete with the
+    application's own threads. When no executor
+    is supplied, the algorithms use transient
+    threads of execution.
+
+    This interface mirrors
+    @ref memory_resource: algorithms call the
+    public members, implementations override the
+    protected virtual functions.
+
+    @see
+        @ref thread_pool,
+        @ref parse_ndjson,
+        @ref serialize_parallel.
+*/
+class executor
+{
+public:
+    /** The type of chunk function.
+
+        The function is called as `fn( arg, i )`
+        once for every index `i` in
+        `[0, count)`, in any order and possibly
+        concurrently. It must not throw;
+        algorithms transport failures through
+        `arg` instead.
+    */
+    typedef void (*function_type)(
+        void* arg, std::size_t i);
+
+    virtual ~executor() = default;
+
+    /** Run a batch of chunk functions.
+
+        This function invokes
+        `fn( arg, i )` for every index `i` in
+        `[0, count)` and returns when all
+        invocations have completed. Invocations
+        may run concurrently; the implementation
+        chooses the threads, which may include
+        the calling thread.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param count The number of chunks.
+
+        @param fn The function to invoke.
+
+        @param arg An opaque argument
+        passed to `fn`.
+    */
+    void
+    run(
+        std::size_t count,
+        function_type fn,
+        void* arg)
+    {
+        do_run(count, fn, arg);
+    }
+
+    /** Return the amount of available parallelism.
+
+        Algorithms use this to choose their
+        chunk count.
+    */
+    unsigned
+    concurrency() const noexcept
+    {
+        return do_concurrency();
+    }
+
+protected:
+    /** Run a batch of chunk functions.
+
+        @param count The number of chunks.
+
+        @param fn The function to invoke.
+
+        @param arg An opaque argument
+        passed to `fn`.
+    */
+    virtual
+    void
+    do_run(
+        std::size_t count,
+        function_type fn,
+        void* arg) = 0;
+
+    /** Return the amount of available parallelism.
+    */
+    virtual
+    unsigned
+    do_concurrency() const noexcept = 0;
+};
+
+//----------------------------------------------------------
+
+/** A pool of worker threads for parallel algorithms.
+
+    This executor owns a fixed set of threads
+    which persist across calls to @ref run, so
+    repeated parallel operations pay no thread
+    creation cost. Chunk indices are claimed
+    dynamically from a shared counter: a worker
+    which finishes its chunk early immediately
+    steals the next unclaimed one, keeping all
+    threads busy when chunks take uneven time.
+    The calling thread participates in the work.
+
+    One pool sized to the machine, shared by all
+    of an application's parallel JSON operations,
+    avoids oversubscription.
+
+    @par Example
+    @code
+    thread_pool pool;
+
+    auto records = parse_ndjson( body, ec, {}, pool );
+    @endcode
+
+    @par Thread Safety
+    Distinct threads may not call @ref run on
+    the same pool concurrently.
+*/
+class
+    BOOST_JSON_DECL
+    BOOST_SYMBOL_VISIBLE
+thread_pool final
+    : public executor
+{
+    struct job;
+
+    std::vector<std::thread> threads_;
+    std::mutex m_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    job* job_ = nullptr;
+    std::size_t generation_ = 0;
+    bool stop_ = false;
+
+public:
+    /// Copy constructor (deleted)
+    thread_pool(
+        thread_pool const&) = delete;
+
+    /// Copy assignment (deleted)
+    thread_pool& operator=(
+        thread_pool const&) = delete;
+
+    /** Destructor.
+
+        All worker threads are joined.
+
+        @par Complexity
+        Linear in the number of threads.
+    */
+    BOOST_JSON_DECL
+    ~thread_pool();
+
+    /** Constructor.
+
+        The pool is created with
+        `threads - 1` worker threads; the thread
+        calling @ref run always participates as
+        the remaining worker. If `threads` is
+        zero, the number of hardware threads
+        is used.
+
+        @par Exception Safety
+        Strong guarantee.
+        Exceptions from launching threads of
+        execution are propagated.
+
+        @param threads The total amount of
+        parallelism, including the
+        calling thread.
+    */
+    BOOST_JSON_DECL
+    explicit
+    thread_pool(unsigned threads = 0);
+
+    /** Constructor.
+
+        This overload additionally pins the
+        worker threads to the processors of one
+        NUMA node, so that parallel algorithms
+        consuming an arena placed on that node
+        with
+        @ref monotonic_resource::growth_options::numa_node
+        never traverse it across the
+        interconnect. If `threads` is zero, the
+        number of processors of the node is
+        used. Pinning is a hint: it has an
+        effect only on Linux, and a node which
+        does not exist leaves the workers
+        unpinned. The calling thread, which
+        participates in @ref run, is never
+        re-pinned by the library.
+
+        @par Exception Safety
+        Strong guarantee.
+        Exceptions from launching threads of
+        execution are propagated.
+
+        @param threads The total amount of
+        parallelism, including the
+        calling thread.
+
+        @param numa_node The NUMA node to pin
+        worker threads to, or -1 for no
+        pinning.
+    */
+    BOOST_JSON_DECL
+    thread_pool(
+        unsigned threads,
+        int numa_node);
+
+protected:
+#ifndef BOOST_JSON_DOCS
+    BOOST_JSON_DECL
+    void
+    do_run(
+        std::size_t count,
+        function_type fn,
+        void* arg) override;
+
+    BOOST_JSON_DECL
+    unsigned
+    do_concurrency() const noexcept override;
+#endif
+
+private:
+    void
+    work(job& j) noexcept;
+};
+
+//----------------------------------------------------------
+
+namespace detail {
+
+// Run fn(arg, i) for every i in [0, count) and
+// wait for completion: on ex when given,
+// otherwise on count - 1 transient threads plus
+// the calling thread.
+BOOST_JSON_DECL
+void
+parallel_run(
+    executor* ex,
+    std::size_t count,
+    executor::function_type fn,
+    void* arg);
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+#endif
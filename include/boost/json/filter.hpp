@@ -0,0 +1,564 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_FILTER_HPP
+#define BOOST_JSON_FILTER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/serialize_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/writer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** A parse handler which re-emits the document as text.
+
+    This handler satisfies the requirements of
+    @ref basic_parser and forwards every parse
+    event into a @ref writer, reproducing the
+    document in the sink using the same
+    escaping and number formatting as
+    @ref serializer. Combined with the filter
+    stages in this header it allows a stream
+    of JSON to be rewritten without building a
+    @ref value:
+
+    @code
+    string_sink sink;
+    basic_parser<
+        redact_filter<
+            writer_handler< string_sink > > > p(
+                parse_options(),
+                std::initializer_list<string_view>{
+                    "password" },
+                sink );
+    @endcode
+
+    Keys and strings which arrive split across
+    buffer boundaries are accumulated in an
+    internal buffer; everything else is written
+    through immediately, so memory use is
+    bounded by the largest single string in the
+    document rather than by its total size.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+*/
+template< class Sink >
+class writer_handler
+{
+    writer<Sink> w_;
+    std::string part_;
+
+public:
+    /// The maximum number of elements allowed in an object
+    static constexpr std::size_t
+        max_object_size = std::size_t(-1);
+
+    /// The maximum number of elements allowed in an array
+    static constexpr std::size_t
+        max_array_size = std::size_t(-1);
+
+    /// The maximum size allowed for a key
+    static constexpr std::size_t
+        max_key_size = std::size_t(-1);
+
+    /// The maximum size allowed for a string
+    static constexpr std::size_t
+        max_string_size = std::size_t(-1);
+
+    /** Constructor.
+
+        @param sink The object to write to.
+        Ownership is not transferred.
+
+        @param opts The options for the
+        produced text.
+    */
+    explicit
+    writer_handler(
+        Sink& sink,
+        serialize_options const& opts = {} ) noexcept
+        : w_( sink, opts )
+    {
+    }
+
+    /** Return true when a complete document has been emitted.
+    */
+    bool
+    done() const noexcept
+    {
+        return w_.done();
+    }
+
+    bool on_document_begin( error_code& ) { return true; }
+    bool on_document_end( error_code& ) { return true; }
+
+    bool on_object_begin( error_code& )
+    {
+        w_.begin_object();
+        return true;
+    }
+
+    bool on_object_end( std::size_t, error_code& )
+    {
+        w_.end_object();
+        return true;
+    }
+
+    bool on_array_begin( error_code& )
+    {
+        w_.begin_array();
+        return true;
+    }
+
+    bool on_array_end( std::size_t, error_code& )
+    {
+        w_.end_array();
+        return true;
+    }
+
+    bool on_key_part( string_view sv, std::size_t, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_key( string_view sv, std::size_t, error_code& )
+    {
+        if( part_.empty() )
+        {
+            w_.key( sv );
+        }
+        else
+        {
+            part_.append( sv.data(), sv.size() );
+            w_.key( part_ );
+            part_.clear();
+        }
+        return true;
+    }
+
+    bool on_string_part( string_view sv, std::size_t, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_string( string_view sv, std::size_t, error_code& )
+    {
+        if( part_.empty() )
+        {
+            w_.value( sv );
+        }
+        else
+        {
+            part_.append( sv.data(), sv.size() );
+            w_.value( string_view(part_) );
+            part_.clear();
+        }
+        return true;
+    }
+
+    bool on_number_part( string_view, error_code& ) { return true; }
+
+    bool on_int64( std::int64_t i, string_view, error_code& )
+    {
+        w_.value( static_cast<long long>(i) );
+        return true;
+    }
+
+    bool on_uint64( std::uint64_t u, string_view, error_code& )
+    {
+        w_.value( static_cast<unsigned long long>(u) );
+        return true;
+    }
+
+    bool on_double( double d, string_view, error_code& )
+    {
+        w_.value( d );
+        return true;
+    }
+
+    bool on_bool( bool b, error_code& )
+    {
+        w_.value( b );
+        return true;
+    }
+
+    bool on_null( error_code& )
+    {
+        w_.value( nullptr );
+        return true;
+    }
+
+    bool on_comment_part( string_view, error_code& ) { return true; }
+    bool on_comment( string_view, error_code& ) { return true; }
+};
+
+/** A pipeline stage which forwards every parse event.
+
+    This class satisfies the requirements of
+    @ref basic_parser by holding a downstream
+    handler and forwarding each event to it
+    unchanged. It is the building block of
+    SAX-to-SAX pipelines: a transforming stage
+    derives from this class and shadows only
+    the events it is interested in, leaving
+    the rest to pass through. Stages compose
+    by nesting, with @ref writer_handler as
+    the usual terminal stage.
+
+    Constructor arguments are forwarded to the
+    downstream handler.
+*/
+template< class Handler >
+class pass_through_filter
+{
+protected:
+    /// The downstream handler
+    Handler h_;
+
+public:
+    /// The maximum number of elements allowed in an object
+    static constexpr std::size_t
+        max_object_size = Handler::max_object_size;
+
+    /// The maximum number of elements allowed in an array
+    static constexpr std::size_t
+        max_array_size = Handler::max_array_size;
+
+    /// The maximum size allowed for a key
+    static constexpr std::size_t
+        max_key_size = Handler::max_key_size;
+
+    /// The maximum size allowed for a string
+    static constexpr std::size_t
+        max_string_size = Handler::max_string_size;
+
+    /** Constructor.
+
+        @param args Arguments forwarded to the
+        downstream handler.
+    */
+    template< class... Args >
+    explicit
+    pass_through_filter( Args&&... args )
+        : h_( std::forward<Args>(args)... )
+    {
+    }
+
+    /** Return the downstream handler.
+    */
+    Handler&
+    next() noexcept
+    {
+        return h_;
+    }
+
+    bool on_document_begin( error_code& ec ) { return h_.on_document_begin(ec); }
+    bool on_document_end( error_code& ec ) { return h_.on_document_end(ec); }
+    bool on_object_begin( error_code& ec ) { return h_.on_object_begin(ec); }
+    bool on_object_end( std::size_t n, error_code& ec ) { return h_.on_object_end(n, ec); }
+    bool on_array_begin( error_code& ec ) { return h_.on_array_begin(ec); }
+    bool on_array_end( std::size_t n, error_code& ec ) { return h_.on_array_end(n, ec); }
+    bool on_key_part( string_view sv, std::size_t n, error_code& ec ) { return h_.on_key_part(sv, n, ec); }
+    bool on_key( string_view sv, std::size_t n, error_code& ec ) { return h_.on_key(sv, n, ec); }
+    bool on_string_part( string_view sv, std::size_t n, error_code& ec ) { return h_.on_string_part(sv, n, ec); }
+    bool on_string( string_view sv, std::size_t n, error_code& ec ) { return h_.on_string(sv, n, ec); }
+    bool on_number_part( string_view sv, error_code& ec ) { return h_.on_number_part(sv, ec); }
+    bool on_int64( std::int64_t i, string_view sv, error_code& ec ) { return h_.on_int64(i, sv, ec); }
+    bool on_uint64( std::uint64_t u, string_view sv, error_code& ec ) { return h_.on_uint64(u, sv, ec); }
+    bool on_double( double d, string_view sv, error_code& ec ) { return h_.on_double(d, sv, ec); }
+    bool on_bool( bool b, error_code& ec ) { return h_.on_bool(b, ec); }
+    bool on_null( error_code& ec ) { return h_.on_null(ec); }
+    bool on_comment_part( string_view sv, error_code& ec ) { return h_.on_comment_part(sv, ec); }
+    bool on_comment( string_view sv, error_code& ec ) { return h_.on_comment(sv, ec); }
+};
+
+/** A pipeline stage which renames object keys.
+
+    Keys equal to the first element of a
+    replacement pair are forwarded downstream
+    as the second element; all other events
+    pass through unchanged. Keys split across
+    buffer boundaries are accumulated before
+    the lookup, so renaming works regardless
+    of how the input is fed to the parser.
+*/
+template< class Handler >
+class rename_filter
+    : public pass_through_filter<Handler>
+{
+    std::vector<std::pair<
+        std::string, std::string>> map_;
+    std::string part_;
+
+public:
+    /** Constructor.
+
+        @param map The replacement pairs, each
+        holding the original key and the key
+        to emit in its place.
+
+        @param args Arguments forwarded to the
+        downstream handler.
+    */
+    template< class... Args >
+    explicit
+    rename_filter(
+        std::initializer_list<std::pair<
+            string_view, string_view>> map,
+        Args&&... args )
+        : pass_through_filter<Handler>(
+            std::forward<Args>(args)... )
+    {
+        map_.reserve( map.size() );
+        for( auto const& p : map )
+            map_.emplace_back( p.first, p.second );
+    }
+
+    bool on_key_part( string_view sv, std::size_t, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_key( string_view sv, std::size_t n, error_code& ec )
+    {
+        if( ! part_.empty() )
+        {
+            part_.append( sv.data(), sv.size() );
+            sv = part_;
+        }
+        for( auto const& p : map_ )
+        {
+            if( sv == p.first )
+            {
+                sv = p.second;
+                n = sv.size();
+                break;
+            }
+        }
+        bool const ok =
+            this->h_.on_key( sv, n, ec );
+        part_.clear();
+        return ok;
+    }
+};
+
+/** A pipeline stage which redacts object members.
+
+    The value of every member whose key equals
+    one of the given keys is replaced by null
+    before being forwarded downstream; nested
+    containers under a redacted key are
+    swallowed without visiting the downstream
+    handler. The key itself and the element
+    counts seen by the downstream handler are
+    preserved, so the output remains
+    structurally identical to the input.
+*/
+template< class Handler >
+class redact_filter
+    : public pass_through_filter<Handler>
+{
+    std::vector<std::string> keys_;
+    std::string part_;
+    std::size_t skip_ = 0;
+    bool pending_ = false;
+
+public:
+    /** Constructor.
+
+        @param keys The keys whose values are
+        replaced by null.
+
+        @param args Arguments forwarded to the
+        downstream handler.
+    */
+    template< class... Args >
+    explicit
+    redact_filter(
+        std::initializer_list<string_view> keys,
+        Args&&... args )
+        : pass_through_filter<Handler>(
+            std::forward<Args>(args)... )
+    {
+        keys_.reserve( keys.size() );
+        for( auto const& sv : keys )
+            keys_.emplace_back( sv );
+    }
+
+    bool on_object_begin( error_code& ec )
+    {
+        if( pending_ || skip_ )
+        {
+            pending_ = false;
+            ++skip_;
+            return true;
+        }
+        return this->h_.on_object_begin( ec );
+    }
+
+    bool on_object_end( std::size_t n, error_code& ec )
+    {
+        if( skip_ )
+            return leave( ec );
+        return this->h_.on_object_end( n, ec );
+    }
+
+    bool on_array_begin( error_code& ec )
+    {
+        if( pending_ || skip_ )
+        {
+            pending_ = false;
+            ++skip_;
+            return true;
+        }
+        return this->h_.on_array_begin( ec );
+    }
+
+    bool on_array_end( std::size_t n, error_code& ec )
+    {
+        if( skip_ )
+            return leave( ec );
+        return this->h_.on_array_end( n, ec );
+    }
+
+    bool on_key_part( string_view sv, std::size_t n, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        part_.append( sv.data(), sv.size() );
+        return this->h_.on_key_part( sv, n, ec );
+    }
+
+    bool on_key( string_view sv, std::size_t n, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        bool const ok = this->h_.on_key( sv, n, ec );
+        if( ! part_.empty() )
+        {
+            part_.append( sv.data(), sv.size() );
+            sv = part_;
+        }
+        for( auto const& k : keys_ )
+        {
+            if( sv == k )
+            {
+                pending_ = true;
+                break;
+            }
+        }
+        part_.clear();
+        return ok;
+    }
+
+    bool on_string_part( string_view sv, std::size_t n, error_code& ec )
+    {
+        if( pending_ || skip_ )
+            return true;
+        return this->h_.on_string_part( sv, n, ec );
+    }
+
+    bool on_string( string_view sv, std::size_t n, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_string( sv, n, ec );
+    }
+
+    bool on_number_part( string_view sv, error_code& ec )
+    {
+        if( pending_ || skip_ )
+            return true;
+        return this->h_.on_number_part( sv, ec );
+    }
+
+    bool on_int64( std::int64_t i, string_view sv, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_int64( i, sv, ec );
+    }
+
+    bool on_uint64( std::uint64_t u, string_view sv, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_uint64( u, sv, ec );
+    }
+
+    bool on_double( double d, string_view sv, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_double( d, sv, ec );
+    }
+
+    bool on_bool( bool b, error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_bool( b, ec );
+    }
+
+    bool on_null( error_code& ec )
+    {
+        if( skip_ )
+            return true;
+        if( pending_ )
+            return replace( ec );
+        return this->h_.on_null( ec );
+    }
+
+private:
+    // emit the null which stands in
+    // for a redacted scalar
+    bool
+    replace( error_code& ec )
+    {
+        pending_ = false;
+        return this->h_.on_null( ec );
+    }
+
+    // close one swallowed container, emitting
+    // the replacement when it was outermost
+    bool
+    leave( error_code& ec )
+    {
+        if( --skip_ > 0 )
+            return true;
+        return this->h_.on_null( ec );
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -26,6 +26,8 @@ class string;
 class value;
 
 class key_value_pair;
+class pointer;
+class shared_value;
 class storage_ptr;
 
 struct value_from_tag;
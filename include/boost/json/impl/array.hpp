@@ -12,7 +12,9 @@
 
 #include <boost/json/value.hpp>
 #include <boost/json/detail/except.hpp>
+#include <boost/json/detail/prefetch.hpp>
 #include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <type_traits>
 
@@ -147,6 +149,18 @@ array(
             decltype(*first)>::value);
 }
 
+template<class T, class>
+array::
+array(
+    T const* first,
+    std::size_t count,
+    storage_ptr sp)
+    : sp_(std::move(sp))
+    , t_(&empty_)
+{
+    append(first, count);
+}
+
 //----------------------------------------------------------
 //
 // Modifiers
@@ -334,6 +348,116 @@ if_contains(
     return nullptr;
 }
 
+namespace detail {
+
+// hint the cache about the separately
+// allocated payload of a value, if any.
+// computing the payload address reads
+// only the element itself, which the
+// traversal already has in cache.
+inline
+void
+prefetch_payload(
+    value const& jv) noexcept
+{
+    if(auto const a = jv.if_array())
+        prefetch(a->data());
+    else if(auto const o = jv.if_object())
+        prefetch(o->begin());
+    else if(auto const s = jv.if_string())
+        prefetch(s->data());
+}
+
+} // detail
+
+template<class F>
+void
+array::
+for_each(F&& f)
+{
+    // visiting an element is long enough
+    // to hide one payload fetch, so a
+    // short prefetch distance suffices
+    std::size_t const d = 2;
+    value* it = &(*t_)[0];
+    value* const last = it + t_->size;
+    for(; it != last; ++it)
+    {
+        if(std::size_t(last - it) > d)
+            detail::prefetch_payload(it[d]);
+        f(*it);
+    }
+}
+
+template<class F>
+void
+array::
+for_each(F&& f) const
+{
+    std::size_t const d = 2;
+    value const* it = &(*t_)[0];
+    value const* const last = it + t_->size;
+    for(; it != last; ++it)
+    {
+        if(std::size_t(last - it) > d)
+            detail::prefetch_payload(it[d]);
+        f(*it);
+    }
+}
+
+template<class Pred>
+std::size_t
+array::
+remove_if(Pred&& pred)
+{
+    if(empty())
+        return 0;
+    auto const first = &(*t_)[0];
+    auto const last = first + t_->size;
+    auto keep = first;
+    auto src = first;
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        for(; src != last; ++src)
+        {
+            if(! pred(*src))
+            {
+                // survivors slide down
+                // bytewise, as erase does
+                if(keep != src)
+                    std::memcpy(
+                        static_cast<void*>(keep),
+                        static_cast<void const*>(src),
+                        sizeof(value));
+                ++keep;
+                continue;
+            }
+            src->~value();
+        }
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(...)
+    {
+        // the element that threw, and those
+        // not yet visited, survive
+        if(keep != src)
+            std::memmove(
+                static_cast<void*>(keep),
+                static_cast<void const*>(src),
+                (last - src) * sizeof(value));
+        t_->size = static_cast<std::uint32_t>(
+            (keep - first) + (last - src));
+        throw;
+    }
+#endif
+    t_->size = static_cast<
+        std::uint32_t>(keep - first);
+    return static_cast<
+        std::size_t>(last - keep);
+}
+
 //----------------------------------------------------------
 //
 // Iterators
@@ -483,7 +607,7 @@ reserve(
     // never shrink
     if(new_capacity <= t_->capacity)
         return;
-    reserve_impl(new_capacity);
+    reserve_exact(new_capacity);
 }
 
 //----------------------------------------------------------
@@ -504,7 +628,10 @@ array(
     revert_construct r(*this);
     while(first != last)
     {
-        reserve(size() + 1);
+        // geometric growth; reserve
+        // would allocate exactly
+        if(t_->size >= t_->capacity)
+            reserve_impl(size() + 1);
         ::new(end()) value(
             *first++, sp_);
         ++t_->size;
@@ -15,6 +15,7 @@
 #include <boost/json/pilfer.hpp>
 #include <boost/json/detail/except.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <new>
 #include <utility>
@@ -63,6 +64,8 @@ deallocate(
 {
     if(p->capacity == 0)
         return;
+    if(sp.is_deallocate_trivial())
+        return;
     sp->deallocate(p,
         sizeof(table) +
             p->capacity * sizeof(value),
@@ -269,13 +272,40 @@ array(
     auto src = other.data();
     auto dest = data();
     auto const n = other.size();
-    do
+    std::size_t i = 0;
+    while(i < n)
     {
-        ::new(dest++) value(
-            *src++, sp_);
-        ++t_->size;
+        // scalar kinds share detail::scalar's
+        // layout: copy runs of them bitwise,
+        // then give each copy this array's
+        // storage. none of this can throw, so
+        // the count is updated afterwards.
+        std::size_t run = i;
+        while(run < n &&
+            src[run].kind() < kind::string)
+            ++run;
+        if(run > i)
+        {
+            std::memcpy(
+                static_cast<void*>(dest + i),
+                src + i,
+                (run - i) * sizeof(value));
+            for(std::size_t j = i; j < run; ++j)
+                ::new(&detail::access::
+                    scalar_sp(dest[j]))
+                        storage_ptr(sp_);
+            t_->size += static_cast<
+                std::uint32_t>(run - i);
+            i = run;
+        }
+        if(i < n)
+        {
+            ::new(dest + i) value(
+                src[i], sp_);
+            ++t_->size;
+            ++i;
+        }
     }
-    while(t_->size < n);
     r.commit();
 }
 
@@ -380,6 +410,11 @@ shrink_to_fit() noexcept
 {
     if(capacity() <= size())
         return;
+    // when deallocation is trivial the vacated
+    // block cannot be returned; reallocating
+    // would only consume more of the arena
+    if(sp_.is_deallocate_trivial())
+        return;
     if(size() == 0)
     {
         table::deallocate(t_, sp_);
@@ -429,6 +464,58 @@ clear() noexcept
     t_->size = 0;
 }
 
+std::size_t
+array::
+copy_doubles(
+    double* dest,
+    std::size_t dest_size) const noexcept
+{
+    std::size_t n = 0;
+    for(auto const& v : *this)
+    {
+        if(n >= dest_size)
+            break;
+        if(v.kind() == kind::double_)
+            dest[n++] = v.get_double();
+    }
+    return n;
+}
+
+std::size_t
+array::
+copy_int64s(
+    std::int64_t* dest,
+    std::size_t dest_size) const noexcept
+{
+    std::size_t n = 0;
+    for(auto const& v : *this)
+    {
+        if(n >= dest_size)
+            break;
+        if(v.kind() == kind::int64)
+            dest[n++] = v.get_int64();
+    }
+    return n;
+}
+
+std::size_t
+array::
+copy_strings(
+    string_view* dest,
+    std::size_t dest_size) const noexcept
+{
+    std::size_t n = 0;
+    for(auto const& v : *this)
+    {
+        if(n >= dest_size)
+            break;
+        if(v.kind() == kind::string)
+            dest[n++] =
+                v.get_string().subview();
+    }
+    return n;
+}
+
 auto
 array::
 insert(
@@ -518,6 +605,20 @@ erase(
     return p;
 }
 
+value
+array::
+extract(std::size_t pos)
+{
+    if(pos >= t_->size)
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error( error::out_of_range, &loc );
+    }
+    value jv( pilfer((*t_)[pos]) );
+    erase(data() + pos);
+    return jv;
+}
+
 void
 array::
 push_back(value const& v)
@@ -532,6 +633,56 @@ push_back(value&& v)
     emplace_back(std::move(v));
 }
 
+void
+array::
+append(
+    double const* first,
+    std::size_t count)
+{
+    revert_insert r(
+        end(), count, *this);
+    while(count--)
+    {
+        // scalar construction
+        // cannot throw
+        ::new(r.p) value(*first++, sp_);
+        ++r.p;
+    }
+    r.commit();
+}
+
+void
+array::
+append(
+    std::int64_t const* first,
+    std::size_t count)
+{
+    revert_insert r(
+        end(), count, *this);
+    while(count--)
+    {
+        ::new(r.p) value(*first++, sp_);
+        ++r.p;
+    }
+    r.commit();
+}
+
+void
+array::
+append(
+    std::uint64_t const* first,
+    std::size_t count)
+{
+    revert_insert r(
+        end(), count, *this);
+    while(count--)
+    {
+        ::new(r.p) value(*first++, sp_);
+        ++r.p;
+    }
+    r.commit();
+}
+
 void
 array::
 pop_back() noexcept
@@ -556,7 +707,10 @@ resize(std::size_t count)
         return;
     }
 
-    reserve(count);
+    // unlike reserve, repeated
+    // resizing grows geometrically
+    if(count > t_->capacity)
+        reserve_impl(count);
     auto p = &(*t_)[t_->size];
     auto const end = &(*t_)[count];
     while(p != end)
@@ -633,10 +787,16 @@ growth(
         detail::throw_system_error( error::array_too_large, &loc );
     }
     std::size_t const old = capacity();
-    if(old > max_size() - old / 2)
+    // configurable geometric growth;
+    // the default of 50 percent is 1.5x
+    auto const g64 =
+        static_cast<std::uint64_t>(old) +
+        static_cast<std::uint64_t>(old) *
+            BOOST_JSON_ARRAY_GROWTH_PERCENT / 100;
+    if(g64 > max_size())
         return new_size;
-    std::size_t const g =
-        old + old / 2; // 1.5x
+    auto const g = static_cast<
+        std::size_t>(g64);
     if(g < new_size)
         return new_size;
     return g;
@@ -661,6 +821,25 @@ reserve_impl(
     table::deallocate(t, sp_);
 }
 
+// precondition: new_capacity > capacity()
+void
+array::
+reserve_exact(
+    std::size_t new_capacity)
+{
+    BOOST_ASSERT(
+        new_capacity > t_->capacity);
+    auto t = table::allocate(
+        new_capacity, sp_);
+    relocate(
+        &(*t)[0],
+        &(*t_)[0],
+        t_->size);
+    t->size = t_->size;
+    t = detail::exchange(t_, t);
+    table::deallocate(t, sp_);
+}
+
 // precondition: pv is not aliased
 value&
 array::
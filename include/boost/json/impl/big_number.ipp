@@ -0,0 +1,239 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_BIG_NUMBER_IPP
+#define BOOST_JSON_IMPL_BIG_NUMBER_IPP
+
+#include <boost/json/big_number.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// multiply a 128-bit magnitude by m and add a,
+// where m is at most 10^8; the caller ensures
+// that the result cannot overflow
+void
+mul_add(
+    std::uint64_t& lo,
+    std::uint64_t& hi,
+    std::uint64_t m,
+    std::uint64_t a) noexcept
+{
+#ifdef BOOST_HAS_INT128
+    unsigned __int128 v =
+        ( static_cast<unsigned __int128>(hi) << 64 ) | lo;
+    v = v * m + a;
+    lo = static_cast<std::uint64_t>(v);
+    hi = static_cast<std::uint64_t>(v >> 64);
+#else
+    // schoolbook multiply over 32-bit limbs;
+    // m and a are both below 2^27, so no
+    // intermediate product overflows
+    std::uint64_t t =
+        ( lo & 0xFFFFFFFF ) * m + a;
+    std::uint64_t const r0 = t & 0xFFFFFFFF;
+    t = ( lo >> 32 ) * m + ( t >> 32 );
+    lo = ( t << 32 ) | r0;
+    hi = hi * m + ( t >> 32 );
+#endif
+}
+
+// divide a 128-bit magnitude by ten in place
+// and return the remainder
+unsigned
+divmod10(
+    std::uint64_t& lo,
+    std::uint64_t& hi) noexcept
+{
+    std::uint64_t r = hi % 10;
+    hi /= 10;
+    std::uint64_t cur = ( r << 32 ) | ( lo >> 32 );
+    std::uint64_t const q1 = cur / 10;
+    r = cur % 10;
+    cur = ( r << 32 ) | ( lo & 0xFFFFFFFF );
+    std::uint64_t const q0 = cur / 10;
+    r = cur % 10;
+    lo = ( q1 << 32 ) | q0;
+    return static_cast<unsigned>(r);
+}
+
+} // (anon)
+
+std::uint64_t
+big_number::
+to_uint64() const
+{
+    if( ! fits_uint64() )
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc
+            = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error(
+            error::not_exact, &loc );
+    }
+    return lo_;
+}
+
+std::int64_t
+big_number::
+to_int64() const
+{
+    if( ! fits_int64() )
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc
+            = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error(
+            error::not_exact, &loc );
+    }
+    if( neg_ )
+        return -static_cast<std::int64_t>(
+            lo_ - 1 ) - 1;
+    return static_cast<std::int64_t>( lo_ );
+}
+
+std::string
+big_number::
+to_string() const
+{
+    if( ! is_inline() )
+        return text_;
+    char buf[40];
+    char* p = buf + sizeof(buf);
+    std::uint64_t lo = lo_;
+    std::uint64_t hi = hi_;
+    do
+    {
+        *--p = static_cast<char>(
+            '0' + divmod10( lo, hi ) );
+    }
+    while( lo | hi );
+    if( neg_ )
+        *--p = '-';
+    return std::string(
+        p, buf + sizeof(buf) - p );
+}
+
+big_number
+parse_big_number(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
+    char const* p = s.data();
+    char const* const end = p + s.size();
+    bool neg = false;
+    if( p != end && *p == '-' )
+    {
+        neg = true;
+        ++p;
+    }
+    std::size_t const digits = end - p;
+    if( digits == 0 ||
+        ( *p == '0' && digits > 1 ) )
+    {
+        BOOST_JSON_FAIL( ec, error::syntax );
+        return {};
+    }
+
+    big_number r;
+    if( digits <= 38 )
+    {
+        // up to 38 digits cannot overflow the
+        // 128-bit magnitude
+        std::uint64_t lo = 0;
+        std::uint64_t hi = 0;
+        std::size_t n = digits;
+#ifdef BOOST_JSON_HAS_SWAR_KERNELS
+        while( n >= 8 )
+        {
+            std::uint64_t v;
+            std::memcpy( &v, p, 8 );
+            // a byte is a decimal digit exactly
+            // when its high nibble is 3 and its
+            // low nibble is at most 9
+            std::uint64_t const t =
+                v ^ 0x3030303030303030;
+            if( ( t & 0xF0F0F0F0F0F0F0F0 ) |
+                ( ( ( t & 0x0F0F0F0F0F0F0F0F ) +
+                    0x0606060606060606 ) &
+                    0x1010101010101010 ) )
+            {
+                BOOST_JSON_FAIL( ec, error::syntax );
+                return {};
+            }
+            mul_add( lo, hi, 100000000,
+                detail::swar_parse_digits( v ) );
+            p += 8;
+            n -= 8;
+        }
+#endif
+        while( n )
+        {
+            char const c = *p;
+            if( c < '0' || c > '9' )
+            {
+                BOOST_JSON_FAIL( ec, error::syntax );
+                return {};
+            }
+            mul_add( lo, hi, 10,
+                static_cast<std::uint64_t>(c - '0') );
+            ++p;
+            --n;
+        }
+        r.lo_ = lo;
+        r.hi_ = hi;
+        // negative zero parses as zero
+        r.neg_ = neg && ( lo | hi ) != 0;
+    }
+    else
+    {
+        for( char const* q = p; q != end; ++q )
+        {
+            if( *q < '0' || *q > '9' )
+            {
+                BOOST_JSON_FAIL( ec, error::syntax );
+                return {};
+            }
+        }
+        r.text_.assign( s.data(), s.size() );
+        r.neg_ = neg;
+    }
+    return r;
+}
+
+big_number
+parse_big_number(
+    string_view s,
+    std::error_code& ec)
+{
+    error_code jec;
+    big_number result = parse_big_number(s, jec);
+    ec = jec;
+    return result;
+}
+
+big_number
+parse_big_number(
+    string_view s)
+{
+    error_code ec;
+    auto result = parse_big_number(s, ec);
+    if(ec)
+        detail::throw_system_error( ec );
+    return result;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,749 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_CBOR_IPP
+#define BOOST_JSON_IMPL_CBOR_IPP
+
+#include <boost/json/cbor.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/detail/except.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// one open container while parsing; count holds
+// the number of items pushed so far, where each
+// map key and mapped value counts separately
+struct cbor_parse_frame
+{
+    std::uint64_t left;
+    std::uint64_t count;
+    bool map;
+    bool indefinite;
+};
+
+// decode the argument following an initial byte
+bool
+read_cbor_arg(
+    char const*& p,
+    char const* end,
+    unsigned char info,
+    std::uint64_t& n,
+    error_code& ec)
+{
+    if(info < 24)
+    {
+        n = info;
+        return true;
+    }
+    std::size_t const needed =
+        std::size_t(1) << (info - 24);
+    if( info > 27 ||
+        static_cast<std::size_t>(
+            end - p) < needed)
+    {
+        if(info > 27)
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+        }
+        else
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+        }
+        return false;
+    }
+    switch(info)
+    {
+    case 24:
+        n = static_cast<unsigned char>(*p);
+        break;
+    case 25:
+        n = detail::load_be16(p);
+        break;
+    case 26:
+        n = detail::load_be32(p);
+        break;
+    default:
+        n = detail::load_be64(p);
+        break;
+    }
+    p += needed;
+    return true;
+}
+
+double
+decode_half(std::uint16_t h) noexcept
+{
+    unsigned const exp = (h >> 10) & 0x1f;
+    unsigned const mant = h & 0x3ff;
+    double d;
+    if(exp == 0)
+        d = std::ldexp(mant, -24);
+    else if(exp != 31)
+        d = std::ldexp(mant + 1024,
+            static_cast<int>(exp) - 25);
+    else if(mant == 0)
+        d = std::numeric_limits<
+            double>::infinity();
+    else
+        d = std::numeric_limits<
+            double>::quiet_NaN();
+    return (h & 0x8000) ? -d : d;
+}
+
+} // (anon)
+
+value
+parse_cbor(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp)
+{
+    ec = {};
+
+    unsigned char temp[
+        BOOST_JSON_STACK_BUFFER_SIZE];
+    value_stack st(
+        storage_ptr(), temp, sizeof(temp));
+    st.reset(std::move(sp));
+
+    unsigned char temp2[16 * sizeof(
+        cbor_parse_frame)];
+    detail::stack fs(
+        storage_ptr(), temp2, sizeof(temp2));
+    cbor_parse_frame cur = {};
+    bool has_cur = false;
+    std::size_t depth = 0;
+    std::size_t const max_depth = 32;
+
+    char const* p = s.data();
+    char const* const end = p + s.size();
+    bool root_done = false;
+
+    // called after an item is pushed; closes
+    // any definite-length containers that the
+    // item completed
+    auto const complete =
+        [&]()
+        {
+            for(;;)
+            {
+                if(! has_cur)
+                {
+                    root_done = true;
+                    return;
+                }
+                ++cur.count;
+                if(cur.indefinite)
+                    return;
+                std::uint64_t const total = cur.map
+                    ? cur.left * 2 : cur.left;
+                if(cur.count < total)
+                    return;
+                if(cur.map)
+                    st.push_object(static_cast<
+                        std::size_t>(cur.left));
+                else
+                    st.push_array(static_cast<
+                        std::size_t>(cur.left));
+                --depth;
+                if(fs.empty())
+                    has_cur = false;
+                else
+                    fs.pop(cur);
+            }
+        };
+
+    while(! root_done)
+    {
+        if(p == end)
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return nullptr;
+        }
+        unsigned char const ib =
+            static_cast<unsigned char>(*p++);
+
+        // "break" terminates an
+        // indefinite-length container
+        if(ib == 0xff)
+        {
+            if( ! has_cur || ! cur.indefinite ||
+                (cur.map && (cur.count & 1) != 0))
+            {
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return nullptr;
+            }
+            if(cur.map)
+                st.push_object(static_cast<
+                    std::size_t>(cur.count / 2));
+            else
+                st.push_array(static_cast<
+                    std::size_t>(cur.count));
+            --depth;
+            if(fs.empty())
+                has_cur = false;
+            else
+                fs.pop(cur);
+            complete();
+            continue;
+        }
+
+        unsigned char const major = ib >> 5;
+        unsigned char const info = ib & 0x1f;
+        bool const at_key = has_cur &&
+            cur.map && (cur.count & 1) == 0;
+
+        // map keys must be strings; tags in
+        // key position apply to the key itself
+        if( at_key && major != 2 &&
+            major != 3 && major != 6)
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return nullptr;
+        }
+
+        switch(major)
+        {
+        case 0:
+        {
+            std::uint64_t n;
+            if(! read_cbor_arg(p, end, info, n, ec))
+                return nullptr;
+            if(n <= static_cast<std::uint64_t>(
+                (std::numeric_limits<
+                    std::int64_t>::max)()))
+                st.push_int64(
+                    static_cast<std::int64_t>(n));
+            else
+                st.push_uint64(n);
+            complete();
+            break;
+        }
+        case 1:
+        {
+            std::uint64_t n;
+            if(! read_cbor_arg(p, end, info, n, ec))
+                return nullptr;
+            if(n > static_cast<std::uint64_t>(
+                (std::numeric_limits<
+                    std::int64_t>::max)()))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::number_too_large);
+                return nullptr;
+            }
+            st.push_int64(-1 -
+                static_cast<std::int64_t>(n));
+            complete();
+            break;
+        }
+        case 2:
+        case 3:
+        {
+            // byte strings are stored as
+            // strings, without transformation
+            if(info == 31)
+            {
+                // chunked string
+                for(;;)
+                {
+                    if(p == end)
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::incomplete);
+                        return nullptr;
+                    }
+                    unsigned char const cb =
+                        static_cast<
+                            unsigned char>(*p++);
+                    if(cb == 0xff)
+                        break;
+                    if( (cb >> 5) != major ||
+                        (cb & 0x1f) == 31)
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::syntax);
+                        return nullptr;
+                    }
+                    std::uint64_t n;
+                    if(! read_cbor_arg(p, end,
+                        cb & 0x1f, n, ec))
+                        return nullptr;
+                    if(n > static_cast<
+                        std::uint64_t>(end - p))
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::incomplete);
+                        return nullptr;
+                    }
+                    st.push_chars(string_view(
+                        p, static_cast<
+                            std::size_t>(n)));
+                    p += n;
+                }
+                // an empty view into the buffer,
+                // not a default-constructed one:
+                // the value stack appends the
+                // final piece with memcpy, whose
+                // source may not be null even
+                // for a zero length
+                if(at_key)
+                    st.push_key(string_view(p, 0));
+                else
+                    st.push_string(string_view(p, 0));
+            }
+            else
+            {
+                std::uint64_t n;
+                if(! read_cbor_arg(
+                    p, end, info, n, ec))
+                    return nullptr;
+                if(n > static_cast<
+                    std::uint64_t>(end - p))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::incomplete);
+                    return nullptr;
+                }
+                string_view const sv(p,
+                    static_cast<std::size_t>(n));
+                p += n;
+                if(at_key)
+                    st.push_key(sv);
+                else
+                    st.push_string(sv);
+            }
+            complete();
+            break;
+        }
+        case 4:
+        case 5:
+        {
+            bool const map = major == 5;
+            std::uint64_t n = 0;
+            bool indefinite = info == 31;
+            if(! indefinite)
+            {
+                if(! read_cbor_arg(
+                    p, end, info, n, ec))
+                    return nullptr;
+                // each element takes at least
+                // one byte, so an oversized
+                // count cannot be satisfied
+                if(n > static_cast<std::uint64_t>(
+                    end - p) / (map ? 2 : 1))
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::incomplete);
+                    return nullptr;
+                }
+                if(n == 0)
+                {
+                    if(map)
+                        st.push_object(0);
+                    else
+                        st.push_array(0);
+                    complete();
+                    break;
+                }
+            }
+            if(depth >= max_depth)
+            {
+                BOOST_JSON_FAIL(ec, error::too_deep);
+                return nullptr;
+            }
+            if(has_cur)
+                fs.push(cur);
+            cur.left = n;
+            cur.count = 0;
+            cur.map = map;
+            cur.indefinite = indefinite;
+            has_cur = true;
+            ++depth;
+            break;
+        }
+        case 6:
+        {
+            // tags are ignored; the tagged
+            // item is parsed in place
+            std::uint64_t n;
+            if(! read_cbor_arg(p, end, info, n, ec))
+                return nullptr;
+            break;
+        }
+        default:
+        {
+            switch(info)
+            {
+            case 20:
+                st.push_bool(false);
+                break;
+            case 21:
+                st.push_bool(true);
+                break;
+            case 22:
+            case 23:
+                // undefined is stored as null
+                st.push_null();
+                break;
+            case 25:
+            {
+                if(end - p < 2)
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::incomplete);
+                    return nullptr;
+                }
+                st.push_double(decode_half(
+                    detail::load_be16(p)));
+                p += 2;
+                break;
+            }
+            case 26:
+            {
+                if(end - p < 4)
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::incomplete);
+                    return nullptr;
+                }
+                std::uint32_t const bits =
+                    detail::load_be32(p);
+                p += 4;
+                float f;
+                std::memcpy(&f, &bits, sizeof(f));
+                st.push_double(f);
+                break;
+            }
+            case 27:
+            {
+                if(end - p < 8)
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::incomplete);
+                    return nullptr;
+                }
+                std::uint64_t const bits =
+                    detail::load_be64(p);
+                p += 8;
+                double d;
+                std::memcpy(&d, &bits, sizeof(d));
+                st.push_double(d);
+                break;
+            }
+            default:
+                // unassigned simple values and
+                // reserved encodings
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return nullptr;
+            }
+            complete();
+            break;
+        }
+        }
+    }
+
+    if(p != end)
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+        return nullptr;
+    }
+    return st.release();
+}
+
+value
+parse_cbor(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp)
+{
+    error_code jec;
+    value result = parse_cbor(
+        s, jec, std::move(sp));
+    ec = jec;
+    return result;
+}
+
+value
+parse_cbor(
+    string_view s,
+    storage_ptr sp)
+{
+    error_code ec;
+    auto jv = parse_cbor(
+        s, ec, std::move(sp));
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+//----------------------------------------------------------
+
+void
+cbor_serializer::
+stage(unsigned char b) noexcept
+{
+    buf_[buf_n_++] = static_cast<char>(b);
+}
+
+void
+cbor_serializer::
+stage_head(
+    unsigned char major,
+    std::uint64_t n) noexcept
+{
+    if(n < 24)
+    {
+        stage(static_cast<unsigned char>(
+            major | n));
+    }
+    else if(n < 256)
+    {
+        stage(major | 24);
+        stage(static_cast<unsigned char>(n));
+    }
+    else if(n < 65536)
+    {
+        stage(major | 25);
+        detail::store_be16(buf_ + buf_n_,
+            static_cast<std::uint16_t>(n));
+        buf_n_ += 2;
+    }
+    else if(n <= 0xffffffff)
+    {
+        stage(major | 26);
+        detail::store_be32(buf_ + buf_n_,
+            static_cast<std::uint32_t>(n));
+        buf_n_ += 4;
+    }
+    else
+    {
+        stage(major | 27);
+        detail::store_be64(buf_ + buf_n_, n);
+        buf_n_ += 8;
+    }
+}
+
+void
+cbor_serializer::
+emit(value const& jv)
+{
+    switch(jv.kind())
+    {
+    case kind::null:
+        stage(0xf6);
+        break;
+    case kind::bool_:
+        stage(jv.get_bool() ? 0xf5 : 0xf4);
+        break;
+    case kind::int64:
+    {
+        std::int64_t const v = jv.get_int64();
+        if(v >= 0)
+            stage_head(0x00,
+                static_cast<std::uint64_t>(v));
+        else
+            stage_head(0x20,
+                ~static_cast<std::uint64_t>(v));
+        break;
+    }
+    case kind::uint64:
+        stage_head(0x00, jv.get_uint64());
+        break;
+    case kind::double_:
+    {
+        stage(0xfb);
+        std::uint64_t bits;
+        double const d = jv.get_double();
+        std::memcpy(&bits, &d, sizeof(bits));
+        detail::store_be64(buf_ + buf_n_, bits);
+        buf_n_ += 8;
+        break;
+    }
+    case kind::string:
+    {
+        auto const& js = jv.get_string();
+        stage_head(0x60, js.size());
+        pay_ = js.data();
+        pay_n_ = js.size();
+        break;
+    }
+    case kind::array:
+    {
+        auto const& ja = jv.get_array();
+        stage_head(0x80, ja.size());
+        if(! ja.empty())
+        {
+            if(has_cur_)
+                st_.push(cur_);
+            cur_.it = ja.data();
+            cur_.end = ja.data() + ja.size();
+            cur_.object = false;
+            cur_.key_done = false;
+            has_cur_ = true;
+        }
+        break;
+    }
+    default:
+    {
+        auto const& jo = jv.get_object();
+        stage_head(0xa0, jo.size());
+        if(! jo.empty())
+        {
+            if(has_cur_)
+                st_.push(cur_);
+            cur_.it = jo.begin();
+            cur_.end = jo.end();
+            cur_.object = true;
+            cur_.key_done = false;
+            has_cur_ = true;
+        }
+        break;
+    }
+    }
+}
+
+void
+cbor_serializer::
+reset(value const* p) noexcept
+{
+    pj_ = p;
+    st_.clear();
+    has_cur_ = false;
+    pay_n_ = 0;
+    buf_n_ = 0;
+    buf_i_ = 0;
+    done_ = false;
+}
+
+string_view
+cbor_serializer::
+read(char* dest, std::size_t size)
+{
+    char* p = dest;
+    char* const end = dest + size;
+    while(p != end)
+    {
+        // staged header bytes
+        if(buf_i_ < buf_n_)
+        {
+            std::size_t n = buf_n_ - buf_i_;
+            if(n > static_cast<std::size_t>(
+                end - p))
+                n = end - p;
+            std::memcpy(p, buf_ + buf_i_, n);
+            p += n;
+            buf_i_ += static_cast<
+                unsigned char>(n);
+            if(buf_i_ == buf_n_)
+            {
+                buf_i_ = 0;
+                buf_n_ = 0;
+            }
+            continue;
+        }
+        // string payload
+        if(pay_n_ > 0)
+        {
+            std::size_t n = pay_n_;
+            if(n > static_cast<std::size_t>(
+                end - p))
+                n = end - p;
+            std::memcpy(p, pay_, n);
+            p += n;
+            pay_ += n;
+            pay_n_ -= n;
+            continue;
+        }
+        // the root item
+        if(pj_)
+        {
+            value const* jv = pj_;
+            pj_ = nullptr;
+            emit(*jv);
+            continue;
+        }
+        if(! has_cur_)
+        {
+            done_ = true;
+            break;
+        }
+        if(cur_.object)
+        {
+            auto it = static_cast<
+                key_value_pair const*>(cur_.it);
+            if(it == cur_.end)
+            {
+                if(st_.empty())
+                    has_cur_ = false;
+                else
+                    st_.pop(cur_);
+            }
+            else if(! cur_.key_done)
+            {
+                string_view const key = it->key();
+                stage_head(0x60, key.size());
+                pay_ = key.data();
+                pay_n_ = key.size();
+                cur_.key_done = true;
+            }
+            else
+            {
+                cur_.key_done = false;
+                cur_.it = it + 1;
+                emit(it->value());
+            }
+        }
+        else
+        {
+            auto it = static_cast<
+                value const*>(cur_.it);
+            if(it == cur_.end)
+            {
+                if(st_.empty())
+                    has_cur_ = false;
+                else
+                    st_.pop(cur_);
+            }
+            else
+            {
+                cur_.it = it + 1;
+                emit(*it);
+            }
+        }
+    }
+    return string_view(dest,
+        static_cast<std::size_t>(p - dest));
+}
+
+std::string
+serialize_cbor(value const& jv)
+{
+    std::string s;
+    cbor_serializer sr;
+    sr.reset(&jv);
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    while(! sr.done())
+    {
+        string_view const sv = sr.read(buf);
+        s.append(sv.data(), sv.size());
+    }
+    return s;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
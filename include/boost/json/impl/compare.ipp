@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_COMPARE_IPP
+#define BOOST_JSON_IMPL_COMPARE_IPP
+
+#include <boost/json/compare.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// Compare a slice of array elements; clear
+// `result` on the first mismatch so the other
+// workers can stop early.
+void
+equal_elements(
+    value const* first,
+    std::size_t n,
+    value const* other,
+    std::atomic<bool>& result) noexcept
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(! result.load(
+                std::memory_order_relaxed))
+            return;
+        if(! (first[i] == other[i]))
+        {
+            result.store(false,
+                std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+// Compare a slice of object members against the
+// other object; lookups by key make the result
+// independent of element order, like object's
+// operator==.
+void
+equal_members(
+    key_value_pair const* first,
+    std::size_t n,
+    object const& other,
+    std::atomic<bool>& result) noexcept
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(! result.load(
+                std::memory_order_relaxed))
+            return;
+        auto it = other.find(first[i].key());
+        if(it == other.end() ||
+            ! (it->value() == first[i].value()))
+        {
+            result.store(false,
+                std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+// the state shared by one batch of chunk
+// comparisons; chunk i covers the half-open
+// element range [first(i), first(i) + len(i)).
+template<class F>
+struct equal_job
+{
+    F const* f;
+    std::size_t per;
+    std::size_t extra;
+    std::atomic<bool> result;
+    std::vector<std::exception_ptr> exceptions;
+
+    static
+    void
+    run(void* arg, std::size_t i)
+    {
+        auto& j = *static_cast<
+            equal_job*>(arg);
+#ifndef BOOST_NO_EXCEPTIONS
+        try
+#endif
+        {
+            std::size_t const len =
+                j.per + (i < j.extra ? 1 : 0);
+            std::size_t const first =
+                i * j.per +
+                (i < j.extra ? i : j.extra);
+            (*j.f)(first, len, j.result);
+        }
+#ifndef BOOST_NO_EXCEPTIONS
+        catch(...)
+        {
+            j.exceptions[i] =
+                std::current_exception();
+        }
+#endif
+    }
+};
+
+template<class F>
+bool
+equal_chunked(
+    std::size_t size,
+    std::size_t chunks,
+    executor* ex,
+    F const& f)
+{
+    equal_job<F> j;
+    j.f = &f;
+    j.per = size / chunks;
+    j.extra = size % chunks;
+    j.result.store(true);
+    j.exceptions.resize(chunks);
+
+    detail::parallel_run(ex, chunks,
+        &equal_job<F>::run, &j);
+
+    for(auto& ep : j.exceptions)
+        if(ep)
+            std::rethrow_exception(ep);
+
+    return j.result.load();
+}
+
+bool
+equal_impl(
+    value const& lhs,
+    value const& rhs,
+    std::size_t n,
+    executor* ex)
+{
+    if(n > 1 &&
+        lhs.is_array() && rhs.is_array())
+    {
+        array const& la = lhs.get_array();
+        array const& ra = rhs.get_array();
+        if(la.size() != ra.size())
+            return false;
+        if(n > la.size())
+            n = la.size();
+        if(n > 1)
+            return equal_chunked(
+                la.size(), n, ex,
+                [&la, &ra](
+                    std::size_t first,
+                    std::size_t len,
+                    std::atomic<bool>& result)
+                {
+                    equal_elements(
+                        la.data() + first, len,
+                        ra.data() + first,
+                        result);
+                });
+    }
+    else if(n > 1 &&
+        lhs.is_object() && rhs.is_object())
+    {
+        object const& lo = lhs.get_object();
+        object const& ro = rhs.get_object();
+        if(lo.size() != ro.size())
+            return false;
+        if(n > lo.size())
+            n = lo.size();
+        if(n > 1)
+            return equal_chunked(
+                lo.size(), n, ex,
+                [&lo, &ro](
+                    std::size_t first,
+                    std::size_t len,
+                    std::atomic<bool>& result)
+                {
+                    equal_members(
+                        lo.begin() + first, len,
+                        ro, result);
+                });
+    }
+
+    return lhs == rhs;
+}
+
+} // (anon)
+
+bool
+equal(
+    value const& lhs,
+    value const& rhs,
+    unsigned threads)
+{
+    std::size_t n = threads == 0 ? 1 : threads;
+    unsigned const hw =
+        std::thread::hardware_concurrency();
+    if(hw != 0 && n > hw)
+        n = hw;
+    return equal_impl(lhs, rhs, n, nullptr);
+}
+
+bool
+equal(
+    value const& lhs,
+    value const& rhs,
+    executor& ex)
+{
+    std::size_t n = ex.concurrency();
+    if(n == 0)
+        n = 1;
+    return equal_impl(lhs, rhs, n, &ex);
+}
+
+std::size_t
+hash_value(
+    value const& jv,
+    std::size_t seed) noexcept
+{
+    boost::hash_combine( seed, jv );
+    return seed;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_DISPOSER_IPP
+#define BOOST_JSON_IMPL_DISPOSER_IPP
+
+#include <boost/json/disposer.hpp>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// containers go back on the work list;
+// everything else is destroyed on the spot
+bool
+disposer_needs_slicing(
+    value const& jv) noexcept
+{
+    if(jv.is_array())
+        return ! jv.get_array().empty();
+    if(jv.is_object())
+        return ! jv.get_object().empty();
+    return false;
+}
+
+} // (anon)
+
+void
+disposer::
+adopt(value&& jv)
+{
+    // moving pilfers the contents without
+    // regard to storage; the local is the
+    // new owner
+    value local(std::move(jv));
+
+    // resources which do not deallocate
+    // never walk their contents
+    if(local.storage().
+        is_not_shared_and_deallocate_is_trivial())
+        return;
+
+    if(disposer_needs_slicing(local))
+        work_.push_back(std::move(local));
+
+    // otherwise the value dies here; a
+    // scalar, string, or empty container
+    // destroys in constant time
+}
+
+bool
+disposer::
+step(std::size_t n)
+{
+    while(n > 0 && ! work_.empty())
+    {
+        if(work_.back().is_array())
+        {
+            array& a =
+                work_.back().get_array();
+            if(a.empty())
+            {
+                // just the shell remains
+                work_.pop_back();
+                --n;
+                continue;
+            }
+            // move construction is used
+            // because move assignment would
+            // copy across storages
+            value child(std::move(a.back()));
+            a.pop_back();
+            --n;
+            if(disposer_needs_slicing(child))
+                work_.push_back(
+                    std::move(child));
+            continue;
+        }
+        if(work_.back().is_object())
+        {
+            object& o =
+                work_.back().get_object();
+            if(o.empty())
+            {
+                work_.pop_back();
+                --n;
+                continue;
+            }
+            auto const it = o.end() - 1;
+            value child(
+                std::move(it->value()));
+            o.erase(it);
+            --n;
+            if(disposer_needs_slicing(child))
+                work_.push_back(
+                    std::move(child));
+            continue;
+        }
+        work_.pop_back();
+        --n;
+    }
+    return work_.empty();
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
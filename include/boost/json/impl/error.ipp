@@ -58,10 +58,14 @@ case error::key_too_large: return "key too large";
 case error::string_too_large: return "string too large";
 case error::number_too_large: return "number too large";
 case error::input_error: return "input error";
+case error::output_error: return "output error";
+case error::output_limit: return "output limit exceeded";
+case error::canceled: return "parse canceled";
 
 case error::exception: return "got exception";
 case error::out_of_range: return "out of range";
 case error::test_failure: return "test failure";
+case error::not_enough_memory: return "not enough memory";
 
 case error::missing_slash: return "missing slash character";
 case error::invalid_escape: return "invalid escape sequence";
@@ -85,6 +89,12 @@ case error::not_integer: return "value is not integer";
 case error::size_mismatch: return "source composite size does not match target size";
 case error::exhausted_variants: return "exhausted all variants";
 case error::unknown_name: return "unknown name";
+
+case error::invalid_path: return "invalid JSONPath query";
+
+case error::duplicate_key: return "duplicate key";
+
+case error::invalid_patch: return "invalid patch document";
     }
 }
 
@@ -117,10 +127,13 @@ case error::key_too_large:
 case error::string_too_large:
 case error::number_too_large:
 case error::input_error:
+case error::canceled:
+case error::duplicate_key:
     return condition::parse_error;
 
 case error::missing_slash:
 case error::invalid_escape:
+case error::invalid_path:
     return condition::pointer_parse_error;
 
 case error::token_not_number:
@@ -148,6 +161,10 @@ case error::unknown_name:
 
 case error::exception:
 case error::out_of_range:
+case error::not_enough_memory:
+case error::output_error:
+case error::output_limit:
+case error::invalid_patch:
     return condition::generic_error;
     }
 }
@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_ESCAPE_IPP
+#define BOOST_JSON_IMPL_ESCAPE_IPP
+
+#include <boost/json/escape.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+// maps characters requiring an escape to
+// the escape letter, or 'u' for \u00XX form
+static constexpr char escape_table_[] =
+    "uuuuuuuubtnufruuuuuuuuuuuuuuuuuu"
+    "\0\0\"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\\\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
+
+std::size_t
+escape(
+    string_view s,
+    char* dest) noexcept
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    char const* p = s.data();
+    std::size_t remain = s.size();
+    char* d = dest;
+    while(remain)
+    {
+        // copy the run which needs no escapes
+        auto const n =
+            detail::count_unescaped(p, remain);
+        if(n)
+        {
+            std::memcpy(d, p, n);
+            d += n;
+            p += n;
+            remain -= n;
+            if(! remain)
+                break;
+        }
+        auto const uc = static_cast<
+            unsigned char>(*p);
+        auto const c = escape_table_[uc];
+        if(! c)
+        {
+            // the vectorized scan can stop
+            // short of a special character
+            *d++ = *p++;
+            --remain;
+            continue;
+        }
+        *d++ = '\\';
+        if(c != 'u')
+        {
+            *d++ = c;
+        }
+        else
+        {
+            d[0] = 'u';
+            d[1] = '0';
+            d[2] = '0';
+            d[3] = hex[uc >> 4];
+            d[4] = hex[uc & 15];
+            d += 5;
+        }
+        ++p;
+        --remain;
+    }
+    return d - dest;
+}
+
+std::size_t
+escaped_size(
+    string_view s) noexcept
+{
+    char const* p = s.data();
+    std::size_t remain = s.size();
+    std::size_t total = 0;
+    while(remain)
+    {
+        auto const n =
+            detail::count_unescaped(p, remain);
+        total += n;
+        p += n;
+        remain -= n;
+        if(! remain)
+            break;
+        auto const c = escape_table_[static_cast<
+            unsigned char>(*p)];
+        total += c == 0 ? 1 :
+            c == 'u' ? 6 : 2;
+        ++p;
+        --remain;
+    }
+    return total;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
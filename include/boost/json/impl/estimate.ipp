@@ -0,0 +1,274 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_ESTIMATE_IPP
+#define BOOST_JSON_IMPL_ESTIMATE_IPP
+
+#include <boost/json/estimate.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/value.hpp>
+#include <boost/json/detail/digest.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/string_impl.hpp>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+/*  Replays the allocations the value builder
+    would make against a simulated arena cursor,
+    without building anything. Strings and keys
+    are charged as they complete and container
+    tables when they close, which is the order
+    the builder allocates in, so the alignment
+    padding of a resource which satisfies
+    requests from a contiguous buffer is
+    reproduced exactly.
+*/
+class estimate_handler
+{
+    std::size_t bytes_ = 0;
+    std::size_t num_len_ = 0;
+    bool raw_numbers_;
+    bool split_ = false;
+    std::string chars_;
+
+    // mirrors the builder's key reuse table:
+    // with a trivial-deallocate resource a key
+    // equal to a cached one shares its
+    // allocation instead of making a new one.
+    // only unsplit keys participate, as in the
+    // builder.
+    struct key_entry
+    {
+        std::string text;
+        bool used = false;
+    };
+    key_entry keys_[64];
+
+    void
+    charge(
+        std::size_t n,
+        std::size_t align) noexcept
+    {
+        bytes_ = (bytes_ + align - 1) &
+            ~(align - 1);
+        bytes_ += n;
+    }
+
+    void
+    charge_string(std::size_t n)
+    {
+        using detail::string_impl;
+        if(n <= string_impl::sbo_chars())
+            return;
+        // the builder sizes the buffer with
+        // two growth steps: one for the
+        // assignment, one inside the
+        // reallocation
+        auto const cap = string_impl::growth(
+            string_impl::growth(n,
+                string_impl::sbo_chars()),
+            string_impl::sbo_chars() + 1);
+        charge(string_impl::table_size() +
+            cap + 1, alignof(std::uint32_t));
+    }
+
+public:
+    static constexpr std::size_t
+        max_object_size = object::max_size();
+
+    static constexpr std::size_t
+        max_array_size = array::max_size();
+
+    static constexpr std::size_t
+        max_key_size = string::max_size();
+
+    static constexpr std::size_t
+        max_string_size = string::max_size();
+
+    explicit
+    estimate_handler(
+        bool raw_numbers) noexcept
+        : raw_numbers_(raw_numbers)
+    {
+    }
+
+    std::size_t
+    bytes() const noexcept
+    {
+        return bytes_;
+    }
+
+    bool on_document_begin(error_code&) { return true; }
+    bool on_document_end(error_code&) { return true; }
+    bool on_object_begin(error_code&) { return true; }
+    bool on_object_end(std::size_t n, error_code&)
+    {
+        if(n == 0)
+            return true;
+        // the element slab, and for tables
+        // which use the hash index also the
+        // hash cache, bucket index, and
+        // fragment metadata
+        std::size_t per =
+            sizeof(key_value_pair);
+        if(n > detail::small_object_size_)
+            per += sizeof(std::size_t) +
+                sizeof(std::uint32_t) +
+                sizeof(std::uint16_t);
+        charge(detail::access::
+            table_size<object>() + n * per,
+            alignof(std::max_align_t));
+        return true;
+    }
+    bool on_array_begin(error_code&) { return true; }
+    bool on_array_end(std::size_t n, error_code&)
+    {
+        if(n != 0)
+            charge(detail::access::
+                table_size<array>() +
+                    n * sizeof(value),
+                alignof(value));
+        return true;
+    }
+    bool on_key_part(string_view s, std::size_t, error_code&)
+    {
+        chars_.append(s.data(), s.size());
+        split_ = true;
+        return true;
+    }
+    bool on_key(string_view s, std::size_t n, error_code&)
+    {
+        if(split_)
+        {
+            // split keys bypass the reuse
+            // table and always allocate
+            charge(n + 1, 1);
+            split_ = false;
+            chars_.clear();
+            return true;
+        }
+        auto& e = keys_[detail::digest(
+            s.begin(), s.end(), 0) & 63];
+        if(e.used && e.text.size() == n &&
+            std::memcmp(e.text.data(),
+                s.data(), n) == 0)
+            return true;
+        charge(n + 1, 1);
+        e.used = true;
+        e.text.assign(s.data(), n);
+        return true;
+    }
+    bool on_string_part(string_view, std::size_t, error_code&)
+    {
+        split_ = true;
+        return true;
+    }
+    bool on_string(string_view, std::size_t n, error_code&)
+    {
+        charge_string(n);
+        split_ = false;
+        return true;
+    }
+    bool on_number_part(string_view s, error_code&)
+    {
+        if(raw_numbers_)
+            num_len_ += s.size();
+        return true;
+    }
+    bool on_int64(std::int64_t, string_view s, error_code&)
+    {
+        return on_number(s);
+    }
+    bool on_uint64(std::uint64_t, string_view s, error_code&)
+    {
+        return on_number(s);
+    }
+    bool on_double(double, string_view s, error_code&)
+    {
+        return on_number(s);
+    }
+    bool on_bool(bool, error_code&) { return true; }
+    bool on_null(error_code&) { return true; }
+    bool on_comment_part(string_view, error_code&) { return true; }
+    bool on_comment(string_view, error_code&) { return true; }
+
+private:
+    bool
+    on_number(string_view s)
+    {
+        if(raw_numbers_)
+        {
+            // stored as a string holding the
+            // pre-formatted numeral
+            charge_string(
+                num_len_ + s.size());
+            num_len_ = 0;
+        }
+        return true;
+    }
+};
+
+} // (anon)
+
+std::size_t
+estimate_storage(
+    string_view doc,
+    error_code& ec,
+    parse_options const& opt)
+{
+    ec = {};
+    basic_parser<estimate_handler> p(
+        opt, opt.raw_numbers);
+    std::size_t const n = p.write_some(
+        false, doc.data(), doc.size(), ec);
+    if(! ec && n < doc.size())
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+    }
+    if(ec.failed())
+        return 0;
+    return p.handler().bytes();
+}
+
+std::size_t
+estimate_storage(
+    string_view doc,
+    std::error_code& ec,
+    parse_options const& opt)
+{
+    error_code jec;
+    auto const result =
+        estimate_storage(doc, jec, opt);
+    ec = jec;
+    return result;
+}
+
+std::size_t
+estimate_storage(
+    string_view doc,
+    parse_options const& opt)
+{
+    error_code ec;
+    auto const result =
+        estimate_storage(doc, ec, opt);
+    if(ec.failed())
+        detail::throw_system_error( ec );
+    return result;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
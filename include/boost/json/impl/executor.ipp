@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_EXECUTOR_IPP
+#define BOOST_JSON_IMPL_EXECUTOR_IPP
+
+#include <boost/json/executor.hpp>
+#include <atomic>
+
+#if defined(__linux__)
+# include <cstdio>
+# include <cstdlib>
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+namespace boost {
+namespace json {
+
+#if defined(__linux__)
+
+// fill `set` with the processors of a NUMA
+// node by parsing the kernel's cpulist for it,
+// e.g. "0-7,16-23"; returns false when the
+// node does not exist
+static
+bool
+read_node_cpus(
+    int node,
+    cpu_set_t& set) noexcept
+{
+    char path[64];
+    std::snprintf(path, sizeof(path),
+        "/sys/devices/system/node/node%d/cpulist",
+        node);
+    std::FILE* f = std::fopen(path, "r");
+    if(! f)
+        return false;
+    char buf[512];
+    auto const n = std::fread(
+        buf, 1, sizeof(buf) - 1, f);
+    std::fclose(f);
+    buf[n] = 0;
+    CPU_ZERO(&set);
+    bool any = false;
+    char* p = buf;
+    while(*p >= '0' && *p <= '9')
+    {
+        long const lo = std::strtol(p, &p, 10);
+        long hi = lo;
+        if(*p == '-')
+            hi = std::strtol(p + 1, &p, 10);
+        for(long c = lo; c <= hi &&
+                c < CPU_SETSIZE; ++c)
+        {
+            CPU_SET(c, &set);
+            any = true;
+        }
+        if(*p != ',')
+            break;
+        ++p;
+    }
+    return any;
+}
+
+#endif
+
+// one batch of chunk functions; lives on the
+// stack of do_run, which cannot return until
+// claimers is zero.
+struct thread_pool::job
+{
+    function_type fn;
+    void* arg;
+    std::size_t count;
+    std::atomic<std::size_t> next;
+    std::atomic<std::size_t> remain;
+    std::size_t claimers = 0;
+};
+
+thread_pool::
+thread_pool(unsigned threads)
+    : thread_pool(threads, -1)
+{
+}
+
+thread_pool::
+thread_pool(
+    unsigned threads,
+    int numa_node)
+{
+#if defined(__linux__)
+    cpu_set_t node_cpus;
+    bool const pin = numa_node >= 0 &&
+        read_node_cpus(numa_node, node_cpus);
+    if(threads == 0 && pin)
+        threads = CPU_COUNT(&node_cpus);
+#else
+    (void)numa_node;
+#endif
+    if(threads == 0)
+    {
+        threads = std::thread::
+            hardware_concurrency();
+        if(threads == 0)
+            threads = 1;
+    }
+    threads_.reserve(threads - 1);
+    for(unsigned i = 1; i < threads; ++i)
+        threads_.emplace_back(
+            [this]
+            {
+                std::size_t last = 0;
+                for(;;)
+                {
+                    job* j;
+                    {
+                        std::unique_lock<
+                            std::mutex> lock(m_);
+                        work_cv_.wait(lock,
+                            [this, last]
+                            {
+                                return stop_ || (
+                                    job_ != nullptr &&
+                                    generation_ != last);
+                            });
+                        if(stop_)
+                            return;
+                        last = generation_;
+                        j = job_;
+                        ++j->claimers;
+                    }
+                    work(*j);
+                }
+            });
+#if defined(__linux__)
+    if(pin)
+        for(auto& t : threads_)
+            ::pthread_setaffinity_np(
+                t.native_handle(),
+                sizeof(node_cpus), &node_cpus);
+#endif
+}
+
+thread_pool::
+~thread_pool()
+{
+    {
+        std::lock_guard<
+            std::mutex> lock(m_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for(auto& t : threads_)
+        t.join();
+}
+
+// claim and execute chunk indices until the
+// batch is drained, then sign off.
+void
+thread_pool::
+work(job& j) noexcept
+{
+    for(;;)
+    {
+        std::size_t const i =
+            j.next.fetch_add(1,
+                std::memory_order_relaxed);
+        if(i >= j.count)
+            break;
+        j.fn(j.arg, i);
+        j.remain.fetch_sub(1,
+            std::memory_order_release);
+    }
+    bool notify;
+    {
+        std::lock_guard<
+            std::mutex> lock(m_);
+        --j.claimers;
+        notify = j.claimers == 0 &&
+            j.remain.load(
+                std::memory_order_acquire) == 0;
+    }
+    if(notify)
+        done_cv_.notify_one();
+}
+
+void
+thread_pool::
+do_run(
+    std::size_t count,
+    function_type fn,
+    void* arg)
+{
+    if(count == 0)
+        return;
+    if(threads_.empty() || count == 1)
+    {
+        for(std::size_t i = 0;
+            i < count; ++i)
+            fn(arg, i);
+        return;
+    }
+
+    job j;
+    j.fn = fn;
+    j.arg = arg;
+    j.count = count;
+    j.next.store(0);
+    j.remain.store(count);
+    {
+        std::lock_guard<
+            std::mutex> lock(m_);
+        job_ = &j;
+        ++generation_;
+        j.claimers = 1; // ourselves
+    }
+    work_cv_.notify_all();
+    work(j);
+    {
+        std::unique_lock<
+            std::mutex> lock(m_);
+        done_cv_.wait(lock,
+            [&j]
+            {
+                return j.claimers == 0 &&
+                    j.remain.load() == 0;
+            });
+        job_ = nullptr;
+    }
+}
+
+unsigned
+thread_pool::
+do_concurrency() const noexcept
+{
+    return static_cast<unsigned>(
+        threads_.size() + 1);
+}
+
+//----------------------------------------------------------
+
+namespace detail {
+
+void
+parallel_run(
+    executor* ex,
+    std::size_t count,
+    executor::function_type fn,
+    void* arg)
+{
+    if(ex)
+    {
+        ex->run(count, fn, arg);
+        return;
+    }
+    if(count == 0)
+        return;
+    if(count == 1)
+    {
+        fn(arg, 0);
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(count - 1);
+    for(std::size_t i = 1; i < count; ++i)
+        threads.emplace_back(fn, arg, i);
+    fn(arg, 0);
+    for(auto& t : threads)
+        t.join();
+}
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+#endif
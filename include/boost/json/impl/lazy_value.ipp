@@ -0,0 +1,525 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_LAZY_VALUE_IPP
+#define BOOST_JSON_IMPL_LAZY_VALUE_IPP
+
+#include <boost/json/lazy_value.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/fast_parser.hpp>
+#include <cstring>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+
+// defined in pointer.ipp
+string_view
+next_segment(
+    string_view& sv,
+    error_code& ec) noexcept;
+
+std::size_t
+parse_number_token(
+    string_view sv,
+    error_code& ec) noexcept;
+
+} // namespace detail
+
+namespace {
+
+// compare a raw key from the JSON text against a
+// pointer token, decoding backslash escapes in the
+// key and '~' escapes in the token
+bool
+key_equal(
+    string_view key,
+    string_view token) noexcept
+{
+    char const* k = key.data();
+    char const* const ke = k + key.size();
+    char const* t = token.data();
+    char const* const te = t + token.size();
+    while(k != ke)
+    {
+        // decode the next key character,
+        // which may expand to several bytes
+        char buf[4];
+        std::size_t n = 0;
+        char const c = *k++;
+        if(c != '\\')
+        {
+            buf[n++] = c;
+        }
+        else
+        {
+            if(k == ke)
+                return false;
+            switch(*k++)
+            {
+            case '\x22': buf[n++] = '\x22'; break;
+            case '\\': buf[n++] = '\\'; break;
+            case '/': buf[n++] = '/'; break;
+            case 'b': buf[n++] = '\x08'; break;
+            case 'f': buf[n++] = '\x0c'; break;
+            case 'n': buf[n++] = '\x0a'; break;
+            case 'r': buf[n++] = '\x0d'; break;
+            case 't': buf[n++] = '\x09'; break;
+            case 'u':
+            {
+                if(ke - k < 4)
+                    return false;
+                int const d1 = detail::hex_digit(
+                    static_cast<unsigned char>(k[0]));
+                int const d2 = detail::hex_digit(
+                    static_cast<unsigned char>(k[1]));
+                int const d3 = detail::hex_digit(
+                    static_cast<unsigned char>(k[2]));
+                int const d4 = detail::hex_digit(
+                    static_cast<unsigned char>(k[3]));
+                if((d1 | d2 | d3 | d4) == -1)
+                    return false;
+                unsigned cp =
+                    (d1 << 12) + (d2 << 8) +
+                    (d3 << 4) + d4;
+                k += 4;
+                if(cp >= 0xd800 && cp <= 0xdfff)
+                {
+                    if(cp > 0xdbff)
+                        return false;
+                    if(ke - k < 6 ||
+                        k[0] != '\\' || k[1] != 'u')
+                        return false;
+                    k += 2;
+                    int const e1 = detail::hex_digit(
+                        static_cast<unsigned char>(k[0]));
+                    int const e2 = detail::hex_digit(
+                        static_cast<unsigned char>(k[1]));
+                    int const e3 = detail::hex_digit(
+                        static_cast<unsigned char>(k[2]));
+                    int const e4 = detail::hex_digit(
+                        static_cast<unsigned char>(k[3]));
+                    if((e1 | e2 | e3 | e4) == -1)
+                        return false;
+                    unsigned const u2 =
+                        (e1 << 12) + (e2 << 8) +
+                        (e3 << 4) + e4;
+                    if(u2 < 0xdc00 || u2 > 0xdfff)
+                        return false;
+                    k += 4;
+                    cp = ((cp - 0xd800) << 10) +
+                        (u2 - 0xdc00) + 0x10000;
+                }
+                if(cp < 0x80)
+                {
+                    buf[n++] = static_cast<char>(cp);
+                }
+                else if(cp < 0x800)
+                {
+                    buf[n++] = static_cast<char>(
+                        (cp >> 6) | 0xc0);
+                    buf[n++] = static_cast<char>(
+                        (cp & 0x3f) | 0x80);
+                }
+                else if(cp < 0x10000)
+                {
+                    buf[n++] = static_cast<char>(
+                        (cp >> 12) | 0xe0);
+                    buf[n++] = static_cast<char>(
+                        ((cp >> 6) & 0x3f) | 0x80);
+                    buf[n++] = static_cast<char>(
+                        (cp & 0x3f) | 0x80);
+                }
+                else
+                {
+                    buf[n++] = static_cast<char>(
+                        (cp >> 18) | 0xf0);
+                    buf[n++] = static_cast<char>(
+                        ((cp >> 12) & 0x3f) | 0x80);
+                    buf[n++] = static_cast<char>(
+                        ((cp >> 6) & 0x3f) | 0x80);
+                    buf[n++] = static_cast<char>(
+                        (cp & 0x3f) | 0x80);
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+
+        // match against the token
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(t == te)
+                return false;
+            char tc = *t++;
+            if(tc == '~')
+            {
+                if(t == te)
+                    return false;
+                tc = (*t++ == '0') ? '~' : '/';
+            }
+            if(tc != buf[i])
+                return false;
+        }
+    }
+    return t == te;
+}
+
+// resolves a JSON Pointer against the structural
+// index without materializing skipped values
+class lazy_walker
+{
+    string_view text_;
+    std::vector<std::size_t> const& idx_;
+
+    char
+    tok(std::size_t i) const noexcept
+    {
+        return text_[idx_[i]];
+    }
+
+    // find the idx position just past the value
+    // whose first token is at position i. for
+    // scalars, which have no tokens of their own,
+    // after == i and the token at i terminates
+    // the value.
+    bool
+    skip_value(
+        std::size_t i,
+        std::size_t& after,
+        error_code& ec) const
+    {
+        if(i >= idx_.size())
+        {
+            // trailing scalar
+            after = i;
+            return true;
+        }
+        switch(tok(i))
+        {
+        case '\x22':
+            if(i + 1 >= idx_.size())
+            {
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return false;
+            }
+            after = i + 2;
+            return true;
+        case '{':
+        case '[':
+        {
+            std::size_t depth = 0;
+            std::size_t j = i;
+            while(j < idx_.size())
+            {
+                char const c = tok(j);
+                if(c == '\x22')
+                {
+                    j += 2;
+                    continue;
+                }
+                if(c == '{' || c == '[')
+                {
+                    ++depth;
+                }
+                else if(c == '}' || c == ']')
+                {
+                    if(--depth == 0)
+                    {
+                        after = j + 1;
+                        return true;
+                    }
+                }
+                ++j;
+            }
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return false;
+        }
+        default:
+            after = i;
+            return true;
+        }
+    }
+
+public:
+    lazy_walker(
+        string_view text,
+        std::vector<std::size_t> const& idx) noexcept
+        : text_(text)
+        , idx_(idx)
+    {
+    }
+
+    // resolve the pointer and return the extent of
+    // the addressed value within the text
+    bool
+    resolve(
+        string_view ptr,
+        std::size_t& from,
+        std::size_t& to,
+        error_code& ec) const
+    {
+        // text offset where the value may begin
+        std::size_t p0 = 0;
+        // first idx position at or after p0
+        std::size_t i = 0;
+
+        auto segment =
+            detail::next_segment(ptr, ec);
+        while(! ec.failed() && ! segment.empty())
+        {
+            if(i >= idx_.size() ||
+                (tok(i) != '{' && tok(i) != '['))
+            {
+                // strings and numbers
+                // cannot be navigated into
+                BOOST_JSON_FAIL(ec,
+                    error::value_is_scalar);
+                return false;
+            }
+            if(tok(i) == '{')
+            {
+                std::size_t j = i + 1;
+                if(j < idx_.size() && tok(j) == '}')
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::not_found);
+                    return false;
+                }
+                bool found = false;
+                while(j < idx_.size())
+                {
+                    if(j + 2 >= idx_.size() ||
+                        tok(j) != '\x22' ||
+                        tok(j + 1) != '\x22' ||
+                        tok(j + 2) != ':')
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::syntax);
+                        return false;
+                    }
+                    string_view const raw =
+                        text_.substr(
+                            idx_[j] + 1,
+                            idx_[j + 1] - idx_[j] - 1);
+                    std::size_t const vi = j + 3;
+                    std::size_t const vp =
+                        idx_[j + 2] + 1;
+                    if(key_equal(raw,
+                        segment.substr(1)))
+                    {
+                        p0 = vp;
+                        i = vi;
+                        found = true;
+                        break;
+                    }
+                    std::size_t after;
+                    if(! skip_value(vi, after, ec))
+                        return false;
+                    if(after >= idx_.size())
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::incomplete);
+                        return false;
+                    }
+                    if(tok(after) == ',')
+                    {
+                        j = after + 1;
+                        continue;
+                    }
+                    if(tok(after) == '}')
+                        break;
+                    BOOST_JSON_FAIL(ec,
+                        error::syntax);
+                    return false;
+                }
+                if(! found)
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::not_found);
+                    return false;
+                }
+            }
+            else
+            {
+                std::size_t const index =
+                    detail::parse_number_token(
+                        segment, ec);
+                if(ec.failed())
+                    return false;
+                std::size_t j = i + 1;
+                std::size_t vp = idx_[i] + 1;
+                if(j < idx_.size() && tok(j) == ']')
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::not_found);
+                    return false;
+                }
+                for(std::size_t k = 0;; ++k)
+                {
+                    if(k == index)
+                    {
+                        p0 = vp;
+                        i = j;
+                        break;
+                    }
+                    std::size_t after;
+                    if(! skip_value(j, after, ec))
+                        return false;
+                    if(after >= idx_.size())
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::incomplete);
+                        return false;
+                    }
+                    if(tok(after) == ',')
+                    {
+                        vp = idx_[after] + 1;
+                        j = after + 1;
+                        continue;
+                    }
+                    if(tok(after) == ']')
+                    {
+                        BOOST_JSON_FAIL(ec,
+                            error::not_found);
+                        return false;
+                    }
+                    BOOST_JSON_FAIL(ec,
+                        error::syntax);
+                    return false;
+                }
+            }
+            segment = detail::next_segment(ptr, ec);
+        }
+        if(ec.failed())
+            return false;
+
+        // compute the extent of the final value
+        std::size_t after;
+        if(! skip_value(i, after, ec))
+            return false;
+        if(after == i)
+        {
+            // scalar; runs up to the
+            // terminating token, if any
+            from = p0;
+            to = i < idx_.size() ?
+                idx_[i] : text_.size();
+        }
+        else
+        {
+            from = idx_[i];
+            to = idx_[after - 1] + 1;
+        }
+        return true;
+    }
+};
+
+} // (anon)
+
+value
+lazy_value::
+at_pointer(
+    string_view ptr,
+    error_code& ec,
+    storage_ptr sp) const
+{
+    ec.clear();
+    std::size_t from;
+    std::size_t to;
+    lazy_walker const w(text_, idx_);
+    if(! w.resolve(ptr, from, to, ec))
+        return nullptr;
+    return detail::fast_parse(
+        text_.substr(from, to - from),
+        ec, std::move(sp), opt_);
+}
+
+value
+lazy_value::
+at_pointer(
+    string_view ptr,
+    storage_ptr sp) const
+{
+    error_code ec;
+    value jv = at_pointer(
+        ptr, ec, std::move(sp));
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+value
+lazy_value::
+materialize(
+    error_code& ec,
+    storage_ptr sp) const
+{
+    ec.clear();
+    return detail::fast_parse(
+        text_, idx_, ec,
+        std::move(sp), opt_);
+}
+
+value
+lazy_value::
+materialize(
+    storage_ptr sp) const
+{
+    error_code ec;
+    value jv = materialize(
+        ec, std::move(sp));
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+lazy_value
+lazy_parse(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt)
+{
+    ec.clear();
+    // lazy documents only support
+    // strict JSON extensions-wise
+    parse_options o(opt);
+    o.allow_comments = false;
+    o.allow_trailing_commas = false;
+    o.allow_infinity_and_nan = false;
+    o.full_buffer_fast_path = true;
+
+    std::vector<std::size_t> idx;
+    if(! detail::build_index(s, idx, ec))
+        return {};
+    return lazy_value(
+        s, std::move(idx), o);
+}
+
+lazy_value
+lazy_parse(
+    string_view s,
+    parse_options const& opt)
+{
+    error_code ec;
+    lazy_value doc = lazy_parse(s, ec, opt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return doc;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
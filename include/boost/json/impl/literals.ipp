@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_LITERALS_IPP
+#define BOOST_JSON_IMPL_LITERALS_IPP
+
+#include <boost/json/literals.hpp>
+#include <boost/json/parse.hpp>
+
+namespace boost {
+namespace json {
+
+static_value::
+~static_value()
+{
+    delete jv_.load(
+        std::memory_order_acquire);
+}
+
+value const&
+static_value::
+get() const
+{
+    auto jv = jv_.load(
+        std::memory_order_acquire);
+    if(! jv)
+    {
+        value* const p = new value(
+            parse(string_view(s_, n_)));
+        if(jv_.compare_exchange_strong(
+            jv, p,
+            std::memory_order_acq_rel,
+            std::memory_order_acquire))
+        {
+            jv = p;
+        }
+        else
+        {
+            // another thread parsed
+            // first; adopt its tree
+            delete p;
+        }
+    }
+    return *jv;
+}
+
+namespace literals {
+
+value
+operator""_json(
+    char const* s,
+    std::size_t n)
+{
+    return parse(string_view(s, n));
+}
+
+} // namespace literals
+
+} // namespace json
+} // namespace boost
+
+#endif
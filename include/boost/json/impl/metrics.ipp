@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_METRICS_IPP
+#define BOOST_JSON_IMPL_METRICS_IPP
+
+#include <boost/json/metrics.hpp>
+#include <atomic>
+#include <chrono>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// one histogram pair per metrics_op; the
+// counters are constant-initialized so that
+// recording is safe before main
+struct metrics_counters
+{
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> bytes_sum;
+    std::atomic<std::uint64_t> ns_sum;
+    std::atomic<std::uint64_t> bytes_buckets[64];
+    std::atomic<std::uint64_t> ns_buckets[64];
+};
+
+metrics_counters counters[3] = {};
+
+// index of the half-open power-of-two range
+// containing v: 0 for zero, otherwise one
+// past the position of the highest set bit
+unsigned
+bucket_of(std::uint64_t v) noexcept
+{
+    unsigned i = 0;
+    while(v != 0)
+    {
+        v >>= 1;
+        ++i;
+    }
+    return i;
+}
+
+} // (anon)
+
+metrics_snapshot
+get_metrics(metrics_op op) noexcept
+{
+    auto const& c = counters[
+        static_cast<unsigned char>(op)];
+    metrics_snapshot ms;
+    ms.bytes.count = c.count.load(
+        std::memory_order_relaxed);
+    ms.nanoseconds.count = ms.bytes.count;
+    ms.bytes.sum = c.bytes_sum.load(
+        std::memory_order_relaxed);
+    ms.nanoseconds.sum = c.ns_sum.load(
+        std::memory_order_relaxed);
+    for(unsigned i = 0; i < 64; ++i)
+    {
+        ms.bytes.buckets[i] =
+            c.bytes_buckets[i].load(
+                std::memory_order_relaxed);
+        ms.nanoseconds.buckets[i] =
+            c.ns_buckets[i].load(
+                std::memory_order_relaxed);
+    }
+    return ms;
+}
+
+void
+reset_metrics() noexcept
+{
+    for(auto& c : counters)
+    {
+        c.count.store(0,
+            std::memory_order_relaxed);
+        c.bytes_sum.store(0,
+            std::memory_order_relaxed);
+        c.ns_sum.store(0,
+            std::memory_order_relaxed);
+        for(unsigned i = 0; i < 64; ++i)
+        {
+            c.bytes_buckets[i].store(0,
+                std::memory_order_relaxed);
+            c.ns_buckets[i].store(0,
+                std::memory_order_relaxed);
+        }
+    }
+}
+
+namespace detail {
+
+std::uint64_t
+metrics_now() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<
+            std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now()
+            .time_since_epoch()).count());
+}
+
+void
+metrics_record(
+    metrics_op op,
+    std::uint64_t bytes,
+    std::uint64_t ns) noexcept
+{
+    auto& c = counters[
+        static_cast<unsigned char>(op)];
+    c.count.fetch_add(1,
+        std::memory_order_relaxed);
+    c.bytes_sum.fetch_add(bytes,
+        std::memory_order_relaxed);
+    c.ns_sum.fetch_add(ns,
+        std::memory_order_relaxed);
+    c.bytes_buckets[bucket_of(bytes)]
+        .fetch_add(1,
+            std::memory_order_relaxed);
+    c.ns_buckets[bucket_of(ns)]
+        .fetch_add(1,
+            std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -12,12 +12,21 @@
 #define BOOST_JSON_IMPL_MONOTONIC_RESOURCE_IPP
 
 #include <boost/json/monotonic_resource.hpp>
+#include <boost/json/trace.hpp>
 #include <boost/json/detail/except.hpp>
 #include <boost/align/align.hpp>
 #include <boost/core/max_align.hpp>
 
+#include <cstdint>
 #include <memory>
 
+#if defined(__linux__)
+# include <cstring>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
 namespace boost {
 namespace json {
 
@@ -65,6 +74,105 @@ next_pow2(
     return result;
 }
 
+// advise the kernel to back the range with
+// transparent huge pages; a best-effort hint
+static
+void
+advise_huge_pages(
+    void* p, std::size_t n) noexcept
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise requires page-aligned addresses,
+    // so shrink the range to page boundaries
+    std::size_t const page = 4096;
+    auto const lo =
+        (reinterpret_cast<std::uintptr_t>(p) +
+            page - 1) & ~(page - 1);
+    auto const hi =
+        (reinterpret_cast<std::uintptr_t>(p) + n)
+            & ~(page - 1);
+    if(hi > lo)
+        ::madvise(
+            reinterpret_cast<void*>(lo),
+            hi - lo, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)n;
+#endif
+}
+
+// place the range on a NUMA node, or
+// interleave it across nodes; a best-effort
+// hint like advise_huge_pages. The policy must
+// be applied before the pages are first
+// touched to have an effect.
+static
+void
+bind_numa(
+    void* p,
+    std::size_t n,
+    int node,
+    bool interleave) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // mbind requires page-aligned addresses,
+    // so shrink the range to page boundaries
+    std::size_t const page = 4096;
+    auto const lo =
+        (reinterpret_cast<std::uintptr_t>(p) +
+            page - 1) & ~(page - 1);
+    auto const hi =
+        (reinterpret_cast<std::uintptr_t>(p) + n)
+            & ~(page - 1);
+    if(hi <= lo)
+        return;
+    // MPOL_BIND = 2 and MPOL_INTERLEAVE = 3
+    // are part of the kernel ABI; using the
+    // raw syscall avoids a libnuma dependency
+    unsigned const bits =
+        8 * sizeof(unsigned long);
+    unsigned long mask[1024 / bits] = {};
+    if(interleave)
+    {
+        // the set of configured nodes is not
+        // known here; the kernel rejects masks
+        // naming nonexistent nodes, so try
+        // progressively smaller all-node masks
+        for(unsigned k = 64; k >= 2; k /= 2)
+        {
+            std::memset(mask, 0, sizeof(mask));
+            for(unsigned i = 0; i < k; ++i)
+                mask[i / bits] |=
+                    1UL << (i % bits);
+            if(0 == ::syscall(SYS_mbind,
+                reinterpret_cast<void*>(lo),
+                hi - lo, 3, mask,
+                static_cast<unsigned long>(
+                    k + 1), 0))
+                break;
+        }
+    }
+    else
+    {
+        if( node < 0 || static_cast<
+            unsigned>(node) >= 1024)
+            return;
+        mask[node / bits] =
+            1UL << (node % bits);
+        ::syscall(SYS_mbind,
+            reinterpret_cast<void*>(lo),
+            hi - lo, 2, mask,
+            static_cast<unsigned long>(
+                node + 2), 0);
+    }
+#else
+    (void)p;
+    (void)n;
+    (void)node;
+    (void)interleave;
+#endif
+}
+
 //----------------------------------------------------------
 
 monotonic_resource::
@@ -84,6 +192,29 @@ monotonic_resource(
 {
 }
 
+monotonic_resource::
+monotonic_resource(
+    growth_options const& opt,
+    storage_ptr upstream) noexcept
+    : buffer_{
+        nullptr, 0, 0, nullptr}
+    , next_size_(round_pow2(opt.initial_size))
+    , upstream_(std::move(upstream))
+    , growth_factor_(
+        opt.growth_factor < 1 ?
+            1 : opt.growth_factor)
+    , max_block_size_(opt.max_block_size)
+    , huge_pages_(opt.huge_pages)
+    , numa_node_(opt.numa_node)
+    , numa_interleave_(opt.numa_interleave)
+{
+    if(max_block_size_ < min_size_)
+        max_block_size_ = min_size_;
+    if(next_size_ > max_block_size_)
+        next_size_ = max_block_size_;
+    node_next_size_ = next_size_;
+}
+
 monotonic_resource::
 monotonic_resource(
     unsigned char* buffer,
@@ -107,49 +238,156 @@ release() noexcept
         upstream_->deallocate(p, p->size);
         p = next;
     }
+    p = node_head_;
+    while(p != &nodes_)
+    {
+        auto next = p->next;
+        upstream_->deallocate(p, p->size);
+        p = next;
+    }
     buffer_.p = reinterpret_cast<
         unsigned char*>(buffer_.p) - (
             buffer_.size - buffer_.avail);
     buffer_.avail = buffer_.size;
     head_ = &buffer_;
+    node_head_ = &nodes_;
+}
+
+auto
+monotonic_resource::
+mark() const noexcept ->
+    checkpoint
+{
+    checkpoint cp;
+    cp.head = head_;
+    cp.p = head_->p;
+    cp.avail = head_->avail;
+    cp.next_size = next_size_;
+    cp.node_head = node_head_;
+    cp.node_p = node_head_->p;
+    cp.node_avail = node_head_->avail;
+    cp.node_next_size = node_next_size_;
+    return cp;
+}
+
+void
+monotonic_resource::
+rollback(
+    checkpoint const& cp) noexcept
+{
+    auto p = head_;
+    while(p != cp.head)
+    {
+        auto next = p->next;
+        upstream_->deallocate(p, p->size);
+        p = next;
+    }
+    head_ = p;
+    head_->p = cp.p;
+    head_->avail = cp.avail;
+    next_size_ = cp.next_size;
+    p = node_head_;
+    while(p != cp.node_head)
+    {
+        auto next = p->next;
+        upstream_->deallocate(p, p->size);
+        p = next;
+    }
+    node_head_ = p;
+    node_head_->p = cp.node_p;
+    node_head_->avail = cp.node_avail;
+    node_next_size_ = cp.node_next_size;
+}
+
+// next block size in the growth progression
+std::size_t
+monotonic_resource::
+grow_size(std::size_t n) const noexcept
+{
+    if( growth_factor_ > 1 &&
+        n > max_size() / growth_factor_)
+        return max_block_size_ < max_size() ?
+            max_block_size_ : max_size();
+    n *= growth_factor_;
+    if(n > max_block_size_)
+        n = max_block_size_;
+    return n;
 }
 
 void*
 monotonic_resource::
-do_allocate(
+allocate_in(
+    block_base*& head,
+    std::size_t& next_size,
     std::size_t n,
     std::size_t align)
 {
     auto p = alignment::align(
-        align, n, head_->p, head_->avail);
+        align, n, head->p, head->avail);
     if(p)
     {
-        head_->p = reinterpret_cast<
+        head->p = reinterpret_cast<
             unsigned char*>(p) + n;
-        head_->avail -= n;
+        head->avail -= n;
         return p;
     }
 
-    if(next_size_ < n)
-        next_size_ = round_pow2(n);
+    std::size_t block_size = next_size;
+    if(block_size < n)
+    {
+        block_size = round_pow2(n);
+        // requests above the cap still get a
+        // single block of the required size
+        if( block_size > max_block_size_ &&
+            max_block_size_ >= n)
+            block_size = max_block_size_;
+    }
     auto b = ::new(upstream_->allocate(
-        sizeof(block) + next_size_)) block;
+        sizeof(block) + block_size)) block;
     b->p = b + 1;
-    b->avail = next_size_;
-    b->size = next_size_;
-    b->next = head_;
-    head_ = b;
-    next_size_ = next_pow2(next_size_);
+    b->avail = block_size;
+    b->size = block_size;
+    b->next = head;
+    head = b;
+    BOOST_JSON_TRACE_EMIT(
+        trace_event::arena_block,
+        this, block_size);
+    if(numa_interleave_ || numa_node_ >= 0)
+        bind_numa(b + 1, block_size,
+            numa_node_, numa_interleave_);
+    if(huge_pages_)
+        advise_huge_pages(b + 1, block_size);
+    next_size = grow_size(block_size);
 
     p = alignment::align(
-        align, n, head_->p, head_->avail);
+        align, n, head->p, head->avail);
     BOOST_ASSERT(p);
-    head_->p = reinterpret_cast<
+    head->p = reinterpret_cast<
         unsigned char*>(p) + n;
-    head_->avail -= n;
+    head->avail -= n;
     return p;
 }
 
+void*
+monotonic_resource::
+do_allocate(
+    std::size_t n,
+    std::size_t align)
+{
+    // in segregated mode, small fixed-size
+    // allocations such as element nodes get
+    // dedicated slabs so that they pack
+    // densely instead of interleaving with
+    // string payloads
+    if( segregate_ &&
+        n <= max_node_size_)
+        return allocate_in(
+            node_head_, node_next_size_,
+            n, align);
+    return allocate_in(
+        head_, next_size_, n, align);
+}
+
 void
 monotonic_resource::
 do_deallocate(
@@ -0,0 +1,757 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_MSGPACK_IPP
+#define BOOST_JSON_IMPL_MSGPACK_IPP
+
+#include <boost/json/msgpack.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/detail/except.hpp>
+#include <cstring>
+#include <limits>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// one open container while parsing; count holds
+// the number of items pushed so far, where each
+// map key and mapped value counts separately
+struct msgpack_parse_frame
+{
+    std::uint64_t left;
+    std::uint64_t count;
+    bool map;
+};
+
+// formats which parse to a string
+bool
+is_msgpack_str(unsigned char ib) noexcept
+{
+    return
+        (ib >= 0xa0 && ib <= 0xbf) ||   // fixstr
+        (ib >= 0xc4 && ib <= 0xc6) ||   // bin
+        (ib >= 0xd9 && ib <= 0xdb);     // str
+}
+
+} // (anon)
+
+value
+parse_msgpack(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp)
+{
+    ec = {};
+
+    unsigned char temp[
+        BOOST_JSON_STACK_BUFFER_SIZE];
+    value_stack st(
+        storage_ptr(), temp, sizeof(temp));
+    st.reset(std::move(sp));
+
+    unsigned char temp2[16 * sizeof(
+        msgpack_parse_frame)];
+    detail::stack fs(
+        storage_ptr(), temp2, sizeof(temp2));
+    msgpack_parse_frame cur = {};
+    bool has_cur = false;
+    std::size_t depth = 0;
+    std::size_t const max_depth = 32;
+
+    char const* p = s.data();
+    char const* const end = p + s.size();
+    bool root_done = false;
+
+    // called after an item is pushed; closes
+    // any containers that the item completed
+    auto const complete =
+        [&]()
+        {
+            for(;;)
+            {
+                if(! has_cur)
+                {
+                    root_done = true;
+                    return;
+                }
+                ++cur.count;
+                std::uint64_t const total = cur.map
+                    ? cur.left * 2 : cur.left;
+                if(cur.count < total)
+                    return;
+                if(cur.map)
+                    st.push_object(static_cast<
+                        std::size_t>(cur.left));
+                else
+                    st.push_array(static_cast<
+                        std::size_t>(cur.left));
+                --depth;
+                if(fs.empty())
+                    has_cur = false;
+                else
+                    fs.pop(cur);
+            }
+        };
+
+    // reads a big-endian length or integer
+    // argument of the given width
+    auto const read_arg =
+        [&](std::size_t width, std::uint64_t& n)
+        {
+            if(static_cast<std::size_t>(
+                end - p) < width)
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return false;
+            }
+            switch(width)
+            {
+            case 1:
+                n = static_cast<
+                    unsigned char>(*p);
+                break;
+            case 2:
+                n = detail::load_be16(p);
+                break;
+            case 4:
+                n = detail::load_be32(p);
+                break;
+            default:
+                n = detail::load_be64(p);
+                break;
+            }
+            p += width;
+            return true;
+        };
+
+    while(! root_done)
+    {
+        if(p == end)
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return nullptr;
+        }
+        unsigned char const ib =
+            static_cast<unsigned char>(*p++);
+        bool const at_key = has_cur &&
+            cur.map && (cur.count & 1) == 0;
+
+        // map keys must be str or bin data
+        if(at_key && ! is_msgpack_str(ib))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return nullptr;
+        }
+
+        // strings; bin data is stored as a
+        // string, without transformation
+        if(is_msgpack_str(ib))
+        {
+            std::uint64_t n;
+            if(ib >= 0xa0 && ib <= 0xbf)
+                n = ib & 0x1f;
+            else
+            {
+                std::size_t const width =
+                    ib == 0xc4 || ib == 0xd9 ? 1 :
+                    ib == 0xc5 || ib == 0xda ? 2 : 4;
+                if(! read_arg(width, n))
+                    return nullptr;
+            }
+            if(n > static_cast<
+                std::uint64_t>(end - p))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return nullptr;
+            }
+            string_view const sv(p,
+                static_cast<std::size_t>(n));
+            p += n;
+            if(at_key)
+                st.push_key(sv);
+            else
+                st.push_string(sv);
+            complete();
+            continue;
+        }
+
+        // containers
+        if( (ib >= 0x80 && ib <= 0x9f) ||
+            (ib >= 0xdc && ib <= 0xdf))
+        {
+            bool map;
+            std::uint64_t n;
+            if(ib <= 0x9f)
+            {
+                map = ib <= 0x8f;
+                n = ib & 0x0f;
+            }
+            else
+            {
+                map = ib >= 0xde;
+                if(! read_arg(
+                    ib == 0xdc || ib == 0xde
+                        ? 2 : 4, n))
+                    return nullptr;
+            }
+            // each element takes at least one
+            // byte, so an oversized count
+            // cannot be satisfied
+            if(n > static_cast<std::uint64_t>(
+                end - p) / (map ? 2 : 1))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return nullptr;
+            }
+            if(n == 0)
+            {
+                if(map)
+                    st.push_object(0);
+                else
+                    st.push_array(0);
+                complete();
+                continue;
+            }
+            if(depth >= max_depth)
+            {
+                BOOST_JSON_FAIL(ec, error::too_deep);
+                return nullptr;
+            }
+            if(has_cur)
+                fs.push(cur);
+            cur.left = n;
+            cur.count = 0;
+            cur.map = map;
+            has_cur = true;
+            ++depth;
+            continue;
+        }
+
+        // scalars
+        if(ib <= 0x7f)
+        {
+            // positive fixint
+            st.push_int64(ib);
+        }
+        else if(ib >= 0xe0)
+        {
+            // negative fixint
+            st.push_int64(static_cast<
+                std::int8_t>(ib));
+        }
+        else switch(ib)
+        {
+        case 0xc0:
+            st.push_null();
+            break;
+        case 0xc2:
+            st.push_bool(false);
+            break;
+        case 0xc3:
+            st.push_bool(true);
+            break;
+        case 0xca:
+        {
+            std::uint64_t n;
+            if(! read_arg(4, n))
+                return nullptr;
+            float f;
+            std::uint32_t const bits =
+                static_cast<std::uint32_t>(n);
+            std::memcpy(&f, &bits, sizeof(f));
+            st.push_double(f);
+            break;
+        }
+        case 0xcb:
+        {
+            std::uint64_t bits;
+            if(! read_arg(8, bits))
+                return nullptr;
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            st.push_double(d);
+            break;
+        }
+        case 0xcc:
+        case 0xcd:
+        case 0xce:
+        case 0xcf:
+        {
+            std::uint64_t n;
+            if(! read_arg(std::size_t(1) <<
+                (ib - 0xcc), n))
+                return nullptr;
+            if(n <= static_cast<std::uint64_t>(
+                (std::numeric_limits<
+                    std::int64_t>::max)()))
+                st.push_int64(
+                    static_cast<std::int64_t>(n));
+            else
+                st.push_uint64(n);
+            break;
+        }
+        case 0xd0:
+        case 0xd1:
+        case 0xd2:
+        case 0xd3:
+        {
+            std::size_t const width =
+                std::size_t(1) << (ib - 0xd0);
+            std::uint64_t n;
+            if(! read_arg(width, n))
+                return nullptr;
+            // sign-extend from the stored width
+            std::uint64_t const sign_bit =
+                std::uint64_t(1) << (8 * width - 1);
+            if(width < 8 && (n & sign_bit))
+                n |= ~(sign_bit * 2 - 1);
+            st.push_int64(
+                static_cast<std::int64_t>(n));
+            break;
+        }
+        default:
+            // 0xc1, and the ext formats which
+            // have no JSON equivalent
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return nullptr;
+        }
+        complete();
+    }
+
+    if(p != end)
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+        return nullptr;
+    }
+    return st.release();
+}
+
+value
+parse_msgpack(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp)
+{
+    error_code jec;
+    value result = parse_msgpack(
+        s, jec, std::move(sp));
+    ec = jec;
+    return result;
+}
+
+value
+parse_msgpack(
+    string_view s,
+    storage_ptr sp)
+{
+    error_code ec;
+    auto jv = parse_msgpack(
+        s, ec, std::move(sp));
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+//----------------------------------------------------------
+
+void
+msgpack_serializer::
+stage(unsigned char b) noexcept
+{
+    buf_[buf_n_++] = static_cast<char>(b);
+}
+
+void
+msgpack_serializer::
+stage_str(std::size_t n)
+{
+    if(n < 32)
+    {
+        stage(static_cast<unsigned char>(
+            0xa0 | n));
+    }
+    else if(n < 256)
+    {
+        stage(0xd9);
+        stage(static_cast<unsigned char>(n));
+    }
+    else if(n < 65536)
+    {
+        stage(0xda);
+        detail::store_be16(buf_ + buf_n_,
+            static_cast<std::uint16_t>(n));
+        buf_n_ += 2;
+    }
+    else if(n <= 0xffffffff)
+    {
+        stage(0xdb);
+        detail::store_be32(buf_ + buf_n_,
+            static_cast<std::uint32_t>(n));
+        buf_n_ += 4;
+    }
+    else
+    {
+        error_code ec;
+        BOOST_JSON_FAIL(ec,
+            error::string_too_large);
+        detail::throw_system_error(ec);
+    }
+}
+
+void
+msgpack_serializer::
+emit(value const& jv)
+{
+    switch(jv.kind())
+    {
+    case kind::null:
+        stage(0xc0);
+        break;
+    case kind::bool_:
+        stage(jv.get_bool() ? 0xc3 : 0xc2);
+        break;
+    case kind::int64:
+    {
+        std::int64_t const v = jv.get_int64();
+        if(v >= 0)
+            goto do_uint;
+        if(v >= -32)
+        {
+            stage(static_cast<
+                unsigned char>(v));
+        }
+        else if(v >= (std::numeric_limits<
+            std::int8_t>::min)())
+        {
+            stage(0xd0);
+            stage(static_cast<
+                unsigned char>(v));
+        }
+        else if(v >= (std::numeric_limits<
+            std::int16_t>::min)())
+        {
+            stage(0xd1);
+            detail::store_be16(buf_ + buf_n_,
+                static_cast<std::uint16_t>(v));
+            buf_n_ += 2;
+        }
+        else if(v >= (std::numeric_limits<
+            std::int32_t>::min)())
+        {
+            stage(0xd2);
+            detail::store_be32(buf_ + buf_n_,
+                static_cast<std::uint32_t>(v));
+            buf_n_ += 4;
+        }
+        else
+        {
+            stage(0xd3);
+            detail::store_be64(buf_ + buf_n_,
+                static_cast<std::uint64_t>(v));
+            buf_n_ += 8;
+        }
+        break;
+    do_uint:
+        {
+            std::uint64_t const u =
+                static_cast<std::uint64_t>(v);
+            if(u < 0x80)
+            {
+                stage(static_cast<
+                    unsigned char>(u));
+            }
+            else if(u < 256)
+            {
+                stage(0xcc);
+                stage(static_cast<
+                    unsigned char>(u));
+            }
+            else if(u < 65536)
+            {
+                stage(0xcd);
+                detail::store_be16(buf_ + buf_n_,
+                    static_cast<std::uint16_t>(u));
+                buf_n_ += 2;
+            }
+            else if(u <= 0xffffffff)
+            {
+                stage(0xce);
+                detail::store_be32(buf_ + buf_n_,
+                    static_cast<std::uint32_t>(u));
+                buf_n_ += 4;
+            }
+            else
+            {
+                stage(0xcf);
+                detail::store_be64(
+                    buf_ + buf_n_, u);
+                buf_n_ += 8;
+            }
+        }
+        break;
+    }
+    case kind::uint64:
+    {
+        std::uint64_t const u = jv.get_uint64();
+        if(u <= static_cast<std::uint64_t>(
+            (std::numeric_limits<
+                std::int64_t>::max)()))
+        {
+            value const tmp(static_cast<
+                std::int64_t>(u));
+            emit(tmp);
+            return;
+        }
+        stage(0xcf);
+        detail::store_be64(buf_ + buf_n_, u);
+        buf_n_ += 8;
+        break;
+    }
+    case kind::double_:
+    {
+        stage(0xcb);
+        std::uint64_t bits;
+        double const d = jv.get_double();
+        std::memcpy(&bits, &d, sizeof(bits));
+        detail::store_be64(buf_ + buf_n_, bits);
+        buf_n_ += 8;
+        break;
+    }
+    case kind::string:
+    {
+        auto const& js = jv.get_string();
+        stage_str(js.size());
+        pay_ = js.data();
+        pay_n_ = js.size();
+        break;
+    }
+    case kind::array:
+    {
+        auto const& ja = jv.get_array();
+        std::size_t const n = ja.size();
+        if(n < 16)
+        {
+            stage(static_cast<unsigned char>(
+                0x90 | n));
+        }
+        else if(n < 65536)
+        {
+            stage(0xdc);
+            detail::store_be16(buf_ + buf_n_,
+                static_cast<std::uint16_t>(n));
+            buf_n_ += 2;
+        }
+        else if(n <= 0xffffffff)
+        {
+            stage(0xdd);
+            detail::store_be32(buf_ + buf_n_,
+                static_cast<std::uint32_t>(n));
+            buf_n_ += 4;
+        }
+        else
+        {
+            error_code ec;
+            BOOST_JSON_FAIL(ec,
+                error::array_too_large);
+            detail::throw_system_error(ec);
+        }
+        if(! ja.empty())
+        {
+            if(has_cur_)
+                st_.push(cur_);
+            cur_.it = ja.data();
+            cur_.end = ja.data() + ja.size();
+            cur_.object = false;
+            cur_.key_done = false;
+            has_cur_ = true;
+        }
+        break;
+    }
+    default:
+    {
+        auto const& jo = jv.get_object();
+        std::size_t const n = jo.size();
+        if(n < 16)
+        {
+            stage(static_cast<unsigned char>(
+                0x80 | n));
+        }
+        else if(n < 65536)
+        {
+            stage(0xde);
+            detail::store_be16(buf_ + buf_n_,
+                static_cast<std::uint16_t>(n));
+            buf_n_ += 2;
+        }
+        else if(n <= 0xffffffff)
+        {
+            stage(0xdf);
+            detail::store_be32(buf_ + buf_n_,
+                static_cast<std::uint32_t>(n));
+            buf_n_ += 4;
+        }
+        else
+        {
+            error_code ec;
+            BOOST_JSON_FAIL(ec,
+                error::object_too_large);
+            detail::throw_system_error(ec);
+        }
+        if(! jo.empty())
+        {
+            if(has_cur_)
+                st_.push(cur_);
+            cur_.it = jo.begin();
+            cur_.end = jo.end();
+            cur_.object = true;
+            cur_.key_done = false;
+            has_cur_ = true;
+        }
+        break;
+    }
+    }
+}
+
+void
+msgpack_serializer::
+reset(value const* p) noexcept
+{
+    pj_ = p;
+    st_.clear();
+    has_cur_ = false;
+    pay_n_ = 0;
+    buf_n_ = 0;
+    buf_i_ = 0;
+    done_ = false;
+}
+
+string_view
+msgpack_serializer::
+read(char* dest, std::size_t size)
+{
+    char* p = dest;
+    char* const end = dest + size;
+    while(p != end)
+    {
+        // staged header bytes
+        if(buf_i_ < buf_n_)
+        {
+            std::size_t n = buf_n_ - buf_i_;
+            if(n > static_cast<std::size_t>(
+                end - p))
+                n = end - p;
+            std::memcpy(p, buf_ + buf_i_, n);
+            p += n;
+            buf_i_ += static_cast<
+                unsigned char>(n);
+            if(buf_i_ == buf_n_)
+            {
+                buf_i_ = 0;
+                buf_n_ = 0;
+            }
+            continue;
+        }
+        // string payload
+        if(pay_n_ > 0)
+        {
+            std::size_t n = pay_n_;
+            if(n > static_cast<std::size_t>(
+                end - p))
+                n = end - p;
+            std::memcpy(p, pay_, n);
+            p += n;
+            pay_ += n;
+            pay_n_ -= n;
+            continue;
+        }
+        // the root item
+        if(pj_)
+        {
+            value const* jv = pj_;
+            pj_ = nullptr;
+            emit(*jv);
+            continue;
+        }
+        if(! has_cur_)
+        {
+            done_ = true;
+            break;
+        }
+        if(cur_.object)
+        {
+            auto it = static_cast<
+                key_value_pair const*>(cur_.it);
+            if(it == cur_.end)
+            {
+                if(st_.empty())
+                    has_cur_ = false;
+                else
+                    st_.pop(cur_);
+            }
+            else if(! cur_.key_done)
+            {
+                string_view const key = it->key();
+                stage_str(key.size());
+                pay_ = key.data();
+                pay_n_ = key.size();
+                cur_.key_done = true;
+            }
+            else
+            {
+                cur_.key_done = false;
+                cur_.it = it + 1;
+                emit(it->value());
+            }
+        }
+        else
+        {
+            auto it = static_cast<
+                value const*>(cur_.it);
+            if(it == cur_.end)
+            {
+                if(st_.empty())
+                    has_cur_ = false;
+                else
+                    st_.pop(cur_);
+            }
+            else
+            {
+                cur_.it = it + 1;
+                emit(*it);
+            }
+        }
+    }
+    return string_view(dest,
+        static_cast<std::size_t>(p - dest));
+}
+
+std::string
+serialize_msgpack(value const& jv)
+{
+    std::string s;
+    msgpack_serializer sr;
+    sr.reset(&jv);
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    while(! sr.done())
+    {
+        string_view const sv = sr.read(buf);
+        s.append(sv.data(), sv.size());
+    }
+    return s;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_NDJSON_IPP
+#define BOOST_JSON_IMPL_NDJSON_IPP
+
+#include <boost/json/ndjson.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parser.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <cstring>
+#include <exception>
+#include <thread>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// split the buffer into records, dropping line
+// terminators and lines holding only whitespace
+void
+split_records(
+    string_view s,
+    std::vector<string_view>& records)
+{
+    char const* p = s.data();
+    char const* const end = p + s.size();
+    while(p != end)
+    {
+        char const* nl = static_cast<char const*>(
+            std::memchr(p, '\n', end - p));
+        char const* last = nl ? nl : end;
+        if(last != p && last[-1] == '\r')
+            --last;
+        string_view const rec(
+            p, static_cast<std::size_t>(last - p));
+        if(detail::count_whitespace(
+                rec.data(), rec.data() + rec.size()) !=
+            rec.data() + rec.size())
+            records.push_back(rec);
+        p = nl ? nl + 1 : end;
+    }
+}
+
+// parse a contiguous chunk of records into its own
+// shared arena, stopping at the first error
+void
+parse_chunk(
+    string_view const* first,
+    std::size_t n,
+    parse_options const& opt,
+    std::vector<value>& out,
+    error_code& ec)
+{
+    storage_ptr sp = make_shared_resource<
+        monotonic_resource>();
+    unsigned char temp[
+        BOOST_JSON_STACK_BUFFER_SIZE];
+    parser pr(storage_ptr(), opt, temp);
+    out.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        pr.reset(sp);
+        pr.write(first[i], ec);
+        if(ec.failed())
+            return;
+        out.push_back(pr.release());
+    }
+}
+
+// the state shared by one batch of chunk
+// parses; chunk i covers records
+// [first(i), first(i) + len(i)).
+struct parse_job
+{
+    string_view const* records;
+    parse_options const* opt;
+    std::size_t per;
+    std::size_t extra;
+    std::vector<std::vector<value>> results;
+    std::vector<error_code> errors;
+    std::vector<std::exception_ptr> exceptions;
+
+    static
+    void
+    run(void* arg, std::size_t i)
+    {
+        auto& j = *static_cast<
+            parse_job*>(arg);
+#ifndef BOOST_NO_EXCEPTIONS
+        try
+#endif
+        {
+            std::size_t const len =
+                j.per + (i < j.extra ? 1 : 0);
+            string_view const* const first =
+                j.records + i * j.per +
+                (i < j.extra ? i : j.extra);
+            parse_chunk(first, len, *j.opt,
+                j.results[i], j.errors[i]);
+        }
+#ifndef BOOST_NO_EXCEPTIONS
+        catch(...)
+        {
+            j.exceptions[i] =
+                std::current_exception();
+        }
+#endif
+    }
+};
+
+std::vector<value>
+parse_ndjson_impl(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt,
+    std::size_t n,
+    executor* ex)
+{
+    ec = {};
+    std::vector<string_view> records;
+    split_records(s, records);
+
+    if(n > records.size())
+        n = records.size();
+
+    if(n <= 1)
+    {
+        std::vector<value> vs;
+        parse_chunk(records.data(),
+            records.size(), opt, vs, ec);
+        if(ec.failed())
+            return {};
+        return vs;
+    }
+
+    parse_job j;
+    j.records = records.data();
+    j.opt = &opt;
+    j.per = records.size() / n;
+    j.extra = records.size() % n;
+    j.results.resize(n);
+    j.errors.resize(n);
+    j.exceptions.resize(n);
+
+    detail::parallel_run(ex, n,
+        &parse_job::run, &j);
+
+    for(std::size_t i = 0; i < n; ++i)
+        if(j.exceptions[i])
+            std::rethrow_exception(j.exceptions[i]);
+
+    std::vector<value> vs;
+    vs.reserve(records.size());
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(j.errors[i].failed())
+        {
+            // first error in record order
+            ec = j.errors[i];
+            return {};
+        }
+        for(auto& jv : j.results[i])
+            vs.push_back(std::move(jv));
+    }
+    return vs;
+}
+
+} // (anon)
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt,
+    unsigned threads)
+{
+    std::size_t n = threads == 0 ? 1 : threads;
+    unsigned const hw =
+        std::thread::hardware_concurrency();
+    if(hw != 0 && n > hw)
+        n = hw;
+    return parse_ndjson_impl(
+        s, ec, opt, n, nullptr);
+}
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    std::error_code& ec,
+    parse_options const& opt,
+    unsigned threads)
+{
+    error_code jec;
+    auto vs = parse_ndjson(s, jec, opt, threads);
+    ec = jec;
+    return vs;
+}
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    parse_options const& opt,
+    unsigned threads)
+{
+    error_code ec;
+    auto vs = parse_ndjson(s, ec, opt, threads);
+    if(ec)
+        detail::throw_system_error( ec );
+    return vs;
+}
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    error_code& ec,
+    parse_options const& opt)
+{
+    std::size_t n = ex.concurrency();
+    if(n == 0)
+        n = 1;
+    return parse_ndjson_impl(
+        s, ec, opt, n, &ex);
+}
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    std::error_code& ec,
+    parse_options const& opt)
+{
+    error_code jec;
+    auto vs = parse_ndjson(s, ex, jec, opt);
+    ec = jec;
+    return vs;
+}
+
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    parse_options const& opt)
+{
+    error_code ec;
+    auto vs = parse_ndjson(s, ex, ec, opt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return vs;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
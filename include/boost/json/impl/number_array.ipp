@@ -0,0 +1,250 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_NUMBER_ARRAY_IPP
+#define BOOST_JSON_IMPL_NUMBER_ARRAY_IPP
+
+#include <boost/json/number_array.hpp>
+#include <boost/json/value.hpp>
+#include <cstring>
+#include <new>
+
+namespace boost {
+namespace json {
+
+// packed slots hold either element type;
+// both are eight bytes with eight byte alignment
+BOOST_STATIC_ASSERT(
+    sizeof(std::int64_t) == sizeof(double));
+BOOST_STATIC_ASSERT(
+    alignof(std::int64_t) <= alignof(double));
+
+number_array::
+~number_array()
+{
+    destroy();
+}
+
+number_array::
+number_array(storage_ptr sp)
+    : sp_(std::move(sp))
+    , arr_(sp_)
+{
+}
+
+number_array::
+number_array(
+    array const& a,
+    storage_ptr sp)
+    : number_array(std::move(sp))
+{
+    reserve(a.size());
+    for(auto const& jv : a)
+        push_back(jv);
+}
+
+number_array::
+number_array(number_array&& other) noexcept
+    : sp_(other.sp_)
+    , data_(other.data_)
+    , size_(other.size_)
+    , capacity_(other.capacity_)
+    , kind_(other.kind_)
+    , arr_(std::move(other.arr_))
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+    other.kind_ = json::kind::int64;
+}
+
+std::size_t
+number_array::
+size() const noexcept
+{
+    if(kind_ == json::kind::array)
+        return arr_.size();
+    return size_;
+}
+
+void
+number_array::
+reserve(std::size_t n)
+{
+    if(kind_ == json::kind::array)
+        return arr_.reserve(n);
+    if(n > capacity_)
+        grow(n);
+}
+
+void
+number_array::
+push_back(std::int64_t v)
+{
+    if(kind_ == json::kind::array)
+    {
+        arr_.emplace_back(v);
+        return;
+    }
+    if(size_ >= capacity_)
+        grow(size_ + 1);
+    if(kind_ == json::kind::double_)
+        ::new(static_cast<char*>(data_) +
+            size_ * sizeof(double)) double(
+                static_cast<double>(v));
+    else
+        ::new(static_cast<char*>(data_) +
+            size_ * sizeof(double))
+                std::int64_t(v);
+    ++size_;
+}
+
+void
+number_array::
+push_back(double v)
+{
+    if(kind_ == json::kind::array)
+    {
+        arr_.emplace_back(v);
+        return;
+    }
+    if(size_ >= capacity_)
+        grow(size_ + 1);
+    if(kind_ == json::kind::int64)
+        to_doubles();
+    ::new(static_cast<char*>(data_) +
+        size_ * sizeof(double)) double(v);
+    ++size_;
+}
+
+void
+number_array::
+push_back(value const& jv)
+{
+    if(kind_ != json::kind::array)
+    {
+        if(jv.is_int64())
+            return push_back(jv.get_int64());
+        if(jv.is_double())
+            return push_back(jv.get_double());
+        to_generic();
+    }
+    arr_.push_back(jv);
+}
+
+array
+number_array::
+to_array() const
+{
+    if(kind_ == json::kind::array)
+        return arr_;
+    array a(sp_);
+    a.reserve(size_);
+    if(kind_ == json::kind::int64)
+    {
+        auto const p = reinterpret_cast<
+            std::int64_t const*>(data_);
+        for(std::size_t i = 0; i < size_; ++i)
+            a.emplace_back(p[i]);
+    }
+    else
+    {
+        auto const p = reinterpret_cast<
+            double const*>(data_);
+        for(std::size_t i = 0; i < size_; ++i)
+            a.emplace_back(p[i]);
+    }
+    return a;
+}
+
+void
+number_array::
+grow(std::size_t n)
+{
+    std::size_t new_cap =
+        capacity_ < 8 ? 16 : capacity_ * 2;
+    if(new_cap < n)
+        new_cap = n;
+    auto const p = sp_->allocate(
+        new_cap * sizeof(double),
+        alignof(double));
+    if(data_)
+    {
+        std::memcpy(p, data_,
+            size_ * sizeof(double));
+        if(! sp_.is_deallocate_trivial())
+            sp_->deallocate(data_,
+                capacity_ * sizeof(double),
+                alignof(double));
+    }
+    data_ = p;
+    capacity_ = new_cap;
+}
+
+void
+number_array::
+to_doubles()
+{
+    auto const base =
+        static_cast<char*>(data_);
+    for(std::size_t i = 0; i < size_; ++i)
+    {
+        std::int64_t v;
+        std::memcpy(&v,
+            base + i * sizeof(double),
+            sizeof(v));
+        ::new(base + i * sizeof(double))
+            double(static_cast<double>(v));
+    }
+    kind_ = json::kind::double_;
+}
+
+void
+number_array::
+to_generic()
+{
+    arr_.reserve(size_);
+    if(kind_ == json::kind::int64)
+    {
+        auto const p = reinterpret_cast<
+            std::int64_t const*>(data_);
+        for(std::size_t i = 0; i < size_; ++i)
+            arr_.emplace_back(p[i]);
+    }
+    else
+    {
+        auto const p = reinterpret_cast<
+            double const*>(data_);
+        for(std::size_t i = 0; i < size_; ++i)
+            arr_.emplace_back(p[i]);
+    }
+    destroy();
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+    kind_ = json::kind::array;
+}
+
+void
+number_array::
+destroy() noexcept
+{
+    if(! data_)
+        return;
+    if(sp_.is_deallocate_trivial())
+        return;
+    sp_->deallocate(data_,
+        capacity_ * sizeof(double),
+        alignof(double));
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
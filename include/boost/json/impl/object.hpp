@@ -13,6 +13,7 @@
 #include <boost/json/value.hpp>
 #include <iterator>
 #include <cmath>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -44,12 +45,48 @@ struct alignas(key_value_pair)
     std::uint32_t capacity = 0;
     std::uintptr_t salt = 0;
 
+    // existence filter: one bit per element,
+    // selected by the key's digest. lookups
+    // for absent keys usually fail the filter
+    // with one load and test, skipping the
+    // bucket probe entirely. bits are never
+    // cleared by erasure; the filter is
+    // rebuilt whenever the index is.
+    std::uint64_t exists = 0;
+
+    // deferred index rebuild: while old_table
+    // is set, the elements which predate the
+    // last growth keep their chains in the old
+    // table's buckets. the chain indexes and
+    // next links stay valid because growth
+    // relocates elements without changing
+    // their positions. migrate_pos is the
+    // first old bucket not yet relinked.
+    table* old_table = nullptr;
+    std::uint32_t migrate_pos = 0;
+
+    // when nonzero, growth defers the index
+    // rebuild and insertions migrate a few
+    // buckets each; see
+    // object::incremental_rehash.
+    std::uint32_t incremental = 0;
+
+    // minimal perfect hash over the current
+    // key set, or null. while set, lookups
+    // probe exactly one element; any
+    // mutation discards it and falls back
+    // to the bucket chains, which are kept
+    // valid alongside it. see
+    // object::freeze_phf.
+    std::uint32_t* phf = nullptr;
+    std::uint32_t phf_buckets = 0;
+
 #if defined(_MSC_VER) && BOOST_JSON_ARCH == 32
     // VFALCO If we make key_value_pair smaller,
     //        then we might want to revisit this
     //        padding.
     BOOST_STATIC_ASSERT(
-        sizeof(key_value_pair) == 32);
+        sizeof(key_value_pair) == 40);
     char pad[4] = {}; // silence warnings
 #endif
 
@@ -77,6 +114,65 @@ struct alignas(key_value_pair)
     std::size_t
     digest(string_view key) const noexcept;
 
+    // returns the probe metadata stored for
+    // each element: a byte of the hash in the
+    // low half and the clamped key length in
+    // the high half. comparing it first skips
+    // most key comparisons during bucket
+    // probes without touching key characters.
+    static
+    std::uint16_t
+    fragment_of(
+        std::size_t hash,
+        std::size_t len) noexcept
+    {
+        // the bucket index uses the low
+        // bits, so take the high bits.
+        return static_cast<std::uint16_t>(
+            static_cast<std::uint8_t>(
+                hash >> (8 * (sizeof(
+                    std::size_t) - 1))) |
+            ((len < 255 ? len : 255) << 8));
+    }
+
+    inline
+    std::uint16_t&
+    fragment(std::size_t pos) noexcept;
+
+    // the bucket index uses the low bits of
+    // the hash and the probe fragment uses
+    // the top byte; the filter draws from
+    // the bits in between.
+    static
+    std::uint64_t
+    exists_bit_of(std::size_t hash) noexcept
+    {
+        return std::uint64_t(1) <<
+            ((hash >> 16) & 63);
+    }
+
+    void
+    mark(std::size_t hash) noexcept
+    {
+        exists |= exists_bit_of(hash);
+    }
+
+    bool
+    maybe(std::size_t hash) const noexcept
+    {
+        return (exists &
+            exists_bit_of(hash)) != 0;
+    }
+
+    // the full digest cached for each
+    // element. growth rebuilds the index
+    // from these instead of re-hashing
+    // every key; they stay valid because
+    // the salt is preserved across growth.
+    inline
+    std::size_t&
+    hash(std::size_t pos) noexcept;
+
     inline
     index_t&
     bucket(std::size_t hash) noexcept;
@@ -97,6 +193,31 @@ struct alignas(key_value_pair)
         std::uintptr_t salt,
         storage_ptr const& sp);
 
+    // the multiplier applied to the per-bucket
+    // displacement of the minimal perfect
+    // hash; drawn from the middle bits so it
+    // is independent of the bucket index.
+    static
+    std::size_t
+    phf_mul(std::size_t hash) noexcept
+    {
+        return (hash >> 16) | 1;
+    }
+
+    // the base position of a key within the
+    // minimal perfect hash; drawn from the
+    // high bits, because the bucket index
+    // uses the low bits and keys sharing a
+    // bucket must not also share a position
+    // modulo the element count.
+    static
+    std::size_t
+    phf_pos(std::size_t hash) noexcept
+    {
+        return hash >> (
+            sizeof(std::size_t) * 4);
+    }
+
     static
     void
     deallocate(
@@ -105,11 +226,20 @@ struct alignas(key_value_pair)
     {
         if(p->capacity == 0)
             return;
+        if(sp.is_deallocate_trivial())
+            return;
+        if(p->phf)
+            sp->deallocate(p->phf,
+                (2 * p->phf_buckets +
+                    p->size) *
+                    sizeof(std::uint32_t));
         if(! p->is_small())
             sp->deallocate(p,
                 sizeof(table) + p->capacity * (
                     sizeof(key_value_pair) +
-                    sizeof(index_t)));
+                    sizeof(std::size_t) +
+                    sizeof(index_t) +
+                    sizeof(std::uint16_t)));
         else
             sp->deallocate(p,
                 sizeof(table) + p->capacity *
@@ -331,7 +461,9 @@ max_size() noexcept
     // max_size depends on the address model
     using min = std::integral_constant<std::size_t,
         (std::size_t(-1) - sizeof(table)) /
-            (sizeof(key_value_pair) + sizeof(index_t))>;
+            (sizeof(key_value_pair) +
+             sizeof(index_t) +
+             sizeof(std::uint16_t))>;
     return min::value < BOOST_JSON_MAX_STRUCTURED_SIZE ?
         min::value : BOOST_JSON_MAX_STRUCTURED_SIZE;
 }
@@ -351,7 +483,10 @@ reserve(std::size_t new_capacity)
     if( new_capacity <= capacity() )
         return;
     table* const old_table = reserve_impl(new_capacity);
-    table::deallocate( old_table, sp_ );
+    // a deferred rebuild keeps the old table
+    // alive; reserve_impl returns null then
+    if(old_table)
+        table::deallocate( old_table, sp_ );
 }
 
 //----------------------------------------------------------
@@ -377,6 +512,14 @@ at(string_view key) && ->
     return std::move( at(key) );
 }
 
+auto
+object::
+operator[](string_view key) && ->
+    value&&
+{
+    return std::move( (*this)[key] );
+}
+
 auto
 object::
 at(string_view key) const& ->
@@ -391,6 +534,33 @@ at(string_view key) const& ->
     return it->value();
 }
 
+auto
+object::
+get(string_view key) & noexcept ->
+    value&
+{
+    auto const& self = *this;
+    return const_cast< value& >( self.get(key) );
+}
+
+auto
+object::
+get(string_view key) && noexcept ->
+    value&&
+{
+    return std::move( get(key) );
+}
+
+auto
+object::
+get(string_view key) const& noexcept ->
+    value const&
+{
+    auto it = find(key);
+    BOOST_ASSERT(it != end());
+    return it->value();
+}
+
 //----------------------------------------------------------
 
 template<class P, class>
@@ -432,6 +602,54 @@ emplace(
     return emplace_impl( key, key, static_cast<Arg&&>(arg) );
 }
 
+template<class Arg>
+auto
+object::
+emplace_at(
+    std::initializer_list<string_view> path,
+    Arg&& arg) ->
+        value&
+{
+    BOOST_ASSERT( path.size() != 0 );
+    object* o = this;
+    auto it = path.begin();
+    for(auto const last = path.end() - 1;
+        it != last; ++it)
+    {
+        // locate or create the next level in
+        // one probe; the new object uses the
+        // container's storage directly
+        auto const r = o->emplace_impl(
+            *it, *it, object_kind );
+        value& v = r.first->value();
+        if(BOOST_JSON_UNLIKELY( ! v.is_object() ))
+        {
+            BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
+            detail::throw_system_error( error::not_object, &loc );
+        }
+        o = &v.get_object();
+    }
+    auto const r = o->insert_or_assign(
+        *it, static_cast<Arg&&>(arg) );
+    return r.first->value();
+}
+
+template<class Pred>
+std::size_t
+object::
+erase_if(Pred&& pred)
+{
+    return do_erase_if(
+        [](void* arg, key_value_pair& kv)
+        {
+            return static_cast<bool>(
+                (*static_cast<typename
+                    std::remove_reference<
+                        Pred>::type*>(arg))(kv));
+        },
+        std::addressof(pred));
+}
+
 //----------------------------------------------------------
 //
 // (private)
@@ -15,9 +15,11 @@
 #include <boost/json/detail/digest.hpp>
 #include <boost/json/detail/except.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
 #include <new>
 #include <stdexcept>
 #include <type_traits>
@@ -26,6 +28,116 @@ namespace boost {
 namespace json {
 namespace detail {
 
+// salt for a freshly allocated table. the
+// address alone repeats whenever the
+// allocator reuses a block, which lets an
+// adversary who observed one table's probe
+// behavior craft clustered keys for the
+// next; mixing in a process-wide counter
+// and scrambling makes every table's salt
+// distinct and unpredictable.
+inline
+std::uintptr_t
+table_salt(void const* p) noexcept
+{
+    static std::atomic<
+        std::uint64_t> counter{0};
+    std::uint64_t x = reinterpret_cast<
+        std::uintptr_t>(p) +
+        counter.fetch_add(
+            0x9E3779B97F4A7C15ULL,
+            std::memory_order_relaxed);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    // the digest functions
+    // require a non-zero salt
+    return static_cast<
+        std::uintptr_t>(x | 1);
+}
+
+inline
+std::uint32_t
+load_key32(char const* p) noexcept
+{
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline
+std::uint64_t
+load_key64(char const* p) noexcept
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// compare a lookup key to a stored key.
+// for string_view, keys of 4 to 24 bytes
+// (the common case) are compared with a
+// few overlapping word loads, avoiding
+// the overhead of a library memcmp call;
+// other lengths check the first character
+// to reject most non-matching elements
+// before falling back to memcmp.
+inline
+bool
+key_equal(
+    string_view key,
+    key_value_pair const& e) noexcept
+{
+    auto const n = key.size();
+    auto const k = e.key();
+    if(k.size() != n)
+        return false;
+    char const* a = k.data();
+    char const* b = key.data();
+    if(n >= 4 && n <= 24)
+    {
+        // the bitwise & avoids a
+        // branch per comparison
+        if(n <= 8)
+            return
+                (load_key32(a) ==
+                    load_key32(b)) &
+                (load_key32(a + n - 4) ==
+                    load_key32(b + n - 4));
+        if(n <= 16)
+            return
+                (load_key64(a) ==
+                    load_key64(b)) &
+                (load_key64(a + n - 8) ==
+                    load_key64(b + n - 8));
+        return
+            (load_key64(a) ==
+                load_key64(b)) &
+            (load_key64(a + 8) ==
+                load_key64(b + 8)) &
+            (load_key64(a + n - 8) ==
+                load_key64(b + n - 8));
+    }
+    if(n == 0)
+        return true;
+    return a[0] == b[0] &&
+        std::memcmp(a, b, n) == 0;
+}
+
+// ranges which are not string_view, such
+// as unescaped JSON Pointer tokens, supply
+// their own comparison.
+template<class CharRange>
+bool
+key_equal(
+    CharRange const& key,
+    key_value_pair const& e) noexcept
+{
+    return key == e.key();
+}
+
 template<class CharRange>
 std::pair<key_value_pair*, std::size_t>
 find_in_object(
@@ -39,7 +151,7 @@ find_in_object(
         auto const last =
             &(*obj.t_)[obj.t_->size];
         for(;it != last; ++it)
-            if( key == it->key() )
+            if( key_equal(key, *it) )
                 return { it, 0 };
         return { nullptr, 0 };
     }
@@ -48,18 +160,88 @@ find_in_object(
         std::size_t> result;
     BOOST_ASSERT(obj.t_->salt != 0);
     result.second = detail::digest(key.begin(), key.end(), obj.t_->salt);
+    // the existence filter rejects most
+    // absent keys here, before the bucket
+    // chain is probed. while a migration is
+    // pending, either table may hold the
+    // element's filter bit.
+    auto* const old = obj.t_->old_table;
+    if(! obj.t_->maybe(result.second) &&
+        (! old || ! old->maybe(result.second)))
+    {
+        result.first = nullptr;
+        return result;
+    }
+    auto const frag =
+        object::table::fragment_of(
+            result.second,
+            static_cast<std::size_t>(
+                std::distance(
+                    key.begin(), key.end())));
+    if(obj.t_->phf)
+    {
+        // frozen: the minimal perfect hash
+        // names the only element which can
+        // match, so there is no chain walk.
+        // the slot indirects through a
+        // redirect table, because elements
+        // keep their insertion order.
+        auto const h = result.second;
+        auto const* const d = obj.t_->phf +
+            2 * (h % obj.t_->phf_buckets);
+        auto const slot = (
+            object::table::phf_pos(h) +
+            d[0] * object::table::phf_mul(h) +
+            d[1]) % obj.t_->size;
+        auto const pos = (obj.t_->phf +
+            2 * obj.t_->phf_buckets)[slot];
+        auto& v = (*obj.t_)[pos];
+        if( obj.t_->fragment(pos) == frag &&
+            key_equal(key, v) )
+        {
+            result.first = &v;
+            return result;
+        }
+        result.first = nullptr;
+        return result;
+    }
     auto i = obj.t_->bucket(
         result.second);
     while(i != object::null_index_)
     {
         auto& v = (*obj.t_)[i];
-        if( key == v.key() )
+        // comparing the stored hash
+        // fragment first avoids touching
+        // the key characters of elements
+        // which share the bucket but
+        // cannot match.
+        if( obj.t_->fragment(i) == frag &&
+            key_equal(key, v) )
         {
             result.first = &v;
             return result;
         }
         i = access::next(v);
     }
+    if(old)
+    {
+        // elements not yet migrated are still
+        // chained in the old table's buckets;
+        // their indexes and next links refer
+        // to the current element array.
+        i = old->bucket(result.second);
+        while(i != object::null_index_)
+        {
+            auto& v = (*obj.t_)[i];
+            if( old->fragment(i) == frag &&
+                key_equal(key, v) )
+            {
+                result.first = &v;
+                return result;
+            }
+            i = access::next(v);
+        }
+    }
     result.first = nullptr;
     return result;
 }
@@ -71,6 +253,15 @@ find_in_object<string_view>(
     object const& obj,
     string_view key) noexcept;
 
+// Old buckets relinked per insertion while a
+// deferred rebuild is outstanding. Growth
+// multiplies capacity by 1.5, so roughly c/2
+// insertions arrive before the next growth
+// while c old buckets wait; anything above two
+// per insertion retires the old table in time,
+// and reserve_impl finishes any remainder.
+constexpr std::size_t rehash_step_ = 8;
+
 } // namespace detail
 
 //----------------------------------------------------------
@@ -90,14 +281,45 @@ digest(string_view key) const noexcept
         key.begin(), key.end(), salt);
 }
 
+std::size_t&
+object::table::
+hash(std::size_t pos) noexcept
+{
+    BOOST_ASSERT(! is_small());
+    // the cached digests are stored
+    // right after the elements, where
+    // their alignment is guaranteed
+    return reinterpret_cast<
+        std::size_t*>(
+            &(*this)[capacity])[pos];
+}
+
+auto
+object::table::
+fragment(std::size_t pos) noexcept ->
+    std::uint16_t&
+{
+    BOOST_ASSERT(! is_small());
+    // the fragments are stored
+    // after the bucket indexes
+    return reinterpret_cast<
+        std::uint16_t*>(
+            reinterpret_cast<index_t*>(
+                reinterpret_cast<std::size_t*>(
+                    &(*this)[capacity]) +
+                capacity) +
+            capacity)[pos];
+}
+
 auto
 object::table::
 bucket(std::size_t hash) noexcept ->
     index_t&
 {
-    return reinterpret_cast<
-        index_t*>(&(*this)[capacity])[
-            hash % capacity];
+    return reinterpret_cast<index_t*>(
+        reinterpret_cast<std::size_t*>(
+            &(*this)[capacity]) +
+        capacity)[hash % capacity];
 }
 
 auto
@@ -113,10 +335,13 @@ object::table::
 clear() noexcept
 {
     BOOST_ASSERT(! is_small());
+    exists = 0;
     // initialize buckets
     std::memset(
         reinterpret_cast<index_t*>(
-            &(*this)[capacity]),
+            reinterpret_cast<std::size_t*>(
+                &(*this)[capacity]) +
+            capacity),
         0xff, // null_index_
         capacity * sizeof(index_t));
 }
@@ -131,6 +356,9 @@ allocate(
     BOOST_STATIC_ASSERT(
         alignof(key_value_pair) >=
         alignof(index_t));
+    BOOST_STATIC_ASSERT(
+        alignof(key_value_pair) >=
+        alignof(std::size_t));
     BOOST_ASSERT(capacity > 0);
     BOOST_ASSERT(capacity <= max_size());
     table* p;
@@ -149,22 +377,28 @@ allocate(
             table*>(sp->allocate(
                 sizeof(table) + capacity * (
                     sizeof(key_value_pair) +
-                    sizeof(index_t))));
+                    sizeof(std::size_t) +
+                    sizeof(index_t) +
+                    sizeof(std::uint16_t))));
         p->capacity = static_cast<
             std::uint32_t>(capacity);
         p->clear();
     }
+    // the storage is raw; no constructor
+    // ran, so every header field needs an
+    // explicit store
+    p->old_table = nullptr;
+    p->migrate_pos = 0;
+    p->incremental = 0;
+    p->phf = nullptr;
+    p->phf_buckets = 0;
     if(salt)
     {
         p->salt = salt;
     }
     else
     {
-        // VFALCO This would be better if it
-        //        was random, but maybe this
-        //        is good enough.
-        p->salt = reinterpret_cast<
-            std::uintptr_t>(p);
+        p->salt = detail::table_salt(p);
     }
     return p;
 }
@@ -212,8 +446,9 @@ object(detail::unchecked_object&& uo)
     t_ = table::allocate(
         uo.size(), 0, sp_);
 
-    // insert all elements, keeping
-    // the last of any duplicate keys.
+    // insert all elements, resolving
+    // duplicate keys per the policy.
+    auto const dup = uo.policy();
     auto dest = begin();
     auto src = uo.release();
     auto const end = src + 2 * uo.size();
@@ -233,6 +468,14 @@ object(detail::unchecked_object&& uo)
                 continue;
             }
             // handle duplicate
+            if(dup == duplicate_keys::error)
+                fail_duplicate(dest, src, end);
+            if(dup == duplicate_keys::first)
+            {
+                // discard the new element
+                dest->~key_value_pair();
+                continue;
+            }
             auto& v = *result.first;
             // don't bother to check if
             // storage deallocate is trivial
@@ -249,7 +492,9 @@ object(detail::unchecked_object&& uo)
         access::construct_key_value_pair(
             dest, pilfer(src[0]), pilfer(src[1]));
         src += 2;
-        auto& head = t_->bucket(dest->key());
+        auto const hash =
+            t_->digest(dest->key());
+        auto& head = t_->bucket(hash);
         auto i = head;
         for(;;)
         {
@@ -260,6 +505,11 @@ object(detail::unchecked_object&& uo)
                     *dest) = head;
                 head = static_cast<index_t>(
                     dest - begin());
+                t_->fragment(dest - begin()) =
+                    table::fragment_of(hash,
+                        dest->key().size());
+                t_->hash(dest - begin()) = hash;
+                t_->mark(hash);
                 ++dest;
                 break;
             }
@@ -271,6 +521,15 @@ object(detail::unchecked_object&& uo)
             }
 
             // handle duplicate
+            if(dup == duplicate_keys::error)
+                fail_duplicate(dest, src, end);
+            if(dup == duplicate_keys::first)
+            {
+                // discard the new element; the
+                // bucket chain is left untouched
+                dest->~key_value_pair();
+                break;
+            }
             access::next(*dest) =
                 access::next(v);
             // don't bother to check if
@@ -287,6 +546,36 @@ object(detail::unchecked_object&& uo)
         index_t>(dest - begin());
 }
 
+// Clean up a partially built object when a
+// duplicate key is found in error mode, then
+// throw. The pairs [begin, dest] are constructed
+// and [src, end) holds the source values not
+// yet consumed; the unchecked_object released
+// them, so they are owned here.
+void
+object::
+fail_duplicate(
+    key_value_pair* dest,
+    value* src,
+    value* end)
+{
+    if(! sp_.is_not_shared_and_deallocate_is_trivial())
+    {
+        for(auto p = begin(); p != dest; ++p)
+            p->~key_value_pair();
+        dest->~key_value_pair();
+        while(src != end)
+        {
+            src->~value();
+            ++src;
+        }
+    }
+    table::deallocate(t_, sp_);
+    t_ = &empty_;
+    BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
+    detail::throw_system_error( error::duplicate_key, &loc );
+}
+
 object::
 ~object() noexcept
 {
@@ -355,12 +644,18 @@ object(
     for(auto const& v : other)
     {
         // skip duplicate checking
-        auto& head =
-            t_->bucket(v.key());
+        auto const hash =
+            t_->digest(v.key());
+        auto& head = t_->bucket(hash);
         auto pv = ::new(end())
             key_value_pair(v, sp_);
         access::next(*pv) = head;
         head = t_->size;
+        t_->fragment(t_->size) =
+            table::fragment_of(hash,
+                pv->key().size());
+        t_->hash(t_->size) = hash;
+        t_->mark(hash);
         ++t_->size;
     }
     r.commit();
@@ -433,10 +728,21 @@ clear() noexcept
 {
     if(empty())
         return;
+    thaw();
     if(! sp_.is_not_shared_and_deallocate_is_trivial())
         destroy(begin(), end());
     if(! t_->is_small())
+    {
         t_->clear();
+        if(t_->old_table)
+        {
+            // nothing is left to migrate
+            table::deallocate(
+                t_->old_table, sp_);
+            t_->old_table = nullptr;
+            t_->migrate_pos = 0;
+        }
+    }
     t_->size = 0;
 }
 
@@ -452,6 +758,7 @@ insert(
         BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
         detail::throw_system_error( error::object_too_large, &loc );
     }
+    thaw();
     revert_insert r( *this, n0 + init.size() );
     if(t_->is_small())
     {
@@ -474,7 +781,21 @@ insert(
     }
     for(auto& iv : init)
     {
-        auto& head = t_->bucket(iv.first);
+        if(t_->old_table)
+            migrate_some(detail::rehash_step_);
+        auto const hash =
+            t_->digest(iv.first);
+        // the chain walk below only sees the
+        // new index; a pending migration may
+        // hold the duplicate in the old one
+        if( t_->old_table &&
+            detail::find_in_object(
+                *this, iv.first).first )
+        {
+            // ignore duplicate
+            continue;
+        }
+        auto& head = t_->bucket(hash);
         auto i = head;
         for(;;)
         {
@@ -489,6 +810,11 @@ insert(
                 access::next(v) = head;
                 head = static_cast<index_t>(
                     t_->size);
+                t_->fragment(t_->size) =
+                    table::fragment_of(hash,
+                        iv.first.size());
+                t_->hash(t_->size) = hash;
+                t_->mark(hash);
                 ++t_->size;
                 break;
             }
@@ -504,6 +830,570 @@ insert(
     r.commit();
 }
 
+void
+object::
+optimize()
+{
+    if(t_->is_small())
+        return;
+    thaw();
+    if(t_->old_table)
+        finish_rehash();
+
+    // target a load factor of one half:
+    // with twice as many buckets as
+    // elements, chains average one probe
+    std::size_t new_cap = size();
+    if(new_cap <=
+        detail::small_object_size_)
+        new_cap =
+            detail::small_object_size_ + 1;
+    else if(new_cap <= max_size() / 2)
+        new_cap *= 2;
+    else
+        new_cap = max_size();
+
+    table* old = nullptr;
+    if(new_cap != t_->capacity)
+    {
+        auto t = table::allocate(
+            new_cap, t_->salt, sp_);
+        t->incremental = t_->incremental;
+        if(! empty())
+            std::memcpy(
+                static_cast<
+                    void*>(&(*t)[0]),
+                begin(),
+                size() * sizeof(
+                    key_value_pair));
+        t->size = t_->size;
+        std::swap(t_, t);
+        // kept alive so that its cached
+        // digests can seed the rebuild
+        old = t;
+        if(! old->is_small())
+            std::memcpy(
+                &t_->hash(0),
+                &old->hash(0),
+                t_->size * sizeof(
+                    std::size_t));
+    }
+    else
+    {
+        t_->clear();
+    }
+
+    // Rebuild the chains so that buckets
+    // probe elements in insertion order.
+    // The insert path pushes the newest
+    // element at the head of its chain;
+    // for containers built once and then
+    // read, the earliest keys are the
+    // likeliest to be looked up first.
+    // The keys are only re-hashed when
+    // the elements came from a small
+    // table, which has no digest cache.
+    bool const cached =
+        ! old || ! old->is_small();
+    auto p = end();
+    index_t i = t_->size;
+    while(i-- > 0)
+    {
+        --p;
+        auto const hash = cached ?
+            t_->hash(i) :
+            t_->digest(p->key());
+        auto& head = t_->bucket(hash);
+        access::next(*p) = head;
+        head = i;
+        t_->fragment(i) =
+            table::fragment_of(hash,
+                p->key().size());
+        t_->hash(i) = hash;
+        t_->mark(hash);
+    }
+    if(old)
+        table::deallocate(old, sp_);
+}
+
+void
+object::
+thaw() noexcept
+{
+    if(t_->phf == nullptr)
+        return;
+    if(! sp_.is_deallocate_trivial())
+        sp_->deallocate(t_->phf,
+            (2 * t_->phf_buckets +
+                t_->size) *
+                sizeof(std::uint32_t));
+    t_->phf = nullptr;
+    t_->phf_buckets = 0;
+}
+
+// Rebuild the index in place under a new
+// salt. Every cached digest, fragment,
+// chain, and the existence filter derive
+// from the salt, so all of them are redone.
+void
+object::
+rehash_with_salt(
+    std::uintptr_t salt) noexcept
+{
+    BOOST_ASSERT(! t_->is_small());
+    BOOST_ASSERT(! t_->old_table);
+    t_->salt = salt ? salt : 1;
+    t_->clear();
+    auto p = end();
+    index_t i = t_->size;
+    while(i-- > 0)
+    {
+        --p;
+        auto const hash =
+            t_->digest(p->key());
+        auto& head = t_->bucket(hash);
+        access::next(*p) = head;
+        head = i;
+        t_->fragment(i) =
+            table::fragment_of(hash,
+                p->key().size());
+        t_->hash(i) = hash;
+        t_->mark(hash);
+    }
+}
+
+/*  Construct the perfect hash for freeze_phf.
+
+    This is the CHD construction: keys are
+    grouped into buckets by their digest,
+    and each bucket, largest first, searches
+    for a displacement pair (d0, d1) placing
+    all of its keys into element positions
+    no earlier bucket has claimed:
+
+        pos = (pos(h) + d0 * mul(h) + d1) % size
+
+    A bucket with one key always succeeds,
+    because d1 alone reaches every position.
+    Larger buckets can exhaust the search
+    when distinct keys collide too closely
+    under the current salt; the caller then
+    re-salts and tries again.
+*/
+bool
+object::
+build_phf(std::size_t keys_per_bucket)
+{
+    std::size_t const n = t_->size;
+    // the caller chooses the load: a quarter
+    // as many buckets as keys costs two
+    // bytes per key and keeps the search
+    // short, while one bucket per key makes
+    // hard key sets almost always placeable
+    std::uint32_t const m =
+        static_cast<std::uint32_t>(
+            (n + keys_per_bucket - 1) /
+                keys_per_bucket);
+
+    // group element indexes by bucket
+    std::vector<index_t> head(
+        m, index_t(null_index_));
+    std::vector<index_t> next(n);
+    std::vector<std::uint32_t> count(m, 0);
+    for(index_t i = 0; i < n; ++i)
+    {
+        auto const b = t_->hash(i) % m;
+        next[i] = head[b];
+        head[b] = i;
+        ++count[b];
+    }
+
+    // place the largest buckets first,
+    // while positions are plentiful
+    std::vector<std::uint32_t> order(m);
+    for(std::uint32_t b = 0; b < m; ++b)
+        order[b] = b;
+    std::sort(order.begin(), order.end(),
+        [&count](
+            std::uint32_t lhs,
+            std::uint32_t rhs)
+        {
+            return count[lhs] > count[rhs];
+        });
+
+    std::vector<std::uint32_t> d(2 * m, 0);
+    std::vector<bool> used(n, false);
+    // maps each hash slot back to the
+    // element which claimed it, so the
+    // elements keep their insertion order
+    std::vector<std::uint32_t> redirect(n, 0);
+    std::vector<std::size_t> pos;
+    for(auto const b : order)
+    {
+        if(count[b] == 0)
+            break;
+        bool placed = false;
+        for(std::uint32_t d0 = 0;
+            d0 < 256 && ! placed; ++d0)
+        {
+            for(std::size_t d1 = 0;
+                d1 < n && ! placed; ++d1)
+            {
+                pos.clear();
+                bool ok = true;
+                for(auto i = head[b];
+                    i != null_index_;
+                    i = next[i])
+                {
+                    auto const h = t_->hash(i);
+                    auto const p = (
+                        table::phf_pos(h) +
+                        d0 * table::phf_mul(h) +
+                        d1) % n;
+                    if(used[p] ||
+                        std::find(
+                            pos.begin(),
+                            pos.end(), p) !=
+                        pos.end())
+                    {
+                        ok = false;
+                        break;
+                    }
+                    pos.push_back(p);
+                }
+                if(! ok)
+                    continue;
+                auto it = pos.begin();
+                for(auto i = head[b];
+                    i != null_index_;
+                    i = next[i])
+                {
+                    used[*it] = true;
+                    redirect[*it] = i;
+                    ++it;
+                }
+                d[2 * b] = d0;
+                d[2 * b + 1] =
+                    static_cast<
+                        std::uint32_t>(d1);
+                placed = true;
+            }
+        }
+        if(! placed)
+            return false;
+    }
+
+    // one block holds the displacement
+    // pairs followed by the redirects
+    auto const g = static_cast<
+        std::uint32_t*>(sp_->allocate(
+            (2 * m + n) *
+                sizeof(std::uint32_t)));
+    std::memcpy(g, d.data(),
+        2 * m * sizeof(std::uint32_t));
+    std::memcpy(g + 2 * m, redirect.data(),
+        n * sizeof(std::uint32_t));
+    t_->phf = g;
+    t_->phf_buckets = m;
+    return true;
+}
+
+bool
+object::
+freeze_phf()
+{
+    if(t_->is_small())
+        return false;
+    if(t_->phf)
+        return true;
+    if(t_->old_table)
+        finish_rehash();
+    if(t_->size == 0)
+        return false;
+    // each attempt draws an independent
+    // salt; later attempts also spend more
+    // buckets, so a pathological key set
+    // costs displacement table size instead
+    // of failing the construction
+    std::size_t keys_per_bucket = 4;
+    for(int attempt = 0;
+        attempt < 16; ++attempt)
+    {
+        if(attempt > 0)
+        {
+            rehash_with_salt(
+                detail::table_salt(t_));
+            if(attempt >= 4)
+                keys_per_bucket = 2;
+            if(attempt >= 8)
+                keys_per_bucket = 1;
+        }
+        if(build_phf(keys_per_bucket))
+            return true;
+    }
+    return false;
+}
+
+bool
+object::
+frozen() const noexcept
+{
+    return t_->phf != nullptr;
+}
+
+std::size_t
+object::
+bucket_count() const noexcept
+{
+    if(t_->is_small())
+        return 0;
+    return t_->capacity;
+}
+
+std::size_t
+object::
+max_probe_length() const noexcept
+{
+    if(t_->is_small())
+        return size();
+    std::size_t result = 0;
+    for(std::size_t b = 0;
+            b < t_->capacity; ++b)
+    {
+        std::size_t len = 0;
+        auto i = t_->bucket(b);
+        while(i != null_index_)
+        {
+            ++len;
+            i = access::next((*t_)[i]);
+        }
+        if(len > result)
+            result = len;
+    }
+    // chains not yet migrated still live
+    // in the old table's buckets
+    if(auto* const old = t_->old_table)
+        for(std::size_t b = 0;
+                b < old->capacity; ++b)
+        {
+            std::size_t len = 0;
+            auto i = old->bucket(b);
+            while(i != null_index_)
+            {
+                ++len;
+                i = access::next((*t_)[i]);
+            }
+            if(len > result)
+                result = len;
+        }
+    return result;
+}
+
+double
+object::
+load_factor() const noexcept
+{
+    if(t_->is_small())
+        return 0;
+    return static_cast<double>(size()) /
+        static_cast<double>(t_->capacity);
+}
+
+std::vector<std::size_t>
+object::
+probe_distribution() const
+{
+    std::vector<std::size_t> counts;
+    if(t_->is_small())
+        return counts;
+    counts.resize(1);
+    for(std::size_t b = 0;
+            b < t_->capacity; ++b)
+    {
+        std::size_t len = 0;
+        auto i = t_->bucket(b);
+        while(i != null_index_)
+        {
+            ++len;
+            i = access::next((*t_)[i]);
+        }
+        if(len >= counts.size())
+            counts.resize(len + 1);
+        ++counts[len];
+    }
+    // chains not yet migrated still live
+    // in the old table's buckets
+    if(auto* const old = t_->old_table)
+        for(std::size_t b = 0;
+                b < old->capacity; ++b)
+        {
+            std::size_t len = 0;
+            auto i = old->bucket(b);
+            while(i != null_index_)
+            {
+                ++len;
+                i = access::next((*t_)[i]);
+            }
+            if(len >= counts.size())
+                counts.resize(len + 1);
+            ++counts[len];
+        }
+    return counts;
+}
+
+void
+object::
+incremental_rehash(bool enable)
+{
+    if(! enable)
+    {
+        if(t_->capacity == 0)
+            return;
+        if(t_->old_table)
+            finish_rehash();
+        t_->incremental = 0;
+        return;
+    }
+    // the setting lives in the table, so an
+    // empty object needs one of its own; the
+    // shared empty table must not be written
+    if(t_->capacity == 0)
+        reserve(1);
+    t_->incremental = 1;
+}
+
+bool
+object::
+incremental_rehash() const noexcept
+{
+    return t_->incremental != 0;
+}
+
+bool
+object::
+rehash_pending() const noexcept
+{
+    return t_->old_table != nullptr;
+}
+
+void
+object::
+merge(object&& source)
+{
+    if(&source == this || source.empty())
+        return;
+    thaw();
+    auto const n = source.size();
+    auto const n0 = size();
+    if(n > max_size() - n0)
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error( error::object_too_large, &loc );
+    }
+    // size the table once up front; the
+    // insertions below can never rehash
+    reserve(n0 + n);
+    // compact rebuilds the source's index
+    // in full, which a deferred migration
+    // cannot survive; it also relocates
+    // elements, invalidating a perfect hash
+    source.thaw();
+    if(source.t_->old_table)
+        source.finish_rehash();
+
+    bool const same_sp =
+        *source.storage() == *sp_;
+    auto const first = source.begin();
+    auto const last = source.end();
+    auto keep = first;
+    auto src = first;
+
+    // Restores source to a valid state:
+    // closes the gap left by transferred
+    // elements and rebuilds the index.
+    auto const compact =
+    [&](key_value_pair* from)
+    {
+        if(keep != from && from != last)
+            std::memmove(
+                static_cast<void*>(keep),
+                static_cast<void const*>(from),
+                (last - from) *
+                    sizeof(key_value_pair));
+        keep += last - from;
+        auto& t = *source.t_;
+        t.size = static_cast<index_t>(
+            keep - first);
+        if(! t.is_small())
+        {
+            t.clear();
+            index_t i = t.size;
+            auto p = first + t.size;
+            while(i-- > 0)
+            {
+                --p;
+                auto const hash =
+                    t.digest(p->key());
+                auto& head = t.bucket(hash);
+                access::next(*p) = head;
+                head = i;
+                t.fragment(i) =
+                    table::fragment_of(hash,
+                        p->key().size());
+                t.hash(i) = hash;
+                t.mark(hash);
+            }
+        }
+    };
+
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        for(; src != last; ++src)
+        {
+            std::pair<iterator, std::size_t>
+                sr(nullptr, 0);
+            if(! empty())
+                sr = detail::find_in_object(
+                    *this, src->key());
+            if(sr.first)
+            {
+                // collision: the element
+                // stays behind in source
+                if(keep != src)
+                    std::memcpy(
+                        static_cast<void*>(keep),
+                        static_cast<void const*>(src),
+                        sizeof(key_value_pair));
+                ++keep;
+                continue;
+            }
+            if(same_sp)
+            {
+                // transfer without copying
+                insert_impl(
+                    pilfer(*src), sr.second);
+            }
+            else
+            {
+                key_value_pair kv(*src, sp_);
+                insert_impl(
+                    pilfer(kv), sr.second);
+            }
+            src->~key_value_pair();
+        }
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(...)
+    {
+        compact(src);
+        throw;
+    }
+#endif
+    compact(last);
+}
+
 auto
 object::
 erase(const_iterator pos) noexcept ->
@@ -567,6 +1457,190 @@ stable_erase(string_view key) noexcept ->
     return 1;
 }
 
+std::size_t
+object::
+do_erase_if(
+    bool (*pred)(
+        void*, key_value_pair&),
+    void* arg)
+{
+    if(empty())
+        return 0;
+    thaw();
+    // erasure relocates elements, which a
+    // deferred migration cannot track
+    if(t_->old_table)
+        finish_rehash();
+
+    auto const first = begin();
+    auto const last = end();
+    auto keep = first;
+    auto src = first;
+
+    // closes the gap left by erased elements
+    // and rebuilds the index, as merge does
+    // for its source
+    auto const compact =
+    [&](key_value_pair* from)
+    {
+        if(keep != from && from != last)
+            std::memmove(
+                static_cast<void*>(keep),
+                static_cast<void const*>(from),
+                (last - from) *
+                    sizeof(key_value_pair));
+        keep += last - from;
+        auto& t = *t_;
+        t.size = static_cast<index_t>(
+            keep - first);
+        if(! t.is_small())
+        {
+            t.clear();
+            index_t i = t.size;
+            auto p = first + t.size;
+            while(i-- > 0)
+            {
+                --p;
+                auto const hash =
+                    t.digest(p->key());
+                auto& head = t.bucket(hash);
+                detail::access::next(*p) = head;
+                head = i;
+                t.fragment(i) =
+                    table::fragment_of(hash,
+                        p->key().size());
+                t.hash(i) = hash;
+                t.mark(hash);
+            }
+        }
+    };
+
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        for(; src != last; ++src)
+        {
+            if(! pred(arg, *src))
+            {
+                if(keep != src)
+                    std::memcpy(
+                        static_cast<void*>(keep),
+                        static_cast<void const*>(src),
+                        sizeof(key_value_pair));
+                ++keep;
+                continue;
+            }
+            src->~key_value_pair();
+        }
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(...)
+    {
+        // the element that threw, and those
+        // not yet visited, survive
+        compact(src);
+        throw;
+    }
+#endif
+    compact(last);
+    return static_cast<std::size_t>(
+        (last - first) - (keep - first));
+}
+
+void
+object::
+reorder(
+    string_view const* keys,
+    std::size_t count) noexcept
+{
+    if(empty() || count == 0)
+        return;
+    thaw();
+    if(t_->old_table)
+        finish_rehash();
+
+    // stable partition: listed keys move to
+    // the front in the given order, the rest
+    // keep their relative order behind them.
+    // the index is stale while the slab is
+    // permuted, so keys are located with a
+    // linear scan of the unplaced suffix.
+    auto const first = begin();
+    auto const last = end();
+    auto next = first;
+    for(std::size_t i = 0;
+        i < count && next != last; ++i)
+    {
+        for(auto p = next; p != last; ++p)
+        {
+            if(p->key() != keys[i])
+                continue;
+            if(p != next)
+            {
+                // rotate [next, p] one slot
+                // to the right; elements are
+                // relocated bytewise like
+                // erase does
+                unsigned char tmp[
+                    sizeof(key_value_pair)];
+                std::memcpy(
+                    static_cast<void*>(tmp),
+                    static_cast<void const*>(p),
+                    sizeof(key_value_pair));
+                std::memmove(
+                    static_cast<void*>(next + 1),
+                    static_cast<void const*>(next),
+                    (p - next) *
+                        sizeof(key_value_pair));
+                std::memcpy(
+                    static_cast<void*>(next),
+                    static_cast<void const*>(tmp),
+                    sizeof(key_value_pair));
+            }
+            ++next;
+            break;
+        }
+    }
+
+    // rebuild the chains over the permuted
+    // slab, as rehash does
+    if(t_->is_small())
+        return;
+    t_->clear();
+    auto p = last;
+    index_t i = t_->size;
+    while(i-- > 0)
+    {
+        --p;
+        auto const hash =
+            t_->digest(p->key());
+        auto& head = t_->bucket(hash);
+        access::next(*p) = head;
+        head = i;
+        t_->fragment(i) =
+            table::fragment_of(hash,
+                p->key().size());
+        t_->hash(i) = hash;
+        t_->mark(hash);
+    }
+}
+
+value
+object::
+extract(string_view key)
+{
+    auto it = find(key);
+    if(it == end())
+    {
+        BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error( error::out_of_range, &loc );
+    }
+    value jv( pilfer(it->value()) );
+    erase(it);
+    return jv;
+}
+
 void
 object::
 swap(object& other)
@@ -597,7 +1671,7 @@ swap(object& other)
 
 auto
 object::
-operator[](string_view key) ->
+operator[](string_view key) & ->
     value&
 {
     auto const result =
@@ -690,6 +1764,7 @@ insert_impl(
 {
     BOOST_ASSERT(
         capacity() > size());
+    thaw();
     if(t_->is_small())
     {
         auto const pv = ::new(end())
@@ -697,12 +1772,21 @@ insert_impl(
         ++t_->size;
         return pv;
     }
+    // pay down any deferred rebuild before
+    // chain heads are taken by reference
+    if(t_->old_table)
+        migrate_some(detail::rehash_step_);
     auto& head =
         t_->bucket(hash);
     auto const pv = ::new(end())
         key_value_pair(p);
     access::next(*pv) = head;
     head = t_->size;
+    t_->fragment(t_->size) =
+        table::fragment_of(hash,
+            pv->key().size());
+    t_->hash(t_->size) = hash;
+    t_->mark(hash);
     ++t_->size;
     return pv;
 }
@@ -714,9 +1798,15 @@ reserve_impl(std::size_t new_capacity)
 {
     BOOST_ASSERT(
         new_capacity > t_->capacity);
+    // at most one deferred rebuild can be
+    // outstanding; retire it before the
+    // index grows again
+    if(t_->old_table)
+        finish_rehash();
     auto t = table::allocate(
         growth(new_capacity),
             t_->salt, sp_);
+    t->incremental = t_->incremental;
     if(! empty())
         std::memcpy(
             static_cast<
@@ -729,23 +1819,104 @@ reserve_impl(std::size_t new_capacity)
 
     if(! t_->is_small())
     {
+        if(t_->incremental != 0 &&
+            ! t->is_small() &&
+            t_->size > 0)
+        {
+            // defer the chain rebuild: the
+            // old table keeps indexing the
+            // existing elements until every
+            // one of its buckets has been
+            // relinked into this table
+            t_->old_table = t;
+            t_->migrate_pos = 0;
+            return nullptr;
+        }
         // rebuild hash table,
-        // without dup checks
+        // without dup checks. keys are
+        // only re-hashed when the
+        // elements came from a small
+        // table, which has no cache.
+        bool const cached =
+            ! t->is_small();
         auto p = end();
         index_t i = t_->size;
         while(i-- > 0)
         {
             --p;
+            auto const hash = cached ?
+                t->hash(i) :
+                t_->digest(p->key());
             auto& head =
-                t_->bucket(p->key());
+                t_->bucket(hash);
             access::next(*p) = head;
             head = i;
+            t_->fragment(i) =
+                table::fragment_of(hash,
+                    p->key().size());
+            t_->hash(i) = hash;
+            t_->mark(hash);
         }
     }
 
     return t;
 }
 
+void
+object::
+migrate_some(std::size_t buckets) noexcept
+{
+    auto* const old = t_->old_table;
+    BOOST_ASSERT(old != nullptr);
+    BOOST_ASSERT(! t_->is_small());
+    BOOST_ASSERT(! old->is_small());
+    auto b = t_->migrate_pos;
+    auto const last = old->capacity;
+    while(buckets-- > 0 && b < last)
+    {
+        // relink every element of one old
+        // bucket; a whole chain leaves at
+        // once, so old chains never contain
+        // migrated elements
+        auto i = old->bucket(
+            std::size_t(b));
+        while(i != null_index_)
+        {
+            auto& v = (*t_)[i];
+            auto const next =
+                access::next(v);
+            auto const hash = old->hash(i);
+            t_->hash(i) = hash;
+            t_->fragment(i) =
+                old->fragment(i);
+            auto& head = t_->bucket(hash);
+            access::next(v) = head;
+            head = i;
+            t_->mark(hash);
+            i = next;
+        }
+        old->bucket(std::size_t(b)) =
+            null_index_;
+        ++b;
+    }
+    t_->migrate_pos = b;
+    if(b >= last)
+    {
+        t_->old_table = nullptr;
+        t_->migrate_pos = 0;
+        table::deallocate(old, sp_);
+    }
+}
+
+void
+object::
+finish_rehash() noexcept
+{
+    BOOST_ASSERT(t_->old_table != nullptr);
+    migrate_some(t_->old_table->capacity);
+    BOOST_ASSERT(t_->old_table == nullptr);
+}
+
 bool
 object::
 equal(object const& other) const noexcept
@@ -753,7 +1924,10 @@ equal(object const& other) const noexcept
     if(size() != other.size())
         return false;
     auto const end_ = other.end();
-    for(auto e : *this)
+    // iterate by reference; copying an
+    // element would allocate, which a
+    // noexcept function must never do
+    for(auto const& e : *this)
     {
         auto it = other.find(e.key());
         if(it == end_)
@@ -812,6 +1986,9 @@ destroy() noexcept
     BOOST_ASSERT(t_->capacity > 0);
     BOOST_ASSERT(! sp_.is_not_shared_and_deallocate_is_trivial());
     destroy(begin(), end());
+    if(t_->old_table)
+        table::deallocate(
+            t_->old_table, sp_);
     table::deallocate(t_, sp_);
 }
 
@@ -835,6 +2012,11 @@ do_erase(
     FB big_reloc) noexcept
     -> iterator
 {
+    thaw();
+    // erasure relocates elements, which a
+    // deferred migration cannot track
+    if(! t_->is_small() && t_->old_table)
+        finish_rehash();
     auto p = begin() + (pos - begin());
     if(t_->is_small())
     {
@@ -870,6 +2052,10 @@ reindex_relocate(
         static_cast<void*>(dst),
         static_cast<void const*>(src),
         sizeof(*dst));
+    t_->fragment(dst - begin()) =
+        t_->fragment(src - begin());
+    t_->hash(dst - begin()) =
+        t_->hash(src - begin());
     access::next(*dst) = head;
     head = static_cast<
         index_t>(dst - begin());
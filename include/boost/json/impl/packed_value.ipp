@@ -0,0 +1,403 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PACKED_VALUE_IPP
+#define BOOST_JSON_IMPL_PACKED_VALUE_IPP
+
+#include <boost/json/packed_value.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/detail/except.hpp>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// node and object member record sizes; the
+// accessors in packed_value.hpp decode the
+// same layout and must change in lockstep
+std::size_t const packed_node_size = 16;
+std::size_t const packed_member_size = 24;
+
+void
+pack_put32(
+    std::vector<unsigned char>& buf,
+    std::size_t off,
+    std::uint32_t v)
+{
+    std::memcpy(&buf[off], &v, sizeof(v));
+}
+
+void
+pack_put64(
+    std::vector<unsigned char>& buf,
+    std::size_t off,
+    std::uint64_t v)
+{
+    std::memcpy(&buf[off], &v, sizeof(v));
+}
+
+// append n bytes and return their offset,
+// which must remain addressable in 32 bits
+std::size_t
+pack_grow(
+    std::vector<unsigned char>& buf,
+    std::size_t n)
+{
+    std::size_t const off = buf.size();
+    if(n > UINT32_MAX - off)
+    {
+        BOOST_STATIC_CONSTEXPR source_location
+            loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error(
+            error::not_enough_memory, &loc);
+    }
+    buf.resize(off + n);
+    return off;
+}
+
+// keep node blocks eight byte aligned, so
+// records never straddle alignment for no
+// reason after variable length string bytes
+void
+pack_align(
+    std::vector<unsigned char>& buf)
+{
+    pack_grow(buf,
+        (8 - buf.size() % 8) % 8);
+}
+
+// write the node for jv at slot, appending
+// any children after the current end; slot
+// is an offset, not a pointer, because the
+// buffer may relocate while children grow it
+void
+pack_value_at(
+    std::vector<unsigned char>& buf,
+    std::size_t slot,
+    value const& jv)
+{
+    pack_put32(buf, slot,
+        static_cast<std::uint32_t>(
+            jv.kind()));
+    switch(jv.kind())
+    {
+    case kind::null:
+        break;
+    case kind::bool_:
+        pack_put32(buf, slot + 4,
+            jv.get_bool() ? 1 : 0);
+        break;
+    case kind::int64:
+        pack_put64(buf, slot + 8,
+            static_cast<std::uint64_t>(
+                jv.get_int64()));
+        break;
+    case kind::uint64:
+        pack_put64(buf, slot + 8,
+            jv.get_uint64());
+        break;
+    case kind::double_:
+    {
+        double const d = jv.get_double();
+        std::uint64_t v;
+        std::memcpy(&v, &d, sizeof(v));
+        pack_put64(buf, slot + 8, v);
+        break;
+    }
+    case kind::string:
+    {
+        auto const& js = jv.get_string();
+        std::size_t const off =
+            pack_grow(buf, js.size());
+        std::memcpy(&buf[off],
+            js.data(), js.size());
+        pack_put32(buf, slot + 4,
+            static_cast<std::uint32_t>(
+                js.size()));
+        pack_put32(buf, slot + 8,
+            static_cast<std::uint32_t>(off));
+        break;
+    }
+    case kind::array:
+    {
+        auto const& ja = jv.get_array();
+        pack_put32(buf, slot + 4,
+            static_cast<std::uint32_t>(
+                ja.size()));
+        pack_align(buf);
+        std::size_t const block = pack_grow(
+            buf, ja.size() * packed_node_size);
+        pack_put32(buf, slot + 8,
+            static_cast<std::uint32_t>(block));
+        for(std::size_t i = 0;
+                i < ja.size(); ++i)
+            pack_value_at(buf, block +
+                i * packed_node_size, ja[i]);
+        break;
+    }
+    default:
+    {
+        auto const& jo = jv.get_object();
+        pack_put32(buf, slot + 4,
+            static_cast<std::uint32_t>(
+                jo.size()));
+        pack_align(buf);
+        std::size_t const block = pack_grow(
+            buf, jo.size() * packed_member_size);
+        pack_put32(buf, slot + 8,
+            static_cast<std::uint32_t>(block));
+        std::size_t m = block;
+        for(auto const& kv : jo)
+        {
+            auto const key = kv.key();
+            std::size_t const koff =
+                pack_grow(buf, key.size());
+            std::memcpy(&buf[koff],
+                key.data(), key.size());
+            pack_put32(buf, m,
+                static_cast<std::uint32_t>(
+                    koff));
+            pack_put32(buf, m + 4,
+                static_cast<std::uint32_t>(
+                    key.size()));
+            pack_value_at(
+                buf, m + 8, kv.value());
+            m += packed_member_size;
+        }
+        break;
+    }
+    }
+}
+
+} // (anon)
+
+//----------------------------------------------------------
+//
+// packed_value
+//
+//----------------------------------------------------------
+
+packed_value
+packed_value::
+at(std::size_t i) const
+{
+    if(base_)
+    {
+        auto const k = kind();
+        if( (k == json::kind::array ||
+             k == json::kind::object) &&
+            i < load32(off_ + 4))
+        {
+            auto const block =
+                load32(off_ + 8);
+            if(k == json::kind::array)
+                return packed_value(base_,
+                    block + static_cast<
+                        std::uint32_t>(i *
+                            packed_node_size));
+            return packed_value(base_,
+                block + static_cast<
+                    std::uint32_t>(i *
+                        packed_member_size) + 8);
+        }
+    }
+    BOOST_STATIC_CONSTEXPR source_location
+        loc = BOOST_CURRENT_LOCATION;
+    detail::throw_system_error(
+        error::out_of_range, &loc );
+}
+
+string_view
+packed_value::
+key_at(std::size_t i) const
+{
+    if( base_ &&
+        kind() == json::kind::object &&
+        i < load32(off_ + 4))
+    {
+        auto const m = load32(off_ + 8) +
+            static_cast<std::uint32_t>(
+                i * packed_member_size);
+        return string_view(
+            reinterpret_cast<char const*>(
+                base_) + load32(m),
+            load32(m + 4));
+    }
+    BOOST_STATIC_CONSTEXPR source_location
+        loc = BOOST_CURRENT_LOCATION;
+    detail::throw_system_error(
+        error::out_of_range, &loc );
+}
+
+packed_value
+packed_value::
+at(string_view key) const
+{
+    if( base_ &&
+        kind() == json::kind::object)
+    {
+        auto const n = load32(off_ + 4);
+        auto m = load32(off_ + 8);
+        for(std::uint32_t i = 0; i < n; ++i)
+        {
+            string_view const k(
+                reinterpret_cast<char const*>(
+                    base_) + load32(m),
+                load32(m + 4));
+            if(k == key)
+                return packed_value(
+                    base_, m + 8);
+            m += static_cast<std::uint32_t>(
+                packed_member_size);
+        }
+    }
+    BOOST_STATIC_CONSTEXPR source_location
+        loc = BOOST_CURRENT_LOCATION;
+    detail::throw_system_error(
+        error::out_of_range, &loc );
+}
+
+bool
+packed_value::
+contains(
+    string_view key) const noexcept
+{
+    if( ! base_ ||
+        kind() != json::kind::object)
+        return false;
+    auto const n = load32(off_ + 4);
+    auto m = load32(off_ + 8);
+    for(std::uint32_t i = 0; i < n; ++i)
+    {
+        string_view const k(
+            reinterpret_cast<char const*>(
+                base_) + load32(m),
+            load32(m + 4));
+        if(k == key)
+            return true;
+        m += static_cast<std::uint32_t>(
+            packed_member_size);
+    }
+    return false;
+}
+
+value
+packed_value::
+unpack(storage_ptr sp) const
+{
+    switch(kind())
+    {
+    case json::kind::null:
+        return value(nullptr, std::move(sp));
+    case json::kind::bool_:
+        return value(
+            get_bool(), std::move(sp));
+    case json::kind::int64:
+        return value(
+            get_int64(), std::move(sp));
+    case json::kind::uint64:
+        return value(
+            get_uint64(), std::move(sp));
+    case json::kind::double_:
+        return value(
+            get_double(), std::move(sp));
+    case json::kind::string:
+        return value(
+            get_string(), std::move(sp));
+    case json::kind::array:
+    {
+        auto const n = load32(off_ + 4);
+        auto const block = load32(off_ + 8);
+        array a(sp);
+        a.reserve(n);
+        for(std::uint32_t i = 0; i < n; ++i)
+            a.push_back(packed_value(base_,
+                block + i * static_cast<
+                    std::uint32_t>(
+                        packed_node_size)
+                ).unpack(sp));
+        return a;
+    }
+    default:
+    {
+        auto const n = load32(off_ + 4);
+        auto m = load32(off_ + 8);
+        object o(sp);
+        o.reserve(n);
+        for(std::uint32_t i = 0; i < n; ++i)
+        {
+            string_view const k(
+                reinterpret_cast<char const*>(
+                    base_) + load32(m),
+                load32(m + 4));
+            o.emplace(k, packed_value(
+                base_, m + 8).unpack(sp));
+            m += static_cast<std::uint32_t>(
+                packed_member_size);
+        }
+        return o;
+    }
+    }
+}
+
+//----------------------------------------------------------
+//
+// packed_document
+//
+//----------------------------------------------------------
+
+packed_document::
+packed_document(
+    value const& jv,
+    storage_ptr sp)
+    : sp_(std::move(sp))
+{
+    std::vector<unsigned char> buf;
+    pack_grow(buf, packed_node_size);
+    pack_value_at(buf, 0, jv);
+    data_ = static_cast<unsigned char*>(
+        sp_->allocate(buf.size()));
+    size_ = buf.size();
+    std::memcpy(data_,
+        buf.data(), size_);
+}
+
+packed_document::
+~packed_document()
+{
+    if(data_)
+        sp_->deallocate(data_, size_);
+}
+
+packed_document&
+packed_document::
+operator=(
+    packed_document&& other) noexcept
+{
+    if(this == &other)
+        return *this;
+    if(data_)
+        sp_->deallocate(data_, size_);
+    sp_ = std::move(other.sp_);
+    data_ = other.data_;
+    size_ = other.size_;
+    other.data_ = nullptr;
+    other.size_ = 0;
+    return *this;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
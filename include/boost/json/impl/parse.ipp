@@ -14,19 +14,53 @@
 #include <boost/json/parse.hpp>
 #include <boost/json/parser.hpp>
 #include <boost/json/detail/except.hpp>
+#include <boost/json/detail/fast_parser.hpp>
+#include <boost/json/metrics.hpp>
 
+#include <cstdio>
 #include <istream>
+#include <new>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+# define BOOST_JSON_HAS_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
 
 namespace boost {
 namespace json {
 
+namespace {
+
+// shared by the throwing and non-throwing
+// overloads; exceptions propagate from here
 value
-parse(
+parse_impl(
     string_view s,
     error_code& ec,
     storage_ptr sp,
     const parse_options& opt)
 {
+    BOOST_JSON_METRICS_TIMER(
+        mt, metrics_op::parse);
+    BOOST_JSON_METRICS_BYTES(mt, s.size());
+    if( opt.full_buffer_fast_path &&
+        ! opt.allow_comments &&
+        ! opt.allow_trailing_commas &&
+        ! opt.allow_infinity_and_nan &&
+        ! opt.raw_numbers &&
+        ! opt.single_storage &&
+        opt.pair_key.empty() &&
+        ! opt.on_blob &&
+        opt.numbers != number_precision::none )
+    {
+        return detail::fast_parse(
+            s, ec, std::move(sp), opt);
+    }
+
     unsigned char temp[
         BOOST_JSON_STACK_BUFFER_SIZE];
     parser p(storage_ptr(), opt, temp);
@@ -38,34 +72,7 @@ parse(
 }
 
 value
-parse(
-    string_view s,
-    std::error_code& ec,
-    storage_ptr sp,
-    parse_options const& opt)
-{
-    error_code jec;
-    value result = parse(s, jec, std::move(sp), opt);
-    ec = jec;
-    return result;
-}
-
-value
-parse(
-    string_view s,
-    storage_ptr sp,
-    const parse_options& opt)
-{
-    error_code ec;
-    auto jv = parse(
-        s, ec, std::move(sp), opt);
-    if(ec)
-        detail::throw_system_error( ec );
-    return jv;
-}
-
-value
-parse(
+parse_impl(
     std::istream& is,
     error_code& ec,
     storage_ptr sp,
@@ -103,6 +110,92 @@ parse(
     return p.release();
 }
 
+} // (anon)
+
+value
+parse(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp,
+    const parse_options& opt)
+{
+    // memory exhaustion is reported through
+    // ec like any other failure; partially
+    // built state is torn down without
+    // allocating. without exception support
+    // the flow below is straight-line and
+    // allocation failure aborts instead.
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        return parse_impl(
+            s, ec, std::move(sp), opt);
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(std::bad_alloc const&)
+    {
+        BOOST_JSON_FAIL(ec,
+            error::not_enough_memory);
+        return nullptr;
+    }
+#endif
+}
+
+value
+parse(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code jec;
+    value result = parse(s, jec, std::move(sp), opt);
+    ec = jec;
+    return result;
+}
+
+value
+parse(
+    string_view s,
+    storage_ptr sp,
+    const parse_options& opt)
+{
+    // unlike the overload taking an error
+    // code, allocation failure propagates
+    // as bad_alloc here
+    error_code ec;
+    auto jv = parse_impl(
+        s, ec, std::move(sp), opt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+value
+parse(
+    std::istream& is,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        return parse_impl(
+            is, ec, std::move(sp), opt);
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(std::bad_alloc const&)
+    {
+        BOOST_JSON_FAIL(ec,
+            error::not_enough_memory);
+        return nullptr;
+    }
+#endif
+}
+
 value
 parse(
     std::istream& is,
@@ -122,14 +215,161 @@ parse(
     storage_ptr sp,
     parse_options const& opt)
 {
+    // unlike the overload taking an error
+    // code, allocation failure propagates
+    // as bad_alloc here
     error_code ec;
-    auto jv = parse(
+    auto jv = parse_impl(
         is, ec, std::move(sp), opt);
     if(ec)
         detail::throw_system_error( ec );
     return jv;
 }
 
+//----------------------------------------------------------
+
+namespace {
+
+#ifdef BOOST_JSON_HAS_MMAP
+
+// unmaps on scope exit, so that a throwing
+// allocation cannot leak the mapping
+struct mmap_guard
+{
+    void* addr;
+    std::size_t size;
+
+    ~mmap_guard()
+    {
+        ::munmap(addr, size);
+    }
+};
+
+#else
+
+struct fclose_guard
+{
+    std::FILE* f;
+
+    ~fclose_guard()
+    {
+        std::fclose(f);
+    }
+};
+
+#endif
+
+} // namespace
+
+value
+parse_file(
+    char const* path,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+#ifdef BOOST_JSON_HAS_MMAP
+    int const fd = ::open(path, O_RDONLY);
+    if(fd < 0)
+    {
+        BOOST_JSON_FAIL(ec, error::input_error);
+        return nullptr;
+    }
+    struct ::stat st;
+    if( ::fstat(fd, &st) != 0 ||
+        ! S_ISREG(st.st_mode) )
+    {
+        ::close(fd);
+        BOOST_JSON_FAIL(ec, error::input_error);
+        return nullptr;
+    }
+    std::size_t const size =
+        static_cast<std::size_t>(st.st_size);
+    if(size == 0)
+    {
+        // a zero length mapping is not allowed
+        ::close(fd);
+        return parse(
+            string_view(), ec, std::move(sp), opt);
+    }
+    void* const addr = ::mmap(
+        nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(addr == MAP_FAILED)
+    {
+        BOOST_JSON_FAIL(ec, error::input_error);
+        return nullptr;
+    }
+    mmap_guard guard{ addr, size };
+#ifdef POSIX_MADV_SEQUENTIAL
+    // the pages are consumed front to back
+    // exactly once; ask the kernel to read
+    // ahead aggressively and drop behind
+    ::posix_madvise(
+        addr, size, POSIX_MADV_SEQUENTIAL);
+#endif
+    return parse(
+        string_view(
+            static_cast<char const*>(addr), size),
+        ec, std::move(sp), opt);
+#else
+    std::FILE* const f = std::fopen(path, "rb");
+    if(! f)
+    {
+        BOOST_JSON_FAIL(ec, error::input_error);
+        return nullptr;
+    }
+    fclose_guard guard{ f };
+    std::string s;
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    for(;;)
+    {
+        std::size_t const n = std::fread(
+            buf, 1, sizeof(buf), f);
+        s.append(buf, n);
+        if(n < sizeof(buf))
+        {
+            if(std::ferror(f))
+            {
+                BOOST_JSON_FAIL(
+                    ec, error::input_error);
+                return nullptr;
+            }
+            break;
+        }
+    }
+    return parse(s, ec, std::move(sp), opt);
+#endif
+}
+
+value
+parse_file(
+    char const* path,
+    std::error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code jec;
+    value result = parse_file(
+        path, jec, std::move(sp), opt);
+    ec = jec;
+    return result;
+}
+
+value
+parse_file(
+    char const* path,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code ec;
+    auto jv = parse_file(
+        path, ec, std::move(sp), opt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
 } // namespace json
 } // namespace boost
 
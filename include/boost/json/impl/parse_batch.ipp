@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PARSE_BATCH_IPP
+#define BOOST_JSON_IMPL_PARSE_BATCH_IPP
+
+#include <boost/json/parse_batch.hpp>
+#include <boost/json/parser.hpp>
+#include <boost/json/detail/except.hpp>
+
+namespace boost {
+namespace json {
+
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    ec = {};
+    std::vector<value> out;
+    out.reserve(count);
+    // one parser serves every document; resetting
+    // it is much cheaper than constructing it, and
+    // the internal stack retains its capacity from
+    // one document to the next.
+    unsigned char temp[BOOST_JSON_STACK_BUFFER_SIZE];
+    parser pr(storage_ptr(), opt, temp);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        pr.reset(sp);
+        pr.write(docs[i], ec);
+        if(ec.failed())
+            return {};
+        out.push_back(pr.release());
+    }
+    return out;
+}
+
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    std::error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code jec;
+    auto result = parse_batch(
+        docs, count, jec, std::move(sp), opt);
+    ec = jec;
+    return result;
+}
+
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code ec;
+    auto result = parse_batch(
+        docs, count, ec, std::move(sp), opt);
+    if(ec.failed())
+        detail::throw_system_error( ec );
+    return result;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -28,6 +28,13 @@ parse_into(
 {
     parser_for<V> p( opt, &v );
 
+    // with the whole document in hand, a leading
+    // array's length can be counted up front and
+    // the container reserved before any element
+    // is parsed; comments would confuse the scan
+    if( !opt.allow_comments )
+        detail::apply_reserve_hint( p.handler(), sv );
+
     std::size_t n = p.write_some( false, sv.data(), sv.size(), ec );
 
     if( !ec && n < sv.size() )
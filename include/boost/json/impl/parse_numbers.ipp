@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PARSE_NUMBERS_IPP
+#define BOOST_JSON_IMPL_PARSE_NUMBERS_IPP
+
+#include <boost/json/parse_numbers.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/system_error.hpp>
+#include <boost/json/detail/except.hpp>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// stores every number directly into the sink;
+// the only structure allowed is nested arrays
+template<class Sink>
+struct numbers_handler
+{
+    static constexpr std::size_t
+        max_object_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_array_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_key_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_string_size = std::size_t(-1);
+
+    Sink& sink;
+    std::size_t depth = 0;
+
+    explicit
+    numbers_handler(Sink& sink_) noexcept
+        : sink(sink_)
+    {
+    }
+
+    bool
+    fail(error_code& ec, error ev)
+    {
+        BOOST_JSON_FAIL(ec, ev);
+        return false;
+    }
+
+    bool
+    append(double d, error_code& ec)
+    {
+        // a number outside of an array is
+        // not a numeric array text
+        if(BOOST_JSON_UNLIKELY(depth == 0))
+            return fail(ec, error::not_array);
+        return sink.append(d, ec);
+    }
+
+    bool on_document_begin(error_code&) { return true; }
+    bool on_document_end(error_code&) { return true; }
+    bool on_array_begin(error_code&)
+    {
+        ++depth;
+        return true;
+    }
+    bool on_array_end(std::size_t, error_code&)
+    {
+        --depth;
+        return true;
+    }
+    bool on_int64(std::int64_t i, string_view, error_code& ec)
+    {
+        return append(static_cast<double>(i), ec);
+    }
+    bool on_uint64(std::uint64_t u, string_view, error_code& ec)
+    {
+        return append(static_cast<double>(u), ec);
+    }
+    bool on_double(double d, string_view, error_code& ec)
+    {
+        return append(d, ec);
+    }
+    bool on_number_part(string_view, error_code&) { return true; }
+    bool on_object_begin(error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_object_end(std::size_t, error_code&) { return true; }
+    bool on_key_part(string_view, std::size_t, error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_key(string_view, std::size_t, error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_string_part(string_view, std::size_t, error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_string(string_view, std::size_t, error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_bool(bool, error_code& ec)
+    {
+        return fail(ec, error::not_number);
+    }
+    bool on_null(error_code& ec)
+    {
+        if(depth == 0)
+            return fail(ec, error::not_array);
+        return fail(ec, error::not_number);
+    }
+    bool on_comment_part(string_view, error_code&) { return true; }
+    bool on_comment(string_view, error_code&) { return true; }
+};
+
+struct buffer_sink
+{
+    double* dest;
+    std::size_t capacity;
+    std::size_t count;
+
+    bool
+    append(double d, error_code& ec)
+    {
+        if(BOOST_JSON_UNLIKELY(
+            count >= capacity))
+        {
+            BOOST_JSON_FAIL(ec,
+                error::size_mismatch);
+            return false;
+        }
+        dest[count++] = d;
+        return true;
+    }
+};
+
+struct vector_sink
+{
+    std::vector<double>& v;
+
+    bool
+    append(double d, error_code&)
+    {
+        v.push_back(d);
+        return true;
+    }
+};
+
+template<class Sink>
+void
+parse_numbers_impl(
+    string_view s,
+    Sink& sink,
+    error_code& ec,
+    parse_options const& opt)
+{
+    basic_parser<
+        numbers_handler<Sink>> p(opt, sink);
+    std::size_t const n = p.write_some(
+        false, s.data(), s.size(), ec);
+    if(! ec && n < s.size())
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+    }
+}
+
+} // (anon)
+
+std::size_t
+parse_numbers(
+    string_view s,
+    double* dest,
+    std::size_t dest_size,
+    error_code& ec,
+    parse_options const& opt)
+{
+    ec = {};
+    buffer_sink sink{dest, dest_size, 0};
+    parse_numbers_impl(s, sink, ec, opt);
+    return sink.count;
+}
+
+void
+parse_numbers(
+    string_view s,
+    std::vector<double>& dest,
+    error_code& ec,
+    parse_options const& opt)
+{
+    ec = {};
+    dest.clear();
+    vector_sink sink{dest};
+    parse_numbers_impl(s, sink, ec, opt);
+}
+
+std::vector<double>
+parse_numbers(
+    string_view s,
+    parse_options const& opt)
+{
+    error_code ec;
+    std::vector<double> v;
+    parse_numbers(s, v, ec, opt);
+    if(ec.failed())
+        detail::throw_system_error( ec );
+    return v;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2020 Krystian Stasiowski (sdkrystian@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PARSE_OPTIONS_IPP
+#define BOOST_JSON_IMPL_PARSE_OPTIONS_IPP
+
+#include <boost/json/parse_options.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// what one pass over the sample can tell us
+struct sample_stats
+{
+    std::uint64_t bytes = 0;
+    std::uint64_t docs = 0;
+    std::size_t depth = 0;       // deepest nesting
+    std::size_t max_digits = 0;  // longest mantissa
+};
+
+// measure one document; this is a tolerant
+// scan, not a parse, so malformed text only
+// produces skewed counters
+void
+measure(
+    string_view s,
+    sample_stats& st) noexcept
+{
+    ++st.docs;
+    st.bytes += s.size();
+    std::size_t depth = 0;
+    std::size_t sig = 0;
+    bool in_string = false;
+    bool in_number = false;
+    bool in_exp = false;
+    bool leading = true;
+    for(std::size_t i = 0; i < s.size(); ++i)
+    {
+        char const c = s[i];
+        if(in_string)
+        {
+            if(c == '\\')
+                ++i;
+            else if(c == '"')
+                in_string = false;
+            continue;
+        }
+        if(c >= '0' && c <= '9')
+        {
+            if(! in_number)
+            {
+                in_number = true;
+                in_exp = false;
+                leading = true;
+                sig = 0;
+            }
+            if(c == '0' && leading)
+                continue;
+            leading = false;
+            if(! in_exp)
+                ++sig;
+            continue;
+        }
+        if(in_number && (
+            c == '.' || c == '-' || c == '+'))
+            continue;
+        if(in_number && (c == 'e' || c == 'E'))
+        {
+            in_exp = true;
+            continue;
+        }
+        if(in_number)
+        {
+            if(sig > st.max_digits)
+                st.max_digits = sig;
+            in_number = false;
+        }
+        switch(c)
+        {
+        case '"':
+            in_string = true;
+            break;
+        case '{':
+        case '[':
+            if(++depth > st.depth)
+                st.depth = depth;
+            break;
+        case '}':
+        case ']':
+            if(depth > 0)
+                --depth;
+            break;
+        default:
+            break;
+        }
+    }
+    if(in_number && sig > st.max_digits)
+        st.max_digits = sig;
+}
+
+} // (anon)
+
+parse_options
+parse_options::
+adaptive(
+    string_view const* samples,
+    std::size_t n) noexcept
+{
+    sample_stats st;
+    for(std::size_t i = 0; i < n; ++i)
+        measure(samples[i], st);
+
+    parse_options opt;
+
+    // leave generous headroom over the deepest
+    // structure observed, and never go below
+    // the default
+    if(2 * st.depth > opt.max_depth)
+        opt.max_depth = 2 * st.depth;
+
+    // a double survives the fast conversion
+    // unchanged up to 15 significant digits;
+    // longer mantissas in the sample mean the
+    // precision modes actually differ
+    if(st.max_digits > 15)
+        opt.numbers = number_precision::precise;
+
+    // the two-stage engine needs documents
+    // large enough to amortize the extra
+    // indexing pass
+    if( st.docs != 0 &&
+        st.bytes / st.docs >= 4096)
+        opt.full_buffer_fast_path = true;
+
+    return opt;
+}
+
+parse_options
+parse_options::
+adaptive(string_view sample) noexcept
+{
+    return adaptive(&sample, 1);
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
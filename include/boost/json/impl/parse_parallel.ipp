@@ -0,0 +1,571 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PARSE_PARALLEL_IPP
+#define BOOST_JSON_IMPL_PARSE_PARALLEL_IPP
+
+#include <boost/json/parse_parallel.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/fast_parser.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// one top-level element of the container root
+struct subtree
+{
+    string_view key;   // text between the key quotes; object roots only
+    bool escaped_key;
+    string_view text;  // the element value, trimmed
+};
+
+string_view
+trimmed(
+    char const* first,
+    char const* last) noexcept
+{
+    first = detail::count_whitespace(first, last);
+    while(last != first && (
+        last[-1] == ' ' || last[-1] == '\t' ||
+        last[-1] == '\r' || last[-1] == '\n'))
+        --last;
+    return string_view(first,
+        static_cast<std::size_t>(last - first));
+}
+
+/*  Identify the top-level elements of a container
+    root from the structural index. Returns false
+    when the document shape does not admit
+    partitioning; malformed shapes also return
+    false, leaving the precise diagnostics to the
+    sequential parser.
+*/
+bool
+partition_root(
+    string_view s,
+    std::vector<std::size_t> const& idx,
+    bool& object_root,
+    std::vector<subtree>& out)
+{
+    if(idx.empty())
+        return false;
+    char const* const p = s.data();
+    char const* const send = p + s.size();
+    std::size_t const open = idx[0];
+    if(p[open] != '{' && p[open] != '[')
+        return false;
+    if(detail::count_whitespace(
+            p, p + open) != p + open)
+        return false;
+    object_root = p[open] == '{';
+    char const close = object_root ? '}' : ']';
+    std::size_t const n = idx.size();
+    std::size_t i = 1;
+    std::size_t pos = open + 1;
+    for(;;)
+    {
+        if(i >= n)
+            return false;
+        subtree st;
+        if(object_root)
+        {
+            if(p[idx[i]] == close && out.empty())
+            {
+                // possibly an empty object
+                if(detail::count_whitespace(p + pos,
+                        p + idx[i]) != p + idx[i])
+                    return false;
+                pos = idx[i] + 1;
+                break;
+            }
+            // a key, then a colon
+            if(p[idx[i]] != '"')
+                return false;
+            if(detail::count_whitespace(p + pos,
+                    p + idx[i]) != p + idx[i])
+                return false;
+            if(i + 1 >= n)
+                return false;
+            std::size_t const k0 = idx[i];
+            std::size_t const k1 = idx[i + 1];
+            if(p[k1] != '"')
+                return false;
+            st.key = string_view(
+                p + k0 + 1, k1 - k0 - 1);
+            st.escaped_key = std::memchr(st.key.data(),
+                '\\', st.key.size()) != nullptr;
+            i += 2;
+            if(i >= n || p[idx[i]] != ':')
+                return false;
+            if(detail::count_whitespace(p + k1 + 1,
+                    p + idx[i]) != p + idx[i])
+                return false;
+            pos = idx[i] + 1;
+            ++i;
+        }
+        // find the end of the element, at depth zero
+        std::size_t depth = 0;
+        std::size_t end;
+        bool last = false;
+        for(;;)
+        {
+            if(i >= n)
+                return false;
+            char const c = p[idx[i]];
+            if(c == '"')
+            {
+                // strings index in pairs
+                i += 2;
+                continue;
+            }
+            if(c == '{' || c == '[')
+            {
+                ++depth;
+                ++i;
+                continue;
+            }
+            if(c == '}' || c == ']')
+            {
+                if(depth > 0)
+                {
+                    --depth;
+                    ++i;
+                    continue;
+                }
+                if(c != close)
+                    return false;
+                end = idx[i];
+                last = true;
+                break;
+            }
+            if(c == ',')
+            {
+                if(depth > 0)
+                {
+                    ++i;
+                    continue;
+                }
+                end = idx[i];
+                break;
+            }
+            // a colon
+            if(depth == 0)
+                return false;
+            ++i;
+        }
+        st.text = trimmed(p + pos, p + end);
+        if(st.text.empty())
+        {
+            // an empty array, or a missing element
+            if(! last || object_root || ! out.empty())
+                return false;
+        }
+        else
+        {
+            out.push_back(st);
+        }
+        pos = end + 1;
+        ++i;
+        if(last)
+            break;
+    }
+    // only whitespace may follow the root
+    return detail::count_whitespace(
+        p + pos, send) == send;
+}
+
+// group contiguous elements into chunks of
+// roughly equal text size; first[i] is the
+// first element of chunk i, first[n] the total
+void
+plan_chunks(
+    std::vector<subtree> const& elems,
+    std::size_t n,
+    std::vector<std::size_t>& first)
+{
+    std::size_t total = 0;
+    for(auto const& st : elems)
+        total += st.key.size() + st.text.size();
+    first.clear();
+    first.reserve(n + 1);
+    first.push_back(0);
+    std::size_t acc = 0;
+    std::size_t i = 0;
+    for(std::size_t c = 1; c < n; ++c)
+    {
+        std::size_t const target = c * (total / n);
+        while(acc < target && i < elems.size())
+        {
+            acc += elems[i].key.size() +
+                elems[i].text.size();
+            ++i;
+        }
+        first.push_back(i);
+    }
+    first.push_back(elems.size());
+}
+
+/*  Uninitialized storage for the top-level
+    elements. The chunks track the lifetimes of
+    the values they construct, and on assembly
+    ownership passes to the new container, so the
+    buffer only ever owns the bytes.
+*/
+struct value_buffer
+{
+    value* p;
+
+    explicit
+    value_buffer(std::size_t n)
+        : p(static_cast<value*>(
+            ::operator new(n * sizeof(value))))
+    {
+    }
+
+    ~value_buffer()
+    {
+        ::operator delete(p);
+    }
+};
+
+// the state shared by one parallel parse; chunk
+// i parses elements [first(i), first(i + 1))
+// directly into its slots of the buffer, each
+// chunk building into its own shared arena.
+struct subtree_job
+{
+    subtree const* elems;
+    parse_options const* opt;
+    value* buf;
+    bool object_root;
+    std::vector<std::size_t> first;
+    std::vector<std::size_t> constructed;
+    std::vector<error_code> errors;
+    std::vector<std::exception_ptr> exceptions;
+
+    static
+    void
+    run(void* arg, std::size_t i)
+    {
+        auto& j = *static_cast<
+            subtree_job*>(arg);
+#ifndef BOOST_NO_EXCEPTIONS
+        try
+#endif
+        {
+            j.parse_chunk(i);
+        }
+#ifndef BOOST_NO_EXCEPTIONS
+        catch(...)
+        {
+            j.exceptions[i] =
+                std::current_exception();
+        }
+#endif
+    }
+
+    void
+    parse_chunk(std::size_t i)
+    {
+        storage_ptr sp = make_shared_resource<
+            monotonic_resource>();
+        error_code& ec = errors[i];
+        std::size_t const f1 = first[i + 1];
+        value* slot = buf + (object_root ?
+            2 * first[i] : first[i]);
+        for(std::size_t k = first[i]; k < f1; ++k)
+        {
+            subtree const& st = elems[k];
+            if(object_root)
+            {
+                if(! st.escaped_key)
+                {
+                    detail::access::construct_value(
+                        slot, detail::key_t{},
+                        st.key, sp);
+                }
+                else
+                {
+                    // the key contains escapes;
+                    // its quoted span is a JSON
+                    // text which parses to the
+                    // unescaped characters
+                    string_view const quoted(
+                        st.key.data() - 1,
+                        st.key.size() + 2);
+                    value kjv = detail::fast_parse(
+                        quoted, ec, sp, *opt);
+                    if(ec.failed())
+                        return;
+                    detail::access::construct_value(
+                        slot, detail::key_t{},
+                        kjv.get_string().subview(),
+                        sp);
+                }
+                ++slot;
+                ++constructed[i];
+            }
+            value jv = detail::fast_parse(
+                st.text, ec, sp, *opt);
+            if(ec.failed())
+                return;
+            detail::access::construct_value(
+                slot, pilfer(jv));
+            ++slot;
+            ++constructed[i];
+        }
+    }
+};
+
+value
+parse_parallel_impl(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt,
+    std::size_t n,
+    executor* ex)
+{
+    ec = {};
+
+    // options outside the indexed engine fall
+    // back to the sequential parser
+    if( opt.allow_comments ||
+        opt.allow_trailing_commas ||
+        opt.allow_infinity_and_nan ||
+        opt.raw_numbers ||
+        opt.single_storage ||
+        ! opt.pair_key.empty() ||
+        opt.on_blob ||
+        opt.numbers == number_precision::none )
+        return parse(s, ec, std::move(sp), opt);
+
+    std::vector<std::size_t> idx;
+    if(! detail::build_index(s, idx, ec))
+    {
+        // let the sequential parser produce
+        // the precise diagnostic
+        ec = {};
+        return parse(s, ec, std::move(sp), opt);
+    }
+
+    bool object_root;
+    std::vector<subtree> elems;
+    if( ! partition_root(
+            s, idx, object_root, elems) ||
+        elems.size() > (object_root ?
+            object::max_size() : array::max_size()))
+    {
+        ec = {};
+        return parse(s, ec, std::move(sp), opt);
+    }
+
+    if(n > elems.size())
+        n = elems.size();
+    if(n <= 1)
+    {
+        // a single chunk is just the plain fast
+        // path, reusing the index
+        return detail::fast_parse(
+            s, idx, ec, std::move(sp), opt);
+    }
+
+    std::size_t const total = elems.size();
+
+    subtree_job j;
+    j.elems = elems.data();
+    j.opt = &opt;
+    j.object_root = object_root;
+    plan_chunks(elems, n, j.first);
+    j.constructed.resize(n);
+    j.errors.resize(n);
+    j.exceptions.resize(n);
+
+    value_buffer buf(object_root ?
+        2 * total : total);
+    j.buf = buf.p;
+
+    detail::parallel_run(ex, n,
+        &subtree_job::run, &j);
+
+    std::exception_ptr ep;
+    error_code jec;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(j.exceptions[i] && ! ep)
+            ep = j.exceptions[i];
+        if(j.errors[i].failed() && ! jec.failed())
+            // first error in document order
+            jec = j.errors[i];
+    }
+    if(ep || jec.failed())
+    {
+        // unwind whatever the chunks built
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            value* p = buf.p + (object_root ?
+                2 * j.first[i] : j.first[i]);
+            for(std::size_t k = 0;
+                    k < j.constructed[i]; ++k)
+                p[k].~value();
+        }
+        if(ep)
+            std::rethrow_exception(ep);
+        ec = jec;
+        return nullptr;
+    }
+
+    // link the elements under the parent
+    // container; relocation transfers their
+    // ownership to the container, and each value
+    // keeps its chunk arena alive through its
+    // storage pointer
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+#endif
+    {
+        alignas(value) unsigned char
+            tmp[sizeof(value)];
+        value* const pv =
+            reinterpret_cast<value*>(tmp);
+        if(object_root)
+            detail::access::construct_value(pv,
+                detail::unchecked_object(
+                    buf.p, total, sp,
+                    opt.on_duplicate_key));
+        else
+            detail::access::construct_value(pv,
+                detail::unchecked_array(
+                    buf.p, total, sp));
+        value jv(pilfer(*pv));
+        pv->~value();
+        return jv;
+    }
+#ifndef BOOST_NO_EXCEPTIONS
+    catch(system_error const& e)
+    {
+        // the duplicate key policy failed
+        // the object
+        if(e.code() != error::duplicate_key)
+            throw;
+        ec = e.code();
+        return nullptr;
+    }
+#endif
+}
+
+} // (anon)
+
+value
+parse_parallel(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt,
+    unsigned threads)
+{
+    std::size_t n = threads == 0 ? 1 : threads;
+    unsigned const hw =
+        std::thread::hardware_concurrency();
+    if(hw != 0 && n > hw)
+        n = hw;
+    return parse_parallel_impl(
+        s, ec, std::move(sp), opt, n, nullptr);
+}
+
+value
+parse_parallel(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt,
+    unsigned threads)
+{
+    error_code jec;
+    auto jv = parse_parallel(
+        s, jec, std::move(sp), opt, threads);
+    ec = jec;
+    return jv;
+}
+
+value
+parse_parallel(
+    string_view s,
+    storage_ptr sp,
+    parse_options const& opt,
+    unsigned threads)
+{
+    error_code ec;
+    auto jv = parse_parallel(
+        s, ec, std::move(sp), opt, threads);
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    std::size_t n = ex.concurrency();
+    if(n == 0)
+        n = 1;
+    return parse_parallel_impl(
+        s, ec, std::move(sp), opt, n, &ex);
+}
+
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    std::error_code& ec,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code jec;
+    auto jv = parse_parallel(
+        s, ex, jec, std::move(sp), opt);
+    ec = jec;
+    return jv;
+}
+
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    storage_ptr sp,
+    parse_options const& opt)
+{
+    error_code ec;
+    auto jv = parse_parallel(
+        s, ex, ec, std::move(sp), opt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -32,6 +32,19 @@ parser(
         buffer,
         size)
 {
+    p_.handler().st.on_duplicate_key(
+        opt.on_duplicate_key);
+    p_.handler().st.raw_numbers(
+        opt.raw_numbers);
+    p_.handler().st.single_storage(
+        opt.single_storage);
+    p_.handler().st.pair_arrays(
+        opt.pair_key, opt.pair_value);
+    p_.handler().blobs(
+        opt.on_blob,
+        opt.blob_user,
+        opt.blob_keys,
+        opt.blob_keys_count);
     reset();
 }
 
@@ -45,6 +58,19 @@ parser(
         nullptr,
         0)
 {
+    p_.handler().st.on_duplicate_key(
+        opt.on_duplicate_key);
+    p_.handler().st.raw_numbers(
+        opt.raw_numbers);
+    p_.handler().st.single_storage(
+        opt.single_storage);
+    p_.handler().st.pair_arrays(
+        opt.pair_key, opt.pair_value);
+    p_.handler().blobs(
+        opt.on_blob,
+        opt.blob_user,
+        opt.blob_keys,
+        opt.blob_keys_count);
     reset();
 }
 
@@ -56,6 +82,15 @@ reset(storage_ptr sp) noexcept
     p_.handler().st.reset(sp);
 }
 
+void
+parser::
+shrink_to_fit() noexcept
+{
+    reset();
+    p_.shrink_to_fit();
+    p_.handler().st.shrink_to_fit();
+}
+
 std::size_t
 parser::
 write_some(
@@ -0,0 +1,591 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PATCH_IPP
+#define BOOST_JSON_IMPL_PATCH_IPP
+
+#include <boost/json/patch.hpp>
+#include <boost/json/pilfer.hpp>
+#include <boost/json/detail/except.hpp>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+std::size_t const token_npos = std::size_t(-1);
+
+// return the array index of an unescaped token,
+// or npos if the token is not a valid index
+std::size_t
+token_index(std::string const& key) noexcept
+{
+    if(key.empty())
+        return token_npos;
+    if(key.size() > 1 && key[0] == '0')
+        return token_npos;
+    std::size_t n = 0;
+    for(char const c : key)
+    {
+        if(c < '0' || c > '9')
+            return token_npos;
+        std::size_t const d =
+            static_cast<std::size_t>(c - '0');
+        if(n > (token_npos - d) / 10)
+            return token_npos;
+        n = n * 10 + d;
+    }
+    return n;
+}
+
+} // (anon)
+
+bool
+patch::
+parse_pointer(
+    string_view sv,
+    std::vector<token>& toks,
+    error_code& ec)
+{
+    toks.clear();
+    if(sv.empty())
+        return true;
+    if(sv[0] != '/')
+    {
+        BOOST_JSON_FAIL(ec, error::missing_slash);
+        return false;
+    }
+    std::size_t pos = 1;
+    for(;;)
+    {
+        std::size_t const end =
+            sv.find('/', pos);
+        string_view const raw = sv.substr(
+            pos, end == string_view::npos ?
+                string_view::npos : end - pos);
+        token tok;
+        tok.key.reserve(raw.size());
+        for(std::size_t i = 0;
+            i < raw.size(); ++i)
+        {
+            if(raw[i] != '~')
+            {
+                tok.key.push_back(raw[i]);
+                continue;
+            }
+            if(i + 1 >= raw.size() ||
+                (raw[i + 1] != '0' &&
+                 raw[i + 1] != '1'))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::invalid_escape);
+                return false;
+            }
+            tok.key.push_back(
+                raw[++i] == '0' ? '~' : '/');
+        }
+        tok.index = token_index(tok.key);
+        toks.push_back(std::move(tok));
+        if(end == string_view::npos)
+            return true;
+        pos = end + 1;
+    }
+}
+
+void
+patch::
+compile(
+    value const& doc,
+    error_code& ec)
+{
+    ec = {};
+    ops_.clear();
+
+    array const* pa = doc.if_array();
+    if(! pa)
+    {
+        BOOST_JSON_FAIL(ec, error::invalid_patch);
+        return;
+    }
+    ops_.reserve(pa->size());
+    for(value const& jv : *pa)
+    {
+        object const* po = jv.if_object();
+        if(! po)
+        {
+            BOOST_JSON_FAIL(ec,
+                error::invalid_patch);
+            break;
+        }
+
+        operation op;
+
+        value const* jop = po->if_contains("op");
+        if(! jop || ! jop->is_string())
+        {
+            BOOST_JSON_FAIL(ec,
+                error::invalid_patch);
+            break;
+        }
+        string_view const name =
+            jop->get_string();
+        if(name == "add")
+            op.kind = op_kind::add;
+        else if(name == "remove")
+            op.kind = op_kind::remove;
+        else if(name == "replace")
+            op.kind = op_kind::replace;
+        else if(name == "move")
+            op.kind = op_kind::move;
+        else if(name == "copy")
+            op.kind = op_kind::copy;
+        else if(name == "test")
+            op.kind = op_kind::test;
+        else
+        {
+            BOOST_JSON_FAIL(ec,
+                error::invalid_patch);
+            break;
+        }
+
+        value const* jpath =
+            po->if_contains("path");
+        if(! jpath || ! jpath->is_string() ||
+            ! parse_pointer(
+                jpath->get_string(),
+                op.path, ec))
+        {
+            if(! ec.failed())
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::invalid_patch);
+            }
+            break;
+        }
+
+        if(op.kind == op_kind::move ||
+            op.kind == op_kind::copy)
+        {
+            value const* jfrom =
+                po->if_contains("from");
+            if(! jfrom || ! jfrom->is_string() ||
+                ! parse_pointer(
+                    jfrom->get_string(),
+                    op.from, ec))
+            {
+                if(! ec.failed())
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::invalid_patch);
+                }
+                break;
+            }
+
+            // the root cannot be moved
+            if(op.kind == op_kind::move &&
+                op.from.empty())
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::invalid_patch);
+                break;
+            }
+
+            // a location cannot be moved
+            // into one of its children
+            if(op.kind == op_kind::move &&
+                op.from.size() < op.path.size())
+            {
+                bool prefix = true;
+                for(std::size_t i = 0;
+                    i < op.from.size(); ++i)
+                {
+                    if(op.from[i].key !=
+                        op.path[i].key)
+                    {
+                        prefix = false;
+                        break;
+                    }
+                }
+                if(prefix)
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::invalid_patch);
+                    break;
+                }
+            }
+        }
+
+        if(op.kind == op_kind::add ||
+            op.kind == op_kind::replace ||
+            op.kind == op_kind::test)
+        {
+            value const* jval =
+                po->if_contains("value");
+            if(! jval)
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::invalid_patch);
+                break;
+            }
+            op.operand = *jval;
+        }
+
+        if(op.kind == op_kind::remove &&
+            op.path.empty())
+        {
+            // the root cannot be removed
+            BOOST_JSON_FAIL(ec,
+                error::invalid_patch);
+            break;
+        }
+
+        ops_.push_back(std::move(op));
+    }
+
+    if(ec.failed())
+        ops_.clear();
+}
+
+void
+patch::
+compile(
+    value const& doc,
+    std::error_code& ec)
+{
+    error_code jec;
+    compile(doc, jec);
+    ec = jec;
+}
+
+void
+patch::
+compile(value const& doc)
+{
+    error_code ec;
+    compile(doc, ec);
+    if(ec.failed())
+        detail::throw_system_error( ec );
+}
+
+value*
+patch::
+resolve(
+    value* jv,
+    token const* first,
+    std::size_t n,
+    error_code& ec)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        token const& tok = first[i];
+        if(object* po = jv->if_object())
+        {
+            auto const it = po->find(tok.key);
+            if(it == po->end())
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::not_found);
+                return nullptr;
+            }
+            jv = &it->value();
+        }
+        else if(array* pa = jv->if_array())
+        {
+            if(tok.index == token_npos)
+            {
+                if(tok.key == "-")
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::past_the_end);
+                }
+                else
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::token_not_number);
+                }
+                return nullptr;
+            }
+            if(tok.index >= pa->size())
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::not_found);
+                return nullptr;
+            }
+            jv = pa->data() + tok.index;
+        }
+        else
+        {
+            BOOST_JSON_FAIL(ec,
+                error::value_is_scalar);
+            return nullptr;
+        }
+    }
+    return jv;
+}
+
+bool
+patch::
+insert_at(
+    value& target,
+    std::vector<token> const& path,
+    value&& jv,
+    error_code& ec)
+{
+    if(path.empty())
+    {
+        target = std::move(jv);
+        return true;
+    }
+    value* parent = resolve(&target,
+        path.data(), path.size() - 1, ec);
+    if(! parent)
+        return false;
+    token const& last = path.back();
+    if(object* po = parent->if_object())
+    {
+        po->insert_or_assign(
+            last.key, std::move(jv));
+        return true;
+    }
+    if(array* pa = parent->if_array())
+    {
+        std::size_t pos = last.index;
+        if(pos == token_npos)
+        {
+            if(last.key != "-")
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::token_not_number);
+                return false;
+            }
+            pos = pa->size();
+        }
+        if(pos > pa->size())
+        {
+            BOOST_JSON_FAIL(ec,
+                error::not_found);
+            return false;
+        }
+        pa->insert(pa->begin() + pos,
+            std::move(jv));
+        return true;
+    }
+    BOOST_JSON_FAIL(ec, error::value_is_scalar);
+    return false;
+}
+
+std::size_t
+patch::
+do_apply(
+    value& target,
+    error_code& ec) const
+{
+    std::size_t n = 0;
+    for(operation const& op : ops_)
+    {
+        switch(op.kind)
+        {
+        case op_kind::add:
+        {
+            // one copy, straight into the
+            // target's storage
+            value tmp(op.operand,
+                target.storage());
+            if(! insert_at(target, op.path,
+                    std::move(tmp), ec))
+                return n;
+            break;
+        }
+
+        case op_kind::move:
+        case op_kind::copy:
+        {
+            value* src = resolve(&target,
+                op.from.data(),
+                op.from.size(), ec);
+            if(! src)
+                return n;
+            if(op.kind == op_kind::copy)
+            {
+                // copy before inserting, since
+                // the source may alias storage
+                // the insertion relocates
+                value tmp(*src,
+                    target.storage());
+                if(! insert_at(target, op.path,
+                        std::move(tmp), ec))
+                    return n;
+                break;
+            }
+            // compile() rejects moves
+            // from the root
+            BOOST_ASSERT(! op.from.empty());
+
+            // detach the subtree by pilfer,
+            // then erase the vacated slot
+            value* parent = resolve(
+                &target, op.from.data(),
+                op.from.size() - 1, ec);
+            BOOST_ASSERT(parent);
+            token const& last = op.from.back();
+            value tmp(pilfer(*src));
+            if(object* po = parent->if_object())
+                po->erase(po->find(last.key));
+            else
+                parent->get_array().erase(
+                    parent->get_array().begin() +
+                        last.index);
+            if(! insert_at(target, op.path,
+                    std::move(tmp), ec))
+                return n;
+            break;
+        }
+
+        case op_kind::remove:
+        {
+            value* parent = resolve(&target,
+                op.path.data(),
+                op.path.size() - 1, ec);
+            if(! parent)
+                return n;
+            token const& last = op.path.back();
+            if(object* po = parent->if_object())
+            {
+                auto const it =
+                    po->find(last.key);
+                if(it == po->end())
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::not_found);
+                    return n;
+                }
+                po->erase(it);
+            }
+            else if(array* pa = parent->if_array())
+            {
+                if(last.index == token_npos ||
+                    last.index >= pa->size())
+                {
+                    BOOST_JSON_FAIL(ec,
+                        error::not_found);
+                    return n;
+                }
+                pa->erase(
+                    pa->begin() + last.index);
+            }
+            else
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::value_is_scalar);
+                return n;
+            }
+            break;
+        }
+
+        case op_kind::replace:
+        {
+            value* jv = resolve(&target,
+                op.path.data(),
+                op.path.size(), ec);
+            if(! jv)
+                return n;
+            *jv = op.operand;
+            break;
+        }
+
+        default:
+        case op_kind::test:
+        {
+            value* jv = resolve(&target,
+                op.path.data(),
+                op.path.size(), ec);
+            if(! jv)
+                return n;
+            if(! (*jv == op.operand))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::test_failure);
+                return n;
+            }
+            break;
+        }
+        }
+        ++n;
+    }
+    return n;
+}
+
+std::size_t
+patch::
+apply(
+    value& target,
+    error_code& ec) const
+{
+    ec = {};
+    return do_apply(target, ec);
+}
+
+std::size_t
+patch::
+apply(
+    value& target,
+    std::error_code& ec) const
+{
+    error_code jec;
+    auto const n = apply(target, jec);
+    ec = jec;
+    return n;
+}
+
+std::size_t
+patch::
+apply(value& target) const
+{
+    error_code ec;
+    auto const n = apply(target, ec);
+    if(ec.failed())
+        detail::throw_system_error( ec );
+    return n;
+}
+
+void
+apply_merge_patch(
+    value& target,
+    value const& mp)
+{
+    object const* po = mp.if_object();
+    if(! po)
+    {
+        target = mp;
+        return;
+    }
+    if(! target.is_object())
+        target.emplace_object();
+    object& to = target.get_object();
+    for(key_value_pair const& kv : *po)
+    {
+        if(kv.value().is_null())
+        {
+            to.erase(kv.key());
+            continue;
+        }
+        auto it = to.find(kv.key());
+        if(it == to.end())
+            it = to.emplace(
+                kv.key(), nullptr).first;
+        apply_merge_patch(
+            it->value(), kv.value());
+    }
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
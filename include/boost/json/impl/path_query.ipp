@@ -0,0 +1,536 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_PATH_QUERY_IPP
+#define BOOST_JSON_IMPL_PATH_QUERY_IPP
+
+#include <boost/json/path_query.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/detail/except.hpp>
+#include <utility>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// handler for basic_parser which tracks the
+// current path through the document and only
+// materializes subtrees matching the query.
+class path_selector
+{
+    // match progress for a path which can
+    // no longer match any prefix of the query
+    static constexpr std::size_t
+        dead_ = std::size_t(-1);
+
+    struct frame
+    {
+        // number of query segments consumed
+        // to reach this container, or dead_
+        std::size_t progress;
+
+        // progress of the pending member,
+        // set when its key completes
+        std::size_t child;
+
+        // index of the next element, for
+        // array containers
+        std::size_t index;
+
+        bool is_object;
+    };
+
+    path_query const& q_;
+    std::vector<frame> stack_;
+    std::string key_;
+
+    // depth within a matched subtree which
+    // is being materialized, or zero
+    std::size_t collect_ = 0;
+
+    // number of completed matches pushed
+    std::size_t matches_ = 0;
+
+public:
+    static constexpr std::size_t
+        max_object_size = object::max_size();
+
+    static constexpr std::size_t
+        max_array_size = array::max_size();
+
+    static constexpr std::size_t
+        max_key_size = string::max_size();
+
+    static constexpr std::size_t
+        max_string_size = string::max_size();
+
+    value_stack st;
+
+    explicit
+    path_selector(
+        path_query const& q) noexcept
+        : q_(q)
+    {
+    }
+
+    array
+    release()
+    {
+        st.push_array(matches_);
+        auto jv = st.release();
+        return std::move(jv.get_array());
+    }
+
+private:
+    // progress of the value about to begin,
+    // without consuming an array slot
+    std::size_t
+    peek() const noexcept
+    {
+        if(stack_.empty())
+            return 0;
+        auto const& f = stack_.back();
+        if( f.progress == dead_ ||
+            f.progress == q_.segments_.size())
+            return dead_;
+        if(f.is_object)
+            return f.child;
+        auto const& seg =
+            q_.segments_[f.progress];
+        if( seg.kind != path_query::
+                seg_kind::index &&
+            seg.kind != path_query::
+                seg_kind::wildcard)
+            return dead_;
+        if( seg.kind == path_query::
+                seg_kind::index &&
+            seg.index != f.index)
+            return dead_;
+        return f.progress + 1;
+    }
+
+    // progress of the value beginning now,
+    // consuming its array slot
+    std::size_t
+    slot() noexcept
+    {
+        auto const p = peek();
+        if( ! stack_.empty() &&
+            ! stack_.back().is_object)
+            ++stack_.back().index;
+        return p;
+    }
+
+    bool
+    matched(std::size_t p) const noexcept
+    {
+        return p == q_.segments_.size();
+    }
+
+    bool
+    begin_container(bool is_object)
+    {
+        if(collect_)
+        {
+            ++collect_;
+            return true;
+        }
+        auto const p = slot();
+        if(matched(p))
+        {
+            collect_ = 1;
+            return true;
+        }
+        stack_.push_back(
+            {p, dead_, 0, is_object});
+        return true;
+    }
+
+public:
+    bool
+    on_document_begin(error_code&)
+    {
+        return true;
+    }
+
+    bool
+    on_document_end(error_code&)
+    {
+        return true;
+    }
+
+    bool
+    on_object_begin(error_code&)
+    {
+        return begin_container(true);
+    }
+
+    bool
+    on_object_end(
+        std::size_t n, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_object(n);
+            if(--collect_ == 0)
+                ++matches_;
+            return true;
+        }
+        stack_.pop_back();
+        return true;
+    }
+
+    bool
+    on_array_begin(error_code&)
+    {
+        return begin_container(false);
+    }
+
+    bool
+    on_array_end(
+        std::size_t n, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_array(n);
+            if(--collect_ == 0)
+                ++matches_;
+            return true;
+        }
+        stack_.pop_back();
+        return true;
+    }
+
+    bool
+    on_key_part(
+        string_view s,
+        std::size_t, error_code&)
+    {
+        if(collect_)
+            st.push_chars(s);
+        else
+            key_.append(
+                s.data(), s.size());
+        return true;
+    }
+
+    bool
+    on_key(
+        string_view s,
+        std::size_t, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_key(s);
+            return true;
+        }
+        key_.append(s.data(), s.size());
+        auto& f = stack_.back();
+        f.child = dead_;
+        if( f.progress != dead_ &&
+            f.progress <
+                q_.segments_.size())
+        {
+            auto const& seg =
+                q_.segments_[f.progress];
+            if( seg.kind == path_query::
+                    seg_kind::wildcard ||
+                ( seg.kind == path_query::
+                    seg_kind::key &&
+                  seg.key == key_))
+                f.child = f.progress + 1;
+        }
+        key_.clear();
+        return true;
+    }
+
+    bool
+    on_string_part(
+        string_view s,
+        std::size_t, error_code&)
+    {
+        if(collect_ || matched(peek()))
+            st.push_chars(s);
+        return true;
+    }
+
+    bool
+    on_string(
+        string_view s,
+        std::size_t, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_string(s);
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_string(s);
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_number_part(
+        string_view, error_code&)
+    {
+        return true;
+    }
+
+    bool
+    on_int64(
+        std::int64_t i,
+        string_view, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_int64(i);
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_int64(i);
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_uint64(
+        std::uint64_t u,
+        string_view, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_uint64(u);
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_uint64(u);
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_double(
+        double d,
+        string_view, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_double(d);
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_double(d);
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_bool(bool b, error_code&)
+    {
+        if(collect_)
+        {
+            st.push_bool(b);
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_bool(b);
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_null(error_code&)
+    {
+        if(collect_)
+        {
+            st.push_null();
+            return true;
+        }
+        if(matched(slot()))
+        {
+            st.push_null();
+            ++matches_;
+        }
+        return true;
+    }
+
+    bool
+    on_comment_part(
+        string_view, error_code&)
+    {
+        return true;
+    }
+
+    bool
+    on_comment(
+        string_view, error_code&)
+    {
+        return true;
+    }
+};
+
+} // namespace detail
+
+path_query::
+path_query(string_view sv)
+    : text_(sv.data(), sv.size())
+{
+    error_code ec;
+    char const* it = sv.data();
+    char const* const end =
+        it + sv.size();
+    bool valid =
+        it != end && *it == '$';
+    if( valid )
+        ++it;
+    while( valid && it != end )
+    {
+        segment seg;
+        if( *it == '.' )
+        {
+            ++it;
+            if( it != end && *it == '*' )
+            {
+                ++it;
+                seg.kind =
+                    seg_kind::wildcard;
+            }
+            else
+            {
+                char const* const b = it;
+                while( it != end &&
+                    *it != '.' &&
+                    *it != '[' )
+                    ++it;
+                if( it == b )
+                {
+                    valid = false;
+                    break;
+                }
+                seg.key.assign( b, it );
+            }
+        }
+        else if( *it == '[' )
+        {
+            ++it;
+            if( it == end )
+            {
+                valid = false;
+                break;
+            }
+            if( *it == '*' )
+            {
+                ++it;
+                seg.kind =
+                    seg_kind::wildcard;
+            }
+            else if( *it == '\'' )
+            {
+                char const* const b = ++it;
+                while( it != end &&
+                    *it != '\'' )
+                    ++it;
+                if( it == end )
+                {
+                    valid = false;
+                    break;
+                }
+                seg.key.assign( b, it );
+                ++it;
+            }
+            else
+            {
+                unsigned d = *it - '0';
+                if( d > 9 )
+                {
+                    valid = false;
+                    break;
+                }
+                std::size_t n = 0;
+                while( it != end &&
+                    ( d = *it - '0' ) <= 9 )
+                {
+                    std::size_t const n1 =
+                        n * 10 + d;
+                    if( n1 < n )
+                    {
+                        valid = false;
+                        break;
+                    }
+                    n = n1;
+                    ++it;
+                }
+                if( ! valid )
+                    break;
+                seg.kind = seg_kind::index;
+                seg.index = n;
+            }
+            if( it == end || *it != ']' )
+            {
+                valid = false;
+                break;
+            }
+            ++it;
+        }
+        else
+        {
+            valid = false;
+            break;
+        }
+        segments_.push_back(
+            std::move( seg ) );
+    }
+    if( ! valid )
+    {
+        BOOST_JSON_FAIL(
+            ec, error::invalid_path );
+        detail::throw_system_error( ec );
+    }
+}
+
+array
+path_query::
+select(
+    string_view js,
+    storage_ptr sp,
+    parse_options const& opt) const
+{
+    basic_parser<
+        detail::path_selector> p(
+            opt, *this);
+    p.handler().st.reset(std::move(sp));
+    error_code ec;
+    auto const n = p.write_some(
+        false, js.data(), js.size(), ec);
+    if( ! ec && n < js.size() )
+    {
+        BOOST_JSON_FAIL(
+            ec, error::extra_data );
+    }
+    if( ec )
+        detail::throw_system_error( ec );
+    return p.handler().release();
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -10,6 +10,7 @@
 #ifndef BOOST_JSON_IMPL_POINTER_IPP
 #define BOOST_JSON_IMPL_POINTER_IPP
 
+#include <boost/json/pointer.hpp>
 #include <boost/json/value.hpp>
 
 namespace boost {
@@ -495,6 +496,109 @@ value::set_at_pointer(
     return *result;
 }
 
+//----------------------------------------------------------
+
+pointer::
+pointer(string_view sv)
+    : text_(sv.data(), sv.size())
+{
+    error_code ec;
+    string_view segment =
+        detail::next_segment( sv, ec );
+    while( !segment.empty() || ec.failed() )
+    {
+        if( ec.failed() )
+            detail::throw_system_error( ec );
+
+        segments_.emplace_back();
+        auto& seg = segments_.back();
+
+        detail::pointer_token const token( segment );
+        seg.key.assign(
+            token.begin(), token.end() );
+        seg.index = detail::parse_number_token(
+            segment, seg.index_ec );
+
+        segment = detail::next_segment( sv, ec );
+    }
+}
+
+value const*
+pointer::
+resolve(
+    value const& jv,
+    error_code& ec) const noexcept
+{
+    ec.clear();
+    auto result = &jv;
+    for( auto const& seg : segments_ )
+    {
+        switch( result->kind() )
+        {
+        case kind::object: {
+            auto const& obj = result->get_object();
+            key_value_pair const* kv = nullptr;
+            if( !obj.empty() )
+                kv = detail::find_in_object(
+                    obj, string_view(seg.key) ).first;
+            if( !kv )
+            {
+                BOOST_JSON_FAIL( ec, error::not_found );
+                return nullptr;
+            }
+            result = &kv->value();
+            break;
+        }
+        case kind::array: {
+            if( seg.index_ec.failed() )
+            {
+                ec = seg.index_ec;
+                return nullptr;
+            }
+            auto const p = result->get_array()
+                .if_contains( seg.index );
+            if( !p )
+            {
+                BOOST_JSON_FAIL( ec, error::not_found );
+                return nullptr;
+            }
+            result = p;
+            break;
+        }
+        default: {
+            BOOST_JSON_FAIL( ec, error::value_is_scalar );
+            return nullptr;
+        }}
+    }
+    return result;
+}
+
+value const*
+value::find_pointer(
+    pointer const& ptr, error_code& ec ) const noexcept
+{
+    return ptr.resolve( *this, ec );
+}
+
+value*
+value::find_pointer(
+    pointer const& ptr, error_code& ec ) noexcept
+{
+    value const& self = *this;
+    return const_cast<value*>(
+        self.find_pointer( ptr, ec ) );
+}
+
+value const&
+value::at_pointer( pointer const& ptr ) const&
+{
+    error_code ec;
+    auto const found = find_pointer( ptr, ec );
+    if( !found )
+        detail::throw_system_error( ec );
+    return *found;
+}
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_POOLED_RESOURCE_IPP
+#define BOOST_JSON_IMPL_POOLED_RESOURCE_IPP
+
+#include <boost/json/pooled_resource.hpp>
+#include <boost/align/align.hpp>
+#include <boost/core/max_align.hpp>
+
+#include <new>
+
+namespace boost {
+namespace json {
+
+struct alignas(core::max_align_t)
+    pooled_resource::block : block_base
+{
+};
+
+// The cache of blocks owned by each thread.
+// A destroyed resource pushes its blocks here,
+// and later constructed resources pop them back
+// out. No synchronization is needed: only the
+// owning thread ever touches its cache.
+struct pooled_resource::cache
+{
+    block_base* head = nullptr;
+    std::size_t bytes = 0;
+
+    // blocks still cached when the
+    // thread exits go back to the heap
+    ~cache()
+    {
+        auto p = head;
+        while(p)
+        {
+            auto const next = p->next;
+            ::operator delete(p);
+            p = next;
+        }
+    }
+};
+
+auto
+pooled_resource::
+thread_cache_() noexcept ->
+    cache&
+{
+    static thread_local cache c;
+    return c;
+}
+
+// remove and return a cached block with
+// at least n usable bytes, or nullptr
+auto
+pooled_resource::
+pop_block(std::size_t n) noexcept ->
+    block_base*
+{
+    auto& c = thread_cache_();
+    auto pp = &c.head;
+    while(auto const b = *pp)
+    {
+        if(b->size >= n)
+        {
+            *pp = b->next;
+            c.bytes -= b->size;
+            b->p = static_cast<block*>(b) + 1;
+            b->avail = b->size;
+            b->next = nullptr;
+            return b;
+        }
+        pp = &b->next;
+    }
+    return nullptr;
+}
+
+// cache the block if it fits under the
+// limit; returns false if the caller
+// should deallocate it instead
+bool
+pooled_resource::
+push_block(block_base* b) noexcept
+{
+    auto& c = thread_cache_();
+    if(b->size >
+        max_cache_bytes_ - c.bytes)
+        return false;
+    b->next = c.head;
+    c.head = b;
+    c.bytes += b->size;
+    return true;
+}
+
+constexpr
+std::size_t
+pooled_resource::
+max_size()
+{
+    return std::size_t(-1) - sizeof(block);
+}
+
+// lowest power of 2 greater than or equal to n
+std::size_t
+pooled_resource::
+round_pow2(
+    std::size_t n) noexcept
+{
+    if(n & (n - 1))
+        return next_pow2(n);
+    return n;
+}
+
+// lowest power of 2 greater than n
+std::size_t
+pooled_resource::
+next_pow2(
+    std::size_t n) noexcept
+{
+    std::size_t result = min_size_;
+    while(result <= n)
+    {
+        if(result >= max_size() - result)
+        {
+            // overflow
+            result = max_size();
+            break;
+        }
+        result *= 2;
+    }
+    return result;
+}
+
+//----------------------------------------------------------
+
+pooled_resource::
+~pooled_resource()
+{
+    release();
+}
+
+pooled_resource::
+pooled_resource(
+    std::size_t initial_size) noexcept
+    : next_size_(round_pow2(initial_size))
+{
+}
+
+void
+pooled_resource::
+release() noexcept
+{
+    auto p = head_;
+    while(p)
+    {
+        auto const next = p->next;
+        if(! push_block(p))
+            ::operator delete(p);
+        p = next;
+    }
+    head_ = nullptr;
+}
+
+void
+pooled_resource::
+clear_thread_cache() noexcept
+{
+    auto& c = thread_cache_();
+    auto p = c.head;
+    while(p)
+    {
+        auto const next = p->next;
+        ::operator delete(p);
+        p = next;
+    }
+    c.head = nullptr;
+    c.bytes = 0;
+}
+
+std::size_t
+pooled_resource::
+thread_cache_bytes() noexcept
+{
+    return thread_cache_().bytes;
+}
+
+void*
+pooled_resource::
+do_allocate(
+    std::size_t n,
+    std::size_t align)
+{
+    if(head_)
+    {
+        auto p = alignment::align(
+            align, n, head_->p, head_->avail);
+        if(p)
+        {
+            head_->p = reinterpret_cast<
+                unsigned char*>(p) + n;
+            head_->avail -= n;
+            return p;
+        }
+    }
+
+    std::size_t block_size = next_size_;
+    if(block_size < n)
+        block_size = round_pow2(n);
+    auto b = pop_block(block_size);
+    if(! b)
+    {
+        // cache miss; blocks always come from
+        // the global heap, never an upstream
+        // resource, because they can outlive
+        // the resource that allocated them
+        b = ::new(::operator new(
+            sizeof(block) + block_size)) block;
+        b->p = static_cast<block*>(b) + 1;
+        b->avail = block_size;
+        b->size = block_size;
+        b->next = nullptr;
+    }
+    b->next = head_;
+    head_ = b;
+    next_size_ = b->size >= max_size() / 2 ?
+        max_size() : b->size * 2;
+
+    auto p = alignment::align(
+        align, n, head_->p, head_->avail);
+    BOOST_ASSERT(p);
+    head_->p = reinterpret_cast<
+        unsigned char*>(p) + n;
+    head_->avail -= n;
+    return p;
+}
+
+void
+pooled_resource::
+do_deallocate(
+    void*,
+    std::size_t,
+    std::size_t)
+{
+    // do nothing
+}
+
+bool
+pooled_resource::
+do_is_equal(
+    memory_resource const& mr) const noexcept
+{
+    return this == &mr;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
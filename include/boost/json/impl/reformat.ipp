@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_REFORMAT_IPP
+#define BOOST_JSON_IMPL_REFORMAT_IPP
+
+#include <boost/json/reformat.hpp>
+#include <boost/json/serializer.hpp>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// a sink backed by the result string
+struct reformat_string_sink
+{
+    std::string s;
+
+    serializer::mutable_buffer
+    prepare(std::size_t n)
+    {
+        size_ = s.size();
+        s.resize(size_ + n);
+        return { &s[0] + size_, n };
+    }
+
+    void
+    commit(std::size_t n)
+    {
+        s.resize(size_ + n);
+    }
+
+private:
+    std::size_t size_ = 0;
+};
+
+} // (anon)
+
+std::string
+reformat(
+    string_view s,
+    error_code& ec,
+    serialize_options const& sopt,
+    parse_options const& popt)
+{
+    reformat_string_sink sink;
+    reformat(s, sink, ec, sopt, popt);
+    if(ec)
+        return {};
+    return std::move(sink.s);
+}
+
+std::string
+reformat(
+    string_view s,
+    std::error_code& ec,
+    serialize_options const& sopt,
+    parse_options const& popt)
+{
+    error_code jec;
+    std::string result = reformat(s, jec, sopt, popt);
+    ec = jec;
+    return result;
+}
+
+std::string
+reformat(
+    string_view s,
+    serialize_options const& sopt,
+    parse_options const& popt)
+{
+    error_code ec;
+    auto result = reformat(s, ec, sopt, popt);
+    if(ec)
+        detail::throw_system_error( ec );
+    return result;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
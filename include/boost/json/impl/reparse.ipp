@@ -0,0 +1,376 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_REPARSE_IPP
+#define BOOST_JSON_IMPL_REPARSE_IPP
+
+#include <boost/json/reparse.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <cstring>
+#include <string>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+/*  Skip one complete JSON value, returning a
+    pointer just past its last character, or
+    nullptr if the text is malformed. Only as
+    much checking is done as is needed to find
+    the extent; the span is fully validated
+    later when it is reparsed.
+*/
+char const*
+reparse_skip_value(
+    char const* p,
+    char const* end) noexcept;
+
+char const*
+reparse_skip_string(
+    char const* p,
+    char const* end) noexcept
+{
+    BOOST_ASSERT(*p == '\x22');
+    char const* q = p + 1;
+    for(;;)
+    {
+        q = detail::count_valid<true>(q, end);
+        if(q == end)
+            return nullptr;
+        if(*q == '\x22')
+            return q + 1;
+        if(*q != '\\')
+            return nullptr;
+        q += 2;
+        if(q > end)
+            return nullptr;
+    }
+}
+
+char const*
+reparse_skip_container(
+    char const* p,
+    char const* end) noexcept
+{
+    char const open = *p;
+    char const close =
+        open == '{' ? '}' : ']';
+    p = detail::count_whitespace(p + 1, end);
+    if(p == end)
+        return nullptr;
+    if(*p == close)
+        return p + 1;
+    for(;;)
+    {
+        if(open == '{')
+        {
+            if(*p != '\x22')
+                return nullptr;
+            p = reparse_skip_string(p, end);
+            if(! p)
+                return nullptr;
+            p = detail::count_whitespace(p, end);
+            if(p == end || *p != ':')
+                return nullptr;
+            p = detail::count_whitespace(
+                p + 1, end);
+            if(p == end)
+                return nullptr;
+        }
+        p = reparse_skip_value(p, end);
+        if(! p)
+            return nullptr;
+        p = detail::count_whitespace(p, end);
+        if(p == end)
+            return nullptr;
+        if(*p == close)
+            return p + 1;
+        if(*p != ',')
+            return nullptr;
+        p = detail::count_whitespace(p + 1, end);
+        if(p == end)
+            return nullptr;
+    }
+}
+
+char const*
+reparse_skip_value(
+    char const* p,
+    char const* end) noexcept
+{
+    switch(*p)
+    {
+    case '{':
+    case '[':
+        return reparse_skip_container(p, end);
+    case '\x22':
+        return reparse_skip_string(p, end);
+    case 't':
+        if(end - p < 4 ||
+            std::memcmp(p, "true", 4) != 0)
+            return nullptr;
+        return p + 4;
+    case 'f':
+        if(end - p < 5 ||
+            std::memcmp(p, "false", 5) != 0)
+            return nullptr;
+        return p + 5;
+    case 'n':
+        if(end - p < 4 ||
+            std::memcmp(p, "null", 4) != 0)
+            return nullptr;
+        return p + 4;
+    default:
+        if(*p != '-' && static_cast<
+            unsigned char>(*p - '0') > 9)
+            return nullptr;
+        ++p;
+        while(p != end && (static_cast<
+                unsigned char>(*p - '0') <= 9 ||
+            *p == '.' || (*p | 32) == 'e' ||
+            *p == '+' || *p == '-'))
+            ++p;
+        return p;
+    }
+}
+
+/*  Find the smallest complete value in `s`
+    whose extent contains [lo, hi), recording
+    its extent and its JSON Pointer. Returns
+    false when the text around the change is
+    malformed, or when the change is not inside
+    the root value.
+*/
+bool
+reparse_locate(
+    string_view s,
+    std::size_t lo,
+    std::size_t hi,
+    std::string& ptr,
+    std::size_t& vs,
+    std::size_t& ve)
+{
+    char const* const base = s.data();
+    char const* const end = base + s.size();
+    char const* p = detail::
+        count_whitespace(base, end);
+    if(p == end)
+        return false;
+    char const* e = reparse_skip_value(p, end);
+    if(! e)
+        return false;
+    // edits to leading or trailing
+    // whitespace need a full parse to
+    // be validated
+    if(lo < static_cast<std::size_t>(p - base) ||
+        hi > static_cast<std::size_t>(e - base))
+        return false;
+
+    for(;;)
+    {
+        if(*p == '{' || *p == '[')
+        {
+            bool const is_object = *p == '{';
+            char const* q = detail::
+                count_whitespace(p + 1, end);
+            if(*q == (is_object ? '}' : ']'))
+                break;
+            std::size_t index = 0;
+            bool descended = false;
+            for(;;)
+            {
+                string_view key;
+                if(is_object)
+                {
+                    char const* const ks = q;
+                    q = reparse_skip_string(q, end);
+                    BOOST_ASSERT(q != nullptr);
+                    key = {ks + 1, static_cast<
+                        std::size_t>(q - ks - 2)};
+                    q = detail::
+                        count_whitespace(q, end);
+                    BOOST_ASSERT(*q == ':');
+                    q = detail::count_whitespace(
+                        q + 1, end);
+                }
+                char const* const cs = q;
+                char const* const ce =
+                    reparse_skip_value(q, end);
+                BOOST_ASSERT(ce != nullptr);
+                if(static_cast<std::size_t>(
+                        cs - base) <= lo &&
+                    hi <= static_cast<std::size_t>(
+                        ce - base))
+                {
+                    // keys holding escapes would
+                    // need unescaping to form the
+                    // pointer; patch the whole
+                    // container instead
+                    if(is_object && key.find(
+                        '\\') != string_view::npos)
+                        break;
+                    ptr.push_back('/');
+                    if(is_object)
+                    {
+                        for(char const ch : key)
+                        {
+                            if(ch == '~')
+                                ptr += "~0";
+                            else if(ch == '/')
+                                ptr += "~1";
+                            else
+                                ptr.push_back(ch);
+                        }
+                    }
+                    else
+                    {
+                        ptr += std::to_string(index);
+                    }
+                    p = cs;
+                    e = ce;
+                    descended = true;
+                    break;
+                }
+                q = detail::
+                    count_whitespace(ce, end);
+                if(*q != ',')
+                    break;
+                q = detail::count_whitespace(
+                    q + 1, end);
+                ++index;
+            }
+            if(descended)
+                continue;
+        }
+        break;
+    }
+    vs = static_cast<std::size_t>(p - base);
+    ve = static_cast<std::size_t>(e - base);
+    return true;
+}
+
+} // (anon)
+
+void
+reparse(
+    value& jv,
+    string_view old_text,
+    string_view new_text,
+    error_code& ec,
+    parse_options const& opt)
+{
+    ec = {};
+    if(old_text == new_text)
+        return;
+
+    do
+    {
+        // the scan does not understand
+        // extensions; full parse instead
+        if( opt.allow_comments ||
+            opt.allow_trailing_commas ||
+            opt.allow_infinity_and_nan )
+            break;
+
+        // bytes shared at both ends of
+        // the texts bound the change
+        std::size_t const n0 = old_text.size();
+        std::size_t const n1 = new_text.size();
+        std::size_t const nmin =
+            n0 < n1 ? n0 : n1;
+        std::size_t lo = 0;
+        while(lo < nmin &&
+            old_text[lo] == new_text[lo])
+            ++lo;
+        std::size_t tail = 0;
+        while(tail < nmin - lo &&
+            old_text[n0 - 1 - tail] ==
+            new_text[n1 - 1 - tail])
+            ++tail;
+
+        std::string ptr;
+        std::size_t vs;
+        std::size_t ve;
+        if(! reparse_locate(new_text,
+            lo, n1 - tail, ptr, vs, ve))
+            break;
+
+        // the old text must isolate the
+        // change to the same path, or the
+        // edit moved bytes between
+        // siblings (as deleting an array
+        // element does) and the patch
+        // would land on the wrong node
+        std::string old_ptr;
+        std::size_t ovs;
+        std::size_t ove;
+        if(! reparse_locate(old_text,
+            lo, n0 - tail, old_ptr, ovs, ove))
+            break;
+        if(old_ptr != ptr)
+            break;
+
+        value* target;
+        if(ptr.empty())
+        {
+            target = &jv;
+        }
+        else
+        {
+            error_code fec;
+            target = jv.find_pointer(
+                string_view(ptr), fec);
+            // the old value does not match
+            // the old text; full parse
+            if(! target)
+                break;
+        }
+
+        value patched = parse(
+            new_text.substr(vs, ve - vs),
+            ec, jv.storage(), opt);
+        if(ec)
+        {
+            // reparse the whole text so a
+            // reported error refers to a
+            // document offset, not a span
+            // offset
+            break;
+        }
+        *target = std::move(patched);
+        return;
+    }
+    while(false);
+
+    value full = parse(new_text,
+        ec, jv.storage(), opt);
+    if(! ec)
+        jv = std::move(full);
+}
+
+void
+reparse(
+    value& jv,
+    string_view old_text,
+    string_view new_text,
+    parse_options const& opt)
+{
+    error_code ec;
+    reparse(jv, old_text, new_text, ec, opt);
+    if(ec)
+        detail::throw_system_error( ec );
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_RESERVED_RESOURCE_IPP
+#define BOOST_JSON_IMPL_RESERVED_RESOURCE_IPP
+
+#include <boost/json/reserved_resource.hpp>
+#include <boost/throw_exception.hpp>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+# define BOOST_JSON_HAS_MMAP
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace boost {
+namespace json {
+
+namespace {
+
+#ifdef BOOST_JSON_HAS_MMAP
+
+// Pages are committed this many bytes at a
+// time to amortize the cost of the syscall.
+std::size_t const commit_chunk = 65536;
+
+std::size_t
+page_size() noexcept
+{
+    static std::size_t const n =
+        static_cast<std::size_t>(
+            ::sysconf(_SC_PAGESIZE));
+    return n;
+}
+
+#endif
+
+std::size_t
+round_up(
+    std::size_t n,
+    std::size_t align) noexcept
+{
+    return (n + align - 1) & ~(align - 1);
+}
+
+} // (anon)
+
+reserved_resource::
+~reserved_resource() noexcept
+{
+#ifdef BOOST_JSON_HAS_MMAP
+    ::munmap(base_, capacity_);
+#else
+    delete[] base_;
+#endif
+}
+
+reserved_resource::
+reserved_resource(
+    std::size_t capacity)
+{
+#ifdef BOOST_JSON_HAS_MMAP
+    capacity_ = round_up(
+        capacity, page_size());
+    void* p = ::mmap(nullptr, capacity_,
+        PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS,
+        -1, 0);
+    if(p == MAP_FAILED)
+        throw_exception( std::bad_alloc(), BOOST_CURRENT_LOCATION );
+    base_ = static_cast<unsigned char*>(p);
+#else
+    // no virtual memory control;
+    // the buffer is allocated eagerly
+    capacity_ = capacity;
+    base_ = new unsigned char[capacity_];
+    committed_ = capacity_;
+#endif
+}
+
+void
+reserved_resource::
+release() noexcept
+{
+    used_ = 0;
+#ifdef BOOST_JSON_HAS_MMAP
+    // drop the physical pages; they remain
+    // usable, so committed_ is unchanged.
+    ::madvise(base_, committed_, MADV_DONTNEED);
+#endif
+}
+
+void*
+reserved_resource::
+do_allocate(
+    std::size_t n,
+    std::size_t align)
+{
+    // base_ is page-aligned, so aligning
+    // the offset aligns the pointer.
+    std::size_t const off =
+        round_up(used_, align);
+    if( off > capacity_ ||
+        n > capacity_ - off )
+        throw_exception( std::bad_alloc(), BOOST_CURRENT_LOCATION );
+#ifdef BOOST_JSON_HAS_MMAP
+    if( off + n > committed_ )
+    {
+        std::size_t grow = round_up(
+            off + n - committed_, commit_chunk);
+        if( grow > capacity_ - committed_ )
+            grow = capacity_ - committed_;
+        if( ::mprotect(base_ + committed_,
+                grow, PROT_READ | PROT_WRITE) != 0 )
+            throw_exception( std::bad_alloc(), BOOST_CURRENT_LOCATION );
+        committed_ += grow;
+    }
+#endif
+    used_ = off + n;
+    return base_ + off;
+}
+
+void
+reserved_resource::
+do_deallocate(
+    void*,
+    std::size_t,
+    std::size_t)
+{
+    // do nothing
+}
+
+bool
+reserved_resource::
+do_is_equal(
+    memory_resource const& mr) const noexcept
+{
+    return this == &mr;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
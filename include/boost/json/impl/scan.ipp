@@ -0,0 +1,319 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_SCAN_IPP
+#define BOOST_JSON_IMPL_SCAN_IPP
+
+#include <boost/json/scan.hpp>
+#include <boost/json/detail/fast_parser.hpp>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+/*  The index records the offsets of every
+    unescaped quote, with no other entries
+    between an opening quote and its partner:
+    structural characters inside a string are
+    suppressed, and quotes inside it are
+    escaped. Strings therefore occupy adjacent
+    pairs of quote entries, and a string is a
+    key exactly when the entry following its
+    closing quote is a colon.
+*/
+template<class Pred>
+bool
+scan_strings(
+    string_view doc,
+    Pred&& pred)
+{
+    std::vector<std::size_t> idx;
+    error_code ec;
+    if(! detail::build_index(doc, idx, ec))
+        return false;
+    std::size_t i = 0;
+    while(i < idx.size())
+    {
+        if(doc[idx[i]] != '\x22')
+        {
+            ++i;
+            continue;
+        }
+        std::size_t const open = idx[i];
+        std::size_t const close = idx[i + 1];
+        bool const is_key =
+            i + 2 < idx.size() &&
+            doc[idx[i + 2]] == ':';
+        if(pred(doc.substr(
+            open + 1, close - open - 1), is_key))
+            return true;
+        i += 2;
+    }
+    return false;
+}
+
+} // (anon)
+
+bool
+contains_key(
+    string_view doc,
+    string_view key)
+{
+    // reject at substring search speed before
+    // paying for the classification pass; a
+    // key always appears in the raw text
+    if(doc.find(key) == string_view::npos)
+        return false;
+    return scan_strings(doc,
+        [&](string_view s, bool is_key)
+        {
+            return is_key && s == key;
+        });
+}
+
+sniff_result
+sniff(string_view doc) noexcept
+{
+    // bytes examined past the opening
+    // bracket of the outermost container;
+    // nothing beyond this is ever read
+    constexpr std::size_t window = 256;
+
+    sniff_result r;
+    char const* p = doc.data();
+    char const* const end = p + doc.size();
+    while(p != end && (
+        *p == ' ' || *p == '\t' ||
+        *p == '\n' || *p == '\r'))
+        ++p;
+    if(p == end)
+        return r;
+
+    // match as much of a literal as the
+    // text provides; a truncated prefix
+    // can still begin valid JSON
+    auto const literal =
+        [&](string_view lit, json::kind k)
+        {
+            auto n = static_cast<
+                std::size_t>(end - p);
+            if(n > lit.size())
+                n = lit.size();
+            if(string_view(p, n) !=
+                lit.substr(0, n))
+                return;
+            r.valid = true;
+            r.kind = k;
+            r.approx_size = 1;
+        };
+
+    switch(*p)
+    {
+    case 'n':
+        literal("null", json::kind::null);
+        return r;
+    case 't':
+        literal("true", json::kind::bool_);
+        return r;
+    case 'f':
+        literal("false", json::kind::bool_);
+        return r;
+    case '"':
+        r.valid = true;
+        r.kind = json::kind::string;
+        r.approx_size = 1;
+        return r;
+    case '-':
+    case '0': case '1': case '2':
+    case '3': case '4': case '5':
+    case '6': case '7': case '8':
+    case '9':
+    {
+        // examine the number token for a
+        // fraction or exponent to pick the
+        // kind, as the parser would
+        bool fp = false;
+        char const* q = p;
+        if(*q == '-')
+            ++q;
+        while(q != end)
+        {
+            char const c = *q;
+            if(c >= '0' && c <= '9')
+            {
+                ++q;
+                continue;
+            }
+            if( c == '.' || c == 'e' ||
+                c == 'E' || c == '+' ||
+                c == '-')
+            {
+                fp = true;
+                ++q;
+                continue;
+            }
+            break;
+        }
+        r.valid = true;
+        r.kind = fp ?
+            json::kind::double_ :
+            *p == '-' ?
+                json::kind::int64 :
+                json::kind::uint64;
+        r.approx_size = 1;
+        return r;
+    }
+    case '{':
+    case '[':
+        break;
+    default:
+        // cannot begin a JSON document
+        return r;
+    }
+
+    bool const is_obj = *p == '{';
+    r.valid = true;
+    r.kind = is_obj ?
+        json::kind::object :
+        json::kind::array;
+    char const* const open = p;
+    ++p;
+    while(p != end && (
+        *p == ' ' || *p == '\t' ||
+        *p == '\n' || *p == '\r'))
+        ++p;
+
+    char const* const stop =
+        static_cast<std::size_t>(
+            end - open) > window ?
+        open + window : end;
+
+    if(is_obj && p != end)
+    {
+        if(*p == '"')
+        {
+            // the raw span between the
+            // quotes; escapes are skipped
+            // but not decoded
+            char const* const k0 = p + 1;
+            char const* q = k0;
+            while(q < stop)
+            {
+                if(*q == '"')
+                {
+                    r.first_key = string_view(
+                        k0, q - k0);
+                    break;
+                }
+                if(*q == '\\')
+                {
+                    ++q;
+                    if(q == stop)
+                        break;
+                }
+                ++q;
+            }
+        }
+        else if(*p != '}')
+        {
+            r.valid = false;
+            return r;
+        }
+    }
+
+    // project the element count from the
+    // commas at depth one within the window
+    std::size_t commas = 0;
+    std::size_t depth = 1;
+    bool closed = false;
+    bool in_str = false;
+    bool saw_elem = false;
+    char const* q = p;
+    for(; q != stop; ++q)
+    {
+        char const c = *q;
+        if(in_str)
+        {
+            if(c == '\\')
+            {
+                ++q;
+                if(q == stop)
+                    break;
+            }
+            else if(c == '"')
+                in_str = false;
+            continue;
+        }
+        if(c == '"')
+        {
+            in_str = true;
+            saw_elem = true;
+        }
+        else if(c == '{' || c == '[')
+        {
+            ++depth;
+            saw_elem = true;
+        }
+        else if(c == '}' || c == ']')
+        {
+            if(--depth == 0)
+            {
+                closed = true;
+                break;
+            }
+        }
+        else if(c == ',')
+        {
+            if(depth == 1)
+                ++commas;
+        }
+        else if(
+            c != ' ' && c != '\t' &&
+            c != '\n' && c != '\r')
+            saw_elem = true;
+    }
+    std::size_t const seen =
+        saw_elem ? commas + 1 : 0;
+    if(closed)
+    {
+        // the container ended within the
+        // window; the count is exact
+        r.approx_size = seen;
+        return r;
+    }
+    std::size_t const scanned = q - open;
+    std::size_t const total = end - open;
+    r.approx_size = scanned > 0 ?
+        seen * total / scanned : seen;
+    return r;
+}
+
+bool
+contains_string(
+    string_view doc,
+    string_view needle)
+{
+    if(needle.empty())
+        return true;
+    if(doc.find(needle) == string_view::npos)
+        return false;
+    return scan_strings(doc,
+        [&](string_view s, bool)
+        {
+            return s.find(needle) !=
+                string_view::npos;
+        });
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
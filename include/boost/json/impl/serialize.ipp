@@ -10,9 +10,27 @@
 #ifndef BOOST_JSON_IMPL_SERIALIZE_IPP
 #define BOOST_JSON_IMPL_SERIALIZE_IPP
 
+#include <boost/json/escape.hpp>
 #include <boost/json/serialize.hpp>
+#include <boost/json/executor.hpp>
 #include <boost/json/serializer.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <mutex>
 #include <ostream>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+# define BOOST_JSON_HAS_FD_WRITE
+# include <cerrno>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
 
 namespace boost {
 namespace json {
@@ -48,48 +66,399 @@ get_stream_flags( std::ostream& os )
     return opts;
 }
 
+// measures a string body plus both quotes,
+// counting the expansion of each escape
+std::size_t
+quoted_size(string_view sv) noexcept
+{
+    return 2 + escaped_size(sv);
+}
+
+/*  Direct emission for small documents.
+
+    When the measured upper bound fits in one
+    stack buffer, compact output can never
+    suspend, so the resumable state machine in
+    serializer is pure overhead. These functions
+    walk the value recursively and format each
+    token in place. The caller guarantees that
+    the destination can hold the measured bound.
+*/
+
+char*
+write_quoted(
+    char* p,
+    string_view sv) noexcept
+{
+    *p++ = '\"';
+    p += escape(sv, p);
+    *p++ = '\"';
+    return p;
+}
+
+char*
+write_direct(
+    char* p,
+    value const& jv,
+    bool allow) noexcept;
+
+char*
+write_direct(
+    char* p,
+    object const& obj,
+    bool allow) noexcept
+{
+    *p++ = '{';
+    auto it = obj.begin();
+    auto const end = obj.end();
+    if(it != end)
+    {
+        for(;;)
+        {
+            p = write_quoted(
+                p, it->key());
+            *p++ = ':';
+            p = write_direct(
+                p, it->value(), allow);
+            if(++it == end)
+                break;
+            *p++ = ',';
+        }
+    }
+    *p++ = '}';
+    return p;
+}
+
+char*
+write_direct(
+    char* p,
+    array const& arr,
+    bool allow) noexcept
+{
+    *p++ = '[';
+    auto it = arr.begin();
+    auto const end = arr.end();
+    if(it != end)
+    {
+        for(;;)
+        {
+            p = write_direct(
+                p, *it, allow);
+            if(++it == end)
+                break;
+            *p++ = ',';
+        }
+    }
+    *p++ = ']';
+    return p;
+}
+
+char*
+write_direct(
+    char* p,
+    value const& jv,
+    bool allow) noexcept
+{
+    switch(jv.kind())
+    {
+    case kind::object:
+        return write_direct(p,
+            jv.get_object(), allow);
+    case kind::array:
+        return write_direct(p,
+            jv.get_array(), allow);
+    case kind::string:
+    {
+        auto const& js = jv.get_string();
+        if(BOOST_JSON_UNLIKELY(
+            detail::access::raw_number(js)))
+        {
+            // pre-formatted numeral; copied
+            // verbatim, without quotes. the
+            // measured bound counted quotes,
+            // so it remains an upper bound.
+            std::memcpy(p,
+                js.data(), js.size());
+            return p + js.size();
+        }
+        return write_quoted(p, js.subview());
+    }
+    case kind::int64:
+        return p + detail::format_int64(
+            p, jv.get_int64());
+    case kind::uint64:
+        return p + detail::format_uint64(
+            p, jv.get_uint64());
+    case kind::double_:
+        return p + detail::format_double(
+            p, jv.get_double(), allow);
+    case kind::bool_:
+        if(jv.get_bool())
+        {
+            std::memcpy(p, "true", 4);
+            return p + 4;
+        }
+        std::memcpy(p, "false", 5);
+        return p + 5;
+    default:
+    case kind::null:
+        std::memcpy(p, "null", 4);
+        return p + 4;
+    }
+}
+
 } // namespace
 
+std::size_t
+serialized_size(value const& jv) noexcept
+{
+    switch(jv.kind())
+    {
+    case kind::object:
+        return serialized_size(jv.get_object());
+    case kind::array:
+        return serialized_size(jv.get_array());
+    case kind::string:
+        return quoted_size(
+            jv.get_string().subview());
+    case kind::int64:
+    case kind::uint64:
+    case kind::double_:
+        return detail::max_number_chars;
+    case kind::bool_:
+        return 5; // "false"
+    default:
+    case kind::null:
+        return 4; // "null"
+    }
+}
+
+std::size_t
+serialized_size(array const& arr) noexcept
+{
+    std::size_t n = 2; // brackets
+    if(! arr.empty())
+        n += arr.size() - 1; // commas
+    for(auto const& jv : arr)
+        n += serialized_size(jv);
+    return n;
+}
+
+std::size_t
+serialized_size(object const& obj) noexcept
+{
+    std::size_t n = 2; // braces
+    if(! obj.empty())
+        n += obj.size() - 1; // commas
+    for(auto const& kv : obj)
+        n += quoted_size(kv.key()) +
+            1 + // colon
+            serialized_size(kv.value());
+    return n;
+}
+
+std::size_t
+serialized_size(string const& str) noexcept
+{
+    return quoted_size(str.subview());
+}
+
+std::size_t
+serialized_size(string_view sv) noexcept
+{
+    return quoted_size(sv);
+}
+
+std::size_t
+exact_serialized_size(
+    value const& jv,
+    serialize_options const& opts) noexcept
+{
+    switch(jv.kind())
+    {
+    case kind::object:
+        return exact_serialized_size(
+            jv.get_object(), opts);
+    case kind::array:
+        return exact_serialized_size(
+            jv.get_array(), opts);
+    case kind::string:
+    {
+        auto const& js = jv.get_string();
+        if(BOOST_JSON_UNLIKELY(
+            detail::access::raw_number(js)))
+            // pre-formatted numeral, emitted
+            // verbatim without quotes
+            return js.size();
+        return quoted_size(js.subview());
+    }
+    case kind::int64:
+    {
+        char buf[detail::max_number_chars];
+        return detail::format_int64(
+            buf, jv.get_int64());
+    }
+    case kind::uint64:
+    {
+        char buf[detail::max_number_chars];
+        return detail::format_uint64(
+            buf, jv.get_uint64());
+    }
+    case kind::double_:
+    {
+        char buf[detail::max_number_chars];
+        return detail::format_double(
+            buf, jv.get_double(),
+            opts.allow_infinity_and_nan);
+    }
+    case kind::bool_:
+        return jv.get_bool() ? 4 : 5;
+    default:
+    case kind::null:
+        return 4; // "null"
+    }
+}
+
+std::size_t
+exact_serialized_size(
+    array const& arr,
+    serialize_options const& opts) noexcept
+{
+    std::size_t n = 2; // brackets
+    if(! arr.empty())
+        n += arr.size() - 1; // commas
+    for(auto const& jv : arr)
+        n += exact_serialized_size(jv, opts);
+    return n;
+}
+
+std::size_t
+exact_serialized_size(
+    object const& obj,
+    serialize_options const& opts) noexcept
+{
+    std::size_t n = 2; // braces
+    if(! obj.empty())
+        n += obj.size() - 1; // commas
+    for(auto const& kv : obj)
+        n += quoted_size(kv.key()) +
+            1 + // colon
+            exact_serialized_size(
+                kv.value(), opts);
+    return n;
+}
+
+std::size_t
+max_serialized_size(value const& jv) noexcept
+{
+    switch(jv.kind())
+    {
+    case kind::object:
+        return max_serialized_size(
+            jv.get_object());
+    case kind::array:
+        return max_serialized_size(
+            jv.get_array());
+    case kind::string:
+        return max_serialized_size(
+            jv.get_string());
+    case kind::int64:
+    case kind::uint64:
+    case kind::double_:
+        return detail::max_number_chars;
+    case kind::bool_:
+        return 5; // "false"
+    default:
+    case kind::null:
+        return 4; // "null"
+    }
+}
+
+std::size_t
+max_serialized_size(array const& arr) noexcept
+{
+    std::size_t n = 2; // brackets
+    if(! arr.empty())
+        n += arr.size() - 1; // commas
+    for(auto const& jv : arr)
+        n += max_serialized_size(jv);
+    return n;
+}
+
+std::size_t
+max_serialized_size(object const& obj) noexcept
+{
+    std::size_t n = 2; // braces
+    if(! obj.empty())
+        n += obj.size() - 1; // commas
+    for(auto const& kv : obj)
+        n += max_serialized_size(kv.key()) +
+            1 + // colon
+            max_serialized_size(kv.value());
+    return n;
+}
+
+std::size_t
+max_serialized_size(string const& str) noexcept
+{
+    return max_serialized_size(str.subview());
+}
+
+std::size_t
+max_serialized_size(string_view sv) noexcept
+{
+    // every character may expand to a
+    // six character escape sequence
+    return 2 + 6 * sv.size();
+}
+
 static
 void
 serialize_impl(
     std::string& s,
-    serializer& sr)
+    serializer& sr,
+    std::size_t bound)
 {
     // serialize to a small buffer to avoid
     // the first few allocations in std::string
     char buf[BOOST_JSON_STACK_BUFFER_SIZE];
-    string_view sv;
-    sv = sr.read(buf);
-    if(sr.done())
+    if(bound <= sizeof(buf))
     {
         // fast path
+        string_view const sv =
+            sr.read(buf, sizeof(buf));
         s.append(
             sv.data(), sv.size());
+        // pretty output may exceed the
+        // compact measurement
+        while(BOOST_JSON_UNLIKELY(
+            ! sr.done()))
+        {
+            string_view const sv1 =
+                sr.read(buf, sizeof(buf));
+            s.append(
+                sv1.data(), sv1.size());
+        }
         return;
     }
+    // reserve the measured size once and
+    // serialize directly into the string
+    s.resize(bound);
+    string_view sv = sr.read(
+        &s[0], s.size());
     std::size_t len = sv.size();
-    s.reserve(len * 2);
-    s.resize(s.capacity());
-    BOOST_ASSERT(
-        s.size() >= len * 2);
-    std::memcpy(&s[0],
-        sv.data(), sv.size());
-    auto const lim =
-        s.max_size() / 2;
-    for(;;)
+    while(! sr.done())
     {
+        // the measurement is an upper
+        // bound; this loop is a safety net
+        if(s.size() <= s.max_size() / 2)
+            s.resize(s.size() * 2);
+        else
+            s.resize(s.max_size());
         sv = sr.read(
             &s[0] + len,
             s.size() - len);
         len += sv.size();
-        if(sr.done())
-            break;
-        // growth factor 2x
-        if(s.size() < lim)
-            s.resize(s.size() * 2);
-        else
-            s.resize(2 * lim);
     }
     s.resize(len);
 }
@@ -99,6 +468,21 @@ serialize(
     value const& jv,
     serialize_options const& opts)
 {
+    std::size_t const bound =
+        serialized_size(jv);
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, jv,
+            opts.allow_infinity_and_nan);
+        return std::string(buf,
+            static_cast<std::size_t>(
+                end - buf));
+    }
     unsigned char buf[256];
     serializer sr(
         storage_ptr(),
@@ -107,7 +491,7 @@ serialize(
         opts);
     sr.reset(&jv);
     std::string s;
-    serialize_impl(s, sr);
+    serialize_impl(s, sr, bound);
     return s;
 }
 
@@ -116,6 +500,21 @@ serialize(
     array const& arr,
     serialize_options const& opts)
 {
+    std::size_t const bound =
+        serialized_size(arr);
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, arr,
+            opts.allow_infinity_and_nan);
+        return std::string(buf,
+            static_cast<std::size_t>(
+                end - buf));
+    }
     unsigned char buf[256];
     serializer sr(
         storage_ptr(),
@@ -124,7 +523,7 @@ serialize(
         opts);
     std::string s;
     sr.reset(&arr);
-    serialize_impl(s, sr);
+    serialize_impl(s, sr, bound);
     return s;
 }
 
@@ -133,6 +532,21 @@ serialize(
     object const& obj,
     serialize_options const& opts)
 {
+    std::size_t const bound =
+        serialized_size(obj);
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, obj,
+            opts.allow_infinity_and_nan);
+        return std::string(buf,
+            static_cast<std::size_t>(
+                end - buf));
+    }
     unsigned char buf[256];
     serializer sr(
         storage_ptr(),
@@ -141,7 +555,7 @@ serialize(
         opts);
     std::string s;
     sr.reset(&obj);
-    serialize_impl(s, sr);
+    serialize_impl(s, sr, bound);
     return s;
 }
 
@@ -167,12 +581,499 @@ serialize(
         opts);
     std::string s;
     sr.reset(sv);
-    serialize_impl(s, sr);
+    serialize_impl(s, sr,
+        serialized_size(sv));
+    return s;
+}
+
+//----------------------------------------------------------
+
+// counterpart of serialize_impl for output
+// owned by a memory_resource; the string's
+// capacity is retained across calls
+static
+void
+serialize_impl(
+    string& s,
+    serializer& sr,
+    std::size_t bound)
+{
+    // reserve the measured size once and
+    // serialize directly into the string
+    s.resize(bound);
+    string_view sv = sr.read(
+        s.data(), s.size());
+    std::size_t len = sv.size();
+    while(! sr.done())
+    {
+        // the measurement is an upper
+        // bound; this loop is a safety net
+        if(s.size() <= s.max_size() / 2)
+            s.resize(s.size() * 2);
+        else
+            s.resize(s.max_size());
+        sv = sr.read(
+            s.data() + len,
+            s.size() - len);
+        len += sv.size();
+    }
+    s.resize(len);
+}
+
+void
+serialize(
+    string& dest,
+    value const& jv,
+    serialize_options const& opts)
+{
+    std::size_t const bound =
+        serialized_size(jv);
+    dest.clear();
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, jv,
+            opts.allow_infinity_and_nan);
+        dest.append(string_view(buf,
+            static_cast<std::size_t>(
+                end - buf)));
+        return;
+    }
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&jv);
+    serialize_impl(dest, sr, bound);
+}
+
+void
+serialize(
+    string& dest,
+    array const& arr,
+    serialize_options const& opts)
+{
+    std::size_t const bound =
+        serialized_size(arr);
+    dest.clear();
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, arr,
+            opts.allow_infinity_and_nan);
+        dest.append(string_view(buf,
+            static_cast<std::size_t>(
+                end - buf)));
+        return;
+    }
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&arr);
+    serialize_impl(dest, sr, bound);
+}
+
+void
+serialize(
+    string& dest,
+    object const& obj,
+    serialize_options const& opts)
+{
+    std::size_t const bound =
+        serialized_size(obj);
+    dest.clear();
+    if(! opts.pretty &&
+        ! opts.canonical && bound <=
+        BOOST_JSON_STACK_BUFFER_SIZE)
+    {
+        char buf[
+            BOOST_JSON_STACK_BUFFER_SIZE];
+        char* const end = write_direct(
+            buf, obj,
+            opts.allow_infinity_and_nan);
+        dest.append(string_view(buf,
+            static_cast<std::size_t>(
+                end - buf)));
+        return;
+    }
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&obj);
+    serialize_impl(dest, sr, bound);
+}
+
+//----------------------------------------------------------
+
+std::string
+serialize(
+    value const& jv,
+    std::size_t limit,
+    error_code& ec,
+    serialize_options const& opts)
+{
+    ec = {};
+    unsigned char sbuf[256];
+    serializer sr(
+        storage_ptr(),
+        sbuf,
+        sizeof(sbuf),
+        opts);
+    sr.reset(&jv);
+    std::string s;
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    std::size_t remain = limit;
+    for(;;)
+    {
+        // the window offered to the
+        // serializer never exceeds the
+        // remaining budget, so the work
+        // performed is bounded by the
+        // limit, not by the document
+        std::size_t n = sizeof(buf);
+        if(n > remain)
+            n = remain;
+        string_view const sv =
+            sr.read(buf, n);
+        s.append(sv.data(), sv.size());
+        remain -= sv.size();
+        if(sr.done())
+            break;
+        if(remain == 0)
+        {
+            BOOST_JSON_FAIL(
+                ec, error::output_limit);
+            break;
+        }
+    }
+    return s;
+}
+
+std::string
+serialize(
+    value const& jv,
+    std::size_t limit,
+    std::error_code& ec,
+    serialize_options const& opts)
+{
+    error_code jec;
+    std::string s = serialize(
+        jv, limit, jec, opts);
+    ec = jec;
+    return s;
+}
+
+std::string
+serialize(
+    value const& jv,
+    std::size_t limit,
+    serialize_options const& opts)
+{
+    error_code ec;
+    std::string s = serialize(
+        jv, limit, ec, opts);
+    if(ec)
+        detail::throw_system_error( ec );
     return s;
 }
 
 //----------------------------------------------------------
 
+// counterpart of serialize_impl for output
+// consumed a chunk at a time; the bytes never
+// leave the stack buffer
+static
+void
+serialize_impl(
+    serialize_sink& sink,
+    serializer& sr)
+{
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    while(! sr.done())
+    {
+        auto const sv = sr.read(buf);
+        sink.write(sv.data(), sv.size());
+    }
+    sink.finish();
+}
+
+void
+serialize(
+    serialize_sink& sink,
+    value const& jv,
+    serialize_options const& opts)
+{
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&jv);
+    serialize_impl(sink, sr);
+}
+
+void
+serialize(
+    serialize_sink& sink,
+    array const& arr,
+    serialize_options const& opts)
+{
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&arr);
+    serialize_impl(sink, sr);
+}
+
+void
+serialize(
+    serialize_sink& sink,
+    object const& obj,
+    serialize_options const& opts)
+{
+    unsigned char buf[256];
+    serializer sr(
+        storage_ptr(),
+        buf,
+        sizeof(buf),
+        opts);
+    sr.reset(&obj);
+    serialize_impl(sink, sr);
+}
+
+//----------------------------------------------------------
+
+namespace {
+
+// serialize a range of array elements,
+// comma separated, into a pre-sized string
+void
+serialize_elements(
+    std::string& s,
+    array::const_iterator first,
+    array::const_iterator last,
+    serialize_options const& opts)
+{
+    std::size_t bound = 0;
+    for(auto it = first; it != last; ++it)
+        bound += serialized_size(*it) + 1;
+    s.resize(bound);
+    std::size_t len = 0;
+    serializer sr(opts);
+    for(auto it = first; it != last; ++it)
+    {
+        if(it != first)
+            s[len++] = ',';
+        sr.reset(&*it);
+        while(! sr.done())
+        {
+            // the measurement is an upper
+            // bound; this is a safety net
+            if(BOOST_JSON_UNLIKELY(
+                len == s.size()))
+                s.resize(s.size() * 2);
+            string_view const sv = sr.read(
+                &s[0] + len, s.size() - len);
+            len += sv.size();
+        }
+    }
+    s.resize(len);
+}
+
+// the state shared by one batch of chunk
+// serializations; chunk t covers elements
+// [t * chunk, min((t + 1) * chunk, size)).
+struct serialize_job
+{
+    array const* arr;
+    serialize_options const* opts;
+    std::size_t chunk;
+    std::vector<std::string> segs;
+    std::vector<std::exception_ptr> eps;
+
+    static
+    void
+    run(void* arg, std::size_t t)
+    {
+        auto& j = *static_cast<
+            serialize_job*>(arg);
+#ifndef BOOST_NO_EXCEPTIONS
+        try
+#endif
+        {
+            auto const first =
+                j.arr->begin() + t * j.chunk;
+            auto const last =
+                j.arr->size() - t * j.chunk >
+                    j.chunk ?
+                first + j.chunk : j.arr->end();
+            serialize_elements(j.segs[t],
+                first, last, *j.opts);
+        }
+#ifndef BOOST_NO_EXCEPTIONS
+        catch(...)
+        {
+            j.eps[t] = std::current_exception();
+        }
+#endif
+    }
+};
+
+std::string
+serialize_parallel_impl(
+    array const& arr,
+    std::size_t num_threads,
+    executor* ex,
+    serialize_options const& opts)
+{
+    // segments are stitched with bare
+    // commas, which cannot reproduce
+    // the indentation of pretty output
+    if(opts.pretty)
+        return serialize(arr, opts);
+    // each worker should have enough
+    // elements to amortize its thread
+    std::size_t constexpr min_elements = 1024;
+    if(num_threads > arr.size() / min_elements)
+        num_threads = arr.size() / min_elements;
+    if(num_threads <= 1)
+        return serialize(arr, opts);
+
+    serialize_job j;
+    j.arr = &arr;
+    j.opts = &opts;
+    j.chunk =
+        (arr.size() + num_threads - 1) /
+            num_threads;
+    j.segs.resize(num_threads);
+    j.eps.resize(num_threads);
+
+    detail::parallel_run(ex, num_threads,
+        &serialize_job::run, &j);
+
+    for(auto const& ep : j.eps)
+        if(ep)
+            std::rethrow_exception(ep);
+
+    std::size_t total = 2 + num_threads - 1;
+    for(auto const& seg : j.segs)
+        total += seg.size();
+    std::string s;
+    s.reserve(total);
+    s.push_back('[');
+    for(std::size_t t = 0; t < num_threads; ++t)
+    {
+        if(t != 0)
+            s.push_back(',');
+        s.append(j.segs[t]);
+    }
+    s.push_back(']');
+    return s;
+}
+
+} // namespace
+
+std::string
+serialize_parallel(
+    array const& arr,
+    std::size_t num_threads,
+    serialize_options const& opts)
+{
+    if(num_threads == 0)
+    {
+        num_threads = std::thread::
+            hardware_concurrency();
+        if(num_threads == 0)
+            num_threads = 1;
+    }
+    return serialize_parallel_impl(
+        arr, num_threads, nullptr, opts);
+}
+
+std::string
+serialize_parallel(
+    value const& jv,
+    std::size_t num_threads,
+    serialize_options const& opts)
+{
+    if(jv.is_array())
+        return serialize_parallel(
+            jv.get_array(), num_threads, opts);
+    return serialize(jv, opts);
+}
+
+std::string
+serialize_parallel(
+    array const& arr,
+    executor& ex,
+    serialize_options const& opts)
+{
+    std::size_t n = ex.concurrency();
+    if(n == 0)
+        n = 1;
+    return serialize_parallel_impl(
+        arr, n, &ex, opts);
+}
+
+std::string
+serialize_parallel(
+    value const& jv,
+    executor& ex,
+    serialize_options const& opts)
+{
+    if(jv.is_array())
+        return serialize_parallel(
+            jv.get_array(), ex, opts);
+    return serialize(jv, opts);
+}
+
+std::size_t
+format_doubles(
+    char* dest,
+    double const* values,
+    std::size_t count,
+    char separator,
+    serialize_options const& opts) noexcept
+{
+    if(count == 0)
+        return 0;
+    bool const allow =
+        opts.allow_infinity_and_nan;
+    char* p = dest;
+    p += detail::format_double(
+        p, *values, allow);
+    for(std::size_t i = 1; i < count; ++i)
+    {
+        *p++ = separator;
+        p += detail::format_double(
+            p, values[i], allow);
+    }
+    return static_cast<
+        std::size_t>(p - dest);
+}
+
+//----------------------------------------------------------
+
 //[example_operator_lt__lt_
 // Serialize a value into an output stream
 
@@ -253,6 +1154,240 @@ operator<<( std::ostream& os, serialize_options const& opts )
     return os;
 }
 
+//----------------------------------------------------------
+
+namespace {
+
+#ifdef BOOST_JSON_HAS_FD_WRITE
+
+/*  Writes submitted buffers on a dedicated
+    thread, so that formatting the next buffer
+    overlaps the disk write of the previous
+    one. At most one buffer is in flight; the
+    caller alternates between two halves.
+*/
+class serialize_file_pump
+{
+    int fd_;
+    std::mutex m_;
+    std::condition_variable cv_;
+    char const* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool stop_ = false;
+    bool failed_ = false;
+    std::thread t_;
+
+    void
+    loop()
+    {
+        std::unique_lock<
+            std::mutex> lock(m_);
+        for(;;)
+        {
+            cv_.wait(lock,
+                [this]
+                {
+                    return data_ != nullptr
+                        || stop_;
+                });
+            if(! data_)
+                return;
+            char const* p = data_;
+            std::size_t n = size_;
+            lock.unlock();
+            bool ok = true;
+            while(n > 0)
+            {
+                auto const r =
+                    ::write(fd_, p, n);
+                if(r < 0)
+                {
+                    if(errno == EINTR)
+                        continue;
+                    ok = false;
+                    break;
+                }
+                p += r;
+                n -= static_cast<
+                    std::size_t>(r);
+            }
+            lock.lock();
+            data_ = nullptr;
+            if(! ok)
+                failed_ = true;
+            cv_.notify_all();
+        }
+    }
+
+public:
+    explicit
+    serialize_file_pump(int fd)
+        : fd_(fd)
+        , t_([this]{ loop(); })
+    {
+    }
+
+    ~serialize_file_pump()
+    {
+        {
+            std::unique_lock<
+                std::mutex> lock(m_);
+            cv_.wait(lock,
+                [this]
+                {
+                    return data_ == nullptr;
+                });
+            stop_ = true;
+        }
+        cv_.notify_all();
+        t_.join();
+    }
+
+    // wait for the buffer in flight, then
+    // submit another. returns false once
+    // any write has failed.
+    bool
+    submit(
+        char const* data,
+        std::size_t size)
+    {
+        std::unique_lock<
+            std::mutex> lock(m_);
+        cv_.wait(lock,
+            [this]
+            {
+                return data_ == nullptr;
+            });
+        if(failed_)
+            return false;
+        data_ = data;
+        size_ = size;
+        cv_.notify_all();
+        return true;
+    }
+
+    // wait until everything submitted
+    // has reached the file
+    bool
+    drain()
+    {
+        std::unique_lock<
+            std::mutex> lock(m_);
+        cv_.wait(lock,
+            [this]
+            {
+                return data_ == nullptr;
+            });
+        return ! failed_;
+    }
+};
+
+#endif
+
+} // namespace
+
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    error_code& ec,
+    serialize_options const& opts)
+{
+    ec = {};
+#ifdef BOOST_JSON_HAS_FD_WRITE
+    int const fd = ::open(path,
+        O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if(fd < 0)
+    {
+        BOOST_JSON_FAIL(ec, error::output_error);
+        return;
+    }
+    {
+        serializer sr(opts);
+        sr.reset(&t);
+        // two halves of one allocation;
+        // one is filled while the other
+        // is being written
+        std::size_t constexpr half = 1048576;
+        std::vector<char> buf(2 * half);
+        std::size_t which = 0;
+        serialize_file_pump pump(fd);
+        while(! sr.done())
+        {
+            char* const dest =
+                buf.data() + which * half;
+            string_view const sv =
+                sr.read(dest, half);
+            if(! pump.submit(
+                sv.data(), sv.size()))
+                break;
+            which ^= 1;
+        }
+        if(! pump.drain())
+        {
+            BOOST_JSON_FAIL(
+                ec, error::output_error);
+        }
+    }
+    if(::close(fd) != 0 && ! ec)
+    {
+        BOOST_JSON_FAIL(ec, error::output_error);
+    }
+#else
+    std::FILE* const f =
+        std::fopen(path, "wb");
+    if(! f)
+    {
+        BOOST_JSON_FAIL(ec, error::output_error);
+        return;
+    }
+    serializer sr(opts);
+    sr.reset(&t);
+    char buf[BOOST_JSON_STACK_BUFFER_SIZE];
+    while(! sr.done())
+    {
+        string_view const sv =
+            sr.read(buf, sizeof(buf));
+        if(std::fwrite(sv.data(), 1,
+            sv.size(), f) != sv.size())
+        {
+            BOOST_JSON_FAIL(
+                ec, error::output_error);
+            break;
+        }
+    }
+    if(std::fclose(f) != 0 && ! ec)
+    {
+        BOOST_JSON_FAIL(ec, error::output_error);
+    }
+#endif
+}
+
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    std::error_code& ec,
+    serialize_options const& opts)
+{
+    error_code jec;
+    serialize_file(path, t, jec, opts);
+    ec = jec;
+}
+
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    serialize_options const& opts)
+{
+    error_code ec;
+    serialize_file(path, t, ec, opts);
+    if(ec)
+        detail::throw_system_error( ec );
+}
+
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_SERIALIZED_TEMPLATE_IPP
+#define BOOST_JSON_IMPL_SERIALIZED_TEMPLATE_IPP
+
+#include <boost/json/serialized_template.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/detail/except.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// collect every strict ancestor of a hole
+// target; only these containers need to be
+// emitted piecewise, everything else is
+// serialized whole
+bool
+mark_branches(
+    value const& jv,
+    std::vector<value const*> const& targets,
+    std::vector<value const*>& branches)
+{
+    if(std::find(targets.begin(),
+            targets.end(), &jv) !=
+        targets.end())
+        return true;
+    bool any = false;
+    if(jv.is_array())
+    {
+        for(auto const& e : jv.get_array())
+            any |= mark_branches(
+                e, targets, branches);
+    }
+    else if(jv.is_object())
+    {
+        for(auto const& e : jv.get_object())
+            any |= mark_branches(e.value(),
+                targets, branches);
+    }
+    if(any)
+        branches.push_back(&jv);
+    return any;
+}
+
+// serialize jv into segments, cutting a hole
+// wherever a target is reached; containers on
+// the path to a target are emitted piecewise,
+// all other subtrees in one call
+struct template_builder
+{
+    std::vector<std::string>& literals;
+    std::vector<std::size_t>& slot;
+    std::vector<value const*> const& targets;
+    std::vector<value const*> const& branches;
+    std::string cur;
+
+    void
+    emit(value const& jv)
+    {
+        auto const it = std::find(
+            targets.begin(),
+            targets.end(), &jv);
+        if(it != targets.end())
+        {
+            literals.push_back(
+                std::move(cur));
+            cur.clear();
+            slot.push_back(static_cast<
+                std::size_t>(it -
+                    targets.begin()));
+            return;
+        }
+        if(std::find(branches.begin(),
+                branches.end(), &jv) ==
+            branches.end())
+        {
+            cur += serialize(jv);
+            return;
+        }
+        if(jv.is_array())
+        {
+            cur += '[';
+            bool first = true;
+            for(auto const& e :
+                jv.get_array())
+            {
+                if(! first)
+                    cur += ',';
+                first = false;
+                emit(e);
+            }
+            cur += ']';
+        }
+        else
+        {
+            cur += '{';
+            bool first = true;
+            for(auto const& e :
+                jv.get_object())
+            {
+                if(! first)
+                    cur += ',';
+                first = false;
+                cur += serialize(e.key());
+                cur += ':';
+                emit(e.value());
+            }
+            cur += '}';
+        }
+    }
+};
+
+} // (anon)
+
+serialized_template::
+serialized_template(
+    value const& jv,
+    string_view const* first,
+    std::size_t n)
+{
+    std::vector<value const*> targets;
+    targets.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+        targets.push_back(
+            &jv.at_pointer(first[i]));
+
+    std::vector<value const*> branches;
+    mark_branches(jv, targets, branches);
+
+    template_builder b{
+        literals_, slot_,
+        targets, branches, {} };
+    b.emit(jv);
+    literals_.push_back(std::move(b.cur));
+
+    // a hole which was never reached lies
+    // inside another hole, or duplicates one
+    if(slot_.size() != n)
+    {
+        literals_.clear();
+        slot_.clear();
+        BOOST_STATIC_CONSTEXPR source_location
+            loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error(
+            error::not_found, &loc );
+    }
+}
+
+std::string
+serialized_template::
+render(
+    value const* const* subs,
+    std::size_t n) const
+{
+    if(n != slot_.size())
+    {
+        BOOST_STATIC_CONSTEXPR source_location
+            loc = BOOST_CURRENT_LOCATION;
+        detail::throw_system_error(
+            error::out_of_range, &loc );
+    }
+    std::string out;
+    if(literals_.empty())
+        return out;
+    out += literals_[0];
+    for(std::size_t i = 0;
+            i < slot_.size(); ++i)
+    {
+        out += serialize(*subs[slot_[i]]);
+        out += literals_[i + 1];
+    }
+    return out;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -11,8 +11,11 @@
 #define BOOST_JSON_IMPL_SERIALIZER_IPP
 
 #include <boost/json/serializer.hpp>
+#include <boost/json/metrics.hpp>
 #include <boost/json/detail/format.hpp>
 #include <boost/json/detail/sse2.hpp>
+#include <algorithm>
+#include <cstring>
 #include <ostream>
 
 #ifdef _MSC_VER
@@ -30,9 +33,11 @@ enum class serializer::state : char
     fal1, fal2, fal3, fal4, fal5,
     str1, str2, str3, esc1, utf1,
     utf2, utf3, utf4, utf5,
-    num,
-    arr1, arr2, arr3, arr4,
-    obj1, obj2, obj3, obj4, obj5, obj6
+    num,  raw,
+    arr1, arr2, arr3, arr4, arr5, arr6,
+    obj1, obj2, obj3, obj4, obj5, obj6,
+    obj7, obj8, obj9,
+    cob1, cob2, cob3, cob4, cob5, cob6
 };
 
 //----------------------------------------------------------
@@ -49,6 +54,41 @@ serializer(
         buf_size)
     , opts_(opts)
 {
+    // canonical text is always compact
+    if(opts_.canonical)
+        opts_.pretty = false;
+}
+
+unsigned
+serializer::
+fmt_double(
+    char* dest, double d)
+{
+    if(BOOST_JSON_LIKELY(
+        ! opts_.cache_doubles))
+        return detail::format_double(dest,
+            d, opts_.allow_infinity_and_nan);
+    if(BOOST_JSON_UNLIKELY(
+        dcache_.empty()))
+        dcache_.resize(256);
+    std::uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+    // multiply-shift spreads the mantissa
+    // bits, which tick data varies least
+    auto& e = dcache_[(bits *
+        0x9E3779B97F4A7C15ULL) >> 56 &
+        (dcache_.size() - 1)];
+    if(e.size != 0 && e.bits == bits)
+    {
+        std::memcpy(dest, e.text, e.size);
+        return e.size;
+    }
+    auto const n = detail::format_double(
+        dest, d, opts_.allow_infinity_and_nan);
+    e.bits = bits;
+    e.size = static_cast<unsigned char>(n);
+    std::memcpy(e.text, dest, n);
+    return n;
 }
 
 bool
@@ -85,6 +125,62 @@ suspend(
     return false;
 }
 
+bool
+serializer::
+suspend(
+    state st,
+    std::size_t pos,
+    std::size_t base,
+    object const* po)
+{
+    st_.push(po);
+    st_.push(base);
+    st_.push(pos);
+    st_.push(st);
+    return false;
+}
+
+void
+serializer::
+set_indent() noexcept
+{
+    nl_ = true;
+    ind_rem_ = depth_ *
+        opts_.indent_size;
+}
+
+bool
+serializer::
+write_indent(local_stream& ss)
+{
+    // a cached block of spaces is copied
+    // per step, instead of appending one
+    // character per indent level
+    static char const ws[] =
+        "                                "
+        "                                ";
+    if(nl_)
+    {
+        if(BOOST_JSON_UNLIKELY(! ss))
+            return false;
+        ss.append('\n');
+        nl_ = false;
+    }
+    while(ind_rem_ > 0)
+    {
+        std::size_t n = ind_rem_;
+        if(n > sizeof(ws) - 1)
+            n = sizeof(ws) - 1;
+        if(n > ss.remain())
+            n = ss.remain();
+        if(BOOST_JSON_UNLIKELY(n == 0))
+            return false;
+        ss.append(ws, n);
+        ind_rem_ -= n;
+    }
+    return true;
+}
+
 template<bool StackEmpty>
 bool
 serializer::
@@ -268,7 +364,51 @@ do_str2:
         std::size_t n = cs.remain();
         if(BOOST_JSON_LIKELY(n > 0))
         {
-            if(ss.remain() > n)
+            if(BOOST_JSON_UNLIKELY(
+                bufs_ != nullptr))
+            {
+                if(! clean_)
+                    n = detail::count_unescaped(
+                        cs.data(), n);
+                /*  When filling a scatter list,
+                    long unescaped runs are
+                    referenced from the value's
+                    own storage instead of being
+                    copied. Two slots are needed
+                    here, and one is kept in
+                    reserve for the trailing
+                    temporary segment.
+                */
+                if( n >= 32 &&
+                    bufs_n_ + 2 < bufs_cap_ )
+                {
+                    if(ss.data() > seg_)
+                    {
+                        bufs_[bufs_n_].data = seg_;
+                        bufs_[bufs_n_].size =
+                            static_cast<std::size_t>(
+                                ss.data() - seg_);
+                        ++bufs_n_;
+                    }
+                    bufs_[bufs_n_].data = cs.data();
+                    bufs_[bufs_n_].size = n;
+                    ++bufs_n_;
+                    cs.skip(n);
+                    seg_ = ss.data();
+                    goto do_str3;
+                }
+                if(n > ss.remain())
+                    n = ss.remain();
+            }
+            else if(clean_)
+            {
+                // marked by the parser as
+                // needing no escapes; copy
+                // without scanning
+                if(n > ss.remain())
+                    n = ss.remain();
+            }
+            else if(ss.remain() > n)
                 n = detail::count_unescaped(
                     cs.data(), n);
             else
@@ -279,7 +419,11 @@ do_str2:
                 ss.append(cs.data(), n);
                 cs.skip(n);
                 if(! ss)
+                {
+                    str_fast_ =
+                        bufs_ == nullptr;
                     return suspend(state::str2);
+                }
             }
         }
         else
@@ -290,6 +434,7 @@ do_str2:
     }
     else
     {
+        str_fast_ = bufs_ == nullptr;
         return suspend(state::str2);
     }
 
@@ -303,12 +448,22 @@ do_str3:
             auto const ch = *cs;
             auto const c = esc[static_cast<
                 unsigned char>(ch)];
-            ++cs;
             if(! c)
             {
+                // the rest of this run of
+                // unescaped characters is
+                // copied in blocks by the
+                // fast loop; append the
+                // current character first so
+                // progress is guaranteed even
+                // when the run is shorter
+                // than one block
                 ss.append(ch);
+                ++cs;
+                goto do_str2;
             }
-            else if(c != 'u')
+            ++cs;
+            if(c != 'u')
             {
                 ss.append('\\');
                 if(BOOST_JSON_LIKELY(ss))
@@ -430,14 +585,13 @@ write_number(stream& ss0)
                     detail::max_number_chars))
             {
                 ss.advance(
-                    detail::format_double(
+                    fmt_double(
                         ss.data(),
-                        jv_->get_double(),
-                        opts_.allow_infinity_and_nan));
+                        jv_->get_double()));
                 return true;
             }
-            cs0_ = { buf_, detail::format_double(
-                buf_, jv_->get_double(), opts_.allow_infinity_and_nan) };
+            cs0_ = { buf_, fmt_double(
+                buf_, jv_->get_double()) };
             break;
         }
     }
@@ -460,6 +614,33 @@ write_number(stream& ss0)
     return true;
 }
 
+template<bool StackEmpty>
+bool
+serializer::
+write_raw(stream& ss0)
+{
+    // emit the characters of a pre-formatted
+    // number exactly as stored, with no quotes
+    local_stream ss(ss0);
+    if(! StackEmpty && ! st_.empty())
+    {
+        state st;
+        st_.pop(st);
+        BOOST_ASSERT(
+            st == state::raw);
+    }
+    auto const n = ss.remain();
+    if(n < cs0_.remain())
+    {
+        ss.append(cs0_.data(), n);
+        cs0_.skip(n);
+        return suspend(state::raw);
+    }
+    ss.append(
+        cs0_.data(), cs0_.remain());
+    return true;
+}
+
 template<bool StackEmpty>
 bool
 serializer::
@@ -489,6 +670,8 @@ write_array(stream& ss0)
         case state::arr2: goto do_arr2;
         case state::arr3: goto do_arr3;
         case state::arr4: goto do_arr4;
+        case state::arr5: goto do_arr5;
+        case state::arr6: goto do_arr6;
             break;
         }
     }
@@ -500,9 +683,90 @@ do_arr1:
             state::arr1, it, pa);
     if(it == end)
         goto do_arr4;
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        ++depth_;
+        set_indent();
+    }
     for(;;)
     {
+do_arr5:
+        if(BOOST_JSON_UNLIKELY(opts_.pretty))
+        {
+            if(! write_indent(ss))
+                return suspend(
+                    state::arr5, it, pa);
+        }
 do_arr2:
+        /*  Write runs of consecutive numbers of
+            one kind directly, without going
+            through the per-value dispatch below.
+            The kind is inspected once per run, so
+            number-dominated arrays serialize from
+            a tight loop with no per-element
+            branching on type. The stack must be
+            empty, otherwise a partially written
+            number is being resumed below.
+        */
+        if( ! opts_.pretty &&
+            ( StackEmpty || st_.empty() ) &&
+            ss.remain() >=
+                detail::max_number_chars + 1 )
+        {
+            switch(it->kind())
+            {
+            case kind::int64:
+                for(;;)
+                {
+                    ss.advance(detail::format_int64(
+                        ss.data(), it->get_int64()));
+                    if(BOOST_JSON_UNLIKELY(
+                        ++it == end))
+                        goto do_arr4;
+                    ss.append(',');
+                    if( ! it->is_int64() ||
+                        ss.remain() <
+                            detail::max_number_chars + 1 )
+                        break;
+                }
+                break;
+
+            case kind::uint64:
+                for(;;)
+                {
+                    ss.advance(detail::format_uint64(
+                        ss.data(), it->get_uint64()));
+                    if(BOOST_JSON_UNLIKELY(
+                        ++it == end))
+                        goto do_arr4;
+                    ss.append(',');
+                    if( ! it->is_uint64() ||
+                        ss.remain() <
+                            detail::max_number_chars + 1 )
+                        break;
+                }
+                break;
+
+            case kind::double_:
+                for(;;)
+                {
+                    ss.advance(fmt_double(
+                        ss.data(), it->get_double()));
+                    if(BOOST_JSON_UNLIKELY(
+                        ++it == end))
+                        goto do_arr4;
+                    ss.append(',');
+                    if( ! it->is_double() ||
+                        ss.remain() <
+                            detail::max_number_chars + 1 )
+                        break;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
         jv_ = &*it;
         if(! write_value<StackEmpty>(ss))
             return suspend(
@@ -516,6 +780,20 @@ do_arr3:
         else
             return suspend(
                 state::arr3, it, pa);
+        if(BOOST_JSON_UNLIKELY(opts_.pretty))
+            set_indent();
+    }
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        --depth_;
+        set_indent();
+    }
+do_arr6:
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        if(! write_indent(ss))
+            return suspend(
+                state::arr6, it, pa);
     }
 do_arr4:
     if(BOOST_JSON_LIKELY(ss))
@@ -557,6 +835,9 @@ write_object(stream& ss0)
         case state::obj4: goto do_obj4;
         case state::obj5: goto do_obj5;
         case state::obj6: goto do_obj6;
+        case state::obj7: goto do_obj7;
+        case state::obj8: goto do_obj8;
+        case state::obj9: goto do_obj9;
             break;
         }
     }
@@ -569,11 +850,24 @@ do_obj1:
     if(BOOST_JSON_UNLIKELY(
         it == end))
         goto do_obj6;
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        ++depth_;
+        set_indent();
+    }
     for(;;)
     {
+do_obj7:
+        if(BOOST_JSON_UNLIKELY(opts_.pretty))
+        {
+            if(! write_indent(ss))
+                return suspend(
+                    state::obj7, it, po);
+        }
         cs0_ = {
             it->key().data(),
             it->key().size() };
+        clean_ = false;
 do_obj2:
         if(BOOST_JSON_UNLIKELY(
             ! write_string<StackEmpty>(ss)))
@@ -585,6 +879,15 @@ do_obj3:
         else
             return suspend(
                 state::obj3, it, po);
+do_obj8:
+        if(BOOST_JSON_UNLIKELY(opts_.pretty))
+        {
+            if(BOOST_JSON_LIKELY(ss))
+                ss.append(' ');
+            else
+                return suspend(
+                    state::obj8, it, po);
+        }
 do_obj4:
         jv_ = &it->value();
         if(BOOST_JSON_UNLIKELY(
@@ -600,6 +903,20 @@ do_obj5:
         else
             return suspend(
                 state::obj5, it, po);
+        if(BOOST_JSON_UNLIKELY(opts_.pretty))
+            set_indent();
+    }
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        --depth_;
+        set_indent();
+    }
+do_obj9:
+    if(BOOST_JSON_UNLIKELY(opts_.pretty))
+    {
+        if(! write_indent(ss))
+            return suspend(
+                state::obj9, it, po);
     }
 do_obj6:
     if(BOOST_JSON_LIKELY(ss))
@@ -611,6 +928,113 @@ do_obj6:
         state::obj6, it, po);
 }
 
+template<bool StackEmpty>
+bool
+serializer::
+write_object_sorted(stream& ss0)
+{
+    /*  Canonical objects are emitted through a
+        key-ordered index of element pointers
+        appended to kidx_ for the duration of
+        the object, instead of copying or
+        reordering the object itself. Canonical
+        output is always compact, so the pretty
+        printing states have no counterpart
+        here.
+    */
+    object const* po;
+    local_stream ss(ss0);
+    std::size_t pos;
+    std::size_t base;
+    if(StackEmpty || st_.empty())
+    {
+        po = po_;
+        base = kidx_.size();
+        kidx_.reserve(base + po->size());
+        for(auto const& e : *po)
+            kidx_.push_back(&e);
+        std::sort(
+            kidx_.begin() + base, kidx_.end(),
+            [](key_value_pair const* lhs,
+                key_value_pair const* rhs)
+            {
+                return lhs->key() < rhs->key();
+            });
+        pos = 0;
+    }
+    else
+    {
+        state st;
+        st_.pop(st);
+        st_.pop(pos);
+        st_.pop(base);
+        st_.pop(po);
+        switch(st)
+        {
+        default:
+        case state::cob1: goto do_cob1;
+        case state::cob2: goto do_cob2;
+        case state::cob3: goto do_cob3;
+        case state::cob4: goto do_cob4;
+        case state::cob5: goto do_cob5;
+        case state::cob6: goto do_cob6;
+            break;
+        }
+    }
+do_cob1:
+    if(BOOST_JSON_LIKELY(ss))
+        ss.append('{');
+    else
+        return suspend(
+            state::cob1, pos, base, po);
+    if(BOOST_JSON_UNLIKELY(
+        pos == po->size()))
+        goto do_cob6;
+    for(;;)
+    {
+        cs0_ = {
+            kidx_[base + pos]->key().data(),
+            kidx_[base + pos]->key().size() };
+        clean_ = false;
+do_cob2:
+        if(BOOST_JSON_UNLIKELY(
+            ! write_string<StackEmpty>(ss)))
+            return suspend(
+                state::cob2, pos, base, po);
+do_cob3:
+        if(BOOST_JSON_LIKELY(ss))
+            ss.append(':');
+        else
+            return suspend(
+                state::cob3, pos, base, po);
+do_cob4:
+        jv_ = &kidx_[base + pos]->value();
+        if(BOOST_JSON_UNLIKELY(
+            ! write_value<StackEmpty>(ss)))
+            return suspend(
+                state::cob4, pos, base, po);
+        ++pos;
+        if(BOOST_JSON_UNLIKELY(
+            pos == po->size()))
+            break;
+do_cob5:
+        if(BOOST_JSON_LIKELY(ss))
+            ss.append(',');
+        else
+            return suspend(
+                state::cob5, pos, base, po);
+    }
+do_cob6:
+    if(BOOST_JSON_LIKELY(ss))
+    {
+        ss.append('}');
+        kidx_.resize(base);
+        return true;
+    }
+    return suspend(
+        state::cob6, pos, base, po);
+}
+
 template<bool StackEmpty>
 bool
 serializer::
@@ -624,6 +1048,10 @@ write_value(stream& ss)
         default:
         case kind::object:
             po_ = &jv.get_object();
+            if(BOOST_JSON_UNLIKELY(
+                opts_.canonical))
+                return write_object_sorted<
+                    true>(ss);
             return write_object<true>(ss);
 
         case kind::array:
@@ -634,6 +1062,11 @@ write_value(stream& ss)
         {
             auto const& js = jv.get_string();
             cs0_ = { js.data(), js.size() };
+            if(BOOST_JSON_UNLIKELY(
+                detail::access::raw_number(js)))
+                return write_raw<true>(ss);
+            clean_ = detail::access::
+                unescaped(js);
             return write_string<true>(ss);
         }
 
@@ -704,14 +1137,26 @@ write_value(stream& ss)
         case state::num:
             return write_number<StackEmpty>(ss);
 
+        case state::raw:
+            return write_raw<StackEmpty>(ss);
+
         case state::arr1: case state::arr2:
         case state::arr3: case state::arr4:
+        case state::arr5: case state::arr6:
             return write_array<StackEmpty>(ss);
 
         case state::obj1: case state::obj2:
         case state::obj3: case state::obj4:
         case state::obj5: case state::obj6:
+        case state::obj7: case state::obj8:
+        case state::obj9:
             return write_object<StackEmpty>(ss);
+
+        case state::cob1: case state::cob2:
+        case state::cob3: case state::cob4:
+        case state::cob5: case state::cob6:
+            return write_object_sorted<
+                StackEmpty>(ss);
         }
     }
 }
@@ -728,6 +1173,41 @@ read_some(
     BOOST_ASSERT(! done_);
 
     stream ss(dest, size);
+    if(BOOST_JSON_UNLIKELY(str_fast_))
+    {
+        // the previous call stopped part way
+        // through an unescaped run; copy from
+        // the memoized fragment in cs0_
+        // directly, instead of unwinding the
+        // suspended frames only to land back
+        // in the same copy loop
+        str_fast_ = false;
+        if(BOOST_JSON_LIKELY(
+            bufs_ == nullptr))
+        {
+            std::size_t n = cs0_.remain();
+            if(n > size)
+                n = size;
+            if(! clean_ && n > 0)
+                n = detail::count_unescaped(
+                    cs0_.data(), n);
+            if(n > 0)
+            {
+                ss.append(cs0_.data(), n);
+                cs0_.skip(n);
+                if( ! ss &&
+                    cs0_.remain() > 0)
+                {
+                    // filled again before the
+                    // run ended; state::str2
+                    // remains on the stack
+                    str_fast_ = true;
+                    return string_view(dest,
+                        ss.used(dest));
+                }
+            }
+        }
+    }
     if(st_.empty())
         (this->*fn0_)(ss);
     else
@@ -750,6 +1230,8 @@ serializer( serialize_options const& opts ) noexcept
     // ensure room for \uXXXX escape plus one
     BOOST_STATIC_ASSERT(
         sizeof(serializer::buf_) >= 7);
+    if(opts_.canonical)
+        opts_.pretty = false;
 }
 
 void
@@ -762,7 +1244,12 @@ reset(value const* p) noexcept
 
     jv_ = p;
     st_.clear();
+    kidx_.clear();
+    depth_ = 0;
+    ind_rem_ = 0;
+    nl_ = false;
     done_ = false;
+    str_fast_ = false;
 }
 
 void
@@ -773,7 +1260,12 @@ reset(array const* p) noexcept
     fn0_ = &serializer::write_array<true>;
     fn1_ = &serializer::write_array<false>;
     st_.clear();
+    kidx_.clear();
+    depth_ = 0;
+    ind_rem_ = 0;
+    nl_ = false;
     done_ = false;
+    str_fast_ = false;
 }
 
 void
@@ -781,10 +1273,25 @@ serializer::
 reset(object const* p) noexcept
 {
     po_ = p;
-    fn0_ = &serializer::write_object<true>;
-    fn1_ = &serializer::write_object<false>;
+    if(opts_.canonical)
+    {
+        fn0_ = &serializer::
+            write_object_sorted<true>;
+        fn1_ = &serializer::
+            write_object_sorted<false>;
+    }
+    else
+    {
+        fn0_ = &serializer::write_object<true>;
+        fn1_ = &serializer::write_object<false>;
+    }
     st_.clear();
+    kidx_.clear();
+    depth_ = 0;
+    ind_rem_ = 0;
+    nl_ = false;
     done_ = false;
+    str_fast_ = false;
 }
 
 void
@@ -792,10 +1299,23 @@ serializer::
 reset(string const* p) noexcept
 {
     cs0_ = { p->data(), p->size() };
+    if(detail::access::raw_number(*p))
+    {
+        fn0_ = &serializer::write_raw<true>;
+        fn1_ = &serializer::write_raw<false>;
+        st_.clear();
+    kidx_.clear();
+        done_ = false;
+        str_fast_ = false;
+        return;
+    }
+    clean_ = detail::access::unescaped(*p);
     fn0_ = &serializer::write_string<true>;
     fn1_ = &serializer::write_string<false>;
     st_.clear();
+    kidx_.clear();
     done_ = false;
+    str_fast_ = false;
 }
 
 void
@@ -803,22 +1323,85 @@ serializer::
 reset(string_view sv) noexcept
 {
     cs0_ = { sv.data(), sv.size() };
+    clean_ = false;
     fn0_ = &serializer::write_string<true>;
     fn1_ = &serializer::write_string<false>;
     st_.clear();
+    kidx_.clear();
     done_ = false;
+    str_fast_ = false;
 }
 
 string_view
 serializer::
 read(char* dest, std::size_t size)
 {
+    BOOST_JSON_METRICS_TIMER(
+        mt, metrics_op::serializer_read);
     if(! jv_)
     {
         static value const null;
         jv_ = &null;
     }
-    return read_some(dest, size);
+    auto const sv = read_some(dest, size);
+    BOOST_JSON_METRICS_BYTES(mt, sv.size());
+    return sv;
+}
+
+string_view
+serializer::
+read(
+    char* dest,
+    std::size_t size,
+    std::size_t max_cost)
+{
+    /*  Every state advances through the input
+        only as it appends characters: the
+        escape scan in write_string counts
+        exactly the characters which are then
+        copied, numbers are formatted into a
+        fixed-size buffer, and indentation is
+        emitted in capped blocks. Output size
+        therefore bounds the work performed,
+        and the cost budget is enforced by
+        shrinking the window offered to the
+        state machine.
+    */
+    if(size > max_cost)
+        size = max_cost;
+    return read(dest, size);
+}
+
+std::size_t
+serializer::
+read_buffers(
+    const_buffer* buffers,
+    std::size_t num_buffers,
+    char* temp,
+    std::size_t temp_size)
+{
+    if(num_buffers == 0)
+        return 0;
+    bufs_ = buffers;
+    bufs_cap_ = num_buffers;
+    bufs_n_ = 0;
+    seg_ = temp;
+    string_view const sv =
+        read(temp, temp_size);
+    bufs_ = nullptr;
+    // the trailing temporary segment,
+    // for which a slot is always kept
+    char const* const end =
+        sv.data() + sv.size();
+    if(end > seg_)
+    {
+        buffers[bufs_n_].data = seg_;
+        buffers[bufs_n_].size =
+            static_cast<std::size_t>(
+                end - seg_);
+        ++bufs_n_;
+    }
+    return bufs_n_;
 }
 
 } // namespace json
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_SHARED_VALUE_IPP
+#define BOOST_JSON_IMPL_SHARED_VALUE_IPP
+
+#include <boost/json/shared_value.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <thread>
+
+namespace boost {
+namespace json {
+
+shared_value::
+shared_value(value const& jv)
+    : sp_(make_shared_resource<
+        monotonic_resource>())
+{
+    // The document is copied into the arena
+    // with a non-owning storage_ptr: only
+    // shared_value copies hold references to
+    // the arena, so the count cannot cycle.
+    // Destructors for the tree never run;
+    // this is safe because a value's only
+    // destruction side effect is deallocation,
+    // and the arena releases everything at
+    // once when the last reference goes away.
+    root_ = ::new(sp_->allocate(
+        sizeof(value), alignof(value)))
+        value(jv, storage_ptr(sp_.get()));
+}
+
+//----------------------------------------------------------
+
+// The counter increments and the loads of cur_
+// below rely on the sequential consistency of
+// the defaulted memory order: a reader announces
+// itself on a side, then re-checks that the side
+// is still current, while a writer makes the
+// other side current and then checks for
+// announced readers. One of the two must observe
+// the other.
+
+shared_value
+atomic_shared_value::
+load() const noexcept
+{
+    for(;;)
+    {
+        auto const i = cur_.load();
+        // announce the read, so a writer who
+        // retires this side waits for us
+        readers_[i].fetch_add(1);
+        if(BOOST_JSON_LIKELY(
+            cur_.load() == i))
+        {
+            shared_value sv(docs_[i]);
+            readers_[i].fetch_sub(1,
+                std::memory_order_release);
+            return sv;
+        }
+        // a replacement landed between the two
+        // loads; back off and read the new side
+        readers_[i].fetch_sub(1,
+            std::memory_order_release);
+    }
+}
+
+void
+atomic_shared_value::
+store(shared_value sv) noexcept
+{
+    exchange(std::move(sv));
+}
+
+shared_value
+atomic_shared_value::
+exchange(shared_value sv) noexcept
+{
+    // writers are serialized; replacement is
+    // assumed to be rare next to reads
+    while(busy_.exchange(true,
+        std::memory_order_acquire))
+        std::this_thread::yield();
+    auto const i = cur_.load(
+        std::memory_order_relaxed);
+    auto const j = 1 - i;
+    // the previous writer drained side j before
+    // releasing busy_; readers who announce on
+    // it now always fail the re-check and back
+    // off without touching docs_[j]
+    docs_[j] = std::move(sv);
+    cur_.store(j);
+    // wait for readers still copying from the
+    // retired side, then take the old document
+    while(readers_[i].load() != 0)
+        std::this_thread::yield();
+    shared_value old(std::move(docs_[i]));
+    busy_.store(false,
+        std::memory_order_release);
+    return old;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
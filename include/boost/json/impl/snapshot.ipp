@@ -0,0 +1,474 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_SNAPSHOT_IPP
+#define BOOST_JSON_IMPL_SNAPSHOT_IPP
+
+#include <boost/json/snapshot.hpp>
+#include <boost/json/value_stack.hpp>
+#include <boost/json/detail/binary.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/stack.hpp>
+#include <cstring>
+#include <ostream>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// tape item tags; the format version must be
+// bumped whenever these change
+enum snapshot_tag : unsigned char
+{
+    tag_null = 0,
+    tag_false,
+    tag_true,
+    tag_int64,
+    tag_uint64,
+    tag_double,
+    tag_string,
+    tag_array,
+    tag_object,
+    tag_key
+};
+
+unsigned char const snapshot_version = 1;
+
+unsigned char
+snapshot_endian() noexcept
+{
+    std::uint16_t const x = 0x0102;
+    unsigned char c;
+    std::memcpy(&c, &x, 1);
+    return c;
+}
+
+// one open container while loading; count holds
+// the number of items pushed so far, where each
+// object key and mapped value counts separately
+struct snapshot_parse_frame
+{
+    std::uint64_t left;
+    std::uint64_t count;
+    bool map;
+};
+
+void
+put_u64(std::ostream& os, std::uint64_t v)
+{
+    os.write(reinterpret_cast<
+        char const*>(&v), sizeof(v));
+}
+
+void
+put_f64(std::ostream& os, double v)
+{
+    os.write(reinterpret_cast<
+        char const*>(&v), sizeof(v));
+}
+
+void
+put_str(
+    std::ostream& os,
+    unsigned char tag,
+    string_view sv)
+{
+    os.put(static_cast<char>(tag));
+    put_u64(os, sv.size());
+    os.write(sv.data(), sv.size());
+}
+
+} // (anon)
+
+void
+save_snapshot(
+    value const& jv,
+    std::ostream& os)
+{
+    char const header[8] = {
+        'B', 'J', 'S', 'N',
+        static_cast<char>(snapshot_version),
+        static_cast<char>(snapshot_endian()),
+        0, 0 };
+    os.write(header, sizeof(header));
+
+    unsigned char temp[16 * sizeof(
+        detail::binary_frame)];
+    detail::stack st(
+        storage_ptr(), temp, sizeof(temp));
+    detail::binary_frame cur = {};
+    bool has_cur = false;
+    value const* next = &jv;
+
+    while(os)
+    {
+        value const* item;
+        if(next)
+        {
+            item = next;
+            next = nullptr;
+        }
+        else if(! has_cur)
+        {
+            break;
+        }
+        else if(cur.object)
+        {
+            auto it = static_cast<
+                key_value_pair const*>(cur.it);
+            if(it == cur.end)
+            {
+                if(st.empty())
+                    has_cur = false;
+                else
+                    st.pop(cur);
+                continue;
+            }
+            put_str(os, tag_key, it->key());
+            cur.it = it + 1;
+            item = &it->value();
+        }
+        else
+        {
+            auto it = static_cast<
+                value const*>(cur.it);
+            if(it == cur.end)
+            {
+                if(st.empty())
+                    has_cur = false;
+                else
+                    st.pop(cur);
+                continue;
+            }
+            cur.it = it + 1;
+            item = it;
+        }
+
+        switch(item->kind())
+        {
+        case kind::null:
+            os.put(static_cast<char>(tag_null));
+            break;
+        case kind::bool_:
+            os.put(static_cast<char>(
+                item->get_bool()
+                    ? tag_true : tag_false));
+            break;
+        case kind::int64:
+            os.put(static_cast<char>(tag_int64));
+            put_u64(os, static_cast<
+                std::uint64_t>(item->get_int64()));
+            break;
+        case kind::uint64:
+            os.put(static_cast<char>(tag_uint64));
+            put_u64(os, item->get_uint64());
+            break;
+        case kind::double_:
+            os.put(static_cast<char>(tag_double));
+            put_f64(os, item->get_double());
+            break;
+        case kind::string:
+            put_str(os, tag_string,
+                item->get_string().subview());
+            break;
+        case kind::array:
+        {
+            auto const& ja = item->get_array();
+            os.put(static_cast<char>(tag_array));
+            put_u64(os, ja.size());
+            if(! ja.empty())
+            {
+                if(has_cur)
+                    st.push(cur);
+                cur.it = ja.data();
+                cur.end = ja.data() + ja.size();
+                cur.object = false;
+                cur.key_done = false;
+                has_cur = true;
+            }
+            break;
+        }
+        default:
+        {
+            auto const& jo = item->get_object();
+            os.put(static_cast<char>(tag_object));
+            put_u64(os, jo.size());
+            if(! jo.empty())
+            {
+                if(has_cur)
+                    st.push(cur);
+                cur.it = jo.begin();
+                cur.end = jo.end();
+                cur.object = true;
+                cur.key_done = false;
+                has_cur = true;
+            }
+            break;
+        }
+        }
+    }
+}
+
+value
+load_snapshot(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp)
+{
+    ec = {};
+
+    if( s.size() < 8 ||
+        std::memcmp(s.data(), "BJSN", 4) != 0 ||
+        static_cast<unsigned char>(s[4]) !=
+            snapshot_version ||
+        static_cast<unsigned char>(s[5]) !=
+            snapshot_endian())
+    {
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return nullptr;
+    }
+
+    unsigned char temp[
+        BOOST_JSON_STACK_BUFFER_SIZE];
+    value_stack st(
+        storage_ptr(), temp, sizeof(temp));
+    st.reset(std::move(sp));
+
+    unsigned char temp2[16 * sizeof(
+        snapshot_parse_frame)];
+    detail::stack fs(
+        storage_ptr(), temp2, sizeof(temp2));
+    snapshot_parse_frame cur = {};
+    bool has_cur = false;
+    std::size_t depth = 0;
+    std::size_t const max_depth = 32;
+
+    char const* p = s.data() + 8;
+    char const* const end = s.data() + s.size();
+    bool root_done = false;
+
+    // called after an item is pushed; closes
+    // any containers that the item completed
+    auto const complete =
+        [&]()
+        {
+            for(;;)
+            {
+                if(! has_cur)
+                {
+                    root_done = true;
+                    return;
+                }
+                ++cur.count;
+                std::uint64_t const total = cur.map
+                    ? cur.left * 2 : cur.left;
+                if(cur.count < total)
+                    return;
+                if(cur.map)
+                    st.push_object(static_cast<
+                        std::size_t>(cur.left));
+                else
+                    st.push_array(static_cast<
+                        std::size_t>(cur.left));
+                --depth;
+                if(fs.empty())
+                    has_cur = false;
+                else
+                    fs.pop(cur);
+            }
+        };
+
+    // reads a fixed-width field
+    auto const read_u64 =
+        [&](std::uint64_t& n)
+        {
+            if(static_cast<std::size_t>(
+                end - p) < sizeof(n))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return false;
+            }
+            std::memcpy(&n, p, sizeof(n));
+            p += sizeof(n);
+            return true;
+        };
+
+    while(! root_done)
+    {
+        if(p == end)
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return nullptr;
+        }
+        unsigned char const tag =
+            static_cast<unsigned char>(*p++);
+        bool const at_key = has_cur &&
+            cur.map && (cur.count & 1) == 0;
+
+        // every object member starts
+        // with a key record
+        if(at_key != (tag == tag_key))
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return nullptr;
+        }
+
+        switch(tag)
+        {
+        case tag_null:
+            st.push_null();
+            complete();
+            break;
+        case tag_false:
+            st.push_bool(false);
+            complete();
+            break;
+        case tag_true:
+            st.push_bool(true);
+            complete();
+            break;
+        case tag_int64:
+        {
+            std::uint64_t n;
+            if(! read_u64(n))
+                return nullptr;
+            st.push_int64(
+                static_cast<std::int64_t>(n));
+            complete();
+            break;
+        }
+        case tag_uint64:
+        {
+            std::uint64_t n;
+            if(! read_u64(n))
+                return nullptr;
+            st.push_uint64(n);
+            complete();
+            break;
+        }
+        case tag_double:
+        {
+            std::uint64_t n;
+            if(! read_u64(n))
+                return nullptr;
+            double d;
+            std::memcpy(&d, &n, sizeof(d));
+            st.push_double(d);
+            complete();
+            break;
+        }
+        case tag_string:
+        case tag_key:
+        {
+            std::uint64_t n;
+            if(! read_u64(n))
+                return nullptr;
+            if(n > static_cast<
+                std::uint64_t>(end - p))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return nullptr;
+            }
+            string_view const sv(p,
+                static_cast<std::size_t>(n));
+            p += n;
+            if(tag == tag_key)
+                st.push_key(sv);
+            else
+                st.push_string(sv);
+            complete();
+            break;
+        }
+        case tag_array:
+        case tag_object:
+        {
+            bool const map = tag == tag_object;
+            std::uint64_t n;
+            if(! read_u64(n))
+                return nullptr;
+            // each item takes at least one
+            // byte, so an oversized count
+            // cannot be satisfied
+            if(n > static_cast<std::uint64_t>(
+                end - p) / (map ? 2 : 1))
+            {
+                BOOST_JSON_FAIL(ec,
+                    error::incomplete);
+                return nullptr;
+            }
+            if(n == 0)
+            {
+                if(map)
+                    st.push_object(0);
+                else
+                    st.push_array(0);
+                complete();
+                break;
+            }
+            if(depth >= max_depth)
+            {
+                BOOST_JSON_FAIL(ec, error::too_deep);
+                return nullptr;
+            }
+            if(has_cur)
+                fs.push(cur);
+            cur.left = n;
+            cur.count = 0;
+            cur.map = map;
+            has_cur = true;
+            ++depth;
+            break;
+        }
+        default:
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return nullptr;
+        }
+    }
+
+    if(p != end)
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+        return nullptr;
+    }
+    return st.release();
+}
+
+value
+load_snapshot(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp)
+{
+    error_code jec;
+    value result = load_snapshot(
+        s, jec, std::move(sp));
+    ec = jec;
+    return result;
+}
+
+value
+load_snapshot(
+    string_view s,
+    storage_ptr sp)
+{
+    error_code ec;
+    auto jv = load_snapshot(
+        s, ec, std::move(sp));
+    if(ec)
+        detail::throw_system_error( ec );
+    return jv;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_SORTED_VIEW_IPP
+#define BOOST_JSON_IMPL_SORTED_VIEW_IPP
+
+#include <boost/json/sorted_view.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace json {
+
+/*  The searches use the monobound form of
+    binary search: the window size halves on
+    every step regardless of the comparison
+    result, so the only data-dependent
+    operation is an add of zero or half,
+    which compilers emit as a conditional
+    move. With thousands of keys this avoids
+    a mispredicted branch per probe.
+*/
+
+sorted_view::
+sorted_view(object const& obj)
+{
+    idx_.reserve(obj.size());
+    for(auto const& kv : obj)
+        idx_.push_back(&kv);
+    // a stable sort keeps insertion order
+    // between equal keys, which an object
+    // may hold under a permissive duplicate
+    // key policy
+    std::stable_sort(
+        idx_.begin(), idx_.end(),
+        [](key_value_pair const* lhs,
+            key_value_pair const* rhs)
+        {
+            return lhs->key() < rhs->key();
+        });
+}
+
+auto
+sorted_view::
+lower_bound(
+    string_view key) const noexcept ->
+        const_iterator
+{
+    auto base = idx_.data();
+    std::size_t n = idx_.size();
+    if(n == 0)
+        return end();
+    while(n > 1)
+    {
+        std::size_t const half = n / 2;
+        base += (
+            base[half - 1]->key() < key)
+                ? half : 0;
+        n -= half;
+    }
+    base += ((*base)->key() < key) ? 1 : 0;
+    return const_iterator(base);
+}
+
+auto
+sorted_view::
+upper_bound(
+    string_view key) const noexcept ->
+        const_iterator
+{
+    auto base = idx_.data();
+    std::size_t n = idx_.size();
+    if(n == 0)
+        return end();
+    while(n > 1)
+    {
+        std::size_t const half = n / 2;
+        base += (
+            base[half - 1]->key() <= key)
+                ? half : 0;
+        n -= half;
+    }
+    base += ((*base)->key() <= key) ? 1 : 0;
+    return const_iterator(base);
+}
+
+auto
+sorted_view::
+find(string_view key) const noexcept ->
+    const_iterator
+{
+    auto const it = lower_bound(key);
+    if( it != end() &&
+        it->key() == key)
+        return it;
+    return end();
+}
+
+auto
+sorted_view::
+prefix_range(
+    string_view prefix) const noexcept ->
+        std::pair<
+            const_iterator, const_iterator>
+{
+    // every key beginning with the prefix
+    // compares greater than or equal to it,
+    // so the range starts at its lower bound
+    auto const first = lower_bound(prefix);
+    // the end is the first element whose
+    // leading prefix.size() characters
+    // compare greater than the prefix
+    auto base = idx_.data();
+    std::size_t n = idx_.size();
+    if(n == 0)
+        return { first, first };
+    while(n > 1)
+    {
+        std::size_t const half = n / 2;
+        base += (
+            base[half - 1]->key().substr(
+                0, prefix.size())
+                    .compare(prefix) <= 0)
+                        ? half : 0;
+        n -= half;
+    }
+    base += (
+        (*base)->key().substr(
+            0, prefix.size())
+                .compare(prefix) <= 0)
+                    ? 1 : 0;
+    return { first, const_iterator(base) };
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
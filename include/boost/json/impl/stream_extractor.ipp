@@ -0,0 +1,560 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_STREAM_EXTRACTOR_IPP
+#define BOOST_JSON_IMPL_STREAM_EXTRACTOR_IPP
+
+#include <boost/json/stream_extractor.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/error.hpp>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+
+constexpr std::size_t extract_handler::dead_;
+
+//----------------------------------------------------------
+
+std::size_t
+extract_handler::
+add(
+    string_view ptr,
+    error_code& ec)
+{
+    path p;
+    if(! ptr.empty())
+    {
+        if(ptr.front() != '/')
+        {
+            BOOST_JSON_FAIL(
+                ec, error::missing_slash);
+            return dead_;
+        }
+        auto it = ptr.begin() + 1;
+        auto const last = ptr.end();
+        segment seg;
+        for(;;)
+        {
+            if(it == last || *it == '/')
+            {
+                // a token of digits without a
+                // leading zero also names an
+                // array index
+                seg.index = dead_;
+                if( ! seg.token.empty() &&
+                    seg.token.size() < 20 &&
+                    ( seg.token.size() == 1 ||
+                      seg.token.front() != '0'))
+                {
+                    std::size_t n = 0;
+                    bool digits = true;
+                    for(char const c : seg.token)
+                    {
+                        if(c < '0' || c > '9')
+                        {
+                            digits = false;
+                            break;
+                        }
+                        n = n * 10 + (c - '0');
+                    }
+                    if(digits)
+                        seg.index = n;
+                }
+                p.segs.emplace_back(
+                    std::move(seg));
+                seg = segment();
+                if(it == last)
+                    break;
+                ++it;
+                continue;
+            }
+            if(*it == '~')
+            {
+                ++it;
+                if(it == last || (
+                    *it != '0' && *it != '1'))
+                {
+                    BOOST_JSON_FAIL(
+                        ec, error::invalid_escape);
+                    return dead_;
+                }
+                seg.token.push_back(
+                    *it == '0' ? '~' : '/');
+            }
+            else
+            {
+                seg.token.push_back(*it);
+            }
+            ++it;
+        }
+    }
+    paths_.emplace_back(std::move(p));
+    return paths_.size() - 1;
+}
+
+void
+extract_handler::
+start(
+    callback_type cb,
+    void* user) noexcept
+{
+    cb_ = cb;
+    user_ = user;
+}
+
+//----------------------------------------------------------
+
+// compute pending_ from the current row for a
+// member value named by an unescaped key
+void
+extract_handler::
+pend_key(
+    string_view key) noexcept
+{
+    auto const row =
+        rows_.data() + rows_.size() - count();
+    any_hit_ = false;
+    for(std::size_t i = 0;
+        i < paths_.size(); ++i)
+    {
+        auto const p = row[i];
+        auto const len =
+            paths_[i].segs.size();
+        if(p == dead_ || p == len ||
+            key != paths_[i].segs[p].token)
+        {
+            pending_[i] = dead_;
+            continue;
+        }
+        pending_[i] = p + 1;
+        if(p + 1 == len)
+            any_hit_ = true;
+    }
+}
+
+// compute pending_ from the current row for the
+// element at an array index
+void
+extract_handler::
+pend_index(
+    std::size_t index) noexcept
+{
+    auto const row =
+        rows_.data() + rows_.size() - count();
+    any_hit_ = false;
+    for(std::size_t i = 0;
+        i < paths_.size(); ++i)
+    {
+        auto const p = row[i];
+        auto const len =
+            paths_[i].segs.size();
+        if(p == dead_ || p == len ||
+            index != paths_[i].segs[p].index)
+        {
+            pending_[i] = dead_;
+            continue;
+        }
+        pending_[i] = p + 1;
+        if(p + 1 == len)
+            any_hit_ = true;
+    }
+}
+
+// establish pending_ for the value whose first
+// event this is; object member values were
+// already entered by on_key
+void
+extract_handler::
+enter() noexcept
+{
+    if(entered_)
+        return;
+    if( ! stack_.empty() &&
+        ! stack_.back().is_object)
+        pend_index(stack_.back().index++);
+    entered_ = true;
+}
+
+// report a completed scalar to every fully
+// matched path and forget the value
+bool
+extract_handler::
+leaf(value const& jv)
+{
+    for(std::size_t i = 0;
+        i < paths_.size(); ++i)
+        if(pending_[i] ==
+                paths_[i].segs.size())
+            cb_(user_, i, jv);
+    entered_ = false;
+    any_hit_ = false;
+    sbuf_.clear();
+    return true;
+}
+
+parse_directive
+extract_handler::
+begin_container(
+    bool is_object)
+{
+    enter();
+    // a match strictly below requires some
+    // path with matched segments remaining
+    bool alive = false;
+    for(std::size_t i = 0;
+        i < paths_.size(); ++i)
+        if( pending_[i] != dead_ &&
+            pending_[i] <
+                paths_[i].segs.size())
+        {
+            alive = true;
+            break;
+        }
+    // the frame is pushed even when skipping:
+    // the parser still delivers the matching
+    // end event for a skipped container
+    stack_.push_back({0, is_object});
+    rows_.insert(rows_.end(),
+        pending_.begin(), pending_.end());
+    entered_ = false;
+    any_hit_ = false;
+    if(! alive)
+        return parse_directive::skip();
+    return true;
+}
+
+void
+extract_handler::
+end_container() noexcept
+{
+    rows_.resize(
+        rows_.size() - count());
+    stack_.pop_back();
+    entered_ = false;
+    any_hit_ = false;
+}
+
+//----------------------------------------------------------
+
+bool
+extract_handler::
+on_document_begin(
+    error_code&)
+{
+    stack_.clear();
+    rows_.clear();
+    key_.clear();
+    sbuf_.clear();
+    pending_.assign(count(), 0);
+    entered_ = false;
+    // the pointer "" names the root itself
+    any_hit_ = false;
+    for(auto const& p : paths_)
+        if(p.segs.empty())
+            any_hit_ = true;
+    return true;
+}
+
+bool
+extract_handler::
+on_document_end(
+    error_code&)
+{
+    return true;
+}
+
+parse_directive
+extract_handler::
+on_object_begin(
+    error_code&)
+{
+    return begin_container(true);
+}
+
+bool
+extract_handler::
+on_object_end(
+    std::size_t,
+    error_code&)
+{
+    end_container();
+    return true;
+}
+
+parse_directive
+extract_handler::
+on_array_begin(
+    error_code&)
+{
+    return begin_container(false);
+}
+
+bool
+extract_handler::
+on_array_end(
+    std::size_t,
+    error_code&)
+{
+    end_container();
+    return true;
+}
+
+bool
+extract_handler::
+on_key_part(
+    string_view s,
+    std::size_t,
+    error_code&)
+{
+    key_.append(s.data(), s.size());
+    return true;
+}
+
+parse_directive
+extract_handler::
+on_key(
+    string_view s,
+    std::size_t,
+    error_code&)
+{
+    if(key_.empty())
+    {
+        pend_key(s);
+    }
+    else
+    {
+        key_.append(s.data(), s.size());
+        pend_key(key_);
+        key_.clear();
+    }
+    entered_ = true;
+    // when the member cannot lie on any path,
+    // its value need not produce events at all
+    if(! any_hit_)
+    {
+        bool alive = false;
+        for(std::size_t i = 0;
+            i < paths_.size(); ++i)
+            if(pending_[i] != dead_)
+            {
+                alive = true;
+                break;
+            }
+        if(! alive)
+        {
+            entered_ = false;
+            return parse_directive::skip();
+        }
+    }
+    return true;
+}
+
+bool
+extract_handler::
+on_string_part(
+    string_view s,
+    std::size_t,
+    error_code&)
+{
+    enter();
+    // characters are only retained when
+    // some path matched the string
+    if(any_hit_)
+        sbuf_.append(s.data(), s.size());
+    return true;
+}
+
+bool
+extract_handler::
+on_string(
+    string_view s,
+    std::size_t,
+    error_code&)
+{
+    enter();
+    if(any_hit_)
+    {
+        if(sbuf_.empty())
+            return leaf(value(s));
+        sbuf_.append(s.data(), s.size());
+        return leaf(value(
+            string_view(sbuf_)));
+    }
+    entered_ = false;
+    sbuf_.clear();
+    return true;
+}
+
+bool
+extract_handler::
+on_number_part(
+    string_view,
+    error_code&)
+{
+    enter();
+    return true;
+}
+
+bool
+extract_handler::
+on_int64(
+    std::int64_t i,
+    string_view,
+    error_code&)
+{
+    enter();
+    return leaf(value(i));
+}
+
+bool
+extract_handler::
+on_uint64(
+    std::uint64_t u,
+    string_view,
+    error_code&)
+{
+    enter();
+    return leaf(value(u));
+}
+
+bool
+extract_handler::
+on_double(
+    double d,
+    string_view,
+    error_code&)
+{
+    enter();
+    return leaf(value(d));
+}
+
+bool
+extract_handler::
+on_bool(
+    bool b,
+    error_code&)
+{
+    enter();
+    return leaf(value(b));
+}
+
+bool
+extract_handler::
+on_null(error_code&)
+{
+    enter();
+    return leaf(value(nullptr));
+}
+
+bool
+extract_handler::
+on_comment_part(
+    string_view,
+    error_code&)
+{
+    return true;
+}
+
+bool
+extract_handler::
+on_comment(
+    string_view,
+    error_code&)
+{
+    return true;
+}
+
+} // namespace detail
+
+//----------------------------------------------------------
+
+stream_extractor::
+stream_extractor(
+    parse_options const& opt) noexcept
+    : p_(opt)
+{
+}
+
+std::size_t
+stream_extractor::
+add_pointer(string_view ptr)
+{
+    error_code ec;
+    auto const i =
+        p_.handler().add(ptr, ec);
+    if(ec)
+        detail::throw_system_error( ec );
+    return i;
+}
+
+void
+stream_extractor::
+reset(
+    callback_type cb,
+    void* user) noexcept
+{
+    p_.reset();
+    p_.handler().start(cb, user);
+}
+
+std::size_t
+stream_extractor::
+write(
+    char const* data,
+    std::size_t size,
+    error_code& ec)
+{
+    auto const n = p_.write_some(
+        true, data, size, ec);
+    if(! ec && n < size)
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+        p_.fail(ec);
+    }
+    return n;
+}
+
+std::size_t
+stream_extractor::
+write(
+    char const* data,
+    std::size_t size,
+    std::error_code& ec)
+{
+    error_code jec;
+    std::size_t const result =
+        write(data, size, jec);
+    ec = jec;
+    return result;
+}
+
+void
+stream_extractor::
+finish(error_code& ec)
+{
+    p_.write_some(
+        false, nullptr, 0, ec);
+}
+
+void
+stream_extractor::
+finish(std::error_code& ec)
+{
+    error_code jec;
+    finish(jec);
+    ec = jec;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -13,6 +13,8 @@
 #include <boost/json/stream_parser.hpp>
 #include <boost/json/basic_parser_impl.hpp>
 #include <boost/json/error.hpp>
+#include <boost/json/metrics.hpp>
+#include <boost/json/trace.hpp>
 #include <cstring>
 #include <stdexcept>
 #include <utility>
@@ -20,6 +22,16 @@
 namespace boost {
 namespace json {
 
+// Timing sites compile to nothing unless the
+// library is built with BOOST_JSON_PARSE_STATS.
+#ifdef BOOST_JSON_PARSE_STATS
+# define BOOST_JSON_TIMING_SCOPE() \
+    timing_scope ts_(*this)
+#else
+# define BOOST_JSON_TIMING_SCOPE() \
+    do { } while(false)
+#endif
+
 stream_parser::
 stream_parser(
     storage_ptr sp,
@@ -32,6 +44,19 @@ stream_parser(
         buffer,
         size)
 {
+    p_.handler().st.on_duplicate_key(
+        opt.on_duplicate_key);
+    p_.handler().st.raw_numbers(
+        opt.raw_numbers);
+    p_.handler().st.single_storage(
+        opt.single_storage);
+    p_.handler().st.pair_arrays(
+        opt.pair_key, opt.pair_value);
+    p_.handler().blobs(
+        opt.on_blob,
+        opt.blob_user,
+        opt.blob_keys,
+        opt.blob_keys_count);
     reset();
 }
 
@@ -45,6 +70,19 @@ stream_parser(
         nullptr,
         0)
 {
+    p_.handler().st.on_duplicate_key(
+        opt.on_duplicate_key);
+    p_.handler().st.raw_numbers(
+        opt.raw_numbers);
+    p_.handler().st.single_storage(
+        opt.single_storage);
+    p_.handler().st.pair_arrays(
+        opt.pair_key, opt.pair_value);
+    p_.handler().blobs(
+        opt.on_blob,
+        opt.blob_user,
+        opt.blob_keys,
+        opt.blob_keys_count);
     reset();
 }
 
@@ -54,6 +92,59 @@ reset(storage_ptr sp) noexcept
 {
     p_.reset();
     p_.handler().st.reset(sp);
+    ibuf_.clear();
+    nparsed_ = 0;
+    BOOST_JSON_TRACE_EMIT(
+        trace_event::document_begin, this, 0);
+}
+
+void
+stream_parser::
+reserve_input(std::size_t n)
+{
+    ibuf_.reserve(n);
+    ibuf_cap_ = n;
+}
+
+void
+stream_parser::
+shrink_to_fit() noexcept
+{
+    reset();
+    p_.shrink_to_fit();
+    p_.handler().st.shrink_to_fit();
+    // basic_string::shrink_to_fit is a
+    // non-binding request; swapping with
+    // an empty string frees the buffer
+    // unconditionally
+    std::string().swap(ibuf_);
+}
+
+bool
+stream_parser::
+flush_input(error_code& ec)
+{
+    if(nparsed_ > 0 && ! p_.done())
+        BOOST_JSON_TRACE_EMIT(
+            trace_event::parser_resume,
+            this, nparsed_);
+    auto const n = p_.write_some(
+        true, ibuf_.data(), ibuf_.size(), ec);
+    nparsed_ += n;
+    // buffered characters only come from write,
+    // which requires that all of them be consumed
+    if(! ec && n < ibuf_.size())
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+        p_.fail(ec);
+    }
+    ibuf_.clear();
+    if(! ec)
+        BOOST_JSON_TRACE_EMIT(p_.done() ?
+            trace_event::document_end :
+            trace_event::parser_suspend,
+            this, nparsed_);
+    return ! ec;
 }
 
 std::size_t
@@ -63,8 +154,23 @@ write_some(
     std::size_t size,
     error_code& ec)
 {
-    return p_.write_some(
+    BOOST_JSON_TIMING_SCOPE();
+    if( ! ibuf_.empty() &&
+        ! flush_input(ec))
+        return 0;
+    if(nparsed_ > 0 && ! p_.done())
+        BOOST_JSON_TRACE_EMIT(
+            trace_event::parser_resume,
+            this, nparsed_);
+    auto const n = p_.write_some(
         true, data, size, ec);
+    nparsed_ += n;
+    if(! ec)
+        BOOST_JSON_TRACE_EMIT(p_.done() ?
+            trace_event::document_end :
+            trace_event::parser_suspend,
+            this, nparsed_);
+    return n;
 }
 
 std::size_t
@@ -94,6 +200,53 @@ write_some(
     return n;
 }
 
+std::size_t
+stream_parser::
+write_some(
+    char const* data,
+    std::size_t size,
+    std::size_t max_work,
+    error_code& ec)
+{
+    // the parser performs bounded work per
+    // character, so capping the slice bounds
+    // the time spent in this call; the suspend
+    // states resume mid-token on the next one
+    if( size > max_work )
+        size = max_work;
+    return write_some(data, size, ec);
+}
+
+std::size_t
+stream_parser::
+write_some(
+    char const* data,
+    std::size_t size,
+    std::size_t max_work,
+    std::error_code& ec)
+{
+    error_code jec;
+    std::size_t const result = write_some(
+        data, size, max_work, jec);
+    ec = jec;
+    return result;
+}
+
+std::size_t
+stream_parser::
+write_some(
+    char const* data,
+    std::size_t size,
+    std::size_t max_work)
+{
+    error_code ec;
+    auto const n = write_some(
+        data, size, max_work, ec);
+    if(ec)
+        detail::throw_system_error( ec );
+    return n;
+}
+
 std::size_t
 stream_parser::
 write(
@@ -101,6 +254,36 @@ write(
     std::size_t size,
     error_code& ec)
 {
+    BOOST_JSON_TIMING_SCOPE();
+    BOOST_JSON_METRICS_TIMER(
+        mt, metrics_op::parser_write);
+    if( ibuf_cap_ > 0 &&
+        (! ibuf_.empty() || size < ibuf_cap_))
+    {
+        // coalesce small writes so that the
+        // parse loop runs over long spans and
+        // suspends at far fewer boundaries
+        std::size_t appended = 0;
+        while(appended < size)
+        {
+            std::size_t n =
+                ibuf_cap_ - ibuf_.size();
+            if(n > size - appended)
+                n = size - appended;
+            ibuf_.append(
+                data + appended, n);
+            appended += n;
+            if( ibuf_.size() >= ibuf_cap_ &&
+                ! flush_input(ec))
+            {
+                BOOST_JSON_METRICS_BYTES(
+                    mt, appended);
+                return appended;
+            }
+        }
+        BOOST_JSON_METRICS_BYTES(mt, size);
+        return size;
+    }
     auto const n = write_some(
         data, size, ec);
     if(! ec && n < size)
@@ -108,6 +291,7 @@ write(
         BOOST_JSON_FAIL(ec, error::extra_data);
         p_.fail(ec);
     }
+    BOOST_JSON_METRICS_BYTES(mt, n);
     return n;
 }
 
@@ -138,11 +322,77 @@ write(
     return n;
 }
 
+std::size_t
+stream_parser::
+write(
+    string_view const* buffers,
+    std::size_t count,
+    error_code& ec)
+{
+    // the parser's own suspend machinery
+    // carries tokens across the seams, so the
+    // chain never needs to be flattened
+    std::size_t total = 0;
+    ec = {};
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        total += write(
+            buffers[i].data(),
+            buffers[i].size(), ec);
+        if(ec)
+            break;
+    }
+    return total;
+}
+
+std::size_t
+stream_parser::
+write(
+    string_view const* buffers,
+    std::size_t count,
+    std::error_code& ec)
+{
+    error_code jec;
+    std::size_t const result =
+        write(buffers, count, jec);
+    ec = jec;
+    return result;
+}
+
+std::size_t
+stream_parser::
+write(
+    string_view const* buffers,
+    std::size_t count)
+{
+    error_code ec;
+    auto const n = write(
+        buffers, count, ec);
+    if(ec)
+        detail::throw_system_error( ec );
+    return n;
+}
+
 void
 stream_parser::
 finish(error_code& ec)
 {
+    BOOST_JSON_TIMING_SCOPE();
+    if( ! ibuf_.empty() &&
+        ! flush_input(ec))
+        return;
+    // finishing an already complete document
+    // must not report its end a second time
+    bool const was_done = p_.done();
+    if(nparsed_ > 0 && ! was_done)
+        BOOST_JSON_TRACE_EMIT(
+            trace_event::parser_resume,
+            this, nparsed_);
     p_.write_some(false, nullptr, 0, ec);
+    if(! ec && ! was_done)
+        BOOST_JSON_TRACE_EMIT(
+            trace_event::document_end,
+            this, nparsed_);
 }
 
 void
@@ -168,7 +418,7 @@ value
 stream_parser::
 release()
 {
-    if(! p_.done())
+    if(! p_.done() || ! ibuf_.empty())
     {
         // prevent undefined behavior
         finish();
@@ -176,6 +426,8 @@ release()
     return p_.handler().st.release();
 }
 
+#undef BOOST_JSON_TIMING_SCOPE
+
 } // namespace json
 } // namespace boost
 
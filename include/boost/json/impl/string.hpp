@@ -38,6 +38,18 @@ string(
 {
 }
 
+string::
+string(
+    detail::key_t const&,
+    char* s,
+    std::size_t n,
+    storage_ptr sp)
+    : sp_(std::move(sp))
+    , impl_(detail::key_t{},
+        s, n)
+{
+}
+
 template<class InputIt, class>
 string::
 string(
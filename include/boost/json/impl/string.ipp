@@ -176,9 +176,16 @@ assign(
     char const* s,
     size_type count)
 {
-    std::char_traits<char>::copy(
-        impl_.assign(count, sp_),
-        s, count);
+    auto const dest =
+        impl_.assign(count, sp_);
+    // most strings seen during parsing fit
+    // the small copy; the branch is cheaper
+    // than memcpy's own length dispatch
+    if(count <= detail::copy_small_max)
+        detail::copy_small(dest, s, count);
+    else
+        std::char_traits<char>::copy(
+            dest, s, count);
     return *this;
 }
 
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_STRING_BUILDER_IPP
+#define BOOST_JSON_IMPL_STRING_BUILDER_IPP
+
+#include <boost/json/string_builder.hpp>
+#include <cstring>
+#include <new>
+
+namespace boost {
+namespace json {
+
+string_builder::
+~string_builder()
+{
+    clear();
+}
+
+void
+string_builder::
+append(string_view s)
+{
+    std::size_t n = s.size();
+    char const* p = s.data();
+    if(tail_)
+    {
+        // fill the remaining space
+        // in the current segment
+        auto const avail =
+            tail_->capacity - tail_->size;
+        auto const amount =
+            n < avail ? n : avail;
+        std::memcpy(
+            tail_->data() + tail_->size,
+            p, amount);
+        tail_->size += amount;
+        size_ += amount;
+        p += amount;
+        n -= amount;
+    }
+    if(n == 0)
+        return;
+    // segment capacities double, so the
+    // number of segments stays logarithmic
+    // in the size of the result.
+    std::size_t cap = tail_ ?
+        tail_->capacity * 2 : 512;
+    if(cap < n)
+        cap = n;
+    // temporary segments always come from
+    // the default resource; using the
+    // destination storage here would leak
+    // them into an arena permanently.
+    storage_ptr sp;
+    auto seg = ::new(sp->allocate(
+        sizeof(segment) + cap,
+            alignof(segment))) segment{
+                nullptr, n, cap};
+    std::memcpy(seg->data(), p, n);
+    if(tail_)
+        tail_->next = seg;
+    else
+        head_ = seg;
+    tail_ = seg;
+    size_ += n;
+}
+
+void
+string_builder::
+clear() noexcept
+{
+    storage_ptr sp;
+    auto seg = head_;
+    while(seg)
+    {
+        auto const next = seg->next;
+        sp->deallocate(seg,
+            sizeof(segment) + seg->capacity,
+            alignof(segment));
+        seg = next;
+    }
+    head_ = nullptr;
+    tail_ = nullptr;
+    size_ = 0;
+}
+
+string
+string_builder::
+release()
+{
+    string s(sp_);
+    if(size_ > 0)
+    {
+        s.reserve(size_);
+        char* dest = s.data();
+        for(auto seg = head_;
+            seg; seg = seg->next)
+        {
+            std::memcpy(dest,
+                seg->data(), seg->size);
+            dest += seg->size;
+        }
+        s.grow(size_);
+        clear();
+    }
+    return s;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
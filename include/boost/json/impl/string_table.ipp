@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_STRING_TABLE_IPP
+#define BOOST_JSON_IMPL_STRING_TABLE_IPP
+
+#include <boost/json/string_table.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/detail/digest.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+string_table::
+~string_table()
+{
+    // entries must survive the table when the
+    // resource is shared: views handed out by
+    // insert are promised to remain valid for
+    // the lifetime of the storage pointer
+    if( sp_.is_shared() ||
+        sp_.is_deallocate_trivial())
+        return;
+    for(std::size_t i = 0;
+        i < bucket_count_; ++i)
+    {
+        entry* e = buckets_[i];
+        while(e)
+        {
+            entry* const next = e->next;
+            sp_->deallocate(e,
+                sizeof(entry) + e->size + 1,
+                alignof(entry));
+            e = next;
+        }
+    }
+    if(buckets_)
+        sp_->deallocate(buckets_,
+            bucket_count_ * sizeof(entry*),
+            alignof(entry*));
+}
+
+string_table::
+string_table()
+    : sp_(make_shared_resource<
+        monotonic_resource>())
+{
+}
+
+string_table::
+string_table(storage_ptr sp)
+    : sp_(std::move(sp))
+{
+}
+
+auto
+string_table::
+bucket(string_view s) const noexcept ->
+    entry**
+{
+    auto const hash = detail::digest(
+        s.begin(), s.end(), 0);
+    return &buckets_[
+        hash & (bucket_count_ - 1)];
+}
+
+void
+string_table::
+rehash()
+{
+    auto const new_count = bucket_count_
+        ? bucket_count_ * 2 : 16;
+    auto const new_buckets =
+        reinterpret_cast<entry**>(
+            sp_->allocate(
+                new_count * sizeof(entry*),
+                alignof(entry*)));
+    std::memset(new_buckets, 0,
+        new_count * sizeof(entry*));
+    auto const old_buckets = buckets_;
+    auto const old_count = bucket_count_;
+    buckets_ = new_buckets;
+    bucket_count_ = new_count;
+    for(std::size_t i = 0;
+        i < old_count; ++i)
+    {
+        entry* e = old_buckets[i];
+        while(e)
+        {
+            entry* const next = e->next;
+            auto const head = bucket(
+                string_view(
+                    reinterpret_cast<
+                        char const*>(e + 1),
+                    e->size));
+            e->next = *head;
+            *head = e;
+            e = next;
+        }
+    }
+    if(old_buckets)
+        sp_->deallocate(old_buckets,
+            old_count * sizeof(entry*),
+            alignof(entry*));
+}
+
+string_view
+string_table::
+insert(string_view s)
+{
+    if(BOOST_JSON_LIKELY(bucket_count_))
+    {
+        entry* e = *bucket(s);
+        while(e)
+        {
+            if( e->size == s.size() &&
+                std::memcmp(e + 1, s.data(),
+                    s.size()) == 0)
+                return {reinterpret_cast<
+                    char const*>(e + 1),
+                    e->size};
+            e = e->next;
+        }
+    }
+    // grow first, so a thrown allocation
+    // cannot leave a linked entry behind
+    if(size_ >= bucket_count_)
+        rehash();
+    auto const e =
+        reinterpret_cast<entry*>(
+            sp_->allocate(
+                sizeof(entry) + s.size() + 1,
+                alignof(entry)));
+    e->size = static_cast<
+        std::uint32_t>(s.size());
+    auto const chars =
+        reinterpret_cast<char*>(e + 1);
+    std::memcpy(chars, s.data(), s.size());
+    chars[s.size()] = 0;
+    auto const head = bucket(s);
+    e->next = *head;
+    *head = e;
+    ++size_;
+    return {chars, s.size()};
+}
+
+string_view
+string_table::
+find(string_view s) const noexcept
+{
+    if(BOOST_JSON_LIKELY(bucket_count_))
+    {
+        entry* e = *bucket(s);
+        while(e)
+        {
+            if( e->size == s.size() &&
+                std::memcmp(e + 1, s.data(),
+                    s.size()) == 0)
+                return {reinterpret_cast<
+                    char const*>(e + 1),
+                    e->size};
+            e = e->next;
+        }
+    }
+    return {};
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_THREAD_LOCAL_RESOURCE_IPP
+#define BOOST_JSON_IMPL_THREAD_LOCAL_RESOURCE_IPP
+
+#include <boost/json/thread_local_resource.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+
+/** A resource with a per-thread freelist of recent blocks.
+
+    Small allocations are rounded up to a power of
+    two size class; freed blocks enter a bounded
+    per-thread freelist for their class and satisfy
+    later allocations without reaching the heap.
+    Requests larger than the biggest size class, or
+    with extended alignment, go straight to
+    `operator new` and `operator delete`.
+*/
+class thread_local_resource final
+    : public memory_resource
+{
+    enum : std::size_t
+    {
+        // size classes 16, 32, ... 4096
+        num_classes = 9,
+        min_class_size = 16,
+        max_class_size =
+            min_class_size << (num_classes - 1),
+
+        // bound on cached blocks per class,
+        // to cap per-thread memory held
+        max_per_class = 32
+    };
+
+    struct cache
+    {
+        struct node
+        {
+            node* next;
+        };
+
+        node* bins[num_classes] = {};
+        std::size_t counts[num_classes] = {};
+
+        // flushed on thread exit
+        ~cache()
+        {
+            for(auto p : bins)
+            {
+                while(p)
+                {
+                    auto const next = p->next;
+                    ::operator delete(p);
+                    p = next;
+                }
+            }
+        }
+    };
+
+    static
+    cache&
+    local() noexcept
+    {
+        static thread_local cache c;
+        return c;
+    }
+
+    // index of the smallest class holding n,
+    // valid for n <= max_class_size
+    static
+    std::size_t
+    class_of(std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        std::size_t size = min_class_size;
+        while(size < n)
+        {
+            size <<= 1;
+            ++i;
+        }
+        return i;
+    }
+
+public:
+    /// Copy constructor (deleted)
+    thread_local_resource(
+        thread_local_resource const&) = delete;
+
+    /// Copy assignment (deleted)
+    thread_local_resource& operator=(
+        thread_local_resource const&) = delete;
+
+    thread_local_resource() noexcept = default;
+
+protected:
+    void*
+    do_allocate(
+        std::size_t n,
+        std::size_t align) override
+    {
+        if( n <= max_class_size &&
+            align <= alignof(std::max_align_t))
+        {
+            auto const i = class_of(n);
+            auto& c = local();
+            if(auto const p = c.bins[i])
+            {
+                c.bins[i] = p->next;
+                --c.counts[i];
+                return p;
+            }
+            return ::operator new(
+                std::size_t(min_class_size) << i);
+        }
+        return ::operator new(n);
+    }
+
+    void
+    do_deallocate(
+        void* p,
+        std::size_t n,
+        std::size_t align) override
+    {
+        if( n <= max_class_size &&
+            align <= alignof(std::max_align_t))
+        {
+            auto const i = class_of(n);
+            auto& c = local();
+            if(c.counts[i] < max_per_class)
+            {
+                auto const node_ = ::new(p)
+                    cache::node{c.bins[i]};
+                c.bins[i] = node_;
+                ++c.counts[i];
+                return;
+            }
+        }
+        ::operator delete(p);
+    }
+
+    bool
+    do_is_equal(
+        memory_resource const& mr
+            ) const noexcept override
+    {
+        return this == &mr;
+    }
+};
+
+} // detail
+
+memory_resource*
+get_thread_local_resource() noexcept
+{
+    static detail::thread_local_resource mr;
+    return &mr;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
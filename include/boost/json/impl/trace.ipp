@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_TRACE_IPP
+#define BOOST_JSON_IMPL_TRACE_IPP
+
+#include <boost/json/trace.hpp>
+#include <atomic>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// constant-initialized so that it is usable
+// before main and from signal handlers; no
+// guard variable, no lock
+std::atomic<trace_hook> installed_hook(nullptr);
+
+} // (anon)
+
+trace_hook
+set_trace_hook(trace_hook hook) noexcept
+{
+    return installed_hook.exchange(
+        hook, std::memory_order_acq_rel);
+}
+
+namespace detail {
+
+void
+trace_emit(
+    trace_event ev,
+    void const* subject,
+    std::uint64_t arg) noexcept
+{
+    // a plain function pointer carries no
+    // payload which needs publishing; the
+    // relaxed load keeps the disabled case
+    // down to one predictable branch
+    auto const hook = installed_hook.load(
+        std::memory_order_relaxed);
+    if(hook)
+        hook(ev, subject, arg);
+}
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_TRACING_RESOURCE_IPP
+#define BOOST_JSON_IMPL_TRACING_RESOURCE_IPP
+
+#include <boost/json/tracing_resource.hpp>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// index of the power-of-two bucket for n
+std::size_t
+size_bucket(std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    while(n > 1 && i <
+        tracing_stats::num_buckets - 1)
+    {
+        n >>= 1;
+        ++i;
+    }
+    return i;
+}
+
+} // (anon)
+
+constexpr std::size_t tracing_stats::num_buckets;
+
+tracing_resource::
+tracing_resource(
+    storage_ptr upstream) noexcept
+    : upstream_(std::move(upstream))
+{
+}
+
+void*
+tracing_resource::
+do_allocate(
+    std::size_t n,
+    std::size_t align)
+{
+    void* p = upstream_->allocate(n, align);
+    // failed allocations throw
+    // and are not counted
+    ++stats_.allocations;
+    stats_.bytes_allocated += n;
+    stats_.bytes_outstanding += n;
+    if(stats_.bytes_outstanding >
+        stats_.peak_bytes)
+        stats_.peak_bytes =
+            stats_.bytes_outstanding;
+    if(n > stats_.largest_allocation)
+        stats_.largest_allocation = n;
+    ++stats_.histogram[size_bucket(n)];
+    return p;
+}
+
+void
+tracing_resource::
+do_deallocate(
+    void* p,
+    std::size_t n,
+    std::size_t align)
+{
+    ++stats_.deallocations;
+    if(stats_.bytes_outstanding >= n)
+        stats_.bytes_outstanding -= n;
+    else
+        stats_.bytes_outstanding = 0;
+    upstream_->deallocate(p, n, align);
+}
+
+bool
+tracing_resource::
+do_is_equal(
+    memory_resource const& mr) const noexcept
+{
+    return this == &mr;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
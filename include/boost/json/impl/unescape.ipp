@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_UNESCAPE_IPP
+#define BOOST_JSON_IMPL_UNESCAPE_IPP
+
+#include <boost/json/unescape.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/detail/uescape.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+std::size_t
+unescape(
+    string_view s,
+    char* dest,
+    error_code& ec)
+{
+    char const* p = s.data();
+    char const* const end = p + s.size();
+    char* d = dest;
+    ec = {};
+    while(p != end)
+    {
+        // copy the run up to the next escape
+        auto q = static_cast<char const*>(
+            std::memchr(p, '\\', end - p));
+        if(! q)
+            q = end;
+        std::memcpy(d, p, q - p);
+        d += q - p;
+        p = q;
+        if(p == end)
+            break;
+        if(end - p < 2)
+        {
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return 0;
+        }
+        ++p;
+        switch(*p++)
+        {
+        case '\x22': *d++ = '\x22'; break; // '"'
+        case '\\': *d++ = '\\'; break;
+        case '/': *d++ = '/'; break;
+        case 'b': *d++ = '\x08'; break;
+        case 'f': *d++ = '\x0c'; break;
+        case 'n': *d++ = '\x0a'; break;
+        case 'r': *d++ = '\x0d'; break;
+        case 't': *d++ = '\x09'; break;
+        case 'u':
+        {
+            // a run of whole, valid escapes is
+            // decoded in bulk; the output never
+            // exceeds the input it replaces, so
+            // the remaining input length bounds
+            // the space the run may use
+            {
+                char const* const r0 = p - 2;
+                char const* const r =
+                    detail::parse_uescape_run(
+                        r0, end, d, d + (end - r0));
+                if(r != r0)
+                {
+                    if(end - r < 2 ||
+                        r[0] != '\\' || r[1] != 'u')
+                    {
+                        // the whole run decoded
+                        p = r;
+                        break;
+                    }
+                    // an irregular escape stopped
+                    // the run; the code below
+                    // reports it
+                    p = r + 2;
+                }
+            }
+            // utf16 escape
+            if(end - p < 4)
+            {
+                BOOST_JSON_FAIL(ec, error::incomplete);
+                return 0;
+            }
+            int const u1 = detail::parse_hex4(p);
+            if(u1 == -1)
+            {
+                BOOST_JSON_FAIL(ec, error::expected_hex_digit);
+                return 0;
+            }
+            p += 4;
+            // valid unicode scalar values are
+            // [0, D7FF] and [E000, 10FFFF]
+            if( u1 < 0xd800 || u1 > 0xdfff)
+            {
+                d = detail::append_utf8(d, u1);
+                break;
+            }
+            if(u1 > 0xdbff)
+            {
+                BOOST_JSON_FAIL(ec, error::illegal_leading_surrogate);
+                return 0;
+            }
+            if(end - p < 6)
+            {
+                BOOST_JSON_FAIL(ec, error::incomplete);
+                return 0;
+            }
+            if(p[0] != '\\' || p[1] != 'u')
+            {
+                BOOST_JSON_FAIL(ec, error::syntax);
+                return 0;
+            }
+            p += 2;
+            int const u2 = detail::parse_hex4(p);
+            if(u2 == -1)
+            {
+                BOOST_JSON_FAIL(ec, error::expected_hex_digit);
+                return 0;
+            }
+            // valid trailing surrogates are [DC00, DFFF]
+            if(u2 < 0xdc00 || u2 > 0xdfff)
+            {
+                BOOST_JSON_FAIL(ec, error::illegal_trailing_surrogate);
+                return 0;
+            }
+            p += 4;
+            unsigned const cp =
+                ((u1 - 0xd800) << 10) +
+                ((u2 - 0xdc00)) +
+                    0x10000;
+            // utf-16 surrogate pair
+            d = detail::append_utf8(d, cp);
+            break;
+        }
+        default:
+        {
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return 0;
+        }
+        }
+    }
+    return d - dest;
+}
+
+std::size_t
+unescape(
+    string_view s,
+    char* dest)
+{
+    error_code ec;
+    auto const n = unescape(s, dest, ec);
+    if(ec)
+        detail::throw_system_error(ec);
+    return n;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
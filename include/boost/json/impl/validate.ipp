@@ -0,0 +1,672 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_VALIDATE_IPP
+#define BOOST_JSON_IMPL_VALIDATE_IPP
+
+#include <boost/json/validate.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/detail/sse2.hpp>
+#include <boost/json/detail/utf8.hpp>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace {
+
+// counts structural events without building
+// anything; used for option combinations which
+// the linear scan does not support.
+struct count_handler
+{
+    static constexpr std::size_t
+        max_object_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_array_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_key_size = std::size_t(-1);
+
+    static constexpr std::size_t
+        max_string_size = std::size_t(-1);
+
+    validate_stats& st;
+    std::size_t depth = 0;
+
+    explicit
+    count_handler(
+        validate_stats& st_) noexcept
+        : st(st_)
+    {
+    }
+
+    bool on_document_begin(error_code&) { return true; }
+    bool on_document_end(error_code&) { return true; }
+    bool on_object_begin(error_code&)
+    {
+        ++st.objects;
+        if(++depth > st.max_depth)
+            st.max_depth = depth;
+        return true;
+    }
+    bool on_object_end(std::size_t, error_code&)
+    {
+        --depth;
+        return true;
+    }
+    bool on_array_begin(error_code&)
+    {
+        ++st.arrays;
+        if(++depth > st.max_depth)
+            st.max_depth = depth;
+        return true;
+    }
+    bool on_array_end(std::size_t, error_code&)
+    {
+        --depth;
+        return true;
+    }
+    bool on_key_part(string_view, std::size_t, error_code&) { return true; }
+    bool on_key(string_view, std::size_t, error_code&)
+    {
+        ++st.keys;
+        return true;
+    }
+    bool on_string_part(string_view, std::size_t, error_code&) { return true; }
+    bool on_string(string_view, std::size_t, error_code&)
+    {
+        ++st.strings;
+        return true;
+    }
+    bool on_number_part(string_view, error_code&) { return true; }
+    bool on_int64(std::int64_t, string_view, error_code&)
+    {
+        ++st.numbers;
+        return true;
+    }
+    bool on_uint64(std::uint64_t, string_view, error_code&)
+    {
+        ++st.numbers;
+        return true;
+    }
+    bool on_double(double, string_view, error_code&)
+    {
+        ++st.numbers;
+        return true;
+    }
+    bool on_bool(bool, error_code&)
+    {
+        ++st.bools;
+        return true;
+    }
+    bool on_null(error_code&)
+    {
+        ++st.nulls;
+        return true;
+    }
+    bool on_comment_part(string_view, error_code&) { return true; }
+    bool on_comment(string_view, error_code&) { return true; }
+};
+
+// single pass over a complete text using the
+// vectorized scan kernels, checking syntax
+// without converting or storing anything
+template<bool AllowBadUTF8>
+class validate_scanner
+{
+    char const* base_;
+    char const* end_;
+    validate_stats& st_;
+    std::size_t max_depth_;
+
+    bool
+    do_string(
+        char const*& p,
+        error_code& ec);
+
+    bool
+    do_number(
+        char const*& p,
+        error_code& ec);
+
+    bool
+    do_literal(
+        char const*& p,
+        char const* s,
+        std::size_t n,
+        error_code& ec);
+
+public:
+    validate_scanner(
+        string_view s,
+        validate_stats& st,
+        parse_options const& opt) noexcept
+        : base_(s.data())
+        , end_(s.data() + s.size())
+        , st_(st)
+        , max_depth_(opt.max_depth)
+    {
+    }
+
+    bool
+    run(error_code& ec);
+};
+
+template<bool AllowBadUTF8>
+bool
+validate_scanner<AllowBadUTF8>::
+do_string(
+    char const*& p,
+    error_code& ec)
+{
+    char const* q = p + 1;
+    for(;;)
+    {
+        q = detail::count_valid<
+            AllowBadUTF8>(q, end_);
+        if(BOOST_JSON_UNLIKELY(q == end_))
+        {
+            st_.position = static_cast<
+                std::size_t>(q - base_);
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return false;
+        }
+        if(*q == '\x22')
+            break;
+        if(BOOST_JSON_UNLIKELY(*q != '\\'))
+        {
+            // control character or invalid utf-8
+            st_.position = static_cast<
+                std::size_t>(q - base_);
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        ++q;
+        if(BOOST_JSON_UNLIKELY(q == end_))
+        {
+            st_.position = static_cast<
+                std::size_t>(q - base_);
+            BOOST_JSON_FAIL(ec, error::incomplete);
+            return false;
+        }
+        switch(*q)
+        {
+        case '\x22': case '\\': case '/':
+        case 'b': case 'f': case 'n':
+        case 'r': case 't':
+            ++q;
+            break;
+        case 'u':
+        {
+            ++q;
+            if(BOOST_JSON_UNLIKELY(end_ - q < 4))
+            {
+                st_.position = static_cast<
+                    std::size_t>(q - base_);
+                BOOST_JSON_FAIL(ec, error::incomplete);
+                return false;
+            }
+            int const d1 = detail::hex_digit(
+                static_cast<unsigned char>(q[0]));
+            int const d2 = detail::hex_digit(
+                static_cast<unsigned char>(q[1]));
+            int const d3 = detail::hex_digit(
+                static_cast<unsigned char>(q[2]));
+            int const d4 = detail::hex_digit(
+                static_cast<unsigned char>(q[3]));
+            if(BOOST_JSON_UNLIKELY(
+                (d1 | d2 | d3 | d4) == -1))
+            {
+                st_.position = static_cast<
+                    std::size_t>(q - base_);
+                BOOST_JSON_FAIL(ec,
+                    error::expected_hex_digit);
+                return false;
+            }
+            unsigned const cp =
+                (d1 << 12) + (d2 << 8) +
+                (d3 << 4) + d4;
+            q += 4;
+            if(cp >= 0xd800 && cp <= 0xdfff)
+            {
+                if(BOOST_JSON_UNLIKELY(cp > 0xdbff))
+                {
+                    st_.position = static_cast<
+                        std::size_t>(q - base_);
+                    BOOST_JSON_FAIL(ec,
+                        error::illegal_leading_surrogate);
+                    return false;
+                }
+                if(BOOST_JSON_UNLIKELY(
+                    end_ - q < 6 ||
+                    q[0] != '\\' || q[1] != 'u'))
+                {
+                    st_.position = static_cast<
+                        std::size_t>(q - base_);
+                    BOOST_JSON_FAIL(ec, error::syntax);
+                    return false;
+                }
+                q += 2;
+                int const e1 = detail::hex_digit(
+                    static_cast<unsigned char>(q[0]));
+                int const e2 = detail::hex_digit(
+                    static_cast<unsigned char>(q[1]));
+                int const e3 = detail::hex_digit(
+                    static_cast<unsigned char>(q[2]));
+                int const e4 = detail::hex_digit(
+                    static_cast<unsigned char>(q[3]));
+                if(BOOST_JSON_UNLIKELY(
+                    (e1 | e2 | e3 | e4) == -1))
+                {
+                    st_.position = static_cast<
+                        std::size_t>(q - base_);
+                    BOOST_JSON_FAIL(ec,
+                        error::expected_hex_digit);
+                    return false;
+                }
+                unsigned const u2 =
+                    (e1 << 12) + (e2 << 8) +
+                    (e3 << 4) + e4;
+                if(BOOST_JSON_UNLIKELY(
+                    u2 < 0xdc00 || u2 > 0xdfff))
+                {
+                    st_.position = static_cast<
+                        std::size_t>(q - base_);
+                    BOOST_JSON_FAIL(ec,
+                        error::illegal_trailing_surrogate);
+                    return false;
+                }
+                q += 4;
+            }
+            break;
+        }
+        default:
+        {
+            st_.position = static_cast<
+                std::size_t>(q - base_);
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+        }
+    }
+    p = q + 1;
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+validate_scanner<AllowBadUTF8>::
+do_number(
+    char const*& p,
+    error_code& ec)
+{
+    if(*p == '-')
+        ++p;
+    if(BOOST_JSON_UNLIKELY(p == end_ ||
+        static_cast<unsigned char>(*p - '0') > 9))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, p == end_ ?
+            error::incomplete : error::syntax);
+        return false;
+    }
+    if(*p == '0')
+    {
+        ++p;
+        if(BOOST_JSON_UNLIKELY(p != end_ &&
+            static_cast<unsigned char>(*p - '0') <= 9))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+    }
+    else
+    {
+        // count_digits examines 16 bytes
+        // at a time
+        while(end_ - p >= 16)
+        {
+            int const n = detail::count_digits(p);
+            p += n;
+            if(n < 16)
+                break;
+        }
+        while(p != end_ && static_cast<
+            unsigned char>(*p - '0') <= 9)
+            ++p;
+    }
+    if(p != end_ && *p == '.')
+    {
+        ++p;
+        char const* const fs = p;
+        while(end_ - p >= 16)
+        {
+            int const n = detail::count_digits(p);
+            p += n;
+            if(n < 16)
+                break;
+        }
+        while(p != end_ && static_cast<
+            unsigned char>(*p - '0') <= 9)
+            ++p;
+        if(BOOST_JSON_UNLIKELY(p == fs))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, p == end_ ?
+                error::incomplete : error::syntax);
+            return false;
+        }
+    }
+    if(p != end_ && (*p | 32) == 'e')
+    {
+        ++p;
+        if(p != end_ && (*p == '+' || *p == '-'))
+            ++p;
+        char const* const es = p;
+        while(p != end_ && static_cast<
+            unsigned char>(*p - '0') <= 9)
+            ++p;
+        if(BOOST_JSON_UNLIKELY(p == es))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, p == end_ ?
+                error::incomplete : error::syntax);
+            return false;
+        }
+    }
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+validate_scanner<AllowBadUTF8>::
+do_literal(
+    char const*& p,
+    char const* s,
+    std::size_t n,
+    error_code& ec)
+{
+    if(BOOST_JSON_UNLIKELY(
+        static_cast<std::size_t>(end_ - p) < n))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(
+        std::memcmp(p, s, n) != 0))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    p += n;
+    return true;
+}
+
+template<bool AllowBadUTF8>
+bool
+validate_scanner<AllowBadUTF8>::
+run(error_code& ec)
+{
+    std::vector<char> frames;
+    frames.reserve(max_depth_ < 256 ?
+        max_depth_ : 256);
+    char const* p = detail::
+        count_whitespace(base_, end_);
+
+expect_value:
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    switch(*p)
+    {
+    case '{':
+        if(BOOST_JSON_UNLIKELY(
+            frames.size() >= max_depth_))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, error::too_deep);
+            return false;
+        }
+        frames.push_back('{');
+        if(frames.size() > st_.max_depth)
+            st_.max_depth = frames.size();
+        ++st_.objects;
+        ++p;
+        p = detail::count_whitespace(p, end_);
+        if(p != end_ && *p == '}')
+        {
+            ++p;
+            frames.pop_back();
+            goto have_value;
+        }
+        goto expect_key;
+
+    case '[':
+        if(BOOST_JSON_UNLIKELY(
+            frames.size() >= max_depth_))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, error::too_deep);
+            return false;
+        }
+        frames.push_back('[');
+        if(frames.size() > st_.max_depth)
+            st_.max_depth = frames.size();
+        ++st_.arrays;
+        ++p;
+        p = detail::count_whitespace(p, end_);
+        if(p != end_ && *p == ']')
+        {
+            ++p;
+            frames.pop_back();
+            goto have_value;
+        }
+        goto expect_value;
+
+    case '\x22':
+        if(BOOST_JSON_UNLIKELY(
+            ! do_string(p, ec)))
+            return false;
+        ++st_.strings;
+        goto have_value;
+
+    case 't':
+        if(BOOST_JSON_UNLIKELY(
+            ! do_literal(p, "true", 4, ec)))
+            return false;
+        ++st_.bools;
+        goto have_value;
+
+    case 'f':
+        if(BOOST_JSON_UNLIKELY(
+            ! do_literal(p, "false", 5, ec)))
+            return false;
+        ++st_.bools;
+        goto have_value;
+
+    case 'n':
+        if(BOOST_JSON_UNLIKELY(
+            ! do_literal(p, "null", 4, ec)))
+            return false;
+        ++st_.nulls;
+        goto have_value;
+
+    default:
+        if(*p == '-' || static_cast<
+            unsigned char>(*p - '0') <= 9)
+        {
+            if(BOOST_JSON_UNLIKELY(
+                ! do_number(p, ec)))
+                return false;
+            ++st_.numbers;
+            goto have_value;
+        }
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+
+expect_key:
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(*p != '\x22'))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::syntax);
+        return false;
+    }
+    if(BOOST_JSON_UNLIKELY(
+        ! do_string(p, ec)))
+        return false;
+    ++st_.keys;
+    p = detail::count_whitespace(p, end_);
+    if(BOOST_JSON_UNLIKELY(
+        p == end_ || *p != ':'))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, p == end_ ?
+            error::incomplete : error::syntax);
+        return false;
+    }
+    ++p;
+    p = detail::count_whitespace(p, end_);
+    goto expect_value;
+
+have_value:
+    p = detail::count_whitespace(p, end_);
+    if(frames.empty())
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        if(BOOST_JSON_UNLIKELY(p != end_))
+        {
+            BOOST_JSON_FAIL(ec, error::extra_data);
+            return false;
+        }
+        return true;
+    }
+    if(BOOST_JSON_UNLIKELY(p == end_))
+    {
+        st_.position = static_cast<
+            std::size_t>(p - base_);
+        BOOST_JSON_FAIL(ec, error::incomplete);
+        return false;
+    }
+    if(frames.back() == '{')
+    {
+        if(*p == ',')
+        {
+            ++p;
+            p = detail::count_whitespace(p, end_);
+            goto expect_key;
+        }
+        if(BOOST_JSON_UNLIKELY(*p != '}'))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+    }
+    else
+    {
+        if(*p == ',')
+        {
+            ++p;
+            p = detail::count_whitespace(p, end_);
+            goto expect_value;
+        }
+        if(BOOST_JSON_UNLIKELY(*p != ']'))
+        {
+            st_.position = static_cast<
+                std::size_t>(p - base_);
+            BOOST_JSON_FAIL(ec, error::syntax);
+            return false;
+        }
+    }
+    ++p;
+    frames.pop_back();
+    goto have_value;
+}
+
+} // (anon)
+
+bool
+validate(
+    string_view s,
+    error_code& ec,
+    validate_stats& st,
+    parse_options const& opt)
+{
+    ec = {};
+    st = validate_stats();
+    if( ! opt.allow_comments &&
+        ! opt.allow_trailing_commas &&
+        ! opt.allow_infinity_and_nan )
+    {
+        if(opt.allow_invalid_utf8)
+            return validate_scanner<
+                true>(s, st, opt).run(ec);
+        return validate_scanner<
+            false>(s, st, opt).run(ec);
+    }
+
+    // extensions are handled by the
+    // incremental parser with a handler
+    // which only counts events
+    basic_parser<count_handler> p(opt, st);
+    std::size_t const n = p.write_some(
+        false, s.data(), s.size(), ec);
+    if(! ec && n < s.size())
+    {
+        BOOST_JSON_FAIL(ec, error::extra_data);
+    }
+    st.position = n;
+    return ! ec;
+}
+
+bool
+validate(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt)
+{
+    validate_stats st;
+    return validate(s, ec, st, opt);
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
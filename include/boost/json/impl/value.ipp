@@ -12,6 +12,7 @@
 
 #include <boost/container_hash/hash.hpp>
 #include <boost/json/value.hpp>
+#include <boost/json/monotonic_resource.hpp>
 #include <boost/json/parser.hpp>
 #include <cstring>
 #include <istream>
@@ -144,6 +145,13 @@ value(
         ::new(&str_) string(
             other.str_,
             std::move(sp));
+        // the raw number mark is semantic, not
+        // an optimization; a copy must emit the
+        // same characters as the original
+        if(detail::access::raw_number(
+                other.str_))
+            detail::access::raw_number(
+                str_, true);
         break;
 
     case json::kind::array:
@@ -172,6 +180,17 @@ value(
     value&& other,
     storage_ptr sp)
 {
+#ifdef BOOST_JSON_REQUIRE_EXPLICIT_RELOCATION
+    // opt-in debug check: moving between
+    // different resources degrades to a
+    // deep copy. callers who define this
+    // macro want that cost made explicit
+    // with relocate() instead.
+    BOOST_ASSERT(
+        *sp == *other.storage() ||
+        ! ( other.is_string() ||
+            other.is_structured()));
+#endif
     switch(other.kind())
     {
     case json::kind::null:
@@ -416,6 +435,89 @@ swap(value& other)
     ::new(this) value(pilfer(temp2));
 }
 
+value
+value::
+freeze(storage_ptr sp) const
+{
+    // the copying constructors already
+    // allocate exactly: arrays and object
+    // tables at their size, strings at their
+    // length, with children copied depth-first.
+    // a fresh deep copy therefore yields the
+    // compact representation.
+    return value(*this, std::move(sp));
+}
+
+value
+value::
+clone_compact(std::size_t reserve) const
+{
+    // the compact copy allocates depth-first,
+    // so a bump-allocating arena receives the
+    // nodes in pre-order traversal order. a
+    // reserve of zero is raised to the arena's
+    // own lower limit.
+    return value(*this,
+        make_shared_resource<
+            monotonic_resource>(reserve));
+}
+
+namespace {
+
+// tally the work a cross-storage copy of
+// jv will perform, for relocation_stats
+void
+relocation_count(
+    value const& jv,
+    value::relocation_stats& st) noexcept
+{
+    ++st.values;
+    switch(jv.kind())
+    {
+    case kind::string:
+        st.string_bytes +=
+            jv.get_string().size();
+        break;
+    case kind::array:
+        for(auto const& e : jv.get_array())
+            relocation_count(e, st);
+        break;
+    case kind::object:
+        for(auto const& e : jv.get_object())
+        {
+            st.string_bytes +=
+                e.key().size();
+            relocation_count(
+                e.value(), st);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+} // (anon)
+
+auto
+value::
+relocate(storage_ptr sp) ->
+    relocation_stats
+{
+    relocation_stats st;
+    if(*sp == *storage())
+        return st;
+    relocation_count(*this, st);
+    st.relocated = true;
+    // the copying constructor allocates
+    // exactly and copies each container's
+    // element block and each string's
+    // characters in bulk
+    value temp(*this, std::move(sp));
+    this->~value();
+    ::new(this) value(pilfer(temp));
+    return st;
+}
+
 std::istream&
 operator>>(
     std::istream& is,
@@ -642,11 +744,6 @@ equal(value const& other) const noexcept
 //
 //----------------------------------------------------------
 
-// empty keys point here
-BOOST_JSON_REQUIRE_CONST_INIT
-char const
-key_value_pair::empty_[1] = { 0 };
-
 key_value_pair::
 key_value_pair(
     pilfered<json::value> key,
@@ -654,8 +751,25 @@ key_value_pair(
     : value_(value)
 {
     std::size_t len;
-    key_ = access::release_key(key.get(), len);
+    auto const s =
+        access::release_key(key.get(), len);
     len_ = static_cast<std::uint32_t>(len);
+    if(len_ <= inline_chars_)
+    {
+        // short keys are copied into the
+        // element and the parser's buffer
+        // returned, so lookups touch no
+        // memory outside the table
+        std::memcpy(buf_, s, len);
+        buf_[len] = 0;
+        auto const& sp = value_.storage();
+        if(! sp.is_deallocate_trivial())
+            sp->deallocate(
+                const_cast<char*>(s),
+                len + 1, alignof(char));
+        return;
+    }
+    key_ = s;
 }
 
 key_value_pair::
@@ -664,13 +778,20 @@ key_value_pair(
     storage_ptr sp)
     : value_(other.value_, std::move(sp))
 {
+    len_ = other.len_;
+    if(len_ <= inline_chars_)
+    {
+        std::memcpy(
+            buf_, other.buf_, len_);
+        buf_[len_] = 0;
+        return;
+    }
     auto p = reinterpret_cast<
         char*>(value_.storage()->
-            allocate(other.len_ + 1,
+            allocate(len_ + 1,
                 alignof(char)));
     std::memcpy(
-        p, other.key_, other.len_);
-    len_ = other.len_;
+        p, other.key_, len_);
     p[len_] = 0;
     key_ = p;
 }
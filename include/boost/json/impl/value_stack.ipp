@@ -11,6 +11,8 @@
 #define BOOST_JSON_IMPL_VALUE_STACK_IPP
 
 #include <boost/json/value_stack.hpp>
+#include <boost/json/detail/digest.hpp>
+#include <boost/json/detail/except.hpp>
 #include <cstring>
 #include <stdexcept>
 #include <utility>
@@ -41,6 +43,7 @@ stack(
     std::size_t size) noexcept
     : sp_(std::move(sp))
     , temp_(temp)
+    , temp_size_(size)
 {
     if(size >= min_size_ *
         sizeof(value))
@@ -103,6 +106,39 @@ clear() noexcept
     chars_ = 0;
 }
 
+// return the stack allocation to the
+// construction-time state; the values
+// must have been cleared already
+void
+value_stack::
+stack::
+shrink_to_fit() noexcept
+{
+    if( begin_ == temp_ ||
+        begin_ == nullptr)
+        return;
+    if( top_ != begin_ ||
+        chars_ != 0)
+        return;
+    sp_->deallocate(begin_,
+        (end_ - begin_) * sizeof(value));
+    if(temp_size_ >= min_size_ *
+        sizeof(value))
+    {
+        begin_ = reinterpret_cast<
+            value*>(temp_);
+        top_ = begin_;
+        end_ = begin_ +
+            temp_size_ / sizeof(value);
+    }
+    else
+    {
+        begin_ = nullptr;
+        top_ = nullptr;
+        end_ = nullptr;
+    }
+}
+
 void
 value_stack::
 stack::
@@ -129,6 +165,9 @@ grow_one()
         reinterpret_cast<value*>(
             sp_->allocate(
                 new_cap * sizeof(value)));
+#ifdef BOOST_JSON_PARSE_STATS
+    allocated_ += new_cap * sizeof(value);
+#endif
     std::size_t const cur_size = top_ - begin_;
     if(begin_)
     {
@@ -171,6 +210,58 @@ grow(std::size_t nchars)
         reinterpret_cast<value*>(
             sp_->allocate(
                 new_cap * sizeof(value)));
+#ifdef BOOST_JSON_PARSE_STATS
+    allocated_ += new_cap * sizeof(value);
+#endif
+    std::size_t const cur_size = top_ - begin_;
+    if(begin_)
+    {
+        std::size_t amount =
+            size() * sizeof(value);
+        if(chars_ > 0)
+            amount += sizeof(value) + chars_;
+        std::memcpy(
+            reinterpret_cast<char*>(begin),
+            reinterpret_cast<char*>(begin_),
+            amount);
+        if(begin_ != temp_)
+            sp_->deallocate(begin_,
+                capacity * sizeof(value));
+    }
+    // book-keeping
+    top_ = begin + cur_size;
+    end_ = begin + new_cap;
+    begin_ = begin;
+}
+
+// make room for at least n more values
+void
+value_stack::
+stack::
+reserve(std::size_t n)
+{
+    std::size_t const capacity =
+        end_ - begin_;
+    // account for a partial string,
+    // which starts at top_+1
+    std::size_t needed = size() + n;
+    if(chars_ > 0)
+        needed += 1 +
+            ((chars_ + sizeof(value) - 1) /
+                sizeof(value));
+    if(needed <= capacity)
+        return;
+    std::size_t new_cap = min_size_;
+    // VFALCO check overflow here
+    while(new_cap < needed)
+        new_cap <<= 1;
+    auto const begin =
+        reinterpret_cast<value*>(
+            sp_->allocate(
+                new_cap * sizeof(value)));
+#ifdef BOOST_JSON_PARSE_STATS
+    allocated_ += new_cap * sizeof(value);
+#endif
     std::size_t const cur_size = top_ - begin_;
     if(begin_)
     {
@@ -192,6 +283,27 @@ grow(std::size_t nchars)
     begin_ = begin;
 }
 
+// make room for a string of n characters
+// total, plus the value which will hold it
+void
+value_stack::
+stack::
+reserve_chars(std::size_t n)
+{
+    if(n <= chars_)
+        return;
+    std::size_t const capacity =
+        end_ - begin_;
+    std::size_t const needed =
+        size() +
+        1 +
+        ((n + sizeof(value) - 1) /
+            sizeof(value));
+    if(needed <= capacity)
+        return;
+    grow(n - chars_);
+}
+
 //--------------------------------------
 
 void
@@ -245,6 +357,18 @@ release_string() noexcept
         char const*>(top_ + 1), n };
 }
 
+// the top n elements of the stack,
+// which remain owned by the stack
+value*
+value_stack::
+stack::
+peek(std::size_t n) noexcept
+{
+    BOOST_ASSERT(n <= size());
+    BOOST_ASSERT(chars_ == 0);
+    return top_ - n;
+}
+
 // transfer ownership of the top n
 // elements of the stack to the caller
 value*
@@ -305,9 +429,12 @@ exchange(Unchecked&& u)
 value_stack::
 ~value_stack()
 {
-    // default dtor is here so the
-    // definition goes in the library
-    // instead of the caller's TU.
+    // destroy partial results while sp_ is
+    // still alive; in single-storage mode the
+    // elements do not keep the resource alive
+    // themselves, and sp_ is destroyed before
+    // st_ otherwise.
+    st_.clear();
 }
 
 value_stack::
@@ -332,10 +459,29 @@ reset(storage_ptr sp) noexcept
     ::new(&sp_) storage_ptr(
         pilfer(sp));
 
+    // in single-storage mode elements are
+    // built with a non-owning alias; sp_
+    // keeps the resource alive until the
+    // owning reference is handed to the
+    // root in release().
+    elided_ = single_storage_ &&
+        sp_.is_shared();
+    if(elided_)
+        esp_ = detail::unowned_alias(sp_);
+    else
+        esp_ = sp_;
+
     // `stack` needs this
     // to clean up correctly
     st_.run_dtors(
-        ! sp_.is_not_shared_and_deallocate_is_trivial());
+        ! esp_.is_not_shared_and_deallocate_is_trivial());
+
+    // key reuse requires that shared key
+    // allocations are never freed individually
+    reuse_keys_ = sp_.is_deallocate_trivial();
+    if(reuse_keys_)
+        for(auto& e : keys_)
+            e.str = nullptr;
 }
 
 value
@@ -347,10 +493,45 @@ release() noexcept
     // to be produced.
     BOOST_ASSERT(st_.size() == 1);
 
+    value& jv = *st_.release(1);
+
+    // the elements hold non-owning aliases;
+    // move the owning reference into the
+    // root so the result keeps the
+    // resource alive
+    if(elided_)
+    {
+        detail::access::sp(jv) =
+            std::move(sp_);
+        elided_ = false;
+    }
+
     // give up shared ownership
     sp_ = {};
+    esp_ = {};
 
-    return pilfer(*st_.release(1));
+    return pilfer(jv);
+}
+
+void
+value_stack::
+reserve(std::size_t n)
+{
+    st_.reserve(n);
+}
+
+void
+value_stack::
+reserve_chars(std::size_t n)
+{
+    st_.reserve_chars(n);
+}
+
+void
+value_stack::
+shrink_to_fit() noexcept
+{
+    st_.shrink_to_fit();
 }
 
 //----------------------------------------------------------
@@ -359,14 +540,94 @@ void
 value_stack::
 push_array(std::size_t n)
 {
+    if(BOOST_JSON_UNLIKELY(
+        ! pair_key_.empty() &&
+        ! pair_value_.empty() &&
+        n > 0))
+    {
+        if(maybe_push_pairs(n))
+            return;
+    }
     // we already have room if n > 0
     if(BOOST_JSON_UNLIKELY(n == 0))
         st_.maybe_grow();
     detail::unchecked_array ua(
-        st_.release(n), n, sp_);
+        st_.release(n), n, esp_);
     st_.exchange(std::move(ua));
 }
 
+// if the top n values all have the
+// pair-object shape, replace them with
+// an object and return true
+bool
+value_stack::
+maybe_push_pairs(std::size_t n)
+{
+    value* const a = st_.peek(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        object const* o =
+            a[i].if_object();
+        if( ! o || o->size() != 2)
+            return false;
+        value const* k =
+            o->if_contains(pair_key_);
+        if( ! k || ! k->is_string())
+            return false;
+        if(! o->if_contains(pair_value_))
+            return false;
+    }
+
+    // build the object before popping, so
+    // that the pair objects are still
+    // destroyed by the stack if an
+    // allocation throws.
+    object obj(esp_);
+    obj.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        object& o = a[i].get_object();
+        string_view const key =
+            o.find(pair_key_)->
+                value().get_string();
+        value& v = o.find(
+            pair_value_)->value();
+        switch(dup_keys_)
+        {
+        case duplicate_keys::last:
+            obj.insert_or_assign(
+                key, std::move(v));
+            break;
+        case duplicate_keys::first:
+            obj.emplace(
+                key, std::move(v));
+            break;
+        case duplicate_keys::error:
+            if(! obj.emplace(key,
+                std::move(v)).second)
+            {
+                BOOST_STATIC_CONSTEXPR
+                    source_location loc =
+                        BOOST_CURRENT_LOCATION;
+                detail::throw_system_error(
+                    error::duplicate_key, &loc );
+            }
+            break;
+        }
+    }
+
+    // the pair objects are no longer
+    // needed; the key characters were
+    // copied by the insertions above.
+    for(std::size_t i = n; i-- != 0;)
+        a[i].~value();
+    st_.release(n);
+    // cannot grow or throw: releasing
+    // n >= 1 values made room
+    st_.push(std::move(obj));
+    return true;
+}
+
 void
 value_stack::
 push_object(std::size_t n)
@@ -375,7 +636,8 @@ push_object(std::size_t n)
     if(BOOST_JSON_UNLIKELY(n == 0))
         st_.maybe_grow();
     detail::unchecked_object uo(
-        st_.release(n * 2), n, sp_);
+        st_.release(n * 2), n, esp_,
+        dup_keys_);
     st_.exchange(std::move(uo));
 }
 
@@ -394,22 +656,48 @@ push_key(
 {
     if(! st_.has_chars())
     {
-        st_.push(detail::key_t{}, s, sp_);
+        if(reuse_keys_)
+        {
+            auto& e = keys_[detail::digest(
+                s.begin(), s.end(), 0) & 63];
+            if(e.str && e.len == s.size() &&
+                std::memcmp(e.str, s.data(),
+                    s.size()) == 0)
+            {
+                st_.push(detail::key_t{},
+                    const_cast<char*>(e.str),
+                    s.size(), esp_);
+                return;
+            }
+            auto const& jv = st_.push(
+                detail::key_t{}, s, esp_);
+            std::size_t len;
+            e.str = detail::access::
+                key_data(jv, len);
+            e.len = static_cast<
+                std::uint32_t>(len);
+            return;
+        }
+        st_.push(detail::key_t{}, s, esp_);
         return;
     }
     auto part = st_.release_string();
-    st_.push(detail::key_t{}, part, s, sp_);
+    st_.push(detail::key_t{}, part, s, esp_);
 }
 
 void
 value_stack::
 push_string(
-    string_view s)
+    string_view s,
+    bool unescaped)
 {
     if(! st_.has_chars())
     {
         // fast path
-        st_.push(s, sp_);
+        auto& jv = st_.push(s, esp_);
+        if(unescaped)
+            detail::access::unescaped(
+                jv.get_string(), true);
         return;
     }
 
@@ -419,7 +707,7 @@ push_string(
     // to reduce member function calls.
     auto part = st_.release_string();
     auto& str = st_.push(
-        string_kind, sp_).get_string();
+        string_kind, esp_).get_string();
     str.reserve(
         part.size() + s.size());
     std::memcpy(
@@ -431,12 +719,45 @@ push_string(
     str.grow(part.size() + s.size());
 }
 
+void
+value_stack::
+push_raw_number(
+    string_view s)
+{
+    if(! st_.has_chars())
+    {
+        // fast path
+        auto& jv = st_.push(s, esp_);
+        auto& str = jv.get_string();
+        // numerals never contain characters
+        // which need escaping
+        detail::access::unescaped(str, true);
+        detail::access::raw_number(str, true);
+        return;
+    }
+
+    auto part = st_.release_string();
+    auto& str = st_.push(
+        string_kind, esp_).get_string();
+    str.reserve(
+        part.size() + s.size());
+    std::memcpy(
+        str.data(),
+        part.data(), part.size());
+    std::memcpy(
+        str.data() + part.size(),
+        s.data(), s.size());
+    str.grow(part.size() + s.size());
+    detail::access::unescaped(str, true);
+    detail::access::raw_number(str, true);
+}
+
 void
 value_stack::
 push_int64(
     int64_t i)
 {
-    st_.push(i, sp_);
+    st_.push(i, esp_);
 }
 
 void
@@ -444,7 +765,7 @@ value_stack::
 push_uint64(
     uint64_t u)
 {
-    st_.push(u, sp_);
+    st_.push(u, esp_);
 }
 
 void
@@ -452,7 +773,7 @@ value_stack::
 push_double(
     double d)
 {
-    st_.push(d, sp_);
+    st_.push(d, esp_);
 }
 
 void
@@ -460,14 +781,33 @@ value_stack::
 push_bool(
     bool b)
 {
-    st_.push(b, sp_);
+    st_.push(b, esp_);
 }
 
 void
 value_stack::
 push_null()
 {
-    st_.push(nullptr, sp_);
+    st_.push(nullptr, esp_);
+}
+
+void
+value_stack::
+push_value(
+    value&& jv)
+{
+    if(*jv.storage() == *esp_)
+    {
+        // the move constructor takes
+        // ownership of the contents
+        // without copying
+        st_.push(std::move(jv));
+        return;
+    }
+    // different resource; the tree keeps
+    // the invariant that every element
+    // uses the resource given to reset
+    st_.push(jv, esp_);
 }
 
 } // namespace json
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_IMPL_VALUE_TRANSACTION_IPP
+#define BOOST_JSON_IMPL_VALUE_TRANSACTION_IPP
+
+#include <boost/json/value_transaction.hpp>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+value_transaction::
+~value_transaction()
+{
+    if(active_)
+        rollback();
+}
+
+value_transaction::
+value_transaction(
+    monotonic_resource& mr) noexcept
+    : mr_(mr)
+    , cp_(mr.mark())
+{
+}
+
+value&
+value_transaction::
+modify(value& jv)
+{
+    BOOST_ASSERT(active_);
+    // the slot must live in the arena the
+    // transaction marked, or rollback would
+    // resurrect storage it does not control
+    BOOST_ASSERT(
+        jv.storage().get() == &mr_);
+    log_.emplace_back();
+    auto& u = log_.back();
+    u.slot = &jv;
+    std::memcpy(
+        u.bits,
+        static_cast<void const*>(&jv),
+        sizeof(value));
+    return jv;
+}
+
+void
+value_transaction::
+commit() noexcept
+{
+    log_.clear();
+    active_ = false;
+}
+
+void
+value_transaction::
+rollback() noexcept
+{
+    // restore the slots before reclaiming the
+    // arena: the recorded representations point
+    // into pre-mark storage, while the values
+    // currently in the slots may point past the
+    // mark and must not be read afterwards
+    for(auto it = log_.rbegin();
+        it != log_.rend(); ++it)
+        std::memcpy(
+            static_cast<void*>(it->slot),
+            it->bits,
+            sizeof(value));
+    mr_.rollback(cp_);
+    log_.clear();
+    active_ = false;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -55,6 +55,127 @@ visit(
     }
 }
 
+namespace detail {
+
+// the accessor for each kind, selected at
+// compile time so that the loop body of
+// visit_uniform contains no kind dispatch
+template<kind K> struct value_accessor;
+template<> struct value_accessor<kind::null>
+{
+    template<class V> static std::nullptr_t get(V&) noexcept
+        { return nullptr; }
+};
+template<> struct value_accessor<kind::bool_>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_bool()) { return jv.get_bool(); }
+};
+template<> struct value_accessor<kind::int64>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_int64()) { return jv.get_int64(); }
+};
+template<> struct value_accessor<kind::uint64>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_uint64()) { return jv.get_uint64(); }
+};
+template<> struct value_accessor<kind::double_>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_double()) { return jv.get_double(); }
+};
+template<> struct value_accessor<kind::string>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_string()) { return jv.get_string(); }
+};
+template<> struct value_accessor<kind::array>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_array()) { return jv.get_array(); }
+};
+template<> struct value_accessor<kind::object>
+{
+    template<class V> static auto get(V& jv) noexcept
+        -> decltype(jv.get_object()) { return jv.get_object(); }
+};
+
+template<kind K, class Visitor, class Value>
+void
+visit_uniform(Visitor& v, Value* it, Value* last)
+{
+    for(; it != last; ++it)
+        v(value_accessor<K>::get(*it));
+}
+
+template<class Visitor, class Value>
+void
+visit_all_impl(Visitor& v, Value* it, Value* last)
+{
+    while(it != last)
+    {
+        // find the run of elements
+        // with the same kind
+        auto const k = it->kind();
+        auto run = it + 1;
+        while(run != last && run->kind() == k)
+            ++run;
+        switch(k)
+        {
+        default:
+        case kind::null:
+            visit_uniform<kind::null>(v, it, run);
+            break;
+        case kind::bool_:
+            visit_uniform<kind::bool_>(v, it, run);
+            break;
+        case kind::int64:
+            visit_uniform<kind::int64>(v, it, run);
+            break;
+        case kind::uint64:
+            visit_uniform<kind::uint64>(v, it, run);
+            break;
+        case kind::double_:
+            visit_uniform<kind::double_>(v, it, run);
+            break;
+        case kind::string:
+            visit_uniform<kind::string>(v, it, run);
+            break;
+        case kind::array:
+            visit_uniform<kind::array>(v, it, run);
+            break;
+        case kind::object:
+            visit_uniform<kind::object>(v, it, run);
+            break;
+        }
+        it = run;
+    }
+}
+
+} // detail
+
+template<class Visitor>
+void
+visit_all(
+    Visitor&& v,
+    array& arr)
+{
+    detail::visit_all_impl(
+        v, arr.data(), arr.data() + arr.size());
+}
+
+template<class Visitor>
+void
+visit_all(
+    Visitor&& v,
+    array const& arr)
+{
+    detail::visit_all_impl(
+        v, arr.data(), arr.data() + arr.size());
+}
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_LAZY_VALUE_HPP
+#define BOOST_JSON_LAZY_VALUE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** A JSON document which materializes values on demand.
+
+    Objects of this type reference a complete JSON
+    text along with an index of its structure, and
+    construct @ref value trees only for the parts of
+    the document which are actually navigated to.
+    This is useful when only a few fields of a large
+    document are needed; the cost of building the
+    full tree is avoided entirely.
+
+    Use @ref lazy_parse to obtain a lazy document,
+    then call @ref at_pointer with a JSON Pointer
+    (RFC 6901) to materialize just the addressed
+    value, or @ref materialize to build the whole
+    document.
+
+    @par Lifetime
+
+    The document does not take ownership of the
+    character buffer; it holds only a view. The
+    caller must ensure that the buffer remains
+    valid and unmodified until the lazy document
+    is destroyed or reassigned.
+
+    @par Validation
+
+    Constructing the lazy document scans the text
+    once to locate strings and structural
+    characters, but full syntax checking is only
+    performed for the regions which are
+    materialized. A document which is never fully
+    navigated may therefore contain undetected
+    errors outside the visited regions. Use
+    @ref materialize to validate the entire text.
+
+    @par Example
+
+    @code
+
+    std::string body = load_request();
+
+    lazy_value doc = lazy_parse( body );
+
+    // builds only the addressed value
+    value route = doc.at_pointer( "/request/route" );
+
+    @endcode
+
+    @see @ref lazy_parse, @ref parse,
+        @ref value::at_pointer.
+*/
+class lazy_value
+{
+    string_view text_;
+    std::vector<std::size_t> idx_;
+    parse_options opt_;
+
+    lazy_value(
+        string_view text,
+        std::vector<std::size_t>&& idx,
+        parse_options const& opt) noexcept
+        : text_(text)
+        , idx_(std::move(idx))
+        , opt_(opt)
+    {
+    }
+
+    BOOST_JSON_DECL
+    friend
+    lazy_value
+    lazy_parse(
+        string_view s,
+        error_code& ec,
+        parse_options const& opt);
+
+public:
+    /** Default constructor.
+
+        The document references no text. Navigation
+        of a default-constructed document fails.
+    */
+    lazy_value() = default;
+
+    /** Return the referenced JSON text.
+    */
+    string_view
+    text() const noexcept
+    {
+        return text_;
+    }
+
+    /** Return the value referenced by a JSON Pointer.
+
+        This function finds the value addressed by
+        `ptr` by navigating the structural index, and
+        builds a @ref value for just that part of the
+        document. Sibling values along the path are
+        skipped without being parsed or allocated.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return The materialized value.
+
+        @param ptr The JSON Pointer string to use.
+
+        @param ec Set to the error, if any occurred.
+        Errors include pointer resolution failures,
+        such as @ref error::not_found, and syntax
+        errors discovered in the navigated region.
+
+        @param sp The memory resource that the
+        returned value and all of its elements
+        will use. If this parameter is omitted,
+        the default memory resource is used.
+
+        @see @ref value::find_pointer.
+    */
+    BOOST_JSON_DECL
+    value
+    at_pointer(
+        string_view ptr,
+        error_code& ec,
+        storage_ptr sp = {}) const;
+
+    /** Return the value referenced by a JSON Pointer.
+
+        @copydetails at_pointer(string_view,error_code&,storage_ptr) const
+
+        @throw system_error on failure.
+    */
+    BOOST_JSON_DECL
+    value
+    at_pointer(
+        string_view ptr,
+        storage_ptr sp = {}) const;
+
+    /** Build the complete document.
+
+        This function parses the entire referenced
+        text and returns the resulting @ref value,
+        reusing the structural index built when the
+        document was created.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return The parsed value, or null on error.
+
+        @param ec Set to the error, if any occurred.
+
+        @param sp The memory resource that the
+        returned value and all of its elements
+        will use. If this parameter is omitted,
+        the default memory resource is used.
+    */
+    BOOST_JSON_DECL
+    value
+    materialize(
+        error_code& ec,
+        storage_ptr sp = {}) const;
+
+    /** Build the complete document.
+
+        @copydetails materialize(error_code&,storage_ptr) const
+
+        @throw system_error on failure.
+    */
+    BOOST_JSON_DECL
+    value
+    materialize(
+        storage_ptr sp = {}) const;
+};
+
+/** Create a lazily materialized document from a JSON text.
+
+    This function scans the buffer once to build the
+    structural index used for later navigation, without
+    constructing any values. The options `allow_comments`,
+    `allow_trailing_commas` and `allow_infinity_and_nan`
+    are not supported by lazy documents and are ignored;
+    the text must be strict JSON. Numbers are always
+    parsed with full precision.
+
+    @par Complexity
+
+    Linear in `s.size()`.
+
+    @par Exception Safety
+
+    Strong guarantee.
+
+    @return The lazy document. The returned object
+    references `s` without taking ownership; the
+    caller must keep the buffer alive.
+
+    @param s The JSON text to reference.
+
+    @param ec Set to the error, if any occurred. Only
+    errors detectable without full parsing are
+    reported here, such as a buffer which ends inside
+    a string.
+
+    @param opt The options to use when values are
+    later materialized.
+
+    @see @ref lazy_value, @ref parse.
+*/
+BOOST_JSON_DECL
+lazy_value
+lazy_parse(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt = {});
+
+/** Create a lazily materialized document from a JSON text.
+
+    @copydetails lazy_parse(string_view,error_code&,parse_options const&)
+
+    @throw system_error on failure.
+*/
+BOOST_JSON_DECL
+lazy_value
+lazy_parse(
+    string_view s,
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_LITERALS_HPP
+#define BOOST_JSON_LITERALS_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/value.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** A JSON document parsed once, on first access.
+
+    This class refers to a fixed JSON text, which
+    must outlive it, and owns the @ref value
+    parsed from that text. Construction stores
+    only the reference and cannot fail, so a
+    namespace-scope instance contributes almost
+    nothing to program startup; the text is
+    parsed by the first call to @ref get and the
+    resulting tree is reused by every later call. This suits
+    fixed templates embedded as string literals,
+    which would otherwise each cost a full
+    @ref parse before serving the first request.
+
+    @par Example
+    @code
+    using namespace boost::json::literals;
+
+    static_value const tmpl =
+        R"( {"id":0,"name":""} )"_json_static;
+
+    value make_person( std::int64_t id )
+    {
+        value jv = tmpl.get(); // copies the tree
+        jv.get_object()["id"] = id;
+        return jv;
+    }
+    @endcode
+
+    @par Thread Safety
+    Concurrent first accesses are safe; one
+    thread's parse wins and the others adopt
+    its result.
+
+    @see
+        @ref literals::operator""_json_static,
+        @ref parse.
+*/
+class static_value
+{
+    char const* s_;
+    std::size_t n_;
+    std::atomic<value*> mutable jv_;
+
+public:
+    /** Destructor.
+
+        The parsed tree, if any, is destroyed.
+    */
+    BOOST_JSON_DECL
+    ~static_value();
+
+    /** Constructor.
+
+        The instance refers to the text without
+        copying or inspecting it; parsing is
+        deferred until @ref get is called.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param s A pointer to the JSON text,
+        which must remain valid for the
+        lifetime of the instance.
+
+        @param n The number of characters.
+    */
+    constexpr
+    static_value(
+        char const* s,
+        std::size_t n) noexcept
+        : s_(s)
+        , n_(n)
+        , jv_(nullptr)
+    {
+    }
+
+    /** Copy constructor.
+
+        The copy refers to the same text, with
+        its own deferred parse; the original's
+        cached tree, if any, is not shared.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param other The instance to copy.
+    */
+    constexpr
+    static_value(
+        static_value const& other) noexcept
+        : s_(other.s_)
+        , n_(other.n_)
+        , jv_(nullptr)
+    {
+    }
+
+    /// Copy assignment (deleted)
+    static_value&
+    operator=(
+        static_value const&) = delete;
+
+    /** Return the referenced JSON text.
+    */
+    string_view
+    text() const noexcept
+    {
+        return string_view(s_, n_);
+    }
+
+    /** Return the parsed document.
+
+        The first call parses the referenced
+        text with default options and the
+        default memory resource; later calls
+        return the same tree.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw system_error The text is not
+        a valid JSON document.
+
+        @return The parsed document.
+    */
+    BOOST_JSON_DECL
+    value const&
+    get() const;
+
+    /** Return the parsed document.
+    */
+    value const&
+    operator*() const
+    {
+        return get();
+    }
+};
+
+/** Literal operators for JSON documents.
+
+    This namespace is meant to be imported with
+    a using-directive; the operators are not
+    found otherwise.
+*/
+namespace literals {
+
+/** Return a value parsed from a JSON literal.
+
+    The text is parsed immediately, with default
+    options and the default memory resource.
+    For documents used on hot paths prefer
+    @ref operator""_json_static, which defers
+    the parse past program startup and performs
+    it only once.
+
+    @par Example
+    @code
+    using namespace boost::json::literals;
+
+    value jv = R"( {"a":1} )"_json;
+    @endcode
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @throw system_error The text is not a
+    valid JSON document.
+
+    @return The parsed document.
+*/
+BOOST_JSON_DECL
+value
+operator""_json(
+    char const* s,
+    std::size_t n);
+
+/** Return a deferred JSON document literal.
+
+    The returned @ref static_value refers to the
+    literal without parsing it, so initializing
+    a namespace scope variable this way costs
+    two stores; the parse happens on the first
+    call to @ref static_value::get.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return An unparsed document reference.
+*/
+inline
+static_value
+operator""_json_static(
+    char const* s,
+    std::size_t n) noexcept
+{
+    return static_value(s, n);
+}
+
+} // namespace literals
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -46,6 +46,68 @@ using polymorphic_allocator =
     boost::container::pmr::polymorphic_allocator<T>;
 #endif
 
+/** Return the default memory resource.
+
+    This function returns the memory resource used
+    by library types when a @ref storage_ptr is
+    default constructed: the resource installed by
+    the most recent call to @ref set_default_resource,
+    or a built-in resource calling `operator new` and
+    `operator delete` if none has been installed.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @par Thread Safety
+    May be called concurrently with
+    @ref set_default_resource.
+*/
+BOOST_JSON_DECL
+memory_resource*
+get_default_resource() noexcept;
+
+/** Set the default memory resource.
+
+    This function installs `mr` as the memory
+    resource used by library types when a
+    @ref storage_ptr is default constructed.
+    Passing `nullptr` restores the built-in
+    resource, which calls `operator new` and
+    `operator delete`.
+
+    The caller is responsible for ensuring that
+    `mr` remains valid until it is uninstalled,
+    and that every allocation made through the
+    previous default is deallocated through a
+    resource that can free it.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @par Thread Safety
+    May be called concurrently with
+    @ref get_default_resource. Allocations in
+    flight on other threads may use either
+    resource during the transition.
+
+    @return A pointer to the previously
+    installed default memory resource.
+
+    @param mr The memory resource to install,
+    or `nullptr` to restore the built-in
+    resource.
+*/
+BOOST_JSON_DECL
+memory_resource*
+set_default_resource(
+    memory_resource* mr) noexcept;
+
 /** Return true if a memory resource's deallocate function has no effect.
 
     This metafunction may be specialized to indicate to
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_METRICS_HPP
+#define BOOST_JSON_METRICS_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** Identifies an instrumented library operation.
+
+    Each enumerator names one of the operations
+    whose calls are measured when the library is
+    built with the macro `BOOST_JSON_METRICS`
+    defined.
+
+    @see
+        @ref get_metrics.
+*/
+enum class metrics_op : unsigned char
+{
+    /// A call to @ref parse on a full buffer
+    parse,
+
+    /// A call to @ref stream_parser::write
+    parser_write,
+
+    /// A call to @ref serializer::read
+    serializer_read
+};
+
+/** A histogram of measured values.
+
+    The buckets partition the measured values
+    into half-open power-of-two ranges: bucket
+    zero counts values equal to zero, and
+    bucket `i` counts values `v` satisfying
+    `(v >> (i - 1)) == 1`; that is, values in
+    the range `[2^(i-1), 2^i)`.
+*/
+struct metrics_histogram
+{
+    /// Number of values recorded
+    std::uint64_t count = 0;
+
+    /// Sum of all recorded values
+    std::uint64_t sum = 0;
+
+    /// Count of values per power-of-two range
+    std::uint64_t buckets[64] = {};
+};
+
+/** Measurements accumulated for one operation.
+
+    This is the result type of @ref get_metrics.
+    Both histograms record one value per call,
+    so their counts match.
+*/
+struct metrics_snapshot
+{
+    /// Bytes consumed or produced per call
+    metrics_histogram bytes;
+
+    /// Wall-clock duration per call, in nanoseconds
+    metrics_histogram nanoseconds;
+};
+
+/** Return the measurements accumulated for an operation.
+
+    This function copies the counters recorded
+    for `op` since the program started or since
+    the last call to @ref reset_metrics,
+    whichever is later. The counters are only
+    populated when the library is built with the
+    macro `BOOST_JSON_METRICS` defined; without
+    it the returned snapshot is always empty.
+
+    Counters accumulate across all threads. The
+    copy reads each counter atomically but not
+    the set as a whole, so a snapshot taken
+    while other threads are recording may
+    reflect some of their calls partially; sums
+    and counts still never go backwards between
+    snapshots.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The accumulated measurements.
+
+    @param op The operation to report on.
+
+    @see
+        @ref metrics_op,
+        @ref reset_metrics.
+*/
+BOOST_JSON_DECL
+metrics_snapshot
+get_metrics(metrics_op op) noexcept;
+
+/** Reset the accumulated measurements.
+
+    This function sets every counter for every
+    operation back to zero. Calls measured
+    concurrently on other threads may be
+    recorded before or after the reset.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @see
+        @ref get_metrics.
+*/
+BOOST_JSON_DECL
+void
+reset_metrics() noexcept;
+
+namespace detail {
+
+BOOST_JSON_DECL
+std::uint64_t
+metrics_now() noexcept;
+
+BOOST_JSON_DECL
+void
+metrics_record(
+    metrics_op op,
+    std::uint64_t bytes,
+    std::uint64_t ns) noexcept;
+
+// measures the enclosing scope; commit may be
+// called early when the byte count becomes
+// known before control leaves the scope
+class metrics_timer
+{
+    metrics_op op_;
+    std::uint64_t t0_;
+    std::uint64_t bytes_ = 0;
+
+public:
+    explicit
+    metrics_timer(metrics_op op) noexcept
+        : op_(op)
+        , t0_(metrics_now())
+    {
+    }
+
+    void
+    bytes(std::uint64_t n) noexcept
+    {
+        bytes_ = n;
+    }
+
+    ~metrics_timer()
+    {
+        metrics_record(op_, bytes_,
+            metrics_now() - t0_);
+    }
+};
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+// Measurement sites compile to nothing unless
+// the library is built with BOOST_JSON_METRICS.
+#ifdef BOOST_JSON_METRICS
+# define BOOST_JSON_METRICS_TIMER(var, op) \
+    ::boost::json::detail::metrics_timer var(op)
+# define BOOST_JSON_METRICS_BYTES(var, n) \
+    var.bytes(n)
+#else
+# define BOOST_JSON_METRICS_TIMER(var, op) \
+    do { } while(false)
+# define BOOST_JSON_METRICS_BYTES(var, n) \
+    do { } while(false)
+#endif
+
+#endif
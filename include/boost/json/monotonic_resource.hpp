@@ -99,18 +99,110 @@ monotonic_resource final
     };
 
     block_base buffer_;
+    block_base nodes_ = {
+        nullptr, 0, 0, nullptr};
     block_base* head_ = &buffer_;
+    block_base* node_head_ = &nodes_;
     std::size_t next_size_ = 1024;
+    std::size_t node_next_size_ = 1024;
     storage_ptr upstream_;
+    std::size_t growth_factor_ = 2;
+    std::size_t max_block_size_ = std::size_t(-1);
+    bool segregate_ = false;
+    bool huge_pages_ = false;
+    int numa_node_ = -1;
+    bool numa_interleave_ = false;
 
     static constexpr std::size_t min_size_ = 1024;
+    static constexpr std::size_t max_node_size_ = 64;
     inline static constexpr std::size_t max_size();
     inline static std::size_t round_pow2(
         std::size_t n) noexcept;
     inline static std::size_t next_pow2(
         std::size_t n) noexcept;
+    inline std::size_t grow_size(
+        std::size_t n) const noexcept;
+    inline void* allocate_in(
+        block_base*& head,
+        std::size_t& next_size,
+        std::size_t n,
+        std::size_t align);
 
 public:
+    /** Growth policy for dynamically allocated blocks.
+
+        An instance of this structure may be passed
+        upon construction to customize how the
+        resource obtains blocks from the upstream
+        resource.
+    */
+    struct growth_options
+    {
+        /// The size of the first dynamically allocated block
+        std::size_t initial_size = 1024;
+
+        /** The factor applied to the block size after each allocation.
+
+            A factor of one produces fixed-size
+            blocks. Values less than one are
+            treated as one.
+        */
+        std::size_t growth_factor = 2;
+
+        /** The largest block requested from the upstream resource.
+
+            The progression of block sizes stops
+            growing at this value. Allocations
+            larger than this are still satisfied
+            with a single block of the required
+            size.
+        */
+        std::size_t max_block_size = std::size_t(-1);
+
+        /** Request transparent huge pages for block memory.
+
+            When `true`, the resource advises the
+            kernel to back each dynamically
+            allocated block with huge pages, which
+            reduces TLB pressure when traversing
+            large parsed trees. This is a hint and
+            has an effect only on systems which
+            support `madvise(MADV_HUGEPAGE)`;
+            elsewhere it is ignored. Block sizes of
+            at least 2 MB benefit the most.
+        */
+        bool huge_pages = false;
+
+        /** The NUMA node to place block memory on.
+
+            When non-negative, the resource asks
+            the kernel to place the pages of each
+            dynamically allocated block on this
+            node, so a parsed tree is local to
+            the threads which consume it. This is
+            a hint and has an effect only on
+            Linux; elsewhere, or when the node
+            does not exist, it is ignored. The
+            default of -1 leaves the system
+            policy in place.
+        */
+        int numa_node = -1;
+
+        /** Interleave block memory across NUMA nodes.
+
+            When `true`, the pages of each
+            dynamically allocated block are
+            spread round-robin over the nodes of
+            the machine, which evens out link
+            traffic for documents consumed from
+            every socket at once. Takes
+            precedence over `numa_node`. This is
+            a hint and has an effect only on
+            Linux.
+        */
+        bool numa_interleave = false;
+    };
+
     /// Copy constructor (deleted)
     monotonic_resource(
         monotonic_resource const&) = delete;
@@ -166,6 +258,39 @@ public:
         std::size_t initial_size = 1024,
         storage_ptr upstream = {}) noexcept;
 
+    /** Constructor
+
+        This constructs the resource with the
+        specified growth policy, which controls the
+        size of the first internal dynamic
+        allocation, the factor by which subsequent
+        blocks grow, the largest block requested
+        from the upstream resource, and whether
+        block memory is advised to use huge pages.
+    \n
+        This constructor is guaranteed not to perform
+        any dynamic allocations.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param opt The growth policy to use.
+
+        @param upstream An optional upstream memory resource
+        to use for performing internal dynamic allocations.
+        If this parameter is omitted, the default resource
+        is used.
+
+        @see @ref growth_options
+    */
+    explicit
+    monotonic_resource(
+        growth_options const& opt,
+        storage_ptr upstream = {}) noexcept;
+
     /** Constructor
 
         This constructs the resource and indicates that
@@ -318,6 +443,121 @@ public:
     void
     release() noexcept;
 
+    /** A point in the sequence of allocations.
+
+        Instances of this type are returned by
+        @ref mark and accepted by @ref rollback.
+        They are opaque; a checkpoint may be
+        copied freely and remains valid until
+        the resource rolls back past it, calls
+        @ref release, or is destroyed.
+    */
+    struct checkpoint
+    {
+#ifndef BOOST_JSON_DOCS
+    private:
+        friend monotonic_resource;
+
+        block_base* head;
+        void* p;
+        std::size_t avail;
+        std::size_t next_size;
+        block_base* node_head;
+        void* node_p;
+        std::size_t node_avail;
+        std::size_t node_next_size;
+#endif
+    };
+
+    /** Return a checkpoint marking the current allocation state.
+
+        Memory allocated after the mark can be
+        reclaimed all at once by passing the
+        returned checkpoint to @ref rollback,
+        making speculative work on the arena
+        cheap to abandon. Memory allocated
+        before the mark is unaffected by such a
+        rollback.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref rollback,
+            @ref value_transaction.
+    */
+    checkpoint
+    mark() const noexcept;
+
+    /** Reclaim all memory allocated after a checkpoint.
+
+        The bump pointer is reset to the state
+        captured by `cp` and any blocks obtained
+        from the upstream resource since then
+        are returned to it. All memory allocated
+        after the mark becomes invalid, along
+        with every checkpoint taken after it;
+        memory allocated before the mark is
+        untouched.
+
+        `cp` must have been returned by @ref mark
+        on this resource, and neither @ref release
+        nor a rollback to an earlier checkpoint
+        may have happened since.
+
+        @par Complexity
+        Linear in the number of blocks allocated
+        after the mark.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param cp The checkpoint to return to.
+
+        @see
+            @ref mark,
+            @ref value_transaction.
+    */
+    void
+    rollback(checkpoint const& cp) noexcept;
+
+    /** Set whether small allocations are segregated.
+
+        When enabled, subsequent small allocations
+        are served from slabs dedicated to them,
+        while larger allocations, such as long
+        string payloads, continue to use the
+        regular blocks. Element nodes of parsed
+        containers are then densely packed instead
+        of interleaving with character data, which
+        improves locality when the resulting
+        structure is traversed. The threshold is
+        implementation-defined and covers the
+        allocation sizes of @ref value and
+        @ref key_value_pair.
+
+        Enabling segregation does not move
+        anything already allocated; it only
+        affects subsequent allocations.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param enable `true` to segregate
+        subsequent small allocations.
+    */
+    void
+    segregate(bool enable) noexcept
+    {
+        segregate_ = enable;
+    }
+
 protected:
 #ifndef BOOST_JSON_DOCS
     void*
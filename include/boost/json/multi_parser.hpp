@@ -0,0 +1,450 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_MULTI_PARSER_HPP
+#define BOOST_JSON_MULTI_PARSER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/stream_parser.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+//----------------------------------------------------------
+
+/** A DOM parser for streams of concatenated JSON texts.
+
+    This class parses a stream holding any number of
+    complete JSON texts written back-to-back, with
+    nothing but optional whitespace between them. Each
+    call to @ref write consumes as much of the input
+    as possible, invoking a caller-provided callback
+    with a @ref value for every document completed
+    along the way; a document split across calls is
+    carried over and completed by later input:
+
+    @code
+    multi_parser p;
+    std::vector< value > docs;
+    auto cb = [&docs]( value jv )
+    {
+        docs.push_back( std::move(jv) );
+    };
+    p.write( "[1,2]{\"k\":", cb );  // one document emitted
+    p.write( "true} null", cb );    // two more emitted
+    assert( p.done() );             // no partial document remains
+    @endcode
+
+    This is equivalent to parsing each document with a
+    @ref stream_parser, calling @ref stream_parser::write_some
+    and @ref stream_parser::reset once per document,
+    except that the caller does not need to track how
+    far each buffer was consumed or carry remainders
+    between documents. The parser's temporary storage
+    is retained at its high-water mark across
+    documents, so parsing many documents performs no
+    temporary allocations in the steady state.
+
+    @par Storage
+
+    The @ref memory_resource optionally supplied upon
+    construction is used for temporary storage only.
+    The resource used for the elements of the emitted
+    values is supplied in each call to @ref reset and
+    is shared by every document emitted until the next
+    call to @ref reset.
+
+    @see
+        @ref parse_ndjson,
+        @ref stream_parser.
+*/
+class multi_parser
+{
+    stream_parser p_;
+    storage_ptr sp_;
+    bool pending_ = false;
+
+public:
+    /// Copy constructor (deleted)
+    multi_parser(
+        multi_parser const&) = delete;
+
+    /// Copy assignment (deleted)
+    multi_parser& operator=(
+        multi_parser const&) = delete;
+
+    /** Constructor.
+
+        This constructs a new parser which first
+        allocates temporary storage from the memory
+        resource `sp`, and which accepts only documents
+        conforming to the options `opt`. Call @ref reset
+        to specify the @ref memory_resource used for the
+        elements of emitted values.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sp The @ref memory_resource to use for
+        temporary storage. If this parameter is omitted,
+        the default memory resource is used.
+
+        @param opt The parsing options to use for every
+        document in the stream. If this parameter is
+        omitted, only standard JSON is accepted.
+    */
+    explicit
+    multi_parser(
+        storage_ptr sp,
+        parse_options const& opt = {}) noexcept
+        : p_(std::move(sp), opt)
+    {
+    }
+
+    /** Constructor.
+
+        This constructs a new parser using the default
+        memory resource for temporary storage, which
+        accepts only standard JSON.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    multi_parser() noexcept
+        : multi_parser(storage_ptr())
+    {
+    }
+
+    /** Reset the parser for a new stream.
+
+        Any partially parsed document is destroyed.
+        The parser is then ready to process a new
+        stream of documents, with the elements of
+        every emitted value allocated using the
+        specified memory resource.
+
+        @par Complexity
+        Constant or linear in the size of any partial
+        parsing results.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sp A pointer to the @ref memory_resource
+        to use for the elements of emitted values. The
+        parser will acquire shared ownership.
+    */
+    void
+    reset(storage_ptr sp = {}) noexcept
+    {
+        sp_ = std::move(sp);
+        p_.reset(sp_);
+        pending_ = false;
+    }
+
+    /** Return true if no partial document remains.
+
+        This function returns `true` when every
+        character written so far belongs to an already
+        emitted document or to the whitespace between
+        documents. A stream may be ended at any point
+        where this is the case.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    bool
+    done() const noexcept
+    {
+        return ! pending_;
+    }
+
+    /** Return excess temporary storage to the memory resource.
+
+        The temporary storage used by the
+        implementation is retained at its high-water
+        mark across documents. This function releases
+        that storage, returning the parser to its
+        construction-time state. Any partially parsed
+        document is destroyed.
+
+        @par Complexity
+        Constant or linear in the size of any partial
+        parsing results.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    void
+    shrink_to_fit() noexcept
+    {
+        p_.shrink_to_fit();
+        p_.reset(sp_);
+        pending_ = false;
+    }
+
+    /** Parse a buffer containing zero or more JSON texts.
+
+        This function parses the characters of the
+        buffer as a stream of complete JSON texts
+        separated by optional whitespace. The callback
+        `cb` is invoked once for each document
+        completed, receiving the corresponding
+        @ref value by rvalue; the parser is recycled
+        between invocations, so the callback may
+        itself write more input. A trailing document
+        for which more characters are required is
+        retained, and completed by subsequent calls.
+
+        Upon error, the return value indicates the
+        offset of the offending byte within `data`,
+        documents already emitted remain emitted, and
+        subsequent calls will fail until @ref reset is
+        called to parse a new stream.
+
+        @par Complexity
+        Linear in `size`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Exceptions thrown by the callback are allowed
+        to escape.
+
+        @return The number of characters consumed from
+        the buffer; this is less than `size` only when
+        an error occurs.
+
+        @param data A pointer to a buffer of `size`
+        characters to parse.
+
+        @param size The number of characters pointed to
+        by `data`.
+
+        @param cb A callable object invoked as
+        `cb( value )` for each completed document.
+
+        @param ec Set to the error, if any occurred.
+    */
+    template<class Callback>
+    std::size_t
+    write(
+        char const* data,
+        std::size_t size,
+        Callback&& cb,
+        error_code& ec)
+    {
+        ec = {};
+        std::size_t n = 0;
+        for(;;)
+        {
+            if(! pending_)
+            {
+                // consume the whitespace between
+                // documents here, so that a stream
+                // which stops on a document boundary
+                // leaves the parser in the done state
+                while(n < size && (
+                    data[n] == ' ' ||
+                    data[n] == '\n' ||
+                    data[n] == '\r' ||
+                    data[n] == '\t'))
+                    ++n;
+                if(n == size)
+                    return n;
+                pending_ = true;
+            }
+            n += p_.write_some(
+                data + n, size - n, ec);
+            if(ec.failed())
+                return n;
+            if(! p_.done())
+                return n;
+            value jv = p_.release();
+            p_.reset(sp_);
+            pending_ = false;
+            cb(std::move(jv));
+        }
+    }
+
+    /** Parse a buffer containing zero or more JSON texts.
+
+        This overload behaves identically to the
+        overload taking an error code, except that
+        a `boost::system::system_error` is thrown on
+        failure instead.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param data A pointer to a buffer of `size`
+        characters to parse.
+
+        @param size The number of characters pointed to
+        by `data`.
+
+        @param cb A callable object invoked as
+        `cb( value )` for each completed document.
+
+        @throw system_error Thrown on failure.
+    */
+    template<class Callback>
+    std::size_t
+    write(
+        char const* data,
+        std::size_t size,
+        Callback&& cb)
+    {
+        error_code ec;
+        auto const n = write(data, size,
+            static_cast<Callback&&>(cb), ec);
+        if(ec)
+            detail::throw_system_error( ec );
+        return n;
+    }
+
+    /** Parse a buffer containing zero or more JSON texts.
+
+        This overload behaves identically to the
+        overload taking a pointer and size, with the
+        buffer specified as a @ref string_view.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param s The character string to parse.
+
+        @param cb A callable object invoked as
+        `cb( value )` for each completed document.
+
+        @param ec Set to the error, if any occurred.
+    */
+    template<class Callback>
+    std::size_t
+    write(
+        string_view s,
+        Callback&& cb,
+        error_code& ec)
+    {
+        return write(s.data(), s.size(),
+            static_cast<Callback&&>(cb), ec);
+    }
+
+    /** Parse a buffer containing zero or more JSON texts.
+
+        This overload behaves identically to the
+        overload taking a pointer and size, with the
+        buffer specified as a @ref string_view. A
+        `boost::system::system_error` is thrown on
+        failure.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param s The character string to parse.
+
+        @param cb A callable object invoked as
+        `cb( value )` for each completed document.
+
+        @throw system_error Thrown on failure.
+    */
+    template<class Callback>
+    std::size_t
+    write(
+        string_view s,
+        Callback&& cb)
+    {
+        return write(s.data(), s.size(),
+            static_cast<Callback&&>(cb));
+    }
+
+    /** Indicate the end of the stream.
+
+        This function must be called when there are no
+        more character buffers. If a document for which
+        no more characters are needed is pending, it is
+        completed and emitted through the callback;
+        otherwise, if any partially parsed document
+        remains, the error is set to
+        @ref error::incomplete.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Exceptions thrown by the callback are allowed
+        to escape.
+
+        @param cb A callable object invoked as
+        `cb( value )` for a completed document.
+
+        @param ec Set to the error, if any occurred.
+    */
+    template<class Callback>
+    void
+    finish(
+        Callback&& cb,
+        error_code& ec)
+    {
+        ec = {};
+        if(! pending_)
+            return;
+        p_.finish(ec);
+        if(ec.failed())
+            return;
+        value jv = p_.release();
+        p_.reset(sp_);
+        pending_ = false;
+        cb(std::move(jv));
+    }
+
+    /** Indicate the end of the stream.
+
+        This overload behaves identically to the
+        overload taking an error code, except that
+        a `boost::system::system_error` is thrown on
+        failure instead.
+
+        @param cb A callable object invoked as
+        `cb( value )` for a completed document.
+
+        @throw system_error Thrown on failure.
+    */
+    template<class Callback>
+    void
+    finish(Callback&& cb)
+    {
+        error_code ec;
+        finish(static_cast<Callback&&>(cb), ec);
+        if(ec)
+            detail::throw_system_error( ec );
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_NDJSON_HPP
+#define BOOST_JSON_NDJSON_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** Return a batch of parsed newline-delimited JSON.
+
+    This function parses a buffer holding
+    newline-delimited JSON ("NDJSON", or "JSON
+    lines") and returns one @ref value per record.
+    Records are separated by line feeds; a carriage
+    return before the line feed is ignored, as are
+    lines containing only whitespace and a missing
+    final line terminator.
+
+    Each record must be a complete JSON text. When
+    any record fails to parse, `ec` is set to the
+    first error in record order and an empty vector
+    is returned.
+
+    The returned values are allocated from
+    @ref monotonic_resource instances created by the
+    function and shared by the returned values; the
+    resources are freed when the last value using
+    them is destroyed.
+
+    When `threads` is greater than one, records are
+    partitioned into contiguous chunks which are
+    parsed concurrently on that many threads of
+    execution, each chunk using its own memory
+    resource. The result is identical to a
+    sequential parse.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A vector with one value per record, or
+    an empty vector if any error occurred.
+
+    @param s The buffer to parse.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @param threads The maximum number of threads to
+    use. If this parameter is omitted, records are
+    parsed on the calling thread only.
+
+    @see
+        @ref parse,
+        @ref parse_options.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt = {},
+    unsigned threads = 1);
+
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    std::error_code& ec,
+    parse_options const& opt = {},
+    unsigned threads = 1);
+/** @} */
+
+/** Return a batch of parsed newline-delimited JSON.
+
+    This overload behaves identically to the
+    overloads taking an error code, except that a
+    `boost::system::system_error` is thrown on
+    failure instead.
+
+    @return A vector with one value per record.
+
+    @param s The buffer to parse.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @param threads The maximum number of threads to
+    use. If this parameter is omitted, records are
+    parsed on the calling thread only.
+
+    @throw system_error Thrown on failure.
+*/
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    parse_options const& opt = {},
+    unsigned threads = 1);
+
+/** Return a batch of parsed newline-delimited JSON.
+
+    These overloads behave identically to the
+    overloads taking a thread count, except that
+    chunk parses are submitted to `ex` instead of
+    transient threads of execution, with the chunk
+    count chosen from `ex.concurrency()`. Use this
+    with a shared @ref thread_pool to keep repeated
+    batch parses from oversubscribing the machine.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A vector with one value per record, or
+    an empty vector if any error occurred.
+
+    @param s The buffer to parse.
+
+    @param ex The executor to run chunk
+    parses on.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @see
+        @ref executor,
+        @ref thread_pool.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    error_code& ec,
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    std::error_code& ec,
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+std::vector<value>
+parse_ndjson(
+    string_view s,
+    executor& ex,
+    parse_options const& opt = {});
+/** @} */
+
+} // namespace json
+} // namespace boost
+
+#endif
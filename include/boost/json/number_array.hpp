@@ -0,0 +1,380 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_NUMBER_ARRAY_HPP
+#define BOOST_JSON_NUMBER_ARRAY_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/conversion.hpp>
+#include <boost/json/kind.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** A JSON array with a packed representation for numbers.
+
+    Arrays of homogeneous numbers, such as
+    coordinate or telemetry vectors, waste
+    most of their memory when every element
+    is stored as a discriminated @ref value.
+    A number array stores a homogeneous run
+    of `std::int64_t` or `double` elements as
+    a packed column of eight byte slots,
+    using half the memory and keeping the
+    numbers contiguous for vectorized scans.
+
+    The representation adapts to the inserted
+    elements:
+
+    @li While every element is an integer,
+    they are stored as a packed `std::int64_t`
+    column, observable through @ref if_int64.
+
+    @li Inserting a `double` converts the
+    column in place to packed `double`
+    elements, observable through
+    @ref if_double. Later integer insertions
+    are stored as their `double` equivalent.
+
+    @li Inserting anything else abandons the
+    packed form: the elements are moved into
+    an ordinary @ref array, observable
+    through @ref if_array, and the container
+    behaves as a thin wrapper from then on.
+
+    Use @ref to_array to materialize the
+    elements as a regular @ref array
+    regardless of the current representation.
+
+    @par Thread Safety
+    Distinct instances may be used
+    concurrently.
+*/
+class number_array
+{
+    storage_ptr sp_;
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+    json::kind kind_ = json::kind::int64;
+    array arr_;
+
+public:
+    /** Destructor.
+
+        The packed column, if any, is
+        deallocated.
+    */
+    BOOST_JSON_DECL
+    ~number_array();
+
+    /** Constructor.
+
+        The container starts empty, in the
+        packed integer representation.
+
+        @param sp A pointer to the @ref
+        memory_resource to use. The container
+        will acquire shared ownership of the
+        memory resource.
+    */
+    BOOST_JSON_DECL
+    explicit
+    number_array(storage_ptr sp = {});
+
+    /** Constructor.
+
+        The elements of `a` are copied. When
+        every element is an integer the
+        container uses the packed
+        `std::int64_t` representation; when
+        every element is a number it uses the
+        packed `double` representation;
+        otherwise the elements are stored
+        generically.
+
+        @param a The array to copy from.
+
+        @param sp A pointer to the @ref
+        memory_resource to use. The container
+        will acquire shared ownership of the
+        memory resource.
+    */
+    BOOST_JSON_DECL
+    explicit
+    number_array(
+        array const& a,
+        storage_ptr sp = {});
+
+    /** Move constructor.
+
+        The container acquires the contents
+        of `other`, which is left empty with
+        its original memory resource.
+
+        @param other The container to move from.
+    */
+    BOOST_JSON_DECL
+    number_array(number_array&& other) noexcept;
+
+    /// Copy construction is not supported.
+    number_array(number_array const&) = delete;
+
+    /// Copy assignment is not supported.
+    number_array& operator=(
+        number_array const&) = delete;
+
+    /** Return a pointer to the memory resource.
+    */
+    storage_ptr const&
+    storage() const noexcept
+    {
+        return sp_;
+    }
+
+    /** Return the kind of the current representation.
+
+        The result is @ref kind::int64 or
+        @ref kind::double_ while the elements
+        are packed, and @ref kind::array
+        after a heterogeneous insertion.
+    */
+    json::kind
+    kind() const noexcept
+    {
+        return kind_;
+    }
+
+    /** Return the number of elements.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    size() const noexcept;
+
+    /** Return `true` if there are no elements.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return the packed integer column, or null.
+
+        The pointer remains valid until the
+        next insertion. The column holds
+        @ref size elements.
+    */
+    std::int64_t const*
+    if_int64() const noexcept
+    {
+        if(kind_ != json::kind::int64)
+            return nullptr;
+        return reinterpret_cast<
+            std::int64_t const*>(data_);
+    }
+
+    /** Return the packed double column, or null.
+
+        The pointer remains valid until the
+        next insertion. The column holds
+        @ref size elements.
+    */
+    double const*
+    if_double() const noexcept
+    {
+        if(kind_ != json::kind::double_)
+            return nullptr;
+        return reinterpret_cast<
+            double const*>(data_);
+    }
+
+    /** Return the generic representation, or null.
+
+        The pointer is null while the
+        elements are packed.
+    */
+    array const*
+    if_array() const noexcept
+    {
+        if(kind_ != json::kind::array)
+            return nullptr;
+        return &arr_;
+    }
+
+    /** Reserve space for at least `n` elements.
+
+        This only affects the packed
+        representations.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param n The minimum capacity.
+    */
+    BOOST_JSON_DECL
+    void
+    reserve(std::size_t n);
+
+    /** Append an integer.
+
+        While the representation is packed
+        `double`, the element is stored as
+        its `double` equivalent.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param v The number to append.
+    */
+    BOOST_JSON_DECL
+    void
+    push_back(std::int64_t v);
+
+    /** Append a double.
+
+        While the representation is packed
+        `std::int64_t`, the existing elements
+        are first converted in place to their
+        `double` equivalents.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param v The number to append.
+    */
+    BOOST_JSON_DECL
+    void
+    push_back(double v);
+
+    /** Append a value.
+
+        Numbers are appended as if by the
+        arithmetic overloads. Any other kind
+        of value causes the packed elements
+        to be moved into the generic
+        representation first.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param jv The value to append.
+    */
+    BOOST_JSON_DECL
+    void
+    push_back(value const& jv);
+
+    /** Return the elements as an ordinary array.
+
+        The returned array uses the same
+        memory resource as the container.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+    */
+    BOOST_JSON_DECL
+    array
+    to_array() const;
+
+private:
+    void
+    grow(std::size_t n);
+
+    void
+    to_doubles();
+
+    void
+    to_generic();
+
+    void
+    destroy() noexcept;
+};
+
+/** Convert a number array to a @ref value.
+
+    This overload is found by @ref value_from
+    and produces an equivalent @ref array,
+    using the storage of `jv`.
+
+    @param jv The value to assign to.
+
+    @param na The container to convert.
+*/
+inline
+void
+tag_invoke(
+    value_from_tag,
+    value& jv,
+    number_array const& na)
+{
+    array& a = jv.emplace_array();
+    if(array const* p = na.if_array())
+    {
+        a = *p;
+        return;
+    }
+    a.reserve(na.size());
+    if(std::int64_t const* p = na.if_int64())
+    {
+        for(std::size_t i = 0;
+                i < na.size(); ++i)
+            a.emplace_back(p[i]);
+    }
+    else if(double const* p = na.if_double())
+    {
+        for(std::size_t i = 0;
+                i < na.size(); ++i)
+            a.emplace_back(p[i]);
+    }
+}
+
+/** Convert a @ref value to a number array.
+
+    This overload is found by @ref value_to.
+    A homogeneous numeric array converts to a
+    single packed column, observable through
+    @ref number_array::if_int64 or
+    @ref number_array::if_double, without an
+    allocation per element.
+
+    @return The converted container.
+
+    @param jv The value to convert; it must
+    be an array.
+
+    @throw system_error `jv` is not an array.
+*/
+inline
+number_array
+tag_invoke(
+    value_to_tag<number_array>,
+    value const& jv)
+{
+    return number_array(jv.as_array());
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
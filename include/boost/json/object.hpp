@@ -22,6 +22,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace boost {
 namespace json {
@@ -71,6 +72,7 @@ class object
     class revert_insert;
     friend class value;
     friend class object_test;
+    friend struct detail::access;
     using access = detail::access;
     using index_t = std::uint32_t;
     static index_t constexpr null_index_ =
@@ -902,6 +904,296 @@ public:
     void
     reserve(std::size_t new_capacity);
 
+    /** Return the number of hash buckets.
+
+        Objects small enough to use a linear
+        search instead of the hash table
+        return zero. Otherwise the result is
+        the number of bucket chains in the
+        probe index, which equals
+        @ref capacity().
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref load_factor,
+            @ref max_probe_length.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    bucket_count() const noexcept;
+
+    /** Return the longest probe sequence.
+
+        This is the number of elements in the
+        longest bucket chain: the worst number
+        of candidate comparisons a lookup can
+        make before failing. A result much
+        larger than @ref load_factor suggests
+        a key set that clusters under the hash
+        function. Objects small enough to use
+        a linear search return @ref size(),
+        which is their worst probe.
+
+        @par Complexity
+        Linear in @ref capacity().
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref bucket_count,
+            @ref probe_distribution.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    max_probe_length() const noexcept;
+
+    /** Return the average number of elements per bucket.
+
+        The result is @ref size() divided by
+        @ref bucket_count(), or zero for
+        objects small enough to use a linear
+        search. @ref optimize rebuilds the
+        index with a load factor of at most
+        one half.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref bucket_count,
+            @ref optimize.
+    */
+    BOOST_JSON_DECL
+    double
+    load_factor() const noexcept;
+
+    /** Return the distribution of probe lengths.
+
+        The returned vector holds, at position
+        `n`, the number of buckets whose chain
+        contains exactly `n` elements; position
+        zero counts the empty buckets. The sum
+        of `n` weighted by the counts equals
+        @ref size(). This is a diagnostic aid:
+        a healthy distribution concentrates
+        near zero, while adversarial keys that
+        cluster under the hash function show a
+        long tail. Objects small enough to use
+        a linear search return an empty vector.
+
+        @par Complexity
+        Linear in @ref capacity().
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @see
+            @ref bucket_count,
+            @ref max_probe_length.
+    */
+    BOOST_JSON_DECL
+    std::vector<std::size_t>
+    probe_distribution() const;
+
+    /** Rebuild the index for read-heavy workloads.
+
+        This function rebuilds the probe table at a
+        load factor of at most one half, and rebuilds
+        every bucket chain so that elements are probed
+        in insertion order. Iteration order and the
+        results of lookups are unchanged. Containers
+        which are built once and read many times can
+        call this after the last insertion; lookups
+        then perform fewer key comparisons per probe,
+        and keys inserted earliest are found fastest.
+        Subsequent insertions and erasures remain
+        valid but may disturb the optimized layout.
+
+        Objects small enough to use a linear search
+        instead of the hash table are unaffected.
+    \n
+        All iterators including any past-the-end
+        iterators, and all references to the elements
+        may be invalidated.
+
+        @par Complexity
+        Linear in @ref size().
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+    */
+    BOOST_JSON_DECL
+    void
+    optimize();
+
+    /** Build a minimal perfect hash over the current keys.
+
+        This function constructs a perfect hash
+        function for the object's key set and
+        attaches it to the index. While it is in
+        effect, @ref find and the other lookup
+        functions probe exactly one element, with
+        no collision handling: the hash of the
+        sought key names the only element which
+        can match, and one comparison decides the
+        lookup. This suits objects which are
+        built once and then queried many times,
+        such as reference data; construction
+        costs several passes over the keys, to
+        be repaid over subsequent lookups.
+
+        The bucket chains remain valid alongside
+        the perfect hash. Any operation which
+        inserts, erases, relocates, or reorders
+        elements discards it and reverts to the
+        normal index; it is never transferred by
+        copies, and a subsequent call to this
+        function may rebuild it. Lookups
+        themselves, and assignment through
+        existing iterators or @ref operator[],
+        do not disturb it.
+
+        Objects small enough to use a linear
+        search instead of the hash table are
+        unaffected, and the function returns
+        `false` for them.
+
+        Construction chooses per-bucket
+        displacements by trial; for a key set
+        whose digests defeat the search, the
+        keys are re-hashed under a new seed and
+        the search is retried a bounded number
+        of times before giving up.
+
+        @par Complexity
+        Expected linear in @ref size().
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @return `true` if lookups now use a
+        perfect hash.
+
+        @see
+            @ref frozen,
+            @ref optimize.
+    */
+    BOOST_JSON_DECL
+    bool
+    freeze_phf();
+
+    /** Return true if lookups use a perfect hash.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref freeze_phf.
+    */
+    BOOST_JSON_DECL
+    bool
+    frozen() const noexcept;
+
+    /** Set whether growth rebuilds the index incrementally.
+
+        By default, an insertion which grows past
+        @ref capacity rebuilds the entire bucket
+        index in one step, pausing that call for
+        time linear in @ref size(). When incremental
+        rehashing is enabled, growth instead keeps
+        the old index alive and every subsequent
+        insertion relinks a few of its buckets into
+        the new one, bounding the extra work any
+        single insertion performs. Lookups probe
+        both indexes until the migration completes.
+        Operations which relocate elements, such as
+        @ref erase and @ref optimize, complete any
+        pending migration in one step first.
+
+        The trade is a small loss of lookup and
+        insertion throughput while a migration is
+        pending, in exchange for a much lower
+        worst-case insertion latency. The setting
+        is intended for large, long-lived objects
+        mutated in place; it applies to this object
+        only and is not propagated by copies.
+
+        Objects small enough to use a linear search
+        instead of the hash table always rebuild in
+        one step, which is trivially cheap.
+
+        @par Complexity
+        Constant to enable; linear in the number of
+        unmigrated buckets to disable.
+
+        @par Exception Safety
+        Strong guarantee.
+        Enabling on an empty object allocates its
+        table; calls to `memory_resource::allocate`
+        may throw.
+
+        @param enable `true` to defer index rebuilds
+        across subsequent insertions.
+
+        @see
+            @ref rehash_pending,
+            @ref optimize.
+    */
+    BOOST_JSON_DECL
+    void
+    incremental_rehash(bool enable);
+
+    /** Return true if incremental rehashing is enabled.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref rehash_pending.
+    */
+    BOOST_JSON_DECL
+    bool
+    incremental_rehash() const noexcept;
+
+    /** Return true if an index migration is outstanding.
+
+        A pending migration means a growth deferred
+        its index rebuild and not every bucket has
+        been relinked yet; lookups probe both the
+        old and the new index until this returns
+        `false`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see
+            @ref incremental_rehash.
+    */
+    BOOST_JSON_DECL
+    bool
+    rehash_pending() const noexcept;
+
     //------------------------------------------------------
     //
     // Modifiers
@@ -1048,6 +1340,37 @@ public:
     insert(std::initializer_list<
         std::pair<string_view, value_ref>> init);
 
+    /** Merge elements from another object.
+
+        Elements of `source` whose keys are not already
+        present in this container are transferred into
+        this container; elements with colliding keys
+        remain in `source`. The table is sized once up
+        front, so at most one rehash occurs regardless
+        of the number of elements transferred. When both
+        containers use the same memory resource the
+        elements are moved without copying keys or
+        values; otherwise equivalent elements are
+        constructed in this container's resource and
+        the originals are removed from `source`.
+
+        All iterators and references into both
+        containers are invalidated.
+
+        @par Complexity
+        Linear in `this->size() + source.size()`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param source The object to transfer
+        elements from.
+    */
+    BOOST_JSON_DECL
+    void
+    merge(object&& source);
+
     /** Insert an element or assign to the current element if the key already exists.
 
         If the key equivalent to `key` already exists in the
@@ -1218,6 +1541,113 @@ public:
     std::size_t
     stable_erase(string_view key) noexcept;
 
+    /** Erase all elements matching a predicate.
+
+        Remove every element for which `pred`
+        returns `true`. The surviving elements
+        are compacted in one pass and the index
+        is rebuilt once afterwards, so removing
+        many elements costs the same as one
+        traversal; erasing the same elements
+        one by one would probe and relocate for
+        each. The relative order of the
+        remaining elements is preserved. All
+        references and iterators are
+        invalidated.
+
+        @par Complexity
+        Linear in @ref size().
+
+        @par Exception Safety
+        Basic guarantee.
+        If the predicate throws, the elements
+        for which it already returned `true`
+        have been removed and the object
+        remains valid.
+
+        @return The number of elements removed.
+
+        @param pred A callable invocable with
+        `key_value_pair&` and returning `bool`.
+    */
+    template<class Pred>
+    std::size_t
+    erase_if(Pred&& pred);
+
+    /** Reorder elements for access locality.
+
+        Moves the elements whose keys appear in
+        `keys` to the front of the object's
+        storage, in the order given, and rebuilds
+        the index accordingly. The relative order
+        of the remaining elements is preserved.
+        Keys which match no element are ignored.
+        All references and iterators are
+        invalidated.
+
+        Elements of an object occupy one
+        contiguous allocation in storage order,
+        so placing the most frequently accessed
+        members first packs them into the fewest
+        cache lines. For a long-lived object
+        looked up far more often than it is
+        modified, such as cached configuration,
+        reordering by observed access frequency
+        shrinks the working set of each lookup
+        and iteration touches the hot members
+        before the cold ones.
+
+        @par Complexity
+        Linear in `count * size()`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param keys A pointer to the first of a
+        sequence of keys, most frequently
+        accessed first. The sequence may name
+        any subset of the object's keys.
+
+        @param count The number of keys.
+    */
+    BOOST_JSON_DECL
+    void
+    reorder(
+        string_view const* keys,
+        std::size_t count) noexcept;
+
+    /** Remove an element and return it.
+
+        Remove the element which matches `key` and
+        return its mapped value. The value is
+        transferred by pilfering; no deep copy is
+        made regardless of the size of the subtree,
+        and the result shares ownership of the
+        memory resource. References and iterators
+        to the erased element are invalidated.
+        Other iterators and references are not
+        invalidated. The relative order of the
+        remaining elements is not preserved.
+
+        @par Complexity
+        Constant on average, worst case linear
+        in @ref size().
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw system_error if no element
+        matches `key`.
+
+        @param key The key to match.
+
+        @return The mapped value of the
+        removed element.
+    */
+    BOOST_JSON_DECL
+    value
+    extract(string_view key);
+
     /** Swap two objects.
 
         Exchanges the contents of this object with another
@@ -1327,6 +1757,45 @@ public:
     at(string_view key) const&;
     /* @} */
 
+    /** Access the specified element, without checking.
+
+        Returns a reference to the mapped value of
+        the element that matches `key`. This is the
+        fastest way to access a member which is
+        known in advance to exist: unlike @ref at
+        there is no failure branch, so validated
+        hot paths compile down to the lookup alone.
+
+        @par Preconditions
+
+        @code
+        this->contains( key )
+        @endcode
+
+        @par Complexity
+        Constant on average, worst case linear in @ref size().
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @return A reference to the mapped value.
+
+        @param key The key of the element to find.
+    */
+    /* @{ */
+    inline
+    value&
+    get(string_view key) & noexcept;
+
+    inline
+    value&&
+    get(string_view key) && noexcept;
+
+    inline
+    value const&
+    get(string_view key) const& noexcept;
+    /* @} */
+
     /** Access or insert the specified element
 
         Returns a reference to the value that is mapped
@@ -1350,9 +1819,62 @@ public:
 
         @param key The key of the element to find.
     */
+    /* @{ */
     BOOST_JSON_DECL
     value&
-    operator[](string_view key);
+    operator[](string_view key) &;
+
+    inline
+    value&&
+    operator[](string_view key) &&;
+    /* @} */
+
+    /** Insert or assign an element at a key path.
+
+        The keys in `path` are followed from this
+        object in one walk: every key but the last
+        locates or inserts an element holding an
+        empty @ref object, and the last key is
+        inserted or assigned a @ref value
+        constructed from
+        `std::forward<Arg>(arg)`. All elements
+        created by the walk use the container's
+        memory resource. This is equivalent to a
+        chain of @ref operator[] calls followed by
+        an assignment, without materializing an
+        intermediate null at each level.
+
+        If an insertion occurs and results in a
+        rehashing of a container, all iterators
+        into it are invalidated. References are not
+        invalidated.
+
+        @par Complexity
+        Amortized constant on average in the length
+        of `path`, worst case linear in the sizes
+        of the traversed containers.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return A reference to the mapped value.
+
+        @param path A non-empty list of keys to
+        follow.
+
+        @param arg The argument used to construct
+        the value.
+
+        @throw system_error if a key other than the
+        last refers to an existing element that is
+        not an object, or if a key is too long.
+    */
+    template<class Arg>
+    value&
+    emplace_at(
+        std::initializer_list<string_view> path,
+        Arg&& arg);
 
     /** Count the number of elements with a specific key
 
@@ -1606,6 +2128,22 @@ private:
     table*
     reserve_impl(std::size_t new_capacity);
 
+    BOOST_JSON_DECL
+    void
+    migrate_some(std::size_t buckets) noexcept;
+
+    BOOST_JSON_DECL
+    void
+    finish_rehash() noexcept;
+
+    BOOST_NORETURN
+    BOOST_JSON_DECL
+    void
+    fail_duplicate(
+        key_value_pair* dest,
+        value* src,
+        value* end);
+
     BOOST_JSON_DECL
     bool
     equal(object const& other) const noexcept;
@@ -1639,6 +2177,26 @@ private:
         FB big_reloc) noexcept
         -> iterator;
 
+    BOOST_JSON_DECL
+    std::size_t
+    do_erase_if(
+        bool (*pred)(
+            void*, key_value_pair&),
+        void* arg);
+
+    inline
+    void
+    thaw() noexcept;
+
+    inline
+    void
+    rehash_with_salt(
+        std::uintptr_t salt) noexcept;
+
+    inline
+    bool
+    build_phf(std::size_t keys_per_bucket);
+
     inline
     void
     reindex_relocate(
@@ -0,0 +1,520 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PACKED_VALUE_HPP
+#define BOOST_JSON_PACKED_VALUE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/kind.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace json {
+
+class packed_document;
+
+/** A read-only cursor into a packed document.
+
+    This lightweight type refers to one value
+    inside a @ref packed_document. It holds a
+    pointer to the document's buffer and a
+    32-bit offset; copying a cursor never
+    copies any part of the document. Accessors
+    decode the fixed sixteen byte node record
+    at the offset.
+
+    The cursor does not keep the document
+    alive. The @ref packed_document it was
+    obtained from must outlive every cursor
+    and string view derived from it.
+
+    @see
+        @ref packed_document.
+*/
+class packed_value
+{
+    unsigned char const* base_ = nullptr;
+    std::uint32_t off_ = 0;
+
+    friend class packed_document;
+
+    packed_value(
+        unsigned char const* base,
+        std::uint32_t off) noexcept
+        : base_(base)
+        , off_(off)
+    {
+    }
+
+    std::uint32_t
+    load32(
+        std::uint32_t off) const noexcept
+    {
+        std::uint32_t v;
+        std::memcpy(&v, base_ + off,
+            sizeof(v));
+        return v;
+    }
+
+    std::uint64_t
+    load64(
+        std::uint32_t off) const noexcept
+    {
+        std::uint64_t v;
+        std::memcpy(&v, base_ + off,
+            sizeof(v));
+        return v;
+    }
+
+public:
+    /** Default constructor.
+
+        The cursor refers to no document and
+        behaves as a null value.
+    */
+    packed_value() = default;
+
+    /** Return the kind of the referenced value.
+    */
+    json::kind
+    kind() const noexcept
+    {
+        if(! base_)
+            return json::kind::null;
+        return static_cast<json::kind>(
+            load32(off_));
+    }
+
+    /// Return true if this is a null
+    bool
+    is_null() const noexcept
+    {
+        return kind() == json::kind::null;
+    }
+
+    /// Return true if this is a bool
+    bool
+    is_bool() const noexcept
+    {
+        return kind() == json::kind::bool_;
+    }
+
+    /// Return true if this is a signed integer
+    bool
+    is_int64() const noexcept
+    {
+        return kind() == json::kind::int64;
+    }
+
+    /// Return true if this is an unsigned integer
+    bool
+    is_uint64() const noexcept
+    {
+        return kind() == json::kind::uint64;
+    }
+
+    /// Return true if this is a double
+    bool
+    is_double() const noexcept
+    {
+        return kind() == json::kind::double_;
+    }
+
+    /// Return true if this is a string
+    bool
+    is_string() const noexcept
+    {
+        return kind() == json::kind::string;
+    }
+
+    /// Return true if this is an array
+    bool
+    is_array() const noexcept
+    {
+        return kind() == json::kind::array;
+    }
+
+    /// Return true if this is an object
+    bool
+    is_object() const noexcept
+    {
+        return kind() == json::kind::object;
+    }
+
+    /** Return the underlying `bool`.
+
+        @par Preconditions
+        @code
+        this->is_bool()
+        @endcode
+    */
+    bool
+    get_bool() const noexcept
+    {
+        BOOST_ASSERT(is_bool());
+        return load32(off_ + 4) != 0;
+    }
+
+    /** Return the underlying `std::int64_t`.
+
+        @par Preconditions
+        @code
+        this->is_int64()
+        @endcode
+    */
+    std::int64_t
+    get_int64() const noexcept
+    {
+        BOOST_ASSERT(is_int64());
+        return static_cast<std::int64_t>(
+            load64(off_ + 8));
+    }
+
+    /** Return the underlying `std::uint64_t`.
+
+        @par Preconditions
+        @code
+        this->is_uint64()
+        @endcode
+    */
+    std::uint64_t
+    get_uint64() const noexcept
+    {
+        BOOST_ASSERT(is_uint64());
+        return load64(off_ + 8);
+    }
+
+    /** Return the underlying `double`.
+
+        @par Preconditions
+        @code
+        this->is_double()
+        @endcode
+    */
+    double
+    get_double() const noexcept
+    {
+        BOOST_ASSERT(is_double());
+        double d;
+        std::uint64_t const v =
+            load64(off_ + 8);
+        std::memcpy(&d, &v, sizeof(d));
+        return d;
+    }
+
+    /** Return the underlying string.
+
+        The view refers to character storage
+        inside the document's buffer and is
+        valid for the document's lifetime.
+
+        @par Preconditions
+        @code
+        this->is_string()
+        @endcode
+    */
+    string_view
+    get_string() const noexcept
+    {
+        BOOST_ASSERT(is_string());
+        return string_view(
+            reinterpret_cast<char const*>(
+                base_) + load32(off_ + 8),
+            load32(off_ + 4));
+    }
+
+    /** Return the number of elements.
+
+        @par Preconditions
+        @code
+        this->is_array() || this->is_object()
+        @endcode
+    */
+    std::size_t
+    size() const noexcept
+    {
+        BOOST_ASSERT(
+            is_array() || is_object());
+        return load32(off_ + 4);
+    }
+
+    /** Return the element at index `i`.
+
+        For arrays this is the i-th element;
+        for objects it is the mapped value of
+        the i-th member in insertion order.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param i The zero-based index.
+
+        @throw system_error `i >= size()`, or
+        the value is not an array or object.
+    */
+    BOOST_JSON_DECL
+    packed_value
+    at(std::size_t i) const;
+
+    /** Return the key of the i-th object member.
+
+        The view refers to character storage
+        inside the document's buffer and is
+        valid for the document's lifetime.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param i The zero-based index.
+
+        @throw system_error `i >= size()`, or
+        the value is not an object.
+    */
+    BOOST_JSON_DECL
+    string_view
+    key_at(std::size_t i) const;
+
+    /** Return the mapped value for `key`.
+
+        If more than one member matches, the
+        first in insertion order is returned.
+
+        @par Complexity
+        Linear in `size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param key The key to search for.
+
+        @throw system_error The key is not
+        found, or the value is not an object.
+    */
+    BOOST_JSON_DECL
+    packed_value
+    at(string_view key) const;
+
+    /** Return true if an object member with `key` exists.
+
+        Returns `false` when the value is not
+        an object.
+
+        @par Complexity
+        Linear in `size()`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    BOOST_JSON_DECL
+    bool
+    contains(
+        string_view key) const noexcept;
+
+    /** Return a @ref value equivalent to the referenced value.
+
+        The result owns its contents and does
+        not reference the document.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param sp A pointer to the
+        @ref memory_resource to use for the
+        result. The container will acquire
+        shared ownership of the memory
+        resource.
+    */
+    BOOST_JSON_DECL
+    value
+    unpack(storage_ptr sp = {}) const;
+};
+
+/** A compact, read-only form of a JSON document.
+
+    This container copies a @ref value into a
+    single contiguous buffer where every value
+    is a fixed sixteen byte node and children
+    are addressed by 32-bit offsets from the
+    start of the buffer, instead of pointers.
+    Compared to the tree form, which spends
+    `sizeof(value)` bytes per element plus a
+    separate allocation and storage pointer per
+    container, the packed form holds an entire
+    document in one allocation, uses a third of
+    the space per node, and stores object
+    members at half the size of
+    @ref key_value_pair. Because the buffer is
+    position independent it also suits
+    workloads that cache or relocate documents
+    wholesale.
+
+    Packed documents are immutable; access is
+    through @ref packed_value cursors starting
+    at @ref root, and @ref packed_value::unpack
+    converts back to a tree when mutation is
+    needed. Documents larger than four
+    gigabytes cannot be represented and cause
+    the constructor to throw.
+
+    @par Example
+    @code
+    packed_document doc( jv );
+    assert( doc.root().at( "k" ).get_int64() == 1 );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Const member functions of the
+    same instance may be called concurrently.
+
+    @see
+        @ref packed_value,
+        @ref value.
+*/
+class packed_document
+{
+    storage_ptr sp_;
+    unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    /** Default constructor.
+
+        The document is empty; @ref root
+        returns a null cursor.
+    */
+    packed_document() = default;
+
+    /** Constructor.
+
+        The document is a packed copy of `jv`.
+        The source is not modified and no
+        reference to it is kept.
+
+        @par Complexity
+        Linear in the number of values in `jv`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param jv The value to pack.
+
+        @param sp A pointer to the
+        @ref memory_resource to use for the
+        buffer. The container will acquire
+        shared ownership of the memory
+        resource.
+
+        @throw system_error The packed form
+        would exceed `UINT32_MAX` bytes.
+    */
+    BOOST_JSON_DECL
+    explicit
+    packed_document(
+        value const& jv,
+        storage_ptr sp = {});
+
+    /** Destructor.
+
+        The buffer is released back to the
+        memory resource.
+    */
+    BOOST_JSON_DECL
+    ~packed_document();
+
+    /** Move constructor.
+
+        Ownership of the buffer is transferred
+        and `other` is left empty.
+
+        @param other The document to move from.
+    */
+    packed_document(
+        packed_document&& other) noexcept
+        : sp_(std::move(other.sp_))
+        , data_(other.data_)
+        , size_(other.size_)
+    {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /** Move assignment.
+
+        Any buffer held is released, then
+        ownership is transferred from `other`,
+        which is left empty.
+
+        @param other The document to move from.
+    */
+    BOOST_JSON_DECL
+    packed_document&
+    operator=(
+        packed_document&& other) noexcept;
+
+    /// Copying is not supported.
+    packed_document(
+        packed_document const&) = delete;
+
+    /// Copying is not supported.
+    packed_document&
+    operator=(
+        packed_document const&) = delete;
+
+    /** Return true if the document holds no buffer.
+    */
+    bool
+    empty() const noexcept
+    {
+        return data_ == nullptr;
+    }
+
+    /** Return the size of the buffer in bytes.
+    */
+    std::size_t
+    size_bytes() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return the memory resource used by the document.
+    */
+    storage_ptr const&
+    storage() const noexcept
+    {
+        return sp_;
+    }
+
+    /** Return a cursor to the top-level value.
+
+        For an empty document the cursor
+        behaves as a null value.
+    */
+    packed_value
+    root() const noexcept
+    {
+        return packed_value(data_, 0);
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
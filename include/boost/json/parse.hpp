@@ -35,7 +35,13 @@ namespace json {
 
     @par Exception Safety
     Strong guarantee.
-    Calls to `memory_resource::allocate` may throw.
+    If a memory allocation fails with
+    `std::bad_alloc`, the failure is reported
+    through `ec` as @ref error::not_enough_memory
+    and any partially built result is destroyed;
+    the exception does not escape. Other
+    exceptions from `memory_resource::allocate`
+    may throw.
 
     @return A value representing the parsed JSON,
     or a null if any error occurred.
@@ -129,7 +135,13 @@ parse(
 
     @par Exception Safety
     Basic guarantee.
-    Calls to `memory_resource::allocate` may throw.
+    If a memory allocation fails with
+    `std::bad_alloc`, the failure is reported
+    through `ec` as @ref error::not_enough_memory
+    and any partially built result is destroyed;
+    the exception does not escape. Other
+    exceptions from `memory_resource::allocate`
+    may throw.
     The stream may throw as described by
     [`std::ios::exceptions`](https://en.cppreference.com/w/cpp/io/basic_ios/exceptions).
 
@@ -208,6 +220,100 @@ parse(
     storage_ptr sp = {},
     parse_options const& opt = {});
 
+/** Return parsed JSON from a file as a @ref value.
+
+    This function parses the entire contents of the file named by `path` and
+    produces a complete JSON entity, returned as a @ref value. On POSIX
+    systems the file is memory-mapped and advised for sequential access, so
+    the text is parsed in place without being copied into an intermediate
+    string; on other systems the file is read with buffered I/O. If the file
+    cannot be opened or does not contain a complete serialized JSON, an error
+    occurs. In this case the returned value will be `null`, using the
+    [default memory resource].
+
+    @par Complexity
+    Linear in the size of the file.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value representing the parsed JSON,
+    or a `null` if any error occurred.
+
+    @param path The path of the file to parse.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the new value and all of its elements
+    will use. If this parameter is omitted, the [default memory resource]
+    is used.
+
+    @param opt The options for the parser. If this parameter is omitted, the
+    parser will accept only standard JSON.
+
+    @see @ref parse, @ref parse_options.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+/** @{ */
+BOOST_JSON_DECL
+value
+parse_file(
+    char const* path,
+    error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+value
+parse_file(
+    char const* path,
+    std::error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+/** @} */
+
+/** Return parsed JSON from a file as a @ref value.
+
+    This function parses the entire contents of the file named by `path` and
+    produces a complete JSON entity, returned as a @ref value. On POSIX
+    systems the file is memory-mapped and advised for sequential access, so
+    the text is parsed in place without being copied into an intermediate
+    string; on other systems the file is read with buffered I/O. If the file
+    cannot be opened or does not contain a complete serialized JSON, an
+    exception is thrown.
+
+    @par Complexity
+    Linear in the size of the file.
+
+    @par Exception Safety
+    Basic guarantee.
+    Throws @ref system_error on failure.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value representing the parsed JSON upon success.
+
+    @param path The path of the file to parse.
+
+    @param sp The memory resource that the new value and all of its elements
+    will use. If this parameter is omitted, the [default memory resource]
+    is used.
+
+    @param opt The options for the parser. If this parameter is omitted, the
+    parser will accept only standard JSON.
+
+    @see @ref parse, @ref parse_options.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+BOOST_JSON_DECL
+value
+parse_file(
+    char const* path,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
 } // namespace json
 } // namespace boost
 
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PARSE_BATCH_HPP
+#define BOOST_JSON_PARSE_BATCH_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** Return many parsed documents from one call.
+
+    This function parses `count` complete JSON
+    texts, given as an array of buffers, and
+    returns one @ref value per document. Unlike
+    calling @ref parse in a loop, the parser and
+    its temporary storage are constructed once and
+    reused for every document, so the per-call
+    setup cost is paid a single time and the
+    parser's internal stack stays warm across
+    documents. This suits workloads which receive
+    large numbers of small documents, such as
+    message-bus consumers.
+
+    Every returned value is allocated from `sp`.
+    Passing a @ref monotonic_resource, or a
+    resource obtained from
+    @ref make_shared_resource, places all the
+    documents in one arena.
+
+    When any document fails to parse, `ec` is set
+    to the first error in document order and an
+    empty vector is returned.
+
+    @par Complexity
+    Linear in the total size of the input buffers.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A vector with one value per document,
+    or an empty vector if any error occurred.
+
+    @param docs Pointer to an array of buffers,
+    each holding a complete JSON text.
+
+    @param count The number of buffers.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the new
+    values and all of their elements will use. If
+    this parameter is omitted, the
+    [default memory resource] is used.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @see
+        @ref parse,
+        @ref parse_ndjson,
+        @ref parse_options.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    std::error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+/** @} */
+
+/** Return many parsed documents from one call.
+
+    This overload behaves identically to the
+    overloads taking an error code, except that a
+    `boost::system::system_error` is thrown on
+    failure instead.
+
+    @return A vector with one value per document.
+
+    @param docs Pointer to an array of buffers,
+    each holding a complete JSON text.
+
+    @param count The number of buffers.
+
+    @param sp The memory resource that the new
+    values and all of their elements will use. If
+    this parameter is omitted, the
+    [default memory resource] is used.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @throw system_error Thrown on failure.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+BOOST_JSON_DECL
+std::vector<value>
+parse_batch(
+    string_view const* docs,
+    std::size_t count,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
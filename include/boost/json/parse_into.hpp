@@ -51,7 +51,10 @@ using parser_for =
     <a href="https://en.cppreference.com/w/cpp/named_req/SequenceContainer"><em>SequenceContainer</em></a>,
     arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
     `std::optional`, `std::nullptr_t`, and structs and enums described using
-    Boost.Describe.
+    Boost.Describe. In addition, types with a user-provided `tag_invoke`
+    overload of @ref value_to are supported: the subtree corresponding to
+    each such element is buffered as a @ref value and converted as soon as
+    it completes, so only one element's source tree is resident at a time.
 
     @par Complexity
     Linear in `sv.size()`.
@@ -98,7 +101,10 @@ parse_into(
     <a href="https://en.cppreference.com/w/cpp/named_req/SequenceContainer"><em>SequenceContainer</em></a>,
     arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
     `std::optional`, `std::nullptr_t`, and structs and enums described using
-    Boost.Describe.
+    Boost.Describe. In addition, types with a user-provided `tag_invoke`
+    overload of @ref value_to are supported: the subtree corresponding to
+    each such element is buffered as a @ref value and converted as soon as
+    it completes, so only one element's source tree is resident at a time.
 
     @par Complexity
     Linear in `sv.size()`.
@@ -133,7 +139,10 @@ parse_into(
     <a href="https://en.cppreference.com/w/cpp/named_req/SequenceContainer"><em>SequenceContainer</em></a>,
     arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
     `std::optional`, `std::nullptr_t`, and structs and enums described using
-    Boost.Describe.
+    Boost.Describe. In addition, types with a user-provided `tag_invoke`
+    overload of @ref value_to are supported: the subtree corresponding to
+    each such element is buffered as a @ref value and converted as soon as
+    it completes, so only one element's source tree is resident at a time.
 
     @par Complexity
     Linear in the size of consumed input.
@@ -182,7 +191,10 @@ parse_into(
     <a href="https://en.cppreference.com/w/cpp/named_req/SequenceContainer"><em>SequenceContainer</em></a>,
     arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
     `std::optional`, `std::nullptr_t`, and structs and enums described using
-    Boost.Describe.
+    Boost.Describe. In addition, types with a user-provided `tag_invoke`
+    overload of @ref value_to are supported: the subtree corresponding to
+    each such element is buffered as a @ref value and converted as soon as
+    it completes, so only one element's source tree is resident at a time.
 
     @par Complexity
     Linear in the size of consumed input.
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PARSE_NUMBERS_HPP
+#define BOOST_JSON_PARSE_NUMBERS_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** Parse a JSON array of numbers into a caller buffer.
+
+    This function parses a complete JSON text
+    whose top level is an array and stores every
+    number it contains into `dest`, converted to
+    `double`, without building a @ref value or
+    going through the generic conversion layering
+    of @ref parse_into. Nested arrays are
+    flattened in order of appearance, so texts
+    like coordinate lists of pairs work directly.
+    Elements other than numbers and arrays cause
+    `error::not_number`.
+
+    If the input contains more numbers than
+    `dest_size`, `ec` is set to
+    `error::size_mismatch` and `dest` receives
+    the first `dest_size` numbers.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @return The number of elements stored.
+
+    @param s The string to parse.
+
+    @param dest The buffer receiving the numbers.
+
+    @param dest_size The capacity of `dest` in
+    elements.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+BOOST_JSON_DECL
+std::size_t
+parse_numbers(
+    string_view s,
+    double* dest,
+    std::size_t dest_size,
+    error_code& ec,
+    parse_options const& opt = {});
+
+/** Parse a JSON array of numbers into a vector.
+
+    This function parses a complete JSON text
+    whose top level is an array and assigns every
+    number it contains to `dest`, converted to
+    `double`, without building a @ref value or
+    going through the generic conversion layering
+    of @ref parse_into. Nested arrays are
+    flattened in order of appearance. Elements
+    other than numbers and arrays cause
+    `error::not_number`. Previous contents of
+    `dest` are destroyed; its capacity is reused.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @param s The string to parse.
+
+    @param dest The vector receiving the numbers.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+BOOST_JSON_DECL
+void
+parse_numbers(
+    string_view s,
+    std::vector<double>& dest,
+    error_code& ec,
+    parse_options const& opt = {});
+
+/** Parse a JSON array of numbers into a vector.
+
+    This overload throws @ref system_error on a
+    failed parse.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Throws @ref system_error on failed parse.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return The parsed numbers.
+
+    @param s The string to parse.
+
+    @param opt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+BOOST_JSON_DECL
+std::vector<double>
+parse_numbers(
+    string_view s,
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
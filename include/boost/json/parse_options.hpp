@@ -11,6 +11,8 @@
 #define BOOST_JSON_PARSE_OPTIONS_HPP
 
 #include <boost/json/detail/config.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
 #include <iosfwd>
 
 namespace boost {
@@ -38,6 +40,46 @@ enum class number_precision : unsigned char
     none,
 };
 
+/** Enumeration of duplicate key policies
+
+    These values are used to select what happens
+    when a parsed object contains two or more
+    elements with the same key.
+
+    @see
+        @ref parse_options,
+        @ref value_stack.
+*/
+enum class duplicate_keys : unsigned char
+{
+    /// Keep the last occurrence; earlier ones are discarded.
+    last,
+
+    /// Keep the first occurrence; later ones are discarded.
+    first,
+
+    /// Fail the parse with @ref error::duplicate_key.
+    error,
+};
+
+/** The type of callback used to stream blob fields
+
+    Callbacks of this type receive the
+    characters of designated string values as
+    they are scanned, instead of having them
+    accumulated into the document. The chunk
+    is valid only for the duration of the
+    call; `done` is `true` on the chunk which
+    completes the string, which may be empty.
+
+    @see
+        @ref parse_options.
+*/
+typedef void (*blob_callback)(
+    void* user,
+    string_view chunk,
+    bool done);
+
 /** Parser options
 
     This structure is used for specifying
@@ -81,6 +123,184 @@ struct parse_options
     */
     number_precision numbers = number_precision::imprecise;
 
+    /** Capture numbers as pre-formatted text
+
+        When set, parsers which build a @ref value
+        store each number as its original,
+        validated numeral text instead of
+        converting it to a numeric type. Such
+        values report @ref value::is_raw_number,
+        and the serializer emits the stored
+        characters verbatim, so the exact decimal
+        representation round-trips: `0.1000`
+        serializes as `0.1000`. Combine with
+        @ref number_precision::none to skip the
+        numeric conversion work entirely.
+
+        This option disables
+        @ref full_buffer_fast_path.
+
+        @see
+            @ref value::is_raw_number,
+            @ref raw_number,
+            @ref parser,
+            @ref stream_parser.
+    */
+    bool raw_numbers = false;
+
+    /** Duplicate key policy
+
+        This selects what happens when an object in
+        the parsed JSON text contains two or more
+        elements with the same key. The default
+        keeps the last occurrence, matching the
+        behavior of @ref object construction.
+        Keeping the first occurrence skips the
+        overwriting work entirely, while the error
+        policy rejects such documents during the
+        parse, without requiring a separate
+        validation pass afterwards.
+
+        Duplicates are resolved when the closing
+        brace of the containing object is reached;
+        the policy has no cost for objects whose
+        keys are unique.
+
+        @see
+            @ref duplicate_keys,
+            @ref parser,
+            @ref stream_parser.
+    */
+    duplicate_keys on_duplicate_key = duplicate_keys::last;
+
+    /** Single-storage tree mode
+
+        When set, parsers which build a @ref value
+        construct the elements of the document with
+        non-owning pointers to the memory resource;
+        only the top-level value returned by the
+        parser keeps the resource alive. For
+        resources created with
+        @ref make_shared_resource this removes the
+        two reference count adjustments otherwise
+        performed for every element, which dominate
+        construction cost for large documents. For
+        resources which are already non-owning the
+        option has no effect.
+
+        Elements detached from the document do not
+        share ownership of the resource; the caller
+        must keep the top-level value, or the
+        resource itself, alive for as long as any
+        detached element is used.
+
+        This option disables
+        @ref full_buffer_fast_path.
+
+        @see
+            @ref make_shared_resource,
+            @ref parser,
+            @ref stream_parser.
+    */
+    bool single_storage = false;
+
+    /** Key member name for building objects from arrays of pairs
+
+        Some APIs encode maps as arrays of
+        two-member objects, for example
+        `[{"k":"a","v":1},{"k":"b","v":2}]`.
+        When this member and @ref pair_value are
+        both non-empty, parsers which build a
+        @ref value recognize arrays whose
+        elements all have that shape — exactly
+        two members, the member named here
+        holding a string — and build an
+        @ref object keyed by those strings
+        directly, instead of the intermediate
+        array of pair objects. The example above
+        with `pair_key = "k"` and
+        `pair_value = "v"` builds the same value
+        as parsing `{"a":1,"b":2}` would. This
+        replaces a full rebuild of the tree
+        after the parse.
+
+        The transform applies to matching arrays
+        anywhere in the document, including the
+        top level; arrays with any non-matching
+        element, and empty arrays, are built
+        normally. Duplicate keys are resolved
+        according to @ref on_duplicate_key. The
+        referenced characters are not copied;
+        they must remain valid for the lifetime
+        of any parser constructed with these
+        options.
+
+        This option disables
+        @ref full_buffer_fast_path.
+
+        @see
+            @ref pair_value,
+            @ref parser,
+            @ref stream_parser.
+    */
+    string_view pair_key;
+
+    /** Value member name for building objects from arrays of pairs
+
+        The name of the member holding the
+        element value; see @ref pair_key. The
+        referenced characters are not copied.
+    */
+    string_view pair_value;
+
+    /** Callback receiving designated string values in chunks
+
+        When set, parsers which build a
+        @ref value deliver the characters of
+        string values belonging to the keys in
+        @ref blob_keys directly to this
+        callback as they are scanned, instead
+        of accumulating them. The member
+        appears in the built document with a
+        null value. This keeps peak memory
+        bounded by the parser's buffer window
+        rather than the string size, which
+        matters for documents embedding large
+        encoded blobs that would only be
+        decoded and discarded after the parse.
+
+        Only object members whose value is a
+        string participate; designated members
+        holding any other type are built
+        normally. A key may be delivered in
+        several chunks when the input arrives
+        split or the value contains escapes.
+
+        This option disables
+        @ref full_buffer_fast_path.
+
+        @see
+            @ref blob_callback,
+            @ref parser,
+            @ref stream_parser.
+    */
+    blob_callback on_blob = nullptr;
+
+    /** Opaque pointer passed to @ref on_blob.
+    */
+    void* blob_user = nullptr;
+
+    /** Keys whose string values are streamed to @ref on_blob.
+
+        The array is not copied; it must
+        remain valid for the lifetime of any
+        parser constructed with these options.
+    */
+    string_view const* blob_keys = nullptr;
+
+    /// The number of keys in @ref blob_keys.
+    std::size_t blob_keys_count = 0;
+
     /** Non-standard extension option
 
         Allow C and C++ style comments to appear
@@ -128,6 +348,105 @@ struct parse_options
     */
     bool allow_infinity_and_nan = false;
 
+    /** Whole-buffer parsing optimization
+
+        When the complete JSON text is available in
+        a single buffer, enabling this option allows
+        @ref parse to use a two-stage engine: a SIMD
+        pass locates all string delimiters and
+        structural characters first, then a second
+        pass builds the value from the index. This
+        can be significantly faster for large texts.
+
+        The fast path is only taken by the
+        overloads of @ref parse accepting a
+        @ref string_view, and only when
+        @ref allow_comments, @ref allow_trailing_commas,
+        @ref allow_infinity_and_nan,
+        @ref raw_numbers, @ref single_storage,
+        @ref pair_key, and @ref on_blob
+        are not set
+        and @ref numbers is not
+        @ref number_precision::none; otherwise the
+        incremental parser is used. The fast path
+        always parses numbers with full precision.
+
+        @see
+            @ref parse.
+    */
+    bool full_buffer_fast_path = false;
+
+    /** Return options tuned to a sample of representative documents.
+
+        This function scans one or more documents
+        which are representative of an expected
+        workload and returns options whose
+        performance knobs are selected from the
+        measurements, instead of being set by
+        hand:
+
+        @li @ref max_depth is given generous
+        headroom over the deepest nesting
+        observed, and never reduced below the
+        default.
+
+        @li @ref numbers selects
+        @ref number_precision::precise when the
+        sample contains numerals carrying more
+        significant digits than the fast
+        conversion preserves; otherwise the two
+        modes produce identical values and the
+        fast one is kept.
+
+        @li @ref full_buffer_fast_path is enabled
+        when documents are large enough for the
+        extra indexing pass to amortize.
+
+        The sample is only measured, not parsed;
+        malformed text simply yields poorer
+        tuning. Options which change accepted
+        inputs or observable results, such as the
+        non-standard extensions and the duplicate
+        key policy, always keep their defaults.
+
+        @par Complexity
+        Linear in the size of the sample.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @return The tuned options.
+
+        @param samples Pointer to an array of
+        documents to measure.
+
+        @param n The number of documents.
+
+        @see
+            @ref parse.
+    */
+    BOOST_JSON_DECL
+    static
+    parse_options
+    adaptive(
+        string_view const* samples,
+        std::size_t n) noexcept;
+
+    /** Return options tuned to a sample of representative documents.
+
+        This overload measures a single buffer,
+        which may also hold the concatenation of
+        several documents.
+
+        @return The tuned options.
+
+        @param sample The document to measure.
+    */
+    BOOST_JSON_DECL
+    static
+    parse_options
+    adaptive(string_view sample) noexcept;
+
     /** Set JSON parse options on input stream.
 
         The function stores parse options in the private storage of the stream. If
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PARSE_PARALLEL_HPP
+#define BOOST_JSON_PARSE_PARALLEL_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/executor.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+
+namespace boost {
+namespace json {
+
+/** Return parsed JSON as a @ref value, using multiple threads.
+
+    This function parses a single complete JSON
+    text, producing the same value that @ref parse
+    would produce. A fast sequential pass indexes
+    the structure of the document; the top-level
+    elements of a container root are then divided
+    into contiguous chunks of roughly equal size
+    and parsed concurrently, each chunk building
+    into its own @ref monotonic_resource created
+    by the function and shared by the values of
+    that chunk. The chunk resources are freed when
+    the last value using them is destroyed.
+
+    The container returned in `jv` uses `sp` for
+    its own structure, while the elements retain
+    the memory resources of the chunks that built
+    them; the result compares equal to a
+    sequential parse and serializes identically.
+    Documents with a scalar root, and options not
+    handled by the indexed engine (comments,
+    trailing commas, infinity literals,
+    validation-only or raw numbers), are parsed
+    sequentially instead.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value representing the parsed JSON,
+    or a null if any error occurred.
+
+    @param s The string to parse.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the
+    returned container will use. If this parameter
+    is omitted, the [default memory resource] is
+    used.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @param threads The maximum number of threads
+    to use. If this parameter is omitted, the
+    document is parsed on the calling thread only.
+
+    @see
+        @ref parse,
+        @ref parse_options.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+/** @{ */
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {},
+    unsigned threads = 1);
+
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {},
+    unsigned threads = 1);
+/** @} */
+
+/** Return parsed JSON as a @ref value, using multiple threads.
+
+    This overload behaves identically to the
+    overloads taking an error code, except that a
+    `boost::system::system_error` is thrown on
+    failure instead.
+
+    @return A value representing the parsed
+    JSON upon success.
+
+    @param s The string to parse.
+
+    @param sp The memory resource that the
+    returned container will use. If this parameter
+    is omitted, the [default memory resource] is
+    used.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @param threads The maximum number of threads
+    to use. If this parameter is omitted, the
+    document is parsed on the calling thread only.
+
+    @throw system_error Thrown on failure.
+
+    [default memory resource]: json/allocators/storage_ptr.html#json.allocators.storage_ptr.default_memory_resource
+*/
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    storage_ptr sp = {},
+    parse_options const& opt = {},
+    unsigned threads = 1);
+
+/** Return parsed JSON as a @ref value, using multiple threads.
+
+    These overloads behave identically to the
+    overloads taking a thread count, except that
+    chunk parses are submitted to `ex` instead of
+    transient threads of execution, with the chunk
+    count chosen from `ex.concurrency()`. Use this
+    with a shared @ref thread_pool to keep
+    repeated parses from oversubscribing the
+    machine.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value representing the parsed JSON,
+    or a null if any error occurred.
+
+    @param s The string to parse.
+
+    @param ex The executor to run chunk
+    parses on.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the
+    returned container will use. If this parameter
+    is omitted, the [default memory resource] is
+    used.
+
+    @param opt The options for the parser. If this
+    parameter is omitted, the parser will accept
+    only standard JSON.
+
+    @see
+        @ref executor,
+        @ref thread_pool.
+*/
+/** @{ */
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    std::error_code& ec,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+
+BOOST_JSON_DECL
+value
+parse_parallel(
+    string_view s,
+    executor& ex,
+    storage_ptr sp = {},
+    parse_options const& opt = {});
+/** @} */
+
+} // namespace json
+} // namespace boost
+
+#endif
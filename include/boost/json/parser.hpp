@@ -15,6 +15,7 @@
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/value.hpp>
 #include <boost/json/detail/handler.hpp>
+#include <atomic>
 #include <type_traits>
 #include <cstddef>
 
@@ -418,6 +419,80 @@ public:
     void
     reset(storage_ptr sp = {}) noexcept;
 
+    /** Set the cancellation flag checked during parsing.
+
+        When `flag` is not null, the parser reads
+        it once for every JSON value it begins,
+        and if the flag is `true` the parse stops
+        with @ref error::canceled. Another thread,
+        such as a deadline timer, may set the flag
+        at any time to make a call to
+        @ref write_some in progress return early
+        instead of parsing its buffer to
+        completion. The flag is read with relaxed
+        ordering and is never written or cleared
+        by the parser; the caller must clear it
+        before reusing the parser after a call to
+        @ref reset.
+
+        The check costs one predictable branch
+        per value when no flag is installed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param flag A pointer to the flag to
+        check, which must remain valid until it
+        is replaced or the parser is destroyed,
+        or `nullptr` to disable cancellation.
+    */
+    void
+    cancel_token(
+        std::atomic<bool> const* flag) noexcept
+    {
+        p_.cancel_token(flag);
+    }
+
+    /** Return the installed cancellation flag.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::atomic<bool> const*
+    cancel_token() const noexcept
+    {
+        return p_.cancel_token();
+    }
+
+    /** Return excess temporary storage to the memory resource.
+
+        The temporary storage used by the
+        implementation is retained at its high-water
+        mark across calls to @ref reset, so that
+        parsing many documents with one parser
+        performs no allocations in the steady state.
+        This function releases that storage,
+        returning the parser to its
+        construction-time state. Any previous
+        partial results are destroyed.
+
+        @par Complexity
+        Constant or linear in the size of any
+        previous partial parsing results.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    shrink_to_fit() noexcept;
+
     /** Parse a buffer containing a complete JSON text.
 
         This function parses a complete JSON text contained
@@ -0,0 +1,327 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PATCH_HPP
+#define BOOST_JSON_PATCH_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** A compiled JSON Patch.
+
+    This class represents a JSON Patch
+    ([RFC 6902](https://datatracker.ietf.org/doc/html/rfc6902))
+    in compiled form: the patch document is
+    validated and its JSON Pointer strings are
+    tokenized once, when the patch is compiled,
+    and the result may then be applied to any
+    number of target documents without parsing
+    pointers again or creating temporary values.
+    This is much cheaper than interpreting the
+    patch document for every application when the
+    same patch is applied at a high rate.
+
+    Operations are applied to the target in
+    place, in order, stopping at the first
+    operation which fails. When an application
+    fails the target is left with all preceding
+    operations applied; callers which require
+    atomic application should retain a copy of
+    the target.
+
+    @par Example
+    @code
+    patch p( parse( R"([
+        { "op": "replace", "path": "/name", "value": "jane" },
+        { "op": "remove", "path": "/tmp" }
+    ])" ) );
+
+    p.apply( doc1 );
+    p.apply( doc2 );
+    @endcode
+
+    @par Thread Safety
+    A compiled patch may be applied to distinct
+    targets concurrently.
+
+    @see
+        @ref apply_merge_patch,
+        <a href="https://datatracker.ietf.org/doc/html/rfc6902">
+            RFC 6902 - JavaScript Object Notation (JSON) Patch</a>
+*/
+class patch
+{
+    enum class op_kind : unsigned char
+    {
+        add,
+        remove,
+        replace,
+        move,
+        copy,
+        test
+    };
+
+    // one unescaped reference token, with the
+    // array index precomputed when numeric
+    struct token
+    {
+        std::string key;
+        std::size_t index;
+    };
+
+    struct operation
+    {
+        op_kind kind;
+        std::vector<token> path;
+        std::vector<token> from;
+        value operand;
+    };
+
+    std::vector<operation> ops_;
+
+public:
+    /** Default constructor.
+
+        The patch contains no operations;
+        applying it has no effect.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    patch() = default;
+
+    /** Constructor.
+
+        The patch is compiled from `doc`, which
+        must be an array of operation objects as
+        specified in RFC 6902. Equivalent to
+        calling @ref compile.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw system_error `doc` is not a
+        valid patch document.
+
+        @param doc The patch document to compile.
+    */
+    explicit
+    patch(value const& doc)
+    {
+        compile(doc);
+    }
+
+    /** Compile a patch document.
+
+        The patch document `doc` is validated and
+        compiled, replacing the previously compiled
+        operations. The document must be an array
+        of operation objects as specified in RFC
+        6902; each operation must name a known
+        `"op"`, have a syntactically valid `"path"`
+        (and `"from"` where applicable), and carry
+        the members its kind requires. Otherwise,
+        `ec` is set to @ref error::invalid_patch or
+        to the pointer parse error, and the patch
+        becomes empty.
+
+        @par Complexity
+        Linear in the size of `doc`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param doc The patch document to compile.
+
+        @param ec Set to the error, if any occurred.
+    */
+    /** @{ */
+    BOOST_JSON_DECL
+    void
+    compile(
+        value const& doc,
+        error_code& ec);
+
+    BOOST_JSON_DECL
+    void
+    compile(
+        value const& doc,
+        std::error_code& ec);
+    /** @} */
+
+    /** Compile a patch document.
+
+        This overload behaves identically to the
+        overloads taking an error code, except
+        that a `boost::system::system_error` is
+        thrown on failure instead.
+
+        @param doc The patch document to compile.
+
+        @throw system_error Thrown on failure.
+    */
+    BOOST_JSON_DECL
+    void
+    compile(value const& doc);
+
+    /** Apply the patch to a target.
+
+        The compiled operations are applied to
+        `target` in place, in order, stopping at
+        the first operation which fails. Inserted
+        values are copied using the target's
+        @ref memory_resource; no other temporary
+        values are created. On failure, `ec` is
+        set and `target` is left with the
+        preceding operations applied.
+
+        @par Complexity
+        Linear in the number of operations and
+        the depth of their pointers.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return The number of operations applied.
+
+        @param target The value to modify.
+
+        @param ec Set to the error, if any occurred.
+    */
+    /** @{ */
+    BOOST_JSON_DECL
+    std::size_t
+    apply(
+        value& target,
+        error_code& ec) const;
+
+    BOOST_JSON_DECL
+    std::size_t
+    apply(
+        value& target,
+        std::error_code& ec) const;
+    /** @} */
+
+    /** Apply the patch to a target.
+
+        This overload behaves identically to the
+        overloads taking an error code, except
+        that a `boost::system::system_error` is
+        thrown on failure instead.
+
+        @return The number of operations applied.
+
+        @param target The value to modify.
+
+        @throw system_error Thrown on failure.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    apply(value& target) const;
+
+    /** Return the number of compiled operations.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return ops_.size();
+    }
+
+    /** Return true if the patch has no operations.
+    */
+    bool
+    empty() const noexcept
+    {
+        return ops_.empty();
+    }
+
+private:
+    static
+    bool
+    parse_pointer(
+        string_view sv,
+        std::vector<token>& toks,
+        error_code& ec);
+
+    static
+    value*
+    resolve(
+        value* jv,
+        token const* first,
+        std::size_t n,
+        error_code& ec);
+
+    static
+    bool
+    insert_at(
+        value& target,
+        std::vector<token> const& path,
+        value&& jv,
+        error_code& ec);
+
+    std::size_t
+    do_apply(
+        value& target,
+        error_code& ec) const;
+};
+
+/** Apply a JSON Merge Patch to a target.
+
+    This function applies the merge patch `mp`
+    ([RFC 7386](https://datatracker.ietf.org/doc/html/rfc7386))
+    to `target` in place. When `mp` is an object,
+    its members are merged recursively: a null
+    member removes the corresponding member from
+    the target, any other member replaces or
+    inserts it. Any other kind of patch replaces
+    the target entirely. Inserted values are
+    copied using the target's
+    @ref memory_resource.
+
+    Merge patch application cannot fail.
+
+    @par Complexity
+    Linear in the size of `mp`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @param target The value to modify.
+
+    @param mp The merge patch to apply.
+
+    @see
+        @ref patch,
+        <a href="https://datatracker.ietf.org/doc/html/rfc7386">
+            RFC 7386 - JSON Merge Patch</a>
+*/
+BOOST_JSON_DECL
+void
+apply_merge_patch(
+    value& target,
+    value const& mp);
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_PATH_QUERY_HPP
+#define BOOST_JSON_PATH_QUERY_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+class path_selector;
+} // detail
+
+/** A compiled JSONPath query, evaluated while parsing.
+
+    This class holds the parsed form of a query
+    expressed in a subset of JSONPath:
+
+    @li `$` refers to the root document,
+
+    @li `.name` and `['name']` select an object
+    member,
+
+    @li `[n]` selects an array element,
+
+    @li `.*` and `[*]` select every member or
+    element of a container.
+
+    Recursive descent, slices, and filter
+    expressions are not supported.
+
+    Calling @ref select evaluates the query
+    directly against serialized JSON using
+    @ref basic_parser: only the subtrees which
+    match the query are materialized as values,
+    while everything else is scanned and
+    discarded without allocation. When a query
+    touches a small fraction of a large document,
+    this avoids building a DOM for the parts
+    which are never inspected:
+
+    @code
+    path_query const q( "$.items[*].price" );
+
+    for( string_view doc : documents )
+        for( value const& price : q.select( doc ) )
+            f( price );
+    @endcode
+*/
+class path_query
+{
+    enum class seg_kind : unsigned char
+    {
+        key,
+        index,
+        wildcard
+    };
+
+    struct segment
+    {
+        std::string key;
+        std::size_t index = 0;
+        seg_kind kind = seg_kind::key;
+    };
+
+    std::vector<segment> segments_;
+    std::string text_;
+
+    friend class detail::path_selector;
+
+public:
+    /** Construct a query from a string.
+
+        The string is parsed into selection
+        segments once, up front.
+
+        @par Complexity
+        Linear in `sv.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param sv The query string to compile.
+
+        @throw system_error `sv` is not a valid
+        query, or uses unsupported JSONPath
+        constructs.
+    */
+    BOOST_JSON_DECL
+    explicit
+    path_query(string_view sv);
+
+    /** Return the original query string.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    string_view
+    str() const noexcept
+    {
+        return text_;
+    }
+
+    /** Return the number of selection segments.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return segments_.size();
+    }
+
+    /** Evaluate the query against serialized JSON.
+
+        The input is parsed once; elements which
+        match the query are collected, in document
+        order, into the returned array. Subtrees
+        which cannot match are scanned without
+        building values for them.
+
+        @par Complexity
+        Linear in `js.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param js The JSON text to evaluate against.
+
+        @param sp The memory resource that the
+        returned array and its elements will use.
+
+        @param opt The options for the parser.
+
+        @return An array of the matching elements.
+
+        @throw system_error `js` is not valid JSON.
+    */
+    BOOST_JSON_DECL
+    array
+    select(
+        string_view js,
+        storage_ptr sp = {},
+        parse_options const& opt = {}) const;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
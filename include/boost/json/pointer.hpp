@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2022 Dmitry Arkhipov (grisumbras@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_POINTER_HPP
+#define BOOST_JSON_POINTER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/system_error.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+class value;
+
+/** A precompiled JSON Pointer.
+
+    This container holds the parsed form of a
+    JSON Pointer string: each reference token is
+    stored with its escape sequences resolved and
+    its interpretation as an array index computed
+    once, up front. Resolving a compiled pointer
+    against a @ref value with
+    @ref value::find_pointer therefore skips the
+    tokenization which the `string_view` overloads
+    repeat on every call. Use this type when the
+    same pointer is evaluated against many
+    documents:
+
+    @code
+    pointer const p( "/deeply/nested/field" );
+
+    for( value const& doc : documents )
+        if( auto v = doc.find_pointer( p, ec ) )
+            f( *v );
+    @endcode
+
+    Invalid pointer strings are reported when the
+    pointer is compiled, rather than on every
+    lookup.
+
+    @see
+    <a href="https://datatracker.ietf.org/doc/html/rfc6901">
+        RFC 6901 - JavaScript Object Notation (JSON) Pointer</a>
+*/
+class pointer
+{
+    struct segment
+    {
+        std::string key;
+
+        // the token parsed as an array
+        // index, valid when index_ec is
+        // empty. a token's meaning depends
+        // on the kind of the container it
+        // is applied to, so both forms are
+        // kept.
+        std::size_t index = 0;
+        error_code index_ec;
+    };
+
+    std::vector<segment> segments_;
+    std::string text_;
+
+public:
+    /** Default constructor.
+
+        A default-constructed pointer has no
+        reference tokens, and resolves to the
+        document itself.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    pointer() = default;
+
+    /** Construct a pointer from a string.
+
+        The string is parsed into reference
+        tokens, unescaping `~0` and `~1` and
+        precomputing array indices.
+
+        @par Complexity
+        Linear in `sv.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param sv The JSON Pointer string to
+        compile.
+
+        @throw system_error `sv` is not a valid
+        JSON Pointer.
+    */
+    BOOST_JSON_DECL
+    explicit
+    pointer(string_view sv);
+
+    /** Return the original pointer string.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    string_view
+    str() const noexcept
+    {
+        return text_;
+    }
+
+    /** Return the number of reference tokens.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return segments_.size();
+    }
+
+    /** Return `true` if there are no reference tokens.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    bool
+    empty() const noexcept
+    {
+        return segments_.empty();
+    }
+
+private:
+    friend class value;
+
+    BOOST_JSON_DECL
+    value const*
+    resolve(
+        value const& jv,
+        error_code& ec) const noexcept;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_POOLED_RESOURCE_HPP
+#define BOOST_JSON_POOLED_RESOURCE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/memory_resource.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // class needs to have dll-interface to be used by clients of class
+#pragma warning(disable: 4275) // non dll-interface class used as base for dll-interface class
+#endif
+
+//----------------------------------------------------------
+
+/** A monotonic resource which recycles its blocks
+
+    This memory resource allocates like
+    @ref monotonic_resource: each allocation is
+    carved from the current block, nothing is
+    returned until the resource goes away, and the
+    deallocate function is trivial. The difference
+    is what happens to the blocks afterwards.
+    Instead of releasing them to the heap, the
+    destructor places them in a cache belonging to
+    the calling thread, and later constructed
+    instances draw from that cache before asking
+    the heap for new memory.
+\n
+    The purpose of this resource is the
+    request-scoped parsing pattern: construct a
+    resource, parse a document, use the result,
+    destroy everything, and repeat. With
+    @ref monotonic_resource every iteration pays
+    for its blocks again; with this resource the
+    blocks of the previous iteration are reused,
+    so steady-state parsing performs no heap
+    allocations at all. The cache needs no
+    synchronization because each thread only
+    touches its own.
+
+    @par Example
+
+    @code
+
+    for(;;)
+    {
+        pooled_resource mr;
+
+        // After the first few iterations, this
+        // parse is served entirely from blocks
+        // recycled by earlier iterations.
+        auto const jv = parse( read_request(), &mr );
+
+        handle( jv );
+    }
+
+    @endcode
+
+    @note The blocks held by a thread's cache are
+    limited to an implementation-defined total
+    size; blocks beyond the limit are released to
+    the heap. The cache itself is freed when the
+    thread exits, or earlier by calling
+    @ref clear_thread_cache.
+
+    @par Thread Safety
+    Members of the same instance may not be
+    called concurrently. Distinct instances may
+    be used concurrently from different threads.
+
+    @see @ref monotonic_resource
+*/
+class
+    BOOST_JSON_DECL
+    BOOST_SYMBOL_VISIBLE
+pooled_resource final
+    : public memory_resource
+{
+    struct block;
+    struct block_base
+    {
+        void* p;
+        std::size_t avail;
+        std::size_t size;
+        block_base* next;
+    };
+    struct cache;
+
+    block_base* head_ = nullptr;
+    std::size_t next_size_ = min_size_;
+
+    static constexpr std::size_t min_size_ = 1024;
+
+    // total bytes a thread's cache may hold
+    static constexpr std::size_t
+        max_cache_bytes_ = 1024 * 1024;
+
+    inline static constexpr std::size_t max_size();
+    inline static std::size_t round_pow2(
+        std::size_t n) noexcept;
+    inline static std::size_t next_pow2(
+        std::size_t n) noexcept;
+    inline static cache& thread_cache_() noexcept;
+    inline static block_base* pop_block(
+        std::size_t n) noexcept;
+    inline static bool push_block(
+        block_base* b) noexcept;
+
+public:
+    /// Copy constructor (deleted)
+    pooled_resource(
+        pooled_resource const&) = delete;
+
+    /// Copy assignment (deleted)
+    pooled_resource& operator=(
+        pooled_resource const&) = delete;
+
+    /** Destructor
+
+        Returns all the blocks owned by this
+        resource to the calling thread's cache.
+        Blocks which do not fit under the cache
+        limit are deallocated.
+
+        @par Effects
+        @code
+        this->release();
+        @endcode
+
+        @par Complexity
+        Linear in the number of blocks.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    ~pooled_resource();
+
+    /** Constructor
+
+        This constructs the resource and indicates
+        that the first block shall hold at least
+        `initial_size` bytes. No block is obtained
+        until the first allocation; at that point
+        the calling thread's cache is consulted
+        before the heap.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param initial_size The size of the first
+        block. If this is lower than the
+        implementation-defined lower limit, then
+        the lower limit is used instead.
+    */
+    explicit
+    pooled_resource(
+        std::size_t initial_size = 1024) noexcept;
+
+    /** Return all blocks to the thread's cache.
+
+        This function hands every block owned by
+        this resource to the calling thread's
+        cache, deallocating blocks which do not
+        fit under the cache limit. The resource
+        remains usable; subsequent allocations
+        obtain blocks as if freshly constructed.
+
+        @par Complexity
+        Linear in the number of blocks.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    void
+    release() noexcept;
+
+    /** Deallocate the calling thread's cached blocks.
+
+        This frees every block held in the calling
+        thread's cache, returning the memory to
+        the heap. It does not affect blocks still
+        owned by live resources.
+
+        @par Complexity
+        Linear in the number of cached blocks.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    static
+    void
+    clear_thread_cache() noexcept;
+
+    /** Return the size of the calling thread's cache.
+
+        This function returns the total number of
+        bytes held in the calling thread's cache,
+        available for reuse by subsequently
+        constructed resources on this thread.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    static
+    std::size_t
+    thread_cache_bytes() noexcept;
+
+protected:
+#ifndef BOOST_JSON_DOCS
+    void*
+    do_allocate(
+        std::size_t n,
+        std::size_t align) override;
+
+    void
+    do_deallocate(
+        void* p,
+        std::size_t n,
+        std::size_t align) override;
+
+    bool
+    do_is_equal(
+        memory_resource const& mr) const noexcept override;
+#endif
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+template<>
+struct is_deallocate_trivial<
+    pooled_resource>
+{
+    static constexpr bool value = true;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_RAW_NUMBER_HPP
+#define BOOST_JSON_RAW_NUMBER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/string_view.hpp>
+#include <string>
+
+namespace boost {
+namespace json {
+
+/** The original text of a JSON number.
+
+    When used as a target type with @ref parse_into,
+    either directly or as the type of an element or
+    described member, this type captures the
+    character representation of a number exactly as
+    it appeared in the JSON text, without converting
+    it to a numeric type. This preserves digits
+    beyond the precision of `double`, and avoids the
+    conversion work entirely for numbers which are
+    only re-emitted as text, such as identifiers:
+
+    @code
+    struct item
+    {
+        raw_number id;  // "id": 9007199254740993
+        double score;   // converted as usual
+    };
+    @endcode
+
+    Numbers are validated by the parser as usual;
+    the stored text is always a valid JSON number.
+    Combined with @ref number_precision::none in
+    @ref parse_options, captured fields perform no
+    conversion work at all.
+
+    @see
+        @ref parse_into,
+        @ref number_precision.
+*/
+struct raw_number
+{
+    /// The character representation of the number.
+    std::string text;
+
+    /** Constructors.
+
+        The default constructor produces an empty
+        text. The second overload copies the
+        characters of `sv`; it is the caller's
+        responsibility that they form a valid JSON
+        number.
+
+        @param sv The characters to copy.
+    */
+    /** @{ */
+    raw_number() = default;
+
+    explicit
+    raw_number(string_view sv)
+        : text(sv.data(), sv.size())
+    {
+    }
+    /** @} */
+
+    /** Conversion to @ref string_view.
+
+        The returned view is valid until the text
+        is changed or destroyed.
+    */
+    operator string_view() const noexcept
+    {
+        return text;
+    }
+};
+
+/** Return true if two numbers have the same text.
+
+    Numbers with different representations of the
+    same value, such as `1` and `1e0`, do not
+    compare equal.
+*/
+inline
+bool
+operator==(
+    raw_number const& lhs,
+    raw_number const& rhs) noexcept
+{
+    return lhs.text == rhs.text;
+}
+
+/** Return true if two numbers have different text.
+
+    Numbers with different representations of the
+    same value, such as `1` and `1e0`, do not
+    compare equal.
+*/
+inline
+bool
+operator!=(
+    raw_number const& lhs,
+    raw_number const& rhs) noexcept
+{
+    return lhs.text != rhs.text;
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
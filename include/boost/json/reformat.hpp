@@ -0,0 +1,662 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_REFORMAT_HPP
+#define BOOST_JSON_REFORMAT_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/serialize_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/writer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace json {
+namespace detail {
+
+// satisfied when T meets the sink requirements
+// of serializer::read_into; used to keep the
+// sink overloads of reformat out of overload
+// resolution for option and error arguments
+template<class T, class = void>
+struct is_sink : std::false_type
+{
+};
+
+template<class T>
+struct is_sink<T, void_t<decltype(
+    std::declval<T&>().prepare(std::size_t(0)),
+    std::declval<T&>().commit(std::size_t(0)))>>
+    : std::true_type
+{
+};
+
+} // detail
+
+/** A parse handler which re-emits the document with its numbers intact.
+
+    This handler satisfies the requirements of
+    @ref basic_parser and reproduces the
+    document in the sink, like
+    @ref writer_handler, except that the
+    original text of every number is copied to
+    the output verbatim instead of being
+    formatted from the converted result. This
+    preserves trailing zeroes, exponent
+    spelling, and digits beyond the precision
+    of `double` exactly as they appeared in the
+    input, so reformatting never alters a
+    numeric literal.
+
+    Keys, strings, and numbers which arrive
+    split across buffer boundaries are
+    accumulated in an internal buffer;
+    everything else is written through
+    immediately, so memory use is bounded by
+    the largest single token in the document
+    rather than by its total size.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+
+    @see @ref reformat, @ref writer_handler.
+*/
+template< class Sink >
+class reformat_handler
+{
+    writer<Sink> w_;
+    std::string part_;
+
+public:
+    /// The maximum number of elements allowed in an object
+    static constexpr std::size_t
+        max_object_size = std::size_t(-1);
+
+    /// The maximum number of elements allowed in an array
+    static constexpr std::size_t
+        max_array_size = std::size_t(-1);
+
+    /// The maximum size allowed for a key
+    static constexpr std::size_t
+        max_key_size = std::size_t(-1);
+
+    /// The maximum size allowed for a string
+    static constexpr std::size_t
+        max_string_size = std::size_t(-1);
+
+    /** Constructor.
+
+        @param sink The object to write to.
+        Ownership is not transferred.
+
+        @param opts The options for the
+        produced text.
+    */
+    explicit
+    reformat_handler(
+        Sink& sink,
+        serialize_options const& opts = {} ) noexcept
+        : w_( sink, opts )
+    {
+    }
+
+    /** Return true when a complete document has been emitted.
+    */
+    bool
+    done() const noexcept
+    {
+        return w_.done();
+    }
+
+    bool on_document_begin( error_code& ) { return true; }
+    bool on_document_end( error_code& ) { return true; }
+
+    bool on_object_begin( error_code& )
+    {
+        w_.begin_object();
+        return true;
+    }
+
+    bool on_object_end( std::size_t, error_code& )
+    {
+        w_.end_object();
+        return true;
+    }
+
+    bool on_array_begin( error_code& )
+    {
+        w_.begin_array();
+        return true;
+    }
+
+    bool on_array_end( std::size_t, error_code& )
+    {
+        w_.end_array();
+        return true;
+    }
+
+    bool on_key_part( string_view sv, std::size_t, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_key( string_view sv, std::size_t, error_code& )
+    {
+        if( part_.empty() )
+        {
+            w_.key( sv );
+        }
+        else
+        {
+            part_.append( sv.data(), sv.size() );
+            w_.key( part_ );
+            part_.clear();
+        }
+        return true;
+    }
+
+    bool on_string_part( string_view sv, std::size_t, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_string( string_view sv, std::size_t, error_code& )
+    {
+        if( part_.empty() )
+        {
+            w_.value( sv );
+        }
+        else
+        {
+            part_.append( sv.data(), sv.size() );
+            w_.value( string_view(part_) );
+            part_.clear();
+        }
+        return true;
+    }
+
+    bool on_number_part( string_view sv, error_code& )
+    {
+        part_.append( sv.data(), sv.size() );
+        return true;
+    }
+
+    bool on_int64( std::int64_t, string_view sv, error_code& )
+    {
+        write_number( sv );
+        return true;
+    }
+
+    bool on_uint64( std::uint64_t, string_view sv, error_code& )
+    {
+        write_number( sv );
+        return true;
+    }
+
+    bool on_double( double, string_view sv, error_code& )
+    {
+        write_number( sv );
+        return true;
+    }
+
+    bool on_bool( bool b, error_code& )
+    {
+        w_.value( b );
+        return true;
+    }
+
+    bool on_null( error_code& )
+    {
+        w_.value( nullptr );
+        return true;
+    }
+
+    bool on_comment_part( string_view, error_code& ) { return true; }
+    bool on_comment( string_view, error_code& ) { return true; }
+
+private:
+    // emit the original number text verbatim,
+    // joining parts split across buffers
+    void
+    write_number( string_view sv )
+    {
+        if( part_.empty() )
+        {
+            w_.raw_json( sv );
+        }
+        else
+        {
+            part_.append( sv.data(), sv.size() );
+            w_.raw_json( part_ );
+            part_.clear();
+        }
+    }
+};
+
+/** Rewrite serialized JSON into a sink.
+
+    This function parses the text in `s` and
+    emits an equivalent document directly into
+    `sink`, applying the whitespace and
+    escaping conventions selected by `sopt`,
+    without building a @ref value. The original
+    text of every number is copied to the
+    output verbatim, so reformatting never
+    alters a numeric literal. With default
+    serialize options this minifies the input;
+    with @ref serialize_options::pretty it
+    pretty-prints it. Comments allowed by
+    `popt` are accepted and dropped from the
+    output.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Basic guarantee.
+    The sink may throw; output already
+    committed to the sink is not rolled back
+    on error.
+
+    @param s The JSON text to rewrite.
+
+    @param sink The object to write to.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+
+    @see @ref reformat_handler, @ref parse_options,
+        @ref serialize_options.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    string_view s,
+    Sink& sink,
+    error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    basic_parser<
+        reformat_handler<Sink>> p(
+            popt, sink, sopt);
+    std::size_t const n = p.write_some(
+        false, s.data(), s.size(), ec);
+    if( ! ec && n < s.size() )
+    {
+        BOOST_JSON_FAIL( ec, error::extra_data );
+    }
+}
+
+/** Rewrite serialized JSON into a sink.
+
+    This overload behaves identically to
+    @ref reformat(string_view,Sink&,error_code&,serialize_options const&,parse_options const&)
+    except for the type of the error parameter.
+
+    @param s The JSON text to rewrite.
+
+    @param sink The object to write to.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    string_view s,
+    Sink& sink,
+    std::error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    error_code jec;
+    reformat(s, sink, jec, sopt, popt);
+    ec = jec;
+}
+
+/** Rewrite serialized JSON into a sink.
+
+    This overload behaves identically to
+    @ref reformat(string_view,Sink&,error_code&,serialize_options const&,parse_options const&)
+    except that an exception is thrown on
+    failed parse.
+
+    @par Exception Safety
+    Basic guarantee.
+    Throws @ref system_error on failed parse.
+    Output already committed to the sink is
+    not rolled back on error.
+
+    @param s The JSON text to rewrite.
+
+    @param sink The object to write to.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    string_view s,
+    Sink& sink,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    error_code ec;
+    reformat(s, sink, ec, sopt, popt);
+    if(ec)
+        detail::throw_system_error( ec );
+}
+
+/** Rewrite serialized JSON from a stream into a sink.
+
+    This function reads JSON text from `is`
+    and emits an equivalent document directly
+    into `sink`, applying the whitespace and
+    escaping conventions selected by `sopt`,
+    without building a @ref value and without
+    accumulating the input. The text is
+    rewritten one fixed-size chunk at a time,
+    so memory use is bounded by the largest
+    single token in the document rather than
+    by its total size. The original text of
+    every number is copied to the output
+    verbatim, so reformatting never alters a
+    numeric literal.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+
+    @par Complexity
+    Linear in the size of consumed input.
+
+    @par Exception Safety
+    Basic guarantee.
+    The sink may throw; output already
+    committed to the sink is not rolled back
+    on error.
+    The stream may throw as described by
+    [`std::ios::exceptions`](https://en.cppreference.com/w/cpp/io/basic_ios/exceptions).
+
+    @param is The stream to read from.
+
+    @param sink The object to write to.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+
+    @see @ref reformat_handler, @ref parse_options,
+        @ref serialize_options.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    std::istream& is,
+    Sink& sink,
+    error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    basic_parser<
+        reformat_handler<Sink>> p(
+            popt, sink, sopt);
+
+    char read_buffer[BOOST_JSON_STACK_BUFFER_SIZE / 2];
+    do
+    {
+        if( is.eof() )
+        {
+            p.write_some(false, nullptr, 0, ec);
+            break;
+        }
+
+        if( !is )
+        {
+            BOOST_JSON_FAIL( ec, error::input_error );
+            break;
+        }
+
+        is.read(read_buffer, sizeof(read_buffer));
+        auto const consumed = static_cast<
+            std::size_t>( is.gcount() );
+
+        std::size_t const n = p.write_some(
+            true, read_buffer, consumed, ec);
+        if( ! ec && n < consumed )
+        {
+            BOOST_JSON_FAIL( ec, error::extra_data );
+        }
+    }
+    while( !ec.failed() );
+}
+
+/** Rewrite serialized JSON from a stream into a sink.
+
+    This overload behaves identically to
+    @ref reformat(std::istream&,Sink&,error_code&,serialize_options const&,parse_options const&)
+    except for the type of the error parameter.
+
+    @param is The stream to read from.
+
+    @param sink The object to write to.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    std::istream& is,
+    Sink& sink,
+    std::error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    error_code jec;
+    reformat(is, sink, jec, sopt, popt);
+    ec = jec;
+}
+
+/** Rewrite serialized JSON from a stream into a sink.
+
+    This overload behaves identically to
+    @ref reformat(std::istream&,Sink&,error_code&,serialize_options const&,parse_options const&)
+    except that an exception is thrown on
+    failed parse.
+
+    @par Exception Safety
+    Basic guarantee.
+    Throws @ref system_error on failed parse.
+    Output already committed to the sink is
+    not rolled back on error.
+
+    @param is The stream to read from.
+
+    @param sink The object to write to.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+template<
+    class Sink,
+    class = typename std::enable_if<
+        detail::is_sink<Sink>::value>::type>
+void
+reformat(
+    std::istream& is,
+    Sink& sink,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {})
+{
+    error_code ec;
+    reformat(is, sink, ec, sopt, popt);
+    if(ec)
+        detail::throw_system_error( ec );
+}
+
+/** Return serialized JSON rewritten as a string.
+
+    This function parses the text in `s` and
+    returns an equivalent document as a
+    `std::string`, applying the whitespace and
+    escaping conventions selected by `sopt`,
+    without building a @ref value. The original
+    text of every number is copied to the
+    output verbatim, so reformatting never
+    alters a numeric literal. On error the
+    returned string is empty.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The rewritten JSON text, or an
+    empty string if any error occurred.
+
+    @param s The JSON text to rewrite.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+
+    @see @ref reformat_handler, @ref parse_options,
+        @ref serialize_options.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::string
+reformat(
+    string_view s,
+    error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {});
+
+BOOST_JSON_DECL
+std::string
+reformat(
+    string_view s,
+    std::error_code& ec,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {});
+/** @} */
+
+/** Return serialized JSON rewritten as a string.
+
+    This overload behaves identically to
+    @ref reformat(string_view,error_code&,serialize_options const&,parse_options const&)
+    except that an exception is thrown on
+    failed parse.
+
+    @par Exception Safety
+    Strong guarantee.
+    Throws @ref system_error on failed parse.
+    Calls to allocate may throw.
+
+    @return The rewritten JSON text.
+
+    @param s The JSON text to rewrite.
+
+    @param sopt The options for the produced
+    text. If this parameter is omitted, compact
+    standard JSON is emitted.
+
+    @param popt The options for the parser. If
+    this parameter is omitted, the parser will
+    accept only standard JSON.
+*/
+BOOST_JSON_DECL
+std::string
+reformat(
+    string_view s,
+    serialize_options const& sopt = {},
+    parse_options const& popt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_REPARSE_HPP
+#define BOOST_JSON_REPARSE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+
+namespace boost {
+namespace json {
+
+/** Update a parsed value after a small change to its text.
+
+    This function brings `jv`, which was produced
+    by parsing `old_text`, up to date with
+    `new_text` while reusing as much of the
+    existing tree as possible. The changed bytes
+    are located by comparing the two texts, the
+    smallest complete JSON value whose extent
+    covers the change is found by a structural
+    scan of the new text, and only that span is
+    reparsed and patched into `jv` in place; the
+    subtrees outside the span are untouched. For
+    an edit confined to a single field of a large
+    document, the cost is proportional to the
+    edited value, not to the document.
+
+    When the change cannot be isolated — for
+    example when it spans the document root, when
+    the new text is malformed, or when the options
+    request extensions such as comments — the
+    whole of `new_text` is parsed and `jv` is
+    replaced, giving the same result as
+    @ref parse.
+
+    The reparsed span uses the storage of `jv`.
+    If an error occurs, `jv` is unchanged.
+
+    @par Preconditions
+
+    `jv` is equal to the result of parsing
+    `old_text` with the same options. This is not
+    checked; passing an unrelated value produces
+    an unspecified (but structurally valid)
+    result.
+
+    @par Complexity
+    Linear in `new_text.size()` for the scan,
+    plus the cost of parsing the changed span.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @param jv The previously parsed value to update.
+
+    @param old_text The text which `jv` was
+    parsed from.
+
+    @param new_text The changed text.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options to use. If this
+    parameter is omitted, strict parsing is
+    performed.
+
+    @see @ref parse, @ref parse_options.
+*/
+BOOST_JSON_DECL
+void
+reparse(
+    value& jv,
+    string_view old_text,
+    string_view new_text,
+    error_code& ec,
+    parse_options const& opt = {});
+
+/** Update a parsed value after a small change to its text.
+
+    This overload behaves identically to
+    @ref reparse(value&,string_view,string_view,error_code&,parse_options const&)
+    except that an exception is thrown on error.
+
+    @throw system_error on failed parse.
+
+    @param jv The previously parsed value to update.
+
+    @param old_text The text which `jv` was
+    parsed from.
+
+    @param new_text The changed text.
+
+    @param opt The options to use. If this
+    parameter is omitted, strict parsing is
+    performed.
+*/
+BOOST_JSON_DECL
+void
+reparse(
+    value& jv,
+    string_view old_text,
+    string_view new_text,
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
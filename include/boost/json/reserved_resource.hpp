@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_RESERVED_RESOURCE_HPP
+#define BOOST_JSON_RESERVED_RESOURCE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/memory_resource.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4275) // non dll-interface class used as base for dll-interface class
+#endif
+
+//----------------------------------------------------------
+
+/** A resource using reserved address space, committed on demand
+
+    This memory resource behaves like @ref static_resource
+    backed by a buffer of the size given upon construction,
+    except that the buffer is a reserved range of virtual
+    address space rather than caller-owned storage. Pages
+    are made usable only as the high-water mark of
+    allocation reaches them, so the physical memory cost
+    of the resource follows the bytes actually allocated
+    while the capacity, and thus the point at which
+    allocation fails, can be sized for the worst case.
+    It has a trivial deallocate function; that is, the
+    metafunction @ref is_deallocate_trivial returns `true`.
+\n
+    Like @ref static_resource, allocated memory is
+    released only when the resource is destroyed or when
+    @ref release is called, making this suitable for
+    arena-per-task usage where a generous fixed capacity
+    is reserved once and the typical task touches only a
+    fraction of it.
+\n
+    On platforms without virtual memory control, the
+    whole buffer is obtained from the heap upon
+    construction instead.
+
+    @par Example
+
+    This parses a JSON text into a value which uses a
+    reserved arena, then prints the result.
+
+    @code
+
+    // reserve 1 MB of address space;
+    // only a few pages become resident
+    reserved_resource mr( 1024 * 1024 );
+
+    // Parse the string, using our memory resource
+    value const jv = parse( "[1,2,3]", &mr );
+
+    // Print the JSON
+    std::cout << jv;
+
+    @endcode
+
+    @par Thread Safety
+    Members of the same instance may not be
+    called concurrently.
+
+    @see
+        @ref static_resource,
+        https://en.wikipedia.org/wiki/Region-based_memory_management
+*/
+class
+    BOOST_JSON_DECL
+    BOOST_SYMBOL_VISIBLE
+reserved_resource final
+    : public memory_resource
+{
+    unsigned char* base_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t used_ = 0;
+    std::size_t committed_ = 0;
+
+public:
+    /// Copy constructor (deleted)
+    reserved_resource(
+        reserved_resource const&) = delete;
+
+    /// Copy assignment (deleted)
+    reserved_resource& operator=(
+        reserved_resource const&) = delete;
+
+    /** Destructor
+
+        The reserved range is returned to the system.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    ~reserved_resource() noexcept;
+
+    /** Constructor
+
+        This reserves a range of `capacity` bytes of
+        address space, rounded up to a whole number of
+        pages, for subsequent calls to allocate. No
+        page is made usable until allocation reaches
+        it. When the capacity is exhausted, allocate
+        will throw `std::bad_alloc`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Strong guarantee.
+        `std::bad_alloc` is thrown when the range
+        cannot be reserved.
+
+        @param capacity The maximum number of bytes
+        which may be allocated in total.
+    */
+    BOOST_JSON_DECL
+    explicit
+    reserved_resource(
+        std::size_t capacity);
+
+    /** Release all allocated memory.
+
+        This function resets the resource so that all
+        of the capacity is available again, and asks
+        the system to reclaim the physical pages which
+        were touched. The reserved range keeps its
+        address, so pointers obtained before the call
+        must no longer be used but the resource itself
+        performs no further system calls to grow back
+        to its previous high-water mark.
+
+        @par Complexity
+        Linear in the number of resident pages.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    release() noexcept;
+
+    /** Return the number of bytes which may be allocated in total.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /** Return the number of bytes allocated so far.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return used_;
+    }
+
+protected:
+#ifndef BOOST_JSON_DOCS
+    /** Allocate memory.
+    */
+    BOOST_JSON_DECL
+    void*
+    do_allocate(
+        std::size_t n,
+        std::size_t align) override;
+
+    /** Deallocate memory.
+    */
+    BOOST_JSON_DECL
+    void
+    do_deallocate(
+        void* p,
+        std::size_t n,
+        std::size_t align) override;
+
+    /** Compare for equality.
+    */
+    BOOST_JSON_DECL
+    bool
+    do_is_equal(
+        memory_resource const& mr
+            ) const noexcept override;
+#endif
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+template<>
+struct is_deallocate_trivial<
+    reserved_resource>
+{
+    static constexpr bool value = true;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
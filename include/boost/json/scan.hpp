@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SCAN_HPP
+#define BOOST_JSON_SCAN_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/kind.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** The result of examining the start of a JSON text.
+
+    @see @ref sniff.
+*/
+struct sniff_result
+{
+    /** `true` if the text begins like valid JSON.
+
+        When this is `false` the other fields
+        are meaningless.
+    */
+    bool valid = false;
+
+    /** The kind of the outermost value.
+    */
+    json::kind kind = json::kind::null;
+
+    /** The raw text of the first object key.
+
+        Set when the outermost value is an
+        object whose first key lies within the
+        examined prefix, otherwise empty. The
+        view refers to the characters between
+        the key's quotes in the original text;
+        a key spelled with escape sequences is
+        reported in its escaped form.
+    */
+    string_view first_key;
+
+    /** The projected number of elements of the outermost container.
+
+        For arrays and objects which close
+        within the examined prefix this is the
+        exact element count; for longer ones it
+        is extrapolated from the element density
+        of the prefix. For scalar kinds it is 1.
+    */
+    std::size_t approx_size = 0;
+};
+
+/** Return `true` if serialized JSON contains a given object key.
+
+    This function scans the raw text of `doc`
+    and determines whether any object member has
+    a key whose text equals `key`, without
+    parsing the document or building a @ref
+    value. The scan classifies string regions
+    with the same vectorized pass used by the
+    structural index, so occurrences of the key
+    text inside string values, or escaped
+    within other strings, never match; only a
+    string immediately preceding a colon does.
+    Documents which do not contain `key` as a
+    substring at all are rejected at substring
+    search speed without the classification
+    pass, which makes the function suitable as
+    a relevance pre-filter in front of @ref
+    parse.
+
+    The comparison is over the raw text between
+    the key's quotes: a key spelled with escape
+    sequences does not match its unescaped
+    form. Text which is not valid JSON yields
+    an unspecified result; text which ends
+    inside a string yields `false`. An empty
+    `key` matches an object member with an
+    empty key.
+
+    @par Complexity
+    Linear in `doc.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return `true` if an object key equal to
+    `key` was found.
+
+    @param doc The serialized JSON text to scan.
+
+    @param key The key text to search for.
+
+    @see @ref contains_string, @ref parse.
+*/
+BOOST_JSON_DECL
+bool
+contains_key(
+    string_view doc,
+    string_view key);
+
+/** Return `true` if any string in serialized JSON contains a substring.
+
+    This function scans the raw text of `doc`
+    and determines whether `needle` occurs
+    within the contents of any string, key or
+    value, without parsing the document. String
+    regions are classified with the same
+    vectorized pass used by the structural
+    index, so text outside of strings, such as
+    numbers or literals which happen to contain
+    the characters of `needle`, never matches.
+    Documents which do not contain `needle` as
+    a substring at all are rejected at
+    substring search speed.
+
+    The search is over the raw text between
+    quotes: occurrences spelled with escape
+    sequences do not match their unescaped
+    form, and a match never spans two strings.
+    Text which is not valid JSON yields an
+    unspecified result; text which ends inside
+    a string yields `false`. An empty `needle`
+    always returns `true`.
+
+    @par Complexity
+    Linear in `doc.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return `true` if a string containing
+    `needle` was found.
+
+    @param doc The serialized JSON text to scan.
+
+    @param needle The text to search for.
+
+    @see @ref contains_key, @ref parse.
+*/
+BOOST_JSON_DECL
+bool
+contains_string(
+    string_view doc,
+    string_view needle);
+
+/** Examine the start of a JSON text without parsing it.
+
+    This function inspects only the first few
+    tokens of `doc` and reports the kind of the
+    outermost value, the first object key, and a
+    projection of the outermost container's
+    element count, without building a @ref value
+    and without allocating. At most a small
+    fixed prefix of the text is read. Routers
+    which dispatch on document shape can consult
+    the result and reserve a full @ref parse for
+    the documents they actually handle.
+
+    Only enough of the text is validated to
+    classify it: `valid` is `false` when the
+    text cannot begin a standard JSON document,
+    and `true` otherwise, including for text
+    which is truncated or goes wrong past the
+    examined prefix. Comments and other
+    extensions are not recognized.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The kind, first key, and projected
+    size observed at the start of the text.
+
+    @param doc The serialized JSON text to
+    examine.
+
+    @see
+        @ref sniff_result,
+        @ref parse,
+        @ref validate.
+*/
+BOOST_JSON_DECL
+sniff_result
+sniff(string_view doc) noexcept;
+
+} // namespace json
+} // namespace boost
+
+#endif
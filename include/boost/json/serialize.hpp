@@ -11,6 +11,8 @@
 #define BOOST_JSON_SERIALIZE_HPP
 
 #include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/executor.hpp>
 #include <boost/json/serialize_options.hpp>
 #include <boost/json/value.hpp>
 #include <iosfwd>
@@ -60,6 +62,686 @@ std::string
 serialize(string_view t, serialize_options const& opts = {});
 /** @} */
 
+/** Serialize an element into a caller-provided string.
+
+    This function serializes `t` as JSON into
+    `dest`, replacing its previous contents. The
+    produced text is identical to that of
+    @ref serialize, but the output is a
+    @ref string whose memory comes from the
+    @ref memory_resource that `dest` was
+    constructed with, and whose capacity is
+    retained across calls. Reusing one output
+    string for a sequence of messages performs
+    no allocations once the string has grown to
+    the size of the largest message.
+
+    @par Preconditions
+
+    `dest` is not an element of `t`.
+
+    @par Complexity
+    Constant or linear in the size of `t`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to allocate may throw.
+
+    @param dest The string to write to. Any
+    contents are replaced.
+
+    @param t The value to serialize
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+
+    @see
+        @ref serialize,
+        @ref string.
+*/
+/** @{ */
+BOOST_JSON_DECL
+void
+serialize(
+    string& dest,
+    value const& t,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+void
+serialize(
+    string& dest,
+    array const& t,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+void
+serialize(
+    string& dest,
+    object const& t,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Return a serialized element, stopping at a byte budget.
+
+    This function serializes `t` as JSON like
+    @ref serialize, but stops as soon as the
+    output exceeds `limit` characters, setting
+    `ec` to @ref error::output_limit and
+    returning the characters produced so far,
+    which never number more than `limit`.
+    Serialization is abandoned at the point the
+    budget is reached, so the cost of rejecting
+    an oversized document is bounded by the
+    limit rather than by the size of the
+    document. On success the returned string is
+    identical to that of @ref serialize.
+
+    @par Complexity
+    Linear in `min( limit, serialized size )`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The serialized string, truncated
+    at `limit` characters if the budget was
+    exceeded.
+
+    @param t The value to serialize
+
+    @param limit The maximum number of
+    characters to produce.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::string
+serialize(
+    value const& t,
+    std::size_t limit,
+    error_code& ec,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+std::string
+serialize(
+    value const& t,
+    std::size_t limit,
+    std::error_code& ec,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Return a serialized element, stopping at a byte budget.
+
+    This function behaves identically to
+    @ref serialize(value const&,std::size_t,error_code&,serialize_options const&)
+    except that an exception is thrown when the
+    budget is exceeded, and the partial output
+    is discarded.
+
+    @par Exception Safety
+    Strong guarantee.
+    Throws @ref system_error when the output
+    exceeds `limit` characters.
+
+    @return The serialized string.
+
+    @param t The value to serialize
+
+    @param limit The maximum number of
+    characters to produce.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+BOOST_JSON_DECL
+std::string
+serialize(
+    value const& t,
+    std::size_t limit,
+    serialize_options const& opts = {});
+
+/** An abstract interface for consuming serialized output.
+
+    The sink overloads of @ref serialize produce
+    their text incrementally with
+    @ref serializer::read into a fixed stack
+    buffer and hand each chunk to the sink while
+    it is still warm in cache, instead of
+    materializing the whole document in memory
+    first. Implement this interface over any
+    streaming consumer — a compression context
+    such as deflate or zstd, a digest, a socket —
+    to process the serialized bytes as they are
+    emitted, touching them once.
+
+    This interface mirrors @ref executor:
+    callers use the public members,
+    implementations override the protected
+    virtual functions.
+
+    @par Example
+    @code
+    class deflate_sink : public serialize_sink
+    {
+        z_stream& zs_;
+
+        void do_write( char const* data, std::size_t size ) override
+        {
+            // feed the chunk to deflate()
+        }
+
+        void do_finish() override
+        {
+            // flush the stream with Z_FINISH
+        }
+
+    public:
+        explicit deflate_sink( z_stream& zs ) : zs_(zs) {}
+    };
+    @endcode
+
+    @see
+        @ref serialize,
+        @ref serializer.
+*/
+class serialize_sink
+{
+public:
+    virtual ~serialize_sink() = default;
+
+    /** Consume a chunk of serialized output.
+
+        Called repeatedly with consecutive
+        pieces of the serialized text.
+
+        @param data A pointer to the chunk.
+
+        @param size The size of the chunk.
+    */
+    void
+    write(
+        char const* data,
+        std::size_t size)
+    {
+        do_write(data, size);
+    }
+
+    /** Indicate the end of the output.
+
+        Called exactly once, after the last
+        chunk.
+    */
+    void
+    finish()
+    {
+        do_finish();
+    }
+
+protected:
+    /** Consume a chunk of serialized output.
+
+        @param data A pointer to the chunk.
+
+        @param size The size of the chunk.
+    */
+    virtual
+    void
+    do_write(
+        char const* data,
+        std::size_t size) = 0;
+
+    /** Indicate the end of the output.
+
+        The default implementation does nothing.
+    */
+    virtual
+    void
+    do_finish()
+    {
+    }
+};
+
+/** Serialize an element into a sink.
+
+    This function serializes `t` as JSON and
+    passes the text to `sink` in chunks of at
+    most `BOOST_JSON_STACK_BUFFER_SIZE`
+    characters as they are produced, followed by
+    one call to @ref serialize_sink::finish. The
+    produced text is identical to that of
+    @ref serialize, but no intermediate string
+    is built: each output byte is written once
+    into a stack buffer and consumed directly
+    from it.
+
+    @par Complexity
+    Constant or linear in the size of `t`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to allocate may throw.
+    Exceptions thrown by the sink are
+    propagated.
+
+    @param sink The sink to write to.
+
+    @param t The value to serialize
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+
+    @see
+        @ref serialize_sink.
+*/
+/** @{ */
+BOOST_JSON_DECL
+void
+serialize(
+    serialize_sink& sink,
+    value const& t,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+void
+serialize(
+    serialize_sink& sink,
+    array const& t,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+void
+serialize(
+    serialize_sink& sink,
+    object const& t,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Return the size of a serialized element.
+
+    This function measures `t` without producing
+    any output, returning the number of characters
+    which @ref serialize would emit. The result is
+    exact for strings and structural characters
+    and an upper bound for numbers and literals;
+    it is never less than the actual serialized
+    size. This may be used to size output buffers
+    in advance, and is used by @ref serialize to
+    reserve the output string exactly once.
+
+    @par Complexity
+    Linear in the size of `t`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return An upper bound on the serialized size,
+    in characters.
+
+    @param t The value to measure.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::size_t
+serialized_size(value const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+serialized_size(array const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+serialized_size(object const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+serialized_size(string const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+serialized_size(string_view t) noexcept;
+/** @} */
+
+/** Return the exact size of a serialized element.
+
+    This function measures `t` without producing
+    any output, returning exactly the number of
+    characters which @ref serialize would emit
+    for compact output. Unlike
+    @ref serialized_size, numbers are formatted
+    to count their digits rather than charged at
+    their maximum width, so the result can size a
+    fixed buffer with no slack and no fallback
+    path; formatting the digits makes this
+    measurement slower for number-heavy
+    documents.
+
+    The result covers compact output, which
+    includes text produced with
+    @ref serialize_options::canonical set:
+    reordering keys does not change the size.
+    The whitespace added by
+    @ref serialize_options::pretty is not
+    counted.
+
+    @par Complexity
+    Linear in the size of `t`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The serialized size, in characters.
+
+    @param t The value to measure.
+
+    @param opts The options the serialization
+    would use. Only options which affect the
+    produced characters, such as
+    @ref serialize_options::allow_infinity_and_nan,
+    influence the result.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::size_t
+exact_serialized_size(
+    value const& t,
+    serialize_options const& opts = {}) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+exact_serialized_size(
+    array const& t,
+    serialize_options const& opts = {}) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+exact_serialized_size(
+    object const& t,
+    serialize_options const& opts = {}) noexcept;
+/** @} */
+
+/** Return the worst-case size of a serialized element.
+
+    This function returns an upper bound on the
+    number of characters which @ref serialize
+    could emit for `t`, assuming every character
+    of every string requires the longest escape
+    sequence, six characters. Unlike
+    @ref serialized_size it does not examine
+    string contents, so the bound is computed
+    from element counts and string lengths alone;
+    this is the cheapest of the three
+    measurements and suits capacity planning,
+    where one buffer size must hold any document
+    of a given shape.
+
+    @par Complexity
+    Linear in the number of elements of `t`;
+    string contents are not read.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return An upper bound on the serialized
+    size, in characters.
+
+    @param t The value to measure.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::size_t
+max_serialized_size(value const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+max_serialized_size(array const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+max_serialized_size(object const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+max_serialized_size(string const& t) noexcept;
+
+BOOST_JSON_DECL
+std::size_t
+max_serialized_size(string_view t) noexcept;
+/** @} */
+
+/** Return a string representing a serialized element, using multiple threads.
+
+    This function serializes `t` as JSON and
+    returns it as a `std::string`, partitioning
+    the elements of a large array across worker
+    threads. Each worker serializes its range of
+    elements into a separately measured and
+    reserved segment, and the segments are then
+    concatenated. The produced text is identical
+    to that of @ref serialize.
+
+    Parallelism is only applied when `t` is an
+    array large enough to make the thread overhead
+    worthwhile; otherwise this function behaves
+    exactly like @ref serialize.
+
+    @par Complexity
+    Linear in the size of `t`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The serialized string
+
+    @param t The value to serialize
+
+    @param num_threads The maximum number of
+    threads to use, including the calling thread.
+    If this parameter is zero, the number of
+    hardware threads is used.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::string
+serialize_parallel(
+    value const& t,
+    std::size_t num_threads = 0,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+std::string
+serialize_parallel(
+    array const& t,
+    std::size_t num_threads = 0,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Return a string representing a serialized element, using an executor.
+
+    These overloads behave identically to the
+    overloads taking a thread count, except that
+    the segment serializations are submitted to
+    `ex` instead of transient threads of
+    execution, with the segment count chosen from
+    `ex.concurrency()`. Use this with a shared
+    @ref thread_pool to keep repeated
+    serializations from oversubscribing the
+    machine.
+
+    @par Complexity
+    Linear in the size of `t`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return The serialized string
+
+    @param t The value to serialize
+
+    @param ex The executor to run segment
+    serializations on.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+
+    @see
+        @ref executor,
+        @ref thread_pool.
+*/
+/** @{ */
+BOOST_JSON_DECL
+std::string
+serialize_parallel(
+    value const& t,
+    executor& ex,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+std::string
+serialize_parallel(
+    array const& t,
+    executor& ex,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Serialize an element into a file.
+
+    This function serializes `t` as JSON and
+    writes it to the file named by `path`,
+    creating or truncating it. The text is
+    produced incrementally with
+    @ref serializer::read into one of two
+    buffers while a dedicated thread writes the
+    other buffer to the file, so the CPU work of
+    escaping and formatting overlaps the disk
+    I/O instead of alternating with it. The
+    written text is identical to that of
+    @ref serialize. On systems without POSIX
+    file descriptors the output is written with
+    buffered I/O on the calling thread.
+
+    If an error occurs, the file may be left
+    partially written.
+
+    @par Complexity
+    Linear in the size of `t`.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to allocate may throw.
+
+    @param path The path of the file to write.
+
+    @param t The value to serialize.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+/** @{ */
+BOOST_JSON_DECL
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    error_code& ec,
+    serialize_options const& opts = {});
+
+BOOST_JSON_DECL
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    std::error_code& ec,
+    serialize_options const& opts = {});
+/** @} */
+
+/** Serialize an element into a file.
+
+    This function behaves identically to
+    @ref serialize_file(char const*,value const&,error_code&,serialize_options const&)
+    except that an exception is thrown on error.
+
+    @par Exception Safety
+    Basic guarantee.
+    Throws @ref system_error on failure.
+
+    @param path The path of the file to write.
+
+    @param t The value to serialize.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+BOOST_JSON_DECL
+void
+serialize_file(
+    char const* path,
+    value const& t,
+    serialize_options const& opts = {});
+
+/** Format a contiguous sequence of doubles as JSON numbers.
+
+    This function writes the shortest-round-trip
+    decimal representation of each element of
+    `values`, separated by `separator`, to the
+    memory pointed to by `dest`. No separator is
+    written after the last element. The output is
+    identical to serializing each value
+    individually, but the values are formatted in
+    one tight loop, which is considerably faster
+    for numeric columns.
+
+    @par Preconditions
+
+    `dest` points to valid memory of at least
+    `28 * count` characters; each formatted
+    number occupies at most 27 characters, plus
+    one for its separator.
+
+    @par Complexity
+    Linear in `count`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The number of characters written.
+
+    @param dest A pointer to the memory to write
+    to.
+
+    @param values A pointer to the first double
+    to format.
+
+    @param count The number of doubles to format.
+
+    @param separator The character written
+    between consecutive numbers.
+
+    @param opts The options for the formatting.
+    If this parameter is omitted, infinities and
+    NaNs are replaced as in standard JSON.
+*/
+BOOST_JSON_DECL
+std::size_t
+format_doubles(
+    char* dest,
+    double const* values,
+    std::size_t count,
+    char separator = ',',
+    serialize_options const& opts = {}) noexcept;
+
 } // namespace json
 } // namespace boost
 
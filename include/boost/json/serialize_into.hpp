@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SERIALIZE_INTO_HPP
+#define BOOST_JSON_SERIALIZE_INTO_HPP
+
+#include <boost/json/detail/config.hpp>
+
+#include <boost/json/serialize_options.hpp>
+#include <boost/json/detail/serialize_into.hpp>
+
+namespace boost {
+namespace json {
+
+/** Serialize a user-defined object directly into a sink.
+
+    This function walks `t` at compile time and
+    writes its JSON representation into `sink`,
+    without building an intermediate @ref value.
+    It is the write-side counterpart of
+    @ref parse_into: the member structure of
+    described classes, tuples, sequences, and
+    maps is turned directly into serialized text.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+
+    The function supports types satisfying
+    <a href="https://en.cppreference.com/w/cpp/named_req/SequenceContainer"><em>SequenceContainer</em></a>,
+    arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
+    `std::optional`, `std::nullptr_t`, and structs and enums described using
+    Boost.Describe. Library types, and types
+    which only provide a `tag_invoke` overload
+    for @ref value_from, are serialized through
+    the regular @ref serializer.
+
+    The produced text is identical to
+    `serialize( value_from( t ), opts )`.
+
+    @par Complexity
+    Linear in the size of the produced output.
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to `prepare` may throw.
+
+    @param sink The object to write to.
+
+    @param t The object to serialize.
+
+    @param opts The options for the serializer. If this parameter
+    is omitted, the serializer will output only standard JSON.
+*/
+template< class Sink, class T >
+void
+serialize_into(
+    Sink& sink,
+    T const& t,
+    serialize_options const& opts = {} )
+{
+    detail::sink_writer<Sink> w( sink, opts );
+    detail::serialize_into_impl( w, t );
+}
+
+} // namespace json
+} // namespace boost
+
+#endif
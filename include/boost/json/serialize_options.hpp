@@ -39,6 +39,80 @@ struct serialize_options
     */
     bool allow_infinity_and_nan = false;
 
+    /** Canonical output option
+
+        Write object members ordered by key
+        instead of by insertion, so that
+        semantically equal documents produce
+        byte-identical text regardless of the
+        order in which their members were
+        inserted or parsed. Keys are ordered
+        lexicographically by their bytes,
+        which for valid UTF-8 is Unicode code
+        point order, similar to the scheme of
+        RFC 8785. Numbers always use the
+        library's fixed, shortest round-trip
+        formatting, so no separate number mode
+        is needed.
+
+        The ordering is produced by sorting a
+        small index of pointers per object as
+        it is first visited; elements are not
+        copied and the object is not modified.
+        Canonical text is always compact:
+        @ref pretty is ignored when this
+        option is set.
+
+        @see
+            @ref serialize,
+            @ref serializer,
+            @ref sorted_view.
+    */
+    bool canonical = false;
+
+    /** Pretty-printed output option
+
+        Write a newline after every structural
+        element and indent nested containers, with
+        a single space after each colon. The
+        produced text parses back to the same
+        value. The default is compact output with
+        no added whitespace.
+
+        @see
+            @ref serialize,
+            @ref serializer.
+    */
+    bool pretty = false;
+
+    /** The number of spaces per indent level
+
+        This option has an effect only when
+        @ref pretty is `true`.
+    */
+    unsigned char indent_size = 4;
+
+    /** Cache formatted doubles option
+
+        When set, a @ref serializer remembers
+        the text of recently formatted `double`
+        values in a small, fixed-size table
+        keyed by their bit patterns, and a
+        repeated value is emitted with a copy
+        instead of running the full formatting
+        algorithm again. This helps documents
+        which repeat a modest set of doubles,
+        such as prices snapped to ticks; the
+        produced text is unchanged. The cache
+        belongs to the serializer and persists
+        across @ref serializer::reset, so a
+        reused serializer stays warm from one
+        document to the next. Values which
+        miss the cache pay a small bookkeeping
+        cost over the default.
+    */
+    bool cache_doubles = false;
+
     /** Set JSON serialization options on input stream.
         The function stores serialization options in the private storage of the
         stream. If the stream fails to allocate necessary private storage,
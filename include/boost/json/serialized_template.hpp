@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SERIALIZED_TEMPLATE_HPP
+#define BOOST_JSON_SERIALIZED_TEMPLATE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** A pre-serialized document with substitutable subtrees.
+
+    This class serializes a template @ref value
+    once, leaving holes at subtrees designated
+    by JSON Pointers. Rendering a document then
+    serializes only the per-request subtrees
+    and stitches them between the cached text
+    segments, instead of walking the entire
+    template again. When near-identical
+    documents differ in a few small subtrees,
+    this removes almost all of the repeated
+    serialization work.
+
+    The template value is fully copied into
+    text during construction and is not
+    referenced afterwards. Rendered output is
+    always compact, regardless of how the
+    substituted subtrees would serialize under
+    other options.
+
+    @par Example
+    @code
+    serialized_template st( tmpl,
+        { "/user/name", "/items" } );
+    std::string s = st.render(
+        { &name, &items } );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Const member functions of the
+    same instance may be called concurrently.
+
+    @see
+        @ref serializer,
+        @ref value::at_pointer.
+*/
+class serialized_template
+{
+    // literals_[i] precedes hole i in
+    // document order; the last element
+    // follows the final hole
+    std::vector<std::string> literals_;
+    // maps each hole, in document order, to
+    // the index of its designating pointer
+    std::vector<std::size_t> slot_;
+
+public:
+    /** Default constructor.
+
+        The template is empty, has no holes,
+        and renders an empty string.
+    */
+    serialized_template() = default;
+
+    /** Constructor.
+
+        The template is serialized immediately,
+        with a hole in place of each subtree
+        referenced by the pointers
+        `[first, first + n)`. Holes must refer
+        to distinct subtrees, and no hole may
+        lie inside another.
+
+        @par Complexity
+        Linear in the size of `jv`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param jv The template value. It is
+        copied into text and not referenced
+        after construction.
+
+        @param first A pointer to the first
+        JSON Pointer designating a hole.
+
+        @param n The number of holes.
+
+        @throw system_error A pointer could not
+        be resolved, or the designated holes
+        are not distinct, disjoint subtrees.
+    */
+    BOOST_JSON_DECL
+    serialized_template(
+        value const& jv,
+        string_view const* first,
+        std::size_t n);
+
+    /** Constructor.
+
+        @see
+            @ref serialized_template(value const&, string_view const*, std::size_t).
+    */
+    serialized_template(
+        value const& jv,
+        std::initializer_list<
+            string_view> pointers)
+        : serialized_template(jv,
+            pointers.begin(),
+            pointers.size())
+    {
+    }
+
+    /** Return the number of holes.
+    */
+    std::size_t
+    holes() const noexcept
+    {
+        return slot_.size();
+    }
+
+    /** Render the document with the given substitutions.
+
+        Each hole is filled with the compact
+        serialization of the value supplied for
+        the pointer which designated it:
+        `subs[i]` corresponds to the i-th
+        pointer given at construction.
+
+        @par Complexity
+        Linear in the size of the cached text
+        plus the sizes of the substituted
+        subtrees.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param subs A pointer to the first
+        substitution. The pointers must not
+        be null.
+
+        @param n The number of substitutions,
+        which must equal @ref holes.
+
+        @throw system_error `n != holes()`.
+    */
+    BOOST_JSON_DECL
+    std::string
+    render(
+        value const* const* subs,
+        std::size_t n) const;
+
+    /** Render the document with the given substitutions.
+
+        @see
+            @ref render(value const* const*, std::size_t).
+    */
+    std::string
+    render(std::initializer_list<
+        value const*> subs) const
+    {
+        return render(
+            subs.begin(), subs.size());
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
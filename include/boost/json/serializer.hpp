@@ -16,6 +16,7 @@
 #include <boost/json/detail/stream.hpp>
 #include <boost/json/serialize_options.hpp>
 #include <boost/json/value.hpp>
+#include <vector>
 
 namespace boost {
 namespace json {
@@ -57,6 +58,42 @@ namespace json {
 */
 class serializer
 {
+public:
+    /** A contiguous span of serialized output.
+
+        Scatter lists filled by @ref read_buffers
+        use this type to describe each segment of
+        output. The layout matches the POSIX
+        `iovec` structure, so a list of these may
+        be passed directly to gather-output
+        functions such as `writev`.
+    */
+    struct const_buffer
+    {
+        /// A pointer to the segment
+        void const* data;
+
+        /// The number of characters in the segment
+        std::size_t size;
+    };
+
+    /** A contiguous region of writable storage.
+
+        Sinks passed to @ref read_into return
+        this type from their `prepare` member
+        function to describe where the next
+        characters of output should be written.
+    */
+    struct mutable_buffer
+    {
+        /// A pointer to the region
+        void* data;
+
+        /// The number of writable characters in the region
+        std::size_t size;
+    };
+
+private:
     enum class state : char;
     // VFALCO Too many streams
     using stream = detail::stream;
@@ -81,21 +118,61 @@ class serializer
     detail::stack st_;
     const_stream cs0_;
     serialize_options opts_;
+    const_buffer* bufs_ = nullptr;
+    std::size_t bufs_cap_ = 0;
+    std::size_t bufs_n_ = 0;
+    char const* seg_ = nullptr;
+    std::size_t depth_ = 0;
+    std::size_t ind_rem_ = 0;
     char buf_[detail::max_number_chars + 1];
     bool done_ = false;
+    bool nl_ = false;
+    // the current string in cs0_ needs no
+    // escaping; the scan can be skipped
+    bool clean_ = false;
+    // the last read stopped part way through
+    // an unescaped run in cs0_; read_some
+    // resumes the copy directly instead of
+    // re-entering the state machine through
+    // every suspended frame
+    bool str_fast_ = false;
+    // key-ordered element pointers for the
+    // objects currently being written in
+    // canonical mode, innermost last
+    std::vector<key_value_pair const*> kidx_;
+
+    // a direct-mapped cache of formatted
+    // doubles keyed by their bit patterns,
+    // allocated on first use; see
+    // serialize_options::cache_doubles
+    struct double_cache_entry
+    {
+        std::uint64_t bits;
+        unsigned char size;
+        char text[detail::max_number_chars];
+    };
+    std::vector<double_cache_entry> dcache_;
 
+    inline unsigned fmt_double(
+        char* dest, double d);
+    inline void set_indent() noexcept;
+    inline bool write_indent(local_stream& ss);
     inline bool suspend(state st);
     inline bool suspend(
         state st, array::const_iterator it, array const* pa);
     inline bool suspend(
         state st, object::const_iterator it, object const* po);
+    inline bool suspend(
+        state st, std::size_t pos, std::size_t base, object const* po);
     template<bool StackEmpty> bool write_null   (stream& ss);
     template<bool StackEmpty> bool write_true   (stream& ss);
     template<bool StackEmpty> bool write_false  (stream& ss);
     template<bool StackEmpty> bool write_string (stream& ss);
     template<bool StackEmpty> bool write_number (stream& ss);
+    template<bool StackEmpty> bool write_raw    (stream& ss);
     template<bool StackEmpty> bool write_array  (stream& ss);
     template<bool StackEmpty> bool write_object (stream& ss);
+    template<bool StackEmpty> bool write_object_sorted(stream& ss);
     template<bool StackEmpty> bool write_value  (stream& ss);
     inline string_view read_some(char* dest, std::size_t size);
 
@@ -279,6 +356,62 @@ public:
     string_view
     read(char* dest, std::size_t size);
 
+    /** Read the next buffer of serialized JSON, with a work budget
+
+        This function behaves as the two-argument
+        overload, except that the amount of work
+        performed before returning is additionally
+        limited by `max_cost`. One unit of cost
+        corresponds to one character examined in
+        the value or appended to the buffer;
+        every state of the serializer consumes
+        input only in proportion to the output it
+        produces, so a call performs at most
+        `max_cost` units plus a small constant of
+        bookkeeping regardless of `size` and of
+        the content being serialized. This makes
+        the serializer cooperatively schedulable:
+        a latency-sensitive loop may emit a large
+        value in bounded slices without
+        thread-level preemption, even through
+        escape-heavy strings.
+
+        The returned view may be shorter than
+        both `size` and `max_cost`; call the
+        function again until @ref done returns
+        `true`.
+
+        @par Preconditions
+        @code
+        this->done() == false
+        @endcode
+
+        @par Complexity
+        Linear in `min( size, max_cost )`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @return A @ref string_view containing the
+        characters written.
+
+        @param dest A pointer to valid memory of at
+        least `size` bytes.
+
+        @param size The maximum number of characters
+        to write to the memory pointed to by `dest`.
+
+        @param max_cost The maximum number of cost
+        units to spend before returning.
+    */
+    BOOST_JSON_DECL
+    string_view
+    read(
+        char* dest,
+        std::size_t size,
+        std::size_t max_cost);
+
     /** Read the next buffer of serialized JSON
 
         This function allows reading into a
@@ -327,6 +460,144 @@ public:
         return read(dest, n);
     }
 #endif
+
+    /** Read the next segments of serialized JSON into a scatter list.
+
+        This function fills the caller provided
+        array of @ref const_buffer with segments
+        which, concatenated in order, form the next
+        portion of the serialized JSON. Long runs
+        of string characters which need no escaping
+        are referenced directly from the value's
+        own storage without being copied, while
+        structural characters, numbers, escapes,
+        and short runs are written to the memory
+        starting at `temp`. The filled scatter list
+        may be passed directly to a gather-output
+        function such as `writev`.
+
+        The function returns when either the
+        scatter list or the temporary buffer is
+        exhausted, or serialization completes;
+        call it again until @ref done returns
+        `true`.
+
+        Segments which reference the value's
+        storage are valid only as long as the
+        value is not modified or destroyed;
+        segments written to `temp` are valid until
+        the next read. Ownership is not
+        transferred.
+
+        @par Preconditions
+        @code
+        this->done() == false
+        @endcode
+
+        @par Complexity
+        Linear in the number of characters
+        produced.
+
+        @par Exception Safety
+        Basic guarantee.
+
+        @return The number of elements of
+        `buffers` which were filled.
+
+        @param buffers A pointer to an array of at
+        least `num_buffers` elements to be filled.
+
+        @param num_buffers The size of the array
+        pointed to by `buffers`.
+
+        @param temp A pointer to valid memory of
+        at least `temp_size` bytes, used to
+        materialize everything which is not
+        referenced in place. Must be at least one
+        byte.
+
+        @param temp_size The size of the memory
+        pointed to by `temp`.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    read_buffers(
+        const_buffer* buffers,
+        std::size_t num_buffers,
+        char* temp,
+        std::size_t temp_size);
+
+    /** Serialize the remaining output directly into a sink.
+
+        This function repeatedly obtains writable
+        storage from `sink`, fills it with
+        serialized JSON, and commits the
+        characters written, until serialization
+        is complete. The output is written in
+        place in the sink's own storage; no
+        intermediate buffer is used.
+\n
+        The type `Sink` must support these
+        expressions, where `sink` is an instance
+        of `Sink` and `n` has type `std::size_t`:
+
+        @code
+        mutable_buffer b = sink.prepare( n );
+        sink.commit( n );
+        @endcode
+
+        `prepare` returns a @ref mutable_buffer,
+        or another type with equivalent `data`
+        and `size` members, describing a region
+        of at least one writable character; `n`
+        is a non-binding hint of the preferred
+        size. `commit` appends the first `n`
+        characters of the most recently prepared
+        region to the sink's readable sequence.
+        Each prepared region is committed before
+        `prepare` is called again. This matches
+        the usage pattern of dynamic buffers and
+        ring buffers, which may be adapted
+        directly.
+
+        @par Preconditions
+        @code
+        this->done() == false
+        @endcode
+
+        @par Complexity
+        Linear in the number of characters
+        produced.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `prepare` may throw.
+
+        @return The total number of characters
+        committed to the sink.
+
+        @param sink The object to write to.
+    */
+    template<class Sink>
+    std::size_t
+    read_into(Sink& sink)
+    {
+        std::size_t total = 0;
+        do
+        {
+            auto const b =
+                sink.prepare(
+                    BOOST_JSON_STACK_BUFFER_SIZE);
+            BOOST_ASSERT(b.size > 0);
+            string_view const sv = read(
+                static_cast<char*>(b.data),
+                b.size);
+            sink.commit(sv.size());
+            total += sv.size();
+        }
+        while(! done());
+        return total;
+    }
 };
 
 } // namespace json
@@ -0,0 +1,444 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SHARED_VALUE_HPP
+#define BOOST_JSON_SHARED_VALUE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/value.hpp>
+#include <atomic>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+/** An immutable, reference-counted JSON document.
+
+    This container holds a read-only copy of a
+    @ref value in a private, reference-counted
+    memory arena. Copying a `shared_value` only
+    increments the reference count; the document
+    itself is shared, making copies suitable for
+    fanning one parsed document out to many
+    consumers without duplicating it:
+
+    @code
+    shared_value doc( parse( config ) );
+
+    for( auto& session : sessions )
+        session.set_config( doc );    // O(1) copy
+    @endcode
+
+    The shared document cannot be modified. A
+    consumer which needs to mutate its copy calls
+    @ref unshare, which produces an ordinary,
+    independent @ref value; this is the write half
+    of copy-on-write, performed at the granularity
+    of the whole document.
+
+    The arena and its reference count use
+    atomic operations; distinct `shared_value`
+    copies may be used from different threads
+    concurrently, as long as each individual copy
+    is confined to one thread at a time.
+
+    @par Thread Safety
+    Distinct copies may be accessed concurrently.
+*/
+class shared_value
+{
+    storage_ptr sp_;
+    value const* root_ = nullptr;
+
+public:
+    /** Default constructor.
+
+        A default-constructed `shared_value` holds
+        no document; @ref empty returns `true`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    shared_value() = default;
+
+    /** Construct a shared copy of a value.
+
+        A deep copy of `jv` is made into a new
+        reference-counted arena. The copy is
+        compact: containers are allocated at
+        exactly their size, and the document's
+        memory is packed in traversal order.
+
+        @par Complexity
+        Linear in the size of `jv`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param jv The value to copy.
+    */
+    BOOST_JSON_DECL
+    explicit
+    shared_value(value const& jv);
+
+    /** Copy constructor.
+
+        The document is shared; only the reference
+        count is adjusted.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    shared_value(
+        shared_value const&) = default;
+
+    /** Move constructor.
+
+        Ownership is transferred; `other` is left
+        empty.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    shared_value(
+        shared_value&& other) noexcept
+        : sp_(std::move(other.sp_))
+        , root_(detail::exchange(
+            other.root_, nullptr))
+    {
+    }
+
+    /** Copy assignment.
+
+        The document is shared; only reference
+        counts are adjusted.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    shared_value&
+    operator=(
+        shared_value const&) = default;
+
+    /** Move assignment.
+
+        Ownership is transferred; `other` is left
+        empty.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    shared_value&
+    operator=(
+        shared_value&& other) noexcept
+    {
+        sp_ = std::move(other.sp_);
+        root_ = detail::exchange(
+            other.root_, nullptr);
+        return *this;
+    }
+
+    /** Return `true` if no document is held.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    bool
+    empty() const noexcept
+    {
+        return root_ == nullptr;
+    }
+
+    /** Return the shared document.
+
+        @par Precondition
+        `empty() == false`
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    value const&
+    operator*() const noexcept
+    {
+        BOOST_ASSERT(root_);
+        return *root_;
+    }
+
+    /** Return a pointer to the shared document.
+
+        If @ref empty returns `true`, the
+        returned pointer is null.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    value const*
+    operator->() const noexcept
+    {
+        return root_;
+    }
+
+    /** Return a pointer to the shared document.
+
+        If @ref empty returns `true`, the
+        returned pointer is null.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    value const*
+    get() const noexcept
+    {
+        return root_;
+    }
+
+    /** Return an independent, mutable copy.
+
+        This makes a deep copy of the shared
+        document using the specified memory
+        resource; the shared document itself is
+        unchanged. This is the write operation of
+        copy-on-write: read access goes through
+        the shared document, and a consumer which
+        needs to modify it pays for its own copy
+        here.
+
+        @par Precondition
+        `empty() == false`
+
+        @par Complexity
+        Linear in the size of the document.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param sp A pointer to the @ref memory_resource
+        to use for the copy. The container will acquire
+        shared ownership of the memory resource.
+    */
+    value
+    unshare(storage_ptr sp = {}) const
+    {
+        BOOST_ASSERT(root_);
+        return value(*root_, std::move(sp));
+    }
+
+    /** Swap two shared values.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    void
+    swap(shared_value& other) noexcept
+    {
+        std::swap(sp_, other.sp_);
+        std::swap(root_, other.root_);
+    }
+
+    /** Swap two shared values.
+
+        @par Effects
+        @code
+        lhs.swap( rhs );
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    friend
+    void
+    swap(
+        shared_value& lhs,
+        shared_value& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+};
+
+//----------------------------------------------------------
+
+/** An atomically replaceable shared document.
+
+    This is a registry slot holding one
+    @ref shared_value which may be read and
+    replaced concurrently, without external
+    synchronization. It serves read-mostly
+    workloads where many threads consume a
+    document that is occasionally reloaded:
+
+    @code
+    atomic_shared_value slot;
+
+    // writer, on reload
+    slot.store( shared_value( parse( config ) ) );
+
+    // any reader, any thread
+    shared_value doc = slot.load();
+    @endcode
+
+    Readers never block and never wait for a
+    writer: @ref load performs a constant number
+    of atomic operations, retrying only when a
+    replacement lands between them. Writers are
+    serialized with each other, and @ref store
+    waits for readers still copying the previous
+    document before releasing it; replacement is
+    assumed to be rare next to reads.
+
+    Internally the slot keeps two generations of
+    the document and flips between them, so a
+    reader always copies from a side no writer is
+    modifying.
+
+    @par Thread Safety
+    All member functions may be called
+    concurrently from any thread.
+*/
+class atomic_shared_value
+{
+    shared_value docs_[2];
+    std::atomic<unsigned> cur_{0};
+    mutable std::atomic<
+        std::size_t> readers_[2]{{0}, {0}};
+    std::atomic<bool> busy_{false};
+
+public:
+    /** Default constructor.
+
+        The slot holds an empty
+        @ref shared_value.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    atomic_shared_value() = default;
+
+    /** Constructor.
+
+        The slot initially holds `sv`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sv The document to hold.
+    */
+    explicit
+    atomic_shared_value(
+        shared_value sv) noexcept
+    {
+        docs_[0] = std::move(sv);
+    }
+
+    /// The slot is not copyable.
+    atomic_shared_value(
+        atomic_shared_value const&) = delete;
+
+    /// The slot is not copyable.
+    atomic_shared_value&
+    operator=(
+        atomic_shared_value const&) = delete;
+
+    /** Return a copy of the current document.
+
+        The returned handle remains valid even if
+        the slot is replaced afterwards; it keeps
+        the document it refers to alive.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    shared_value
+    load() const noexcept;
+
+    /** Replace the current document.
+
+        Subsequent calls to @ref load return `sv`.
+        The previous document is released after
+        in-flight readers finish copying it;
+        copies they already obtained remain valid.
+
+        @par Complexity
+        Constant, plus waiting for concurrent
+        readers of the previous document.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sv The document to install.
+    */
+    BOOST_JSON_DECL
+    void
+    store(shared_value sv) noexcept;
+
+    /** Replace the current document, returning the old one.
+
+        Behaves as @ref store, except that the
+        previously held document is returned
+        instead of released.
+
+        @par Complexity
+        Constant, plus waiting for concurrent
+        readers of the previous document.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sv The document to install.
+
+        @return The previously held document.
+    */
+    BOOST_JSON_DECL
+    shared_value
+    exchange(shared_value sv) noexcept;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
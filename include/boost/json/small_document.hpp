@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SMALL_DOCUMENT_HPP
+#define BOOST_JSON_SMALL_DOCUMENT_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** A parsed JSON document with inline storage.
+
+    This class bundles a fixed-size buffer, a
+    @ref monotonic_resource using that buffer,
+    and a root @ref value allocated from the
+    resource into one object which can be placed
+    on the stack. Parsing a document whose values
+    fit in `Capacity` bytes performs no dynamic
+    allocations: the parser's temporary storage
+    lives on the stack, and the parsed values are
+    placed in the inline buffer. Documents which
+    exceed the capacity fail over cleanly; the
+    resource falls back to dynamic allocation and
+    the parse still succeeds.
+
+    The parsed values are owned by the document
+    and are destroyed with it. Reusing one
+    document for a sequence of messages amortizes
+    nothing further, but keeps the working set in
+    the same cache-resident buffer:
+
+    @par Example
+    @code
+    small_document< 4096 > doc;
+    for(;;)
+    {
+        string_view msg = read_message();
+        error_code ec;
+        value const& jv = doc.parse( msg, ec );
+        if( ec.failed() )
+            break;
+        handle( jv );
+    }
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Access to one instance and to
+    the values it owns is not thread-safe.
+
+    @tparam Capacity The size of the inline
+    buffer in bytes.
+
+    @see
+        @ref monotonic_resource,
+        @ref parse.
+*/
+template<std::size_t Capacity = 4096>
+class small_document
+{
+    unsigned char buf_[Capacity];
+    monotonic_resource mr_;
+    value jv_;
+
+public:
+    /// Copy constructor (deleted)
+    small_document(
+        small_document const&) = delete;
+
+    /// Copy assignment (deleted)
+    small_document& operator=(
+        small_document const&) = delete;
+
+    /** Constructor.
+
+        The document is created holding a null
+        value and an empty arena.
+    */
+    small_document() noexcept
+        : mr_(buf_, Capacity)
+        , jv_(storage_ptr(&mr_))
+    {
+    }
+
+    /** Parse a complete JSON text into the document.
+
+        The previous contents of the document,
+        if any, are destroyed and their storage
+        is reclaimed first. On success a
+        reference to the new root value is
+        returned; on failure `ec` is set and the
+        document holds a null value.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may
+        throw.
+
+        @return A reference to the root value,
+        valid until the next call to @ref parse
+        or @ref clear, or the document is
+        destroyed.
+
+        @param s The string to parse.
+
+        @param ec Set to the error, if any
+        occurred.
+
+        @param opt The options for the parser. If
+        this parameter is omitted, the parser
+        will accept only standard JSON.
+    */
+    /** @{ */
+    value const&
+    parse(
+        string_view s,
+        error_code& ec,
+        parse_options const& opt = {})
+    {
+        clear();
+        jv_ = json::parse(
+            s, ec, storage_ptr(&mr_), opt);
+        return jv_;
+    }
+
+    value const&
+    parse(
+        string_view s,
+        std::error_code& ec,
+        parse_options const& opt = {})
+    {
+        error_code jec;
+        value const& jv = parse(s, jec, opt);
+        ec = jec;
+        return jv;
+    }
+    /** @} */
+
+    /** Parse a complete JSON text into the document.
+
+        This overload behaves identically to the
+        overloads taking an error code, except
+        that a `boost::system::system_error` is
+        thrown on failure instead.
+
+        @return A reference to the root value.
+
+        @param s The string to parse.
+
+        @param opt The options for the parser. If
+        this parameter is omitted, the parser
+        will accept only standard JSON.
+
+        @throw system_error Thrown on failure.
+    */
+    value const&
+    parse(
+        string_view s,
+        parse_options const& opt = {})
+    {
+        error_code ec;
+        parse(s, ec, opt);
+        if(ec)
+            detail::throw_system_error( ec );
+        return jv_;
+    }
+
+    /** Return the root value.
+
+        If no document has been parsed, or the
+        last parse failed, the root is null.
+    */
+    value const&
+    root() const noexcept
+    {
+        return jv_;
+    }
+
+    /** Return a pointer to the document's memory resource.
+    */
+    storage_ptr
+    storage() noexcept
+    {
+        return storage_ptr(&mr_);
+    }
+
+    /** Destroy the contents and reclaim the arena.
+
+        The document holds a null value
+        afterwards. All previously returned
+        references are invalidated.
+    */
+    void
+    clear() noexcept
+    {
+        jv_.emplace_null();
+        mr_.release();
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SNAPSHOT_HPP
+#define BOOST_JSON_SNAPSHOT_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <iosfwd>
+
+namespace boost {
+namespace json {
+
+/** Write a binary snapshot of a value.
+
+    This function writes a versioned binary image
+    of `jv` to `os`. The image is a flat, pre-order
+    tape of the value's tree: every item is stored
+    with a one-byte tag followed by fixed-width
+    native-endian payloads, and container items
+    carry their element counts so that a later
+    load can size each container exactly once.
+    The result can be reloaded with
+    @ref load_snapshot without any text parsing,
+    number conversion, or validation of string
+    contents, which makes reloading large
+    documents much faster than @ref parse.
+
+    Snapshots record the endianness of the writing
+    host and are refused by @ref load_snapshot on
+    a mismatched host; they are a caching format,
+    not an interchange format. Use
+    @ref serialize_cbor for portable binary
+    interchange.
+
+    Errors are reported by setting the stream
+    state, as with any other stream output.
+
+    @par Complexity
+    Linear in the size of the serialized output.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @param jv The value to write.
+
+    @param os The stream to write to.
+
+    @see
+        @ref load_snapshot,
+        @ref serialize_cbor.
+*/
+BOOST_JSON_DECL
+void
+save_snapshot(
+    value const& jv,
+    std::ostream& os);
+
+/** Return a value loaded from a binary snapshot.
+
+    This function reconstructs a @ref value from
+    a buffer previously produced by
+    @ref save_snapshot; the buffer is typically a
+    memory-mapped snapshot file. The load is a
+    single linear pass over the tape with bulk
+    copies for string contents. Input which is
+    truncated, holds trailing data, or was written
+    with a different format version or on a host
+    of different endianness results in an error.
+
+    Values nested more than 32 levels deep fail
+    with @ref error::too_deep, mirroring the
+    default @ref parse_options::max_depth.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to `memory_resource::allocate` may throw.
+
+    @return A value holding the loaded result,
+    or null if any error occurred.
+
+    @param s The buffer to read.
+
+    @param ec Set to the error, if any occurred.
+
+    @param sp The memory resource that the new
+    value and all of its elements will use. If
+    this parameter is omitted, the default memory
+    resource is used.
+
+    @see
+        @ref save_snapshot.
+*/
+/** @{ */
+BOOST_JSON_DECL
+value
+load_snapshot(
+    string_view s,
+    error_code& ec,
+    storage_ptr sp = {});
+
+BOOST_JSON_DECL
+value
+load_snapshot(
+    string_view s,
+    std::error_code& ec,
+    storage_ptr sp = {});
+/** @} */
+
+/** Return a value loaded from a binary snapshot.
+
+    This overload behaves identically to the
+    overloads taking an error code, except that a
+    `boost::system::system_error` is thrown on
+    failure instead.
+
+    @return A value holding the loaded result.
+
+    @param s The buffer to read.
+
+    @param sp The memory resource that the new
+    value and all of its elements will use. If
+    this parameter is omitted, the default memory
+    resource is used.
+
+    @throw system_error Thrown on failure.
+*/
+BOOST_JSON_DECL
+value
+load_snapshot(
+    string_view s,
+    storage_ptr sp = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,422 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_SORTED_VIEW_HPP
+#define BOOST_JSON_SORTED_VIEW_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** A key-ordered index over the elements of an object.
+
+    This class holds the elements of an
+    @ref object sorted by key, as an index of
+    pointers into the object's own storage; the
+    values themselves are not copied. Lookups
+    use a binary search whose inner loop
+    compiles to a conditional move rather than
+    a branch, and the ordering enables queries
+    a hash table cannot answer: @ref lower_bound,
+    @ref equal_range, and @ref prefix_range for
+    key schemes with range semantics, such as
+    time-bucketed keys. Building the view costs
+    one sort; each query is then logarithmic,
+    with no per-query allocation.
+
+    The view does not own the object. The
+    object must outlive the view, and any
+    operation which adds, removes, or reorders
+    elements of the object invalidates it.
+
+    @par Example
+    @code
+    sorted_view sv( obj );
+    auto const r = sv.prefix_range( "2024-01-" );
+    for( auto it = r.first; it != r.second; ++it )
+        f( it->key(), it->value() );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Const member functions of the
+    same instance may be called concurrently.
+
+    @see
+        @ref object.
+*/
+class sorted_view
+{
+    std::vector<
+        key_value_pair const*> idx_;
+
+public:
+    /** A random access iterator to an element.
+
+        Dereferencing yields the
+        @ref key_value_pair in the underlying
+        object; iteration order is ascending
+        by key.
+    */
+    class const_iterator
+    {
+        key_value_pair const* const* p_;
+
+        friend class sorted_view;
+
+        explicit
+        const_iterator(
+            key_value_pair
+                const* const* p) noexcept
+            : p_(p)
+        {
+        }
+
+    public:
+        using value_type = key_value_pair;
+        using reference =
+            key_value_pair const&;
+        using pointer =
+            key_value_pair const*;
+        using difference_type =
+            std::ptrdiff_t;
+        using iterator_category =
+            std::random_access_iterator_tag;
+
+        const_iterator() noexcept
+            : p_(nullptr)
+        {
+        }
+
+        reference
+        operator*() const noexcept
+        {
+            return **p_;
+        }
+
+        pointer
+        operator->() const noexcept
+        {
+            return *p_;
+        }
+
+        reference
+        operator[](
+            difference_type n) const noexcept
+        {
+            return *p_[n];
+        }
+
+        const_iterator&
+        operator++() noexcept
+        {
+            ++p_;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) noexcept
+        {
+            auto it = *this;
+            ++p_;
+            return it;
+        }
+
+        const_iterator&
+        operator--() noexcept
+        {
+            --p_;
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) noexcept
+        {
+            auto it = *this;
+            --p_;
+            return it;
+        }
+
+        const_iterator&
+        operator+=(
+            difference_type n) noexcept
+        {
+            p_ += n;
+            return *this;
+        }
+
+        const_iterator&
+        operator-=(
+            difference_type n) noexcept
+        {
+            p_ -= n;
+            return *this;
+        }
+
+        friend
+        const_iterator
+        operator+(
+            const_iterator it,
+            difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend
+        const_iterator
+        operator-(
+            const_iterator it,
+            difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend
+        difference_type
+        operator-(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ - b.p_;
+        }
+
+        friend
+        bool
+        operator==(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ == b.p_;
+        }
+
+        friend
+        bool
+        operator!=(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ != b.p_;
+        }
+
+        friend
+        bool
+        operator<(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ < b.p_;
+        }
+
+        friend
+        bool
+        operator<=(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ <= b.p_;
+        }
+
+        friend
+        bool
+        operator>(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ > b.p_;
+        }
+
+        friend
+        bool
+        operator>=(
+            const_iterator a,
+            const_iterator b) noexcept
+        {
+            return a.p_ >= b.p_;
+        }
+    };
+
+    /** Default constructor.
+
+        The view indexes no elements.
+    */
+    sorted_view() = default;
+
+    /** Constructor.
+
+        The view indexes every element of `obj`
+        in ascending key order. Elements with
+        equal keys, which an object may hold
+        when parsed with a permissive duplicate
+        key policy, keep their insertion order
+        relative to each other.
+
+        @par Complexity
+        `O(N log N)` where
+        `N == obj.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param obj The object to index, which
+        must outlive the view and not be
+        modified while the view is in use.
+    */
+    BOOST_JSON_DECL
+    explicit
+    sorted_view(object const& obj);
+
+    /** Return the number of indexed elements.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return idx_.size();
+    }
+
+    /** Return true if no elements are indexed.
+    */
+    bool
+    empty() const noexcept
+    {
+        return idx_.empty();
+    }
+
+    /** Return an iterator to the first element, by key order.
+    */
+    const_iterator
+    begin() const noexcept
+    {
+        return const_iterator(idx_.data());
+    }
+
+    /** Return an iterator to one past the last element.
+    */
+    const_iterator
+    end() const noexcept
+    {
+        return const_iterator(
+            idx_.data() + idx_.size());
+    }
+
+    /** Return the first element whose key is not less than `key`.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    BOOST_JSON_DECL
+    const_iterator
+    lower_bound(
+        string_view key) const noexcept;
+
+    /** Return the first element whose key is greater than `key`.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    BOOST_JSON_DECL
+    const_iterator
+    upper_bound(
+        string_view key) const noexcept;
+
+    /** Return the range of elements whose key equals `key`.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    std::pair<
+        const_iterator, const_iterator>
+    equal_range(
+        string_view key) const noexcept
+    {
+        return {
+            lower_bound(key),
+            upper_bound(key) };
+    }
+
+    /** Return an iterator to the element with `key`, or `end()`.
+
+        If more than one element matches, the
+        first in key order is returned.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    BOOST_JSON_DECL
+    const_iterator
+    find(string_view key) const noexcept;
+
+    /** Return true if an element with `key` exists.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to search for.
+    */
+    bool
+    contains(
+        string_view key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    /** Return the range of elements whose key begins with `prefix`.
+
+        @par Complexity
+        `O(log(size()))`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param prefix The key prefix to
+        search for. An empty prefix matches
+        every element.
+    */
+    BOOST_JSON_DECL
+    std::pair<
+        const_iterator, const_iterator>
+    prefix_range(
+        string_view prefix) const noexcept;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
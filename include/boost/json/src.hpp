@@ -29,26 +29,65 @@ in a translation unit of the program.
 #include <boost/json/detail/config.hpp>
 
 #include <boost/json/impl/array.ipp>
+#include <boost/json/impl/big_number.ipp>
+#include <boost/json/impl/cbor.ipp>
+#include <boost/json/impl/compare.ipp>
+#include <boost/json/impl/disposer.ipp>
 #include <boost/json/impl/error.ipp>
+#include <boost/json/impl/escape.ipp>
+#include <boost/json/impl/estimate.ipp>
+#include <boost/json/impl/executor.ipp>
 #include <boost/json/impl/kind.ipp>
+#include <boost/json/impl/lazy_value.ipp>
+#include <boost/json/impl/literals.ipp>
+#include <boost/json/impl/metrics.ipp>
 #include <boost/json/impl/monotonic_resource.ipp>
+#include <boost/json/impl/msgpack.ipp>
+#include <boost/json/impl/ndjson.ipp>
 #include <boost/json/impl/null_resource.ipp>
+#include <boost/json/impl/number_array.ipp>
 #include <boost/json/impl/object.ipp>
+#include <boost/json/impl/packed_value.ipp>
 #include <boost/json/impl/parse.ipp>
+#include <boost/json/impl/parse_batch.ipp>
+#include <boost/json/impl/parse_numbers.ipp>
+#include <boost/json/impl/parse_options.ipp>
+#include <boost/json/impl/parse_parallel.ipp>
 #include <boost/json/impl/parser.ipp>
+#include <boost/json/impl/patch.ipp>
+#include <boost/json/impl/path_query.ipp>
 #include <boost/json/impl/pointer.ipp>
+#include <boost/json/impl/pooled_resource.ipp>
+#include <boost/json/impl/reformat.ipp>
+#include <boost/json/impl/reparse.ipp>
+#include <boost/json/impl/reserved_resource.ipp>
+#include <boost/json/impl/scan.ipp>
 #include <boost/json/impl/serialize.ipp>
+#include <boost/json/impl/serialized_template.ipp>
 #include <boost/json/impl/serializer.ipp>
+#include <boost/json/impl/shared_value.ipp>
+#include <boost/json/impl/snapshot.ipp>
+#include <boost/json/impl/sorted_view.ipp>
 #include <boost/json/impl/static_resource.ipp>
+#include <boost/json/impl/stream_extractor.ipp>
 #include <boost/json/impl/stream_parser.ipp>
 #include <boost/json/impl/string.ipp>
+#include <boost/json/impl/string_builder.ipp>
+#include <boost/json/impl/string_table.ipp>
+#include <boost/json/impl/thread_local_resource.ipp>
+#include <boost/json/impl/trace.ipp>
+#include <boost/json/impl/tracing_resource.ipp>
+#include <boost/json/impl/unescape.ipp>
+#include <boost/json/impl/validate.ipp>
 #include <boost/json/impl/value.ipp>
 #include <boost/json/impl/value_stack.ipp>
+#include <boost/json/impl/value_transaction.ipp>
 #include <boost/json/impl/value_ref.ipp>
 
 #include <boost/json/detail/impl/shared_resource.ipp>
 #include <boost/json/detail/impl/default_resource.ipp>
 #include <boost/json/detail/impl/except.ipp>
+#include <boost/json/detail/impl/fast_parser.ipp>
 #include <boost/json/detail/impl/format.ipp>
 #include <boost/json/detail/impl/handler.ipp>
 #include <boost/json/detail/impl/stack.ipp>
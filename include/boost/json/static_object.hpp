@@ -0,0 +1,419 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_STATIC_OBJECT_HPP
+#define BOOST_JSON_STATIC_OBJECT_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/detail/digest.hpp>
+#include <boost/json/detail/except.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+
+// lowest power of 2 greater than or equal
+// to n, computable in an array bound
+constexpr
+std::size_t
+static_object_table_size(
+    std::size_t m, std::size_t n)
+{
+    return m >= n ? m :
+        static_object_table_size(m * 2, n);
+}
+
+} // namespace detail
+
+/** An object whose keys are fixed at compile time.
+
+    This class holds one @ref value for each key
+    of a schema known when the program is built,
+    in a flat array with no separate element
+    table and no per-element allocation. Lookup
+    by key consults a perfect hash table
+    constructed once per schema: a key is hashed
+    with a salt chosen so that every key of the
+    schema lands in its own slot, so exactly one
+    candidate is compared, with no probing. This
+    is faster than @ref object::find for the
+    common case of building or reading messages
+    whose layout never varies at runtime.
+
+    The schema is supplied as a type with the
+    following members, where the keys must be
+    distinct:
+
+    @code
+    struct person_schema
+    {
+        static constexpr std::size_t count = 3;
+
+        static string_view key( std::size_t i ) noexcept
+        {
+            static constexpr char const* k[] = {
+                "id", "name", "email" };
+            return k[ i ];
+        }
+    };
+    @endcode
+
+    Every key of the schema is always present,
+    with unset members holding null. The order
+    of the schema is the order of serialization
+    produced by @ref to_object.
+
+    @par Example
+    @code
+    static_object< person_schema > p;
+    p.at( "id" ) = 42;
+    p.at( "name" ) = "John Doe";
+    std::string s = serialize( p.to_object() );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently; the shared hash table is
+    built under a thread-safe initializer.
+
+    @tparam Schema The type describing the keys.
+
+    @see
+        @ref object,
+        @ref value.
+*/
+template<class Schema>
+class static_object
+{
+    BOOST_STATIC_ASSERT(Schema::count >= 1);
+    BOOST_STATIC_ASSERT(Schema::count <= 64);
+
+    struct slot_table
+    {
+        std::size_t salt;
+        unsigned char slot[
+            detail::static_object_table_size(
+                16, 8 * Schema::count)];
+    };
+
+    value vals_[Schema::count];
+
+public:
+    /// The index returned when a key is not in the schema
+    static constexpr std::size_t npos =
+        std::size_t(-1);
+
+    /** Constructor.
+
+        The object is created with all members
+        null, using the given or the default
+        memory resource.
+
+        @param sp A pointer to the
+        @ref memory_resource to use.
+    */
+    /** @{ */
+    static_object() = default;
+
+    explicit
+    static_object(storage_ptr sp)
+        : static_object(sp,
+            mp11::make_index_sequence<
+                Schema::count>())
+    {
+    }
+    /** @} */
+
+    /** Return the number of keys in the schema.
+    */
+    static
+    constexpr
+    std::size_t
+    size() noexcept
+    {
+        return Schema::count;
+    }
+
+    /** Return the key at an index.
+
+        @par Preconditions
+        `i < size()`
+
+        @param i The index of the key.
+    */
+    static
+    string_view
+    key(std::size_t i) noexcept
+    {
+        BOOST_ASSERT(i < Schema::count);
+        return Schema::key(i);
+    }
+
+    /** Return the index of a key, or @ref npos.
+
+        This performs the perfect-hash lookup:
+        one salted hash of `key` selects the
+        only slot which can hold it, and one
+        comparison confirms it.
+
+        @par Complexity
+        Linear in the size of `key`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to look for.
+    */
+    static
+    std::size_t
+    index_of(string_view key) noexcept
+    {
+        slot_table const& t = table();
+        std::size_t const h = detail::digest(
+            key.data(),
+            key.data() + key.size(), t.salt);
+        unsigned char const i = t.slot[
+            h & (sizeof(t.slot) - 1)];
+        if( i != 0xff &&
+            key == Schema::key(i))
+            return i;
+        return npos;
+    }
+
+    /** Return the value at an index.
+
+        @par Preconditions
+        `i < size()`
+
+        @param i The index of the member.
+    */
+    /** @{ */
+    value&
+    item(std::size_t i) noexcept
+    {
+        BOOST_ASSERT(i < Schema::count);
+        return vals_[i];
+    }
+
+    value const&
+    item(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < Schema::count);
+        return vals_[i];
+    }
+    /** @} */
+
+    /** Return the value for a key.
+
+        @par Complexity
+        Linear in the size of `key`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param key The key to look for.
+
+        @throw system_error `key` is not a key
+        of the schema.
+    */
+    /** @{ */
+    value&
+    at(string_view key)
+    {
+        auto const i = index_of(key);
+        if(i == npos)
+        {
+            BOOST_STATIC_CONSTEXPR source_location loc
+                = BOOST_CURRENT_LOCATION;
+            detail::throw_system_error(
+                error::out_of_range, &loc );
+        }
+        return vals_[i];
+    }
+
+    value const&
+    at(string_view key) const
+    {
+        auto const i = index_of(key);
+        if(i == npos)
+        {
+            BOOST_STATIC_CONSTEXPR source_location loc
+                = BOOST_CURRENT_LOCATION;
+            detail::throw_system_error(
+                error::out_of_range, &loc );
+        }
+        return vals_[i];
+    }
+    /** @} */
+
+    /** Return a pointer to the value for a key, or null.
+
+        @par Complexity
+        Linear in the size of `key`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key The key to look for.
+    */
+    /** @{ */
+    value*
+    if_contains(string_view key) noexcept
+    {
+        auto const i = index_of(key);
+        if(i == npos)
+            return nullptr;
+        return &vals_[i];
+    }
+
+    value const*
+    if_contains(string_view key) const noexcept
+    {
+        auto const i = index_of(key);
+        if(i == npos)
+            return nullptr;
+        return &vals_[i];
+    }
+    /** @} */
+
+    /** Copy the members of an object into this.
+
+        Members of `obj` whose keys are not in
+        the schema are ignored; keys of the
+        schema missing from `obj` are set to
+        null.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param obj The object to copy from.
+    */
+    void
+    assign(object const& obj)
+    {
+        for(auto& v : vals_)
+            v.emplace_null();
+        for(auto const& kv : obj)
+        {
+            auto const i =
+                index_of(kv.key());
+            if(i != npos)
+                vals_[i] = kv.value();
+        }
+    }
+
+    /** Return the members as an @ref object.
+
+        The members appear in schema order,
+        including null members.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param sp A pointer to the
+        @ref memory_resource to use for the
+        returned object.
+    */
+    object
+    to_object(storage_ptr sp = {}) const
+    {
+        object obj(std::move(sp));
+        obj.reserve(Schema::count);
+        for(std::size_t i = 0;
+            i < Schema::count; ++i)
+            obj.emplace(
+                Schema::key(i), vals_[i]);
+        return obj;
+    }
+
+private:
+    template<std::size_t... I>
+    explicit
+    static_object(
+        storage_ptr const& sp,
+        mp11::index_sequence<I...>)
+        : vals_{ value(((void)I, sp))... }
+    {
+    }
+
+    // chooses the smallest salt for which no
+    // two keys of the schema share a slot; at
+    // most half the slots are occupied, so a
+    // suitable salt is found after a handful
+    // of attempts
+    static
+    slot_table
+    build_table() noexcept
+    {
+        slot_table t;
+        for(t.salt = 0;; ++t.salt)
+        {
+            std::memset(t.slot, 0xff,
+                sizeof(t.slot));
+            bool ok = true;
+            for(std::size_t i = 0;
+                i < Schema::count; ++i)
+            {
+                string_view const k =
+                    Schema::key(i);
+                auto& s = t.slot[
+                    detail::digest(
+                        k.data(),
+                        k.data() + k.size(),
+                        t.salt) &
+                    (sizeof(t.slot) - 1)];
+                if(s != 0xff)
+                {
+                    // distinct keys are a
+                    // precondition; a repeated
+                    // key collides under every
+                    // salt
+                    BOOST_ASSERT(
+                        Schema::key(s) != k);
+                    ok = false;
+                    break;
+                }
+                s = static_cast<
+                    unsigned char>(i);
+            }
+            if(ok)
+                return t;
+        }
+    }
+
+    static
+    slot_table const&
+    table() noexcept
+    {
+        static slot_table const t =
+            build_table();
+        return t;
+    }
+};
+
+template<class Schema>
+constexpr
+std::size_t
+static_object<Schema>::npos;
+
+} // namespace json
+} // namespace boost
+
+#endif
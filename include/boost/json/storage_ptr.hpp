@@ -22,6 +22,14 @@
 namespace boost {
 namespace json {
 
+class storage_ptr;
+
+namespace detail {
+storage_ptr
+unowned_alias(
+    storage_ptr const& sp) noexcept;
+} // detail
+
 /** A smart pointer to a @ref memory_resource
 
     This container is used to hold a pointer to a memory resource. The
@@ -82,6 +90,10 @@ class storage_ptr
 #ifndef BOOST_JSON_DOCS
     // VFALCO doc toolchain shows this when it shouldn't
     friend struct detail::shared_resource;
+    friend
+    storage_ptr
+    detail::unowned_alias(
+        storage_ptr const& sp) noexcept;
 #endif
     using shared_resource =
         detail::shared_resource;
@@ -103,8 +115,16 @@ class storage_ptr
     addref() const noexcept
     {
         if(is_shared())
-            get_shared()->refs.fetch_add(
-                1, std::memory_order_relaxed);
+        {
+            auto const p = get_shared();
+            if(p->unsync)
+                p->refs.store(p->refs.load(
+                    std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+            else
+                p->refs.fetch_add(1,
+                    std::memory_order_relaxed);
+        }
     }
 
     void
@@ -113,7 +133,17 @@ class storage_ptr
         if(is_shared())
         {
             auto const p = get_shared();
-            if(p->refs.fetch_sub(1,
+            if(p->unsync)
+            {
+                auto const n = p->refs.load(
+                    std::memory_order_relaxed);
+                if(n == 1)
+                    delete p;
+                else
+                    p->refs.store(n - 1,
+                        std::memory_order_relaxed);
+            }
+            else if(p->refs.fetch_sub(1,
                     std::memory_order_acq_rel) == 1)
                 delete p;
         }
@@ -457,8 +487,33 @@ public:
     friend
     storage_ptr
     make_shared_resource(Args&&... args);
+
+    template<class U, class... Args>
+    friend
+    storage_ptr
+    make_shared_resource_unsync(Args&&... args);
 };
 
+namespace detail {
+
+// Return a non-owning pointer to the resource
+// referenced by sp, preserving the trivial
+// deallocate property. Used where many copies
+// of a shared pointer would otherwise maintain
+// the reference count, with the owning copy
+// held elsewhere.
+inline
+storage_ptr
+unowned_alias(
+    storage_ptr const& sp) noexcept
+{
+    storage_ptr r;
+    r.i_ = sp.i_ & ~std::uintptr_t(1);
+    return r;
+}
+
+} // detail
+
 #if defined(_MSC_VER)
 # pragma warning( push )
 # if !defined(__clang__) && _MSC_VER <= 1900
@@ -504,6 +559,52 @@ make_shared_resource(Args&&... args)
 # pragma warning( pop )
 #endif
 
+/** Return unsynchronized shared ownership of a new memory resource.
+
+    This function behaves like @ref make_shared_resource,
+    except that the reference count of the returned
+    resource is adjusted without atomic instructions.
+    This removes the cost of interlocked operations when
+    values sharing the resource are copied frequently in
+    a pipeline confined to one thread.
+
+    All copies of the returned @ref storage_ptr, and all
+    containers holding such copies, must be accessed from
+    a single thread at a time; otherwise the behavior is
+    undefined. When ownership may cross threads, use
+    @ref make_shared_resource instead.
+
+    @par Mandates
+    @code
+    std::is_base_of< memory_resource, U >::value == true
+    @endcode
+
+    @par Complexity
+    Same as `new U( std::forward<Args>(args)... )`.
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @tparam U The type of memory resource to create.
+
+    @param args Parameters forwarded to the constructor of `U`.
+*/
+template<class U, class... Args>
+storage_ptr
+make_shared_resource_unsync(Args&&... args)
+{
+    // If this generates an error, it means that
+    // `T` is not a memory resource.
+    BOOST_STATIC_ASSERT(
+        std::is_base_of<
+            memory_resource, U>::value);
+    auto const p = new
+        detail::shared_resource_impl<U>(
+            std::forward<Args>(args)...);
+    p->unsync = true;
+    return storage_ptr(p);
+}
+
 /** Return true if two storage pointers point to the same memory resource.
 
     This function returns `true` if the @ref memory_resource
@@ -0,0 +1,356 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_STREAM_EXTRACTOR_HPP
+#define BOOST_JSON_STREAM_EXTRACTOR_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/basic_parser.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+namespace detail {
+
+// handler for basic_parser which matches the
+// document against registered JSON Pointers
+// and reports matching scalar leaves, keeping
+// no value_stack and skipping subtrees which
+// cannot contain a match.
+class extract_handler
+{
+public:
+    /// The type of callback invoked for each match
+    typedef void (*callback_type)(
+        void* user,
+        std::size_t path,
+        value const& jv);
+
+    static constexpr std::size_t
+        max_object_size = object::max_size();
+
+    static constexpr std::size_t
+        max_array_size = array::max_size();
+
+    static constexpr std::size_t
+        max_key_size = string::max_size();
+
+    static constexpr std::size_t
+        max_string_size = string::max_size();
+
+private:
+    // match progress for a path which can no
+    // longer match at or below this point
+    static constexpr std::size_t
+        dead_ = std::size_t(-1);
+
+    struct segment
+    {
+        // unescaped token text
+        std::string token;
+
+        // parsed array index, or dead_ when
+        // the token is not a valid index
+        std::size_t index;
+    };
+
+    struct path
+    {
+        std::vector<segment> segs;
+    };
+
+    struct frame
+    {
+        // index of the next element, for
+        // array containers
+        std::size_t index;
+
+        bool is_object;
+    };
+
+    std::vector<path> paths_;
+    callback_type cb_ = nullptr;
+    void* user_ = nullptr;
+
+    std::vector<frame> stack_;
+
+    // one progress entry per path and open
+    // container; the last paths_.size()
+    // entries are the current row
+    std::vector<std::size_t> rows_;
+
+    // progress of the value about to begin
+    std::vector<std::size_t> pending_;
+
+    // key and matched string accumulators,
+    // for input split across buffers
+    std::string key_;
+    std::string sbuf_;
+
+    // pending_ has been computed for the
+    // current value
+    bool entered_ = false;
+
+    // some entry of pending_ is a full match
+    bool any_hit_ = false;
+
+    inline void pend_key(
+        string_view key) noexcept;
+    inline void pend_index(
+        std::size_t index) noexcept;
+    inline void enter() noexcept;
+    inline bool leaf(value const& jv);
+    inline parse_directive begin_container(
+        bool is_object);
+    inline void end_container() noexcept;
+
+public:
+    extract_handler() = default;
+
+    inline std::size_t add(
+        string_view ptr, error_code& ec);
+    inline void start(
+        callback_type cb, void* user) noexcept;
+
+    std::size_t
+    count() const noexcept
+    {
+        return paths_.size();
+    }
+
+    inline bool on_document_begin(error_code& ec);
+    inline bool on_document_end(error_code& ec);
+    inline parse_directive on_object_begin(error_code& ec);
+    inline bool on_object_end(std::size_t n, error_code& ec);
+    inline parse_directive on_array_begin(error_code& ec);
+    inline bool on_array_end(std::size_t n, error_code& ec);
+    inline bool on_key_part(string_view s, std::size_t n, error_code& ec);
+    inline parse_directive on_key(string_view s, std::size_t n, error_code& ec);
+    inline bool on_string_part(string_view s, std::size_t n, error_code& ec);
+    inline bool on_string(string_view s, std::size_t n, error_code& ec);
+    inline bool on_number_part(string_view, error_code&);
+    inline bool on_int64(std::int64_t i, string_view, error_code& ec);
+    inline bool on_uint64(std::uint64_t u, string_view, error_code& ec);
+    inline bool on_double(double d, string_view, error_code& ec);
+    inline bool on_bool(bool b, error_code& ec);
+    inline bool on_null(error_code& ec);
+    inline bool on_comment_part(string_view, error_code&);
+    inline bool on_comment(string_view, error_code&);
+};
+
+} // namespace detail
+
+/** A streaming extractor of fields from serialized JSON.
+
+    This class pulls a fixed set of fields,
+    named by JSON Pointers registered up front,
+    out of a stream of serialized JSON without
+    building the document. Input is supplied in
+    chunks of any size; each time a registered
+    pointer's scalar leaf completes, a callback
+    receives the converted value together with
+    the index the pointer was registered under.
+    Internally the input drives a
+    @ref basic_parser handler which tracks match
+    progress against the pointers and asks the
+    parser to skip every subtree which cannot
+    contain a match, so no @ref value_stack
+    exists and memory use is bounded by the
+    nesting depth and the largest matched
+    string, not by the size of the document.
+
+    Only scalar leaves are reported; a pointer
+    naming a container matches nothing.
+
+    @par Example
+    @code
+    stream_extractor ex;
+    ex.add_pointer( "/user/id" );
+    ex.add_pointer( "/status" );
+    ex.reset( &on_field, &ctx );
+    while( auto chunk = read_chunk() )
+        ex.write( chunk, ec );
+    ex.finish( ec );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently.
+
+    @see
+        @ref stream_parser,
+        @ref path_query,
+        @ref basic_parser.
+*/
+class stream_extractor
+{
+    basic_parser<detail::extract_handler> p_;
+
+public:
+    /** The type of callback invoked for each match.
+
+        The callback receives the opaque user
+        pointer given to @ref reset, the index
+        returned by @ref add_pointer for the
+        matched pointer, and the leaf as a
+        @ref value using the default memory
+        resource. The value is valid only for
+        the duration of the callback.
+    */
+    typedef detail::extract_handler::
+        callback_type callback_type;
+
+    /** Constructor.
+
+        @param opt The options for the parser.
+        If this parameter is omitted, the
+        parser will accept only standard JSON.
+    */
+    BOOST_JSON_DECL
+    explicit
+    stream_extractor(
+        parse_options const& opt = {}) noexcept;
+
+    /** Register a JSON Pointer to extract.
+
+        Pointers must be registered before the
+        first call to @ref write after
+        construction or @ref reset. A token
+        consisting of digits matches both an
+        object key and an array index.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @return The index passed to the
+        callback when this pointer matches.
+
+        @param ptr The JSON Pointer to
+        register.
+
+        @throw system_error `ptr` is not a
+        valid JSON Pointer.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    add_pointer(string_view ptr);
+
+    /** Start a new document.
+
+        This discards any incomplete parse and
+        installs the callback invoked for
+        subsequent matches. Registered pointers
+        are retained.
+
+        @param cb The callback to invoke for
+        each match.
+
+        @param user An opaque pointer passed to
+        the callback.
+    */
+    BOOST_JSON_DECL
+    void
+    reset(
+        callback_type cb,
+        void* user) noexcept;
+
+    /** Parse a chunk of the document.
+
+        The characters are processed
+        immediately; callbacks for matches
+        completed inside the chunk are invoked
+        before this function returns.
+
+        @par Exception Safety
+        Basic guarantee.
+
+        @return The number of characters
+        consumed.
+
+        @param data A pointer to the chunk.
+
+        @param size The size of the chunk.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    /** @{ */
+    BOOST_JSON_DECL
+    std::size_t
+    write(
+        char const* data,
+        std::size_t size,
+        error_code& ec);
+
+    BOOST_JSON_DECL
+    std::size_t
+    write(
+        char const* data,
+        std::size_t size,
+        std::error_code& ec);
+
+    std::size_t
+    write(
+        string_view s,
+        error_code& ec)
+    {
+        return write(
+            s.data(), s.size(), ec);
+    }
+
+    std::size_t
+    write(
+        string_view s,
+        std::error_code& ec)
+    {
+        return write(
+            s.data(), s.size(), ec);
+    }
+    /** @} */
+
+    /** Indicate the end of the document.
+
+        @par Exception Safety
+        Basic guarantee.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    /** @{ */
+    BOOST_JSON_DECL
+    void
+    finish(error_code& ec);
+
+    BOOST_JSON_DECL
+    void
+    finish(std::error_code& ec);
+    /** @} */
+
+    /** Return true if a complete document has been parsed.
+    */
+    bool
+    done() const noexcept
+    {
+        return p_.done();
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -16,14 +16,51 @@
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/value.hpp>
 #include <boost/json/detail/handler.hpp>
+#ifdef BOOST_JSON_PARSE_STATS
+# include <boost/json/detail/rdtsc.hpp>
+#endif
+#include <atomic>
 #include <type_traits>
 #include <cstddef>
+#include <string>
 
 namespace boost {
 namespace json {
 
 //----------------------------------------------------------
 
+#ifdef BOOST_JSON_PARSE_STATS
+/** Tick counters separating parse compute from wait.
+
+    This type is only available when the
+    library is built with the macro
+    `BOOST_JSON_PARSE_STATS` defined, which
+    adds the counters to @ref stream_parser.
+    Values are in the ticks of the platform's
+    cheapest monotonic counter — the time
+    stamp counter on x86 — so only the ratio
+    between the two durations, or differences
+    between snapshots, are meaningful. The
+    counters accumulate across documents and
+    are never cleared by `reset`, which suits
+    periodic scraping per connection.
+
+    @see
+        @ref stream_parser::timings.
+*/
+struct parse_timings
+{
+    /// Ticks spent inside calls which parse
+    std::uint64_t write_ticks = 0;
+
+    /// Ticks elapsed between such calls
+    std::uint64_t suspended_ticks = 0;
+
+    /// Number of calls measured
+    std::uint64_t writes = 0;
+};
+#endif
+
 /** A DOM parser for JSON text contained in multiple buffers.
 
     This class is used to parse a JSON text contained in a
@@ -134,6 +171,54 @@ namespace json {
 class stream_parser
 {
     basic_parser<detail::handler> p_;
+    std::string ibuf_;
+    std::size_t ibuf_cap_ = 0;
+    std::size_t nparsed_ = 0;
+
+#ifdef BOOST_JSON_PARSE_STATS
+    parse_timings tm_;
+    std::uint64_t last_stop_ = 0;
+    unsigned timing_depth_ = 0;
+
+    // measures one public call; the write
+    // functions delegate to each other, and
+    // only the outermost frame records
+    struct timing_scope
+    {
+        stream_parser& p;
+        std::uint64_t t0;
+        bool const outer;
+
+        explicit
+        timing_scope(
+            stream_parser& p_) noexcept
+            : p(p_)
+            , outer(p_.timing_depth_++ == 0)
+        {
+            if(! outer)
+                return;
+            t0 = detail::rdtsc();
+            if(p.last_stop_ != 0)
+                p.tm_.suspended_ticks +=
+                    t0 - p.last_stop_;
+        }
+
+        ~timing_scope()
+        {
+            --p.timing_depth_;
+            if(! outer)
+                return;
+            auto const t1 = detail::rdtsc();
+            p.tm_.write_ticks += t1 - t0;
+            p.last_stop_ = t1;
+            ++p.tm_.writes;
+        }
+    };
+#endif
+
+    BOOST_JSON_DECL
+    bool
+    flush_input(error_code& ec);
 
 public:
     /// Copy constructor (deleted)
@@ -439,6 +524,75 @@ public:
     void
     reset(storage_ptr sp = {}) noexcept;
 
+    /** Set the size of the input coalescing buffer.
+
+        This function provides a hint of the typical
+        size of the buffers which will be passed to
+        @ref write. When `n` is greater than zero,
+        subsequent calls to @ref write append their
+        input to an internal buffer of `n` characters
+        instead of parsing it immediately; the parser
+        runs only when the buffer fills up, when
+        @ref finish is called, or when a buffer at
+        least `n` characters in size is written while
+        the internal buffer is empty. This coalesces
+        many small writes into a few long spans,
+        reducing the number of times the parser must
+        suspend and resume at a buffer boundary.
+
+        Buffering changes when errors are reported,
+        but not whether they are reported: a call to
+        @ref write whose characters are merely
+        buffered always succeeds, and errors caused
+        by those characters, including
+        `error::extra_data`, surface when the buffer
+        is next flushed. Likewise @ref done reflects
+        only the characters parsed so far. Calling
+        `reserve_input(0)` disables buffering;
+        characters already buffered are parsed on the
+        next write or call to @ref finish.
+
+        The buffer capacity is retained across calls
+        to @ref reset.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param n The size of the coalescing buffer,
+        or zero to disable buffering.
+    */
+    BOOST_JSON_DECL
+    void
+    reserve_input(std::size_t n);
+
+    /** Return excess temporary storage to the memory resource.
+
+        The temporary storage used by the
+        implementation is retained at its high-water
+        mark across calls to @ref reset, so that
+        parsing many documents with one parser
+        performs no allocations in the steady state.
+        This function releases that storage,
+        returning the parser to its
+        construction-time state. Any previous
+        partial results are destroyed, and any
+        buffered input is discarded.
+
+        @par Complexity
+        Constant or linear in the size of any
+        previous partial parsing results.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    shrink_to_fit() noexcept;
+
     /** Return true if a complete JSON text has been parsed.
 
         This function returns `true` when all of these
@@ -463,6 +617,138 @@ public:
         return p_.done();
     }
 
+    /** Set the cancellation flag checked during parsing.
+
+        When `flag` is not null, the parser reads
+        it once for every JSON value it begins,
+        and if the flag is `true` the parse stops
+        with @ref error::canceled. Another thread,
+        such as a deadline timer, may set the flag
+        at any time to make a call to @ref write
+        in progress return early instead of
+        parsing its buffer to completion. The flag
+        is read with relaxed ordering and is never
+        written or cleared by the parser; the
+        caller must clear it before reusing the
+        parser after a call to @ref reset. The
+        error is sticky, like any other parse
+        error.
+
+        The check costs one predictable branch
+        per value when no flag is installed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param flag A pointer to the flag to
+        check, which must remain valid until it
+        is replaced or the parser is destroyed,
+        or `nullptr` to disable cancellation.
+    */
+    void
+    cancel_token(
+        std::atomic<bool> const* flag) noexcept
+    {
+        p_.cancel_token(flag);
+    }
+
+    /** Return the installed cancellation flag.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::atomic<bool> const*
+    cancel_token() const noexcept
+    {
+        return p_.cancel_token();
+    }
+
+    /** Return the number of input bytes parsed.
+
+        This function returns the number of bytes
+        of input consumed by the parser since the
+        parser was constructed, or since the last
+        call to @ref reset. When a write operation
+        has failed with a parse error, this is the
+        offset of the offending byte within the
+        input stream, making the failure position
+        available on the non-throwing overloads
+        without constructing an exception.
+        Bytes buffered by @ref write after a call
+        to @ref reserve_input are not counted
+        until they are parsed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::size_t
+    error_offset() const noexcept
+    {
+        return nparsed_;
+    }
+
+#ifdef BOOST_JSON_PARSE_STATS
+    /** Return counters describing the work performed.
+
+        The counters accumulate over the lifetime of
+        the parser and are not cleared by @ref reset,
+        making them suitable for periodic collection
+        by an external metrics scraper. Only available
+        when `BOOST_JSON_PARSE_STATS` is defined.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    parse_stats
+    stats() const noexcept
+    {
+        parse_stats st = p_.stats();
+        st.stack_bytes =
+            p_.handler().st.allocated();
+        return st;
+    }
+
+    /** Return tick counters separating parse compute from wait.
+
+        Calls to @ref write, @ref write_some,
+        and @ref finish accumulate the ticks
+        spent inside them into
+        @ref parse_timings::write_ticks, and
+        the ticks elapsed since the previous
+        such call returned into
+        @ref parse_timings::suspended_ticks.
+        For a parser fed from a network
+        connection this separates compute
+        from time spent waiting for input,
+        without external profiling. Only
+        available when `BOOST_JSON_PARSE_STATS`
+        is defined.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    parse_timings
+    timings() const noexcept
+    {
+        return tm_;
+    }
+#endif
+
     /** Parse a buffer containing all or part of a complete JSON text.
 
         This function parses JSON text contained in the
@@ -697,6 +983,146 @@ public:
             s.data(), s.size());
     }
 
+    /** Parse part of a JSON text with a bound on the work performed.
+
+        This function behaves like
+        @ref write_some(char const*,std::size_t,error_code&)
+        except that at most `max_work` characters
+        of the buffer are examined before the
+        function returns, even when more input is
+        available. Because the parser performs a
+        bounded amount of work per character, this
+        bounds the time spent inside a single
+        call: a cooperative scheduler can offer a
+        large buffer repeatedly, advancing by the
+        returned count, and never be blocked for
+        longer than one `max_work` slice. The
+        parser suspends mid-token at the slice
+        boundary using the same machinery that
+        handles input split across buffers, so no
+        characters are reprocessed when the next
+        call resumes.
+
+        Input buffered by @ref write, if any, is
+        flushed in full before the slice is
+        examined and does not count toward
+        `max_work`; callers interleaving the two
+        interfaces should size the coalescing
+        buffer accordingly.
+
+        @par Complexity
+        Linear in `min( size, max_work )`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Upon error or exception, subsequent calls will
+        fail until @ref reset is called to parse a new JSON text.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param data A pointer to a buffer of `size`
+        characters to parse.
+
+        @param size The number of characters pointed to
+        by `data`.
+
+        @param max_work The maximum number of
+        characters to examine in this call.
+
+        @param ec Set to the error, if any occurred.
+    */
+/** @{ */
+    BOOST_JSON_DECL
+    std::size_t
+    write_some(
+        char const* data,
+        std::size_t size,
+        std::size_t max_work,
+        error_code& ec);
+
+    BOOST_JSON_DECL
+    std::size_t
+    write_some(
+        char const* data,
+        std::size_t size,
+        std::size_t max_work,
+        std::error_code& ec);
+/** @} */
+
+    /** Parse part of a JSON text with a bound on the work performed.
+
+        This overload behaves identically to
+        @ref write_some(char const*,std::size_t,std::size_t,error_code&)
+        except that an exception is thrown on error.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Upon error or exception, subsequent calls will
+        fail until @ref reset is called to parse a new JSON text.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param data A pointer to a buffer of `size`
+        characters to parse.
+
+        @param size The number of characters pointed to
+        by `data`.
+
+        @param max_work The maximum number of
+        characters to examine in this call.
+
+        @throw system_error Thrown on error.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    write_some(
+        char const* data,
+        std::size_t size,
+        std::size_t max_work);
+
+    /** Parse part of a JSON text with a bound on the work performed.
+
+        This overload behaves identically to
+        @ref write_some(char const*,std::size_t,std::size_t,error_code&)
+        except that the input is given as a
+        @ref string_view.
+
+        @return The number of characters consumed from
+        the buffer.
+
+        @param s The character string to parse.
+
+        @param max_work The maximum number of
+        characters to examine in this call.
+
+        @param ec Set to the error, if any occurred.
+    */
+/** @{ */
+    std::size_t
+    write_some(
+        string_view s,
+        std::size_t max_work,
+        error_code& ec)
+    {
+        return write_some(
+            s.data(), s.size(), max_work, ec);
+    }
+
+    std::size_t
+    write_some(
+        string_view s,
+        std::size_t max_work,
+        std::error_code& ec)
+    {
+        return write_some(
+            s.data(), s.size(), max_work, ec);
+    }
+/** @} */
+
     /** Parse a buffer containing all or part of a complete JSON text.
 
         This function parses a all or part of a JSON text
@@ -919,6 +1345,93 @@ public:
             s.data(), s.size());
     }
 
+    /** Parse a sequence of buffers containing all or part of a complete JSON text.
+
+        This function parses all or part of a JSON
+        text spread over `count` non-contiguous
+        character buffers, such as the chains
+        produced by scatter/gather I/O, without
+        first flattening them into a single
+        allocation. The buffers are walked in
+        order and behave as if their contents had
+        been concatenated: tokens may be split
+        across buffer boundaries, and every
+        character must be consumed as with
+        @ref write.
+
+        @par Example
+        @code
+        stream_parser p;                                // construct a parser
+        string_view const bufs[] = { "[1,", "2,3", ",4]" };
+        p.write( bufs, 3 );                             // parse the whole chain
+        value jv = p.release();                         // take ownership of the value
+        @endcode
+
+        @par Complexity
+        Linear in the total size of the buffers.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Upon error or exception, subsequent calls will
+        fail until @ref reset is called to parse a new JSON text.
+
+        @return The number of characters consumed.
+
+        @param buffers A pointer to an array of
+        `count` buffers to parse in order.
+
+        @param count The number of buffers.
+
+        @param ec Set to the error, if any occurred.
+    */
+/** @{ */
+    BOOST_JSON_DECL
+    std::size_t
+    write(
+        string_view const* buffers,
+        std::size_t count,
+        error_code& ec);
+
+    BOOST_JSON_DECL
+    std::size_t
+    write(
+        string_view const* buffers,
+        std::size_t count,
+        std::error_code& ec);
+/** @} */
+
+    /** Parse a sequence of buffers containing all or part of a complete JSON text.
+
+        This function behaves identically to
+        @ref write(string_view const*,std::size_t,error_code&)
+        except that an exception is thrown on
+        error.
+
+        @par Complexity
+        Linear in the total size of the buffers.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+        Upon error or exception, subsequent calls will
+        fail until @ref reset is called to parse a new JSON text.
+
+        @return The number of characters consumed.
+
+        @param buffers A pointer to an array of
+        `count` buffers to parse in order.
+
+        @param count The number of buffers.
+
+        @throw system_error Thrown on error.
+    */
+    BOOST_JSON_DECL
+    std::size_t
+    write(
+        string_view const* buffers,
+        std::size_t count);
+
     /** Indicate the end of JSON input.
 
         This function is used to indicate that there
@@ -83,6 +83,13 @@ class string
         string_view s2,
         storage_ptr sp);
 
+    inline
+    string(
+        detail::key_t const&,
+        char* s,
+        std::size_t n,
+        storage_ptr sp);
+
 public:
     /** The type of _Allocator_ returned by @ref get_allocator
 
@@ -909,7 +916,7 @@ public:
     char&
     at(std::size_t pos)
     {
-
+        impl_.unescaped(false);
         auto const& self = *this;
         return const_cast< char& >( self.at(pos) );
     }
@@ -946,6 +953,7 @@ public:
     char&
     operator[](std::size_t pos)
     {
+        impl_.unescaped(false);
         return impl_.data()[pos];
     }
 
@@ -989,6 +997,7 @@ public:
     char&
     front()
     {
+        impl_.unescaped(false);
         return impl_.data()[0];
     }
 
@@ -1029,6 +1038,7 @@ public:
     char&
     back()
     {
+        impl_.unescaped(false);
         return impl_.data()[impl_.size() - 1];
     }
 
@@ -1069,6 +1079,7 @@ public:
     char*
     data() noexcept
     {
+        impl_.unescaped(false);
         return impl_.data();
     }
 
@@ -1166,6 +1177,7 @@ public:
     iterator
     begin() noexcept
     {
+        impl_.unescaped(false);
         return impl_.data();
     }
 
@@ -1217,6 +1229,7 @@ public:
     iterator
     end() noexcept
     {
+        impl_.unescaped(false);
         return impl_.end();
     }
 
@@ -1274,6 +1287,7 @@ public:
     reverse_iterator
     rbegin() noexcept
     {
+        impl_.unescaped(false);
         return reverse_iterator(impl_.end());
     }
 
@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_STRING_BUILDER_HPP
+#define BOOST_JSON_STRING_BUILDER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+//----------------------------------------------------------
+
+/** A builder which assembles a string with one allocation.
+
+    Growing a @ref string by repeated calls to
+    `append` or `push_back` reallocates its buffer
+    geometrically. When the string uses an arena
+    such as @ref monotonic_resource, each discarded
+    buffer remains in the arena until the arena is
+    released, wasting up to the final size of the
+    string in dead space.
+\n
+    This builder accumulates characters in a chain
+    of temporary segments obtained from the default
+    memory resource, then copies them into a string
+    using the destination storage exactly once when
+    @ref release is called. The destination arena
+    only ever sees the final, exact-sized buffer.
+
+    @par Example
+
+    This assembles a large string in a
+    monotonic resource without waste.
+
+    @code
+
+    monotonic_resource mr;
+
+    string_builder sb( &mr );
+
+    for( int i = 0; i < 1000; ++i )
+        sb.append( "segment" );
+
+    string s = sb.release();
+
+    assert( s.size() == 7000 );
+
+    @endcode
+
+    @par Thread Safety
+    Members of the same instance may not be
+    called concurrently.
+*/
+class string_builder
+{
+    struct segment
+    {
+        segment* next;
+        std::size_t size;
+        std::size_t capacity;
+
+        char*
+        data() noexcept
+        {
+            return reinterpret_cast<
+                char*>(this + 1);
+        }
+    };
+
+    storage_ptr sp_;
+    segment* head_ = nullptr;
+    segment* tail_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    /// Copy constructor (deleted)
+    string_builder(
+        string_builder const&) = delete;
+
+    /// Copy assignment (deleted)
+    string_builder& operator=(
+        string_builder const&) = delete;
+
+    /** Destructor.
+
+        All temporary segments are freed.
+
+        @par Complexity
+        Linear in the number of segments.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    ~string_builder();
+
+    /** Constructor.
+
+        This constructs an empty builder. Strings
+        produced by @ref release will use the
+        specified memory resource.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param sp A pointer to the @ref memory_resource
+        to use for released strings. The builder will
+        acquire shared ownership of the memory resource.
+    */
+    explicit
+    string_builder(
+        storage_ptr sp = {}) noexcept
+        : sp_(std::move(sp))
+    {
+    }
+
+    /** Return the number of characters accumulated.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Append a string.
+
+        The characters are copied into the
+        builder's temporary segments; no
+        allocation is performed on the
+        destination storage.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param s The characters to append.
+    */
+    BOOST_JSON_DECL
+    void
+    append(string_view s);
+
+    /** Append a character.
+
+        @par Complexity
+        Amortized constant.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param ch The character to append.
+    */
+    void
+    push_back(char ch)
+    {
+        append(string_view(&ch, 1));
+    }
+
+    /** Discard the accumulated characters.
+
+        All temporary segments are freed and
+        the size is reset to zero. The builder
+        may be reused.
+
+        @par Complexity
+        Linear in the number of segments.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    clear() noexcept;
+
+    /** Return the accumulated characters as a string.
+
+        A string using the destination storage is
+        constructed with exactly one allocation of
+        the final size, the accumulated characters
+        are copied in, and the builder is cleared
+        for reuse.
+
+        @par Complexity
+        Linear in @ref size.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw system_error `size() > string::max_size()`.
+    */
+    BOOST_JSON_DECL
+    string
+    release();
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
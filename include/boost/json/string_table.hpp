@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_STRING_TABLE_HPP
+#define BOOST_JSON_STRING_TABLE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** An interning table for repeated strings.
+
+    Documents often repeat the same string
+    values: enum-like fields, country codes,
+    or status words appear millions of times
+    across a cache of parsed documents. A
+    string table stores one canonical copy of
+    each distinct string inserted into it and
+    returns stable views of that copy, so
+    repeated content is kept in memory once.
+
+    The characters live in memory obtained
+    from the table's @ref memory_resource,
+    which the table owns through a counted
+    @ref storage_ptr. Views returned by
+    @ref insert and @ref find remain valid as
+    long as any copy of @ref storage exists,
+    even after the table itself is destroyed.
+    Callers who keep interned views alongside
+    parsed documents should retain a copy of
+    the storage pointer with them.
+
+    A table does not produce shared
+    @ref string values: every kind of
+    @ref string owns its character buffer and
+    mutates it in place, so two values cannot
+    alias one copy. Note that enum-like
+    strings of up to fourteen characters are
+    stored inline in a @ref value and do not
+    allocate at all; the table pays off for
+    longer repeated strings and for callers
+    who index or compare by identity.
+
+    @par Thread Safety
+    Distinct instances may be used
+    concurrently. Shared access to the same
+    instance requires external
+    synchronization.
+*/
+class string_table
+{
+    struct entry
+    {
+        entry* next;
+        std::uint32_t size;
+        // char[size + 1] follows
+    };
+
+    storage_ptr sp_;
+    entry** buckets_ = nullptr;
+    std::size_t bucket_count_ = 0;
+    std::size_t size_ = 0;
+
+    BOOST_JSON_DECL
+    entry**
+    bucket(string_view s) const noexcept;
+
+    BOOST_JSON_DECL
+    void
+    rehash();
+
+public:
+    /** Destructor.
+
+        Entries are deallocated unless the
+        memory resource is shared or its
+        `deallocate` is trivial. Character
+        storage kept alive through copies of
+        @ref storage is not affected.
+    */
+    BOOST_JSON_DECL
+    ~string_table();
+
+    /** Constructor.
+
+        The table starts empty, with all
+        character storage obtained from a
+        newly created, counted
+        @ref monotonic_resource.
+    */
+    BOOST_JSON_DECL
+    string_table();
+
+    /** Constructor.
+
+        The table starts empty, obtaining
+        character storage from `sp`. The
+        table acquires shared ownership of
+        the memory resource.
+
+        @param sp A pointer to the
+        @ref memory_resource to use.
+    */
+    BOOST_JSON_DECL
+    explicit
+    string_table(storage_ptr sp);
+
+    /// Copy constructor (deleted)
+    string_table(
+        string_table const&) = delete;
+
+    /// Copy assignment (deleted)
+    string_table&
+    operator=(
+        string_table const&) = delete;
+
+    /** Return the associated memory resource.
+
+        Interned characters remain valid as
+        long as any copy of this pointer
+        exists.
+    */
+    storage_ptr const&
+    storage() const noexcept
+    {
+        return sp_;
+    }
+
+    /** Return the number of distinct strings.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Intern a string.
+
+        If a string equal to `s` was inserted
+        before, a view of the existing copy
+        is returned and nothing is allocated.
+        Otherwise the characters are copied
+        into the table and a view of the new
+        canonical copy is returned. The view
+        is null terminated and remains stable
+        for the lifetime of @ref storage.
+
+        @par Complexity
+        Constant on average, linear in
+        `s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param s The string to intern.
+    */
+    BOOST_JSON_DECL
+    string_view
+    insert(string_view s);
+
+    /** Find an interned string.
+
+        If a string equal to `s` was inserted
+        before, a view of the canonical copy
+        is returned. Otherwise a view with a
+        null data pointer is returned.
+
+        @par Complexity
+        Constant on average, linear in
+        `s.size()`.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param s The string to look up.
+    */
+    BOOST_JSON_DECL
+    string_view
+    find(string_view s) const noexcept;
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
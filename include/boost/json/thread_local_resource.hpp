@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_THREAD_LOCAL_RESOURCE_HPP
+#define BOOST_JSON_THREAD_LOCAL_RESOURCE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/memory_resource.hpp>
+
+namespace boost {
+namespace json {
+
+/** Return a pointer to the thread-local caching resource.
+
+    This memory resource forwards to `operator new`
+    and `operator delete`, but keeps a small
+    per-thread cache of recently deallocated blocks
+    organized by size class. Allocations which can
+    be satisfied from the calling thread's cache do
+    not touch the global heap, removing allocator
+    contention when many threads parse and destroy
+    values concurrently. Each cache is flushed when
+    its thread exits.
+
+    Blocks may be allocated on one thread and
+    deallocated on another; the block then enters
+    the cache of the deallocating thread.
+
+    To use this resource for all default-constructed
+    @ref storage_ptr objects, install it as the
+    default:
+
+    @code
+    set_default_resource( get_thread_local_resource() );
+    @endcode
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+*/
+BOOST_JSON_DECL
+memory_resource*
+get_thread_local_resource() noexcept;
+
+} // namespace json
+} // namespace boost
+
+#endif
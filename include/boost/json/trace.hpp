@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_TRACE_HPP
+#define BOOST_JSON_TRACE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** Identifies the transition reported by a tracepoint.
+
+    Each enumerator names one of the places in
+    the library which report to the hook
+    installed with @ref set_trace_hook. The
+    tracepoints are only compiled in when the
+    library is built with the macro
+    `BOOST_JSON_TRACE` defined.
+
+    @see
+        @ref set_trace_hook.
+*/
+enum class trace_event : unsigned char
+{
+    /// A @ref stream_parser began a new document
+    document_begin,
+
+    /// A @ref stream_parser completed a document
+    document_end,
+
+    /// A @ref stream_parser suspended on incomplete input
+    parser_suspend,
+
+    /// A @ref stream_parser resumed a suspended parse
+    parser_resume,
+
+    /// A @ref monotonic_resource allocated a new block
+    arena_block
+};
+
+/** The type of callback invoked by tracepoints.
+
+    The hook receives the event, an opaque
+    pointer identifying the reporting object,
+    and one event-specific argument: the bytes
+    of input consumed so far for the parser
+    events, and the block size in bytes for
+    @ref trace_event::arena_block.
+*/
+using trace_hook = void(*)(
+    trace_event ev,
+    void const* subject,
+    std::uint64_t arg);
+
+/** Install the tracing callback.
+
+    This function atomically replaces the hook
+    invoked by the library's tracepoints and
+    returns the previous hook, or `nullptr` if
+    none was installed. Passing `nullptr`
+    disables tracing. The tracepoints
+    themselves are only compiled in when the
+    library is built with the macro
+    `BOOST_JSON_TRACE` defined; without it this
+    function still replaces the hook, but
+    nothing ever invokes it.
+
+    The hook may be invoked concurrently from
+    any thread using the library, and from code
+    holding no locks; it must not re-enter the
+    library and should not block. The hook
+    receives only plain values and is loaded
+    with a single atomic read, so a hook which
+    is itself async-signal-safe may be used to
+    observe parses from signal handlers or
+    sampling profilers.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The previously installed hook.
+
+    @param hook The hook to install, or
+    `nullptr` to disable tracing.
+
+    @see
+        @ref trace_event.
+*/
+BOOST_JSON_DECL
+trace_hook
+set_trace_hook(trace_hook hook) noexcept;
+
+namespace detail {
+
+BOOST_JSON_DECL
+void
+trace_emit(
+    trace_event ev,
+    void const* subject,
+    std::uint64_t arg) noexcept;
+
+} // namespace detail
+
+} // namespace json
+} // namespace boost
+
+// Tracepoints compile to nothing unless the
+// library is built with BOOST_JSON_TRACE.
+#ifdef BOOST_JSON_TRACE
+# define BOOST_JSON_TRACE_EMIT(ev, subject, arg) \
+    ::boost::json::detail::trace_emit(ev, subject, arg)
+#else
+# define BOOST_JSON_TRACE_EMIT(ev, subject, arg) \
+    do { } while(false)
+#endif
+
+#endif
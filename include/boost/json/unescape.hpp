@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_UNESCAPE_HPP
+#define BOOST_JSON_UNESCAPE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace json {
+
+/** Replace JSON escape sequences with the characters they encode.
+
+    This function copies the characters of `s` to
+    `dest`, replacing each backslash escape
+    sequence with the character or UTF-8 encoded
+    code point it represents, using the same rules
+    as @ref parse. The input is the contents of a
+    JSON string token without the enclosing
+    quotes, such as a raw token obtained from
+    @ref lazy_value. Since every escape sequence
+    is longer than its replacement, the output
+    never exceeds `s.size()` characters; `dest`
+    must point to at least that much storage. The
+    input and output ranges may not overlap.
+
+    Escape sequences must be well-formed: an
+    unknown escape character, malformed `\\u`
+    escape, or unpaired surrogate sets `ec`, and
+    the contents of `dest` are unspecified.
+    Characters outside of escape sequences are
+    copied without inspection; UTF-8 validity of
+    the input is not checked.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    No-throw guarantee.
+
+    @return The number of characters written
+    to `dest`, or zero if an error occurred.
+
+    @param s The string to unescape.
+
+    @param dest The destination to write to.
+
+    @param ec Set to the error, if any occurred.
+
+    @see @ref escape, @ref parse.
+*/
+BOOST_JSON_DECL
+std::size_t
+unescape(
+    string_view s,
+    char* dest,
+    error_code& ec);
+
+/** Replace JSON escape sequences with the characters they encode.
+
+    This overload behaves identically to
+    @ref unescape(string_view,char*,error_code&)
+    except that an exception is thrown on error.
+
+    @return The number of characters written
+    to `dest`.
+
+    @throw boost::system::system_error on error.
+
+    @param s The string to unescape.
+
+    @param dest The destination to write to.
+*/
+BOOST_JSON_DECL
+std::size_t
+unescape(
+    string_view s,
+    char* dest);
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_VALIDATE_HPP
+#define BOOST_JSON_VALIDATE_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** Structural metadata recorded by @ref validate.
+
+    All counters start at zero and describe the
+    portion of the text examined before validation
+    stopped.
+*/
+struct validate_stats
+{
+    /** The number of bytes examined.
+
+        On success this equals the size of the
+        input. On failure it is the byte offset
+        at which the first error was detected.
+    */
+    std::size_t position = 0;
+
+    /// The deepest level of structure nesting
+    std::size_t max_depth = 0;
+
+    /// The number of objects
+    std::uint64_t objects = 0;
+
+    /// The number of arrays
+    std::uint64_t arrays = 0;
+
+    /// The number of object keys
+    std::uint64_t keys = 0;
+
+    /// The number of string values, not counting keys
+    std::uint64_t strings = 0;
+
+    /// The number of number values
+    std::uint64_t numbers = 0;
+
+    /// The number of `true` and `false` values
+    std::uint64_t bools = 0;
+
+    /// The number of `null` values
+    std::uint64_t nulls = 0;
+};
+
+/** Check whether a string is a valid JSON text.
+
+    This function scans the entire input and
+    determines whether it forms a complete, valid
+    JSON text, without building a @ref value or
+    invoking any handler. The scan uses the same
+    vectorized whitespace, string, and UTF-8
+    kernels as @ref parse, but performs no
+    allocation, escape expansion, or number
+    conversion, making it substantially faster
+    than parsing into a null handler. Counts
+    describing the structure of the text are
+    recorded in `st`.
+
+    When the options request an extension which
+    the linear scan does not support, such as
+    comments or trailing commas, the incremental
+    parser is used instead with a counting
+    handler; the result is the same, only slower.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @return `true` if the text is valid.
+
+    @param s The string to validate.
+
+    @param ec Set to the error, if any occurred.
+
+    @param st Set to counts describing the
+    examined text, including the byte offset
+    at which validation stopped.
+
+    @param opt The options to use. If this
+    parameter is omitted, strict parsing is
+    performed.
+
+    @see @ref parse, @ref parse_options,
+        @ref validate_stats.
+*/
+BOOST_JSON_DECL
+bool
+validate(
+    string_view s,
+    error_code& ec,
+    validate_stats& st,
+    parse_options const& opt = {});
+
+/** Check whether a string is a valid JSON text.
+
+    This overload behaves identically to
+    @ref validate(string_view,error_code&,validate_stats&,parse_options const&)
+    except that the structural counts are
+    discarded.
+
+    @return `true` if the text is valid.
+
+    @param s The string to validate.
+
+    @param ec Set to the error, if any occurred.
+
+    @param opt The options to use. If this
+    parameter is omitted, strict parsing is
+    performed.
+*/
+BOOST_JSON_DECL
+bool
+validate(
+    string_view s,
+    error_code& ec,
+    parse_options const& opt = {});
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -16,6 +16,7 @@
 #include <boost/json/kind.hpp>
 #include <boost/json/object.hpp>
 #include <boost/json/pilfer.hpp>
+#include <boost/json/raw_number.hpp>
 #include <boost/json/set_pointer_options.hpp>
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/string.hpp>
@@ -35,6 +36,8 @@
 namespace boost {
 namespace json {
 
+class pointer;
+
 //----------------------------------------------------------
 
 /** The type used to represent any JSON value
@@ -105,6 +108,15 @@ class value
     {
     }
 
+    value(
+        detail::key_t const&,
+        char* s,
+        std::size_t n,
+        storage_ptr sp)
+        : str_(detail::key_t{}, s, n, std::move(sp))
+    {
+    }
+
     inline bool is_scalar() const noexcept
     {
         return sca_.k < json::kind::string;
@@ -778,6 +790,53 @@ public:
     {
     }
 
+    /** Construct a pre-formatted number.
+
+        The value is constructed with a copy of
+        the characters of `n`, marked so that
+        @ref serializer emits them verbatim,
+        without quotes or reformatting. It is
+        the caller's responsibility that the
+        characters form a valid JSON number;
+        the parser produces such values, with
+        validated text, when
+        @ref parse_options::raw_numbers is set.
+
+        The text is stored as a @ref string:
+        @ref kind() returns @ref kind::string,
+        and @ref is_raw_number returns `true`.
+        Modifying the characters removes the
+        mark, and the value is serialized as an
+        ordinary quoted string thereafter.
+
+        @par Complexity
+        Linear in `n.text.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param n The number text to construct with.
+
+        @param sp A pointer to the @ref memory_resource
+        to use. The container will acquire shared
+        ownership of the memory resource.
+
+        @see @ref is_raw_number,
+            @ref get_raw_number,
+            @ref parse_options.
+    */
+    value(
+        raw_number const& n,
+        storage_ptr sp = {})
+        : str_(
+            string_view(n.text),
+            std::move(sp))
+    {
+        detail::access::raw_number(
+            str_, true);
+    }
+
     /** Construct an @ref array.
 
         The value is constructed from `other`, using the
@@ -1681,6 +1740,163 @@ public:
         lhs.swap(rhs);
     }
 
+    /** Return a compact copy of this value.
+
+        This function returns a deep copy of this value
+        which uses exactly as much memory as its contents
+        require, constructed using the specified memory
+        resource:
+
+        @li Arrays are allocated with capacity equal
+        to their size, discarding any slack left over
+        from incremental insertion.
+
+        @li Object tables are allocated at exactly
+        the number of contained elements, rather than
+        the larger capacity which @ref object::insert
+        reserves for future growth.
+
+        @li Strings and structured children are copied
+        depth-first, so that when `sp` refers to a
+        bump-allocating resource such as
+        @ref monotonic_resource, the character data of
+        a document is packed contiguously in traversal
+        order, improving locality of reference for
+        read-mostly workloads.
+
+        The returned value is an ordinary @ref value;
+        immutability is by convention. To preserve the
+        compact representation, store the result in a
+        `const` object and do not call functions which
+        modify it.
+
+        @par Complexity
+        Linear in the size of `*this`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param sp A pointer to the @ref memory_resource
+        to use for the copy. The container will acquire
+        shared ownership of the memory resource.
+    */
+    BOOST_JSON_DECL
+    value
+    freeze(storage_ptr sp = {}) const;
+
+    /** Return a copy of this value packed into a fresh arena.
+
+        This function returns a deep copy of this value
+        constructed in a new bump-allocating arena which
+        the returned value owns. Children are copied
+        depth-first, so the copy is laid out in strict
+        pre-order traversal order: @ref serializer visits
+        the nodes of the returned value in the same order
+        in which they were allocated and streams through
+        the arena sequentially. For large documents which
+        were built incrementally, and whose nodes are
+        therefore scattered through memory in stack order,
+        this converts serialization from a pointer-chasing
+        workload into a mostly linear scan.
+
+        The arena grows geometrically on demand. Callers
+        who know the approximate memory footprint of the
+        document may pass it as `reserve` to size the
+        first block so that the entire copy lands in one
+        contiguous allocation.
+
+        The arena is released as a whole when the returned
+        value and all values which share its storage are
+        destroyed. As with @ref freeze, the compact layout
+        is preserved only as long as the result is not
+        modified.
+
+        @par Complexity
+        Linear in the size of `*this`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param reserve The size of the arena's first
+        block, in bytes. If this parameter is omitted,
+        an implementation-defined default is used.
+
+        @see @ref freeze, @ref monotonic_resource.
+    */
+    BOOST_JSON_DECL
+    value
+    clone_compact(std::size_t reserve = 0) const;
+
+    /** Statistics describing a call to @ref relocate.
+
+        @see @ref relocate.
+    */
+    struct relocation_stats
+    {
+        /// The number of value nodes copied.
+        std::size_t values = 0;
+
+        /// The number of string and key
+        /// character bytes copied.
+        std::size_t string_bytes = 0;
+
+        /// True if the contents moved to a
+        /// different memory resource.
+        bool relocated = false;
+    };
+
+    /** Move the contents to a different memory resource.
+
+        If `*sp` and `*storage()` are the same
+        resource, no work is performed and the
+        returned statistics are all zero.
+        Otherwise the contents are deep-copied
+        into storage obtained from `sp`, this
+        value takes ownership of the copy, and
+        the previous contents are destroyed.
+        The statistics describe the work
+        performed, making the otherwise silent
+        linear cost of crossing memory
+        resources observable and attributable.
+
+        Like @ref freeze, the copy allocates
+        exactly and is laid out depth-first, so
+        each container's element block and each
+        string's characters are transferred in
+        one allocation and one bulk copy each.
+
+        Move construction and move assignment
+        between values with different memory
+        resources perform the same deep copy
+        implicitly. Defining
+        `BOOST_JSON_REQUIRE_EXPLICIT_RELOCATION`
+        turns those implicit copies into debug
+        assertions, so hidden relocations are
+        caught in testing and replaced with
+        calls to this function.
+
+        @par Complexity
+        Linear in the size of `*this`, or
+        constant when the resource is unchanged.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate`
+        may throw.
+
+        @param sp A pointer to the
+        @ref memory_resource to move to. The
+        container will acquire shared ownership
+        of the memory resource.
+
+        @see @ref freeze.
+    */
+    BOOST_JSON_DECL
+    relocation_stats
+    relocate(storage_ptr sp);
+
     //------------------------------------------------------
     //
     // Observers
@@ -1774,6 +1990,57 @@ public:
         return kind() == json::kind::string;
     }
 
+    /** Return `true` if this is a pre-formatted number
+
+        Pre-formatted numbers hold the text of a
+        JSON numeral which the serializer emits
+        verbatim. They are produced by the parser
+        when @ref parse_options::raw_numbers is
+        set, or constructed from @ref raw_number.
+        The text is stored as a @ref string, so
+        @ref is_string also returns `true`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see @ref get_raw_number,
+            @ref parse_options.
+    */
+    bool
+    is_raw_number() const noexcept
+    {
+        return kind() == json::kind::string &&
+            detail::access::raw_number(str_);
+    }
+
+    /** Return the text of a pre-formatted number
+
+        The returned view is valid until the
+        value is changed or destroyed.
+
+        @par Precondition
+        @code
+        this->is_raw_number()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see @ref is_raw_number.
+    */
+    string_view
+    get_raw_number() const noexcept
+    {
+        BOOST_ASSERT(is_raw_number());
+        return str_.subview();
+    }
+
     /** Return `true` if this is a signed integer
 
         This function is used to determine if the underlying
@@ -3246,6 +3513,61 @@ public:
     }
 /** @} */
 
+    /** Remove an element and return it.
+
+        This function removes an element of the
+        underlying object and returns its mapped
+        value as its own document, or throws an
+        exception if the value is not an object.
+        The subtree is transferred by pilfering; no
+        deep copy is made regardless of its size,
+        and the result shares ownership of the
+        memory resource. This is useful for
+        splitting one parsed document into many
+        without copying.
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param key The key of the element to remove.
+
+        @return `this->as_object().extract( key )`.
+    */
+    value
+    extract(string_view key)
+    {
+        return as_object().extract(key);
+    }
+
+    /** Remove an element and return it.
+
+        This function removes an element of the
+        underlying array and returns it as its own
+        document, or throws an exception if the
+        value is not an array. The subtree is
+        transferred by pilfering; no deep copy is
+        made regardless of its size, and the result
+        shares ownership of the memory resource.
+
+        @par Complexity
+        Linear in `this->get_array().size() - pos`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param pos A zero-based array index.
+
+        @return `this->as_array().extract( pos )`.
+    */
+    value
+    extract(std::size_t pos)
+    {
+        return as_array().extract(pos);
+    }
+
     /** Access an element via JSON Pointer.
 
         This function is used to access a (potentially nested)
@@ -3320,6 +3642,64 @@ public:
     find_pointer(string_view ptr, std::error_code& ec) noexcept;
 /** @} */
 
+    /** Return a pointer to an element via a precompiled JSON Pointer.
+
+        This function is used to access a (potentially nested)
+        element of the value using a @ref json::pointer, which
+        holds the pointer string already parsed into reference
+        tokens. When the same pointer is resolved against many
+        documents, compiling it once avoids repeating the
+        tokenization on every call.
+
+        @par Complexity
+        Linear in the number of reference tokens.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param ptr The compiled pointer.
+
+        @param ec Set to the error, if any occurred.
+
+        @return pointer to the element identified by `ptr`.
+
+        @see @ref json::pointer,
+        <a href="https://datatracker.ietf.org/doc/html/rfc6901">
+            RFC 6901 - JavaScript Object Notation (JSON) Pointer</a>
+    */
+/** @{ */
+    BOOST_JSON_DECL
+    value const*
+    find_pointer(pointer const& ptr, error_code& ec) const noexcept;
+
+    BOOST_JSON_DECL
+    value*
+    find_pointer(pointer const& ptr, error_code& ec) noexcept;
+/** @} */
+
+    /** Access an element via a precompiled JSON Pointer.
+
+        This function is used to access a (potentially nested)
+        element of the value using a @ref json::pointer.
+
+        @par Complexity
+        Linear in the number of reference tokens.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param ptr The compiled pointer.
+
+        @return reference to the element identified by `ptr`.
+
+        @throw system_error an error occurred.
+
+        @see @ref json::pointer
+    */
+    BOOST_JSON_DECL
+    value const&
+    at_pointer(pointer const& ptr) const&;
+
     //------------------------------------------------------
 
     /** Set an element via JSON Pointer.
@@ -3780,9 +4160,6 @@ class key_value_pair
     using access = detail::access;
 #endif
 
-    BOOST_JSON_DECL
-    static char const empty_[1];
-
     inline
     key_value_pair(
         pilfered<json::value> k,
@@ -3800,10 +4177,16 @@ public:
     */
     ~key_value_pair() noexcept
     {
-        auto const& sp = value_.storage();
-        if(sp.is_not_shared_and_deallocate_is_trivial())
+        // short keys live inside the
+        // element and own no storage
+        if(len_ <= inline_chars_)
             return;
-        if(key_ == empty_)
+        auto const& sp = value_.storage();
+        // only the key buffer is released
+        // here, so a trivial deallocate may
+        // be skipped even when ownership of
+        // the resource is shared
+        if(sp.is_deallocate_trivial())
             return;
         sp->deallocate(const_cast<char*>(key_),
             len_ + 1, alignof(char));
@@ -3872,11 +4255,15 @@ public:
     key_value_pair(
         key_value_pair&& other) noexcept
         : value_(std::move(other.value_))
-        , key_(detail::exchange(
-            other.key_, empty_))
         , len_(detail::exchange(
             other.len_, 0))
     {
+        // copies either the key pointer or
+        // the inline characters; len_ says
+        // which representation is active
+        std::memcpy(buf_, other.buf_,
+            sizeof(buf_));
+        other.buf_[0] = 0;
     }
 
     /** Pilfer constructor.
@@ -3904,11 +4291,12 @@ public:
     key_value_pair(
         pilfered<key_value_pair> other) noexcept
         : value_(pilfer(other.get().value_))
-        , key_(detail::exchange(
-            other.get().key_, empty_))
         , len_(detail::exchange(
             other.get().len_, 0))
     {
+        std::memcpy(buf_,
+            other.get().buf_, sizeof(buf_));
+        other.get().buf_[0] = 0;
     }
 
     /** Constructor.
@@ -3931,6 +4319,17 @@ public:
         Args&&... args)
         : value_(std::forward<Args>(args)...)
     {
+        if(key.size() <= inline_chars_)
+        {
+            // short keys are stored in the
+            // element itself; no allocation
+            std::memcpy(buf_,
+                key.data(), key.size());
+            buf_[key.size()] = 0;
+            len_ = static_cast<
+                std::uint32_t>(key.size());
+            return;
+        }
         if(key.size() > string::max_size())
         {
             BOOST_STATIC_CONSTEXPR source_location loc = BOOST_CURRENT_LOCATION;
@@ -4037,7 +4436,7 @@ public:
     string_view const
     key() const noexcept
     {
-        return { key_, len_ };
+        return { key_c_str(), len_ };
     }
 
     /** Return the key of this element as a null-terminated string.
@@ -4051,7 +4450,8 @@ public:
     char const*
     key_c_str() const noexcept
     {
-        return key_;
+        return len_ <= inline_chars_ ?
+            buf_ : key_;
     }
 
     /** Return the value of this element.
@@ -4083,8 +4483,27 @@ public:
     /* @} */
 
 private:
+    /*  Keys of at most inline_chars_
+        characters are stored in buf_, inside
+        the element; longer keys live in a
+        separate allocation owned by the
+        element and addressed by key_. The
+        representation is selected by len_
+        alone, never by a pointer into the
+        element, so elements remain trivially
+        relocatable by memcpy; the containing
+        object depends on this when it erases
+        and rehashes.
+    */
+    static constexpr std::size_t
+        inline_chars_ = 15;
+
     json::value value_;
-    char const* key_;
+    union
+    {
+        char const* key_;
+        char buf_[inline_chars_ + 1];
+    };
     std::uint32_t len_;
     std::uint32_t next_;
 };
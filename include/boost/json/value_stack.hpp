@@ -12,6 +12,7 @@
 
 #include <boost/json/detail/config.hpp>
 #include <boost/json/error.hpp>
+#include <boost/json/parse_options.hpp>
 #include <boost/json/storage_ptr.hpp>
 #include <boost/json/value.hpp>
 #include <stddef.h>
@@ -126,12 +127,16 @@ class value_stack
 
         storage_ptr sp_;
         void* temp_;
+        std::size_t temp_size_;
         value* begin_;
         value* top_;
         value* end_;
         // string starts at top_+1
         std::size_t chars_ = 0;
         bool run_dtors_ = true;
+#ifdef BOOST_JSON_PARSE_STATS
+        std::uint64_t allocated_ = 0;
+#endif
 
     public:
         inline ~stack();
@@ -143,19 +148,64 @@ class value_stack
         inline bool has_chars();
 
         inline void clear() noexcept;
+        inline void shrink_to_fit() noexcept;
         inline void maybe_grow();
         inline void grow_one();
         inline void grow(std::size_t nchars);
+        inline void reserve(std::size_t n);
+        inline void reserve_chars(std::size_t n);
 
         inline void append(string_view s);
         inline string_view release_string() noexcept;
+        inline value* peek(std::size_t n) noexcept;
         inline value* release(std::size_t n) noexcept;
         template<class... Args> value& push(Args&&... args);
         template<class Unchecked> void exchange(Unchecked&& u);
+
+#ifdef BOOST_JSON_PARSE_STATS
+        std::uint64_t
+        allocated() const noexcept
+        {
+            return allocated_;
+        }
+#endif
+    };
+
+    // Caches the arena copies of recently pushed
+    // keys so that documents repeating the same
+    // keys allocate each distinct key only once.
+    // Only used when the resource's deallocate is
+    // trivial, since cached keys are then shared
+    // by multiple elements.
+    struct key_entry
+    {
+        char const* str;
+        std::uint32_t len;
     };
 
     stack st_;
     storage_ptr sp_;
+    // the pointer elements are constructed
+    // with; a non-owning alias of sp_ in
+    // single-storage mode
+    storage_ptr esp_;
+    key_entry keys_[64];
+    bool reuse_keys_ = false;
+    bool raw_numbers_ = false;
+    bool single_storage_ = false;
+    // whether the current document is being
+    // built with aliased element pointers
+    bool elided_ = false;
+    // non-empty when arrays of key/value
+    // pair objects are built as objects
+    string_view pair_key_;
+    string_view pair_value_;
+    duplicate_keys dup_keys_ =
+        duplicate_keys::last;
+
+    BOOST_JSON_DECL
+    bool
+    maybe_push_pairs(std::size_t n);
 
 public:
     /// Copy constructor (deleted)
@@ -254,6 +304,91 @@ public:
     value
     release() noexcept;
 
+    /** Reserve temporary storage.
+
+        This function ensures that pushing up to
+        `n` additional values will not reallocate
+        the temporary storage used to buffer
+        elements. Callers which know the number
+        of elements in advance, such as parsers
+        operating on complete buffers, can use
+        this to avoid repeated growth while a
+        document is built.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param n The number of additional values
+        for which storage should be reserved.
+    */
+    BOOST_JSON_DECL
+    void
+    reserve(std::size_t n);
+
+    /** Reserve space for string characters.
+
+        This function ensures that building a
+        string of up to `n` characters total
+        with @ref push_chars followed by
+        @ref push_string or @ref push_key will
+        not reallocate the temporary storage
+        used to buffer elements. Callers which
+        can measure a string before appending
+        its parts, such as parsers scanning a
+        complete token, can use this to avoid
+        repeated growth while the string is
+        accumulated. Characters already pushed
+        count towards `n`.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param n The total number of characters
+        for which storage should be reserved.
+    */
+    BOOST_JSON_DECL
+    void
+    reserve_chars(std::size_t n);
+
+    /** Return excess temporary storage to the memory resource.
+
+        The temporary storage used to buffer
+        elements is retained at its high-water
+        mark across calls to @ref reset, so that
+        building many values in a loop performs
+        no allocations in the steady state. This
+        function releases that storage, returning
+        the stack to its construction-time state.
+        It may only be called when the stack does
+        not contain partial results; that is,
+        after @ref release or @ref reset.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    shrink_to_fit() noexcept;
+
+#ifdef BOOST_JSON_PARSE_STATS
+    /** Return the number of bytes allocated for temporary storage.
+
+        The count is cumulative over the lifetime
+        of the stack and is never reset. Only
+        available when `BOOST_JSON_PARSE_STATS`
+        is defined.
+    */
+    std::uint64_t
+    allocated() const noexcept
+    {
+        return st_.allocated();
+    }
+#endif
+
     //--------------------------------------------
 
     /** Push an array formed by popping `n` values from the stack.
@@ -294,6 +429,14 @@ public:
 
         @endcode
 
+        @par Pair Arrays
+
+        If member names were set with
+        @ref pair_arrays and every popped value
+        is a matching pair object, an
+        @ref object keyed by the popped key
+        members is pushed instead of the array.
+
         @param n The number of values to pop from the
         top of the stack to form the array.
     */
@@ -349,8 +492,13 @@ public:
 
         If there are object elements with duplicate keys;
         that is, if multiple elements in an object have
-        keys that compare equal, only the last equivalent
-        element will be inserted.
+        keys that compare equal, they are resolved
+        according to the policy set by
+        @ref on_duplicate_key. By default only the last
+        equivalent element will be inserted; with
+        @ref duplicate_keys::error the function throws
+        a `boost::system::system_error` with code
+        @ref error::duplicate_key.
 
         @param n The number of key/value pairs to pop from the
         top of the stack to form the array.
@@ -359,6 +507,163 @@ public:
     void
     push_object(std::size_t n);
 
+    /** Set the policy for duplicate object keys.
+
+        This function selects what @ref push_object
+        does when the popped elements contain
+        duplicate keys. The setting persists across
+        calls to @ref reset.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param policy The policy to use.
+
+        @see @ref duplicate_keys
+    */
+    void
+    on_duplicate_key(
+        duplicate_keys policy) noexcept
+    {
+        dup_keys_ = policy;
+    }
+
+    /** Set whether numbers are captured as text.
+
+        When set, callers which produce numbers
+        from parsed text use @ref push_raw_number
+        instead of the converting push functions,
+        preserving the original numeral exactly.
+        The setting persists across calls to
+        @ref reset.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param v `true` to capture number text.
+
+        @see @ref push_raw_number
+    */
+    void
+    raw_numbers(bool v) noexcept
+    {
+        raw_numbers_ = v;
+    }
+
+    /** Return `true` if numbers are captured as text.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see @ref push_raw_number
+    */
+    bool
+    raw_numbers() const noexcept
+    {
+        return raw_numbers_;
+    }
+
+    /** Set whether elements share ownership of the resource.
+
+        When set, elements of the built document
+        hold non-owning pointers to the memory
+        resource passed to @ref reset; only the
+        value returned by @ref release keeps the
+        resource alive. For resources created
+        with @ref make_shared_resource this
+        removes the two reference count
+        adjustments otherwise performed for
+        every element pushed. Elements detached
+        from the released document do not keep
+        the resource alive; the caller must
+        preserve the top-level value, or the
+        resource itself, for as long as any
+        detached element is used. The setting
+        persists across calls to @ref reset and
+        takes effect at the next call.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param v `true` to construct elements
+        with non-owning pointers.
+    */
+    void
+    single_storage(bool v) noexcept
+    {
+        single_storage_ = v;
+    }
+
+    /** Return `true` if elements are built with non-owning pointers.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see @ref single_storage
+    */
+    bool
+    single_storage() const noexcept
+    {
+        return single_storage_;
+    }
+
+    /** Set the member names for building objects from arrays of pairs.
+
+        When both names are non-empty,
+        @ref push_array first checks whether
+        every popped value is an object with
+        exactly two members: `key_name`,
+        holding a string, and `value_name`.
+        If so, an @ref object keyed by those
+        strings is pushed instead of the
+        array; the value members are adopted
+        without copying. Arrays with any
+        non-matching element, and empty
+        arrays, are built normally. Duplicate
+        keys are resolved according to
+        @ref on_duplicate_key.
+
+        The referenced characters are not
+        copied; they must remain valid until
+        the names are changed or the stack is
+        destroyed. Passing an empty name
+        disables the transform. The setting
+        persists across calls to @ref reset.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param key_name The name of the member
+        holding the element key.
+
+        @param value_name The name of the member
+        holding the element value.
+
+        @see @ref push_array
+    */
+    void
+    pair_arrays(
+        string_view key_name,
+        string_view value_name) noexcept
+    {
+        pair_key_ = key_name;
+        pair_value_ = value_name;
+    }
+
+    /** Return `true` if arrays of pair objects are built as objects.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @see @ref pair_arrays
+    */
+    bool
+    pair_arrays() const noexcept
+    {
+        return ! pair_key_.empty() &&
+            ! pair_value_.empty();
+    }
+
     /** Push part of a key or string onto the stack.
 
         This function pushes the characters in `s` onto
@@ -420,10 +725,44 @@ public:
         Calls to `memory_resource::allocate` may throw.
 
         @param s The characters to append. This may be empty.
+
+        @param unescaped When set, and no
+        characters were previously pushed, the
+        resulting string is marked as needing no
+        escaping when serialized. Callers set this
+        when `s` was produced by a parse which
+        processed no escape sequence.
     */
     BOOST_JSON_DECL
     void
     push_string(
+        string_view s,
+        bool unescaped = false);
+
+    /** Place a pre-formatted number onto the stack.
+
+        This function notionally removes all the
+        characters currently on the stack, then
+        pushes a @ref value holding the numeral
+        text formed by appending `s` to the
+        removed characters, marked so that the
+        serializer emits the characters verbatim,
+        without quotes. The caller is responsible
+        for ensuring that the characters form a
+        valid JSON number.
+
+        @par Exception Safety
+
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param s The characters to append. This may be empty.
+
+        @see @ref raw_numbers
+    */
+    BOOST_JSON_DECL
+    void
+    push_raw_number(
         string_view s);
 
     /** Push a number onto the stack
@@ -502,6 +841,36 @@ public:
     BOOST_JSON_DECL
     void
     push_null();
+
+    /** Push an existing value onto the stack
+
+        This function pushes a previously
+        constructed value onto the stack, where
+        it behaves exactly as if it had been
+        built in place; it may serve as an
+        array element, as the value of a
+        key/value pair, or as the top-level
+        result.
+
+        If `jv` uses the same memory resource
+        which was passed to @ref reset, its
+        contents are adopted without copying
+        and `jv` is left null. Otherwise an
+        element using the correct resource is
+        copy-constructed from `jv`, which is
+        unchanged.
+
+        @par Exception Safety
+
+        Basic guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param jv The value to push.
+    */
+    BOOST_JSON_DECL
+    void
+    push_value(
+        value&& jv);
 };
 
 } // namespace json
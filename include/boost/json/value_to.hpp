@@ -33,6 +33,11 @@ namespace json {
     arrays, arithmetic types, `bool`, `std::tuple`, `std::pair`,
     `std::variant`, `std::optional`, `std::monostate`, and `std::nullopt_t`.
 
+    Non-owning destinations are supported for strings: @ref string_view,
+    and containers of it, are constructed directly over the characters
+    owned by `jv` without copying them. Such results are valid only as
+    long as `jv` is alive and unmodified.
+
     Conversion of other types is done by calling an overload of `tag_invoke`
     found by argument-dependent lookup. Its signature should be similar to:
 
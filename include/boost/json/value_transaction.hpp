@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_VALUE_TRANSACTION_HPP
+#define BOOST_JSON_VALUE_TRANSACTION_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/value.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace json {
+
+/** Speculative mutation of values in a monotonic arena.
+
+    This class groups mutations of a @ref value owned by
+    a @ref monotonic_resource into a transaction which
+    either commits or leaves the document exactly as it
+    was. On construction it marks the arena with
+    @ref monotonic_resource::mark; each slot to be
+    replaced is registered with @ref modify before being
+    assigned; @ref rollback restores every registered
+    slot and returns the arena to the mark, while
+    @ref commit keeps the new state. A transaction
+    which is destroyed without committing rolls back.
+
+    This works because a monotonic arena never reuses
+    memory: the subtrees displaced by an assignment
+    remain intact in storage allocated before the mark,
+    so restoring a slot's previous representation brings
+    them back, and everything allocated after the mark
+    is reclaimed in one step.
+
+    @par Usage
+
+    @code
+    monotonic_resource mr;
+    value jv = parse( input, &mr );
+
+    value_transaction tx( mr );
+    tx.modify( jv.at( "config" ) ) = parse( patch, &mr );
+    if( valid( jv ) )
+        tx.commit();
+    // otherwise ~value_transaction restores jv
+    @endcode
+
+    @par Constraints
+
+    Only whole-slot replacement through @ref modify is
+    undone. Mutating the interior of a container which
+    existed before the transaction, such as erasing
+    elements or inserting into spare capacity, is not
+    tracked; build the replacement and assign it through
+    the registered slot instead. Every modified value
+    must be owned by the transaction's resource, and no
+    allocation from the resource may outlive a rollback.
+
+    @par Thread Safety
+
+    Distinct instances may be accessed concurrently.
+    Like the arena it guards, an instance may not be
+    accessed concurrently from multiple threads.
+
+    @see
+        @ref monotonic_resource::mark,
+        @ref monotonic_resource::rollback.
+*/
+class value_transaction
+{
+    // prior representation of a registered slot
+    struct undo
+    {
+        value* slot;
+        alignas(value)
+        unsigned char bits[sizeof(value)];
+    };
+
+    monotonic_resource& mr_;
+    monotonic_resource::checkpoint cp_;
+    std::vector<undo> log_;
+    bool active_ = true;
+
+public:
+    /// Copy constructor (deleted)
+    value_transaction(
+        value_transaction const&) = delete;
+
+    /// Copy assignment (deleted)
+    value_transaction& operator=(
+        value_transaction const&) = delete;
+
+    /** Destructor.
+
+        If neither @ref commit nor @ref rollback was
+        called, the transaction rolls back.
+    */
+    BOOST_JSON_DECL
+    ~value_transaction();
+
+    /** Constructor.
+
+        The transaction marks the current allocation
+        state of `mr`. The resource must outlive the
+        transaction, and between construction and
+        @ref commit or @ref rollback it may only be
+        used through values registered with
+        @ref modify or for new allocations.
+
+        @par Exception Safety
+        No-throw guarantee.
+
+        @param mr The resource owning the values to
+        be mutated.
+    */
+    BOOST_JSON_DECL
+    explicit
+    value_transaction(
+        monotonic_resource& mr) noexcept;
+
+    /** Register a slot for mutation.
+
+        The current representation of `jv` is recorded
+        so that @ref rollback can restore it, and `jv`
+        is returned for assignment. The subtree `jv`
+        currently holds remains valid in the arena and
+        is resurrected on rollback.
+
+        `jv` must be owned by the transaction's
+        resource, and the transaction must be active.
+        Registering the same slot twice is harmless.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to `memory_resource::allocate` may throw.
+
+        @param jv The value to be replaced.
+
+        @return `jv`.
+    */
+    BOOST_JSON_DECL
+    value&
+    modify(value& jv);
+
+    /** Keep all mutations.
+
+        The undo log is discarded and the transaction
+        becomes inactive. Storage displaced by the
+        mutations stays allocated until the resource
+        is released, as with any monotonic allocation.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    commit() noexcept;
+
+    /** Undo all mutations.
+
+        Every slot registered with @ref modify is
+        restored to the representation it had when
+        registered, in reverse order, and the arena
+        is rolled back to the mark taken at
+        construction. All values allocated from the
+        resource after construction become invalid.
+        The transaction becomes inactive.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_JSON_DECL
+    void
+    rollback() noexcept;
+
+    /** Return true if the transaction is active.
+
+        A transaction is active from construction
+        until @ref commit or @ref rollback.
+    */
+    bool
+    active() const noexcept
+    {
+        return active_;
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -0,0 +1,481 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#ifndef BOOST_JSON_WRITER_HPP
+#define BOOST_JSON_WRITER_HPP
+
+#include <boost/json/detail/config.hpp>
+#include <boost/json/serialize_options.hpp>
+#include <boost/json/string_view.hpp>
+#include <boost/json/detail/serialize_into.hpp>
+#include <boost/json/detail/stack.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace json {
+
+/** A forward-only streaming JSON writer.
+
+    This class emits a JSON document directly
+    into a sink, one event at a time, without
+    building a @ref value first. It is the
+    write-side analogue of @ref value_stack:
+    the caller issues `begin_object`, `key`,
+    scalar values, and `end_object` style calls
+    in document order, and the corresponding
+    text is produced immediately using the same
+    escaping and number formatting as
+    @ref serializer.
+
+    The type `Sink` must meet the sink
+    requirements of @ref serializer::read_into,
+    exposing `prepare(n)` and `commit(n)`.
+    Because every event writes through to the
+    sink before returning, the writer holds no
+    buffered output; the sink alone decides how
+    bytes are accumulated or flushed.
+
+    @par Usage
+
+    Events must form exactly one valid JSON
+    document: a scalar, or a balanced tree of
+    objects and arrays in which every object
+    member is preceded by @ref key. Issuing
+    events out of order is undefined behavior;
+    the order is checked by `BOOST_ASSERT` only,
+    as in @ref value_stack.
+
+    @par Example
+    @code
+    writer< sink_type > w( sink );
+    w.begin_object();
+    w.key( "name" ).value( "quote" );
+    w.key( "bids" ).begin_array();
+    w.value( 100 ).value( 101 );
+    w.end_array();
+    w.end_object();
+    assert( w.done() );
+    @endcode
+
+    @par Thread Safety
+    Distinct instances may be accessed
+    concurrently. Non-const member functions of
+    a shared instance may not be called
+    concurrently.
+*/
+template< class Sink >
+class writer
+{
+    struct frame
+    {
+        char kind;
+        bool any;
+    };
+
+    detail::sink_writer<Sink> w_;
+    detail::stack st_;
+    char kind_ = 0;
+    bool any_ = false;
+    bool key_ = false;
+    bool done_ = false;
+
+public:
+    /// Copy constructor (deleted)
+    writer( writer const& ) = delete;
+
+    /// Copy assignment (deleted)
+    writer& operator=( writer const& ) = delete;
+
+    /** Constructor.
+
+        The writer is ready to emit one
+        document into `sink`. Ownership of the
+        sink is not transferred; the caller is
+        responsible for ensuring its lifetime
+        extends until the writer is destroyed.
+
+        @param sink The object to write to.
+
+        @param opts The options for the
+        produced text. If this parameter is
+        omitted, the writer emits compact,
+        standard JSON.
+    */
+    explicit
+    writer(
+        Sink& sink,
+        serialize_options const& opts = {} ) noexcept
+        : w_( sink, opts )
+    {
+    }
+
+    /** Return true when a complete document has been emitted.
+
+        When this returns `true`, no further
+        events may be issued until @ref reset
+        is called.
+    */
+    bool
+    done() const noexcept
+    {
+        return done_;
+    }
+
+    /** Prepare to write another document.
+
+        The writer is returned to its initial
+        state, keeping the same sink and
+        options. This may only be called when
+        no document is in progress, that is
+        before the first event or after
+        @ref done returns `true`.
+    */
+    void
+    reset() noexcept
+    {
+        st_.clear();
+        kind_ = 0;
+        any_ = false;
+        key_ = false;
+        done_ = false;
+    }
+
+    /** Open a new object.
+
+        A matching call to @ref end_object
+        must follow the object's members.
+
+        @return `*this`
+    */
+    writer&
+    begin_object()
+    {
+        prefix();
+        st_.push( frame{ kind_, any_ } );
+        kind_ = '{';
+        any_ = false;
+        key_ = false;
+        w_.write('{');
+        return *this;
+    }
+
+    /** Close the current object.
+
+        @return `*this`
+    */
+    writer&
+    end_object()
+    {
+        BOOST_ASSERT( kind_ == '{' && ! key_ );
+        if( any_ )
+            w_.leave();
+        w_.write('}');
+        pop();
+        return *this;
+    }
+
+    /** Open a new array.
+
+        A matching call to @ref end_array
+        must follow the array's elements.
+
+        @return `*this`
+    */
+    writer&
+    begin_array()
+    {
+        prefix();
+        st_.push( frame{ kind_, any_ } );
+        kind_ = '[';
+        any_ = false;
+        key_ = false;
+        w_.write('[');
+        return *this;
+    }
+
+    /** Close the current array.
+
+        @return `*this`
+    */
+    writer&
+    end_array()
+    {
+        BOOST_ASSERT( kind_ == '[' );
+        if( any_ )
+            w_.leave();
+        w_.write(']');
+        pop();
+        return *this;
+    }
+
+    /** Write the key of the next object member.
+
+        The current container must be an
+        object, and the next event must supply
+        the member's value.
+
+        @return `*this`
+
+        @param sv The key, as an unescaped
+        UTF-8 string.
+    */
+    writer&
+    key( string_view sv )
+    {
+        BOOST_ASSERT( kind_ == '{' && ! key_ && ! done_ );
+        if( any_ )
+            w_.comma();
+        else
+        {
+            w_.enter();
+            any_ = true;
+        }
+        w_.write_string( sv );
+        w_.colon();
+        key_ = true;
+        return *this;
+    }
+
+    /** Write a string value.
+
+        @return `*this`
+
+        @param sv The value, as an unescaped
+        UTF-8 string.
+    */
+    writer&
+    value( string_view sv )
+    {
+        prefix();
+        w_.write_string( sv );
+        finish();
+        return *this;
+    }
+
+    /** Write a string value.
+
+        @return `*this`
+
+        @param s A null-terminated string.
+    */
+    writer&
+    value( char const* s )
+    {
+        return value( string_view(s) );
+    }
+
+    /** Write a number value.
+
+        @return `*this`
+
+        @param v The number to write.
+    */
+    writer&
+    value( long long v )
+    {
+        prefix();
+        w_.write_int64( v );
+        finish();
+        return *this;
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( unsigned long long v )
+    {
+        prefix();
+        w_.write_uint64( v );
+        finish();
+        return *this;
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( double v )
+    {
+        prefix();
+        w_.write_double( v );
+        finish();
+        return *this;
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( signed char v )
+    {
+        return value( static_cast<long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( short v )
+    {
+        return value( static_cast<long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( int v )
+    {
+        return value( static_cast<long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( long v )
+    {
+        return value( static_cast<long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( unsigned char v )
+    {
+        return value( static_cast<unsigned long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( unsigned short v )
+    {
+        return value( static_cast<unsigned long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( unsigned int v )
+    {
+        return value( static_cast<unsigned long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( unsigned long v )
+    {
+        return value( static_cast<unsigned long long>(v) );
+    }
+
+    /// @copydoc value(long long)
+    writer&
+    value( float v )
+    {
+        return value( static_cast<double>(v) );
+    }
+
+    /** Write a boolean value.
+
+        @return `*this`
+
+        @param v The value to write.
+    */
+    writer&
+    value( bool v )
+    {
+        prefix();
+        if( v )
+            w_.write( "true", 4 );
+        else
+            w_.write( "false", 5 );
+        finish();
+        return *this;
+    }
+
+    /** Write a null value.
+
+        @return `*this`
+    */
+    writer&
+    value( std::nullptr_t )
+    {
+        prefix();
+        w_.write( "null", 4 );
+        finish();
+        return *this;
+    }
+
+    /** Write a pre-serialized JSON value.
+
+        The characters are copied to the sink
+        verbatim in place of a single value,
+        skipping escaping and structure
+        walking. This allows cached serialized
+        fragments to be embedded in a larger
+        document without re-parsing them.
+
+        The caller must ensure that `sv` holds
+        exactly one complete, valid JSON value;
+        this is not checked, and text which
+        violates it produces invalid output.
+        The fragment is emitted as-is even when
+        pretty-printing options are in effect.
+
+        @return `*this`
+
+        @param sv The serialized JSON text to
+        write verbatim.
+    */
+    writer&
+    raw_json( string_view sv )
+    {
+        BOOST_ASSERT( ! sv.empty() );
+        prefix();
+        w_.write( sv.data(), sv.size() );
+        finish();
+        return *this;
+    }
+
+private:
+    // establish the position of the next
+    // value: separate array elements, and
+    // consume a previously written key
+    void
+    prefix()
+    {
+        BOOST_ASSERT( ! done_ );
+        if( kind_ == '[' )
+        {
+            if( any_ )
+                w_.comma();
+            else
+            {
+                w_.enter();
+                any_ = true;
+            }
+        }
+        else if( kind_ == '{' )
+        {
+            BOOST_ASSERT( key_ );
+            key_ = false;
+        }
+    }
+
+    void
+    finish()
+    {
+        if( kind_ == 0 )
+            done_ = true;
+    }
+
+    void
+    pop()
+    {
+        frame f;
+        st_.pop( f );
+        kind_ = f.kind;
+        any_ = f.any;
+        key_ = false;
+        finish();
+    }
+};
+
+} // namespace json
+} // namespace boost
+
+#endif
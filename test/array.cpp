@@ -229,6 +229,32 @@ public:
                 check(a2);
                 check_storage(a2, storage_ptr{});
             }
+
+            {
+                // long scalar runs are copied
+                // bitwise; every copy must still
+                // hold the new array's storage
+                array a1;
+                for(int i = 0; i < 100; ++i)
+                {
+                    a1.emplace_back(i);
+                    a1.emplace_back(i + 0.5);
+                    a1.emplace_back(i % 2 == 0);
+                    a1.emplace_back(nullptr);
+                    if(i % 10 == 0)
+                        a1.emplace_back(str_);
+                }
+                auto sp = make_shared_resource<
+                    monotonic_resource>();
+                array a2(a1, sp);
+                BOOST_TEST(a2 == a1);
+                for(auto const& v : a2)
+                    BOOST_TEST(
+                        *v.storage() == *sp);
+                array a3(a2);
+                BOOST_TEST(a3 == a1);
+                check_storage(a3, sp);
+            }
         }
 
         // array(array const&, storage)
@@ -758,14 +784,23 @@ public:
 
             fail_loop([&](storage_ptr const& sp)
             {
+                // the request is honored exactly
                 array a(4, 'c', sp);
                 a.reserve(a.capacity() + 1);
-                auto const new_cap = a.capacity();
-                // 1.5x growth
-                BOOST_TEST(new_cap == 6);
-                a.reserve(new_cap + 1);
-                BOOST_TEST(a.capacity() == 9);
+                BOOST_TEST(a.capacity() == 5);
+                a.reserve(7);
+                BOOST_TEST(a.capacity() == 7);
             });
+
+            // insertions still grow geometrically
+            {
+                array a;
+                a.reserve(4);
+                a.resize(4);
+                a.push_back(1);
+                // 1.5x growth
+                BOOST_TEST(a.capacity() == 6);
+            }
         }
 
         // capacity()
@@ -817,6 +852,17 @@ public:
                 if(a.capacity() != a.size())
                     throw test_failure{};
             });
+
+            // no-op on arena resources, where
+            // reallocating returns nothing
+            {
+                monotonic_resource mr;
+                array a(&mr);
+                a.reserve(10);
+                a.push_back(1);
+                a.shrink_to_fit();
+                BOOST_TEST(a.capacity() == 10);
+            }
         }
     }
 
@@ -1035,6 +1081,84 @@ public:
             check(a);
         }
 
+        // remove_if(pred)
+        {
+            {
+                array a({1, true, nullptr, 2, nullptr, 3});
+                BOOST_TEST(a.remove_if(
+                    [](value& v)
+                    {
+                        return v.is_null();
+                    }) == 2);
+                BOOST_TEST(a ==
+                    array({1, true, 2, 3}));
+            }
+
+            // no matches
+            {
+                array a({1, true, str_});
+                BOOST_TEST(a.remove_if(
+                    [](value&)
+                    {
+                        return false;
+                    }) == 0);
+                BOOST_TEST(a ==
+                    array({1, true, str_}));
+            }
+
+            // all matches
+            {
+                array a({1, 2, 3});
+                BOOST_TEST(a.remove_if(
+                    [](value&)
+                    {
+                        return true;
+                    }) == 3);
+                BOOST_TEST(a.empty());
+            }
+
+            // empty
+            {
+                array a;
+                BOOST_TEST(a.remove_if(
+                    [](value&)
+                    {
+                        return true;
+                    }) == 0);
+                BOOST_TEST(a.empty());
+            }
+
+            // subtrees are pilfered, not copied
+            {
+                array a({1, {1, 2, 3}, 2});
+                auto const* p =
+                    a[1].get_array().data();
+                BOOST_TEST(a.remove_if(
+                    [](value& v)
+                    {
+                        return v.is_int64();
+                    }) == 2);
+                BOOST_TEST(a.size() == 1);
+                BOOST_TEST(
+                    a[0].get_array().data() == p);
+            }
+        }
+
+        // extract(pos)
+        {
+            array a({1, true, {1, 2, 3}, str_});
+            auto const* p =
+                a[2].get_array().data();
+            value jv = a.extract(2);
+
+            // the subtree was pilfered, not copied
+            BOOST_TEST(jv.get_array().data() == p);
+            BOOST_TEST(jv == value({1, 2, 3}));
+            check(a);
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                a.extract(a.size()));
+        }
+
         // push_back(value const&)
         {
             // fast path
@@ -1268,6 +1392,83 @@ public:
         });
     }
 
+    void
+    testAppendSpan()
+    {
+        // array(double const*, size_type, storage)
+        {
+            double const d[] = { 1.5, -2.25, 3.0 };
+            array a(d, 3);
+            BOOST_TEST(a.size() == 3);
+            BOOST_TEST(a[0].as_double() == 1.5);
+            BOOST_TEST(a[2].as_double() == 3.0);
+            check_storage(a, storage_ptr{});
+
+            array a0(d, 0);
+            BOOST_TEST(a0.empty());
+
+            fail_loop([&](storage_ptr const& sp)
+            {
+                array b(d, 3, sp);
+                BOOST_TEST(b.size() == 3);
+                check_storage(b, sp);
+            });
+        }
+
+        // array(int64 const*, size_type, storage)
+        {
+            std::int64_t const n[] = { -1, 0, INT64_MAX };
+            array a(n, 3);
+            BOOST_TEST(a.size() == 3);
+            BOOST_TEST(a[0].as_int64() == -1);
+            BOOST_TEST(a[2].as_int64() == INT64_MAX);
+        }
+
+        // array(uint64 const*, size_type, storage)
+        {
+            std::uint64_t const n[] = { 0, UINT64_MAX };
+            array a(n, 2);
+            BOOST_TEST(a.size() == 2);
+            BOOST_TEST(a[1].as_uint64() == UINT64_MAX);
+        }
+
+        // append(double const*, size_type)
+        {
+            double const d[] = { 1.5, 2.5 };
+            array a;
+            a.append(d, 2);
+            a.append(d, 0);
+            a.append(d, 2);
+            BOOST_TEST(a.size() == 4);
+            BOOST_TEST(a[3].as_double() == 2.5);
+
+            // appending preserves existing
+            // elements on reallocation
+            array b;
+            b.emplace_back("x");
+            b.append(d, 2);
+            BOOST_TEST(b.size() == 3);
+            BOOST_TEST(b[0].as_string() == "x");
+            BOOST_TEST(b[2].as_double() == 2.5);
+        }
+
+        // append(int64 const*, size_type)
+        {
+            std::int64_t const n[] = { 7, -8 };
+            array a;
+            a.append(n, 2);
+            BOOST_TEST(a[1].as_int64() == -8);
+        }
+
+        // append(uint64 const*, size_type)
+        {
+            std::uint64_t const n[] = { 9 };
+            array a;
+            a.append(n, 1);
+            BOOST_TEST(a[0].as_uint64() == 9);
+        }
+    }
+
     void
     testEquality()
     {
@@ -1297,6 +1498,109 @@ public:
             array{nullptr, "a", "b"}));
     }
 
+    void
+    testForEach()
+    {
+        // empty
+        {
+            array a;
+            int n = 0;
+            a.for_each(
+                [&](value&)
+                {
+                    ++n;
+                });
+            BOOST_TEST(n == 0);
+        }
+
+        // visits every element in order,
+        // including payload-bearing kinds
+        {
+            array a;
+            for(int i = 0; i < 100; ++i)
+            {
+                a.push_back(i);
+                a.push_back(object({{"k", i}}));
+                a.push_back(array({i, i + 1}));
+                a.push_back(
+                    "a string long enough to "
+                    "not be stored inline");
+            }
+            std::size_t n = 0;
+            a.for_each(
+                [&](value const& v)
+                {
+                    BOOST_TEST(v == a[n]);
+                    ++n;
+                });
+            BOOST_TEST(n == a.size());
+        }
+
+        // mutation through the reference
+        {
+            array a({1, 2, 3});
+            a.for_each(
+                [](value& v)
+                {
+                    v = v.as_int64() + 1;
+                });
+            BOOST_TEST(a == array({2, 3, 4}));
+        }
+    }
+
+    void
+    testCopyKinds()
+    {
+        array a({
+            1, 2.5, "x", -3, 4.5,
+            true, nullptr, "y", 5 });
+
+        // only elements of the matching
+        // kind are copied, in order
+        {
+            double d[9];
+            BOOST_TEST(a.copy_doubles(
+                d, 9) == 2);
+            BOOST_TEST(d[0] == 2.5);
+            BOOST_TEST(d[1] == 4.5);
+        }
+        {
+            std::int64_t i[9];
+            BOOST_TEST(a.copy_int64s(
+                i, 9) == 3);
+            BOOST_TEST(i[0] == 1);
+            BOOST_TEST(i[1] == -3);
+            BOOST_TEST(i[2] == 5);
+        }
+        {
+            string_view sv[9];
+            BOOST_TEST(a.copy_strings(
+                sv, 9) == 2);
+            BOOST_TEST(sv[0] == "x");
+            BOOST_TEST(sv[1] == "y");
+        }
+
+        // extraction stops when the
+        // destination is full
+        {
+            std::int64_t i[2];
+            BOOST_TEST(a.copy_int64s(
+                i, 2) == 2);
+            BOOST_TEST(i[0] == 1);
+            BOOST_TEST(i[1] == -3);
+            BOOST_TEST(a.copy_int64s(
+                i, 0) == 0);
+        }
+
+        // empty array
+        {
+            array e;
+            double d[1];
+            BOOST_TEST(e.copy_doubles(
+                d, 1) == 0);
+        }
+    }
+
     void
     testIssue692()
     {
@@ -1324,8 +1628,11 @@ public:
         testCapacity();
         testModifiers();
         testExceptions();
+        testAppendSpan();
         testEquality();
         testHash();
+        testForEach();
+        testCopyKinds();
         testIssue692();
     }
 };
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// These tests require Boost.Asio; the adapter
+// header is opt-in and the library itself does
+// not depend on Asio, so they compile away
+// when it is absent.
+#if defined(__has_include)
+# if __has_include(<boost/asio/io_context.hpp>)
+#  define BOOST_JSON_TEST_HAS_ASIO
+# endif
+#endif
+
+#include "test_suite.hpp"
+
+#ifdef BOOST_JSON_TEST_HAS_ASIO
+
+// Test that header file is self-contained.
+#include <boost/json/asio.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace boost {
+namespace json {
+
+class asio_test
+{
+public:
+    // a stream which delivers a fixed text
+    // in small chunks and collects writes
+    struct test_stream
+    {
+        asio::io_context& ioc;
+        std::string in;
+        std::string out;
+        std::size_t pos = 0;
+        std::size_t chunk = 3;
+
+        using executor_type =
+            asio::io_context::executor_type;
+
+        executor_type
+        get_executor() noexcept
+        {
+            return ioc.get_executor();
+        }
+
+        template<
+            class MutableBufferSequence,
+            class Handler>
+        void
+        async_read_some(
+            MutableBufferSequence const& b,
+            Handler&& h)
+        {
+            asio::post(ioc,
+                [this, b, h = std::forward<
+                    Handler>(h)]() mutable
+                {
+                    if(pos >= in.size())
+                    {
+                        h(error_code(
+                            asio::error::eof), 0);
+                        return;
+                    }
+                    std::size_t n = std::min(
+                        chunk, in.size() - pos);
+                    n = asio::buffer_copy(b,
+                        asio::buffer(
+                            in.data() + pos, n));
+                    pos += n;
+                    h(error_code(), n);
+                });
+        }
+
+        template<
+            class ConstBufferSequence,
+            class Handler>
+        void
+        async_write_some(
+            ConstBufferSequence const& b,
+            Handler&& h)
+        {
+            asio::post(ioc,
+                [this, b, h = std::forward<
+                    Handler>(h)]() mutable
+                {
+                    std::size_t n = std::min<
+                        std::size_t>(chunk,
+                        asio::buffer_size(b));
+                    out.append(static_cast<
+                        char const*>((*asio::
+                            buffer_sequence_begin(
+                                b)).data()), n);
+                    h(error_code(), n);
+                });
+        }
+    };
+
+    void
+    testParse()
+    {
+        asio::io_context ioc;
+        test_stream ts{ioc};
+        ts.in =
+            "{\"a\":[1,2,3],\"b\":\"chunked\"}";
+
+        stream_parser p;
+        error_code rec;
+        value rv;
+        bool invoked = false;
+        async_parse(ts, p,
+            [&](error_code ec, value jv)
+            {
+                invoked = true;
+                rec = ec;
+                rv = std::move(jv);
+            });
+        ioc.run();
+        BOOST_TEST(invoked);
+        BOOST_TEST(! rec);
+        BOOST_TEST(rv == parse(ts.in));
+    }
+
+    void
+    testParseError()
+    {
+        asio::io_context ioc;
+        test_stream ts{ioc};
+        ts.in = "{\"a\":";
+
+        stream_parser p;
+        error_code rec;
+        bool invoked = false;
+        async_parse(ts, p,
+            [&](error_code ec, value)
+            {
+                invoked = true;
+                rec = ec;
+            });
+        ioc.run();
+        BOOST_TEST(invoked);
+        BOOST_TEST(rec);
+    }
+
+    void
+    testSerialize()
+    {
+        asio::io_context ioc;
+        test_stream ts{ioc};
+        value const jv = parse(
+            "{\"a\":[1,2,3],\"b\":\"chunked\"}");
+
+        serializer sr;
+        sr.reset(&jv);
+        error_code rec;
+        std::size_t total = 0;
+        bool invoked = false;
+        async_serialize(ts, sr,
+            [&](error_code ec, std::size_t n)
+            {
+                invoked = true;
+                rec = ec;
+                total = n;
+            });
+        ioc.run();
+        BOOST_TEST(invoked);
+        BOOST_TEST(! rec);
+        BOOST_TEST(ts.out == serialize(jv));
+        BOOST_TEST(total == ts.out.size());
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testParseError();
+        testSerialize();
+    }
+};
+
+TEST_SUITE(asio_test, "boost.json.asio");
+
+} // namespace json
+} // namespace boost
+
+#else
+
+namespace boost {
+namespace json {
+
+class asio_test
+{
+public:
+    void
+    run()
+    {
+    }
+};
+
+TEST_SUITE(asio_test, "boost.json.asio");
+
+} // namespace json
+} // namespace boost
+
+#endif
@@ -1717,10 +1717,311 @@ public:
         }
     }
 
+    // Records events as a compact string, and
+    // returns parse_directive::skip() for the
+    // value of every key named "skip" and,
+    // optionally, from every on_array_begin.
+    struct skip_handler
+    {
+        constexpr static std::size_t max_object_size = std::size_t(-1);
+        constexpr static std::size_t max_array_size = std::size_t(-1);
+        constexpr static std::size_t max_key_size = std::size_t(-1);
+        constexpr static std::size_t max_string_size = std::size_t(-1);
+
+        std::string events;
+        std::string key;
+        bool skip_arrays = false;
+
+        parse_directive on_document_begin( error_code& ) { return true; }
+        parse_directive on_document_end( error_code& ) { return true; }
+        parse_directive on_object_begin( error_code& )
+        {
+            events += '{';
+            return true;
+        }
+        parse_directive on_object_end( std::size_t n, error_code& )
+        {
+            events += std::to_string(n);
+            events += '}';
+            return true;
+        }
+        parse_directive on_array_begin( error_code& )
+        {
+            events += '[';
+            if(skip_arrays)
+                return parse_directive::skip();
+            return true;
+        }
+        parse_directive on_array_end( std::size_t n, error_code& )
+        {
+            events += std::to_string(n);
+            events += ']';
+            return true;
+        }
+        parse_directive on_key_part( string_view s, std::size_t, error_code& )
+        {
+            key.append(s.data(), s.size());
+            return true;
+        }
+        parse_directive on_key( string_view s, std::size_t, error_code& )
+        {
+            key.append(s.data(), s.size());
+            events += 'k';
+            events += key;
+            bool const skip = key == "skip";
+            key.clear();
+            if(skip)
+                return parse_directive::skip();
+            return true;
+        }
+        parse_directive on_string_part( string_view, std::size_t, error_code& ) { return true; }
+        parse_directive on_string( string_view, std::size_t, error_code& )
+        {
+            events += 's';
+            return true;
+        }
+        parse_directive on_number_part( string_view, error_code& ) { return true; }
+        parse_directive on_int64( std::int64_t, string_view, error_code& )
+        {
+            events += 'i';
+            return true;
+        }
+        parse_directive on_uint64( std::uint64_t, string_view, error_code& )
+        {
+            events += 'u';
+            return true;
+        }
+        parse_directive on_double( double, string_view, error_code& )
+        {
+            events += 'd';
+            return true;
+        }
+        parse_directive on_bool( bool, error_code& )
+        {
+            events += 'b';
+            return true;
+        }
+        parse_directive on_null( error_code& )
+        {
+            events += 'n';
+            return true;
+        }
+        parse_directive on_comment_part( string_view, error_code& ) { return true; }
+        parse_directive on_comment( string_view, error_code& ) { return true; }
+    };
+
+    void
+    checkSkip(
+        string_view s,
+        string_view events,
+        bool good = true,
+        parse_options const& po = parse_options(),
+        bool skip_arrays = false)
+    {
+        // single buffer
+        {
+            basic_parser<skip_handler> p(po);
+            p.handler().skip_arrays = skip_arrays;
+            error_code ec;
+            p.write_some(false, s.data(), s.size(), ec);
+            if(good)
+            {
+                BOOST_TEST(! ec);
+                BOOST_TEST(p.handler().events == events);
+            }
+            else
+            {
+                BOOST_TEST(ec);
+            }
+        }
+        // one character at a time, to
+        // exercise suspend and resume
+        {
+            basic_parser<skip_handler> p(po);
+            p.handler().skip_arrays = skip_arrays;
+            error_code ec;
+            for(std::size_t i = 0;
+                i < s.size() && ! ec; ++i)
+                p.write_some(i + 1 < s.size(),
+                    s.data() + i, 1, ec);
+            if(good)
+            {
+                BOOST_TEST(! ec);
+                BOOST_TEST(p.handler().events == events);
+            }
+            else
+            {
+                BOOST_TEST(ec);
+            }
+        }
+    }
+
+    void
+    testSkip()
+    {
+        parse_options comments;
+        comments.allow_comments = true;
+
+        // skipped member values emit no events,
+        // but still count towards the object size
+        checkSkip( "{\"skip\":1,\"b\":2}", "{kskipkbi2}" );
+        checkSkip( "{\"skip\":null}", "{kskip1}" );
+        checkSkip( "{\"skip\":-1.5e3,\"b\":2}", "{kskipkbi2}" );
+        checkSkip( "{\"skip\":\"\\\" \\\\ [{,\",\"b\":2}",
+            "{kskipkbi2}" );
+        checkSkip(
+            "{\"a\":1,\"skip\":{\"x\":[1,2],\"y\":\"s{]\"},\"b\":[2]}",
+            "{kaikskipkb[i1]3}" );
+        checkSkip( "{\"skip\":[[],{},[{\"q\":[3]}]],\"b\":2}",
+            "{kskipkbi2}" );
+        checkSkip( "{\"skip\" : [ 1 , {\"x\" : 2} ] ,\"b\":2}",
+            "{kskipkbi2}" );
+
+        // escaped keys trigger the skip too
+        checkSkip( "{\"sk\\u0069p\":{\"x\":1},\"b\":2}",
+            "{kskipkbi2}" );
+
+        // containers skipped from on_array_begin
+        // still produce a balanced, empty end event
+        checkSkip( "[1,[2],3]", "[0]", true,
+            parse_options(), true );
+        checkSkip( "{\"a\":[[1],[2]],\"b\":2}",
+            "{ka[0]kbi2}", true, parse_options(), true );
+
+        // comments are skipped structurally
+        checkSkip(
+            "{\"skip\":[1,/*]}*/2,// ]}\n3],\"b\":2}",
+            "{kskipkbi2}", true, comments );
+        checkSkip( "{\"skip\": /* c */ {\"x\":1},\"b\":2}",
+            "{kskipkbi2}", true, comments );
+
+        // malformed skipped content still fails
+        checkSkip( "{\"skip\":,\"b\":2}", "", false );
+        checkSkip( "{\"skip\":[1,2", "", false );
+        checkSkip( "{\"skip\":\"abc", "", false );
+        checkSkip( "{\"skip\":/x/}", "", false, comments );
+        checkSkip( "[1,2}", "", false,
+            parse_options(), true );
+
+        // max_depth applies inside skipped subtrees
+        parse_options shallow;
+        shallow.max_depth = 3;
+        checkSkip( "{\"skip\":[[1]],\"b\":2}",
+            "{kskipkbi2}", true, shallow );
+        checkSkip( "{\"skip\":[[[1]]]}", "", false, shallow );
+    }
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
+    struct noop_handler
+    {
+        constexpr static std::size_t max_object_size = std::size_t(-1);
+        constexpr static std::size_t max_array_size = std::size_t(-1);
+        constexpr static std::size_t max_key_size = std::size_t(-1);
+        constexpr static std::size_t max_string_size = std::size_t(-1);
+
+        bool on_document_begin( error_code& ) { return true; }
+        bool on_document_end( error_code& ) { return true; }
+        bool on_object_begin( error_code& ) { return true; }
+        bool on_object_end( std::size_t, error_code& ) { return true; }
+        bool on_array_begin( error_code& ) { return true; }
+        bool on_array_end( std::size_t, error_code& ) { return true; }
+        bool on_key_part( string_view, std::size_t, error_code& ) { return true; }
+        bool on_key( string_view, std::size_t, error_code& ) { return true; }
+        bool on_string_part( string_view, std::size_t, error_code& ) { return true; }
+        bool on_string( string_view, std::size_t, error_code& ) { return true; }
+        bool on_number_part( string_view, error_code&) { return true; }
+        bool on_int64( std::int64_t, string_view, error_code& ) { return true; }
+        bool on_uint64( std::uint64_t, string_view, error_code& ) { return true; }
+        bool on_double( double, string_view, error_code& ) { return true; }
+        bool on_bool( bool, error_code& ) { return true; }
+        bool on_null( error_code& ) { return true; }
+        bool on_comment_part( string_view, error_code& ) { return true; }
+        bool on_comment( string_view, error_code& ) { return true; }
+    };
+
+    template<class Options>
+    bool
+    accepts(
+        string_view s,
+        parse_options po = parse_options())
+    {
+        basic_parser<noop_handler, Options> p(po);
+        error_code ec;
+        auto const n = p.write_some(
+            false, s.data(), s.size(), ec);
+        if(! ec && n < s.size())
+            ec = error::extra_data;
+        return ! ec;
+    }
+
+    void
+    testStaticOptions()
+    {
+        using strict = static_options<>;
+        using loose = static_options<
+            true, true, true, true>;
+
+        // the fixed flags select the same
+        // behavior the equivalent runtime
+        // options would
+        BOOST_TEST(accepts<strict>("[1,2,3]"));
+        BOOST_TEST(! accepts<strict>("[1,2,]"));
+        BOOST_TEST(! accepts<strict>("//\n[1]"));
+        BOOST_TEST(! accepts<strict>("[Infinity]"));
+        BOOST_TEST(! accepts<strict>("[\"\xff\"]"));
+        BOOST_TEST(accepts<loose>("[1,2,]"));
+        BOOST_TEST(accepts<loose>("// c\n[1]"));
+        BOOST_TEST(accepts<loose>("[Infinity]"));
+        BOOST_TEST(accepts<loose>("[\"\xff\"]"));
+
+        // individual extensions
+        BOOST_TEST(accepts<static_options<
+            true>>("/* c */[1]"));
+        BOOST_TEST(! accepts<static_options<
+            true>>("[1,]"));
+        BOOST_TEST((accepts<static_options<
+            false, true>>("{\"a\":1,}")));
+
+        // the default second parameter keeps
+        // the runtime dispatch
+        parse_options po;
+        po.allow_trailing_commas = true;
+        BOOST_TEST((accepts<parse_options>(
+            "[1,]", po)));
+        BOOST_TEST(! accepts<parse_options>(
+            "[1,]"));
+
+        // max_depth stays dynamic and is
+        // taken from the constructor argument
+        parse_options shallow;
+        shallow.max_depth = 2;
+        BOOST_TEST((! accepts<strict>(
+            "[[[1]]]", shallow)));
+        BOOST_TEST((accepts<strict>(
+            "[[1]]", shallow)));
+
+        // the inline depth only sizes the
+        // embedded suspend stack; parsing is
+        // unaffected on either side of it
+        using deep = static_options<
+            false, false, false, false,
+            number_precision::imprecise, 64>;
+        std::string doc;
+        for(int i = 0; i < 64; ++i)
+            doc += '[';
+        doc += '1';
+        for(int i = 0; i < 64; ++i)
+            doc += ']';
+        parse_options po64;
+        po64.max_depth = 64;
+        BOOST_TEST((accepts<deep>(doc, po64)));
+        BOOST_TEST((! accepts<deep>(doc)));
+        BOOST_TEST((accepts<strict>(doc, po64)));
+    }
+
     void
     run()
     {
@@ -1744,6 +2045,8 @@ public:
         testNumberLiteral();
         testStickyErrors();
         testStdTypes();
+        testSkip();
+        testStaticOptions();
     }
 };
 
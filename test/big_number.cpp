@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/big_number.hpp>
+
+#include <limits>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class big_number_test
+{
+public:
+    void
+    testParse()
+    {
+        // values within uint64 range
+        {
+            big_number const n =
+                parse_big_number("12345678901234567890");
+            BOOST_TEST(n.is_inline());
+            BOOST_TEST(! n.is_negative());
+            BOOST_TEST(n.fits_uint64());
+            BOOST_TEST(n.to_uint64() ==
+                UINT64_C(12345678901234567890));
+        }
+
+        // values beyond uint64 keep full
+        // precision, up to 38 digits inline
+        {
+            big_number const n = parse_big_number(
+                "99999999999999999999999999999999999999");
+            BOOST_TEST(n.is_inline());
+            BOOST_TEST(! n.fits_uint64());
+            BOOST_TEST(n.low64() ==
+                UINT64_C(0x098A223FFFFFFFFF));
+            BOOST_TEST(n.high64() ==
+                UINT64_C(0x4B3B4CA85A86C47A));
+        }
+
+        // negative values
+        {
+            big_number const n = parse_big_number(
+                "-18446744073709551616");
+            BOOST_TEST(n.is_inline());
+            BOOST_TEST(n.is_negative());
+            BOOST_TEST(! n.fits_int64());
+            BOOST_TEST(n.low64() == 0);
+            BOOST_TEST(n.high64() == 1);
+        }
+
+        // 39 digits and beyond fall back to text
+        {
+            std::string const s(39, '9');
+            big_number const n = parse_big_number(s);
+            BOOST_TEST(! n.is_inline());
+            BOOST_TEST(n.text() == s);
+            BOOST_TEST(n.to_string() == s);
+        }
+
+        // negative zero parses as zero
+        {
+            big_number const n = parse_big_number("-0");
+            BOOST_TEST(! n.is_negative());
+            BOOST_TEST(n == parse_big_number("0"));
+            BOOST_TEST(n == big_number());
+        }
+    }
+
+    void
+    testConversion()
+    {
+        auto const imin =
+            std::numeric_limits<std::int64_t>::min();
+        auto const imax =
+            std::numeric_limits<std::int64_t>::max();
+
+        BOOST_TEST(parse_big_number(
+            "-9223372036854775808").fits_int64());
+        BOOST_TEST(parse_big_number(
+            "-9223372036854775808").to_int64() == imin);
+        BOOST_TEST(parse_big_number(
+            "9223372036854775807").to_int64() == imax);
+        BOOST_TEST(! parse_big_number(
+            "-9223372036854775809").fits_int64());
+        BOOST_TEST(! parse_big_number(
+            "9223372036854775808").fits_int64());
+        BOOST_TEST(parse_big_number(
+            "9223372036854775808").fits_uint64());
+        BOOST_TEST(! parse_big_number(
+            "-1").fits_uint64());
+
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            parse_big_number("-1").to_uint64());
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            parse_big_number(
+                "18446744073709551616").to_int64());
+    }
+
+    void
+    testToString()
+    {
+        // round trip through text at every
+        // digit count, crossing the SWAR chunk
+        // width and both 64-bit halves
+        std::string s = "9";
+        for(int i = 1; i <= 45; ++i)
+        {
+            big_number const n = parse_big_number(s);
+            BOOST_TEST(n.to_string() == s);
+            BOOST_TEST(parse_big_number(
+                "-" + s).to_string() == "-" + s);
+            s += '0' + (i % 10);
+        }
+
+        BOOST_TEST(big_number().to_string() == "0");
+    }
+
+    void
+    testErrors()
+    {
+        for(string_view sv : {
+            "", "-", "01", "-01", "1.5", "1e3",
+            "+1", " 1", "1 ", "12x4", "--1" })
+        {
+            error_code ec;
+            big_number const n =
+                parse_big_number(sv, ec);
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(n == big_number());
+        }
+
+        // a bad digit past the SWAR chunk
+        {
+            error_code ec;
+            parse_big_number(
+                "123456789012345678!0", ec);
+            BOOST_TEST(ec == error::syntax);
+        }
+
+        std::error_code sec;
+        parse_big_number("bad", sec);
+        BOOST_TEST(sec);
+
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            parse_big_number("1e5"));
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testConversion();
+        testToString();
+        testErrors();
+    }
+};
+
+TEST_SUITE(big_number_test, "boost.json.big_number");
+
+} // namespace json
+} // namespace boost
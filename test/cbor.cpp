@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/cbor.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+
+#include <initializer_list>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class cbor_test
+{
+public:
+    static
+    std::string
+    bytes(std::initializer_list<int> init)
+    {
+        std::string s;
+        for(int b : init)
+            s.push_back(static_cast<char>(b));
+        return s;
+    }
+
+    void
+    checkRoundTrip(string_view js)
+    {
+        value const jv = parse(js);
+        std::string const b = serialize_cbor(jv);
+        error_code ec;
+        value const jv2 = parse_cbor(b, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv2 == jv);
+    }
+
+    void
+    testRoundTrip()
+    {
+        checkRoundTrip("null");
+        checkRoundTrip("true");
+        checkRoundTrip("false");
+        checkRoundTrip("0");
+        checkRoundTrip("23");
+        checkRoundTrip("24");
+        checkRoundTrip("255");
+        checkRoundTrip("65536");
+        checkRoundTrip("4294967296");
+        checkRoundTrip("9223372036854775807");
+        checkRoundTrip("18446744073709551615");
+        checkRoundTrip("-1");
+        checkRoundTrip("-24");
+        checkRoundTrip("-25");
+        checkRoundTrip("-9223372036854775808");
+        checkRoundTrip("1.5");
+        checkRoundTrip("-2.75e10");
+        checkRoundTrip("\"\"");
+        checkRoundTrip("\"hello\"");
+        checkRoundTrip("[]");
+        checkRoundTrip("{}");
+        checkRoundTrip("[1,[2,[3]],\"x\"]");
+        checkRoundTrip(
+            "{\"a\":1,\"b\":[true,null],"
+            "\"c\":{\"d\":\"e\"}}");
+    }
+
+    void
+    testEncoding()
+    {
+        // shortest-form headers,
+        // known byte sequences
+        BOOST_TEST(serialize_cbor(
+            parse("{\"a\":1}")) ==
+            bytes({0xa1, 0x61, 'a', 0x01}));
+        BOOST_TEST(serialize_cbor(
+            parse("[1,2]")) ==
+            bytes({0x82, 0x01, 0x02}));
+        BOOST_TEST(serialize_cbor(
+            value(-1)) == bytes({0x20}));
+        BOOST_TEST(serialize_cbor(
+            value(24)) == bytes({0x18, 24}));
+        BOOST_TEST(serialize_cbor(
+            value(nullptr)) == bytes({0xf6}));
+        BOOST_TEST(serialize_cbor(
+            value(true)) == bytes({0xf5}));
+    }
+
+    void
+    testDecoding()
+    {
+        error_code ec;
+
+        // indefinite-length containers
+        BOOST_TEST(parse_cbor(bytes(
+            {0x9f, 0x01, 0x02, 0xff}), ec) ==
+                parse("[1,2]"));
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_cbor(bytes(
+            {0xbf, 0x61, 'a', 0x01, 0xff}), ec) ==
+                parse("{\"a\":1}"));
+        BOOST_TEST(! ec);
+
+        // chunked strings
+        BOOST_TEST(parse_cbor(bytes(
+            {0x7f, 0x61, 'a', 0x62, 'b', 'c',
+                0xff}), ec) == value("abc"));
+        BOOST_TEST(! ec);
+
+        // byte strings are stored as strings
+        BOOST_TEST(parse_cbor(bytes(
+            {0x42, 'h', 'i'}), ec) == value("hi"));
+        BOOST_TEST(! ec);
+
+        // tags are ignored
+        BOOST_TEST(parse_cbor(bytes(
+            {0xc0, 0x61, 'x'}), ec) == value("x"));
+        BOOST_TEST(! ec);
+
+        // half and single precision floats
+        BOOST_TEST(parse_cbor(bytes(
+            {0xf9, 0x3e, 0x00}), ec) == value(1.5));
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_cbor(bytes(
+            {0xfa, 0x40, 0x20, 0x00, 0x00}),
+                ec) == value(2.5));
+        BOOST_TEST(! ec);
+
+        // undefined is stored as null
+        BOOST_TEST(parse_cbor(
+            bytes({0xf7}), ec).is_null());
+        BOOST_TEST(! ec);
+    }
+
+    void
+    testErrors()
+    {
+        error_code ec;
+
+        // truncated input
+        parse_cbor(bytes({0x81}), ec);
+        BOOST_TEST(ec == error::incomplete);
+        parse_cbor(bytes({0x61}), ec);
+        BOOST_TEST(ec == error::incomplete);
+
+        // trailing data
+        parse_cbor(bytes({0x01, 0x02}), ec);
+        BOOST_TEST(ec == error::extra_data);
+
+        // stray break
+        parse_cbor(bytes({0xff}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // break in place of a map value
+        parse_cbor(bytes(
+            {0xbf, 0x61, 'a', 0xff}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // map keys must be strings
+        parse_cbor(bytes(
+            {0xa1, 0x01, 0x02}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // negative integer below INT64_MIN
+        parse_cbor(bytes({0x3b, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff}), ec);
+        BOOST_TEST(ec == error::number_too_large);
+
+        // reserved encodings
+        parse_cbor(bytes({0x1c}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // nesting deeper than 32 levels
+        std::string s(33, '\x81');
+        s.push_back('\x01');
+        parse_cbor(s, ec);
+        BOOST_TEST(ec == error::too_deep);
+        s.erase(0, 1);
+        parse_cbor(s, ec);
+        BOOST_TEST(! ec);
+
+        BOOST_TEST_THROWS(
+            parse_cbor(bytes({0x81})),
+            system_error);
+    }
+
+    void
+    testSerializer()
+    {
+        value const jv = parse(
+            "{\"key\":[1,2.5,\"payload\","
+            "{\"n\":null}],\"b\":true}");
+        std::string const whole =
+            serialize_cbor(jv);
+
+        // single-byte reads produce
+        // identical output
+        cbor_serializer sr;
+        BOOST_TEST(sr.done());
+        sr.reset(&jv);
+        std::string pieces;
+        while(! sr.done())
+        {
+            char buf[1];
+            string_view const sv = sr.read(buf);
+            pieces.append(sv.data(), sv.size());
+        }
+        BOOST_TEST(pieces == whole);
+
+        // the serializer is reusable
+        sr.reset(&jv);
+        pieces.clear();
+        while(! sr.done())
+        {
+            char buf[7];
+            string_view const sv = sr.read(buf);
+            pieces.append(sv.data(), sv.size());
+        }
+        BOOST_TEST(pieces == whole);
+    }
+
+    void
+    testStorage()
+    {
+        error_code ec;
+        monotonic_resource mr;
+        value const jv = parse_cbor(
+            serialize_cbor(parse(
+                "{\"a\":[1,2]}")), ec, &mr);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv.storage().get() == &mr);
+    }
+
+    void
+    run()
+    {
+        testRoundTrip();
+        testEncoding();
+        testDecoding();
+        testErrors();
+        testSerializer();
+        testStorage();
+    }
+};
+
+TEST_SUITE(cbor_test, "boost.json.cbor");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/value.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+/*
+    This translation unit is compiled with
+    BOOST_JSON_COMPACT_TABLES defined, which
+    selects the small power-of-five table of
+    the ryu double formatter; the output must
+    not change, only the speed.
+*/
+
+class compact_tables_test
+{
+public:
+    static
+    bool
+    same_bits(double x, double y) noexcept
+    {
+        std::uint64_t bx, by;
+        std::memcpy(&bx, &x, sizeof(bx));
+        std::memcpy(&by, &y, sizeof(by));
+        return bx == by;
+    }
+
+    void
+    testRoundTrip()
+    {
+        // read back with full precision so a
+        // formatter defect cannot hide behind
+        // parser rounding
+        parse_options popt;
+        popt.numbers = number_precision::precise;
+
+        double const cases[] = {
+            0.0, -0.0, 1.0, -1.0,
+            0.1, 0.5, 1.0/3.0,
+            0.30000000000000004,
+            1.7976931348623157e+308,   // max
+            2.2250738585072014e-308,   // min normal
+            4.9406564584124654e-324,   // min subnormal
+            9007199254740993.0,
+            6.022e23, 1e-45, 3.14159265358979323846,
+            123456789.123456789,
+            2.718281828459045,
+            1e308, 1e-308, 5e-324
+        };
+        for(double const d : cases)
+        {
+            value const jv(d);
+            value const jv2 = parse(
+                serialize(jv), {}, popt);
+            BOOST_TEST(same_bits(
+                d, jv2.to_number<double>()));
+        }
+
+        // a sweep of exponents exercises both
+        // signs of the power table
+        for(int e = -300; e <= 300; e += 7)
+        {
+            double const d =
+                std::ldexp(1.2345678901234567, e);
+            value const jv2 = parse(
+                serialize(value(d)), {}, popt);
+            BOOST_TEST(same_bits(
+                d, jv2.to_number<double>()));
+        }
+
+        // the fixed spellings are unchanged
+        BOOST_TEST(serialize(value(1.5)) == "1.5E0");
+        BOOST_TEST(
+            serialize(value(100.0)) == "1E2");
+    }
+
+    void
+    run()
+    {
+        testRoundTrip();
+    }
+};
+
+TEST_SUITE(compact_tables_test, "boost.json.compact_tables");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,159 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/compare.hpp>
+
+#include <boost/json/parse.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class compare_test
+{
+public:
+    void
+    testEqual()
+    {
+        // scalars and small trees fall back
+        // to the serial comparison
+        BOOST_TEST(equal(value(1), value(1)));
+        BOOST_TEST(! equal(value(1), value(2)));
+        BOOST_TEST(! equal(value(1), value("1")));
+        BOOST_TEST(equal(value(1), value(1), 8));
+        BOOST_TEST(! equal(value(1), value(2), 8));
+
+        // large array, every thread count
+        array a1;
+        for(int i = 0; i < 1000; ++i)
+            a1.emplace_back(i);
+        array a2(a1);
+        for(unsigned threads = 1;
+            threads <= 8; ++threads)
+        {
+            BOOST_TEST(equal(
+                value(a1), value(a2), threads));
+        }
+
+        // mismatch in the last chunk
+        a2.back() = -1;
+        for(unsigned threads = 1;
+            threads <= 8; ++threads)
+        {
+            BOOST_TEST(! equal(
+                value(a1), value(a2), threads));
+        }
+
+        // size mismatch
+        a2 = a1;
+        a2.emplace_back(0);
+        BOOST_TEST(! equal(value(a1), value(a2), 4));
+
+        // nested containers within chunks
+        {
+            array n1;
+            for(int i = 0; i < 100; ++i)
+                n1.emplace_back(
+                    parse("{\"k\":[1,2,3]}"));
+            array n2(n1);
+            BOOST_TEST(equal(
+                value(n1), value(n2), 4));
+            n2[50].at("k").at(1) = 0;
+            BOOST_TEST(! equal(
+                value(n1), value(n2), 4));
+        }
+    }
+
+    void
+    testEqualObject()
+    {
+        // objects compare by key, so
+        // element order does not matter
+        object o1;
+        object o2;
+        for(int i = 0; i < 100; ++i)
+            o1.emplace(
+                std::to_string(i), i);
+        for(int i = 99; i >= 0; --i)
+            o2.emplace(
+                std::to_string(i), i);
+        for(unsigned threads = 1;
+            threads <= 8; ++threads)
+        {
+            BOOST_TEST(equal(
+                value(o1), value(o2), threads));
+        }
+
+        // value mismatch
+        o2["42"] = -1;
+        for(unsigned threads = 1;
+            threads <= 8; ++threads)
+        {
+            BOOST_TEST(! equal(
+                value(o1), value(o2), threads));
+        }
+
+        // key mismatch, same size
+        o2 = o1;
+        o2.erase("42");
+        o2.emplace("missing", 42);
+        BOOST_TEST(! equal(value(o1), value(o2), 4));
+
+        // size mismatch
+        o2 = o1;
+        o2.emplace("extra", 0);
+        BOOST_TEST(! equal(value(o1), value(o2), 4));
+    }
+
+    void
+    testHashValue()
+    {
+        value const jv1 = parse(
+            "{\"a\":[1,2,3],\"b\":null}");
+        value const jv2 = parse(
+            "{\"b\":null,\"a\":[1,2,3]}");
+        value const jv3 = parse(
+            "{\"a\":[1,2,4],\"b\":null}");
+
+        // equal values hash equal
+        // for the same seed
+        BOOST_TEST(hash_value(jv1, 0) ==
+            hash_value(jv2, 0));
+        BOOST_TEST(hash_value(jv1, 7331) ==
+            hash_value(jv2, 7331));
+
+        // deterministic
+        BOOST_TEST(hash_value(jv1, 42) ==
+            hash_value(jv1, 42));
+
+        // distinct seeds give
+        // distinct hash streams
+        BOOST_TEST(hash_value(jv1, 0) !=
+            hash_value(jv1, 1));
+
+        // unequal values hash unequal
+        BOOST_TEST(hash_value(jv1, 0) !=
+            hash_value(jv3, 0));
+    }
+
+    void
+    run()
+    {
+        testEqual();
+        testEqualObject();
+        testHashValue();
+    }
+};
+
+TEST_SUITE(compare_test, "boost.json.compare");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/disposer.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/tracing_resource.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class disposer_test
+{
+public:
+    static
+    value
+    make_doc(storage_ptr sp)
+    {
+        // a deep and wide tree with nodes
+        // of every kind
+        array arr(sp);
+        for(int i = 0; i < 200; ++i)
+        {
+            object obj(sp);
+            obj.emplace("id", i);
+            obj.emplace("name",
+                "a string long enough to "
+                "require an allocation " +
+                    std::to_string(i));
+            value deep(sp);
+            for(int j = 0; j < 20; ++j)
+                deep = array(
+                    { std::move(deep) }, sp);
+            obj.emplace("deep",
+                std::move(deep));
+            arr.emplace_back(std::move(obj));
+        }
+        return arr;
+    }
+
+    void
+    testDispose()
+    {
+        // every allocation is returned,
+        // no matter the slice size
+        for(std::size_t slice : {
+            std::size_t(1), std::size_t(7),
+            std::size_t(100000) })
+        {
+            tracing_resource mr;
+            disposer d;
+            BOOST_TEST(d.done());
+            d.adopt(make_doc(&mr));
+            BOOST_TEST(! d.done());
+            std::size_t steps = 0;
+            while(! d.step(slice))
+                ++steps;
+            BOOST_TEST(d.done());
+            if(slice == 1)
+                BOOST_TEST(steps > 1000);
+            auto const st = mr.stats();
+            BOOST_TEST(st.allocations ==
+                st.deallocations);
+            BOOST_TEST(
+                st.bytes_outstanding == 0);
+        }
+    }
+
+    void
+    testImmediate()
+    {
+        // scalars and strings have no
+        // contents to slice
+        disposer d;
+        d.adopt(value(1));
+        d.adopt(value("a string long enough "
+            "to require an allocation"));
+        d.adopt(value());
+        BOOST_TEST(d.done());
+
+        // an arena with unique ownership
+        // skips the walk entirely
+        monotonic_resource mr;
+        d.adopt(make_doc(&mr));
+        BOOST_TEST(d.done());
+    }
+
+    void
+    testMultiple()
+    {
+        // adopted values queue up behind
+        // each other
+        tracing_resource mr;
+        disposer d;
+        d.adopt(make_doc(&mr));
+        d.adopt(parse(
+            "{\"a\":[1,2,3],\"b\":{}}", &mr));
+        while(! d.step(50))
+        {
+        }
+        auto const st = mr.stats();
+        BOOST_TEST(st.allocations ==
+            st.deallocations);
+    }
+
+    void
+    testPendingAtDestruction()
+    {
+        // the destructor releases
+        // unfinished work
+        tracing_resource mr;
+        {
+            disposer d;
+            d.adopt(make_doc(&mr));
+            d.step(10);
+        }
+        auto const st = mr.stats();
+        BOOST_TEST(st.allocations ==
+            st.deallocations);
+        BOOST_TEST(st.bytes_outstanding == 0);
+    }
+
+    void
+    run()
+    {
+        testDispose();
+        testImmediate();
+        testMultiple();
+        testPendingAtDestruction();
+    }
+};
+
+TEST_SUITE(disposer_test, "boost.json.disposer");
+
+} // namespace json
+} // namespace boost
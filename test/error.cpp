@@ -66,6 +66,7 @@ public:
 
         check(condition::pointer_parse_error, error::missing_slash);
         check(condition::pointer_parse_error, error::invalid_escape);
+        check(condition::pointer_parse_error, error::invalid_path);
 
         check(condition::pointer_use_error, error::token_not_number);
         check(condition::pointer_use_error, error::value_is_scalar);
@@ -90,6 +91,7 @@ public:
 
         check(condition::generic_error, error::exception);
         check(condition::generic_error, error::out_of_range);
+        check(condition::generic_error, error::not_enough_memory);
         check(error::test_failure);
 
         // check std interop
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/escape.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/json/value.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class escape_test
+{
+public:
+    void
+    check(
+        string_view s,
+        string_view expected)
+    {
+        BOOST_TEST(
+            escaped_size(s) == expected.size());
+        std::string buf(6 * s.size(), '*');
+        auto const n = escape(s, &buf[0]);
+        BOOST_TEST(
+            string_view(buf.data(), n) == expected);
+
+        // matches the serializer, which
+        // emits the enclosing quotes
+        BOOST_TEST(serialize(value(s)) ==
+            "\"" + std::string(expected) + "\"");
+    }
+
+    void
+    testEscape()
+    {
+        check("", "");
+        check("hello", "hello");
+        check("\"", "\\\"");
+        check("\\", "\\\\");
+        check("\n", "\\n");
+        check("a\tb", "a\\tb");
+        check("\b\f\n\r\t", "\\b\\f\\n\\r\\t");
+        check("\x01", "\\u0001");
+        check("\x1f", "\\u001f");
+        check("say \"hi\"\n", "say \\\"hi\\\"\\n");
+        // solidus is not escaped
+        check("a/b", "a/b");
+        // multi-byte utf8 passes through
+        check("\xc3\xa9", "\xc3\xa9");
+        // long strings exercise the
+        // vectorized scan
+        std::string long_in(1000, 'x');
+        long_in += '\n';
+        long_in.append(1000, 'y');
+        std::string long_out(1000, 'x');
+        long_out += "\\n";
+        long_out.append(1000, 'y');
+        check(long_in, long_out);
+    }
+
+    void
+    run()
+    {
+        testEscape();
+    }
+};
+
+TEST_SUITE(escape_test, "boost.json.escape");
+
+} // namespace json
+} // namespace boost
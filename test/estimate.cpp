@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/estimate.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+// hands out real memory but meters it the way
+// a contiguous arena would: every allocation
+// advances a cursor past its alignment padding.
+// deallocate is trivial, so the meter owns its
+// blocks and frees them on destruction, like
+// monotonic_resource does.
+struct arena_meter
+    : memory_resource
+{
+    std::size_t used = 0;
+    std::vector<void*> blocks;
+
+    ~arena_meter()
+    {
+        for(auto p : blocks)
+            ::operator delete(p);
+    }
+
+    void*
+    do_allocate(
+        std::size_t n,
+        std::size_t align) override
+    {
+        used = (used + align - 1) &
+            ~(align - 1);
+        used += n;
+        auto const p = ::operator new(n);
+        blocks.push_back(p);
+        return p;
+    }
+
+    void
+    do_deallocate(
+        void*,
+        std::size_t,
+        std::size_t) noexcept override
+    {
+        // ownership stays with the meter
+    }
+
+    bool
+    do_is_equal(
+        memory_resource const& mr
+            ) const noexcept override
+    {
+        return this == &mr;
+    }
+};
+
+// the meter stands in for monotonic_resource,
+// so keys may be reused the same way
+template<>
+struct is_deallocate_trivial<arena_meter>
+{
+    static constexpr bool value = true;
+};
+
+class estimate_test
+{
+public:
+    void
+    check(
+        string_view doc,
+        parse_options const& opt = {})
+    {
+        error_code ec;
+        auto const est =
+            estimate_storage(doc, ec, opt);
+        if(! BOOST_TEST(! ec))
+            return;
+        arena_meter mr;
+        {
+            auto jv = parse(doc,
+                storage_ptr(&mr), opt);
+            BOOST_TEST(mr.used == est);
+        }
+    }
+
+    void
+    testEstimate()
+    {
+        // scalars need no storage
+        BOOST_TEST(
+            estimate_storage("null") == 0);
+        BOOST_TEST(
+            estimate_storage("true") == 0);
+        BOOST_TEST(
+            estimate_storage("-1.5e3") == 0);
+        BOOST_TEST(estimate_storage(
+            "\"short string\"") == 0);
+
+        // neither do empty containers
+        BOOST_TEST(
+            estimate_storage("[]") == 0);
+        BOOST_TEST(
+            estimate_storage("{}") == 0);
+
+        // long strings allocate
+        BOOST_TEST(estimate_storage(
+            "\"a string too long for sbo\"")
+                > 0);
+
+        check("[1,2,3]");
+        check("[[],[[]],{}]");
+        check(R"({"a":1,"b":[true,null]})");
+
+        // strings around the inline
+        // threshold, with and without
+        // escapes
+        check(R"(["1234567890123"])");
+        check(R"(["12345678901234"])");
+        check(R"(["123456789012345"])");
+        check(R"(["1234567890123456"])");
+        check(R"(["12345678901234567890123456789012345"])");
+        check(R"(["123456789\n1234"])");
+        check(R"(["12345678901234567890\nabcdefghij"])");
+
+        // keys around the element's inline
+        // capacity, and an escaped key
+        check(R"({"k":1})");
+        check(R"({"123456789012345":1})");
+        check(R"({"1234567890123456":1})");
+        check(R"({"a\nb":1,"c":2})");
+
+        // an object large enough to use
+        // the hash index
+        {
+            std::string s = "{";
+            for(int i = 0; i < 40; ++i)
+            {
+                if(i != 0)
+                    s += ',';
+                s += "\"key_number_" +
+                    std::to_string(i) +
+                    "\":" + std::to_string(i);
+            }
+            s += '}';
+            check(s);
+        }
+
+        // repeated keys share an
+        // allocation across elements
+        {
+            std::string s = "[";
+            for(int i = 0; i < 20; ++i)
+            {
+                if(i != 0)
+                    s += ',';
+                s += R"({"a_rather_long_key_name":)" +
+                    std::to_string(i) + '}';
+            }
+            s += ']';
+            check(s);
+        }
+
+        // duplicate keys in one object
+        check(R"({"x":1,"x":2})");
+
+        // a larger mixed document
+        check(R"json(
+            {
+                "menu": {
+                    "id": "file",
+                    "value": "File",
+                    "popup": {
+                        "menuitem": [
+                            {"value": "New", "onclick": "CreateNewDoc()"},
+                            {"value": "Open", "onclick": "OpenDoc()"},
+                            {"value": "Close", "onclick": "CloseDoc()"}
+                        ]
+                    },
+                    "numbers": [0, -1, 18446744073709551615, 1.25e-9]
+                }
+            })json");
+    }
+
+    void
+    testOptions()
+    {
+        // extensions are honored
+        parse_options opt;
+        opt.allow_comments = true;
+        opt.allow_trailing_commas = true;
+        check("[1,2,/*x*/3,]", opt);
+
+        // raw numbers are stored as
+        // pre-formatted strings
+        parse_options raw;
+        raw.raw_numbers = true;
+        check("[1,2,3]", raw);
+        check(
+            "[3.14159265358979323846,"
+            "123456789012345678901234567890]",
+            raw);
+    }
+
+    void
+    testErrors()
+    {
+        error_code ec;
+        BOOST_TEST(estimate_storage(
+            "[1,2", ec) == 0);
+        BOOST_TEST(ec);
+
+        ec = {};
+        BOOST_TEST(estimate_storage(
+            "[] trailing", ec) == 0);
+        BOOST_TEST(ec == error::extra_data);
+
+        std::error_code sec;
+        BOOST_TEST(estimate_storage(
+            "{", sec) == 0);
+        BOOST_TEST(sec);
+        BOOST_TEST(estimate_storage(
+            "[1]", sec) > 0);
+        BOOST_TEST(! sec);
+
+        BOOST_TEST_THROWS(
+            estimate_storage("nul"),
+            system_error);
+
+        // a sized monotonic buffer parses
+        // the sample without growing
+        {
+            string_view doc =
+                R"({"alpha":[1,"a long enough string",3]})";
+            auto const est =
+                estimate_storage(doc);
+            BOOST_TEST(est > 0);
+        }
+    }
+
+    void
+    run()
+    {
+        testEstimate();
+        testOptions();
+        testErrors();
+    }
+};
+
+TEST_SUITE(estimate_test, "boost.json.estimate");
+
+} // namespace json
+} // namespace boost
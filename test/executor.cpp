@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/executor.hpp>
+
+#include <boost/json/compare.hpp>
+#include <boost/json/ndjson.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <atomic>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class executor_test
+{
+public:
+    struct counter
+    {
+        std::atomic<std::size_t> sum;
+        std::atomic<std::size_t> calls;
+
+        counter()
+        {
+            sum.store(0);
+            calls.store(0);
+        }
+
+        static
+        void
+        run(void* arg, std::size_t i)
+        {
+            auto& c = *static_cast<
+                counter*>(arg);
+            c.sum.fetch_add(i);
+            c.calls.fetch_add(1);
+        }
+    };
+
+    void
+    testRun()
+    {
+        thread_pool pool(4);
+        BOOST_TEST(pool.concurrency() == 4);
+
+        // every index is invoked exactly once
+        for(std::size_t count :
+            { std::size_t(0), std::size_t(1),
+              std::size_t(3), std::size_t(4),
+              std::size_t(100) })
+        {
+            counter c;
+            pool.run(count, &counter::run, &c);
+            BOOST_TEST(c.calls == count);
+            BOOST_TEST(c.sum == (count == 0
+                ? 0 : count * (count - 1) / 2));
+        }
+
+        // the pool is reusable across batches
+        for(int i = 0; i < 100; ++i)
+        {
+            counter c;
+            pool.run(8, &counter::run, &c);
+            BOOST_TEST(c.calls == 8);
+        }
+
+        // NUMA pinning is a hint; work runs
+        // even for a nonexistent node
+        for(int node : { 0, 999 })
+        {
+            thread_pool numa(2, node);
+            counter c;
+            numa.run(16, &counter::run, &c);
+            BOOST_TEST(c.calls == 16);
+        }
+
+        // a pool of one runs inline
+        thread_pool serial(1);
+        BOOST_TEST(serial.concurrency() == 1);
+        counter c;
+        serial.run(5, &counter::run, &c);
+        BOOST_TEST(c.calls == 5);
+        BOOST_TEST(c.sum == 10);
+    }
+
+    void
+    testParallelRun()
+    {
+        // without an executor, transient
+        // threads are used
+        counter c;
+        detail::parallel_run(
+            nullptr, 7, &counter::run, &c);
+        BOOST_TEST(c.calls == 7);
+        BOOST_TEST(c.sum == 21);
+    }
+
+    void
+    testAlgorithms()
+    {
+        thread_pool pool(4);
+
+        // parse_ndjson
+        std::string ndjson;
+        for(int i = 0; i < 1000; ++i)
+            ndjson += std::to_string(i) + "\n";
+        error_code ec;
+        auto vs = parse_ndjson(ndjson, pool, ec);
+        BOOST_TEST(! ec.failed());
+        if(BOOST_TEST(vs.size() == 1000))
+        {
+            BOOST_TEST(vs.front() == value(0));
+            BOOST_TEST(vs.back() == value(999));
+        }
+
+        // serialize_parallel
+        array a;
+        for(int i = 0; i < 10000; ++i)
+            a.emplace_back(i);
+        BOOST_TEST(
+            serialize_parallel(a, pool) ==
+            serialize(a));
+        value const jv(a);
+        BOOST_TEST(
+            serialize_parallel(jv, pool) ==
+            serialize(jv));
+
+        // equal
+        array a2(a);
+        BOOST_TEST(equal(jv, value(a2), pool));
+        a2.back() = -1;
+        BOOST_TEST(! equal(jv, value(a2), pool));
+    }
+
+    void
+    run()
+    {
+        testRun();
+        testParallelRun();
+        testAlgorithms();
+    }
+};
+
+TEST_SUITE(executor_test, "boost.json.executor");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/filter.hpp>
+
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/serializer.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class filter_test
+{
+public:
+    // a sink backed by a std::string
+    struct string_sink
+    {
+        std::string s;
+
+        serializer::mutable_buffer
+        prepare(std::size_t n)
+        {
+            size_ = s.size();
+            s.resize(size_ + n);
+            return { &s[0] + size_, n };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            s.resize(size_ + n);
+        }
+
+    private:
+        std::size_t size_ = 0;
+    };
+
+    // feed the text through a parser built on
+    // the handler, one byte at a time to
+    // exercise split keys and strings
+    template<class Handler, class... Args>
+    static
+    std::string
+    pipe(
+        string_view text,
+        Args&&... args)
+    {
+        string_sink sink;
+        basic_parser<Handler> p(
+            parse_options(),
+            std::forward<Args>(args)...,
+            sink);
+        error_code ec;
+        for(auto const& c : text)
+        {
+            p.write_some(true, &c, 1, ec);
+            if(! BOOST_TEST(! ec))
+                return {};
+        }
+        p.write_some(false, nullptr, 0, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(p.done());
+        return sink.s;
+    }
+
+    void
+    testEmit()
+    {
+        // the terminal stage reproduces
+        // the document
+        BOOST_TEST(pipe<writer_handler<
+            string_sink>>(
+            R"({"a":[1,2.5,"x\n",true,null],"b":{}})")
+            == "{\"a\":[1,2.5E0,\"x\\n\",true,null],"
+               "\"b\":{}}");
+
+        BOOST_TEST(pipe<writer_handler<
+            string_sink>>("[]") == "[]");
+
+        BOOST_TEST(pipe<writer_handler<
+            string_sink>>("\"quote\"")
+            == "\"quote\"");
+    }
+
+    void
+    testPassThrough()
+    {
+        // a bare pass-through stage
+        // changes nothing
+        BOOST_TEST(pipe<pass_through_filter<
+            writer_handler<string_sink>>>(
+            R"({"a":1,"b":[true,"s"]})")
+            == R"({"a":1,"b":[true,"s"]})");
+    }
+
+    void
+    testRename()
+    {
+        using handler = rename_filter<
+            writer_handler<string_sink>>;
+        std::initializer_list<std::pair<
+            string_view, string_view>> map = {
+                { "uid", "user_id" },
+                { "ts", "timestamp" } };
+
+        BOOST_TEST(pipe<handler>(
+            R"({"uid":1,"ts":2,"other":3})", map)
+            == R"({"user_id":1,"timestamp":2,"other":3})");
+
+        // nested objects are renamed too
+        BOOST_TEST(pipe<handler>(
+            R"([{"uid":1},{"uid":{"uid":2}}])", map)
+            == R"([{"user_id":1},{"user_id":{"user_id":2}}])");
+    }
+
+    void
+    testRedact()
+    {
+        using handler = redact_filter<
+            writer_handler<string_sink>>;
+        std::initializer_list<
+            string_view> keys = { "password" };
+
+        // scalars are replaced by null
+        BOOST_TEST(pipe<handler>(
+            R"({"user":"ed","password":"hunter2"})",
+            keys)
+            == R"({"user":"ed","password":null})");
+
+        // nested containers are swallowed
+        BOOST_TEST(pipe<handler>(
+            R"({"password":{"hash":"x","salt":[1,2]},"n":1})",
+            keys)
+            == R"({"password":null,"n":1})");
+
+        // redaction applies at any depth
+        BOOST_TEST(pipe<handler>(
+            R"([{"password":[[[]]]},{"a":{"password":true}}])",
+            keys)
+            == R"([{"password":null},{"a":{"password":null}}])");
+    }
+
+    void
+    testChain()
+    {
+        // rename and redact stages compose
+        using handler = rename_filter<
+            redact_filter<
+                writer_handler<string_sink>>>;
+
+        BOOST_TEST(pipe<handler>(
+            R"({"uid":7,"password":"pw","x":[0]})",
+            std::initializer_list<std::pair<
+                string_view, string_view>>{
+                    { "uid", "user_id" } },
+            std::initializer_list<string_view>{
+                "password" })
+            == R"({"user_id":7,"password":null,"x":[0]})");
+    }
+
+    void
+    run()
+    {
+        testEmit();
+        testPassThrough();
+        testRename();
+        testRedact();
+        testChain();
+    }
+};
+
+TEST_SUITE(filter_test, "boost.json.filter");
+
+} // namespace json
+} // namespace boost
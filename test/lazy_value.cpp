@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/lazy_value.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class lazy_value_test
+{
+public:
+    void
+    testAtPointer()
+    {
+        string_view const doc =
+            "{\"a\":{\"b\":[1,2,{\"c\":\"hello\"}],\"x\":null},"
+            "\"arr\":[true,false,3.5,\"s\",{},[]],"
+            "\"esc~/\":{\"k\":\"v\"},"
+            "\"\\n\\u0041\":7,"
+            "\"num\":-123}";
+
+        value const jv = parse(doc);
+        lazy_value const lv = lazy_parse(doc);
+        BOOST_TEST(lv.text() == doc);
+
+        // agree with value::find_pointer for
+        // both successful and failing lookups
+        auto const check =
+            [&](string_view ptr)
+        {
+            error_code ec1;
+            error_code ec2;
+            auto const* pv =
+                jv.find_pointer(ptr, ec1);
+            value const mv =
+                lv.at_pointer(ptr, ec2);
+            if(pv)
+            {
+                BOOST_TEST(! ec2.failed());
+                BOOST_TEST(*pv == mv);
+            }
+            else
+            {
+                BOOST_TEST(ec2.failed());
+            }
+        };
+
+        check("");
+        check("/a");
+        check("/a/b");
+        check("/a/b/0");
+        check("/a/b/1");
+        check("/a/b/2");
+        check("/a/b/2/c");
+        check("/a/x");
+        check("/arr");
+        check("/arr/0");
+        check("/arr/2");
+        check("/arr/3");
+        check("/arr/4");
+        check("/arr/5");
+        check("/esc~0~1");
+        check("/esc~0~1/k");
+        check("/\nA");
+        check("/num");
+
+        // failures
+        check("/missing");
+        check("/a/missing");
+        check("/a/b/3");
+        check("/a/b/x");
+        check("/a/b/-");
+        check("/num/x");
+        check("/a/b/0/y");
+        check("no-slash");
+        check("/esc~0");
+
+        // the value can use a caller-provided resource
+        {
+            monotonic_resource mr;
+            value const mv = lv.at_pointer(
+                "/a/b", storage_ptr(&mr));
+            BOOST_TEST(jv.at_pointer("/a/b") == mv);
+            BOOST_TEST(*mv.storage() == mr);
+        }
+
+        // throwing overload
+        {
+            BOOST_TEST_THROWS(
+                lv.at_pointer("/missing"),
+                system_error);
+        }
+    }
+
+    void
+    testErrors()
+    {
+        // text ending inside a string is
+        // detected when the index is built
+        {
+            error_code ec;
+            lazy_parse("{\"a\":\"unterminated", ec);
+            BOOST_TEST(ec == error::incomplete);
+        }
+        {
+            BOOST_TEST_THROWS(
+                lazy_parse("\"abc"),
+                system_error);
+        }
+
+        // syntax errors in the navigated
+        // region are reported
+        {
+            error_code ec;
+            lazy_value const lv = lazy_parse(
+                "{\"a\":[1,,2]}", ec);
+            BOOST_TEST(! ec.failed());
+            lv.at_pointer("/a", ec);
+            BOOST_TEST(ec.failed());
+        }
+
+        // errors outside the navigated
+        // region go unnoticed
+        {
+            error_code ec;
+            lazy_value const lv = lazy_parse(
+                "{\"a\":1,\"b\":[,]}", ec);
+            BOOST_TEST(! ec.failed());
+            value const mv =
+                lv.at_pointer("/a", ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(mv == value(1));
+        }
+
+        // default-constructed documents
+        // cannot be navigated
+        {
+            error_code ec;
+            lazy_value const lv;
+            lv.at_pointer("/a", ec);
+            BOOST_TEST(ec.failed());
+        }
+    }
+
+    void
+    testMaterialize()
+    {
+        string_view const doc =
+            "{\"a\":[1,2,3],\"b\":{\"c\":\"d\"},"
+            "\"e\":1.25,\"f\":null}";
+        value const jv = parse(doc);
+        lazy_value const lv = lazy_parse(doc);
+        BOOST_TEST(lv.materialize() == jv);
+
+        // whole-document errors surface here
+        {
+            error_code ec;
+            lazy_value const bad = lazy_parse(
+                "{\"a\":1} extra", ec);
+            BOOST_TEST(! ec.failed());
+            bad.materialize(ec);
+            BOOST_TEST(ec == error::extra_data);
+        }
+    }
+
+    void
+    run()
+    {
+        testAtPointer();
+        testErrors();
+        testMaterialize();
+    }
+};
+
+TEST_SUITE(lazy_value_test, "boost.json.lazy_value");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/literals.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+using namespace literals;
+
+// a namespace scope instance demonstrates
+// the intended use: nothing is parsed until
+// the first access
+static_value const tmpl =
+    R"( {"id":0,"name":"","tags":[]} )"_json_static;
+
+class literals_test
+{
+public:
+    void
+    testJson()
+    {
+        value const jv =
+            R"( {"a":[1,2],"b":null} )"_json;
+        BOOST_TEST(jv == parse(
+            R"( {"a":[1,2],"b":null} )"));
+
+        BOOST_TEST("[1,2,3]"_json ==
+            value(array{1, 2, 3}));
+
+        BOOST_TEST_THROWS(
+            "[1,"_json, system_error);
+    }
+
+    void
+    testStatic()
+    {
+        BOOST_TEST(tmpl.text() ==
+            R"( {"id":0,"name":"","tags":[]} )");
+
+        value const& jv = tmpl.get();
+        BOOST_TEST(jv.is_object());
+        BOOST_TEST(
+            jv.at("tags").is_array());
+
+        // later accesses reuse the tree
+        BOOST_TEST(&tmpl.get() == &jv);
+        BOOST_TEST(&*tmpl == &jv);
+
+        // a copy refers to the same text
+        // but parses independently
+        static_value const other = tmpl;
+        BOOST_TEST(
+            other.text() == tmpl.text());
+        BOOST_TEST(&other.get() != &jv);
+        BOOST_TEST(other.get() == jv);
+
+        // invalid text reports its error
+        // on access, not construction
+        static_value const bad =
+            "{\"a\":"_json_static;
+        BOOST_TEST_THROWS(
+            bad.get(), system_error);
+    }
+
+    void
+    testConcurrentFirstAccess()
+    {
+        static_value const sv =
+            "[1,2,3]"_json_static;
+        std::vector<std::thread> tv;
+        std::vector<value const*> seen(4);
+        for(std::size_t i = 0;
+            i < seen.size(); ++i)
+            tv.emplace_back(
+                [&sv, &seen, i]
+                {
+                    seen[i] = &sv.get();
+                });
+        for(auto& t : tv)
+            t.join();
+        // exactly one parse wins and
+        // every thread adopts its tree
+        for(auto const p : seen)
+            BOOST_TEST(p == seen.front());
+        BOOST_TEST(sv.get() ==
+            value(array{1, 2, 3}));
+    }
+
+    void
+    run()
+    {
+        testJson();
+        testStatic();
+        testConcurrentFirstAccess();
+    }
+};
+
+TEST_SUITE(literals_test, "boost.json.literals");
+
+} // namespace json
+} // namespace boost
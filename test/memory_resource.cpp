@@ -10,8 +10,12 @@
 // Test that header file is self-contained.
 #include <boost/json/memory_resource.hpp>
 #include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
 #include <boost/json/value.hpp>
 #include <boost/container/pmr/vector.hpp>
+#include <new>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "test_suite.hpp"
@@ -97,11 +101,169 @@ public:
         }
     }
 
+    // throws std::bad_alloc after a set number
+    // of successful allocations, and counts
+    // outstanding blocks so a leaking teardown
+    // cannot go unnoticed
+    class fail_resource
+        : public memory_resource
+    {
+        std::size_t fail_after_;
+        std::size_t outstanding_ = 0;
+
+    public:
+        explicit
+        fail_resource(
+            std::size_t fail_after) noexcept
+            : fail_after_(fail_after)
+        {
+        }
+
+        std::size_t
+        outstanding() const noexcept
+        {
+            return outstanding_;
+        }
+
+        void*
+        do_allocate(
+            std::size_t n,
+            std::size_t) override
+        {
+            if(fail_after_ == 0)
+                throw std::bad_alloc();
+            --fail_after_;
+            ++outstanding_;
+            return ::operator new(n);
+        }
+
+        void
+        do_deallocate(
+            void* p,
+            std::size_t,
+            std::size_t) override
+        {
+            BOOST_TEST(outstanding_ > 0);
+            --outstanding_;
+            ::operator delete(p);
+        }
+
+        bool
+        do_is_equal(
+            memory_resource const& mr
+                ) const noexcept override
+        {
+            return this == &mr;
+        }
+    };
+
+    void
+    testAllocationFailure()
+    {
+        // enough structure to allocate many
+        // times: nested containers, keys, and
+        // strings past the small buffer
+        std::string doc =
+            "{\"a\":[1,2,3,{\"b\":\"" +
+            std::string(100, 'x') +
+            "\",\"c\":[true,null,1.5]}],"
+            "\"d\":[";
+        for(int i = 0; i < 50; ++i)
+        {
+            if(i > 0)
+                doc += ',';
+            doc += "\"s" +
+                std::to_string(i) + "\"";
+        }
+        doc += "],\"e\":{\"f\":[[[[0]]]]}}";
+        value const expected = parse(doc);
+
+        parse_options modes[2];
+        modes[1].full_buffer_fast_path = true;
+
+        for(auto const& opt : modes)
+        {
+            bool parsed = false;
+            for(std::size_t n = 0;
+                n < 10000; ++n)
+            {
+                fail_resource mr(n);
+                {
+                    error_code ec;
+                    value const jv = parse(
+                        doc, ec, &mr, opt);
+                    if(! ec)
+                    {
+                        BOOST_TEST(jv == expected);
+                        parsed = true;
+                    }
+                    else
+                    {
+                        BOOST_TEST(ec ==
+                            error::not_enough_memory);
+                        BOOST_TEST(jv.is_null());
+                    }
+                }
+                // everything allocated before the
+                // failure was returned
+                BOOST_TEST(mr.outstanding() == 0);
+                if(parsed)
+                    break;
+            }
+            BOOST_TEST(parsed);
+        }
+
+        // the stream overload degrades the
+        // same way
+        {
+            bool parsed = false;
+            for(std::size_t n = 0;
+                n < 10000; ++n)
+            {
+                fail_resource mr(n);
+                {
+                    std::istringstream is(doc);
+                    error_code ec;
+                    value const jv = parse(
+                        is, ec, &mr);
+                    if(! ec)
+                    {
+                        BOOST_TEST(jv == expected);
+                        parsed = true;
+                    }
+                    else
+                    {
+                        BOOST_TEST(ec ==
+                            error::not_enough_memory);
+                        BOOST_TEST(jv.is_null());
+                    }
+                }
+                BOOST_TEST(mr.outstanding() == 0);
+                if(parsed)
+                    break;
+            }
+            BOOST_TEST(parsed);
+        }
+
+        // a resource that always fails still
+        // tears down cleanly
+        {
+            fail_resource mr(0);
+            error_code ec;
+            value const jv = parse(doc, ec, &mr);
+            BOOST_TEST(ec ==
+                error::not_enough_memory);
+            BOOST_TEST(jv.is_null());
+            BOOST_TEST(mr.outstanding() == 0);
+        }
+    }
+
     void
     run()
     {
         testBoostPmr();
         testPmr();
+        testAllocationFailure();
     }
 };
 
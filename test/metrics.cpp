@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/metrics.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/serializer.hpp>
+#include <boost/json/stream_parser.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+/*
+    This translation unit is compiled with
+    BOOST_JSON_METRICS defined and exercises
+    the measurement sites. Without the macro
+    the measurement sites are inert, so the
+    whole suite is compiled out.
+*/
+#ifdef BOOST_JSON_METRICS
+
+namespace boost {
+namespace json {
+
+class metrics_test
+{
+public:
+    // the documented bucket rule: zero goes
+    // in bucket zero, otherwise one past the
+    // highest set bit
+    static
+    unsigned
+    bucket_of(std::uint64_t v)
+    {
+        unsigned i = 0;
+        while(v != 0)
+        {
+            v >>= 1;
+            ++i;
+        }
+        return i;
+    }
+
+    static
+    std::uint64_t
+    bucket_total(
+        metrics_histogram const& h)
+    {
+        std::uint64_t n = 0;
+        for(auto const b : h.buckets)
+            n += b;
+        return n;
+    }
+
+    static
+    void
+    check(metrics_snapshot const& ms)
+    {
+        // both histograms record one value
+        // per call
+        BOOST_TEST(ms.bytes.count ==
+            ms.nanoseconds.count);
+        BOOST_TEST(bucket_total(
+            ms.bytes) == ms.bytes.count);
+        BOOST_TEST(bucket_total(
+            ms.nanoseconds) ==
+                ms.nanoseconds.count);
+    }
+
+    void
+    testParse()
+    {
+        reset_metrics();
+        std::string const doc =
+            "{\"a\":[1,2,3],\"b\":\"xyz\"}";
+        value const jv = parse(doc);
+        BOOST_TEST(jv.is_object());
+
+        auto const ms = get_metrics(
+            metrics_op::parse);
+        check(ms);
+        BOOST_TEST(ms.bytes.count == 1);
+        BOOST_TEST(
+            ms.bytes.sum == doc.size());
+        BOOST_TEST(ms.bytes.buckets[
+            bucket_of(doc.size())] == 1);
+
+        // errors are measured too
+        error_code ec;
+        parse("[1,", ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(get_metrics(
+            metrics_op::parse)
+                .bytes.count == 2);
+    }
+
+    void
+    testParserWrite()
+    {
+        reset_metrics();
+        std::string const doc =
+            "[1,\"ab\",null,true]";
+        stream_parser p;
+        p.write(doc.data(), 7);
+        p.write(doc.data() + 7,
+            doc.size() - 7);
+        p.finish();
+        BOOST_TEST(p.done());
+
+        auto const ms = get_metrics(
+            metrics_op::parser_write);
+        check(ms);
+        BOOST_TEST(ms.bytes.count == 2);
+        BOOST_TEST(
+            ms.bytes.sum == doc.size());
+        BOOST_TEST(
+            ms.bytes.buckets[
+                bucket_of(7)] >= 1);
+    }
+
+    void
+    testSerializerRead()
+    {
+        reset_metrics();
+        value const jv = parse(
+            "{\"a\":[1,2,3],\"b\":\"xyz\"}");
+        std::string const expected =
+            serialize(jv);
+
+        reset_metrics();
+        serializer sr;
+        sr.reset(&jv);
+        std::uint64_t chunks = 0;
+        std::uint64_t bytes = 0;
+        char buf[8];
+        while(! sr.done())
+        {
+            auto const sv = sr.read(
+                buf, sizeof(buf));
+            bytes += sv.size();
+            ++chunks;
+        }
+        BOOST_TEST(
+            bytes == expected.size());
+        BOOST_TEST(chunks > 1);
+
+        auto const ms = get_metrics(
+            metrics_op::serializer_read);
+        check(ms);
+        BOOST_TEST(
+            ms.bytes.count == chunks);
+        BOOST_TEST(ms.bytes.sum == bytes);
+    }
+
+    void
+    testReset()
+    {
+        parse("[1,2,3]");
+        BOOST_TEST(get_metrics(
+            metrics_op::parse)
+                .bytes.count > 0);
+        reset_metrics();
+        for(auto const op : {
+            metrics_op::parse,
+            metrics_op::parser_write,
+            metrics_op::serializer_read })
+        {
+            auto const ms = get_metrics(op);
+            BOOST_TEST(
+                ms.bytes.count == 0);
+            BOOST_TEST(ms.bytes.sum == 0);
+            BOOST_TEST(
+                ms.nanoseconds.sum == 0);
+            BOOST_TEST(bucket_total(
+                ms.bytes) == 0);
+        }
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testParserWrite();
+        testSerializerRead();
+        testReset();
+    }
+};
+
+TEST_SUITE(metrics_test, "boost.json.metrics");
+
+} // namespace json
+} // namespace boost
+
+#endif // BOOST_JSON_METRICS
@@ -303,12 +303,199 @@ R"xx({
         BOOST_TEST_PASS();
     }
 
+    void
+    testSegregate()
+    {
+        // small allocations pack densely even
+        // when large ones are interleaved
+        {
+            monotonic_resource mr;
+            mr.segregate(true);
+            auto const p1 = reinterpret_cast<
+                char*>(mr.allocate(16, 8));
+            (void)mr.allocate(1000, 8);
+            auto const p2 = reinterpret_cast<
+                char*>(mr.allocate(16, 8));
+            BOOST_TEST(p2 == p1 + 16);
+        }
+
+        // parsing through a segregated
+        // resource produces the same value
+        {
+            string_view const js =
+                "{\"k\":[1,2,3],\"s\":\""
+                "a string long enough to "
+                "require a dynamic payload "
+                "allocation instead of sbo\"}";
+            monotonic_resource mr;
+            mr.segregate(true);
+            value const jv = parse(js, &mr);
+            BOOST_TEST(jv == parse(js));
+
+            // release makes the slabs
+            // available again
+            mr.release();
+            value const jv2 = parse(js, &mr);
+            BOOST_TEST(jv2 == parse(js));
+        }
+    }
+
+    void
+    testGrowthOptions()
+    {
+        // fixed-size blocks
+        {
+            monotonic_resource::growth_options opt;
+            opt.initial_size = 4096;
+            opt.growth_factor = 1;
+            monotonic_resource mr(opt);
+            BOOST_TEST(all_alloc_in_same_block(mr, 4096, 1));
+            BOOST_TEST(all_alloc_in_same_block(mr, 4096, 1));
+        }
+
+        // growth stops at the block cap, and
+        // larger requests still succeed
+        {
+            monotonic_resource::growth_options opt;
+            opt.initial_size = 1024;
+            opt.max_block_size = 2048;
+            monotonic_resource mr(opt);
+            BOOST_TEST(all_alloc_in_same_block(mr, 1024, 1));
+            BOOST_TEST(all_alloc_in_same_block(mr, 2048, 1));
+            BOOST_TEST(all_alloc_in_same_block(mr, 2048, 1));
+            BOOST_TEST(mr.allocate(10000, 1) != nullptr);
+        }
+
+        // huge page advice is exercised; the
+        // hint cannot fail an allocation
+        {
+            monotonic_resource::growth_options opt;
+            opt.initial_size = 1 << 21;
+            opt.huge_pages = true;
+            monotonic_resource mr(opt);
+            value const jv = parse(
+                "[1,2,3,\"abcdefghijklmnopqrstuvwxyz"
+                "abcdefghijklmnopqrstuvwxyz\"]", &mr);
+            BOOST_TEST(jv.is_array());
+        }
+
+        // NUMA placement is exercised; the
+        // hint cannot fail an allocation,
+        // even for a nonexistent node
+        {
+            monotonic_resource::growth_options opt;
+            opt.numa_node = 0;
+            monotonic_resource mr(opt);
+            BOOST_TEST(
+                mr.allocate(2000, 1) != nullptr);
+        }
+        {
+            monotonic_resource::growth_options opt;
+            opt.numa_node = 999;
+            monotonic_resource mr(opt);
+            BOOST_TEST(
+                mr.allocate(2000, 1) != nullptr);
+        }
+        {
+            monotonic_resource::growth_options opt;
+            opt.numa_interleave = true;
+            monotonic_resource mr(opt);
+            value const jv = parse(
+                "[1,2,3,\"abcdefghijklmnopqrstuvwxyz"
+                "abcdefghijklmnopqrstuvwxyz\"]", &mr);
+            BOOST_TEST(jv.is_array());
+        }
+    }
+
+    void
+    testCheckpoint()
+    {
+        // rolling back makes the marked
+        // position available again
+        {
+            monotonic_resource mr;
+            (void)mr.allocate(100, 1);
+            auto const cp = mr.mark();
+            auto const p1 = mr.allocate(100, 1);
+            mr.rollback(cp);
+            auto const p2 = mr.allocate(100, 1);
+            BOOST_TEST(p1 == p2);
+        }
+
+        // blocks obtained after the mark are
+        // returned to the upstream resource
+        {
+            monotonic_resource mr(1024);
+            (void)mr.allocate(100, 1);
+            auto const cp = mr.mark();
+            for(int i = 0; i < 64; ++i)
+                (void)mr.allocate(1000, 1);
+            mr.rollback(cp);
+            auto const p1 = mr.allocate(100, 1);
+            mr.rollback(cp);
+            auto const p2 = mr.allocate(100, 1);
+            BOOST_TEST(p1 == p2);
+        }
+
+        // works with an initial buffer and
+        // with a mark taken before any block
+        {
+            unsigned char buf[256];
+            monotonic_resource mr(
+                buf, sizeof(buf));
+            auto const cp = mr.mark();
+            auto const p1 = mr.allocate(16, 1);
+            (void)mr.allocate(4096, 1);
+            mr.rollback(cp);
+            auto const p2 = mr.allocate(16, 1);
+            BOOST_TEST(p1 == p2);
+            BOOST_TEST(in_buffer(
+                p2, buf, sizeof(buf)));
+        }
+
+        // both chains are restored when
+        // segregation is enabled
+        {
+            monotonic_resource mr;
+            mr.segregate(true);
+            (void)mr.allocate(16, 8);
+            (void)mr.allocate(1000, 8);
+            auto const cp = mr.mark();
+            auto const p1 = mr.allocate(16, 8);
+            (void)mr.allocate(1000, 8);
+            mr.rollback(cp);
+            BOOST_TEST(p1 == mr.allocate(16, 8));
+            // the large allocation lived in a
+            // block obtained after the mark,
+            // which rollback returned upstream;
+            // its address is not stable, so only
+            // the success of a fresh allocation
+            // is observable
+            BOOST_TEST(
+                mr.allocate(1000, 8) != nullptr);
+        }
+
+        // release is still valid after
+        // marks have been taken
+        {
+            monotonic_resource mr;
+            (void)mr.allocate(100, 1);
+            (void)mr.mark();
+            mr.release();
+            BOOST_TEST(
+                mr.allocate(100, 1) != nullptr);
+        }
+    }
+
     void
     run()
     {
         testMembers();
         testStorage();
         testGeneral();
+        testSegregate();
+        testGrowthOptions();
+        testCheckpoint();
     }
 };
 
@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/msgpack.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+
+#include <initializer_list>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class msgpack_test
+{
+public:
+    static
+    std::string
+    bytes(std::initializer_list<int> init)
+    {
+        std::string s;
+        for(int b : init)
+            s.push_back(static_cast<char>(b));
+        return s;
+    }
+
+    void
+    checkRoundTrip(string_view js)
+    {
+        value const jv = parse(js);
+        std::string const b =
+            serialize_msgpack(jv);
+        error_code ec;
+        value const jv2 = parse_msgpack(b, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv2 == jv);
+    }
+
+    void
+    testRoundTrip()
+    {
+        checkRoundTrip("null");
+        checkRoundTrip("true");
+        checkRoundTrip("false");
+        checkRoundTrip("0");
+        checkRoundTrip("127");
+        checkRoundTrip("128");
+        checkRoundTrip("255");
+        checkRoundTrip("65536");
+        checkRoundTrip("4294967296");
+        checkRoundTrip("9223372036854775807");
+        checkRoundTrip("18446744073709551615");
+        checkRoundTrip("-1");
+        checkRoundTrip("-32");
+        checkRoundTrip("-33");
+        checkRoundTrip("-128");
+        checkRoundTrip("-129");
+        checkRoundTrip("-65536");
+        checkRoundTrip("-9223372036854775808");
+        checkRoundTrip("1.5");
+        checkRoundTrip("-2.75e10");
+        checkRoundTrip("\"\"");
+        checkRoundTrip("\"hello\"");
+        checkRoundTrip("[]");
+        checkRoundTrip("{}");
+        checkRoundTrip("[1,[2,[3]],\"x\"]");
+        checkRoundTrip(
+            "{\"a\":1,\"b\":[true,null],"
+            "\"c\":{\"d\":\"e\"}}");
+    }
+
+    void
+    testEncoding()
+    {
+        // shortest-form headers,
+        // known byte sequences
+        BOOST_TEST(serialize_msgpack(
+            parse("{\"a\":1}")) ==
+            bytes({0x81, 0xa1, 'a', 0x01}));
+        BOOST_TEST(serialize_msgpack(
+            parse("[1,2]")) ==
+            bytes({0x92, 0x01, 0x02}));
+        BOOST_TEST(serialize_msgpack(
+            value(-1)) == bytes({0xff}));
+        BOOST_TEST(serialize_msgpack(
+            value(-33)) == bytes({0xd0, 0xdf}));
+        BOOST_TEST(serialize_msgpack(
+            value(128)) == bytes({0xcc, 128}));
+        BOOST_TEST(serialize_msgpack(
+            value(nullptr)) == bytes({0xc0}));
+        BOOST_TEST(serialize_msgpack(
+            value(true)) == bytes({0xc3}));
+    }
+
+    void
+    testDecoding()
+    {
+        error_code ec;
+
+        // bin data is stored as a string
+        BOOST_TEST(parse_msgpack(bytes(
+            {0xc4, 0x02, 'h', 'i'}), ec) ==
+                value("hi"));
+        BOOST_TEST(! ec);
+
+        // sign extension of sized integers
+        BOOST_TEST(parse_msgpack(bytes(
+            {0xd0, 0xfb}), ec) == value(-5));
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_msgpack(bytes(
+            {0xd1, 0xfe, 0xd4}), ec) ==
+                value(-300));
+        BOOST_TEST(! ec);
+
+        // uint64 above INT64_MAX
+        BOOST_TEST(parse_msgpack(bytes(
+            {0xcf, 0xff, 0xff, 0xff, 0xff,
+             0xff, 0xff, 0xff, 0xff}), ec) ==
+                value(UINT64_MAX));
+        BOOST_TEST(! ec);
+
+        // float 32 is widened to double
+        BOOST_TEST(parse_msgpack(bytes(
+            {0xca, 0x40, 0x20, 0x00, 0x00}),
+                ec) == value(2.5));
+        BOOST_TEST(! ec);
+    }
+
+    void
+    testErrors()
+    {
+        error_code ec;
+
+        // truncated input
+        parse_msgpack(bytes({0x91}), ec);
+        BOOST_TEST(ec == error::incomplete);
+        parse_msgpack(bytes({0xa1}), ec);
+        BOOST_TEST(ec == error::incomplete);
+
+        // trailing data
+        parse_msgpack(bytes({0x01, 0x02}), ec);
+        BOOST_TEST(ec == error::extra_data);
+
+        // 0xc1 is never used
+        parse_msgpack(bytes({0xc1}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // ext formats have no JSON equivalent
+        parse_msgpack(bytes(
+            {0xd4, 0x01, 0x02}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // map keys must be str or bin
+        parse_msgpack(bytes(
+            {0x81, 0x01, 0x02}), ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // nesting deeper than 32 levels
+        std::string s(33, '\x91');
+        s.push_back('\x01');
+        parse_msgpack(s, ec);
+        BOOST_TEST(ec == error::too_deep);
+        s.erase(0, 1);
+        parse_msgpack(s, ec);
+        BOOST_TEST(! ec);
+
+        BOOST_TEST_THROWS(
+            parse_msgpack(bytes({0x91})),
+            system_error);
+    }
+
+    void
+    testSerializer()
+    {
+        value const jv = parse(
+            "{\"key\":[1,2.5,\"payload\","
+            "{\"n\":null}],\"b\":true}");
+        std::string const whole =
+            serialize_msgpack(jv);
+
+        // single-byte reads produce
+        // identical output
+        msgpack_serializer sr;
+        BOOST_TEST(sr.done());
+        sr.reset(&jv);
+        std::string pieces;
+        while(! sr.done())
+        {
+            char buf[1];
+            string_view const sv = sr.read(buf);
+            pieces.append(sv.data(), sv.size());
+        }
+        BOOST_TEST(pieces == whole);
+
+        // the serializer is reusable
+        sr.reset(&jv);
+        pieces.clear();
+        while(! sr.done())
+        {
+            char buf[7];
+            string_view const sv = sr.read(buf);
+            pieces.append(sv.data(), sv.size());
+        }
+        BOOST_TEST(pieces == whole);
+    }
+
+    void
+    testStorage()
+    {
+        error_code ec;
+        monotonic_resource mr;
+        value const jv = parse_msgpack(
+            serialize_msgpack(parse(
+                "{\"a\":[1,2]}")), ec, &mr);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv.storage().get() == &mr);
+    }
+
+    void
+    run()
+    {
+        testRoundTrip();
+        testEncoding();
+        testDecoding();
+        testErrors();
+        testSerializer();
+        testStorage();
+    }
+};
+
+TEST_SUITE(msgpack_test, "boost.json.msgpack");
+
+} // namespace json
+} // namespace boost
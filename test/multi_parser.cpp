@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/multi_parser.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/system_error.hpp>
+
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class multi_parser_test
+{
+public:
+    // parse the stream in chunks of every
+    // size and compare the emitted documents
+    void
+    check(
+        string_view s,
+        std::vector<string_view> expected)
+    {
+        for(std::size_t chunk = 1;
+            chunk <= s.size(); ++chunk)
+        {
+            multi_parser p;
+            std::vector<value> docs;
+            auto const cb =
+            [&docs](value jv)
+            {
+                docs.push_back(std::move(jv));
+            };
+            error_code ec;
+            std::size_t n = 0;
+            while(n < s.size())
+            {
+                std::size_t amount = chunk;
+                if(amount > s.size() - n)
+                    amount = s.size() - n;
+                auto const used = p.write(
+                    s.data() + n, amount, cb, ec);
+                BOOST_TEST(! ec);
+                BOOST_TEST(used == amount);
+                n += used;
+            }
+            p.finish(cb, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(p.done());
+            if(! BOOST_TEST(docs.size() ==
+                    expected.size()))
+                continue;
+            for(std::size_t i = 0;
+                i < docs.size(); ++i)
+                BOOST_TEST(docs[i] ==
+                    parse(expected[i]));
+        }
+    }
+
+    void
+    testParse()
+    {
+        check("[1,2,3]", {"[1,2,3]"});
+        check("{}[]", {"{}", "[]"});
+        check(
+            "{\"ok\":true,\"id\":1}"
+            "{\"ok\":true,\"id\":2}",
+            {"{\"ok\":true,\"id\":1}",
+             "{\"ok\":true,\"id\":2}"});
+        check("1 2 3", {"1", "2", "3"});
+        check("null true \"x\"",
+            {"null", "true", "\"x\""});
+        check(" [1] \n\r\t [2] ",
+            {"[1]", "[2]"});
+        check("  \n ", {});
+        check("[[1,[2]],{\"a\":{}}]\"s\"7",
+            {"[[1,[2]],{\"a\":{}}]", "\"s\"", "7"});
+    }
+
+    void
+    testFinish()
+    {
+        // a trailing number is completed
+        // only by finish
+        multi_parser p;
+        std::vector<value> docs;
+        auto const cb =
+        [&docs](value jv)
+        {
+            docs.push_back(std::move(jv));
+        };
+        error_code ec;
+        p.write("[1] 23", cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(docs.size() == 1);
+        BOOST_TEST(! p.done());
+        p.finish(cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(p.done());
+        BOOST_TEST(docs.size() == 2);
+        BOOST_TEST(docs[1] == value(23));
+
+        // finish with nothing pending
+        // is a no-op
+        p.finish(cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(docs.size() == 2);
+
+        // an incomplete document is an error
+        p.reset();
+        p.write("{\"a\":", cb, ec);
+        BOOST_TEST(! ec);
+        p.finish(cb, ec);
+        BOOST_TEST(ec == error::incomplete);
+        BOOST_TEST_THROWS(
+            p.finish(cb), system_error);
+    }
+
+    void
+    testError()
+    {
+        multi_parser p;
+        std::size_t count = 0;
+        auto const cb =
+        [&count](value)
+        {
+            ++count;
+        };
+        error_code ec;
+
+        // documents before the error
+        // are still emitted, and the
+        // offset points at the error
+        auto const n = p.write(
+            string_view("[1] [2] [3,]"), cb, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(count == 2);
+        BOOST_TEST(n == 11);
+
+        // subsequent writes fail
+        // until the parser is reset
+        p.write(string_view("[4]"), cb, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(count == 2);
+        p.reset();
+        p.write(string_view("[4] "), cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(count == 3);
+
+        // throwing overload
+        p.reset();
+        BOOST_TEST_THROWS(p.write(
+            string_view("[1] x"), cb),
+            system_error);
+    }
+
+    void
+    testStorage()
+    {
+        // every document emitted since the
+        // last reset uses its resource
+        monotonic_resource mr;
+        multi_parser p;
+        p.reset(&mr);
+        std::vector<value> docs;
+        auto const cb =
+        [&docs](value jv)
+        {
+            docs.push_back(std::move(jv));
+        };
+        error_code ec;
+        p.write(string_view(
+            "[1,2] {\"k\":\"v\"}"), cb, ec);
+        p.finish(cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(docs.size() == 2);
+        for(auto const& jv : docs)
+            BOOST_TEST(*jv.storage() == mr);
+    }
+
+    void
+    testOptions()
+    {
+        // options apply to every document
+        parse_options opt;
+        opt.allow_comments = true;
+        multi_parser p(storage_ptr(), opt);
+        std::vector<value> docs;
+        auto const cb =
+        [&docs](value jv)
+        {
+            docs.push_back(std::move(jv));
+        };
+        error_code ec;
+        p.write(string_view(
+            "[1] /*c*/ [2] // c\n [3]"), cb, ec);
+        p.finish(cb, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(docs.size() == 3);
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testFinish();
+        testError();
+        testStorage();
+        testOptions();
+    }
+};
+
+TEST_SUITE(multi_parser_test, "boost.json.multi_parser");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/ndjson.hpp>
+
+#include <boost/json/serialize.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class ndjson_test
+{
+public:
+    void
+    testParse()
+    {
+        error_code ec;
+        auto vs = parse_ndjson(
+            "{\"a\":1}\n[1,2,3]\n\"x\"\nnull\n", ec);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == 4))
+        {
+            BOOST_TEST(serialize(vs[0]) == "{\"a\":1}");
+            BOOST_TEST(serialize(vs[1]) == "[1,2,3]");
+            BOOST_TEST(vs[2].as_string() == "x");
+            BOOST_TEST(vs[3].is_null());
+        }
+
+        // missing final terminator, CRLF,
+        // and whitespace-only lines
+        ec = {};
+        vs = parse_ndjson("1\r\n\r\n  \n2", ec);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == 2))
+        {
+            BOOST_TEST(vs[0] == value(1));
+            BOOST_TEST(vs[1] == value(2));
+        }
+
+        // empty input
+        ec = {};
+        vs = parse_ndjson("", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(vs.empty());
+    }
+
+    void
+    testErrors()
+    {
+        // a bad record reports an error
+        // and returns an empty batch
+        error_code ec;
+        auto vs = parse_ndjson("1\n[2\n3\n", ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(vs.empty());
+
+        BOOST_TEST_THROWS(
+            parse_ndjson("{"),
+            system_error);
+
+        // records may not span lines
+        ec = {};
+        vs = parse_ndjson("[1,\n2]\n", ec);
+        BOOST_TEST(ec);
+    }
+
+    void
+    testParallel()
+    {
+        std::string s;
+        for(int i = 0; i < 1000; ++i)
+            s += "{\"i\":" +
+                std::to_string(i) + "}\n";
+
+        error_code ec;
+        auto vs1 = parse_ndjson(s, ec);
+        BOOST_TEST(! ec);
+        auto vs2 = parse_ndjson(s, ec, {}, 4);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs1.size() == vs2.size()))
+        {
+            for(std::size_t i = 0;
+                i < vs1.size(); ++i)
+                BOOST_TEST(vs1[i] == vs2[i]);
+        }
+
+        // errors are still reported
+        // when parsing in parallel
+        s += "{bad\n";
+        ec = {};
+        auto vs3 = parse_ndjson(s, ec, {}, 4);
+        BOOST_TEST(ec);
+        BOOST_TEST(vs3.empty());
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testErrors();
+        testParallel();
+    }
+};
+
+TEST_SUITE(ndjson_test, "boost.json.ndjson");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/number_array.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/value_from.hpp>
+#include <boost/json/value_to.hpp>
+
+#include "test.hpp"
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class number_array_test
+{
+public:
+    void
+    testPacked()
+    {
+        // integers stay in the packed
+        // int64 column
+        number_array na;
+        for(std::int64_t i = 0; i < 100; ++i)
+            na.push_back(i);
+        BOOST_TEST(na.kind() == kind::int64);
+        BOOST_TEST(na.size() == 100);
+        auto const p = na.if_int64();
+        if(BOOST_TEST(p != nullptr))
+        {
+            BOOST_TEST(p[0] == 0);
+            BOOST_TEST(p[99] == 99);
+        }
+        BOOST_TEST(na.if_double() == nullptr);
+        BOOST_TEST(na.if_array() == nullptr);
+
+        // a double converts the column
+        // in place
+        na.push_back(1.5);
+        BOOST_TEST(na.kind() == kind::double_);
+        BOOST_TEST(na.size() == 101);
+        auto const q = na.if_double();
+        if(BOOST_TEST(q != nullptr))
+        {
+            BOOST_TEST(q[0] == 0.0);
+            BOOST_TEST(q[99] == 99.0);
+            BOOST_TEST(q[100] == 1.5);
+        }
+
+        // later integers are stored
+        // as doubles
+        na.push_back(std::int64_t(7));
+        BOOST_TEST(na.kind() == kind::double_);
+        BOOST_TEST(na.if_double()[101] == 7.0);
+    }
+
+    void
+    testGeneric()
+    {
+        // a non-number abandons the
+        // packed form
+        number_array na;
+        na.push_back(std::int64_t(1));
+        na.push_back(std::int64_t(2));
+        na.push_back(value("x"));
+        BOOST_TEST(na.kind() == kind::array);
+        BOOST_TEST(na.size() == 3);
+        auto const a = na.if_array();
+        if(BOOST_TEST(a != nullptr))
+        {
+            BOOST_TEST(a->at(0).as_int64() == 1);
+            BOOST_TEST(a->at(2).as_string() == "x");
+        }
+        BOOST_TEST(na.if_int64() == nullptr);
+
+        // further pushes go to the array
+        na.push_back(std::int64_t(3));
+        BOOST_TEST(na.size() == 4);
+        BOOST_TEST(
+            na.if_array()->at(3).as_int64() == 3);
+    }
+
+    void
+    testConversion()
+    {
+        // canada.json-style coordinates
+        // pack as doubles
+        {
+            value jv = parse(
+                R"([[-65.61, 43.42],
+                    [-65.62, 43.45]])");
+            number_array na(
+                jv.at(0).as_array());
+            BOOST_TEST(
+                na.kind() == kind::double_);
+            BOOST_TEST(serialize(na.to_array())
+                == serialize(jv.at(0)));
+        }
+
+        // heterogeneous input round-trips
+        // through the generic form
+        {
+            value jv = parse(
+                R"([1, "two", 3.0])");
+            number_array na(jv.as_array());
+            BOOST_TEST(
+                na.kind() == kind::array);
+            BOOST_TEST(
+                na.to_array() == jv.as_array());
+        }
+
+        // empty input stays packed
+        {
+            number_array na((array()));
+            BOOST_TEST(
+                na.kind() == kind::int64);
+            BOOST_TEST(na.empty());
+            BOOST_TEST(na.to_array().empty());
+        }
+    }
+
+    void
+    testStorage()
+    {
+        // the packed column and any
+        // generic fallback use the
+        // given resource
+        monotonic_resource mr;
+        number_array na(&mr);
+        BOOST_TEST(
+            na.storage().get() == &mr);
+        for(std::int64_t i = 0; i < 10; ++i)
+            na.push_back(i);
+        na.push_back(value("x"));
+        BOOST_TEST(na.if_array()->storage()
+            .get() == &mr);
+        BOOST_TEST(na.to_array().storage()
+            .get() == &mr);
+
+        // reserve prevents reallocation
+        fail_resource fr;
+        {
+            number_array na2(
+                (storage_ptr(&fr)));
+            na2.reserve(1000);
+            auto const n = fr.nalloc;
+            for(std::int64_t i = 0;
+                    i < 1000; ++i)
+                na2.push_back(i);
+            BOOST_TEST(fr.nalloc == n);
+        }
+        BOOST_TEST(fr.nalloc == 0);
+    }
+
+    void
+    testMove()
+    {
+        number_array na1;
+        na1.push_back(std::int64_t(1));
+        number_array na2(std::move(na1));
+        BOOST_TEST(na2.size() == 1);
+        BOOST_TEST(na1.empty());
+        BOOST_TEST(
+            na1.kind() == kind::int64);
+        na1.push_back(std::int64_t(2));
+        BOOST_TEST(na1.size() == 1);
+    }
+
+    void
+    testValueConversion()
+    {
+        // value_to builds the packed column
+        value jv = parse("[1.5,2.5,3.5]");
+        auto na = value_to<number_array>(jv);
+        double const* p = na.if_double();
+        if(BOOST_TEST(p != nullptr))
+        {
+            BOOST_TEST(na.size() == 3);
+            BOOST_TEST(p[1] == 2.5);
+        }
+
+        // value_from produces the
+        // equivalent array
+        BOOST_TEST(value_from(na) == jv);
+
+        // integer columns round-trip too
+        auto ni = value_to<number_array>(
+            parse("[1,2,3]"));
+        BOOST_TEST(ni.if_int64() != nullptr);
+        BOOST_TEST(
+            value_from(ni) == parse("[1,2,3]"));
+
+        // so does the generic representation
+        auto ng = value_to<number_array>(
+            parse("[1,\"x\"]"));
+        BOOST_TEST(ng.if_array() != nullptr);
+        BOOST_TEST(value_from(ng) ==
+            parse("[1,\"x\"]"));
+
+        // only arrays convert
+        BOOST_TEST_THROWS(
+            value_to<number_array>(value(1)),
+            system_error);
+    }
+
+    void
+    run()
+    {
+        testPacked();
+        testGeneric();
+        testConversion();
+        testStorage();
+        testMove();
+        testValueConversion();
+    }
+};
+
+TEST_SUITE(number_array_test, "boost.json.number_array");
+
+} // namespace json
+} // namespace boost
+
@@ -1283,6 +1283,95 @@ public:
             }
         }
 
+        // erase_if(pred)
+        {
+            // small
+            {
+                object o(i0_);
+                BOOST_TEST(o.erase_if(
+                    [](key_value_pair& kv)
+                    {
+                        return (kv.value().
+                            as_int64() % 2) != 0;
+                    }) == 8);
+                BOOST_TEST(serialize(o) ==
+                    R"({"0":0,"2":2,"4":4,"6":6,)"
+                    R"("8":8,"10":10,"12":12,"14":14})");
+                BOOST_TEST(o.find("10") ==
+                    o.begin() + 5);
+                BOOST_TEST(o.find("1") == o.end());
+            }
+
+            // large
+            {
+                object o(i1_);
+                BOOST_TEST(o.erase_if(
+                    [](key_value_pair& kv)
+                    {
+                        return (kv.value().
+                            as_int64() % 2) != 0;
+                    }) == 10);
+                BOOST_TEST(serialize(o) ==
+                    R"({"0":0,"2":2,"4":4,"6":6,"8":8,)"
+                    R"("10":10,"12":12,"14":14,"16":16,"18":18})");
+                BOOST_TEST(o.find("18") ==
+                    o.end() - 1);
+                BOOST_TEST(o.find("19") == o.end());
+            }
+
+            // no matches
+            {
+                object o(i1_);
+                BOOST_TEST(o.erase_if(
+                    [](key_value_pair&)
+                    {
+                        return false;
+                    }) == 0);
+                check(o, s1_, i1_.size());
+            }
+
+            // all matches
+            {
+                object o(i1_);
+                BOOST_TEST(o.erase_if(
+                    [](key_value_pair&)
+                    {
+                        return true;
+                    }) == i1_.size());
+                BOOST_TEST(o.empty());
+            }
+
+            // empty
+            {
+                object o;
+                BOOST_TEST(o.erase_if(
+                    [](key_value_pair&)
+                    {
+                        return true;
+                    }) == 0);
+                BOOST_TEST(o.empty());
+            }
+        }
+
+        // extract(key)
+        {
+            object o({
+                {"a", 1},
+                {"b", {1, 2, 3}},
+                {"c", "hello"}});
+            auto const* p =
+                o.at("b").get_array().data();
+            value jv = o.extract("b");
+
+            // the subtree was pilfered, not copied
+            BOOST_TEST(jv.get_array().data() == p);
+            BOOST_TEST(jv == value({1, 2, 3}));
+            BOOST_TEST(o.size() == 2);
+            BOOST_TEST(o.find("b") == o.end());
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                o.extract("b"));
+        }
+
         // swap(object&)
         {
             {
@@ -1387,6 +1476,45 @@ public:
                 co1.find("a")->key() == "a");
             BOOST_TEST(
                 co1.find("e") == o1.end());
+
+            // small objects use a linear scan;
+            // keys sharing a length or a first
+            // character must still disambiguate
+            object o2{
+                {"", 0},
+                {"ab", 1},
+                {"ac", 2},
+                {"ba", 3}};
+            BOOST_TEST(
+                o2.find("")->value() == 0);
+            BOOST_TEST(
+                o2.find("ab")->value() == 1);
+            BOOST_TEST(
+                o2.find("ac")->value() == 2);
+            BOOST_TEST(
+                o2.find("ba")->value() == 3);
+            BOOST_TEST(
+                o2.find("aa") == o2.end());
+            BOOST_TEST(
+                o2.find("a") == o2.end());
+
+            // hashed objects store the key
+            // length in the probe metadata,
+            // clamped to 255; longer keys
+            // must still be found
+            object o3;
+            std::string const k1(300, 'x');
+            std::string k2 = k1;
+            k2.back() = 'y';
+            for(std::size_t i = 0; i < 40; ++i)
+                o3.emplace(std::to_string(i), i);
+            o3.emplace(k1, 1);
+            o3.emplace(k2, 2);
+            BOOST_TEST(! o3.t_->is_small());
+            BOOST_TEST(
+                o3.find(k1)->value() == 1);
+            BOOST_TEST(
+                o3.find(k2)->value() == 2);
         }
 
         // contains(key)
@@ -1407,6 +1535,57 @@ public:
             *o1.if_contains("a") = 2;
             BOOST_TEST(co1.if_contains("a")->as_int64() == 2);
         }
+
+        // get(key)
+        // get(key) const
+        {
+            BOOST_TEST(o1.get("a").is_int64());
+            BOOST_TEST(co1.get("b").is_bool());
+
+            o1.get("a") = 7;
+            BOOST_TEST(co1.get("a").as_int64() == 7);
+            o1.get("a") = 1;
+
+            // rvalue overload
+            object o(o1);
+            value v( std::move(o).get("a") );
+            BOOST_TEST(v.as_int64() == 1);
+        }
+
+        // existence filter
+        {
+            object o;
+            for(int i = 0; i < 64; ++i)
+                o.emplace(std::to_string(i), i);
+            BOOST_TEST(! o.t_->is_small());
+
+            for(int i = 0; i < 64; ++i)
+                BOOST_TEST(o.contains(
+                    std::to_string(i)));
+            for(int i = 64; i < 256; ++i)
+                BOOST_TEST(! o.contains(
+                    std::to_string(i)));
+
+            // erasure leaves the filter
+            // conservative, never wrong
+            for(int i = 0; i < 64; i += 2)
+                o.erase(std::to_string(i));
+            for(int i = 0; i < 64; i += 2)
+                BOOST_TEST(! o.contains(
+                    std::to_string(i)));
+            for(int i = 1; i < 64; i += 2)
+                BOOST_TEST(o.contains(
+                    std::to_string(i)));
+
+            // growth rebuilds the filter
+            o.reserve(o.capacity() + 1);
+            for(int i = 1; i < 64; i += 2)
+                BOOST_TEST(o.contains(
+                    std::to_string(i)));
+            for(int i = 0; i < 64; i += 2)
+                BOOST_TEST(! o.contains(
+                    std::to_string(i)));
+        }
     }
 
     void
@@ -1657,6 +1836,671 @@ public:
         BOOST_TEST( capacity == o.capacity() );
     }
 
+    void
+    testMerge()
+    {
+        // same storage: elements are transferred
+        {
+            object o1({{"a", 1}, {"b", 2}});
+            object o2({{"b", 99}, {"c", 3}, {"d", 4}});
+            o1.merge(std::move(o2));
+            BOOST_TEST(o1.size() == 4);
+            BOOST_TEST(o1.at("a").as_int64() == 1);
+            BOOST_TEST(o1.at("b").as_int64() == 2);
+            BOOST_TEST(o1.at("c").as_int64() == 3);
+            BOOST_TEST(o1.at("d").as_int64() == 4);
+            // the colliding element stays behind
+            BOOST_TEST(o2.size() == 1);
+            BOOST_TEST(o2.at("b").as_int64() == 99);
+        }
+
+        // merge into empty
+        {
+            object o1;
+            object o2({{"a", 1}, {"b", 2}});
+            o1.merge(std::move(o2));
+            BOOST_TEST(o1.size() == 2);
+            BOOST_TEST(o2.empty());
+        }
+
+        // merge from empty, self-merge
+        {
+            object o1({{"a", 1}});
+            o1.merge(object());
+            BOOST_TEST(o1.size() == 1);
+            o1.merge(std::move(o1));
+            BOOST_TEST(o1.size() == 1);
+            BOOST_TEST(o1.at("a").as_int64() == 1);
+        }
+
+        // different storage: elements are copied
+        // into the destination's resource
+        {
+            monotonic_resource mr;
+            object o1(&mr);
+            o1.emplace("a", 1);
+            object o2({{"a", 9}, {"b", 2}});
+            o1.merge(std::move(o2));
+            BOOST_TEST(o1.size() == 2);
+            BOOST_TEST(o1.at("b").as_int64() == 2);
+            BOOST_TEST(*o1.at("b").storage() == mr);
+            BOOST_TEST(o2.size() == 1);
+            BOOST_TEST(o2.at("a").as_int64() == 9);
+        }
+
+        // large objects exercise the hashed
+        // index on both sides
+        {
+            object o1;
+            object o2;
+            for(int i = 0; i < 40; ++i)
+            {
+                std::string k = std::to_string(i);
+                if(i % 2 == 0)
+                    o1.emplace(k, i);
+                if(i % 3 == 0)
+                    o2.emplace(k, -i);
+            }
+            auto const n1 = o1.size();
+            auto const n2 = o2.size();
+            std::size_t collisions = 0;
+            for(int i = 0; i < 40; i += 3)
+                if(i % 2 == 0)
+                    ++collisions;
+            o1.merge(std::move(o2));
+            BOOST_TEST(o1.size() ==
+                n1 + n2 - collisions);
+            BOOST_TEST(o2.size() == collisions);
+            for(int i = 0; i < 40; ++i)
+            {
+                std::string k = std::to_string(i);
+                if(i % 2 == 0)
+                    BOOST_TEST(
+                        o1.at(k).as_int64() == i);
+                else if(i % 3 == 0)
+                    BOOST_TEST(
+                        o1.at(k).as_int64() == -i);
+                else
+                    BOOST_TEST(
+                        o1.find(k) == o1.end());
+            }
+            // the source index still works
+            for(int i = 0; i < 40; i += 6)
+                BOOST_TEST(
+                    o2.at(std::to_string(i)
+                        ).as_int64() == -i);
+            // merging sized the table only once
+            BOOST_TEST(
+                o1.capacity() >= n1 + n2);
+        }
+    }
+
+    void
+    testOptimize()
+    {
+        // small objects are unaffected
+        {
+            object o({{"a", 1}, {"b", 2}});
+            auto const c0 = o.capacity();
+            o.optimize();
+            BOOST_TEST(o.capacity() == c0);
+            BOOST_TEST(o.at("a").as_int64() == 1);
+        }
+
+        // the index is rebuilt at a load
+        // factor of at most one half
+        {
+            object o;
+            for(int i = 0; i < 40; ++i)
+                o.emplace(std::to_string(i), i);
+            std::string const before =
+                serialize(o);
+            o.optimize();
+            BOOST_TEST(
+                o.capacity() >= 2 * o.size());
+            // iteration order is unchanged
+            BOOST_TEST(
+                serialize(o) == before);
+            // lookups still find everything
+            for(int i = 0; i < 40; ++i)
+                BOOST_TEST(o.at(
+                    std::to_string(i)
+                        ).as_int64() == i);
+            BOOST_TEST(o.find("none") ==
+                o.end());
+
+            // the container remains usable
+            o.emplace("40", 40);
+            BOOST_TEST(
+                o.at("40").as_int64() == 40);
+            o.erase("0");
+            BOOST_TEST(o.find("0") == o.end());
+            BOOST_TEST(o.size() == 40);
+        }
+
+        // empty hashed object
+        {
+            object o;
+            o.reserve(100);
+            o.optimize();
+            BOOST_TEST(o.empty());
+            o.emplace("a", 1);
+            BOOST_TEST(o.at("a").as_int64() == 1);
+        }
+    }
+
+    void
+    testReorder()
+    {
+        // listed keys move to the front in
+        // order, the rest keep their
+        // relative order
+        {
+            object o({
+                {"a", 1}, {"b", 2},
+                {"c", 3}, {"d", 4},
+                {"e", 5}});
+            string_view const hot[] =
+                { "d", "b" };
+            o.reorder(hot, 2);
+            BOOST_TEST(serialize(o) ==
+                "{\"d\":4,\"b\":2,\"a\":1,"
+                "\"c\":3,\"e\":5}");
+            BOOST_TEST(o.at("a") == 1);
+            BOOST_TEST(o.at("d") == 4);
+        }
+
+        // unknown keys are ignored; the
+        // index still finds every element
+        // after the rebuild
+        {
+            object o;
+            for(int i = 0; i < 50; ++i)
+                o.emplace(
+                    std::to_string(i), i);
+            string_view const hot[] =
+                { "31", "missing", "7" };
+            o.reorder(hot, 3);
+            BOOST_TEST(
+                o.begin()->key() == "31");
+            BOOST_TEST(
+                (o.begin() + 1)->key() == "7");
+            for(int i = 0; i < 50; ++i)
+                BOOST_TEST(o.at(
+                    std::to_string(i)
+                        ).as_int64() == i);
+            BOOST_TEST(o.find("none") ==
+                o.end());
+
+            // the container remains usable
+            o.emplace("50", 50);
+            BOOST_TEST(
+                o.at("50").as_int64() == 50);
+            o.erase("31");
+            BOOST_TEST(o.size() == 50);
+            BOOST_TEST(
+                o.at("7").as_int64() == 7);
+        }
+
+        // degenerate cases
+        {
+            object o;
+            string_view const k[] = { "a" };
+            o.reorder(k, 1);
+            BOOST_TEST(o.empty());
+
+            o.emplace("a", 1);
+            o.reorder(k, 0);
+            o.reorder(k, 1);
+            BOOST_TEST(
+                o.at("a").as_int64() == 1);
+        }
+    }
+
+    void
+    testEmplaceAt()
+    {
+        // emplace_at creates the chain
+        {
+            object o;
+            o.emplace_at({"a", "b", "c"}, 42);
+            BOOST_TEST(o.at("a").at("b")
+                .at("c").as_int64() == 42);
+        }
+
+        // existing levels are reused,
+        // siblings are preserved
+        {
+            object o;
+            o.emplace_at({"a", "x"}, 1);
+            o.emplace_at({"a", "y"}, 2);
+            BOOST_TEST(
+                o.at("a").as_object().size() == 2);
+            BOOST_TEST(
+                o.at("a").at("x").as_int64() == 1);
+            BOOST_TEST(
+                o.at("a").at("y").as_int64() == 2);
+        }
+
+        // the last key assigns over an
+        // existing element
+        {
+            object o;
+            o.emplace_at({"a", "b"}, 1);
+            value& v = o.emplace_at(
+                {"a", "b"}, "hello");
+            BOOST_TEST(
+                o.at("a").at("b").as_string()
+                    == "hello");
+            BOOST_TEST(&v ==
+                &o.at("a").at("b"));
+        }
+
+        // a single-key path behaves like
+        // insert_or_assign
+        {
+            object o;
+            o.emplace_at({"a"}, 1);
+            BOOST_TEST(o.at("a").as_int64() == 1);
+        }
+
+        // a non-object intermediate throws
+        {
+            object o;
+            o.emplace("a", 1);
+            BOOST_TEST_THROWS(
+                o.emplace_at({"a", "b"}, 2),
+                system_error);
+        }
+
+        // created levels use the
+        // container's storage
+        {
+            monotonic_resource mr;
+            object o(&mr);
+            value& v = o.emplace_at(
+                {"a", "b"}, "propagated storage");
+            BOOST_TEST(*o.at("a")
+                .storage() == mr);
+            BOOST_TEST(*v.storage() == mr);
+        }
+
+        // the rvalue subscript returns an
+        // rvalue that can be moved from
+        {
+            object o;
+            o.emplace("a",
+                "a string long enough to allocate");
+            value jv(std::move(o)["a"]);
+            BOOST_TEST(jv.as_string() ==
+                "a string long enough to allocate");
+        }
+    }
+
+    void
+    testIntrospection()
+    {
+        // small objects use a linear search
+        // and report no buckets
+        {
+            object o{{"a", 1}, {"b", 2}};
+            BOOST_TEST(o.bucket_count() == 0);
+            BOOST_TEST(o.load_factor() == 0);
+            BOOST_TEST(
+                o.max_probe_length() == 2);
+            BOOST_TEST(
+                o.probe_distribution().empty());
+        }
+
+        // hashed objects report consistent
+        // numbers
+        {
+            object o;
+            for(int i = 0; i < 100; ++i)
+                o.emplace(
+                    "key" + std::to_string(i), i);
+            BOOST_TEST(o.bucket_count() ==
+                o.capacity());
+            BOOST_TEST(o.load_factor() ==
+                double(o.size()) /
+                    o.bucket_count());
+            BOOST_TEST(
+                o.max_probe_length() >= 1);
+            BOOST_TEST(
+                o.max_probe_length() <= o.size());
+
+            auto const dist =
+                o.probe_distribution();
+            BOOST_TEST(dist.size() ==
+                o.max_probe_length() + 1);
+            std::size_t buckets = 0;
+            std::size_t elements = 0;
+            for(std::size_t n = 0;
+                    n < dist.size(); ++n)
+            {
+                buckets += dist[n];
+                elements += n * dist[n];
+            }
+            BOOST_TEST(
+                buckets == o.bucket_count());
+            BOOST_TEST(elements == o.size());
+
+            // optimize rebuilds at a load
+            // factor of at most one half
+            o.optimize();
+            BOOST_TEST(
+                o.load_factor() <= 0.5);
+        }
+
+        // the empty object
+        {
+            object o;
+            BOOST_TEST(o.bucket_count() == 0);
+            BOOST_TEST(o.load_factor() == 0);
+            BOOST_TEST(
+                o.max_probe_length() == 0);
+        }
+    }
+
+    void
+    testIncrementalRehash()
+    {
+        auto const key =
+            [](int i)
+            {
+                return "key" +
+                    std::to_string(i);
+            };
+
+        // growth defers the rebuild and
+        // insertions migrate it; every key
+        // is found throughout
+        {
+            object o;
+            BOOST_TEST(
+                ! o.incremental_rehash());
+            o.incremental_rehash(true);
+            BOOST_TEST(
+                o.incremental_rehash());
+            bool saw_pending = false;
+            for(int i = 0; i < 2000; ++i)
+            {
+                o.emplace(key(i), i);
+                saw_pending = saw_pending ||
+                    o.rehash_pending();
+                // spot check older keys
+                BOOST_TEST(o.at(
+                    key(i / 2)).as_int64() ==
+                        i / 2);
+            }
+            BOOST_TEST(saw_pending);
+            BOOST_TEST(o.size() == 2000);
+            for(int i = 0; i < 2000; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+
+            // introspection covers both
+            // indexes while pending
+            auto const dist =
+                o.probe_distribution();
+            std::size_t elements = 0;
+            for(std::size_t n = 0;
+                    n < dist.size(); ++n)
+                elements += n * dist[n];
+            BOOST_TEST(
+                elements == o.size());
+
+            // disabling retires any
+            // pending migration
+            o.incremental_rehash(false);
+            BOOST_TEST(! o.rehash_pending());
+            BOOST_TEST(
+                ! o.incremental_rehash());
+            for(int i = 0; i < 2000; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+        }
+
+        // duplicates are rejected while a
+        // migration is pending
+        {
+            object o;
+            o.incremental_rehash(true);
+            int n = 0;
+            while(! o.rehash_pending())
+            {
+                o.emplace(key(n), n);
+                ++n;
+            }
+            auto const size = o.size();
+            for(int i = 0; i < n; ++i)
+            {
+                auto const r =
+                    o.emplace(key(i), -1);
+                BOOST_TEST(! r.second);
+            }
+            o.insert({{key(0), -1}});
+            BOOST_TEST(o.size() == size);
+            BOOST_TEST(o.at(
+                key(0)).as_int64() == 0);
+        }
+
+        // erasure retires the migration
+        // first and stays consistent
+        {
+            object o;
+            o.incremental_rehash(true);
+            int n = 0;
+            while(! o.rehash_pending())
+            {
+                o.emplace(key(n), n);
+                ++n;
+            }
+            BOOST_TEST(o.erase(key(0)) == 1);
+            BOOST_TEST(! o.rehash_pending());
+            BOOST_TEST(
+                o.size() == std::size_t(n) - 1);
+            for(int i = 1; i < n; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+        }
+
+        // so do optimize and clear
+        {
+            object o;
+            o.incremental_rehash(true);
+            int n = 0;
+            while(! o.rehash_pending())
+            {
+                o.emplace(key(n), n);
+                ++n;
+            }
+            o.optimize();
+            BOOST_TEST(! o.rehash_pending());
+            BOOST_TEST(
+                o.incremental_rehash());
+            for(int i = 0; i < n; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+
+            while(! o.rehash_pending())
+            {
+                o.emplace(key(n), n);
+                ++n;
+            }
+            o.clear();
+            BOOST_TEST(! o.rehash_pending());
+            BOOST_TEST(o.empty());
+        }
+
+        // equality ignores the mode, and
+        // copies do not inherit it
+        {
+            object o1;
+            o1.incremental_rehash(true);
+            object o2;
+            for(int i = 0; i < 500; ++i)
+            {
+                o1.emplace(key(i), i);
+                o2.emplace(key(i), i);
+            }
+            BOOST_TEST(o1 == o2);
+            object o3(o1);
+            BOOST_TEST(
+                ! o3.incremental_rehash());
+            BOOST_TEST(o3 == o1);
+        }
+    }
+
+    void
+    testFreeze()
+    {
+        auto const key =
+            [](int i)
+            {
+                return "key" +
+                    std::to_string(i);
+            };
+
+        // every key is found with a
+        // perfect hash, absent keys miss
+        {
+            object o;
+            for(int i = 0; i < 500; ++i)
+                o.emplace(key(i), i);
+            auto const s = serialize(o);
+            BOOST_TEST(! o.frozen());
+            BOOST_TEST(o.freeze_phf());
+            BOOST_TEST(o.frozen());
+            for(int i = 0; i < 500; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+            for(int i = 500; i < 600; ++i)
+                BOOST_TEST(o.find(key(i))
+                    == o.end());
+            BOOST_TEST(
+                o.find("") == o.end());
+
+            // iteration order is unchanged
+            BOOST_TEST(serialize(o) == s);
+
+            // freezing again is a no-op
+            BOOST_TEST(o.freeze_phf());
+        }
+
+        // small objects keep their
+        // linear search
+        {
+            object o = {{"a",1}, {"b",2}};
+            BOOST_TEST(! o.freeze_phf());
+            BOOST_TEST(! o.frozen());
+            BOOST_TEST(
+                o.at("a").as_int64() == 1);
+        }
+
+        // mutation falls back to the
+        // normal table
+        {
+            object o;
+            for(int i = 0; i < 100; ++i)
+                o.emplace(key(i), i);
+            BOOST_TEST(o.freeze_phf());
+
+            // assigning through lookups
+            // does not disturb it
+            o.at(key(7)) = -7;
+            o[key(8)] = -8;
+            BOOST_TEST(o.frozen());
+
+            // insertion does
+            o.emplace(key(100), 100);
+            BOOST_TEST(! o.frozen());
+            for(int i = 0; i < 101; ++i)
+                BOOST_TEST(o.contains(key(i)));
+
+            // refreeze, then erase
+            BOOST_TEST(o.freeze_phf());
+            BOOST_TEST(o.erase(key(50)) == 1);
+            BOOST_TEST(! o.frozen());
+            BOOST_TEST(! o.contains(key(50)));
+            BOOST_TEST(o.contains(key(99)));
+
+            // refreeze, then erase_if
+            BOOST_TEST(o.freeze_phf());
+            o.erase_if(
+                [](key_value_pair& kv)
+                {
+                    return kv.value().
+                        as_int64() >= 90;
+                });
+            BOOST_TEST(! o.frozen());
+            BOOST_TEST(! o.contains(key(95)));
+            BOOST_TEST(o.contains(key(0)));
+        }
+
+        // copies never inherit the
+        // perfect hash
+        {
+            object o;
+            for(int i = 0; i < 100; ++i)
+                o.emplace(key(i), i);
+            BOOST_TEST(o.freeze_phf());
+            object o2(o);
+            BOOST_TEST(! o2.frozen());
+            BOOST_TEST(o2 == o);
+
+            // a move transfers the table,
+            // and the hash with it
+            object o3(std::move(o));
+            BOOST_TEST(o3.frozen());
+            BOOST_TEST(o3 == o2);
+        }
+
+        // clear drops it
+        {
+            object o;
+            for(int i = 0; i < 100; ++i)
+                o.emplace(key(i), i);
+            BOOST_TEST(o.freeze_phf());
+            o.clear();
+            BOOST_TEST(! o.frozen());
+            BOOST_TEST(o.empty());
+        }
+
+        // a pending migration is retired
+        // before freezing
+        {
+            object o;
+            o.incremental_rehash(true);
+            int n = 0;
+            while(! o.rehash_pending())
+            {
+                o.emplace(key(n), n);
+                ++n;
+            }
+            BOOST_TEST(o.freeze_phf());
+            BOOST_TEST(! o.rehash_pending());
+            for(int i = 0; i < n; ++i)
+                BOOST_TEST(o.at(
+                    key(i)).as_int64() == i);
+        }
+
+        // frozen objects work through a
+        // monotonic resource, where
+        // deallocation is trivial
+        {
+            monotonic_resource mr;
+            object o(&mr);
+            for(int i = 0; i < 100; ++i)
+                o.emplace(key(i), i);
+            BOOST_TEST(o.freeze_phf());
+            for(int i = 0; i < 100; ++i)
+                BOOST_TEST(o.contains(key(i)));
+            o.emplace(key(100), 100);
+            BOOST_TEST(! o.frozen());
+        }
+    }
+
     void
     run()
     {
@@ -1666,6 +2510,7 @@ public:
         testCapacity();
         testModifiers();
         testLookup();
+        testEmplaceAt();
         testHashPolicy();
         testImplementation();
         testCollisions();
@@ -1673,6 +2518,12 @@ public:
         testAllocation();
         testHash();
         testStrongGurantee();
+        testMerge();
+        testOptimize();
+        testReorder();
+        testIntrospection();
+        testIncrementalRehash();
+        testFreeze();
     }
 };
 
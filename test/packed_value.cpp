@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/packed_value.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/value.hpp>
+
+#include <string>
+#include <utility>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class packed_value_test
+{
+public:
+    void
+    testScalars()
+    {
+        // default constructed
+        {
+            packed_document doc;
+            BOOST_TEST(doc.empty());
+            BOOST_TEST(doc.size_bytes() == 0);
+            BOOST_TEST(doc.root().is_null());
+        }
+        {
+            packed_document doc(
+                (value(nullptr)));
+            BOOST_TEST(! doc.empty());
+            BOOST_TEST(doc.root().is_null());
+            BOOST_TEST(doc.root().kind() ==
+                kind::null);
+        }
+        {
+            packed_document doc((value(true)));
+            BOOST_TEST(doc.root().is_bool());
+            BOOST_TEST(doc.root().get_bool());
+        }
+        {
+            packed_document doc((value(-42)));
+            BOOST_TEST(doc.root().is_int64());
+            BOOST_TEST(doc.root(
+                ).get_int64() == -42);
+        }
+        {
+            packed_document doc((value(
+                UINT64_C(18446744073709551615))));
+            BOOST_TEST(doc.root().is_uint64());
+            BOOST_TEST(doc.root().get_uint64()
+                == UINT64_C(
+                    18446744073709551615));
+        }
+        {
+            packed_document doc(
+                (value(1.5)));
+            BOOST_TEST(doc.root().is_double());
+            BOOST_TEST(doc.root(
+                ).get_double() == 1.5);
+        }
+        {
+            packed_document doc((value(
+                "hello, packed world")));
+            BOOST_TEST(doc.root().is_string());
+            BOOST_TEST(doc.root().get_string()
+                == "hello, packed world");
+        }
+    }
+
+    void
+    testContainers()
+    {
+        value const jv = parse(
+            "{\"a\":[1,2,3],"
+            "\"b\":{\"x\":null,\"y\":"
+            "\"s\"},\"c\":false}");
+        packed_document doc(jv);
+        auto const root = doc.root();
+        BOOST_TEST(root.is_object());
+        BOOST_TEST(root.size() == 3);
+        BOOST_TEST(root.key_at(0) == "a");
+        BOOST_TEST(root.key_at(2) == "c");
+        BOOST_TEST(root.contains("b"));
+        BOOST_TEST(! root.contains("d"));
+
+        auto const a = root.at("a");
+        BOOST_TEST(a.is_array());
+        BOOST_TEST(a.size() == 3);
+        BOOST_TEST(
+            a.at(1).get_int64() == 2);
+
+        auto const b = root.at(1);
+        BOOST_TEST(b.is_object());
+        BOOST_TEST(b.at("x").is_null());
+        BOOST_TEST(
+            b.at("y").get_string() == "s");
+
+        BOOST_TEST(
+            ! root.at("c").get_bool());
+
+        // out of range and wrong kind
+        BOOST_TEST_THROWS(
+            root.at(3), system_error);
+        BOOST_TEST_THROWS(
+            root.at("d"), system_error);
+        BOOST_TEST_THROWS(
+            root.key_at(3), system_error);
+        BOOST_TEST_THROWS(
+            a.at("k"), system_error);
+        BOOST_TEST_THROWS(
+            root.at("c").at(0), system_error);
+        BOOST_TEST(! a.contains("k"));
+    }
+
+    void
+    testUnpack()
+    {
+        value const jv = parse(
+            "{\"k\":[{},[],\"\","
+            "[1,2.25,true,null],"
+            "{\"n\":-1,\"u\":2}],"
+            "\"s\":\"str\"}");
+        packed_document doc(jv);
+        BOOST_TEST(doc.root().unpack() == jv);
+
+        // unpack into a caller's resource
+        monotonic_resource mr;
+        value const jv2 = doc.root(
+            ).unpack(&mr);
+        BOOST_TEST(jv2 == jv);
+        BOOST_TEST(jv2.storage().get() == &mr);
+
+        // sub-value unpack
+        BOOST_TEST(doc.root().at("k").unpack()
+            == jv.at("k"));
+    }
+
+    void
+    testDocument()
+    {
+        value const jv = parse(
+            "[\"abc\",{\"k\":1}]");
+
+        // the buffer comes from the
+        // given resource
+        monotonic_resource mr;
+        packed_document doc(jv, &mr);
+        BOOST_TEST(
+            doc.storage().get() == &mr);
+        BOOST_TEST(doc.size_bytes() > 0);
+
+        // move construction transfers
+        // the buffer
+        packed_document doc2(std::move(doc));
+        BOOST_TEST(doc.empty());
+        BOOST_TEST(! doc2.empty());
+        BOOST_TEST(serialize(
+            doc2.root().unpack()) ==
+                serialize(jv));
+
+        // move assignment releases the
+        // old buffer
+        packed_document doc3(
+            (value("replaced")));
+        doc3 = std::move(doc2);
+        BOOST_TEST(doc2.empty());
+        BOOST_TEST(doc3.root().is_array());
+        BOOST_TEST(doc3.root().at(0
+            ).get_string() == "abc");
+    }
+
+    void
+    run()
+    {
+        testScalars();
+        testContainers();
+        testUnpack();
+        testDocument();
+    }
+};
+
+TEST_SUITE(packed_value_test, "boost.json.packed_value");
+
+} // namespace json
+} // namespace boost
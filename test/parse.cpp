@@ -11,8 +11,10 @@
 // Test that header file is self-contained.
 #include <boost/json/parse.hpp>
 
+#include <boost/json/monotonic_resource.hpp>
 #include <boost/json/serialize.hpp>
 
+#include <cstdio>
 #include <string>
 
 #include "test.hpp"
@@ -180,6 +182,76 @@ public:
         }
     }
 
+    void
+    testDuplicateKeys()
+    {
+        auto const check =
+        [](parse_options opt)
+        {
+            string_view const dup =
+                "{\"a\":1,\"b\":2,\"a\":3}";
+            string_view const uniq =
+                "{\"a\":1,\"b\":2,\"c\":3}";
+            // nested, and large enough
+            // to index the inner object
+            std::string big =
+                "{\"x\":{\"k0\":0";
+            for(int i = 1; i < 30; ++i)
+                big += ",\"k" +
+                    std::to_string(i) + "\":" +
+                    std::to_string(i);
+            big += ",\"k7\":77}}";
+
+            // keep the last occurrence
+            opt.on_duplicate_key =
+                duplicate_keys::last;
+            value jv = parse(dup, {}, opt);
+            BOOST_TEST(jv.at("a") == 3);
+            BOOST_TEST(jv.as_object().size() == 2);
+
+            // keep the first occurrence
+            opt.on_duplicate_key =
+                duplicate_keys::first;
+            jv = parse(dup, {}, opt);
+            BOOST_TEST(jv.at("a") == 1);
+            BOOST_TEST(jv.as_object().size() == 2);
+            jv = parse(big, {}, opt);
+            BOOST_TEST(jv.at("x").at("k7") == 7);
+            BOOST_TEST(
+                jv.at("x").as_object().size() == 30);
+
+            // fail the parse
+            opt.on_duplicate_key =
+                duplicate_keys::error;
+            error_code ec;
+            jv = parse(dup, ec, {}, opt);
+            BOOST_TEST(ec == error::duplicate_key);
+            BOOST_TEST(
+                ec == condition::parse_error);
+            BOOST_TEST(jv.is_null());
+            ec = {};
+            jv = parse(big, ec, {}, opt);
+            BOOST_TEST(ec == error::duplicate_key);
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                parse(dup, {}, opt));
+
+            // unique keys are unaffected
+            ec = {};
+            jv = parse(uniq, ec, {}, opt);
+            BOOST_TEST(! ec);
+            BOOST_TEST(
+                jv.as_object().size() == 3);
+        };
+
+        // incremental parser
+        check({});
+
+        // fast path
+        parse_options opt;
+        opt.full_buffer_fast_path = true;
+        check(opt);
+    }
+
     void
     testIssue726()
     {
@@ -191,6 +263,290 @@ public:
         BOOST_TEST(arr == array{123});
     }
 
+    void
+    testFullBufferFastPath()
+    {
+        parse_options opt;
+        opt.full_buffer_fast_path = true;
+
+        // the fast path always parses numbers
+        // precisely; compare against the precise
+        // incremental parser
+        parse_options ref;
+        ref.numbers = number_precision::precise;
+
+        auto const check =
+        [&](string_view s)
+        {
+            error_code ec1;
+            value jv1 = parse(s, ec1, {}, ref);
+            error_code ec2;
+            value jv2 = parse(s, ec2, {}, opt);
+            BOOST_TEST(ec1.failed() == ec2.failed());
+            if(! ec1 && ! ec2)
+                BOOST_TEST(jv1 == jv2);
+        };
+
+        check("null");
+        check("true");
+        check("false");
+        check("17");
+        check("-17");
+        check("0");
+        check("-0");
+        check("1.5e2");
+        check("-1.25");
+        check("18446744073709551615");
+        check("-9223372036854775808");
+        check("99999999999999999999999");
+        check("1e999999");
+        check("\"\"");
+        check("\"x\"");
+        check("\"\\u0041\\ud83d\\ude00\\n\"");
+        check("\"\\\\\\\"\"");
+        check("[]");
+        check("{}");
+        check("[1,2,3]");
+        check("[[[[]]]]");
+        check("{\"a\":1,\"b\":[true,null],\"c\":{}}");
+        check("  [ 1 , \"a\" ]  ");
+        check(std::string(1000, ' ') + "{}");
+        {
+            // long runs of comma-separated
+            // numbers are parsed in batches
+            std::string s = "[";
+            for(int i = 0; i < 200; ++i)
+            {
+                if(i > 0)
+                    s += ',';
+                s += std::to_string(i);
+                s += ",-";
+                s += std::to_string(i);
+                s += ".";
+                s += std::to_string(i + 1);
+                s += "e2";
+            }
+            s += ",\"x\",true,[2,4],12345678901234567890123456,"
+                "3.14159265358979323846264338327950288]";
+            check(s);
+        }
+        {
+            // runs longer than one conversion
+            // batch, mixing exact doubles with
+            // cases that need the slow fallback
+            std::string s = "[";
+            for(int i = 0; i < 100; ++i)
+            {
+                if(i > 0)
+                    s += ',';
+                s += std::to_string(i) + ".25,";
+                s += std::to_string(i) + "e-" +
+                    std::to_string(3 * i);
+                s += ",2.2250738585072014e-308";
+                s += ",18446744073709551615";
+                s += ",123456789012345678901234567890."
+                    "123456789e-3";
+                s += ",1e999,-0.0";
+            }
+            s += "]";
+            check(s);
+        }
+        {
+            // long strings with escapes crossing
+            // 64-byte block boundaries
+            std::string s = "[\"";
+            s.append(63, 'x');
+            s += "\\\"";
+            s.append(100, 'y');
+            s += "\\u00e9\",\"";
+            s.append(200, 'z');
+            s += "\"]";
+            check(s);
+        }
+        {
+            // long runs of consecutive utf16
+            // escapes are decoded in batches
+            // larger than the chunk buffer
+            std::string s = "[\"";
+            for(int i = 0; i < 80; ++i)
+                s += "\\u00e9";
+            s += "\",\"";
+            for(int i = 0; i < 40; ++i)
+                s += "\\ud83d\\ude00";
+            s += "\",\"";
+            for(int i = 0; i < 30; ++i)
+                s += "\\u0041\\u20ac";
+            s += "\\n\"]";
+            check(s);
+        }
+        // a lone surrogate ending a run fails
+        // identically in both parsers
+        check("\"\\u0041\\u0042\\udc00\"");
+        check("\"\\u0041\\ud83d\\u0041\"");
+        check("\"\\u0041\\u0042\\u00zz\"");
+        check("\"\\u0041\\ud83d");
+
+        // errors
+        check("");
+        check(" ");
+        check("nul");
+        check("nulx");
+        check("[1,2");
+        check("[1,2]]");
+        check("{\"a\"");
+        check("{\"a\":}");
+        check("{\"a\":1,}");
+        check("[1,]");
+        check("\"abc");
+        check("\"\\q\"");
+        check("\"\\u12\"");
+        check("\"\\ud83d\"");
+        check("\"\\ud83dx\"");
+        check("\"\\udc00\"");
+        check("01");
+        check("1.");
+        check("1e");
+        check("-");
+        check("123 456");
+        check("\"a\" \"b\"");
+        check("{1:2}");
+        check("[1 2]");
+        check("[1,2x]");
+        check("[1,2,03]");
+        check("[-1-2]");
+        check("\x01");
+
+        // depth limit
+        {
+            parse_options opt2 = opt;
+            opt2.max_depth = 2;
+            error_code ec;
+            parse("[[[1]]]", ec, {}, opt2);
+            BOOST_TEST(ec == error::too_deep);
+            ec = {};
+            parse("[[1]]", ec, {}, opt2);
+            BOOST_TEST(! ec);
+        }
+
+        // invalid utf-8 is rejected by default
+        // and passed through when allowed
+        {
+            error_code ec;
+            parse("\"\xff\"", ec, {}, opt);
+            BOOST_TEST(ec.failed());
+
+            parse_options opt2 = opt;
+            opt2.allow_invalid_utf8 = true;
+            ec = {};
+            value jv = parse("\"\xff\"", ec, {}, opt2);
+            BOOST_TEST(! ec);
+            BOOST_TEST(jv.as_string() == "\xff");
+        }
+    }
+
+    void
+    testSingleStorage()
+    {
+        string_view const js =
+            "{\"a\":[1,2,3],\"b\":\"a string "
+            "long enough to require a "
+            "dynamic allocation\"}";
+
+        // elements hold non-owning pointers;
+        // only the root owns the resource
+        {
+            parse_options opt;
+            opt.single_storage = true;
+            auto sp = make_shared_resource<
+                monotonic_resource>();
+            value jv = parse(js, sp, opt);
+            BOOST_TEST(
+                jv.storage().is_shared());
+            BOOST_TEST(! jv.at("a")
+                .storage().is_shared());
+            BOOST_TEST(jv == parse(js));
+
+            // the root keeps the resource
+            // alive after other copies of
+            // the pointer are gone
+            sp = {};
+            BOOST_TEST(jv == parse(js));
+        }
+
+        // the whole-buffer fast path is
+        // disabled by the option
+        {
+            parse_options opt;
+            opt.single_storage = true;
+            opt.full_buffer_fast_path = true;
+            auto sp = make_shared_resource<
+                monotonic_resource>();
+            value jv = parse(js, sp, opt);
+            BOOST_TEST(! jv.at("a")
+                .storage().is_shared());
+            BOOST_TEST(jv == parse(js));
+        }
+    }
+
+    void
+    testPairArrays()
+    {
+        parse_options opt;
+        opt.pair_key = "k";
+        opt.pair_value = "v";
+
+        // matching arrays are built as
+        // objects, anywhere in the document
+        {
+            value jv = parse(
+                "[{\"k\":\"a\",\"v\":1},"
+                "{\"k\":\"b\",\"v\":"
+                "[{\"k\":\"c\",\"v\":null}]}]",
+                {}, opt);
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":1,\"b\":{\"c\":null}}");
+        }
+
+        // non-matching arrays are unchanged
+        {
+            string_view const js =
+                "[{\"k\":\"a\",\"v\":1},"
+                "{\"k\":\"b\"}]";
+            BOOST_TEST(
+                parse(js, {}, opt) == parse(js));
+        }
+
+        // duplicates follow the policy
+        {
+            string_view const js =
+                "[{\"k\":\"a\",\"v\":1},"
+                "{\"k\":\"a\",\"v\":2}]";
+            value jv = parse(js, {}, opt);
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":2}");
+
+            parse_options opt2 = opt;
+            opt2.on_duplicate_key =
+                duplicate_keys::error;
+            error_code ec;
+            jv = parse(js, ec, {}, opt2);
+            BOOST_TEST(
+                ec == error::duplicate_key);
+        }
+
+        // the whole-buffer fast path is
+        // disabled by the option
+        {
+            parse_options opt2 = opt;
+            opt2.full_buffer_fast_path = true;
+            value jv = parse(
+                "[{\"k\":\"a\",\"v\":1}]",
+                {}, opt2);
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":1}");
+        }
+    }
+
     void
     testIstream()
     {
@@ -202,13 +558,83 @@ public:
         BOOST_TEST_THROWS_WITH_LOCATION( parse(ss) );
     }
 
+    void
+    testParseFile()
+    {
+        char const* const path =
+            "boost_json_parse_file_test.json";
+
+        // a document larger than the
+        // stack buffer
+        std::string s = "[";
+        for(int i = 0; i < 2000; ++i)
+        {
+            if(i != 0)
+                s += ',';
+            s += "{\"k" + std::to_string(i) +
+                "\":" + std::to_string(i) + "}";
+        }
+        s += ']';
+        {
+            std::FILE* const f =
+                std::fopen(path, "wb");
+            BOOST_TEST(f != nullptr);
+            std::fwrite(
+                s.data(), 1, s.size(), f);
+            std::fclose(f);
+        }
+
+        error_code ec;
+        value jv = parse_file(path, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(s));
+        BOOST_TEST(
+            parse_file(path) == parse(s));
+
+        // incomplete documents fail
+        {
+            std::FILE* const f =
+                std::fopen(path, "wb");
+            std::fwrite("[1,", 1, 3, f);
+            std::fclose(f);
+        }
+        jv = parse_file(path, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(jv.is_null());
+
+        // empty files fail
+        {
+            std::FILE* const f =
+                std::fopen(path, "wb");
+            std::fclose(f);
+        }
+        jv = parse_file(path, ec);
+        BOOST_TEST(ec);
+
+        std::remove(path);
+
+        // missing files fail
+        jv = parse_file(
+            "boost_json_no_such_file.json", ec);
+        BOOST_TEST(ec == error::input_error);
+        BOOST_TEST(jv.is_null());
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            parse_file(
+                "boost_json_no_such_file.json"));
+    }
+
     void
     run()
     {
         testParse();
         testMemoryUsage();
+        testDuplicateKeys();
         testIssue726();
+        testFullBufferFastPath();
+        testSingleStorage();
+        testPairArrays();
         testIstream();
+        testParseFile();
     }
 };
 
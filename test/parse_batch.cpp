@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/parse_batch.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class parse_batch_test
+{
+public:
+    void
+    testParse()
+    {
+        string_view const docs[] = {
+            "{\"a\":1}",
+            "[1,2,3]",
+            "\"x\"",
+            "null",
+            "3.14"
+        };
+        std::size_t const n =
+            sizeof(docs) / sizeof(docs[0]);
+
+        error_code ec;
+        auto vs = parse_batch(docs, n, ec);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == n))
+        {
+            // each document matches a
+            // standalone parse of it
+            for(std::size_t i = 0; i < n; ++i)
+                BOOST_TEST(vs[i] == parse(docs[i]));
+        }
+
+        // empty batch
+        ec = {};
+        vs = parse_batch(docs, 0, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(vs.empty());
+
+        // many small documents
+        std::vector<std::string> bufs;
+        std::vector<string_view> views;
+        for(int i = 0; i < 1000; ++i)
+            bufs.push_back(
+                "[" + std::to_string(i) + "]");
+        for(auto const& s : bufs)
+            views.push_back(s);
+        ec = {};
+        vs = parse_batch(
+            views.data(), views.size(), ec);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == views.size()))
+        {
+            BOOST_TEST(vs[0] == parse("[0]"));
+            BOOST_TEST(vs[999] == parse("[999]"));
+        }
+    }
+
+    void
+    testStorage()
+    {
+        // all documents share the caller's arena
+        string_view const docs[] = {
+            "{\"k\":[1,2,3]}",
+            "[\"long enough to allocate....\"]"
+        };
+        monotonic_resource mr;
+        error_code ec;
+        auto vs = parse_batch(
+            docs, 2, ec, storage_ptr(&mr));
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == 2))
+        {
+            BOOST_TEST(*vs[0].storage() == mr);
+            BOOST_TEST(*vs[1].storage() == mr);
+            BOOST_TEST(vs[0] == parse(docs[0]));
+            BOOST_TEST(vs[1] == parse(docs[1]));
+        }
+    }
+
+    void
+    testOptions()
+    {
+        string_view const docs[] = {
+            "[1,2,3,] // trailing",
+        };
+        error_code ec;
+        auto vs = parse_batch(docs, 1, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(vs.empty());
+
+        parse_options opt;
+        opt.allow_comments = true;
+        opt.allow_trailing_commas = true;
+        ec = {};
+        vs = parse_batch(docs, 1, ec, {}, opt);
+        BOOST_TEST(! ec);
+        if(BOOST_TEST(vs.size() == 1))
+            BOOST_TEST(serialize(vs[0]) == "[1,2,3]");
+    }
+
+    void
+    testErrors()
+    {
+        // a bad document reports the error
+        // and returns an empty batch
+        string_view const docs[] = {
+            "1", "[2", "3"
+        };
+        error_code ec;
+        auto vs = parse_batch(docs, 3, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(vs.empty());
+
+        // std::error_code overload
+        {
+            std::error_code sec;
+            vs = parse_batch(docs, 3, sec);
+            BOOST_TEST(sec);
+            BOOST_TEST(vs.empty());
+        }
+
+        // throwing overload
+        BOOST_TEST_THROWS(
+            parse_batch(docs, 3),
+            system_error);
+        vs = parse_batch(docs, 1);
+        if(BOOST_TEST(vs.size() == 1))
+            BOOST_TEST(vs[0] == value(1));
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testStorage();
+        testOptions();
+        testErrors();
+    }
+};
+
+TEST_SUITE(parse_batch_test, "boost.json.parse_batch");
+
+} // namespace json
+} // namespace boost
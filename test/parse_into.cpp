@@ -50,6 +50,42 @@ bool operator==( Y const& y1, Y const& y2 )
 
 BOOST_DEFINE_ENUM_CLASS(E, x, y, z)
 
+// mixed converted and raw captured members
+struct R
+{
+    boost::json::raw_number id;
+    double score;
+};
+
+BOOST_DESCRIBE_STRUCT(R, (), (id, score))
+
+// converted only through tag_invoke
+struct M
+{
+    std::string name;
+    double val;
+};
+
+bool operator==( M const& m1, M const& m2 )
+{
+    return m1.name == m2.name && m1.val == m2.val;
+}
+
+void tag_invoke(
+    boost::json::value_from_tag, boost::json::value& jv, M const& m )
+{
+    jv = { { "name", m.name }, { "val", m.val } };
+}
+
+M tag_invoke(
+    boost::json::value_to_tag<M>, boost::json::value const& jv )
+{
+    boost::json::object const& o = jv.as_object();
+    return M{
+        boost::json::value_to<std::string>( o.at("name") ),
+        o.at("val").to_number<double>() };
+}
+
 namespace boost {
 namespace json {
 
@@ -208,6 +244,88 @@ public:
         testParseIntoErrors< double >( error::not_double, { {"value", 12.1 } } );
     }
 
+    void testRawNumber()
+    {
+        // the original representation is
+        // preserved exactly
+        for( std::string js: {
+            "9007199254740993",
+            "-1.2500e2",
+            "18446744073709551616",
+            "0.1000000000000000055511151231257827" } )
+        {
+            raw_number n;
+            error_code ec;
+            parse_into( n, js, ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( n.text == js );
+        }
+
+        // a reused target is overwritten
+        {
+            raw_number n;
+            error_code ec;
+            parse_into( n, "111", ec );
+            parse_into( n, "22", ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( n.text == "22" );
+        }
+
+        // as elements and members
+        {
+            std::vector<raw_number> v;
+            error_code ec;
+            parse_into( v, "[1,2.5,18446744073709551616]", ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( v.size() == 3 );
+            BOOST_TEST( v[0].text == "1" );
+            BOOST_TEST( v[1].text == "2.5" );
+            BOOST_TEST( v[2].text == "18446744073709551616" );
+        }
+        {
+            R r;
+            error_code ec;
+            parse_into( r,
+                "{\"id\":10000000000000000001,\"score\":2.5}", ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( r.id.text == "10000000000000000001" );
+            BOOST_TEST( r.score == 2.5 );
+        }
+
+        // a number split across stream reads
+        // is reassembled
+        {
+            std::string const number = "123456789.5e15";
+            std::stringstream is(
+                std::string( BOOST_JSON_STACK_BUFFER_SIZE - 6, ' ' )
+                    + number );
+            raw_number n;
+            error_code ec;
+            parse_into( n, is, ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( n.text == number );
+        }
+
+        // conversion can be turned off entirely
+        {
+            parse_options opt;
+            opt.numbers = number_precision::none;
+            raw_number n;
+            error_code ec;
+            parse_into( n, "1e308", ec, opt );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST( n.text == "1e308" );
+        }
+
+        // only numbers are captured
+        {
+            raw_number n;
+            error_code ec;
+            parse_into( n, "\"123\"", ec );
+            BOOST_TEST( ec == error::not_number );
+        }
+    }
+
     void testString()
     {
         testParseInto<std::string>( "" );
@@ -268,6 +386,42 @@ public:
         BOOST_TEST( v.size() == 3 );
     }
 
+    void testCapacityReuse()
+    {
+        // the array prescan sees through nesting,
+        // strings, and escapes
+        BOOST_TEST( detail::prescan_array_size( "[1,2,3]" ) == 3 );
+        BOOST_TEST( detail::prescan_array_size( " [ 1 , 2 ] " ) == 2 );
+        BOOST_TEST( detail::prescan_array_size( "[]" ) == 0 );
+        BOOST_TEST( detail::prescan_array_size( "[ ]" ) == 0 );
+        BOOST_TEST( detail::prescan_array_size( "{\"a\":[1,2]}" ) == 0 );
+        BOOST_TEST( detail::prescan_array_size( "42" ) == 0 );
+        BOOST_TEST( detail::prescan_array_size( "[[1,2],[3,4]]" ) == 2 );
+        BOOST_TEST( detail::prescan_array_size( "[{\"a\":1},2]" ) == 2 );
+        BOOST_TEST( detail::prescan_array_size( "[\"a,b\",\"c]\"]" ) == 2 );
+        BOOST_TEST( detail::prescan_array_size( "[\"\\\",\",1]" ) == 2 );
+
+        // the whole array is reserved before the
+        // first element arrives
+        std::vector<int> v;
+        parse_into( v, "[1,2,3,4,5,6,7,8]" );
+        BOOST_TEST( v.capacity() >= 8 );
+
+        // reparsing a document of the same size
+        // does not reallocate
+        std::size_t const cap = v.capacity();
+        int const* const data = v.data();
+        parse_into( v, "[8,7,6,5,4,3,2,1]" );
+        BOOST_TEST( v.capacity() == cap );
+        BOOST_TEST( v.data() == data );
+        BOOST_TEST( v[0] == 8 );
+
+        // a smaller document keeps the capacity
+        parse_into( v, "[1]" );
+        BOOST_TEST( v.size() == 1 );
+        BOOST_TEST( v.capacity() == cap );
+    }
+
     void testMap()
     {
         testParseInto< std::map<std::string, int> >( {} );
@@ -336,6 +490,32 @@ public:
         testParseInto<Y>( {} );
         testParseInto<Y>( { { { 1, 1.0f, "one" }, { 2, 2.0f, "two" } }, { { "one", { 1, 1.1f, "1" } }, { "two", { 2, 2.2f, "2" } } } } );
 
+        // members out of declaration order
+        {
+            X x{};
+            error_code ec;
+            parse_into( x,
+                R"( {"c": "hello", "a": 1, "b": 3.25} )", ec );
+            BOOST_TEST( !ec.failed() );
+            BOOST_TEST(( x == X{ 1, 3.25f, "hello" } ));
+        }
+
+        // repeated objects with a consistent member order
+        {
+            std::vector<X> xs;
+            error_code ec;
+            parse_into( xs,
+                R"( [{"a": 1, "b": 1.0, "c": "one"},
+                     {"a": 2, "b": 2.0, "c": "two"},
+                     {"b": 3.0, "c": "three", "a": 3}] )", ec );
+            BOOST_TEST( !ec.failed() );
+            if( BOOST_TEST( xs.size() == 3 ) )
+            {
+                BOOST_TEST(( xs[1] == X{ 2, 2.0f, "two" } ));
+                BOOST_TEST(( xs[2] == X{ 3, 3.0f, "three" } ));
+            }
+        }
+
         testParseIntoErrors<X>( error::not_object, 1 );
         testParseIntoErrors<X>(
             error::unknown_name,
@@ -414,19 +594,52 @@ public:
 #endif
     }
 
+    void testUserConversion()
+    {
+        testParseInto< M >( { "cpu", 0.5 } );
+
+        testParseInto< std::vector<M> >(
+            { { "a", 1.0 }, { "b", 2.5 }, { "c", -1.0 } } );
+
+        testParseInto< std::map<std::string, M> >(
+            { { "k1", { "a", 1.0 } }, { "k2", { "b", 2.0 } } } );
+
+        testParseInto< std::vector< std::vector<M> > >(
+            { { { "a", 1.0 } }, {}, { { "b", 2.0 }, { "c", 3.0 } } } );
+
+        // a conversion failure surfaces
+        // as the parse error
+        {
+            std::vector<M> v;
+            error_code ec;
+            parse_into( v, R"([{"name":"a","val":1},null])", ec );
+            BOOST_TEST( ec );
+        }
+
+        {
+            std::vector<M> v;
+            BOOST_TEST_THROWS(
+                parse_into( v, R"([42])" ),
+                system_error );
+        }
+    }
+
     void run()
     {
         testNull();
         testBoolean();
         testIntegral();
         testFloatingPoint();
+        testRawNumber();
         testString();
         testSequence();
+        testCapacityReuse();
         testMap();
         testTuple();
         testStruct();
         testEnum();
         testOptional();
+        testUserConversion();
         testVariant<variant2::variant, variant2::monostate>();
 #ifndef BOOST_NO_CXX17_HDR_VARIANT
         testVariant<std::variant, std::monostate>();
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/parse_numbers.hpp>
+
+#include <boost/json/system_error.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class parse_numbers_test
+{
+public:
+    void
+    good(
+        string_view s,
+        std::initializer_list<double> expected)
+    {
+        error_code ec;
+        std::vector<double> v;
+        parse_numbers(s, v, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(v ==
+            std::vector<double>(expected));
+    }
+
+    void
+    bad(string_view s, error ev)
+    {
+        error_code ec;
+        std::vector<double> v;
+        parse_numbers(s, v, ec);
+        BOOST_TEST(ec == ev);
+    }
+
+    void
+    testVector()
+    {
+        good("[]", {});
+        good("[1]", {1});
+        good("[1,2,3]", {1, 2, 3});
+        good("[1.5,-2.25,1e3]",
+            {1.5, -2.25, 1e3});
+        good(" [ 1 , 2 ] ", {1, 2});
+        good("[18446744073709551615]",
+            {18446744073709551615.0});
+
+        // nested arrays are flattened
+        good("[[1,2],[3,4]]", {1, 2, 3, 4});
+        good("[[[1]],[],[2,[3]]]", {1, 2, 3});
+
+        bad("", error::incomplete);
+        bad("[1,2", error::incomplete);
+        bad("1", error::not_array);
+        bad("null", error::not_array);
+        bad("[1,2] x", error::extra_data);
+        bad("{\"a\":1}", error::not_number);
+        bad("[\"a\"]", error::not_number);
+        bad("[true]", error::not_number);
+        bad("[null]", error::not_number);
+        bad("[1,{}]", error::not_number);
+    }
+
+    void
+    testBuffer()
+    {
+        double buf[4];
+        error_code ec;
+
+        auto n = parse_numbers(
+            "[1,2,3]", buf, 4, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(n == 3);
+        BOOST_TEST(buf[0] == 1);
+        BOOST_TEST(buf[1] == 2);
+        BOOST_TEST(buf[2] == 3);
+
+        // too many elements for the buffer
+        n = parse_numbers(
+            "[1,2,3,4,5]", buf, 4, ec);
+        BOOST_TEST(
+            ec == error::size_mismatch);
+        BOOST_TEST(n == 4);
+        BOOST_TEST(buf[3] == 4);
+    }
+
+    void
+    testThrowing()
+    {
+        auto const v =
+            parse_numbers("[[1,2],[3]]");
+        BOOST_TEST(v ==
+            std::vector<double>({1, 2, 3}));
+        BOOST_TEST_THROWS(
+            parse_numbers("[true]"),
+            system_error);
+    }
+
+    void
+    run()
+    {
+        testVector();
+        testBuffer();
+        testThrowing();
+    }
+};
+
+TEST_SUITE(parse_numbers_test, "boost.json.parse_numbers");
+
+} // namespace json
+} // namespace boost
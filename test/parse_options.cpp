@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2020 Krystian Stasiowski (sdkrystian@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/parse_options.hpp>
+
+#include <boost/json/parse.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class parse_options_test
+{
+public:
+    void
+    testAdaptive()
+    {
+        // small, shallow, short numbers:
+        // everything stays at the defaults
+        parse_options opt = parse_options::adaptive(
+            "{\"a\":[1,2.5],\"b\":\"x\"}");
+        BOOST_TEST(opt.max_depth == 32);
+        BOOST_TEST(opt.numbers ==
+            number_precision::imprecise);
+        BOOST_TEST(! opt.full_buffer_fast_path);
+
+        // conformance options are never loosened
+        BOOST_TEST(! opt.allow_comments);
+        BOOST_TEST(! opt.allow_trailing_commas);
+        BOOST_TEST(! opt.allow_invalid_utf8);
+        BOOST_TEST(! opt.allow_infinity_and_nan);
+        BOOST_TEST(opt.on_duplicate_key ==
+            duplicate_keys::last);
+
+        // deep nesting raises the depth limit
+        std::string deep;
+        for(int i = 0; i < 40; ++i)
+            deep += '[';
+        for(int i = 0; i < 40; ++i)
+            deep += ']';
+        opt = parse_options::adaptive(deep);
+        BOOST_TEST(opt.max_depth == 80);
+        error_code ec;
+        parse(deep, ec, {}, opt);
+        BOOST_TEST(! ec);
+
+        // long mantissas select precise mode;
+        // exponents do not count
+        opt = parse_options::adaptive(
+            "[0.30000000000000004]");
+        BOOST_TEST(opt.numbers ==
+            number_precision::precise);
+        opt = parse_options::adaptive(
+            "[1e315,0.5,100000000000000000]");
+        BOOST_TEST(opt.numbers ==
+            number_precision::precise);
+        opt = parse_options::adaptive(
+            "[1.5e300,12345,2.25]");
+        BOOST_TEST(opt.numbers ==
+            number_precision::imprecise);
+
+        // leading zeros are not significant
+        opt = parse_options::adaptive(
+            "[0.00000000000000000025]");
+        BOOST_TEST(opt.numbers ==
+            number_precision::imprecise);
+
+        // digits inside strings are not numbers
+        opt = parse_options::adaptive(
+            "\"12345678901234567890\"");
+        BOOST_TEST(opt.numbers ==
+            number_precision::imprecise);
+
+        // large documents enable the indexed
+        // engine
+        std::string big = "[";
+        while(big.size() < 8192)
+            big += "\"filler\",";
+        big.back() = ']';
+        opt = parse_options::adaptive(big);
+        BOOST_TEST(opt.full_buffer_fast_path);
+
+        // ...but only when they dominate
+        // the sample
+        string_view samples[3] = {
+            "{\"a\":1}", "{\"b\":2}", "[3]" };
+        opt = parse_options::adaptive(samples, 3);
+        BOOST_TEST(! opt.full_buffer_fast_path);
+
+        // escaped quotes do not end strings
+        opt = parse_options::adaptive(
+            "\"\\\"1234567890123456789\"");
+        BOOST_TEST(opt.numbers ==
+            number_precision::imprecise);
+
+        // empty input yields the defaults
+        opt = parse_options::adaptive(
+            nullptr, 0);
+        BOOST_TEST(opt.max_depth == 32);
+        BOOST_TEST(! opt.full_buffer_fast_path);
+    }
+
+    void
+    run()
+    {
+        testAdaptive();
+    }
+};
+
+TEST_SUITE(parse_options_test, "boost.json.parse_options");
+
+} // namespace json
+} // namespace boost
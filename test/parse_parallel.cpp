@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/parse_parallel.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class parse_parallel_test
+{
+public:
+    static
+    std::string
+    make_array_doc(int n)
+    {
+        std::string s = "[";
+        for(int i = 0; i < n; ++i)
+        {
+            if(i > 0)
+                s += ',';
+            s += "{\"i\":" +
+                std::to_string(i) +
+                ",\"s\":\"x" +
+                std::to_string(i) + "\"}";
+        }
+        s += ']';
+        return s;
+    }
+
+    void
+    testParse()
+    {
+        // the result matches a sequential parse
+        auto const s = make_array_doc(500);
+        error_code ec;
+        value jv1 = parse(s, ec);
+        BOOST_TEST(! ec);
+        value jv2 = parse_parallel(
+            s, ec, {}, {}, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv1 == jv2);
+        BOOST_TEST(serialize(jv2) == s);
+
+        // object roots partition by member
+        std::string so = "{";
+        for(int i = 0; i < 300; ++i)
+        {
+            if(i > 0)
+                so += ',';
+            so += "\"k" + std::to_string(i) +
+                "\":[" + std::to_string(i) + "]";
+        }
+        so += '}';
+        jv1 = parse(so, ec);
+        BOOST_TEST(! ec);
+        jv2 = parse_parallel(so, ec, {}, {}, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv1 == jv2);
+
+        // keys holding escapes are unescaped
+        jv2 = parse_parallel(
+            "{\"a\\nb\":1,\"c\":2}",
+            ec, {}, {}, 2);
+        BOOST_TEST(! ec);
+        BOOST_TEST(
+            jv2.at("a\nb") == value(1));
+
+        // scalar roots and small documents
+        // use the sequential path
+        BOOST_TEST(parse_parallel(
+            "42", ec, {}, {}, 4) == value(42));
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_parallel(
+            "[]", ec, {}, {}, 4) == array());
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_parallel(
+            "{}", ec, {}, {}, 4) == object());
+        BOOST_TEST(! ec);
+        BOOST_TEST(parse_parallel(
+            " [1, 2] ", ec, {}, {}, 4) ==
+                parse("[1,2]"));
+        BOOST_TEST(! ec);
+    }
+
+    void
+    testStorage()
+    {
+        // the returned container uses the given
+        // resource; elements keep the arenas
+        // that built them
+        auto const s = make_array_doc(100);
+        monotonic_resource mr;
+        error_code ec;
+        value jv = parse_parallel(
+            s, ec, &mr, {}, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(*jv.storage() == mr);
+        BOOST_TEST(jv == parse(s));
+
+        // elements outlive siblings
+        value first =
+            std::move(jv.get_array()[0]);
+        jv = nullptr;
+        BOOST_TEST(
+            first.at("i") == value(0));
+    }
+
+    void
+    testExecutor()
+    {
+        auto const s = make_array_doc(500);
+        thread_pool pool(4);
+        error_code ec;
+        value jv = parse_parallel(
+            s, pool, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(s));
+    }
+
+    void
+    testDuplicates()
+    {
+        // the duplicate key policy applies to
+        // the partitioned root
+        std::string so = "{";
+        for(int i = 0; i < 100; ++i)
+            so += "\"k" + std::to_string(i % 50) +
+                "\":" + std::to_string(i) + ",";
+        so.back() = '}';
+
+        parse_options opt;
+        opt.on_duplicate_key =
+            duplicate_keys::last;
+        error_code ec;
+        value jv = parse_parallel(
+            so, ec, {}, opt, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(so, {}, opt));
+
+        opt.on_duplicate_key =
+            duplicate_keys::first;
+        jv = parse_parallel(so, ec, {}, opt, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(so, {}, opt));
+
+        opt.on_duplicate_key =
+            duplicate_keys::error;
+        jv = parse_parallel(so, ec, {}, opt, 4);
+        BOOST_TEST(
+            ec == error::duplicate_key);
+        BOOST_TEST(jv.is_null());
+    }
+
+    void
+    testErrors()
+    {
+        // an error in any subtree fails the
+        // parse, reporting the first error
+        // in document order
+        auto s = make_array_doc(500);
+        s[s.size() / 2] = '!';
+        error_code ec1;
+        parse(s, ec1);
+        BOOST_TEST(ec1);
+        error_code ec2;
+        value jv = parse_parallel(
+            s, ec2, {}, {}, 4);
+        BOOST_TEST(ec2);
+        BOOST_TEST(jv.is_null());
+
+        // malformed shapes fall back to the
+        // sequential parser for diagnostics
+        for(string_view js : {
+            "[1,2", "[1,,2]", "[1,2,]",
+            "{\"a\":1,}", "{\"a\" 1}",
+            "{\"a\":}", "[1] x", "\"abc"})
+        {
+            error_code sec;
+            parse(js, sec);
+            error_code pec;
+            parse_parallel(js, pec, {}, {}, 4);
+            BOOST_TEST(pec == sec);
+        }
+
+        BOOST_TEST_THROWS(
+            parse_parallel(
+                "[1,!]", {}, {}, 4),
+            system_error);
+
+        // non-default options fall back to the
+        // sequential parser
+        parse_options opt;
+        opt.allow_comments = true;
+        error_code ec;
+        value jv2 = parse_parallel(
+            "[1,/*c*/2]", ec, {}, opt, 4);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv2 == parse("[1,2]"));
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testStorage();
+        testExecutor();
+        testDuplicates();
+        testErrors();
+    }
+};
+
+TEST_SUITE(parse_parallel_test, "boost.json.parse_parallel");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+#include <boost/json/stream_parser.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+/*
+    This translation unit is compiled with
+    BOOST_JSON_PARSE_STATS defined and exercises
+    the instrumentation counters. Without the
+    macro the counters do not exist, so the
+    whole suite is compiled out.
+*/
+#ifdef BOOST_JSON_PARSE_STATS
+
+namespace boost {
+namespace json {
+
+class parse_stats_test
+{
+public:
+    void
+    testCounters()
+    {
+        std::string const doc =
+            "{\"key\":[1,2.5,3,\"hello world\"]}";
+
+        stream_parser p;
+        p.reset();
+        std::size_t n = p.write(doc);
+        BOOST_TEST(n == doc.size());
+        BOOST_TEST(p.done());
+
+        parse_stats st = p.stats();
+        BOOST_TEST(st.bytes == doc.size());
+        BOOST_TEST(st.numbers == 3);
+        // "key" + "hello world"
+        BOOST_TEST(st.string_bytes == 3 + 11);
+        // write coalesces input and flushes
+        // with more=true, so even a complete
+        // document suspends at most once
+        BOOST_TEST(st.suspends <= 1);
+        BOOST_TEST(st.stack_bytes > 0);
+    }
+
+    void
+    testSuspends()
+    {
+        std::string const doc =
+            "[\"split across\", 12345]";
+
+        stream_parser p;
+        p.reset();
+        // one byte at a time forces a
+        // suspension at every boundary
+        for(char const& c : doc)
+            p.write_some(&c, 1);
+        BOOST_TEST(p.done());
+
+        parse_stats st = p.stats();
+        BOOST_TEST(st.bytes == doc.size());
+        BOOST_TEST(st.numbers == 1);
+        BOOST_TEST(st.string_bytes == 12);
+        BOOST_TEST(st.suspends > 0);
+    }
+
+    void
+    testAccumulation()
+    {
+        std::string const doc = "[1,2,3]";
+
+        stream_parser p;
+        p.reset();
+        p.write(doc);
+        p.release();
+
+        // counters are cumulative and
+        // survive reset, so a scraper can
+        // sample them at any interval
+        p.reset();
+        p.write(doc);
+
+        parse_stats st = p.stats();
+        BOOST_TEST(st.bytes == 2 * doc.size());
+        BOOST_TEST(st.numbers == 6);
+    }
+
+    void
+    testTimings()
+    {
+        std::string const doc =
+            "[1,2,3,\"abcdef\",null]";
+
+        stream_parser p;
+        p.reset();
+
+        // nothing is recorded before the
+        // first call; idle time before it
+        // does not count as suspended
+        parse_timings t0 = p.timings();
+        BOOST_TEST(t0.writes == 0);
+        BOOST_TEST(t0.write_ticks == 0);
+        BOOST_TEST(t0.suspended_ticks == 0);
+
+        p.write(doc.data(), 5);
+        p.write(doc.data() + 5,
+            doc.size() - 5);
+        p.finish();
+        BOOST_TEST(p.done());
+
+        // the delegating overloads record
+        // once per public call
+        parse_timings t = p.timings();
+        BOOST_TEST(t.writes == 3);
+        BOOST_TEST(t.write_ticks > 0);
+        BOOST_TEST(t.suspended_ticks > 0);
+
+        // counters accumulate and survive
+        // reset, like the work counters
+        p.release();
+        p.reset();
+        p.write(doc);
+        parse_timings t2 = p.timings();
+        BOOST_TEST(t2.writes == t.writes + 1);
+        BOOST_TEST(
+            t2.write_ticks >= t.write_ticks);
+        BOOST_TEST(t2.suspended_ticks >=
+            t.suspended_ticks);
+    }
+
+    void
+    run()
+    {
+        testCounters();
+        testSuspends();
+        testAccumulation();
+        testTimings();
+    }
+};
+
+TEST_SUITE(parse_stats_test, "boost.json.parse_stats");
+
+} // namespace json
+} // namespace boost
+
+#endif // BOOST_JSON_PARSE_STATS
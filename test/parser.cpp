@@ -10,6 +10,7 @@
 // Test that header file is self-contained.
 #include <boost/json/parser.hpp>
 
+#include "test.hpp"
 #include "test_suite.hpp"
 
 namespace boost {
@@ -366,12 +367,54 @@ public:
         }
     }
 
+    void
+    testShrinkToFit()
+    {
+        // deep and wide enough to exceed
+        // the parser's stack buffers while
+        // staying within the default depth
+        std::string big(30, '[');
+        big += '1';
+        for(int i = 0; i < 100; ++i)
+            big += ",2";
+        big.append(30, ']');
+
+        fail_resource mr;
+        {
+            parser p((storage_ptr(&mr)));
+            p.reset();
+            p.write(big);
+            value const jv1 = p.release();
+
+            // temporary storage is retained at
+            // its high-water mark, so a second
+            // identical document allocates nothing
+            std::size_t const high = mr.bytes;
+            BOOST_TEST(high > 0);
+            p.reset();
+            p.write(big);
+            value const jv2 = p.release();
+            BOOST_TEST(mr.bytes == high);
+            BOOST_TEST(jv1 == jv2);
+
+            // shrink_to_fit returns everything
+            p.shrink_to_fit();
+            BOOST_TEST(mr.bytes == 0);
+
+            // the parser remains usable
+            p.reset();
+            p.write(big);
+            BOOST_TEST(p.release() == jv1);
+        }
+    }
+
     void
     run()
     {
         testCtors();
         testMembers<error_code>();
         testMembers<std::error_code>();
+        testShrinkToFit();
     }
 };
 
@@ -0,0 +1,304 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/patch.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class patch_test
+{
+public:
+    // apply `ops` to `before` and
+    // expect `after`
+    void
+    good(
+        string_view before,
+        string_view ops,
+        string_view after)
+    {
+        patch p(parse(ops));
+        value jv = parse(before);
+        error_code ec;
+        BOOST_TEST(p.apply(jv, ec) == p.size());
+        BOOST_TEST(! ec.failed());
+        BOOST_TEST(jv == parse(after));
+    }
+
+    // applying `ops` to `before` fails with `e`
+    void
+    bad(
+        string_view before,
+        string_view ops,
+        error e)
+    {
+        patch p(parse(ops));
+        value jv = parse(before);
+        error_code ec;
+        p.apply(jv, ec);
+        BOOST_TEST(ec == e);
+        BOOST_TEST_THROWS(
+            p.apply(jv), system_error);
+    }
+
+    void
+    testCompile()
+    {
+        // compile errors
+        auto const expect =
+            [](string_view doc, error e)
+            {
+                patch p;
+                error_code ec;
+                p.compile(parse(doc), ec);
+                BOOST_TEST(ec == e);
+                BOOST_TEST(p.empty());
+            };
+        expect(R"({})", error::invalid_patch);
+        expect(R"([[]])", error::invalid_patch);
+        expect(R"([{}])", error::invalid_patch);
+        expect(R"([{"op":"frob","path":""}])",
+            error::invalid_patch);
+        expect(R"([{"op":"add","path":"/a"}])",
+            error::invalid_patch);
+        expect(R"([{"op":"add","value":1}])",
+            error::invalid_patch);
+        expect(R"([{"op":"add","path":"a","value":1}])",
+            error::missing_slash);
+        expect(R"([{"op":"add","path":"/a~2","value":1}])",
+            error::invalid_escape);
+        expect(R"([{"op":"move","path":"/a"}])",
+            error::invalid_patch);
+        expect(R"([{"op":"remove","path":""}])",
+            error::invalid_patch);
+
+        // moving into a child is not allowed
+        expect(R"([{"op":"move","from":"/a","path":"/a/b"}])",
+            error::invalid_patch);
+
+        // the root cannot be moved
+        expect(R"([{"op":"move","from":"","path":"/b"}])",
+            error::invalid_patch);
+
+        // throwing overloads
+        BOOST_TEST_THROWS(
+            patch(parse("{}")), system_error);
+        {
+            patch p;
+            std::error_code ec;
+            p.compile(parse("{}"), ec);
+            BOOST_TEST(ec ==
+                error::invalid_patch);
+        }
+
+        // a compiled patch can be reused
+        {
+            patch p(parse(
+                R"([{"op":"add","path":"/n","value":1}])"));
+            BOOST_TEST(p.size() == 1);
+            value jv1 = parse("{}");
+            value jv2 = parse(R"({"x":2})");
+            p.apply(jv1);
+            p.apply(jv2);
+            BOOST_TEST(jv1 == parse(R"({"n":1})"));
+            BOOST_TEST(jv2 == parse(R"({"x":2,"n":1})"));
+        }
+    }
+
+    void
+    testApply()
+    {
+        // RFC 6902 appendix A
+        good(
+            R"({"foo":"bar"})",
+            R"([{"op":"add","path":"/baz","value":"qux"}])",
+            R"({"baz":"qux","foo":"bar"})");
+        good(
+            R"({"foo":["bar","baz"]})",
+            R"([{"op":"add","path":"/foo/1","value":"qux"}])",
+            R"({"foo":["bar","qux","baz"]})");
+        good(
+            R"({"baz":"qux","foo":"bar"})",
+            R"([{"op":"remove","path":"/baz"}])",
+            R"({"foo":"bar"})");
+        good(
+            R"({"foo":["bar","qux","baz"]})",
+            R"([{"op":"remove","path":"/foo/1"}])",
+            R"({"foo":["bar","baz"]})");
+        good(
+            R"({"baz":"qux","foo":"bar"})",
+            R"([{"op":"replace","path":"/baz","value":"boo"}])",
+            R"({"baz":"boo","foo":"bar"})");
+        good(
+            R"({"foo":{"bar":"baz","waldo":"fred"},"qux":{"corge":"grault"}})",
+            R"([{"op":"move","from":"/foo/waldo","path":"/qux/thud"}])",
+            R"({"foo":{"bar":"baz"},"qux":{"corge":"grault","thud":"fred"}})");
+        good(
+            R"({"foo":["all","grass","cows","eat"]})",
+            R"([{"op":"move","from":"/foo/1","path":"/foo/3"}])",
+            R"({"foo":["all","cows","eat","grass"]})");
+        good(
+            R"({"baz":"qux","foo":["a",2,"c"]})",
+            R"([{"op":"test","path":"/baz","value":"qux"},)"
+            R"({"op":"test","path":"/foo/1","value":2}])",
+            R"({"baz":"qux","foo":["a",2,"c"]})");
+        good(
+            R"({"foo":"bar"})",
+            R"([{"op":"add","path":"/child","value":{"grandchild":{}}}])",
+            R"({"foo":"bar","child":{"grandchild":{}}})");
+        good(
+            R"({"foo":["bar"]})",
+            R"([{"op":"add","path":"/foo/-","value":["abc","def"]}])",
+            R"({"foo":["bar",["abc","def"]]})");
+        good(
+            R"({"foo":"bar"})",
+            R"([{"op":"copy","from":"/foo","path":"/qux"}])",
+            R"({"foo":"bar","qux":"bar"})");
+
+        // escaped tokens
+        good(
+            R"({"a/b":1,"c~d":2})",
+            R"([{"op":"replace","path":"/a~1b","value":3},)"
+            R"({"op":"replace","path":"/c~0d","value":4}])",
+            R"({"a/b":3,"c~d":4})");
+
+        // whole-document operations
+        good(
+            R"({"a":1})",
+            R"([{"op":"replace","path":"","value":[1]}])",
+            R"([1])");
+        good(
+            R"({"a":1})",
+            R"([{"op":"test","path":"","value":{"a":1}}])",
+            R"({"a":1})");
+
+        // sequential application; later
+        // operations see earlier effects
+        good(
+            R"({})",
+            R"([{"op":"add","path":"/a","value":{}},)"
+            R"({"op":"add","path":"/a/b","value":[]},)"
+            R"({"op":"add","path":"/a/b/-","value":1}])",
+            R"({"a":{"b":[1]}})");
+    }
+
+    void
+    testApplyErrors()
+    {
+        bad(
+            R"({"a":1})",
+            R"([{"op":"remove","path":"/b"}])",
+            error::not_found);
+        bad(
+            R"({"a":[1]})",
+            R"([{"op":"remove","path":"/a/1"}])",
+            error::not_found);
+        bad(
+            R"({"a":[1]})",
+            R"([{"op":"add","path":"/a/9","value":2}])",
+            error::not_found);
+        bad(
+            R"({"a":[1]})",
+            R"([{"op":"add","path":"/a/x","value":2}])",
+            error::token_not_number);
+        bad(
+            R"({"a":1})",
+            R"([{"op":"add","path":"/a/b","value":2}])",
+            error::value_is_scalar);
+        bad(
+            R"({"a":1})",
+            R"([{"op":"test","path":"/a","value":2}])",
+            error::test_failure);
+        // count of applied operations
+        {
+            patch p(parse(
+                R"([{"op":"add","path":"/x","value":1},)"
+                R"({"op":"remove","path":"/nope"},)"
+                R"({"op":"add","path":"/y","value":2}])"));
+            value jv = parse("{}");
+            error_code ec;
+            BOOST_TEST(p.apply(jv, ec) == 1);
+            BOOST_TEST(ec == error::not_found);
+            BOOST_TEST(jv == parse(R"({"x":1})"));
+        }
+    }
+
+    void
+    testStorage()
+    {
+        // inserted values use the
+        // target's memory resource
+        monotonic_resource mr;
+        value jv(&mr);
+        jv = parse(R"({"a":[1,2]})", &mr);
+        patch p(parse(
+            R"([{"op":"add","path":"/b","value":[3,4]},)"
+            R"({"op":"copy","from":"/a","path":"/c"},)"
+            R"({"op":"move","from":"/a/0","path":"/b/-"}])"));
+        p.apply(jv);
+        BOOST_TEST(jv == parse(
+            R"({"a":[2],"b":[3,4,1],"c":[1,2]})"));
+        BOOST_TEST(*jv.at("b").storage() == mr);
+        BOOST_TEST(*jv.at("c").storage() == mr);
+    }
+
+    void
+    testMergePatch()
+    {
+        // RFC 7386 appendix, expressed
+        // as before/patch/after
+        auto const merge =
+            [](string_view before,
+                string_view mp,
+                string_view after)
+            {
+                value jv = parse(before);
+                apply_merge_patch(jv, parse(mp));
+                BOOST_TEST(jv == parse(after));
+            };
+        merge(R"({"a":"b"})", R"({"a":"c"})", R"({"a":"c"})");
+        merge(R"({"a":"b"})", R"({"b":"c"})", R"({"a":"b","b":"c"})");
+        merge(R"({"a":"b"})", R"({"a":null})", R"({})");
+        merge(R"({"a":"b","b":"c"})", R"({"a":null})", R"({"b":"c"})");
+        merge(R"({"a":["b"]})", R"({"a":"c"})", R"({"a":"c"})");
+        merge(R"({"a":"c"})", R"({"a":["b"]})", R"({"a":["b"]})");
+        merge(R"({"a":{"b":"c"}})", R"({"a":{"b":"d","c":null}})",
+            R"({"a":{"b":"d"}})");
+        merge(R"({"a":[{"b":"c"}]})", R"({"a":[1]})", R"({"a":[1]})");
+        merge(R"(["a","b"])", R"(["c","d"])", R"(["c","d"])");
+        merge(R"({"a":"b"})", R"(["c"])", R"(["c"])");
+        merge(R"({"a":"foo"})", R"(null)", R"(null)");
+        merge(R"({"a":"foo"})", R"("bar")", R"("bar")");
+        merge(R"({"e":null})", R"({"a":1})", R"({"e":null,"a":1})");
+        merge(R"([1,2])", R"({"a":"b","c":null})", R"({"a":"b"})");
+        merge(R"({})", R"({"a":{"bb":{"ccc":null}}})",
+            R"({"a":{"bb":{}}})");
+    }
+
+    void
+    run()
+    {
+        testCompile();
+        testApply();
+        testApplyErrors();
+        testStorage();
+        testMergePatch();
+    }
+};
+
+TEST_SUITE(patch_test, "boost.json.patch");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/path_query.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test.hpp"
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class path_query_test
+{
+public:
+    void
+    check(
+        string_view query,
+        string_view js,
+        string_view matches)
+    {
+        path_query const q( query );
+        BOOST_TEST( q.str() == query );
+        array const a = q.select( js );
+        BOOST_TEST( a == parse( matches ) );
+    }
+
+    void
+    testSelect()
+    {
+        string_view const js =
+            "{\"items\":["
+            "{\"name\":\"a\",\"price\":1},"
+            "{\"name\":\"b\",\"price\":2.5},"
+            "{\"name\":\"c\"}],"
+            "\"total\":3}";
+
+        // root
+        check( "$", "42", "[42]" );
+        check( "$", js, "[" + std::string(js) + "]" );
+
+        // member access, both spellings
+        check( "$.total", js, "[3]" );
+        check( "$['total']", js, "[3]" );
+        check( "$.missing", js, "[]" );
+
+        // index access
+        check( "$.items[0].name", js, "[\"a\"]" );
+        check( "$.items[2]", js,
+            "[{\"name\":\"c\"}]" );
+        check( "$.items[9]", js, "[]" );
+
+        // wildcards collect in document order
+        check( "$.items[*].price", js, "[1,2.5]" );
+        check( "$.items[*].name", js,
+            "[\"a\",\"b\",\"c\"]" );
+        check( "$.*", "{\"a\":1,\"b\":[2]}",
+            "[1,[2]]" );
+        check( "$[*]", "[1,\"x\",null,true]",
+            "[1,\"x\",null,true]" );
+
+        // matches can be whole subtrees
+        check( "$.items[1]", js,
+            "[{\"name\":\"b\",\"price\":2.5}]" );
+
+        // scalars along the path do not match
+        check( "$.total.x", js, "[]" );
+
+        // escaped member names
+        check( "$['a.b']",
+            "{\"a.b\":7}", "[7]" );
+    }
+
+    void
+    testStorage()
+    {
+        // results use the given resource,
+        // and allocations balance
+        fail_resource mr;
+        {
+            path_query const q(
+                "$.items[*].price" );
+            array const a = q.select(
+                "{\"items\":[{\"price\":1},"
+                "{\"price\":2}]}", &mr );
+            BOOST_TEST(
+                a == parse( "[1,2]" ) );
+            BOOST_TEST( *a.storage() == mr );
+        }
+        BOOST_TEST( mr.bytes == 0 );
+    }
+
+    void
+    testErrors()
+    {
+        // malformed queries
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "items" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$." ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$[" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$[*" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$['a" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$[x]" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            path_query( "$..a" ) );
+
+        // invalid JSON is reported
+        path_query const q( "$.a" );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            q.select( "{\"a\":" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            q.select( "{} trailing" ) );
+    }
+
+    void
+    run()
+    {
+        testSelect();
+        testStorage();
+        testErrors();
+    }
+};
+
+TEST_SUITE(path_query_test, "boost.json.path_query");
+
+} // namespace json
+} // namespace boost
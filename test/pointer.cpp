@@ -9,6 +9,8 @@
 
 #include <boost/json/value.hpp>
 
+#include <boost/json/pointer.hpp>
+
 #include "test_suite.hpp"
 
 namespace boost {
@@ -346,6 +348,73 @@ public:
         BOOST_TEST( hasLocation(ec) );
     }
 
+    void
+    testCompiled()
+    {
+        value const jv = testValue();
+
+        // a compiled pointer resolves to the
+        // same elements as the string form
+        for( string_view sv : {
+            "", "/foo", "/foo/0", "/a~1b",
+            "/m~0n", "/x/y", "/" } )
+        {
+            pointer const p( sv );
+            BOOST_TEST( p.str() == sv );
+            BOOST_TEST(
+                &jv.at_pointer( p ) ==
+                &jv.at_pointer( sv ) );
+        }
+
+        // observers
+        {
+            pointer const p0;
+            BOOST_TEST( p0.empty() );
+            BOOST_TEST( p0.size() == 0 );
+            BOOST_TEST( &jv.at_pointer( p0 ) == &jv );
+
+            pointer const p( "/foo/0" );
+            BOOST_TEST( ! p.empty() );
+            BOOST_TEST( p.size() == 2 );
+        }
+
+        // invalid strings fail at compilation
+        BOOST_TEST_THROWS_WITH_LOCATION( pointer( "foo" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION( pointer( "/m~" ) );
+        BOOST_TEST_THROWS_WITH_LOCATION( pointer( "/m~2" ) );
+
+        // resolution errors
+        {
+            error_code ec;
+            BOOST_TEST( ! jv.find_pointer(
+                pointer( "/fo" ), ec ) );
+            BOOST_TEST( ec == error::not_found );
+            BOOST_TEST( ! jv.find_pointer(
+                pointer( "/foo/bar" ), ec ) );
+            BOOST_TEST( ec == error::token_not_number );
+            BOOST_TEST( ! jv.find_pointer(
+                pointer( "/foo/-" ), ec ) );
+            BOOST_TEST( ec == error::past_the_end );
+            BOOST_TEST( ! jv.find_pointer(
+                pointer( "/foo/5" ), ec ) );
+            BOOST_TEST( ec == error::not_found );
+            BOOST_TEST( ! jv.find_pointer(
+                pointer( "/x/y/z" ), ec ) );
+            BOOST_TEST( ec == error::value_is_scalar );
+        }
+
+        // non-const overload
+        {
+            value jv2 = testValue();
+            error_code ec;
+            pointer const p( "/foo/1" );
+            value* v = jv2.find_pointer( p, ec );
+            BOOST_TEST( v );
+            *v = 42;
+            BOOST_TEST( jv2.at_pointer( "/foo/1" ) == 42 );
+        }
+    }
+
     void
     run()
     {
@@ -359,6 +428,7 @@ public:
         testSet();
         testSetNonThrowing<error_code>();
         testSetNonThrowing<std::error_code>();
+        testCompiled();
     }
 };
 
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/pooled_resource.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+BOOST_STATIC_ASSERT( std::is_nothrow_destructible<pooled_resource>::value );
+BOOST_STATIC_ASSERT( is_deallocate_trivial<pooled_resource>::value );
+
+class pooled_resource_test
+{
+public:
+    void
+    testMembers()
+    {
+        // ~pooled_resource
+        {
+            // implied
+        }
+
+        // pooled_resource(size_t)
+        {
+            {
+                pooled_resource mr;
+            }
+            {
+                pooled_resource mr(1);
+            }
+            {
+                pooled_resource mr(5000);
+            }
+        }
+
+        // allocate
+        {
+            pooled_resource mr;
+            auto p = mr.allocate(100);
+            BOOST_TEST(p != nullptr);
+            // deallocate is trivial
+            mr.deallocate(p, 100);
+            p = mr.allocate(100, 32);
+            BOOST_TEST((reinterpret_cast<
+                std::uintptr_t>(p) % 32) == 0);
+            // larger than a whole block
+            p = mr.allocate(100000);
+            BOOST_TEST(p != nullptr);
+        }
+
+        // release
+        {
+            pooled_resource mr;
+            mr.allocate(100);
+            mr.release();
+            // remains usable
+            BOOST_TEST(
+                mr.allocate(100) != nullptr);
+        }
+
+        // do_is_equal
+        {
+            pooled_resource mr1;
+            pooled_resource mr2;
+            BOOST_TEST(mr1 == mr1);
+            BOOST_TEST(mr1 != mr2);
+        }
+    }
+
+    void
+    testRecycling()
+    {
+        pooled_resource::clear_thread_cache();
+        BOOST_TEST(
+            pooled_resource::thread_cache_bytes() == 0);
+
+        std::string const doc = serialize(value(
+            array(1000, value("recycling", {}))));
+        value jv1(storage_ptr{});
+
+        // the first resource obtains its
+        // blocks from the heap and hands
+        // them to the cache on destruction
+        {
+            pooled_resource mr;
+            jv1 = value(parse(doc, &mr), storage_ptr{});
+        }
+        auto const cached =
+            pooled_resource::thread_cache_bytes();
+        BOOST_TEST(cached > 0);
+
+        // a second identical parse reuses the
+        // cached blocks and returns the same
+        // bytes when it completes
+        {
+            pooled_resource mr;
+            value const jv2 = parse(doc, &mr);
+            BOOST_TEST(
+                pooled_resource::thread_cache_bytes()
+                    < cached);
+            BOOST_TEST(jv2 == jv1);
+        }
+        BOOST_TEST(
+            pooled_resource::thread_cache_bytes()
+                == cached);
+
+        // release() recycles without
+        // destroying the resource
+        {
+            pooled_resource mr;
+            parse(doc, &mr);
+            mr.release();
+            BOOST_TEST(
+                pooled_resource::thread_cache_bytes()
+                    == cached);
+        }
+        BOOST_TEST(
+            pooled_resource::thread_cache_bytes()
+                == cached);
+
+        pooled_resource::clear_thread_cache();
+        BOOST_TEST(
+            pooled_resource::thread_cache_bytes() == 0);
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testRecycling();
+    }
+};
+
+TEST_SUITE(pooled_resource_test, "boost.json.pooled_resource");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/raw_number.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/serializer.hpp>
+#include <boost/json/stream_parser.hpp>
+#include <boost/json/value.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class raw_number_test
+{
+public:
+    void
+    testParse()
+    {
+        parse_options opt;
+        opt.raw_numbers = true;
+
+        // the exact numeral text round-trips
+        for(string_view js : {
+            "0.1000",
+            "1E+2",
+            "-0.0",
+            "[0.50,1e3,-7]",
+            "{\"p\":2.5000,\"q\":[1.10,2.20]}",
+            "0.30000000000000004",
+            "123456789012345678901234567890"})
+        {
+            value jv = parse(js, {}, opt);
+            BOOST_TEST(serialize(jv) == js);
+        }
+
+        value jv = parse("0.1000", {}, opt);
+        BOOST_TEST(jv.is_raw_number());
+        BOOST_TEST(jv.is_string());
+        BOOST_TEST(
+            jv.get_raw_number() == "0.1000");
+
+        // without conversion, both imprecise
+        // and none modes capture the text
+        opt.numbers = number_precision::none;
+        jv = parse("[1.25,3]", {}, opt);
+        BOOST_TEST(
+            serialize(jv) == "[1.25,3]");
+
+        // the default behavior is unchanged
+        jv = parse("0.1000");
+        BOOST_TEST(jv.is_double());
+        BOOST_TEST(! jv.is_raw_number());
+    }
+
+    void
+    testStreaming()
+    {
+        // numbers split across writes are
+        // reassembled without losing text
+        parse_options opt;
+        opt.raw_numbers = true;
+        string_view js =
+            "{\"a\":123.4500,\"b\":[9007199254740993,-0.125E-2]}";
+        stream_parser p({}, opt);
+        for(std::size_t i = 0;
+                i < js.size(); ++i)
+        {
+            error_code ec;
+            p.write(js.data() + i, 1, ec);
+            BOOST_TEST(! ec);
+        }
+        p.finish();
+        BOOST_TEST(
+            serialize(p.release()) == js);
+    }
+
+    void
+    testConstruct()
+    {
+        // pre-formatted numerals pass through
+        value jv(raw_number("0.1000"));
+        BOOST_TEST(jv.is_raw_number());
+        BOOST_TEST(
+            serialize(jv) == "0.1000");
+
+        object obj;
+        obj["price"] =
+            value(raw_number("2.5000"));
+        obj["qty"] = 3;
+        BOOST_TEST(serialize(obj) ==
+            "{\"price\":2.5000,\"qty\":3}");
+
+        // the serializer resumes mid-numeral
+        // when the output buffer is small
+        value arr = parse(
+            "[0.30000000000000004,1.000]",
+            {}, make_parse_options());
+        serializer sr;
+        sr.reset(&arr);
+        std::string s;
+        while(! sr.done())
+        {
+            char buf[3];
+            s.append(sr.read(
+                buf, sizeof(buf)));
+        }
+        BOOST_TEST(s ==
+            "[0.30000000000000004,1.000]");
+    }
+
+    void
+    testCopy()
+    {
+        // the mark survives copies into
+        // other storage
+        parse_options opt;
+        opt.raw_numbers = true;
+        value jv = parse(
+            "{\"a\":[0.1000]}", {}, opt);
+        value jv2(jv, storage_ptr());
+        BOOST_TEST(serialize(jv2) ==
+            "{\"a\":[0.1000]}");
+        value jv3 = jv.clone_compact();
+        BOOST_TEST(serialize(jv3) ==
+            "{\"a\":[0.1000]}");
+
+        // mutation removes the mark; the
+        // characters are no longer known to
+        // be a valid numeral
+        value jv4(raw_number("1.50"));
+        jv4.get_string().push_back('0');
+        BOOST_TEST(! jv4.is_raw_number());
+        BOOST_TEST(
+            serialize(jv4) == "\"1.500\"");
+    }
+
+    static
+    parse_options
+    make_parse_options() noexcept
+    {
+        parse_options opt;
+        opt.raw_numbers = true;
+        return opt;
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testStreaming();
+        testConstruct();
+        testCopy();
+    }
+};
+
+TEST_SUITE(raw_number_test, "boost.json.raw_number");
+
+} // namespace json
+} // namespace boost
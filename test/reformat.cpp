@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/reformat.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/serializer.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class reformat_test
+{
+public:
+    // a sink backed by a std::string
+    struct string_sink
+    {
+        std::string s;
+
+        serializer::mutable_buffer
+        prepare(std::size_t n)
+        {
+            size_ = s.size();
+            s.resize(size_ + n);
+            return { &s[0] + size_, n };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            s.resize(size_ + n);
+        }
+
+    private:
+        std::size_t size_ = 0;
+    };
+
+    void
+    testMinify()
+    {
+        // whitespace is stripped, structure
+        // and member order are preserved
+        BOOST_TEST(reformat(
+            "{ \"a\" : [ 1 , 2 ] ,\n  \"b\" : { } }")
+            == R"({"a":[1,2],"b":{}})");
+
+        BOOST_TEST(reformat(" [ ] ") == "[]");
+        BOOST_TEST(reformat("\"quote\"") == "\"quote\"");
+        BOOST_TEST(reformat(" null ") == "null");
+    }
+
+    void
+    testNumbersPreserved()
+    {
+        // number text is copied verbatim:
+        // trailing zeroes, exponent spelling,
+        // and excess precision all survive
+        for(string_view sv : {
+            "2.50",
+            "1e3",
+            "1E+2",
+            "-0.0",
+            "0.30000000000000004",
+            "10.000000000000001",
+            "18446744073709551615",
+            "-9223372036854775808",
+            "[2.50,1e3,0.1000]" })
+        {
+            BOOST_TEST(reformat(sv) == sv);
+        }
+
+        // by contrast, building a value and
+        // serializing it reformats the text
+        BOOST_TEST(serialize(parse("2.50")) != "2.50");
+    }
+
+    void
+    testPretty()
+    {
+        serialize_options opts;
+        opts.pretty = true;
+
+        // pretty output matches the serializer
+        // when the numbers are canonical
+        string_view const sv =
+            R"({"a":[true,null],"b":"x"})";
+        BOOST_TEST(reformat(sv, opts)
+            == serialize(parse(sv), opts));
+
+        // and numbers stay verbatim even
+        // when pretty-printing
+        BOOST_TEST(reformat("[1.50]", opts)
+            == "[\n    1.50\n]");
+    }
+
+    void
+    testSink()
+    {
+        // output goes directly into the sink
+        string_sink sink;
+        reformat(string_view(
+            " { \"n\" : 2.50 } "), sink);
+        BOOST_TEST(sink.s == R"({"n":2.50})");
+
+        // error_code overloads
+        string_sink sink2;
+        error_code ec;
+        reformat(string_view("[ 1, ]"), sink2, ec);
+        BOOST_TEST(ec);
+
+        string_sink sink3;
+        std::error_code sec;
+        reformat(string_view("[1]"), sink3, sec);
+        BOOST_TEST(! sec);
+        BOOST_TEST(sink3.s == "[1]");
+    }
+
+    void
+    testStream()
+    {
+        // documents larger than the internal
+        // read buffer are rewritten one chunk
+        // at a time; tokens which straddle the
+        // chunk boundaries are reassembled
+        std::string big = "{\"pad\":\"";
+        big.append(3000, 'x');
+        big += "\",\"k\":[1.2500,\"";
+        big.append(3000, 'y');
+        big += "\"],\"t\":true}";
+
+        std::string expected = big;
+        {
+            std::istringstream is(big);
+            string_sink sink;
+            reformat(is, sink);
+            BOOST_TEST(sink.s == expected);
+        }
+
+        // whitespace is still stripped
+        {
+            std::istringstream is(
+                " [ 1 , 2.50 ,\n \"x\" ] ");
+            string_sink sink;
+            error_code ec;
+            reformat(is, sink, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(sink.s == R"([1,2.50,"x"])");
+        }
+
+        // std::error_code overload
+        {
+            std::istringstream is("[true]");
+            string_sink sink;
+            std::error_code sec;
+            reformat(is, sink, sec);
+            BOOST_TEST(! sec);
+            BOOST_TEST(sink.s == "[true]");
+        }
+    }
+
+    void
+    testOptions()
+    {
+        // comments allowed by the parse
+        // options are dropped from the output
+        parse_options popt;
+        popt.allow_comments = true;
+        BOOST_TEST(reformat(
+            "[1, /* gone */ 2]",
+            serialize_options{}, popt)
+            == "[1,2]");
+    }
+
+    void
+    testErrors()
+    {
+        error_code ec;
+        BOOST_TEST(reformat("{", ec).empty());
+        BOOST_TEST(ec == error::incomplete);
+
+        ec = {};
+        BOOST_TEST(reformat("[1] x", ec).empty());
+        BOOST_TEST(ec == error::extra_data);
+
+        std::error_code sec;
+        BOOST_TEST(reformat("nul", sec).empty());
+        BOOST_TEST(sec);
+
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            reformat("[1,]"));
+
+        // a failed stream sets input_error
+        {
+            std::istringstream is("[1");
+            is.setstate(std::ios::badbit);
+            string_sink sink;
+            error_code jec;
+            reformat(is, sink, jec);
+            BOOST_TEST(jec == error::input_error);
+        }
+    }
+
+    void
+    run()
+    {
+        testMinify();
+        testNumbersPreserved();
+        testPretty();
+        testSink();
+        testStream();
+        testOptions();
+        testErrors();
+    }
+};
+
+TEST_SUITE(reformat_test, "boost.json.reformat");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/reparse.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class reparse_test
+{
+public:
+    void
+    check(
+        string_view s0,
+        string_view s1)
+    {
+        // the patched tree matches a
+        // fresh parse of the new text
+        value jv = parse(s0);
+        error_code ec;
+        reparse(jv, s0, s1, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(s1));
+    }
+
+    void
+    testPatch()
+    {
+        // single scalar edits
+        check("1", "2");
+        check("null", "true");
+        check("\"a\"", "\"b\"");
+
+        // single field edits
+        check(
+            "{\"a\":1,\"b\":2,\"c\":3}",
+            "{\"a\":1,\"b\":20,\"c\":3}");
+        check(
+            "{\"a\":1,\"b\":\"old\",\"c\":3}",
+            "{\"a\":1,\"b\":\"newer\",\"c\":3}");
+        check(
+            "[1,2,3,4]",
+            "[1,25,3,4]");
+        check(
+            "{\"a\":{\"b\":{\"c\":1}}}",
+            "{\"a\":{\"b\":{\"c\":2}}}");
+
+        // value replaced with a different
+        // kind, including structure
+        check(
+            "{\"a\":1,\"b\":2}",
+            "{\"a\":[1,2,3],\"b\":2}");
+        check(
+            "{\"a\":[1,2,3],\"b\":2}",
+            "{\"a\":null,\"b\":2}");
+
+        // edits touching keys or separators
+        // fall back to the enclosing object
+        check(
+            "{\"abc\":1,\"b\":2}",
+            "{\"axc\":1,\"b\":2}");
+        check(
+            "{\"a\":1}",
+            "{\"a\":1,\"b\":2}");
+        check("[1,2]", "[1,2,3]");
+        check("[1,2,3]", "[1,3]");
+        check(
+            "[[1],[2],[3]]",
+            "[[1],[3]]");
+        check(
+            "{\"a\":1,\"b\":2}",
+            "{\"b\":2}");
+
+        // escaped keys patch the
+        // enclosing container
+        check(
+            "{\"a\\n\":1,\"b\":2}",
+            "{\"a\\n\":7,\"b\":2}");
+
+        // whitespace-only edits
+        check("[1,2]", "[1, 2]");
+        check(" [1] ", "[1]");
+
+        // identical texts
+        check("{\"a\":1}", "{\"a\":1}");
+
+        // root replaced entirely
+        check("{\"a\":1}", "[1,2]");
+    }
+
+    void
+    testErrors()
+    {
+        // a bad edit reports an error and
+        // leaves the value unchanged
+        string_view const s0 = "{\"a\":1}";
+        value jv = parse(s0);
+        error_code ec;
+        reparse(jv, s0, "{\"a\":tru}", ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(jv == parse(s0));
+
+        reparse(jv, s0, "", ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(jv == parse(s0));
+
+        // throwing overload
+        BOOST_TEST_THROWS(
+            reparse(jv, s0, "{]"),
+            system_error);
+    }
+
+    void
+    testStorage()
+    {
+        // the patched subtree uses the
+        // storage of the original value
+        monotonic_resource mr;
+        string_view const s0 =
+            "{\"a\":1,\"b\":\"x\"}";
+        string_view const s1 =
+            "{\"a\":1,\"b\":\"a string long "
+            "enough to require allocation\"}";
+        value jv = parse(s0, &mr);
+        reparse(jv, s0, s1);
+        BOOST_TEST(jv == parse(s1));
+        BOOST_TEST(*jv.storage() == mr);
+        BOOST_TEST(
+            *jv.at("b").storage() == mr);
+    }
+
+    void
+    testOptions()
+    {
+        // extensions route through a
+        // full parse
+        parse_options opt;
+        opt.allow_comments = true;
+        string_view const s0 = "[1, /*c*/ 2]";
+        string_view const s1 = "[1, /*c*/ 3]";
+        value jv = parse(s0, {}, opt);
+        error_code ec;
+        reparse(jv, s0, s1, ec, opt);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(s1, {}, opt));
+    }
+
+    void
+    testLarge()
+    {
+        // a one-field edit deep inside a
+        // large document
+        std::string s0 = "[";
+        for(int i = 0; i < 500; ++i)
+        {
+            if(i > 0)
+                s0 += ',';
+            s0 += "{\"id\":";
+            s0 += std::to_string(i);
+            s0 += ",\"name\":\"item\",\"tags\""
+                ":[\"x\",\"y\"]}";
+        }
+        s0 += ']';
+        std::string s1 = s0;
+        auto const pos = s1.find(
+            "{\"id\":250,");
+        BOOST_TEST(pos != std::string::npos);
+        // replace the "item" value of the
+        // "name" member of element 250
+        s1.replace(pos + 17, 6, "\"edited\"");
+        BOOST_TEST(s1 != s0);
+
+        value jv = parse(s0);
+        error_code ec;
+        reparse(jv, s0, s1, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv == parse(s1));
+    }
+
+    void
+    run()
+    {
+        testPatch();
+        testErrors();
+        testStorage();
+        testOptions();
+        testLarge();
+    }
+};
+
+TEST_SUITE(reparse_test, "boost.json.reparse");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/reserved_resource.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <cstdint>
+#include <iostream>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+BOOST_STATIC_ASSERT( std::is_nothrow_destructible<reserved_resource>::value );
+BOOST_STATIC_ASSERT( is_deallocate_trivial<reserved_resource>::value );
+
+class reserved_resource_test
+{
+public:
+    void
+    testJavadocs()
+    {
+    //--------------------------------------
+
+    // reserve 1 MB of address space;
+    // only a few pages become resident
+    reserved_resource mr( 1024 * 1024 );
+
+    // Parse the string, using our memory resource
+    value const jv = parse( "[1,2,3]", &mr );
+
+    // Print the JSON
+    std::cout << jv;
+
+    //--------------------------------------
+    }
+
+    void
+    test()
+    {
+        // reserved_resource(size_t)
+        {
+            reserved_resource mr(1000);
+            BOOST_TEST(serialize(parse(
+                "[1,2,3]", &mr)) == "[1,2,3]");
+        }
+
+        // capacity(), size()
+        {
+            reserved_resource mr(1000);
+            BOOST_TEST(mr.capacity() >= 1000);
+            BOOST_TEST(mr.size() == 0);
+            (void)mr.allocate(100, 1);
+            BOOST_TEST(mr.size() >= 100);
+            BOOST_TEST(mr.size() <= mr.capacity());
+        }
+
+        // exhaustion
+        {
+            reserved_resource mr(1000);
+            (void)mr.allocate(1000, 1);
+            BOOST_TEST_THROWS(
+                mr.allocate(mr.capacity(), 1),
+                std::bad_alloc);
+        }
+
+        // alignment
+        {
+            reserved_resource mr(1000);
+            (void)mr.allocate(1, 1);
+            auto p = mr.allocate(8, 8);
+            BOOST_TEST(reinterpret_cast<
+                std::uintptr_t>(p) % 8 == 0);
+        }
+
+        // release()
+        {
+            reserved_resource mr(1000);
+            (void)mr.allocate(1000, 1);
+            mr.release();
+            BOOST_TEST(mr.size() == 0);
+            (void)mr.allocate(1000, 1);
+        }
+
+        // allocations only touch pages on demand
+        {
+            reserved_resource mr(
+                std::size_t(256) * 1024 * 1024);
+            auto p = static_cast<char*>(
+                mr.allocate(100, 1));
+            p[0] = '*';
+            p[99] = '*';
+            BOOST_TEST(mr.capacity() >=
+                std::size_t(256) * 1024 * 1024);
+        }
+    }
+
+    void
+    run()
+    {
+        test();
+    }
+};
+
+TEST_SUITE(reserved_resource_test, "boost.json.reserved_resource");
+
+} // namespace json
+} // namespace boost
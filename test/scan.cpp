@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/scan.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class scan_test
+{
+public:
+    void
+    testContainsKey()
+    {
+        // present as a key
+        BOOST_TEST(contains_key(
+            R"({"a":1,"user":{"name":"x"}})",
+            "user"));
+        BOOST_TEST(contains_key(
+            R"({"a":1,"user":{"name":"x"}})",
+            "name"));
+        BOOST_TEST(contains_key(
+            R"( { "k" : null } )", "k"));
+
+        // present only in a string value
+        BOOST_TEST(! contains_key(
+            R"({"a":"user"})", "user"));
+        BOOST_TEST(! contains_key(
+            R"(["user","user"])", "user"));
+
+        // present only outside of strings
+        BOOST_TEST(! contains_key(
+            R"({"a":true})", "true"));
+
+        // substring of a longer key
+        BOOST_TEST(! contains_key(
+            R"({"username":1})", "user"));
+        BOOST_TEST(! contains_key(
+            R"({"user":1})", "use"));
+
+        // escaped quotes do not end the key
+        BOOST_TEST(! contains_key(
+            R"({"a\"user\"b":1})", "user"));
+        BOOST_TEST(contains_key(
+            "{\"a\\\"b\":1}", "a\\\"b"));
+
+        // raw text comparison: the escaped
+        // spelling is a different key
+        BOOST_TEST(! contains_key(
+            R"({"\u0061":1})", "a"));
+
+        // empty key and empty document
+        BOOST_TEST(contains_key(
+            R"({"":1})", ""));
+        BOOST_TEST(! contains_key("{}", "a"));
+        BOOST_TEST(! contains_key("", "a"));
+
+        // text ending inside a string
+        BOOST_TEST(! contains_key(
+            R"({"user)", "user"));
+    }
+
+    void
+    testContainsString()
+    {
+        // keys and values both match
+        BOOST_TEST(contains_string(
+            R"({"user":1})", "user"));
+        BOOST_TEST(contains_string(
+            R"({"a":"the user id"})", "user"));
+        BOOST_TEST(contains_string(
+            R"(["x","user"])", "user"));
+
+        // text outside of strings never matches
+        BOOST_TEST(! contains_string(
+            R"([null,true,12345])", "true"));
+        BOOST_TEST(! contains_string(
+            R"({"a":12345})", "234"));
+
+        // a match never spans two strings
+        BOOST_TEST(! contains_string(
+            R"(["ab","cd"])", "abcd"));
+        BOOST_TEST(! contains_string(
+            R"(["ab","cd"])", "b\",\"c"));
+
+        // empty needle always matches
+        BOOST_TEST(contains_string("{}", ""));
+        BOOST_TEST(contains_string("", ""));
+
+        // text ending inside a string
+        BOOST_TEST(! contains_string(
+            R"(["user)", "user"));
+    }
+
+    void
+    testSniff()
+    {
+        // scalars
+        {
+            auto r = sniff("null");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::null);
+            BOOST_TEST(r.approx_size == 1);
+
+            r = sniff("  true ");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::bool_);
+
+            r = sniff("false");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::bool_);
+
+            r = sniff("\"hello\"");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::string);
+
+            r = sniff("12345");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::uint64);
+
+            r = sniff("-7");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::int64);
+
+            r = sniff("3.14");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::double_);
+
+            r = sniff("1e10");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::double_);
+        }
+
+        // objects report their first key
+        {
+            auto r = sniff(
+                R"({"type":"order","id":1})");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::object);
+            BOOST_TEST(r.first_key == "type");
+            BOOST_TEST(r.approx_size == 2);
+
+            r = sniff(R"( { "a\"b" : 1 } )");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(
+                r.first_key == "a\\\"b");
+
+            r = sniff("{}");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::object);
+            BOOST_TEST(r.first_key.empty());
+            BOOST_TEST(r.approx_size == 0);
+        }
+
+        // arrays report exact counts when
+        // they close within the prefix
+        {
+            auto r = sniff("[1,2,3]");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::array);
+            BOOST_TEST(r.approx_size == 3);
+
+            r = sniff("[]");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.approx_size == 0);
+
+            // commas inside nested values
+            // and strings do not count
+            r = sniff(
+                R"([[1,2],{"a":1,"b":2},"x,y"])");
+            BOOST_TEST(r.approx_size == 3);
+        }
+
+        // long containers get a projection
+        // from the examined prefix
+        {
+            std::string s = "[";
+            for(int i = 0; i < 10000; ++i)
+            {
+                if(i > 0)
+                    s += ',';
+                s += "7";
+            }
+            s += ']';
+            auto const r = sniff(s);
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::array);
+            BOOST_TEST(r.approx_size > 5000);
+            BOOST_TEST(r.approx_size < 20000);
+        }
+
+        // truncated text can still begin
+        // valid JSON
+        {
+            auto r = sniff(R"({"key)");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::object);
+            BOOST_TEST(r.first_key.empty());
+
+            r = sniff("{");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::object);
+
+            r = sniff("tru");
+            BOOST_TEST(r.valid);
+            BOOST_TEST(r.kind == kind::bool_);
+
+            r = sniff("-");
+            BOOST_TEST(r.valid);
+        }
+
+        // text which cannot begin JSON
+        {
+            BOOST_TEST(! sniff("").valid);
+            BOOST_TEST(! sniff("   ").valid);
+            BOOST_TEST(! sniff("x").valid);
+            BOOST_TEST(! sniff("nul!").valid);
+            BOOST_TEST(! sniff("{1:2}").valid);
+            BOOST_TEST(
+                ! sniff("// c").valid);
+        }
+    }
+
+    void
+    run()
+    {
+        testContainsKey();
+        testContainsString();
+        testSniff();
+    }
+};
+
+TEST_SUITE(scan_test, "boost.json.scan");
+
+} // namespace json
+} // namespace boost
@@ -10,10 +10,15 @@
 // Test that header file is self-contained.
 #include <boost/json/serialize.hpp>
 
+#include <boost/json/monotonic_resource.hpp>
 #include <boost/json/parse.hpp>
+#include <boost/json/serializer.hpp>
 #include <boost/json/static_resource.hpp>
+#include <cstdio>
+#include <fstream>
 #include <limits>
 #include <sstream>
+#include <string>
 
 #include "test_suite.hpp"
 
@@ -58,6 +63,231 @@ public:
         }
     }
 
+    void
+    testSerializeToString()
+    {
+        // small documents use the direct path
+        {
+            string s;
+            value const jv = { 1, 2, 3 };
+            serialize(s, jv);
+            BOOST_TEST(s == "[1,2,3]");
+            array const arr = { 4, 5 };
+            serialize(s, arr);
+            BOOST_TEST(s == "[4,5]");
+            object const obj = { {"k",1} };
+            serialize(s, obj);
+            BOOST_TEST(s == "{\"k\":1}");
+        }
+
+        // large documents reserve once,
+        // and the output text matches
+        // serialize exactly
+        {
+            array arr;
+            for(int i = 0; i < 1000; ++i)
+                arr.emplace_back(
+                    "abcdefghijklmnop\\\"\n");
+            value const jv(arr);
+            string s;
+            serialize(s, jv);
+            BOOST_TEST(
+                s.subview() == serialize(jv));
+        }
+
+        // the capacity and the memory
+        // resource are retained across calls
+        {
+            monotonic_resource mr;
+            string s{storage_ptr(&mr)};
+            value const jv = { "hello", 3.14,
+                { {"k", nullptr} } };
+            serialize(s, jv);
+            BOOST_TEST(
+                s.subview() == serialize(jv));
+            BOOST_TEST(*s.storage() == mr);
+            auto const cap = s.capacity();
+            for(int i = 0; i < 100; ++i)
+            {
+                serialize(s, jv);
+                BOOST_TEST(
+                    s.capacity() == cap);
+            }
+        }
+
+        // pretty output exceeds the
+        // compact measurement
+        {
+            serialize_options opts;
+            opts.pretty = true;
+            value const jv = { 1, { {"k", 2} } };
+            string s;
+            serialize(s, jv, opts);
+            BOOST_TEST(s.subview() ==
+                serialize(jv, opts));
+        }
+    }
+
+    struct string_sink : serialize_sink
+    {
+        std::string text;
+        std::size_t chunks = 0;
+        std::size_t finished = 0;
+
+        void
+        do_write(
+            char const* data,
+            std::size_t size) override
+        {
+            text.append(data, size);
+            ++chunks;
+        }
+
+        void
+        do_finish() override
+        {
+            ++finished;
+        }
+    };
+
+    void
+    testSink()
+    {
+        // the sink receives the exact
+        // serialized text, then finish
+        {
+            value const jv = { "hello", 3.14,
+                { {"k", nullptr} } };
+            string_sink sink;
+            serialize(sink, jv);
+            BOOST_TEST(sink.text == serialize(jv));
+            BOOST_TEST(sink.finished == 1);
+
+            array const arr = { 4, 5 };
+            string_sink sink2;
+            serialize(sink2, arr);
+            BOOST_TEST(sink2.text == "[4,5]");
+
+            object const obj = { {"k",1} };
+            string_sink sink3;
+            serialize(sink3, obj);
+            BOOST_TEST(sink3.text == "{\"k\":1}");
+        }
+
+        // large documents arrive in
+        // bounded chunks
+        {
+            array arr;
+            for(int i = 0; i < 10000; ++i)
+                arr.emplace_back(i);
+            value const jv(arr);
+            string_sink sink;
+            serialize(sink, jv);
+            BOOST_TEST(sink.text == serialize(jv));
+            BOOST_TEST(sink.chunks > 1);
+            BOOST_TEST(sink.finished == 1);
+        }
+
+        // options are honored
+        {
+            serialize_options opts;
+            opts.pretty = true;
+            value const jv = { 1, { {"k", 2} } };
+            string_sink sink;
+            serialize(sink, jv, opts);
+            BOOST_TEST(sink.text ==
+                serialize(jv, opts));
+        }
+    }
+
+    void
+    testLimit()
+    {
+        value const jv = { "hello", 3.14,
+            { {"k", nullptr} } };
+        auto const full = serialize(jv);
+
+        // a sufficient budget reports no
+        // error and produces identical text
+        {
+            error_code ec;
+            auto const s = serialize(
+                jv, full.size(), ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(s == full);
+            BOOST_TEST(serialize(
+                jv, full.size() + 1) == full);
+        }
+
+        // an exceeded budget stops early,
+        // returning a prefix of the output
+        {
+            error_code ec;
+            auto const s = serialize(
+                jv, 5, ec);
+            BOOST_TEST(ec ==
+                error::output_limit);
+            BOOST_TEST(s.size() <= 5);
+            BOOST_TEST(
+                s == full.substr(0, s.size()));
+
+            std::error_code sec;
+            serialize(jv, 5, sec);
+            BOOST_TEST(sec ==
+                error::output_limit);
+
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                serialize(jv, 5));
+        }
+
+        // the work performed is bounded by
+        // the budget even when the document
+        // is much larger
+        {
+            array arr;
+            for(int i = 0; i < 10000; ++i)
+                arr.emplace_back(i);
+            value const big(arr);
+            error_code ec;
+            auto const s = serialize(
+                big, 100, ec);
+            BOOST_TEST(ec ==
+                error::output_limit);
+            BOOST_TEST(s.size() <= 100);
+            BOOST_TEST(serialize(big)
+                .compare(0, s.size(), s) == 0);
+        }
+
+        // a zero budget fails for any
+        // document
+        {
+            error_code ec;
+            auto const s = serialize(
+                value(1), 0, ec);
+            BOOST_TEST(ec ==
+                error::output_limit);
+            BOOST_TEST(s.empty());
+        }
+
+        // pretty output is capped on its
+        // own, larger text
+        {
+            serialize_options opts;
+            opts.pretty = true;
+            auto const pf =
+                serialize(jv, opts);
+            error_code ec;
+            auto const s = serialize(
+                jv, 10, ec, opts);
+            BOOST_TEST(ec ==
+                error::output_limit);
+            BOOST_TEST(
+                s == pf.substr(0, s.size()));
+            BOOST_TEST(serialize(jv,
+                pf.size(), opts) == pf);
+        }
+    }
+
     void
     testSpecialNumbers()
     {
@@ -81,11 +311,534 @@ public:
         BOOST_TEST( ss.str() == "[null,1e99999,-1e99999]" );
     }
 
+    void
+    testSerializedSize()
+    {
+        // exact for strings and structure
+        {
+            value const jv = { "abc", {
+                { "key", "value" },
+                { "esc", "a\"b\\c\nd\x01" } },
+                array{}, nullptr };
+            BOOST_TEST(serialized_size(jv) ==
+                serialize(jv).size());
+        }
+        {
+            string const str =
+                "a long string\twith\\escapes\x02"
+                " and some more text to measure";
+            BOOST_TEST(serialized_size(str) ==
+                serialize(str).size());
+            BOOST_TEST(
+                serialized_size(str.subview()) ==
+                serialize(str).size());
+        }
+
+        // an upper bound for numbers and literals
+        for(string_view js : {
+            "[1,2,3]",
+            "{\"k1\":1,\"k2\":-2.5e10}",
+            "[true,false,null,1.25]",
+            "18446744073709551615" })
+        {
+            value const jv = parse(js);
+            BOOST_TEST(serialized_size(jv) >=
+                serialize(jv).size());
+        }
+        {
+            array const arr = { 1, 2, 3 };
+            BOOST_TEST(serialized_size(arr) >=
+                serialize(arr).size());
+            object const obj = { {"k1",1}, {"k2",2} };
+            BOOST_TEST(serialized_size(obj) >=
+                serialize(obj).size());
+        }
+
+        // large outputs exceed the stack
+        // buffer and reserve exactly once
+        {
+            array arr;
+            for(int i = 0; i < 1000; ++i)
+                arr.emplace_back(
+                    "string number " +
+                        std::to_string(i));
+            auto const s = serialize(arr);
+            BOOST_TEST(serialized_size(arr) ==
+                s.size());
+            BOOST_TEST(parse(s).as_array() == arr);
+        }
+    }
+
+    void
+    testExactAndMaxSize()
+    {
+        // exact_serialized_size matches the
+        // output, including numbers
+        for(string_view js : {
+            "[1,2,3]",
+            "{\"k1\":1,\"k2\":-2.5e10}",
+            "[true,false,null,1.25]",
+            "18446744073709551615",
+            "{\"esc\":\"a\\\"b\\\\c\\nd\\u0001\"}",
+            "[[],{},\"\",0]" })
+        {
+            value const jv = parse(js);
+            BOOST_TEST(
+                exact_serialized_size(jv) ==
+                serialize(jv).size());
+        }
+        {
+            array const arr = { 1, 2.5, "x" };
+            BOOST_TEST(
+                exact_serialized_size(arr) ==
+                serialize(arr).size());
+            object const obj =
+                { {"k1",1}, {"k2",-2} };
+            BOOST_TEST(
+                exact_serialized_size(obj) ==
+                serialize(obj).size());
+        }
+
+        // canonical output has the same size
+        {
+            value const jv = parse(
+                "{\"b\":1,\"a\":[2,{\"d\":3,"
+                "\"c\":4}]}");
+            serialize_options opts;
+            opts.canonical = true;
+            BOOST_TEST(
+                exact_serialized_size(jv) ==
+                serialize(jv, opts).size());
+        }
+
+        // non-finite doubles follow the
+        // allow_infinity_and_nan option
+        {
+            value const jv = {
+                std::numeric_limits<
+                    double>::quiet_NaN(),
+                std::numeric_limits<
+                    double>::infinity() };
+            serialize_options opts;
+            opts.allow_infinity_and_nan = true;
+            BOOST_TEST(
+                exact_serialized_size(jv, opts) ==
+                serialize(jv, opts).size());
+            BOOST_TEST(
+                exact_serialized_size(jv) ==
+                serialize(jv).size());
+        }
+
+        // max_serialized_size bounds any
+        // output without reading strings
+        for(string_view js : {
+            "[1,2,3]",
+            "\"a\\u0001b\\u0002\"",
+            "{\"k\":\"\\u0003\\u0004\\u0005\"}",
+            "[true,false,null,1e308]" })
+        {
+            value const jv = parse(js);
+            BOOST_TEST(
+                max_serialized_size(jv) >=
+                serialize(jv).size());
+            BOOST_TEST(
+                max_serialized_size(jv) >=
+                exact_serialized_size(jv));
+        }
+
+        // the string bound is tight when
+        // every character needs \uXXXX
+        {
+            string const str(10, '\x01');
+            BOOST_TEST(
+                max_serialized_size(str) ==
+                serialize(str).size());
+            BOOST_TEST(
+                max_serialized_size(
+                    str.subview()) ==
+                serialize(str).size());
+        }
+    }
+
+    void
+    testSmallDocuments()
+    {
+        // small values are emitted directly;
+        // the output must match the
+        // serializer exactly
+        for(string_view js : {
+            "{\"ok\":true,\"id\":123}",
+            "[1,2.5,-3,18446744073709551615]",
+            "{\"a\":{\"b\":[1,\"two\",null]},"
+                "\"c\":false}",
+            "\"plain\"",
+            "\"esc \\\"quote\\\" \\\\ \\n \\u0001\"",
+            "[]",
+            "{}",
+            "null",
+            "true",
+            "-1.25e-10" })
+        {
+            value const jv = parse(js);
+            serializer sr;
+            sr.reset(&jv);
+            char buf[4096];
+            BOOST_TEST(serialize(jv) ==
+                sr.read(buf, sizeof(buf)));
+        }
+
+        // outputs near the stack buffer
+        // boundary agree with the
+        // serializer on both sides of it
+        for(std::size_t n :
+            { 4000, 4100, 8200 })
+        {
+            array arr;
+            std::size_t i = 0;
+            while(serialized_size(arr) < n)
+                arr.emplace_back(i++);
+            auto const s = serialize(arr);
+            BOOST_TEST(parse(s).as_array()
+                == arr);
+        }
+    }
+
+    void
+    testPretty()
+    {
+        serialize_options opts;
+        opts.pretty = true;
+
+        value const jv = parse(
+            "{\"a\":1,\"arr\":[1,true,"
+            "{\"k\":\"v\"},[],{}],\"n\":null}");
+        string_view const expected =
+            "{\n"
+            "    \"a\": 1,\n"
+            "    \"arr\": [\n"
+            "        1,\n"
+            "        true,\n"
+            "        {\n"
+            "            \"k\": \"v\"\n"
+            "        },\n"
+            "        [],\n"
+            "        {}\n"
+            "    ],\n"
+            "    \"n\": null\n"
+            "}";
+        auto const s = serialize(jv, opts);
+        BOOST_TEST(s == expected);
+
+        // pretty output parses back
+        // to the same value
+        BOOST_TEST(parse(s) == jv);
+
+        // the serializer remains resumable
+        // at every buffer size
+        for(std::size_t size = 1;
+            size <= 64; ++size)
+        {
+            serializer sr(opts);
+            sr.reset(&jv);
+            std::string s1;
+            while(! sr.done())
+            {
+                char buf[64];
+                auto const sv =
+                    sr.read(buf, size);
+                s1.append(
+                    sv.data(), sv.size());
+            }
+            BOOST_TEST(s1 == expected);
+        }
+
+        // indent width is configurable
+        opts.indent_size = 2;
+        BOOST_TEST(serialize(
+            array{ 1, 2 }, opts) ==
+            "[\n  1,\n  2\n]");
+
+        // deep nesting exceeds one cached
+        // whitespace block while staying
+        // within the default parse depth
+        opts.indent_size = 4;
+        value deep = 1;
+        for(int i = 0; i < 30; ++i)
+            deep = array{ deep };
+        BOOST_TEST(parse(serialize(
+            deep, opts)) == deep);
+
+        // compact output is unchanged
+        BOOST_TEST(serialize(jv,
+            serialize_options{}) ==
+                serialize(jv));
+        BOOST_TEST(serialize_parallel(
+            jv, 4, opts) == s);
+    }
+
+    void
+    testCanonical()
+    {
+        serialize_options opts;
+        opts.canonical = true;
+
+        value const jv = parse(
+            R"({"b":1,"a":{"y":[{"q":1,"p":2},3],"x":null},"c":"s"})");
+        string_view const expected =
+            R"({"a":{"x":null,"y":[{"p":2,"q":1},3]},"b":1,"c":"s"})";
+        BOOST_TEST(
+            serialize(jv, opts) == expected);
+
+        // equal documents produce identical
+        // text regardless of insertion order
+        {
+            value const jv2 = parse(
+                R"({"c":"s","a":{"y":[{"p":2,"q":1},3],"x":null},"b":1})");
+            BOOST_TEST(jv2 == jv);
+            BOOST_TEST(serialize(
+                jv2, opts) == expected);
+        }
+
+        // canonical output parses back
+        // to the same value
+        BOOST_TEST(
+            parse(serialize(jv, opts)) == jv);
+
+        // the serializer remains resumable
+        // at every buffer size
+        for(std::size_t size = 1;
+            size <= 64; ++size)
+        {
+            serializer sr(opts);
+            sr.reset(&jv);
+            std::string s1;
+            while(! sr.done())
+            {
+                char buf[64];
+                auto const sv =
+                    sr.read(buf, size);
+                s1.append(
+                    sv.data(), sv.size());
+            }
+            BOOST_TEST(s1 == expected);
+        }
+
+        // the object overload sorts too
+        BOOST_TEST(serialize(
+            jv.get_object(), opts) == expected);
+        BOOST_TEST(serialize(
+            object{}, opts) == "{}");
+
+        // canonical implies compact output
+        opts.pretty = true;
+        BOOST_TEST(
+            serialize(jv, opts) == expected);
+        opts.pretty = false;
+
+        // the serializer can be reused after
+        // an abandoned canonical pass
+        {
+            serializer sr(opts);
+            sr.reset(&jv);
+            char buf[8];
+            sr.read(buf, sizeof(buf));
+            sr.reset(&jv);
+            std::string s1;
+            while(! sr.done())
+            {
+                char buf2[32];
+                auto const sv = sr.read(
+                    buf2, sizeof(buf2));
+                s1.append(
+                    sv.data(), sv.size());
+            }
+            BOOST_TEST(s1 == expected);
+        }
+
+        // insertion-ordered output
+        // is unchanged
+        BOOST_TEST(serialize(jv) != expected);
+        BOOST_TEST(parse(
+            serialize(jv)) == jv);
+    }
+
+    void
+    testParallel()
+    {
+        // identical output to serialize()
+        // for each thread count
+        array arr;
+        for(int i = 0; i < 5000; ++i)
+        {
+            switch(i % 4)
+            {
+            case 0:
+                arr.emplace_back(i);
+                break;
+            case 1:
+                arr.emplace_back(
+                    "element \"" +
+                        std::to_string(i) + "\"");
+                break;
+            case 2:
+                arr.emplace_back(
+                    object{ { "i", i } });
+                break;
+            default:
+                arr.emplace_back(i * 1.5);
+                break;
+            }
+        }
+        auto const expected = serialize(arr);
+        for(std::size_t n : {
+            std::size_t(0), std::size_t(1),
+            std::size_t(2), std::size_t(3),
+            std::size_t(7) })
+        {
+            BOOST_TEST(serialize_parallel(
+                arr, n) == expected);
+            BOOST_TEST(serialize_parallel(
+                value(arr), n) == expected);
+        }
+
+        // small inputs and other kinds take
+        // the ordinary path
+        BOOST_TEST(serialize_parallel(
+            array{ 1, 2, 3 }, 4) == "[1,2,3]");
+        BOOST_TEST(serialize_parallel(
+            array{}, 4) == "[]");
+        value const jv = { {"k", "v"} };
+        BOOST_TEST(serialize_parallel(jv, 4) ==
+            serialize(jv));
+    }
+
+    void
+    testFormatDoubles()
+    {
+        double const values[] = {
+            0.0, -0.0, 1.0, -1.5, 3.14159,
+            1e300, -2.5e-10, 1.0/3.0,
+            123456789.123456789 };
+        std::size_t const n =
+            sizeof(values) / sizeof(values[0]);
+
+        // output matches serializing the
+        // same values as an array
+        array arr;
+        for(double d : values)
+            arr.emplace_back(d);
+        char buf[28 * n];
+        std::size_t const len =
+            format_doubles(buf, values, n);
+        BOOST_TEST(len <= sizeof(buf));
+        BOOST_TEST(
+            "[" + std::string(buf, len) + "]" ==
+            serialize(arr));
+
+        // custom separator
+        {
+            double const two[] = { 1.5, 2.5 };
+            char buf2[56];
+            std::size_t const len2 =
+                format_doubles(buf2, two, 2, ' ');
+            BOOST_TEST(std::string(
+                buf2, len2) == "1.5E0 2.5E0");
+        }
+
+        // non-finite values follow the options
+        {
+            using Lims = std::numeric_limits<double>;
+            double const special[] = {
+                Lims::infinity(), Lims::quiet_NaN() };
+            char buf2[56];
+            std::size_t len2 = format_doubles(
+                buf2, special, 2);
+            BOOST_TEST(std::string(buf2, len2) ==
+                "1e99999,null");
+            serialize_options opts;
+            opts.allow_infinity_and_nan = true;
+            len2 = format_doubles(
+                buf2, special, 2, ',', opts);
+            BOOST_TEST(std::string(buf2, len2) ==
+                "Infinity,NaN");
+        }
+
+        // empty input writes nothing
+        BOOST_TEST(format_doubles(
+            nullptr, nullptr, 0) == 0);
+    }
+
+    void
+    testFile()
+    {
+        char const* const path =
+            "serialize_file_test.json";
+
+        // large outputs round-trip and
+        // match serialize() exactly
+        array arr;
+        for(int i = 0; i < 20000; ++i)
+            arr.emplace_back(
+                "string number " +
+                    std::to_string(i));
+        value const jv = std::move(arr);
+        auto const expected = serialize(jv);
+        error_code ec;
+        serialize_file(path, jv, ec);
+        BOOST_TEST(! ec);
+        {
+            std::ifstream is(path,
+                std::ios::binary);
+            std::stringstream ss;
+            ss << is.rdbuf();
+            BOOST_TEST(ss.str() == expected);
+        }
+
+        // options are honored
+        serialize_options opts;
+        opts.pretty = true;
+        serialize_file(path, jv, ec, opts);
+        BOOST_TEST(! ec);
+        {
+            std::ifstream is(path,
+                std::ios::binary);
+            std::stringstream ss;
+            ss << is.rdbuf();
+            BOOST_TEST(ss.str() ==
+                serialize(jv, opts));
+        }
+        std::remove(path);
+
+        // unwritable paths report an error
+        char const* const bad =
+            "no-such-dir/serialize_file.json";
+        serialize_file(bad, jv, ec);
+        BOOST_TEST(
+            ec == error::output_error);
+        BOOST_TEST_THROWS(
+            serialize_file(bad, jv),
+            system_error);
+        std::error_code sec;
+        serialize_file(bad, jv, sec);
+        BOOST_TEST(sec);
+    }
+
     void
     run()
     {
         testSerialize();
+        testSerializeToString();
+        testSink();
+        testLimit();
         testSpecialNumbers();
+        testSerializedSize();
+        testExactAndMaxSize();
+        testSmallDocuments();
+        testPretty();
+        testCanonical();
+        testParallel();
+        testFormatDoubles();
+        testFile();
     }
 };
 
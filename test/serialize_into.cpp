@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/serialize_into.hpp>
+
+#include <boost/json/parse_into.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/value_from.hpp>
+#include <boost/describe.hpp>
+
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_suite.hpp"
+
+struct A
+{
+    int x;
+    double y;
+    std::string z;
+};
+
+BOOST_DESCRIBE_STRUCT(A, (), (x, y, z))
+
+struct B
+{
+    std::vector<A> v;
+    std::map<std::string, int> m;
+    bool b;
+};
+
+BOOST_DESCRIBE_STRUCT(B, (), (v, m, b))
+
+BOOST_DEFINE_ENUM_CLASS(E, a, b, c)
+
+namespace boost {
+namespace json {
+
+class serialize_into_test
+{
+public:
+    // a sink backed by a std::string
+    struct string_sink
+    {
+        std::string s;
+
+        serializer::mutable_buffer
+        prepare(std::size_t n)
+        {
+            size_ = s.size();
+            s.resize(size_ + n);
+            return { &s[0] + size_, n };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            s.resize(size_ + n);
+        }
+
+    private:
+        std::size_t size_ = 0;
+    };
+
+    template<class T>
+    static
+    std::string
+    direct(
+        T const& t,
+        serialize_options const& opts = {})
+    {
+        string_sink sink;
+        serialize_into(sink, t, opts);
+        return sink.s;
+    }
+
+    // the output must be identical to
+    // going through value_from
+    template<class T>
+    static
+    void
+    check(T const& t)
+    {
+        BOOST_TEST(direct(t) ==
+            serialize(value_from(t)));
+    }
+
+    void
+    testScalars()
+    {
+        check(nullptr);
+        check(true);
+        check(false);
+        check(0);
+        check(-123);
+        check(18446744073709551615ULL);
+        check(1.5);
+        check(std::string("plain"));
+        check(std::string("esc \"q\" \\ \n \x01 tail"));
+        check(E::b);
+    }
+
+    void
+    testContainers()
+    {
+        check(std::vector<int>{});
+        check(std::vector<int>{ 1, 2, 3 });
+        check(std::map<std::string, double>{
+            { "pi", 3.14 }, { "e", 2.72 } });
+        check(std::make_tuple(
+            1, std::string("two"), 3.5));
+        check(std::make_pair(
+            std::string("k"), false));
+        check(std::vector<std::vector<int>>{
+            { 1 }, {}, { 2, 3 } });
+    }
+
+    void
+    testDescribed()
+    {
+        A const a{ 1, 2.5, "three" };
+        check(a);
+
+        B const b{
+            { { 1, 1.5, "one" }, { 2, 2.5, "two" } },
+            { { "k1", 1 }, { "k2", 2 } },
+            true };
+        check(b);
+
+        // round trip through parse_into
+        B b2{};
+        parse_into(b2, direct(b));
+        BOOST_TEST(direct(b2) == direct(b));
+    }
+
+    void
+    testLibraryTypes()
+    {
+        // library types go through the
+        // regular serializer
+        value const jv = { 1, "two", { { "k", 3 } } };
+        check(jv);
+        check(jv.get_array());
+        check(jv.at(2).get_object());
+        check(string("str"));
+    }
+
+    void
+    testOptions()
+    {
+        serialize_options opts;
+        opts.pretty = true;
+
+        B const b{
+            { { 1, 1.5, "one" } },
+            { { "k", 1 } },
+            false };
+        BOOST_TEST(direct(b, opts) ==
+            serialize(value_from(b), opts));
+        BOOST_TEST(direct(
+            std::vector<int>{}, opts) == "[]");
+
+        using Lims = std::numeric_limits<double>;
+        opts = {};
+        opts.allow_infinity_and_nan = true;
+        BOOST_TEST(direct(
+            Lims::infinity(), opts) == "Infinity");
+        BOOST_TEST(direct(
+            Lims::infinity()) == "1e99999");
+    }
+
+    void
+    run()
+    {
+        testScalars();
+        testContainers();
+        testDescribed();
+        testLibraryTypes();
+        testOptions();
+    }
+};
+
+TEST_SUITE(serialize_into_test, "boost.json.serialize_into");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/serialized_template.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class serialized_template_test
+{
+    // render, then check against serializing
+    // the template with the holes replaced
+    static
+    void
+    checkRender(
+        value const& tmpl,
+        std::initializer_list<
+            string_view> pointers,
+        std::initializer_list<
+            value const*> subs)
+    {
+        serialized_template st(
+            tmpl, pointers);
+        BOOST_TEST(st.holes() ==
+            pointers.size());
+        value expect = tmpl;
+        auto p = pointers.begin();
+        auto s = subs.begin();
+        for(; p != pointers.end(); ++p, ++s)
+            expect.at_pointer(*p) = **s;
+        BOOST_TEST(st.render(subs) ==
+            serialize(expect));
+    }
+
+public:
+    void
+    testRender()
+    {
+        value const tmpl = parse(
+            "{\"greeting\":\"hello\","
+            "\"user\":{\"name\":\"x\","
+            "\"id\":0},"
+            "\"items\":[],"
+            "\"footer\":[1,2,{\"k\":null}]}");
+
+        // single hole
+        {
+            value const name = "alice";
+            checkRender(tmpl,
+                { "/user/name" },
+                { &name });
+        }
+
+        // several holes, including an
+        // array element
+        {
+            value const name = "bob\n\"q\"";
+            value const items = parse(
+                "[{\"sku\":1},{\"sku\":2}]");
+            value const k = 3.5;
+            checkRender(tmpl,
+                { "/user/name", "/items",
+                    "/footer/2/k" },
+                { &name, &items, &k });
+        }
+
+        // the whole document as one hole
+        {
+            value const sub = parse(
+                "[false,null]");
+            checkRender(tmpl,
+                { "" }, { &sub });
+        }
+
+        // no holes renders the cached text
+        {
+            serialized_template st(tmpl, {});
+            BOOST_TEST(st.holes() == 0);
+            BOOST_TEST(st.render({}) ==
+                serialize(tmpl));
+        }
+
+        // rendering twice with different
+        // substitutions reuses the segments
+        {
+            serialized_template st(tmpl,
+                { "/user/id" });
+            value const a = 1;
+            value const b = 2;
+            BOOST_TEST(
+                st.render({ &a }) !=
+                st.render({ &b }));
+        }
+
+        // default constructed
+        {
+            serialized_template st;
+            BOOST_TEST(st.holes() == 0);
+            BOOST_TEST(st.render({}) == "");
+        }
+    }
+
+    void
+    testErrors()
+    {
+        value const tmpl = parse(
+            "{\"a\":{\"b\":[1,2]}}");
+
+        // unresolvable pointer
+        BOOST_TEST_THROWS(
+            serialized_template(tmpl,
+                { "/missing" }),
+            system_error);
+
+        // nested holes
+        BOOST_TEST_THROWS(
+            serialized_template(tmpl,
+                { "/a", "/a/b" }),
+            system_error);
+
+        // duplicate holes
+        BOOST_TEST_THROWS(
+            serialized_template(tmpl,
+                { "/a/b", "/a/b" }),
+            system_error);
+
+        // substitution count mismatch
+        {
+            serialized_template st(
+                tmpl, { "/a/b" });
+            value const sub = 1;
+            BOOST_TEST_THROWS(
+                st.render({ &sub, &sub }),
+                system_error);
+        }
+    }
+
+    void
+    run()
+    {
+        testRender();
+        testErrors();
+    }
+};
+
+TEST_SUITE(serialized_template_test, "boost.json.serialized_template");
+
+} // namespace json
+} // namespace boost
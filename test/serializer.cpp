@@ -11,10 +11,12 @@
 #include <boost/json/serializer.hpp>
 
 #include <boost/json/serialize.hpp>
+#include <boost/json/detail/sbo_buffer.hpp>
 #include <boost/json/null_resource.hpp>
 #include <boost/json/parse.hpp>
 #include <boost/json/parse.hpp>
 #include <iostream>
+#include <limits>
 
 #include "parse-vectors.hpp"
 #include "test.hpp"
@@ -346,6 +348,16 @@ public:
         check("[{},{}]");
         check("[1,2,3,4,5]");
         check("[true,false,null]");
+
+        // runs of same-kind numbers use the
+        // dedicated emission loops; mix the
+        // kinds to cover the run boundaries
+        check("[1,2,3,-4,-5,6,7,8,9,10]");
+        check("[1E1,2.5E0,-3.5E2,1E-1]");
+        check("[18446744073709551615,18446744073709551614]");
+        check("[1,2,1E1,2E1,3,18446744073709551615,4,5]");
+        check("[\"x\",1,2,3,\"y\",4.5E0,5.5E0,null,6,7]");
+        check("[[1,2,3],[4,5,6],[7.5E0,8.5E0]]");
     }
 
     void
@@ -580,6 +592,189 @@ public:
         }
     }
 
+    void
+    testReadBuffers()
+    {
+        string const big(
+            string_view(
+                "this string is long enough to be "
+                "referenced in place rather than "
+                "copied through the temporary, "
+                "0123456789 0123456789 0123456789"));
+        value jv = {
+            { "key", big },
+            { "esc", "a\"b\\c\n" + std::string(
+                big.subview()) + "\ttail" },
+            { "num", 12345 },
+            { "arr", { 1, big, nullptr } },
+            { "small", "xy" } };
+        auto const expected = serialize(jv);
+
+        // reassembled segments match read(),
+        // for various list and buffer sizes
+        for(std::size_t num_bufs :
+            { std::size_t(1), std::size_t(2),
+              std::size_t(4), std::size_t(16) })
+        for(std::size_t temp_size :
+            { std::size_t(1), std::size_t(7),
+              std::size_t(64), std::size_t(4096) })
+        {
+            serializer sr;
+            sr.reset(&jv);
+            std::string result;
+            std::size_t refs = 0;
+            serializer::const_buffer bufs[16];
+            char temp[4096];
+            while(! sr.done())
+            {
+                std::size_t const n =
+                    sr.read_buffers(bufs,
+                        num_bufs, temp, temp_size);
+                BOOST_TEST(n <= num_bufs);
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    result.append(static_cast<
+                        char const*>(bufs[i].data),
+                        bufs[i].size);
+                    // segments outside temp alias
+                    // the value's own storage
+                    if(bufs[i].data < temp ||
+                        bufs[i].data >= temp + temp_size)
+                        ++refs;
+                }
+            }
+            BOOST_TEST(result == expected);
+            // large strings are referenced in
+            // place when the list has room
+            if(num_bufs >= 4)
+                BOOST_TEST(refs > 0);
+        }
+
+        // plain read() is unaffected afterwards
+        {
+            serializer sr;
+            sr.reset(&jv);
+            serializer::const_buffer bufs[8];
+            char temp[64];
+            sr.read_buffers(bufs, 8, temp, 64);
+            std::string result;
+            char buf[4096];
+            // restart
+            sr.reset(&jv);
+            while(! sr.done())
+                result.append(std::string(
+                    sr.read(buf)));
+            BOOST_TEST(result == expected);
+        }
+    }
+
+    // a sink backed by a std::string,
+    // see serializer::read_into
+    struct string_sink
+    {
+        std::string s;
+        std::size_t chunk;
+
+        serializer::mutable_buffer
+        prepare(std::size_t n)
+        {
+            if(n > chunk)
+                n = chunk;
+            size_ = s.size();
+            s.resize(size_ + n);
+            return { &s[0] + size_, n };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            s.resize(size_ + n);
+        }
+
+    private:
+        std::size_t size_ = 0;
+    };
+
+    void
+    testReadInto()
+    {
+        value jv = {
+            { "key", "value with a \"quote\"" },
+            { "num", 12345 },
+            { "arr", { 1, 2.5, nullptr, true } } };
+        auto const expected = serialize(jv);
+
+        // sinks receive the same characters
+        // as read(), for various region sizes
+        for(std::size_t chunk :
+            { std::size_t(1), std::size_t(7),
+              std::size_t(64), std::size_t(4096) })
+        {
+            string_sink sink;
+            sink.chunk = chunk;
+            serializer sr;
+            sr.reset(&jv);
+            std::size_t const total =
+                sr.read_into(sink);
+            BOOST_TEST(total == expected.size());
+            BOOST_TEST(sink.s == expected);
+            BOOST_TEST(sr.done());
+        }
+
+        // detail::sbo_buffer models the
+        // sink requirements
+        {
+            detail::sbo_buffer<16> buf;
+            serializer sr;
+            sr.reset(&jv);
+            sr.read_into(buf);
+            BOOST_TEST(string_view(
+                buf.data(), buf.size()) ==
+                    expected);
+        }
+    }
+
+    void
+    testCostBudget()
+    {
+        // an escape-heavy value is emitted
+        // in slices no larger than the budget
+        value jv = {
+            { "text", std::string(100, '\n') },
+            { "arr", { 1, 2.5, nullptr, true } } };
+        auto const expected = serialize(jv);
+
+        for(std::size_t cost :
+            { std::size_t(1), std::size_t(10),
+              std::size_t(1000) })
+        {
+            serializer sr;
+            sr.reset(&jv);
+            std::string s;
+            char buf[4096];
+            while(! sr.done())
+            {
+                auto const sv = sr.read(
+                    buf, sizeof(buf), cost);
+                BOOST_TEST(sv.size() <= cost);
+                s.append(sv.data(), sv.size());
+            }
+            BOOST_TEST(s == expected);
+        }
+
+        // a generous budget does not
+        // limit the output
+        {
+            serializer sr;
+            sr.reset(&jv);
+            char buf[4096];
+            auto const sv = sr.read(buf,
+                sizeof(buf), std::size_t(-1));
+            BOOST_TEST(sr.done());
+            BOOST_TEST(sv == expected);
+        }
+    }
+
     void
     testNumberRoundTrips()
     {
@@ -592,6 +787,107 @@ public:
         BOOST_TEST(serialize(parse("-0.0")) == "-0E0");
     }
 
+    void
+    testDoubleCache()
+    {
+        serialize_options opts;
+        opts.cache_doubles = true;
+
+        // repeated doubles produce the
+        // same text as the default path
+        {
+            array arr;
+            for(int i = 0; i < 1000; ++i)
+                arr.emplace_back(
+                    100.25 + (i % 7) * 0.25);
+            value const jv(arr);
+            BOOST_TEST(
+                serialize(jv, opts) ==
+                serialize(jv));
+        }
+
+        // the cache persists across reset
+        {
+            value const jv1 = parse(
+                "[1.25,1.25,2.5,1e308,5e-324]");
+            value const jv2 = parse(
+                "{\"a\":1.25,\"b\":2.5}");
+            serializer sr(opts);
+            char buf[1024];
+            sr.reset(&jv1);
+            BOOST_TEST(sr.read(buf) ==
+                serialize(jv1));
+            sr.reset(&jv2);
+            BOOST_TEST(sr.read(buf) ==
+                serialize(jv2));
+        }
+
+        // non-finite values still follow
+        // allow_infinity_and_nan
+        {
+            double const inf =
+                std::numeric_limits<
+                    double>::infinity();
+            value const jv = { inf, inf };
+            BOOST_TEST(
+                serialize(jv, opts) ==
+                serialize(jv));
+            opts.allow_infinity_and_nan = true;
+            BOOST_TEST(serialize(jv, opts) ==
+                "[Infinity,Infinity]");
+        }
+
+        // mixed kinds are unaffected
+        {
+            value const jv = parse(
+                "[1.5,\"x\",1.5,2,true,1.5]");
+            BOOST_TEST(
+                serialize(jv, opts) ==
+                serialize(jv));
+        }
+    }
+
+    void
+    testUnescapedStrings()
+    {
+        // strings produced by the fast-path
+        // parser without escape processing are
+        // copied without re-scanning; the mark
+        // must not survive mutation
+        parse_options opt;
+        opt.full_buffer_fast_path = true;
+
+        auto const roundtrip =
+        [&](string_view s)
+        {
+            value jv1 = parse(s, {}, opt);
+            value jv2 = parse(s);
+            BOOST_TEST(
+                serialize(jv1) == serialize(jv2));
+        };
+
+        roundtrip("\"plain\"");
+        roundtrip("[\"a\",\"esc\\nape\",\"\"]");
+        roundtrip(
+            "{\"k\":\"" +
+            std::string(1000, 'x') + "\"}");
+        roundtrip("[\"quote\\\"q\",\"tab\\tt\"]");
+
+        // mutating a clean string re-enables
+        // escaping on output
+        value jv = parse(
+            "[\"abc\"]", {}, opt);
+        jv.get_array()[0]
+            .get_string()[1] = '\n';
+        BOOST_TEST(serialize(jv) ==
+            "[\"a\\nc\"]");
+        jv = parse("[\"abcdefgh\"]", {}, opt);
+        jv.get_array()[0]
+            .get_string().data()[0] = '"';
+        BOOST_TEST(serialize(jv) ==
+            "[\"\\\"bcdefgh\"]");
+    }
+
     void
     run()
     {
@@ -605,7 +901,12 @@ public:
         testMembers();
         testVectors();
         testOstream();
+        testReadBuffers();
+        testReadInto();
+        testCostBudget();
         testNumberRoundTrips();
+        testDoubleCache();
+        testUnescapedStrings();
     }
 };
 
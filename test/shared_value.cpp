@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/shared_value.hpp>
+
+#include <boost/json/parse.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "test.hpp"
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class shared_value_test
+{
+public:
+    void
+    testMembers()
+    {
+        string_view const js =
+            "{\"k\":[1,2,3],\"s\":\""
+            "a string long enough to "
+            "require a dynamic allocation\"}";
+        value const jv = parse(js);
+
+        // shared_value()
+        {
+            shared_value sv;
+            BOOST_TEST(sv.empty());
+            BOOST_TEST(sv.get() == nullptr);
+        }
+
+        // shared_value(value const&)
+        {
+            shared_value sv(jv);
+            BOOST_TEST(! sv.empty());
+            BOOST_TEST(*sv == jv);
+            BOOST_TEST(sv->at("k") ==
+                jv.at("k"));
+        }
+
+        // copies share the document
+        {
+            shared_value sv1(jv);
+            shared_value sv2(sv1);
+            shared_value sv3;
+            sv3 = sv2;
+            BOOST_TEST(sv2.get() == sv1.get());
+            BOOST_TEST(sv3.get() == sv1.get());
+        }
+
+        // move transfers ownership
+        {
+            shared_value sv1(jv);
+            auto const p = sv1.get();
+            shared_value sv2(std::move(sv1));
+            BOOST_TEST(sv1.empty());
+            BOOST_TEST(sv2.get() == p);
+            shared_value sv3;
+            sv3 = std::move(sv2);
+            BOOST_TEST(sv2.empty());
+            BOOST_TEST(sv3.get() == p);
+        }
+
+        // swap
+        {
+            shared_value sv1(jv);
+            shared_value sv2;
+            auto const p = sv1.get();
+            swap(sv1, sv2);
+            BOOST_TEST(sv1.empty());
+            BOOST_TEST(sv2.get() == p);
+        }
+    }
+
+    void
+    testUnshare()
+    {
+        value const jv = parse(
+            "{\"a\":[1,2,3],\"b\":null}");
+        shared_value const sv(jv);
+
+        // the copy is independent
+        value jv2 = sv.unshare();
+        BOOST_TEST(jv2 == *sv);
+        jv2.as_object()["b"] = 42;
+        BOOST_TEST(jv2 != *sv);
+        BOOST_TEST(*sv == jv);
+
+        // unshare into a caller's resource,
+        // with balanced allocations
+        fail_resource mr;
+        {
+            value const jv3 = sv.unshare(&mr);
+            BOOST_TEST(jv3 == jv);
+            BOOST_TEST(*jv3.storage() == mr);
+        }
+        BOOST_TEST(mr.bytes == 0);
+    }
+
+    void
+    testAtomic()
+    {
+        value const jv1 = parse("[1,2,3]");
+        value const jv2 = parse("{\"a\":1}");
+
+        // load() on an empty slot
+        {
+            atomic_shared_value slot;
+            BOOST_TEST(slot.load().empty());
+        }
+
+        // store() then load()
+        {
+            atomic_shared_value slot;
+            slot.store(shared_value(jv1));
+            shared_value sv = slot.load();
+            BOOST_TEST(*sv == jv1);
+
+            // loads share one document
+            BOOST_TEST(
+                slot.load().get() == sv.get());
+        }
+
+        // atomic_shared_value(shared_value)
+        {
+            shared_value sv(jv1);
+            auto const p = sv.get();
+            atomic_shared_value slot(
+                std::move(sv));
+            BOOST_TEST(slot.load().get() == p);
+        }
+
+        // exchange() returns the old document,
+        // and outstanding handles survive
+        // replacement
+        {
+            atomic_shared_value slot{
+                shared_value(jv1)};
+            shared_value sv = slot.load();
+            shared_value old = slot.exchange(
+                shared_value(jv2));
+            BOOST_TEST(old.get() == sv.get());
+            BOOST_TEST(*sv == jv1);
+            BOOST_TEST(*slot.load() == jv2);
+        }
+
+        // concurrent readers while the
+        // document is replaced
+        {
+            atomic_shared_value slot{
+                shared_value(jv1)};
+            std::atomic<bool> done{false};
+            std::thread readers[4];
+            bool ok[4];
+            for(int k = 0; k < 4; ++k)
+                readers[k] = std::thread(
+                    [&, k]{
+                    bool good = true;
+                    while(! done.load())
+                    {
+                        shared_value sv =
+                            slot.load();
+                        good = good && (
+                            *sv == jv1 ||
+                            *sv == jv2);
+                    }
+                    ok[k] = good;
+                });
+            for(int n = 0; n < 1000; ++n)
+                slot.store(shared_value(
+                    (n & 1) ? jv2 : jv1));
+            done = true;
+            for(int k = 0; k < 4; ++k)
+            {
+                readers[k].join();
+                BOOST_TEST(ok[k]);
+            }
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testUnshare();
+        testAtomic();
+    }
+};
+
+TEST_SUITE(shared_value_test, "boost.json.shared_value");
+
+} // namespace json
+} // namespace boost
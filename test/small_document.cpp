@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/small_document.hpp>
+
+#include <boost/json/serialize.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class small_document_test
+{
+public:
+    void
+    testParse()
+    {
+        small_document<4096> doc;
+        BOOST_TEST(doc.root().is_null());
+
+        // values land in the inline arena
+        error_code ec;
+        value const& jv = doc.parse(
+            "{\"op\":\"set\",\"seq\":42,"
+            "\"args\":[1,2.5,null,true]}", ec);
+        BOOST_TEST(! ec.failed());
+        BOOST_TEST(&jv == &doc.root());
+        BOOST_TEST(
+            *jv.storage() == *doc.storage());
+        BOOST_TEST(*jv.at("args").storage() ==
+            *doc.storage());
+        BOOST_TEST(
+            jv.at("seq").as_int64() == 42);
+
+        // reuse reclaims the arena
+        for(int i = 0; i < 1000; ++i)
+        {
+            value const& jv2 = doc.parse(
+                "[\"abcdefghijklmnopqrstuvwxyz\","
+                "1,2,3]", ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(
+                jv2.as_array().size() == 4);
+        }
+
+        // errors leave a null root
+        doc.parse("{\"a\":", ec);
+        BOOST_TEST(ec.failed());
+        BOOST_TEST(doc.root().is_null());
+
+        // std::error_code and throwing overloads
+        std::error_code sec;
+        doc.parse("[1]", sec);
+        BOOST_TEST(! sec);
+        BOOST_TEST(
+            doc.parse("[2]") == array{2});
+        BOOST_TEST_THROWS(
+            doc.parse("}"), system_error);
+
+        // clear
+        doc.parse("[3]", ec);
+        doc.clear();
+        BOOST_TEST(doc.root().is_null());
+    }
+
+    void
+    testFailover()
+    {
+        // documents larger than the inline
+        // buffer still parse correctly
+        small_document<64> doc;
+        std::string s = "[";
+        for(int i = 0; i < 1000; ++i)
+        {
+            if(i > 0)
+                s += ',';
+            s += std::to_string(i);
+        }
+        s += "]";
+        error_code ec;
+        value const& jv = doc.parse(s, ec);
+        BOOST_TEST(! ec.failed());
+        BOOST_TEST(
+            jv.as_array().size() == 1000);
+        BOOST_TEST(serialize(jv) == s);
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testFailover();
+    }
+};
+
+TEST_SUITE(small_document_test,
+    "boost.json.small_document");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/snapshot.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class snapshot_test
+{
+public:
+    static
+    std::string
+    save(value const& jv)
+    {
+        std::ostringstream os;
+        save_snapshot(jv, os);
+        return os.str();
+    }
+
+    void
+    checkRoundTrip(string_view js)
+    {
+        value const jv = parse(js);
+        std::string const b = save(jv);
+        error_code ec;
+        value const jv2 = load_snapshot(b, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv2 == jv);
+    }
+
+    void
+    testRoundTrip()
+    {
+        checkRoundTrip("null");
+        checkRoundTrip("true");
+        checkRoundTrip("false");
+        checkRoundTrip("0");
+        checkRoundTrip("-1");
+        checkRoundTrip("9223372036854775807");
+        checkRoundTrip("18446744073709551615");
+        checkRoundTrip("1.5");
+        checkRoundTrip("-2.75e10");
+        checkRoundTrip("\"\"");
+        checkRoundTrip("\"hello\"");
+        checkRoundTrip("[]");
+        checkRoundTrip("{}");
+        checkRoundTrip("[1,[2,[3]],\"x\"]");
+        checkRoundTrip(
+            "{\"a\":1,\"b\":[true,null],"
+            "\"c\":{\"d\":\"e\"}}");
+    }
+
+    void
+    testErrors()
+    {
+        value const jv = parse(
+            "{\"a\":[1,\"x\"],\"b\":2}");
+        std::string const b = save(jv);
+        error_code ec;
+
+        // a valid image loads
+        load_snapshot(b, ec);
+        BOOST_TEST(! ec);
+
+        // bad magic, version, or endianness
+        std::string bad = b;
+        bad[0] = 'X';
+        load_snapshot(bad, ec);
+        BOOST_TEST(ec == error::syntax);
+        bad = b;
+        bad[4] = 99;
+        load_snapshot(bad, ec);
+        BOOST_TEST(ec == error::syntax);
+        bad = b;
+        bad[5] = static_cast<char>(
+            3 - static_cast<
+                unsigned char>(bad[5]));
+        load_snapshot(bad, ec);
+        BOOST_TEST(ec == error::syntax);
+
+        // truncation at every byte
+        for(std::size_t n = 0;
+            n < b.size(); ++n)
+        {
+            load_snapshot(
+                string_view(b.data(), n), ec);
+            BOOST_TEST(ec);
+        }
+
+        // trailing data
+        bad = b;
+        bad.push_back(0);
+        load_snapshot(bad, ec);
+        BOOST_TEST(ec == error::extra_data);
+
+        // unknown tag
+        bad = b;
+        bad[8] = 99;
+        load_snapshot(bad, ec);
+        BOOST_TEST(ec == error::syntax);
+
+        BOOST_TEST_THROWS(
+            load_snapshot("BJSN"),
+            system_error);
+    }
+
+    void
+    testStorage()
+    {
+        error_code ec;
+        monotonic_resource mr;
+        value const jv = load_snapshot(
+            save(parse("{\"a\":[1,2]}")),
+            ec, &mr);
+        BOOST_TEST(! ec);
+        BOOST_TEST(jv.storage().get() == &mr);
+    }
+
+    void
+    run()
+    {
+        testRoundTrip();
+        testErrors();
+        testStorage();
+    }
+};
+
+TEST_SUITE(snapshot_test, "boost.json.snapshot");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/sorted_view.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/value.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class sorted_view_test
+{
+public:
+    void
+    testMembers()
+    {
+        // default constructed view is empty
+        {
+            sorted_view sv;
+            BOOST_TEST(sv.empty());
+            BOOST_TEST(sv.size() == 0);
+            BOOST_TEST(
+                sv.begin() == sv.end());
+            BOOST_TEST(
+                sv.find("a") == sv.end());
+            BOOST_TEST(! sv.contains("a"));
+            auto const r =
+                sv.prefix_range("a");
+            BOOST_TEST(r.first == r.second);
+        }
+
+        // insertion order does not matter
+        object obj;
+        obj["c"] = 3;
+        obj["a"] = 1;
+        obj["d"] = 4;
+        obj["b"] = 2;
+        sorted_view sv(obj);
+        BOOST_TEST(sv.size() == 4);
+        BOOST_TEST(std::is_sorted(
+            sv.begin(), sv.end(),
+            [](key_value_pair const& lhs,
+                key_value_pair const& rhs)
+            {
+                return lhs.key() < rhs.key();
+            }));
+        BOOST_TEST(
+            sv.begin()->key() == "a");
+        BOOST_TEST(
+            (sv.end() - 1)->key() == "d");
+
+        // elements are the object's own,
+        // not copies
+        BOOST_TEST(
+            &sv.find("c")->value() ==
+            &obj.at("c"));
+
+        // random access iteration
+        auto it = sv.begin();
+        BOOST_TEST(it[2].key() == "c");
+        it += 3;
+        BOOST_TEST(it->key() == "d");
+        BOOST_TEST(it - sv.begin() == 3);
+        --it;
+        BOOST_TEST(it->key() == "c");
+    }
+
+    void
+    testSearch()
+    {
+        object obj;
+        obj["b"] = 1;
+        obj["d"] = 2;
+        obj["f"] = 3;
+        sorted_view sv(obj);
+
+        BOOST_TEST(
+            sv.find("d")->value() == 2);
+        BOOST_TEST(
+            sv.find("a") == sv.end());
+        BOOST_TEST(
+            sv.find("c") == sv.end());
+        BOOST_TEST(
+            sv.find("g") == sv.end());
+        BOOST_TEST(sv.contains("b"));
+        BOOST_TEST(! sv.contains("e"));
+
+        // lower_bound lands on the key or
+        // the next greater one
+        BOOST_TEST(
+            sv.lower_bound("a")->key() == "b");
+        BOOST_TEST(
+            sv.lower_bound("d")->key() == "d");
+        BOOST_TEST(
+            sv.lower_bound("e")->key() == "f");
+        BOOST_TEST(
+            sv.lower_bound("g") == sv.end());
+
+        // upper_bound always passes the key
+        BOOST_TEST(
+            sv.upper_bound("d")->key() == "f");
+        BOOST_TEST(
+            sv.upper_bound("f") == sv.end());
+
+        auto const r = sv.equal_range("d");
+        BOOST_TEST(
+            r.second - r.first == 1);
+        BOOST_TEST(r.first->key() == "d");
+        auto const r2 = sv.equal_range("c");
+        BOOST_TEST(r2.first == r2.second);
+
+        // exhaustive check against every
+        // key of a larger object
+        object big;
+        for(int i = 0; i < 1000; ++i)
+            big["k" + std::to_string(
+                1000 + i)] = i;
+        sorted_view bv(big);
+        BOOST_TEST(bv.size() == 1000);
+        for(int i = 0; i < 1000; ++i)
+        {
+            auto const key = "k" +
+                std::to_string(1000 + i);
+            auto const found =
+                bv.find(key);
+            BOOST_TEST(found != bv.end());
+            BOOST_TEST(
+                found->value() == i);
+        }
+    }
+
+    void
+    testPrefixRange()
+    {
+        // time-bucketed keys, the motivating
+        // shape for range queries
+        object obj;
+        obj["2024-01-14T23:59"] = 0;
+        obj["2024-01-15T00:00"] = 1;
+        obj["2024-01-15T12:30"] = 2;
+        obj["2024-01-15T23:45"] = 3;
+        obj["2024-01-16T00:15"] = 4;
+        sorted_view sv(obj);
+
+        auto r = sv.prefix_range("2024-01-15");
+        BOOST_TEST(r.second - r.first == 3);
+        for(auto it = r.first;
+            it != r.second; ++it)
+            BOOST_TEST(it->key().substr(
+                0, 10) == "2024-01-15");
+
+        // a full key is its own prefix
+        r = sv.prefix_range(
+            "2024-01-15T12:30");
+        BOOST_TEST(r.second - r.first == 1);
+        BOOST_TEST(r.first->value() == 2);
+
+        // no matches yields an empty range
+        // positioned at the insertion point
+        r = sv.prefix_range("2023");
+        BOOST_TEST(r.first == r.second);
+        BOOST_TEST(r.first == sv.begin());
+        r = sv.prefix_range("2025");
+        BOOST_TEST(r.first == r.second);
+        BOOST_TEST(r.first == sv.end());
+
+        // the empty prefix matches all
+        r = sv.prefix_range("");
+        BOOST_TEST(r.first == sv.begin());
+        BOOST_TEST(r.second == sv.end());
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testSearch();
+        testPrefixRange();
+    }
+};
+
+TEST_SUITE(sorted_view_test, "boost.json.sorted_view");
+
+} // namespace json
+} // namespace boost
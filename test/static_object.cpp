@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/static_object.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class static_object_test
+{
+public:
+    struct person_schema
+    {
+        static constexpr std::size_t count = 3;
+
+        static
+        string_view
+        key(std::size_t i) noexcept
+        {
+            static constexpr char const* k[] = {
+                "id", "name", "email" };
+            return k[i];
+        }
+    };
+
+    using person = static_object<person_schema>;
+
+    // fourteen keys, matching the shape of
+    // the production schemas
+    struct wide_schema
+    {
+        static constexpr std::size_t count = 14;
+
+        static
+        string_view
+        key(std::size_t i) noexcept
+        {
+            static constexpr char const* k[] = {
+                "a", "ab", "abc", "b", "ba",
+                "key", "key2", "value", "values",
+                "x", "xx", "xxx", "y", "z" };
+            return k[i];
+        }
+    };
+
+    void
+    testLookup()
+    {
+        // every key maps to its own index,
+        // and misses return npos
+        BOOST_TEST(
+            person::index_of("id") == 0);
+        BOOST_TEST(
+            person::index_of("name") == 1);
+        BOOST_TEST(
+            person::index_of("email") == 2);
+        BOOST_TEST(
+            person::index_of("") ==
+                person::npos);
+        BOOST_TEST(
+            person::index_of("nam") ==
+                person::npos);
+        BOOST_TEST(
+            person::index_of("names") ==
+                person::npos);
+
+        using wide = static_object<wide_schema>;
+        for(std::size_t i = 0;
+            i < wide::size(); ++i)
+            BOOST_TEST(wide::index_of(
+                wide::key(i)) == i);
+        BOOST_TEST(wide::index_of("nope") ==
+            wide::npos);
+    }
+
+    void
+    testMembers()
+    {
+        person p;
+        BOOST_TEST(p.size() == 3);
+        BOOST_TEST(p.at("id").is_null());
+
+        p.at("id") = 42;
+        p.at("name") = "John Doe";
+        BOOST_TEST(
+            p.item(0).as_int64() == 42);
+        BOOST_TEST(
+            p.if_contains("name") != nullptr);
+        BOOST_TEST(
+            p.if_contains("nope") == nullptr);
+        BOOST_TEST_THROWS(
+            p.at("nope"), system_error);
+
+        person const& cp = p;
+        BOOST_TEST(
+            cp.at("id").as_int64() == 42);
+        BOOST_TEST(
+            cp.if_contains("email") != nullptr);
+        BOOST_TEST(cp.item(2).is_null());
+    }
+
+    void
+    testConversion()
+    {
+        person p;
+        p.at("id") = 42;
+        p.at("name") = "John Doe";
+        BOOST_TEST(
+            serialize(p.to_object()) ==
+            "{\"id\":42,\"name\":\"John Doe\","
+            "\"email\":null}");
+
+        // round trip through object;
+        // unknown keys are ignored
+        auto const jv = parse(
+            "{\"email\":\"jd@example.com\","
+            "\"id\":7,\"extra\":true}");
+        p.assign(jv.as_object());
+        BOOST_TEST(
+            p.at("id").as_int64() == 7);
+        BOOST_TEST(p.at("name").is_null());
+        BOOST_TEST(p.at("email") ==
+            "jd@example.com");
+    }
+
+    void
+    testStorage()
+    {
+        // members and conversions use the
+        // given resource
+        monotonic_resource mr;
+        person p{storage_ptr(&mr)};
+        BOOST_TEST(
+            *p.at("id").storage() == mr);
+        p.at("name") = "John Doe";
+        BOOST_TEST(
+            *p.at("name").storage() == mr);
+        auto const obj =
+            p.to_object(storage_ptr(&mr));
+        BOOST_TEST(*obj.storage() == mr);
+    }
+
+    void
+    run()
+    {
+        testLookup();
+        testMembers();
+        testConversion();
+        testStorage();
+    }
+};
+
+TEST_SUITE(static_object_test,
+    "boost.json.static_object");
+
+} // namespace json
+} // namespace boost
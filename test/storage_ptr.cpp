@@ -10,6 +10,9 @@
 // Test that header file is self-contained.
 #include <boost/json/storage_ptr.hpp>
 
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+
 #include <type_traits>
 
 #include "test.hpp"
@@ -28,6 +31,58 @@ namespace json {
 BOOST_STATIC_ASSERT(
     std::is_nothrow_move_constructible<storage_ptr>::value);
 
+// counts deallocate calls while drawing
+// storage from an arena, so that skipped
+// no-op deallocations are observable. the
+// count lives outside the resource, which
+// may only be reachable through the shared
+// wrapper returned by make_shared_resource.
+struct counting_arena_resource final
+    : memory_resource
+{
+    monotonic_resource mr;
+    std::size_t& deallocs;
+
+    explicit
+    counting_arena_resource(
+        std::size_t& n) noexcept
+        : deallocs(n)
+    {
+    }
+
+    void*
+    do_allocate(
+        std::size_t n,
+        std::size_t align) override
+    {
+        return mr.allocate(n, align);
+    }
+
+    void
+    do_deallocate(
+        void*,
+        std::size_t,
+        std::size_t) noexcept override
+    {
+        ++deallocs;
+    }
+
+    bool
+    do_is_equal(
+        memory_resource const& other
+            ) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+template<>
+struct is_deallocate_trivial<
+    counting_arena_resource >
+{
+    static constexpr bool value = true;
+};
+
 class storage_ptr_test
 {
 public:
@@ -143,6 +198,55 @@ public:
         }
     }
 
+    void
+    testUnsync()
+    {
+        // counts destructions, to verify the
+        // unsynchronized count releases once
+        struct counted
+            : unique_resource
+        {
+            int* pn;
+
+            explicit
+            counted(int* pn_) noexcept
+                : pn(pn_)
+            {
+            }
+
+            ~counted()
+            {
+                ++*pn;
+            }
+        };
+
+        int n = 0;
+        {
+            auto sp = make_shared_resource_unsync<
+                counted>(&n);
+            BOOST_TEST(sp.is_shared());
+
+            // copies share the count
+            storage_ptr sp2(sp);
+            storage_ptr sp3;
+            sp3 = sp2;
+            storage_ptr sp4(std::move(sp2));
+            BOOST_TEST(sp4 == sp);
+
+            // allocation goes through the resource
+            auto const p = sp->allocate(100, 8);
+            sp->deallocate(p, 100, 8);
+
+            BOOST_TEST(n == 0);
+        }
+        BOOST_TEST(n == 1);
+
+        // exception in construction
+        BOOST_TEST_THROWS(
+            make_shared_resource_unsync<throwing>(),
+            std::exception);
+    }
+
     // https://github.com/boostorg/json/pull/182
     void
     testPull182()
@@ -192,14 +296,45 @@ public:
         BOOST_TEST(! jv1.storage().is_shared());
     }
 
+    void
+    testTrivialTeardown()
+    {
+        // destroying a tree held by a
+        // resource with trivial deallocate
+        // issues no deallocate calls, even
+        // when ownership is shared
+        std::size_t deallocs = 0;
+        auto sp = make_shared_resource<
+            counting_arena_resource>(deallocs);
+        BOOST_TEST(sp.is_shared());
+        BOOST_TEST(
+            sp.is_deallocate_trivial());
+        std::size_t n;
+        {
+            value jv = parse(
+                "{\"a key long enough to "
+                "allocate\":[\"a string long "
+                "enough to allocate\","
+                "1,2,3],\"b\":{\"c\":null}}",
+                sp);
+            // the parser may release
+            // temporary buffers; only the
+            // teardown walk is measured
+            n = deallocs;
+        }
+        BOOST_TEST(deallocs == n);
+    }
+
     void
     run()
     {
         storage_ptr sp;
 
         testMembers();
+        testUnsync();
         testPull182();
         testInitOrder();
+        testTrivialTeardown();
     }
 };
 
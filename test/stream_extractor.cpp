@@ -0,0 +1,277 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/stream_extractor.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class stream_extractor_test
+{
+public:
+    struct collector
+    {
+        std::vector<std::pair<
+            std::size_t, value>> hits;
+
+        static
+        void
+        on_match(
+            void* user,
+            std::size_t path,
+            value const& jv)
+        {
+            static_cast<collector*>(
+                user)->hits.emplace_back(
+                    path, jv);
+        }
+    };
+
+    // extract `ptrs` from `doc`, feeding the
+    // input in chunks of the given size
+    std::vector<std::pair<std::size_t, value>>
+    extract(
+        string_view doc,
+        std::vector<string_view> const& ptrs,
+        std::size_t chunk = 0)
+    {
+        stream_extractor ex;
+        for(auto const p : ptrs)
+            ex.add_pointer(p);
+        collector c;
+        ex.reset(&collector::on_match, &c);
+        error_code ec;
+        if(chunk == 0)
+            chunk = doc.size();
+        for(std::size_t i = 0;
+            i < doc.size(); i += chunk)
+        {
+            ex.write(doc.substr(
+                i, chunk), ec);
+            if(! BOOST_TEST(! ec))
+                return c.hits;
+        }
+        ex.finish(ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(ex.done());
+        return c.hits;
+    }
+
+    void
+    testExtract()
+    {
+        string_view const doc =
+            "{\"user\":{\"id\":42,\"name\":\"John Doe\","
+            "\"tags\":[\"a\",\"b\",\"c\"]},"
+            "\"status\":\"active\",\"ratio\":0.5,"
+            "\"flag\":true,\"extra\":{\"deep\":"
+            "[{\"k\":1},{\"k\":2}]}}";
+
+        // every chunk size gives the same hits
+        for(std::size_t chunk :
+            { std::size_t(0), std::size_t(1),
+              std::size_t(3), std::size_t(7) })
+        {
+            auto const hits = extract(doc,
+                { "/user/id", "/status",
+                  "/user/tags/1", "/ratio",
+                  "/flag", "/extra/deep/1/k",
+                  "/missing" }, chunk);
+            if(! BOOST_TEST(hits.size() == 6))
+                continue;
+            BOOST_TEST(hits[0].first == 0);
+            BOOST_TEST(hits[0].second == value(42));
+            BOOST_TEST(hits[1].first == 2);
+            BOOST_TEST(hits[1].second == value("b"));
+            BOOST_TEST(hits[2].first == 1);
+            BOOST_TEST(hits[2].second == value("active"));
+            BOOST_TEST(hits[3].first == 3);
+            BOOST_TEST(hits[3].second == value(0.5));
+            BOOST_TEST(hits[4].first == 4);
+            BOOST_TEST(hits[4].second == value(true));
+            BOOST_TEST(hits[5].first == 5);
+            BOOST_TEST(hits[5].second == value(2));
+        }
+
+        // escaped tokens and escaped keys
+        {
+            auto const hits = extract(
+                "{\"a/b\":1,\"m~n\":2,"
+                "\"sp\\u0061ce\":3}",
+                { "/a~1b", "/m~0n", "/space" });
+            if(BOOST_TEST(hits.size() == 3))
+            {
+                BOOST_TEST(hits[0].second == value(1));
+                BOOST_TEST(hits[1].second == value(2));
+                BOOST_TEST(hits[2].second == value(3));
+            }
+        }
+
+        // a digit token matches an array index
+        // and an object key alike
+        {
+            auto const hits = extract(
+                "{\"a\":[10,20],\"b\":{\"1\":30}}",
+                { "/a/1", "/b/1" });
+            if(BOOST_TEST(hits.size() == 2))
+            {
+                BOOST_TEST(hits[0].second == value(20));
+                BOOST_TEST(hits[1].second == value(30));
+            }
+        }
+
+        // the empty pointer names a scalar root
+        {
+            auto const hits =
+                extract("42", { "" });
+            if(BOOST_TEST(hits.size() == 1))
+                BOOST_TEST(
+                    hits[0].second == value(42));
+        }
+
+        // a pointer naming a container
+        // reports nothing
+        {
+            auto const hits = extract(
+                "{\"a\":[1,2]}", { "/a" });
+            BOOST_TEST(hits.empty());
+        }
+
+        // null leaves are delivered
+        {
+            auto const hits = extract(
+                "{\"a\":null}", { "/a" });
+            if(BOOST_TEST(hits.size() == 1))
+                BOOST_TEST(
+                    hits[0].second.is_null());
+        }
+
+        // the same leaf may satisfy
+        // several pointers
+        {
+            auto const hits = extract(
+                "{\"a\":7}", { "/a", "/a" });
+            BOOST_TEST(hits.size() == 2);
+        }
+    }
+
+    void
+    testSkipping()
+    {
+        // siblings of the matched path are
+        // skipped without affecting indices
+        // or later matches
+        std::string doc = "[";
+        for(int i = 0; i < 100; ++i)
+        {
+            if(i > 0)
+                doc += ',';
+            doc += "{\"pad\":[[[1,2,3]]],\"v\":";
+            doc += std::to_string(i);
+            doc += '}';
+        }
+        doc += ']';
+        auto const hits = extract(doc,
+            { "/0/v", "/50/v", "/99/v" }, 11);
+        if(BOOST_TEST(hits.size() == 3))
+        {
+            BOOST_TEST(hits[0].second == value(0));
+            BOOST_TEST(hits[1].second == value(50));
+            BOOST_TEST(hits[2].second == value(99));
+        }
+    }
+
+    void
+    testErrors()
+    {
+        // invalid pointers are rejected
+        // at registration
+        {
+            stream_extractor ex;
+            BOOST_TEST_THROWS(
+                ex.add_pointer("x"),
+                system_error);
+            BOOST_TEST_THROWS(
+                ex.add_pointer("/a~2"),
+                system_error);
+            BOOST_TEST_THROWS(
+                ex.add_pointer("/a~"),
+                system_error);
+        }
+
+        // malformed documents fail
+        {
+            stream_extractor ex;
+            ex.add_pointer("/a");
+            collector c;
+            ex.reset(&collector::on_match, &c);
+            error_code ec;
+            ex.write("{\"a\":1]", ec);
+            BOOST_TEST(ec);
+        }
+
+        // trailing characters fail
+        {
+            stream_extractor ex;
+            ex.add_pointer("/a");
+            collector c;
+            ex.reset(&collector::on_match, &c);
+            error_code ec;
+            ex.write("{\"a\":1} x", ec);
+            BOOST_TEST(
+                ec == error::extra_data);
+        }
+    }
+
+    void
+    testReset()
+    {
+        stream_extractor ex;
+        ex.add_pointer("/a");
+        for(int i = 0; i < 3; ++i)
+        {
+            collector c;
+            ex.reset(&collector::on_match, &c);
+            error_code ec;
+            ex.write("{\"a\":", ec);
+            BOOST_TEST(! ec);
+            ex.write(std::to_string(i), ec);
+            BOOST_TEST(! ec);
+            ex.write("}", ec);
+            BOOST_TEST(! ec);
+            ex.finish(ec);
+            BOOST_TEST(! ec);
+            if(BOOST_TEST(c.hits.size() == 1))
+                BOOST_TEST(c.hits[0].second
+                    == value(i));
+        }
+    }
+
+    void
+    run()
+    {
+        testExtract();
+        testSkipping();
+        testErrors();
+        testReset();
+    }
+};
+
+TEST_SUITE(stream_extractor_test, "boost.json.stream_extractor");
+
+} // namespace json
+} // namespace boost
@@ -15,6 +15,7 @@
 #include <boost/json/parse.hpp>
 #include <boost/json/serialize.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <iostream>
 #include <cstring>
@@ -1207,6 +1208,115 @@ R"xx({
         }
     }
 
+    void
+    testBlobs()
+    {
+        struct sink
+        {
+            std::string text;
+            std::size_t chunks = 0;
+            std::size_t completions = 0;
+
+            static
+            void
+            append(
+                void* user,
+                string_view chunk,
+                bool done)
+            {
+                auto& self =
+                    *static_cast<sink*>(user);
+                self.text.append(
+                    chunk.data(), chunk.size());
+                ++self.chunks;
+                if(done)
+                    ++self.completions;
+            }
+        };
+
+        string_view const keys[] =
+            { "data", "thumb" };
+        sink sk;
+        parse_options opt;
+        opt.on_blob = &sink::append;
+        opt.blob_user = &sk;
+        opt.blob_keys = keys;
+        opt.blob_keys_count = 2;
+
+        // designated members are streamed in
+        // chunks and built as null; everything
+        // else is unaffected
+        {
+            stream_parser p(
+                storage_ptr(), opt);
+            string_view doc =
+                R"({"id":7,"data":"QUJDRA==","other":"kept"})";
+            error_code ec;
+            // one character at a time, so the
+            // key and the blob arrive split
+            for(char const& c : doc)
+                p.write(&c, 1, ec);
+            p.finish(ec);
+            BOOST_TEST(! ec);
+            value jv = p.release();
+            BOOST_TEST(sk.text == "QUJDRA==");
+            BOOST_TEST(sk.completions == 1);
+            BOOST_TEST(sk.chunks > 1);
+            object& jo = jv.as_object();
+            BOOST_TEST(jo.at("data").is_null());
+            BOOST_TEST(jo.at("other").as_string() == "kept");
+            BOOST_TEST(jo.at("id").as_int64() == 7);
+        }
+
+        // escapes are delivered unescaped,
+        // and both designated keys stream
+        {
+            sk = {};
+            stream_parser p(
+                storage_ptr(), opt);
+            p.write(
+                R"({"data":"AA\nBB","thumb":"QQ"})");
+            p.finish();
+            value jv = p.release();
+            BOOST_TEST(sk.text == "AA\nBBQQ");
+            BOOST_TEST(sk.completions == 2);
+            BOOST_TEST(jv.at("data").is_null());
+            BOOST_TEST(jv.at("thumb").is_null());
+        }
+
+        // designated members holding other
+        // types are built normally, including
+        // strings nested below them
+        {
+            sk = {};
+            stream_parser p(
+                storage_ptr(), opt);
+            p.write(
+                R"({"data":[1,"kept"],"thumb":42})");
+            p.finish();
+            value jv = p.release();
+            BOOST_TEST(sk.chunks == 0);
+            BOOST_TEST(
+                jv.at("data").at(1).as_string() == "kept");
+            BOOST_TEST(
+                jv.at("thumb").as_int64() == 42);
+        }
+
+        // the parse free function does not
+        // take the fast path when a blob
+        // callback is installed
+        {
+            sk = {};
+            parse_options o2 = opt;
+            o2.full_buffer_fast_path = true;
+            value jv = parse(
+                R"({"data":"zzzz"})",
+                storage_ptr(), o2);
+            BOOST_TEST(sk.text == "zzzz");
+            BOOST_TEST(jv.at("data").is_null());
+        }
+    }
+
     //------------------------------------------------------
 
     // https://github.com/boostorg/json/issues/15
@@ -1373,6 +1483,497 @@ R"xx({
 #endif
     }
 
+    void
+    testReserveInput()
+    {
+        string_view const js =
+            "{\"a\":1,\"arr\":[1,2,3,\"xyz\"],"
+            "\"b\":{\"k\":null,\"t\":true}}";
+        value const jv = parse(js);
+
+        // byte-at-a-time writes are coalesced
+        // and produce the same value
+        for(std::size_t cap :
+            { std::size_t(1), std::size_t(7),
+              std::size_t(16), std::size_t(4096) })
+        {
+            stream_parser p;
+            p.reserve_input(cap);
+            for(char const c : js)
+                BOOST_TEST(p.write(&c, 1) == 1);
+            p.finish();
+            BOOST_TEST(p.release() == jv);
+        }
+
+        // writes at least as large as the buffer
+        // bypass it when the buffer is empty
+        {
+            stream_parser p;
+            p.reserve_input(8);
+            BOOST_TEST(p.write(js) == js.size());
+            p.finish();
+            BOOST_TEST(p.release() == jv);
+        }
+
+        // extra data surfaces when the
+        // buffer is flushed
+        {
+            stream_parser p;
+            p.reserve_input(4096);
+            error_code ec;
+            BOOST_TEST(
+                p.write("null x", 6, ec) == 6);
+            BOOST_TEST(! ec);
+            p.finish(ec);
+            BOOST_TEST(ec == error::extra_data);
+        }
+
+        // incomplete documents still fail
+        {
+            stream_parser p;
+            p.reserve_input(4096);
+            error_code ec;
+            p.write("[1,", 3, ec);
+            BOOST_TEST(! ec);
+            p.finish(ec);
+            BOOST_TEST(ec == error::incomplete);
+        }
+
+        // disabling buffering parses pending
+        // characters on the next write
+        {
+            stream_parser p;
+            p.reserve_input(4096);
+            p.write("[1,2");
+            p.reserve_input(0);
+            p.write(",3]");
+            BOOST_TEST(p.done());
+            BOOST_TEST(
+                p.release() == parse("[1,2,3]"));
+        }
+
+        // reset discards buffered characters
+        // but keeps the capacity
+        {
+            stream_parser p;
+            p.reserve_input(64);
+            p.write("[true");
+            p.reset();
+            p.write("[false]");
+            p.finish();
+            BOOST_TEST(
+                p.release() == parse("[false]"));
+        }
+
+        // release flushes buffered characters
+        {
+            stream_parser p;
+            p.reserve_input(64);
+            p.write("42");
+            BOOST_TEST(p.release() == value(42));
+        }
+
+        // shrink_to_fit discards buffered input
+        // and leaves the parser usable
+        {
+            stream_parser p;
+            p.reserve_input(64);
+            p.write("[1,");
+            p.shrink_to_fit();
+            p.write("[2]");
+            p.finish();
+            BOOST_TEST(
+                p.release() == parse("[2]"));
+        }
+    }
+
+    void
+    testWriteBuffers()
+    {
+        string_view const js =
+            "{\"a\":1,\"arr\":[1,2,3,\"xyz\"],"
+            "\"b\":{\"k\":null,\"t\":true}}";
+        value const jv = parse(js);
+
+        // a chain parses like the
+        // concatenation of its buffers
+        {
+            string_view const bufs[] = {
+                js.substr(0, 9),
+                js.substr(9, 13),
+                js.substr(22) };
+            stream_parser p;
+            BOOST_TEST(
+                p.write(bufs, 3) == js.size());
+            p.finish();
+            BOOST_TEST(p.release() == jv);
+        }
+
+        // tokens may straddle the seams
+        {
+            string_view const bufs[] = {
+                "[\"ab", "cd\",12", "34,tr", "ue]" };
+            stream_parser p;
+            error_code ec;
+            p.write(bufs, 4, ec);
+            BOOST_TEST(! ec);
+            p.finish(ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(p.release() ==
+                parse("[\"abcd\",1234,true]"));
+        }
+
+        // empty buffers and an empty
+        // chain are permitted
+        {
+            string_view const bufs[] = {
+                "", "[1]", "" };
+            stream_parser p;
+            BOOST_TEST(p.write(bufs, 3) == 3);
+            stream_parser p2;
+            string_view const* none = nullptr;
+            BOOST_TEST(p2.write(none, 0) == 0);
+        }
+
+        // an error reports the characters
+        // consumed up to the failure
+        {
+            string_view const bufs[] = {
+                "[1,", "2]x", "[3]" };
+            stream_parser p;
+            error_code ec;
+            BOOST_TEST(
+                p.write(bufs, 3, ec) == 5);
+            BOOST_TEST(ec == error::extra_data);
+
+            stream_parser p2;
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                p2.write(bufs, 3));
+        }
+    }
+
+    void
+    testBoundedWork()
+    {
+        // a large buffer is consumed in
+        // slices no bigger than the budget
+        {
+            std::string js = "[";
+            for(int i = 0; i < 1000; ++i)
+            {
+                if(i > 0)
+                    js += ',';
+                js += "{\"k" + std::to_string(i) +
+                    "\":\"v\\n" + std::to_string(i) +
+                    "\"}";
+            }
+            js += ']';
+
+            stream_parser p;
+            error_code ec;
+            std::size_t off = 0;
+            while(off < js.size())
+            {
+                auto const n = p.write_some(
+                    js.data() + off,
+                    js.size() - off, 100, ec);
+                if(! BOOST_TEST(! ec))
+                    break;
+                BOOST_TEST(n <= 100);
+                off += n;
+            }
+            BOOST_TEST(off == js.size());
+            p.finish(ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(p.release() == parse(js));
+        }
+
+        // slices may end mid-token, even
+        // inside an escape sequence
+        {
+            string_view const js =
+                R"(["abcd",12.5e1])";
+            stream_parser p;
+            error_code ec;
+            std::size_t off = 0;
+            while(off < js.size() && ! ec)
+                off += p.write_some(
+                    js.substr(off), 1, ec);
+            BOOST_TEST(! ec);
+            p.finish(ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(p.release() == parse(js));
+        }
+
+        // a zero budget consumes nothing
+        // and is not an error
+        {
+            stream_parser p;
+            error_code ec;
+            BOOST_TEST(p.write_some(
+                "[1]", 3, 0, ec) == 0);
+            BOOST_TEST(! ec);
+        }
+
+        // error and exception overloads
+        {
+            stream_parser p;
+            std::error_code ec;
+            BOOST_TEST(p.write_some(
+                "[1,", 3, 2, ec) == 2);
+            BOOST_TEST(! ec);
+
+            stream_parser p2;
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                p2.write_some("]", 1, 8));
+        }
+    }
+
+    void
+    testErrorOffset()
+    {
+        // no input
+        {
+            stream_parser p;
+            BOOST_TEST(p.error_offset() == 0);
+        }
+
+        // counts consumed bytes
+        {
+            stream_parser p;
+            p.write("[1,2");
+            BOOST_TEST(p.error_offset() == 4);
+            p.write(",3]");
+            BOOST_TEST(p.error_offset() == 7);
+        }
+
+        // offset of the offending byte,
+        // in a single write
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("[1,x]", 5, ec);
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(p.error_offset() == 3);
+        }
+
+        // offset accumulates across writes
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("[1,2,", 5, ec);
+            BOOST_TEST(! ec);
+            p.write("3,x]", 4, ec);
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(p.error_offset() == 7);
+        }
+
+        // the error is sticky and so
+        // is the offset
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("nulx", 4, ec);
+            BOOST_TEST(ec);
+            auto const off = p.error_offset();
+            p.write("null", 4, ec);
+            BOOST_TEST(ec);
+            BOOST_TEST(p.error_offset() == off);
+        }
+
+        // extra data
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("null x", 6, ec);
+            BOOST_TEST(ec == error::extra_data);
+            BOOST_TEST(p.error_offset() == 5);
+        }
+
+        // incomplete points past the input
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("[1,", 3, ec);
+            BOOST_TEST(! ec);
+            p.finish(ec);
+            BOOST_TEST(ec == error::incomplete);
+            BOOST_TEST(p.error_offset() == 3);
+        }
+
+        // buffered input is counted
+        // when it is parsed
+        {
+            stream_parser p;
+            p.reserve_input(4096);
+            error_code ec;
+            p.write("[1,x]", 5, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(p.error_offset() == 0);
+            p.finish(ec);
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(p.error_offset() == 3);
+        }
+
+        // reset clears the offset
+        {
+            stream_parser p;
+            error_code ec;
+            p.write("[x", 2, ec);
+            BOOST_TEST(ec);
+            p.reset();
+            BOOST_TEST(p.error_offset() == 0);
+        }
+    }
+
+    void
+    testStringReserve()
+    {
+        std::string big = "\"";
+        for(int i = 0; i < 8000; ++i)
+            big += "ab\\n";
+        big += "\"";
+        std::string expected;
+        for(int i = 0; i < 8000; ++i)
+            expected += "ab\n";
+
+        // when a whole escaped string is in
+        // the buffer, its storage is grown
+        // exactly once
+        fail_resource mr;
+        {
+            stream_parser p{storage_ptr(&mr)};
+            p.reset();
+            p.write(big);
+            p.finish();
+            value jv = p.release();
+            BOOST_TEST(mr.nalloc == 1);
+            BOOST_TEST(
+                jv.get_string() == expected);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+
+        // a string split across writes falls
+        // back to growing as the parts arrive
+        {
+            stream_parser p{storage_ptr(&mr)};
+            p.reset();
+            p.write(big.data(), big.size() / 2);
+            p.write(
+                big.data() + big.size() / 2,
+                big.size() - big.size() / 2);
+            p.finish();
+            value jv = p.release();
+            BOOST_TEST(
+                jv.get_string() == expected);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+
+        // escaped keys are measured too
+        {
+            std::string doc = "{\"";
+            for(int i = 0; i < 100; ++i)
+                doc += "k\\t";
+            doc += "\":1}";
+            stream_parser p{storage_ptr(&mr)};
+            p.reset();
+            p.write(doc);
+            p.finish();
+            value jv = p.release();
+            std::string key;
+            for(int i = 0; i < 100; ++i)
+                key += "k\t";
+            BOOST_TEST(jv.as_object()
+                .begin()->key() == key);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+    }
+
+    void
+    testCancellation()
+    {
+        std::string big = "[";
+        for(int i = 0; i < 1000; ++i)
+            big += "1,";
+        big += "1]";
+
+        // a set flag stops the parse with
+        // error::canceled
+        {
+            std::atomic<bool> flag{true};
+            stream_parser p;
+            p.cancel_token(&flag);
+            BOOST_TEST(
+                p.cancel_token() == &flag);
+            error_code ec;
+            p.write(big.data(), big.size(), ec);
+            BOOST_TEST(ec == error::canceled);
+            BOOST_TEST(ec == condition::parse_error);
+        }
+
+        // a clear flag costs nothing and
+        // the parse completes normally
+        {
+            std::atomic<bool> flag{false};
+            stream_parser p;
+            p.cancel_token(&flag);
+            p.write(big);
+            p.finish();
+            BOOST_TEST(p.release()
+                .as_array().size() == 1001);
+        }
+
+        // setting the flag between writes
+        // abandons a parse in progress,
+        // and the error is sticky
+        {
+            std::atomic<bool> flag{false};
+            stream_parser p;
+            p.cancel_token(&flag);
+            error_code ec;
+            p.write(big.data(), 10, ec);
+            BOOST_TEST(! ec);
+            flag = true;
+            p.write(big.data() + 10,
+                big.size() - 10, ec);
+            BOOST_TEST(ec == error::canceled);
+            p.write(big.data() + 10,
+                big.size() - 10, ec);
+            BOOST_TEST(ec == error::canceled);
+        }
+
+        // the flag survives reset; clearing
+        // it makes the parser usable again
+        {
+            std::atomic<bool> flag{true};
+            stream_parser p;
+            p.cancel_token(&flag);
+            error_code ec;
+            p.write(big.data(), big.size(), ec);
+            BOOST_TEST(ec == error::canceled);
+            flag = false;
+            p.reset();
+            p.write(big);
+            p.finish();
+            BOOST_TEST(p.release()
+                .as_array().size() == 1001);
+        }
+
+        // removing the token disables
+        // cancellation
+        {
+            std::atomic<bool> flag{true};
+            stream_parser p;
+            p.cancel_token(&flag);
+            p.cancel_token(nullptr);
+            BOOST_TEST(
+                p.cancel_token() == nullptr);
+            p.write(big);
+            p.finish();
+            BOOST_TEST(p.done());
+        }
+    }
+
     //------------------------------------------------------
 
     void
@@ -1394,12 +1995,19 @@ R"xx({
         testTrailingCommas();
         testComments();
         testDupeKeys();
+        testBlobs();
         testIssue15();
         testIssue45();
         testIssue876();
         testSentinelOverlap();
         testSpecialNumbers();
         testLongNumberOverlfow();
+        testReserveInput();
+        testWriteBuffers();
+        testBoundedWork();
+        testErrorOffset();
+        testStringReserve();
+        testCancellation();
     }
 };
 
@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/string_builder.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/tracing_resource.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class string_builder_test
+{
+public:
+    void
+    testJavadocs()
+    {
+    //--------------------------------------
+
+    monotonic_resource mr;
+
+    string_builder sb( &mr );
+
+    for( int i = 0; i < 1000; ++i )
+        sb.append( "segment" );
+
+    string s = sb.release();
+
+    BOOST_TEST( s.size() == 7000 );
+
+    //--------------------------------------
+    }
+
+    void
+    testAppend()
+    {
+        string_builder sb;
+        BOOST_TEST(sb.size() == 0);
+
+        sb.append("hello");
+        sb.push_back(',');
+        sb.push_back(' ');
+        sb.append("world");
+        BOOST_TEST(sb.size() == 12);
+
+        string s = sb.release();
+        BOOST_TEST(s == "hello, world");
+
+        // the builder is reusable
+        // after release
+        BOOST_TEST(sb.size() == 0);
+        sb.append("again");
+        BOOST_TEST(sb.release() == "again");
+
+        // releasing an empty builder
+        // yields an empty string
+        BOOST_TEST(sb.release().empty());
+    }
+
+    void
+    testLarge()
+    {
+        // appends larger than a segment,
+        // and enough of them to chain
+        // several segments
+        string_builder sb;
+        std::string expected;
+        std::string const piece(700, '*');
+        for(int i = 0; i < 100; ++i)
+        {
+            sb.append(piece);
+            expected += piece;
+        }
+        BOOST_TEST(sb.size() ==
+            expected.size());
+        BOOST_TEST(sb.release() ==
+            string_view(expected));
+    }
+
+    void
+    testClear()
+    {
+        string_builder sb;
+        sb.append("discarded");
+        sb.clear();
+        BOOST_TEST(sb.size() == 0);
+        sb.append("kept");
+        BOOST_TEST(sb.release() == "kept");
+    }
+
+    void
+    testArena()
+    {
+        // the destination storage sees
+        // exactly one allocation, of
+        // the final size
+        tracing_resource mr;
+        string_builder sb(&mr);
+        for(int i = 0; i < 200; ++i)
+            sb.append(
+                "a reasonably long piece of text");
+        string const s = sb.release();
+        BOOST_TEST(*s.storage() == mr);
+        tracing_stats const st = mr.stats();
+        BOOST_TEST(st.allocations == 1);
+        BOOST_TEST(st.bytes_allocated >=
+            s.size());
+    }
+
+    void
+    run()
+    {
+        testJavadocs();
+        testAppend();
+        testLarge();
+        testClear();
+        testArena();
+    }
+};
+
+TEST_SUITE(string_builder_test, "boost.json.string_builder");
+
+} // namespace json
+} // namespace boost
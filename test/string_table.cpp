@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/string_table.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/storage_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class string_table_test
+{
+public:
+    void
+    testIntern()
+    {
+        string_table t;
+        BOOST_TEST(t.size() == 0);
+        BOOST_TEST(
+            t.find("BUY").data() == nullptr);
+
+        auto const v1 = t.insert("BUY");
+        BOOST_TEST(v1 == "BUY");
+        BOOST_TEST(v1.data()[v1.size()] == 0);
+        BOOST_TEST(t.size() == 1);
+
+        // repeated content returns the
+        // canonical copy
+        auto const v2 = t.insert("BUY");
+        BOOST_TEST(v2.data() == v1.data());
+        BOOST_TEST(t.size() == 1);
+
+        auto const v3 = t.insert("SELL");
+        BOOST_TEST(v3 == "SELL");
+        BOOST_TEST(v3.data() != v1.data());
+        BOOST_TEST(t.size() == 2);
+
+        BOOST_TEST(
+            t.find("BUY").data() == v1.data());
+        BOOST_TEST(
+            t.find("SELL").data() == v3.data());
+        BOOST_TEST(
+            t.find("HOLD").data() == nullptr);
+
+        // the empty string is a valid entry
+        auto const v4 = t.insert("");
+        BOOST_TEST(v4.size() == 0);
+        BOOST_TEST(v4.data() != nullptr);
+        BOOST_TEST(
+            t.insert("").data() == v4.data());
+        BOOST_TEST(t.size() == 3);
+    }
+
+    void
+    testRehash()
+    {
+        string_table t;
+        std::vector<std::string> keys;
+        std::vector<string_view> views;
+        for(int i = 0; i < 200; ++i)
+        {
+            keys.push_back(
+                "country-code-" +
+                std::to_string(i));
+            views.push_back(
+                t.insert(keys.back()));
+        }
+        BOOST_TEST(t.size() == 200);
+        // interned views are stable across
+        // growth of the bucket array
+        for(int i = 0; i < 200; ++i)
+        {
+            BOOST_TEST(views[i] == keys[i]);
+            BOOST_TEST(t.find(keys[i]).data()
+                == views[i].data());
+        }
+    }
+
+    void
+    testLifetime()
+    {
+        storage_ptr sp;
+        string_view v;
+        {
+            string_table t;
+            v = t.insert(
+                "outlives the table");
+            sp = t.storage();
+        }
+        // the characters live as long as any
+        // copy of the table's storage
+        BOOST_TEST(
+            v == "outlives the table");
+    }
+
+    void
+    testStorage()
+    {
+        monotonic_resource mr;
+        string_table t(&mr);
+        auto const v = t.insert("BUY");
+        BOOST_TEST(v == "BUY");
+        BOOST_TEST(
+            t.insert("BUY").data() == v.data());
+        BOOST_TEST(t.storage().get() == &mr);
+    }
+
+    void
+    run()
+    {
+        testIntern();
+        testRehash();
+        testLifetime();
+        testStorage();
+    }
+};
+
+TEST_SUITE(string_table_test, "boost.json.string_table");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/thread_local_resource.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/storage_ptr.hpp>
+
+#include <thread>
+
+#include "test.hpp"
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class thread_local_resource_test
+{
+public:
+    void
+    testCache()
+    {
+        auto& mr = *get_thread_local_resource();
+        BOOST_TEST(&mr ==
+            get_thread_local_resource());
+
+        // a freed block is reused by the
+        // next allocation of its size class
+        auto const p = mr.allocate(32, 8);
+        mr.deallocate(p, 32, 8);
+        auto const q = mr.allocate(32, 8);
+        BOOST_TEST(q == p);
+        mr.deallocate(q, 32, 8);
+
+        // different sizes in the same class
+        // share cached blocks
+        auto const r = mr.allocate(20, 8);
+        BOOST_TEST(r == p);
+        mr.deallocate(r, 32, 8);
+
+        // large blocks bypass the cache
+        auto const big = mr.allocate(100000, 8);
+        mr.deallocate(big, 100000, 8);
+
+        // a block freed on another thread
+        // enters that thread's cache and is
+        // flushed when the thread exits
+        auto const s = mr.allocate(64, 8);
+        std::thread([&]{
+            mr.deallocate(s, 64, 8);
+        }).join();
+
+        // parsing through the resource
+        // produces the same value
+        string_view const js =
+            "{\"k\":[1,2,3],\"s\":\"abc\"}";
+        value const jv =
+            parse(js, storage_ptr(&mr));
+        BOOST_TEST(jv == parse(js));
+    }
+
+    void
+    testDefaultResource()
+    {
+        BOOST_TEST(json::get_default_resource() ==
+            storage_ptr().get());
+
+        // an installed resource serves
+        // default-constructed storage_ptr
+        fail_resource mr;
+        auto const builtin =
+            json::set_default_resource(&mr);
+        {
+            value const jv = parse("[1,2,3]");
+            BOOST_TEST(mr.bytes > 0);
+            BOOST_TEST((jv == array{1, 2, 3}));
+            BOOST_TEST(
+                storage_ptr().get() == &mr);
+        }
+        auto const prev =
+            json::set_default_resource(nullptr);
+        BOOST_TEST(prev == &mr);
+        BOOST_TEST(
+            json::get_default_resource() == builtin);
+        BOOST_TEST(mr.bytes == 0);
+
+        // the thread-local resource can be
+        // installed as the default
+        json::set_default_resource(
+            get_thread_local_resource());
+        {
+            value const jv = parse("[1,2,3]");
+            BOOST_TEST((jv == array{1, 2, 3}));
+        }
+        json::set_default_resource(nullptr);
+    }
+
+    void
+    run()
+    {
+        testCache();
+        testDefaultResource();
+    }
+};
+
+TEST_SUITE(thread_local_resource_test, "boost.json.thread_local_resource");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/trace.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/stream_parser.hpp>
+
+#include <vector>
+
+#include "test_suite.hpp"
+
+/*
+    This translation unit is compiled with
+    BOOST_JSON_TRACE defined and exercises
+    the tracepoints. Without the macro the
+    tracepoints are inert and none of the
+    expectations below hold, so the whole
+    suite is compiled out.
+*/
+#ifdef BOOST_JSON_TRACE
+
+namespace boost {
+namespace json {
+
+class trace_test
+{
+public:
+    struct event
+    {
+        trace_event ev;
+        void const* subject;
+        std::uint64_t arg;
+    };
+
+    // the hook is a plain function pointer,
+    // so the captured events are static
+    static std::vector<event>& log()
+    {
+        static std::vector<event> v;
+        return v;
+    }
+
+    static
+    void
+    record(
+        trace_event ev,
+        void const* subject,
+        std::uint64_t arg)
+    {
+        log().push_back({ev, subject, arg});
+    }
+
+    static
+    std::size_t
+    count(trace_event ev)
+    {
+        std::size_t n = 0;
+        for(auto const& e : log())
+            if(e.ev == ev)
+                ++n;
+        return n;
+    }
+
+    void
+    testHook()
+    {
+        // installing returns the previous hook
+        BOOST_TEST(
+            set_trace_hook(&record) == nullptr);
+        BOOST_TEST(
+            set_trace_hook(nullptr) == &record);
+
+        // with no hook, tracepoints are inert
+        log().clear();
+        stream_parser p;
+        p.write("[1,2,3]");
+        BOOST_TEST(log().empty());
+    }
+
+    void
+    testParserEvents()
+    {
+        set_trace_hook(&record);
+        log().clear();
+
+        stream_parser p;
+        p.reset();
+        BOOST_TEST(count(
+            trace_event::document_begin) >= 1);
+
+        // one byte at a time suspends at
+        // every boundary and resumes at the
+        // next write
+        std::string const doc = "[1,\"ab\"]";
+        for(char const& c : doc)
+            p.write_some(&c, 1);
+        p.finish();
+        BOOST_TEST(p.done());
+
+        BOOST_TEST(count(
+            trace_event::parser_suspend) > 0);
+        BOOST_TEST(count(
+            trace_event::parser_resume) > 0);
+        BOOST_TEST(count(
+            trace_event::document_end) == 1);
+
+        // the subject identifies the parser,
+        // and the argument reports consumed
+        // bytes
+        for(auto const& e : log())
+        {
+            if(e.ev ==
+                trace_event::document_end)
+            {
+                BOOST_TEST(e.subject == &p);
+                BOOST_TEST(
+                    e.arg == doc.size());
+            }
+        }
+        set_trace_hook(nullptr);
+    }
+
+    void
+    testArenaEvents()
+    {
+        set_trace_hook(&record);
+        log().clear();
+
+        monotonic_resource mr;
+        void* p = mr.allocate(100);
+        BOOST_TEST(p != nullptr);
+        BOOST_TEST(count(
+            trace_event::arena_block) == 1);
+        if(BOOST_TEST(! log().empty()))
+        {
+            BOOST_TEST(
+                log().front().subject == &mr);
+            BOOST_TEST(
+                log().front().arg >= 100);
+
+            // exhausting the block reports
+            // the next one
+            mr.allocate(log().front().arg);
+            BOOST_TEST(count(
+                trace_event::arena_block) == 2);
+        }
+        set_trace_hook(nullptr);
+    }
+
+    void
+    run()
+    {
+        testHook();
+        testParserEvents();
+        testArenaEvents();
+    }
+};
+
+TEST_SUITE(trace_test, "boost.json.trace");
+
+} // namespace json
+} // namespace boost
+
+#endif // BOOST_JSON_TRACE
@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2020 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/tracing_resource.hpp>
+
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+BOOST_STATIC_ASSERT( std::is_nothrow_destructible<tracing_resource>::value );
+
+class tracing_resource_test
+{
+public:
+    void
+    testJavadocs()
+    {
+    //--------------------------------------
+
+    tracing_resource mr;
+
+    value const jv = parse( "[1,2,3]", &mr );
+
+    tracing_stats st = mr.stats();
+
+    BOOST_TEST( st.allocations > 0 );
+    BOOST_TEST( st.bytes_outstanding <= st.bytes_allocated );
+
+    //--------------------------------------
+    }
+
+    void
+    testCounters()
+    {
+        tracing_resource mr;
+        void* p = mr.allocate(100, 8);
+        void* q = mr.allocate(3000, 8);
+
+        tracing_stats st = mr.stats();
+        BOOST_TEST(st.allocations == 2);
+        BOOST_TEST(st.deallocations == 0);
+        BOOST_TEST(st.bytes_allocated == 3100);
+        BOOST_TEST(st.bytes_outstanding == 3100);
+        BOOST_TEST(st.peak_bytes == 3100);
+        BOOST_TEST(st.largest_allocation == 3000);
+        // 100 lies in [64,128), 3000 in [2048,4096)
+        BOOST_TEST(st.histogram[6] == 1);
+        BOOST_TEST(st.histogram[11] == 1);
+
+        mr.deallocate(q, 3000, 8);
+        st = mr.stats();
+        BOOST_TEST(st.deallocations == 1);
+        BOOST_TEST(st.bytes_outstanding == 100);
+        // the high-water mark is retained
+        BOOST_TEST(st.peak_bytes == 3100);
+
+        mr.deallocate(p, 100, 8);
+        st = mr.stats();
+        BOOST_TEST(st.bytes_outstanding == 0);
+
+        mr.reset_stats();
+        st = mr.stats();
+        BOOST_TEST(st.allocations == 0);
+        BOOST_TEST(st.bytes_allocated == 0);
+        BOOST_TEST(st.peak_bytes == 0);
+    }
+
+    void
+    testUpstream()
+    {
+        // allocations are forwarded
+        // to the wrapped resource
+        monotonic_resource upstream;
+        tracing_resource mr(&upstream);
+        BOOST_TEST(serialize(parse(
+            "[1,2,3]", &mr)) == "[1,2,3]");
+        tracing_stats const st = mr.stats();
+        BOOST_TEST(st.allocations > 0);
+        BOOST_TEST(st.bytes_allocated > 0);
+        BOOST_TEST(st.peak_bytes <=
+            st.bytes_allocated);
+    }
+
+    void
+    testParse()
+    {
+        tracing_resource mr;
+        {
+            value const jv = parse(
+                "{\"k\":[1,2,3],\"s\":\"a somewhat longer string value\"}",
+                &mr);
+            tracing_stats const st = mr.stats();
+            BOOST_TEST(st.allocations > 0);
+            BOOST_TEST(st.bytes_outstanding > 0);
+            std::uint64_t total = 0;
+            for(auto n : st.histogram)
+                total += n;
+            BOOST_TEST(total == st.allocations);
+        }
+        // everything returned once
+        // the value is destroyed
+        tracing_stats const st = mr.stats();
+        BOOST_TEST(st.bytes_outstanding == 0);
+        BOOST_TEST(st.allocations ==
+            st.deallocations);
+    }
+
+    void
+    run()
+    {
+        testJavadocs();
+        testCounters();
+        testUpstream();
+        testParse();
+    }
+};
+
+TEST_SUITE(tracing_resource_test, "boost.json.tracing_resource");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/unescape.hpp>
+
+#include <boost/json/escape.hpp>
+#include <boost/json/parse.hpp>
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class unescape_test
+{
+public:
+    void
+    good(
+        string_view s,
+        string_view expected)
+    {
+        std::string buf(s.size() + 1, '*');
+        error_code ec;
+        auto const n = unescape(s, &buf[0], ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(
+            string_view(buf.data(), n) == expected);
+
+        // matches the parser
+        std::string const text =
+            "\"" + std::string(s) + "\"";
+        value const jv = parse(text);
+        BOOST_TEST(
+            jv.as_string() == expected);
+
+        // throwing overload
+        BOOST_TEST(
+            unescape(s, &buf[0]) == n);
+    }
+
+    void
+    bad(
+        string_view s,
+        error e)
+    {
+        std::string buf(s.size() + 1, '*');
+        error_code ec;
+        auto const n = unescape(s, &buf[0], ec);
+        BOOST_TEST(ec == e);
+        BOOST_TEST(n == 0);
+        BOOST_TEST_THROWS_WITH_LOCATION(
+            unescape(s, &buf[0]));
+    }
+
+    void
+    testUnescape()
+    {
+        good("", "");
+        good("hello", "hello");
+        good("\\\"", "\"");
+        good("\\\\", "\\");
+        good("\\/", "/");
+        good("\\b\\f\\n\\r\\t",
+            "\x08\x0c\x0a\x0d\x09");
+        good("say \\\"hi\\\"\\n", "say \"hi\"\n");
+
+        // utf16 escapes
+        good("\\u0041", "A");
+        good("\\u00e9", "\xc3\xa9");
+        good("\\u20ac", "\xe2\x82\xac");
+        good("\\ud83d\\ude00", "\xf0\x9f\x98\x80");
+        good("a\\u0062c", "abc");
+
+        // runs of consecutive utf16 escapes
+        // are decoded in batches
+        {
+            std::string s;
+            std::string expected;
+            for(int i = 0; i < 100; ++i)
+            {
+                s += "\\u0041";
+                expected += 'A';
+            }
+            good(s, expected);
+        }
+        {
+            std::string s;
+            std::string expected;
+            for(int i = 0; i < 50; ++i)
+            {
+                s += "\\u0024\\u00a2\\u20ac"
+                    "\\ud83d\\ude00";
+                expected +=
+                    "\x24\xc2\xa2\xe2\x82\xac"
+                    "\xf0\x9f\x98\x80";
+            }
+            good(s, expected);
+        }
+        good("\\u0041x\\u0042\\u0043\\ny",
+            "AxBC\ny");
+
+        // an irregular escape ending a run is
+        // reported exactly as when it stands
+        // alone
+        bad("\\u0041\\u0042\\udc00",
+            error::illegal_leading_surrogate);
+        bad("\\u0041\\ud83d\\u0041",
+            error::illegal_trailing_surrogate);
+        bad("\\u0041\\u0042\\u00zz",
+            error::expected_hex_digit);
+        bad("\\u0041\\u0042\\u00",
+            error::incomplete);
+        bad("\\u0041\\ud83d",
+            error::incomplete);
+
+        // unescaped multi-byte utf8
+        // passes through untouched
+        good("\xe2\x82\xac", "\xe2\x82\xac");
+
+        // long strings exercise the bulk copy
+        {
+            std::string s(1000, 'x');
+            s += "\\n";
+            s.append(1000, 'y');
+            std::string expected(1000, 'x');
+            expected += '\n';
+            expected.append(1000, 'y');
+            good(s, expected);
+        }
+
+        // round trip with escape
+        {
+            string_view const s =
+                "control \x01 quote \" slash \\ \n";
+            std::string esc(6 * s.size(), 0);
+            esc.resize(escape(s, &esc[0]));
+            std::string buf(esc.size(), 0);
+            buf.resize(unescape(esc, &buf[0]));
+            BOOST_TEST(buf == s);
+        }
+
+        // errors
+        bad("\\", error::incomplete);
+        bad("\\q", error::syntax);
+        bad("\\u", error::incomplete);
+        bad("\\u00", error::incomplete);
+        bad("\\u00zz", error::expected_hex_digit);
+        bad("\\udc00", error::illegal_leading_surrogate);
+        bad("\\ud83d", error::incomplete);
+        bad("\\ud83dx", error::incomplete);
+        bad("\\ud83dabcdef", error::syntax);
+        bad("\\ud83d\\u0041", error::illegal_trailing_surrogate);
+        bad("\\ud83d\\uzzzz", error::expected_hex_digit);
+    }
+
+    void
+    run()
+    {
+        testUnescape();
+    }
+};
+
+TEST_SUITE(unescape_test, "boost.json.unescape");
+
+} // namespace json
+} // namespace boost
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/validate.hpp>
+
+#include <boost/json/parse.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class validate_test
+{
+public:
+    void
+    good(string_view s)
+    {
+        error_code ec;
+        validate_stats st;
+        BOOST_TEST(validate(s, ec, st));
+        BOOST_TEST(! ec);
+        BOOST_TEST(st.position == s.size());
+
+        // agrees with the parser
+        error_code pec;
+        parse(s, pec);
+        BOOST_TEST(! pec);
+    }
+
+    void
+    bad(string_view s)
+    {
+        error_code ec;
+        validate_stats st;
+        BOOST_TEST(! validate(s, ec, st));
+        BOOST_TEST(ec);
+        BOOST_TEST(st.position <= s.size());
+
+        // agrees with the parser
+        error_code pec;
+        parse(s, pec);
+        BOOST_TEST(pec);
+    }
+
+    void
+    testValid()
+    {
+        good("null");
+        good("true");
+        good("false");
+        good("0");
+        good("-0");
+        good("1234567890");
+        good("-12.34e+5");
+        good("1e999999999999999999");
+        good("\"\"");
+        good("\"x\"");
+        good("\"\\u0000\\n\\\\\"");
+        good("\"\\ud83d\\ude00\"");
+        good("\"\xf0\x9f\x98\x80\"");
+        good("[]");
+        good("[1,\"two\",[3],{},null]");
+        good("{}");
+        good("{\"a\":1}");
+        good(" { \"a\" : [ 1 , 2 ] } ");
+        good("{\"a\":{\"b\":{\"c\":[]}}}");
+    }
+
+    void
+    testInvalid()
+    {
+        bad("");
+        bad(" ");
+        bad("nul");
+        bad("truE");
+        bad("+1");
+        bad("01");
+        bad("1.");
+        bad("1e");
+        bad("-");
+        bad("\"");
+        bad("\"\\q\"");
+        bad("\"\\u123");
+        bad("\"\\u123x\"");
+        bad("\"\\ud800\"");
+        bad("\"\\ud800\\u0041\"");
+        bad("\"\xff\"");
+        bad("\"\x01\"");
+        bad("[");
+        bad("[1,");
+        bad("[1 2]");
+        bad("{");
+        bad("{\"a\"}");
+        bad("{\"a\":}");
+        bad("{\"a\":1,}");
+        bad("{1:2}");
+        bad("{}}");
+        bad("1 2");
+    }
+
+    void
+    testStats()
+    {
+        error_code ec;
+        validate_stats st;
+        BOOST_TEST(validate(
+            "{\"a\":[1,2.5,true,false,null],"
+            "\"b\":{\"c\":\"s\"}}", ec, st));
+        BOOST_TEST(st.objects == 2);
+        BOOST_TEST(st.arrays == 1);
+        BOOST_TEST(st.keys == 3);
+        BOOST_TEST(st.strings == 1);
+        BOOST_TEST(st.numbers == 2);
+        BOOST_TEST(st.bools == 2);
+        BOOST_TEST(st.nulls == 1);
+        BOOST_TEST(st.max_depth == 2);
+    }
+
+    void
+    testPosition()
+    {
+        error_code ec;
+        validate_stats st;
+        string_view const s = "[1, tru ]";
+        BOOST_TEST(! validate(s, ec, st));
+        // the error is at the malformed literal
+        BOOST_TEST(st.position == 4);
+    }
+
+    void
+    testOptions()
+    {
+        // extensions route through the
+        // incremental parser
+        parse_options opt;
+        opt.allow_comments = true;
+        opt.allow_trailing_commas = true;
+
+        error_code ec;
+        validate_stats st;
+        BOOST_TEST(validate(
+            "[1, /*c*/ 2,]", ec, st, opt));
+        BOOST_TEST(st.arrays == 1);
+        BOOST_TEST(st.numbers == 2);
+        BOOST_TEST(st.position == 13);
+
+        BOOST_TEST(! validate(
+            "[1, /*c*/ 2,]", ec, st));
+
+        // invalid utf-8 is accepted
+        // when the option is set
+        parse_options lax;
+        lax.allow_invalid_utf8 = true;
+        BOOST_TEST(validate(
+            "\"\xff\"", ec, st, lax));
+
+        // nesting deeper than max_depth
+        // is rejected
+        parse_options shallow;
+        shallow.max_depth = 2;
+        BOOST_TEST(! validate(
+            "[[[1]]]", ec, shallow));
+        BOOST_TEST(ec == error::too_deep);
+    }
+
+    void
+    testLarge()
+    {
+        // exercise the block-at-a-time
+        // kernels with a document larger
+        // than any single vector width
+        std::string s = "[";
+        for(int i = 0; i < 1000; ++i)
+        {
+            if(i > 0)
+                s += ',';
+            s += "{\"key number ";
+            s += std::to_string(i);
+            s += "\":[1,2.5,\"a longer string "
+                "value with \\\"escapes\\\" in "
+                "it\",null,true]}";
+        }
+        s += ']';
+        error_code ec;
+        validate_stats st;
+        BOOST_TEST(validate(s, ec, st));
+        BOOST_TEST(st.position == s.size());
+        BOOST_TEST(st.objects == 1000);
+        BOOST_TEST(st.arrays == 1001);
+        BOOST_TEST(st.keys == 1000);
+        BOOST_TEST(st.max_depth == 3);
+    }
+
+    void
+    run()
+    {
+        testValid();
+        testInvalid();
+        testStats();
+        testPosition();
+        testOptions();
+        testLarge();
+    }
+};
+
+TEST_SUITE(validate_test, "boost.json.validate");
+
+} // namespace json
+} // namespace boost
@@ -2063,6 +2063,41 @@ public:
         BOOST_TEST_THROWS_WITH_LOCATION( value({true,2,"3"}).at(4) );
     }
 
+    void
+    testExtract()
+    {
+        // object
+        {
+            value jv{{"results", {1, 2, 3}}, {"status", "ok"}};
+            auto const* p = jv.at("results").get_array().data();
+            value sub = jv.extract("results");
+
+            // the subtree was pilfered, not copied
+            BOOST_TEST( sub.get_array().data() == p );
+            BOOST_TEST( sub == array({1, 2, 3}) );
+            BOOST_TEST( jv.get_object().size() == 1 );
+            BOOST_TEST_THROWS_WITH_LOCATION( jv.extract("results") );
+        }
+
+        // array
+        {
+            value jv{true, {1, 2, 3}, "3"};
+            auto const* p = jv.at(1).get_array().data();
+            value sub = jv.extract(std::size_t(1));
+
+            BOOST_TEST( sub.get_array().data() == p );
+            BOOST_TEST( jv == value({true, "3"}) );
+            BOOST_TEST_THROWS_WITH_LOCATION(
+                jv.extract(std::size_t(2)) );
+        }
+
+        // wrong kind
+        {
+            value jv = 1;
+            BOOST_TEST_THROWS_WITH_LOCATION( jv.extract("k") );
+        }
+    }
+
     //------------------------------------------------------
 
     void
@@ -2090,6 +2125,44 @@ public:
         BOOST_STATIC_ASSERT(std::is_same<
             decltype(get<1>(std::declval<kvp>())), json::value&&>::value);
 
+        // keys of at most 15 characters are
+        // stored inline and do not allocate;
+        // longer keys are allocated
+        {
+            fail_resource mr;
+            {
+                kvp p1("123456789012345",
+                    value(1, &mr));
+                BOOST_TEST(mr.nalloc == 0);
+                BOOST_TEST(p1.key() ==
+                    "123456789012345");
+                kvp p2("1234567890123456",
+                    value(2, &mr));
+                BOOST_TEST(mr.nalloc == 1);
+                BOOST_TEST(p2.key() ==
+                    "1234567890123456");
+
+                // both representations
+                // survive copy and move
+                kvp c1(p1);
+                kvp c2(p2);
+                BOOST_TEST(c1.key() == p1.key());
+                BOOST_TEST(c2.key() == p2.key());
+                kvp m1(std::move(c1));
+                kvp m2(std::move(c2));
+                BOOST_TEST(m1.key() ==
+                    "123456789012345");
+                BOOST_TEST(m2.key() ==
+                    "1234567890123456");
+
+                // moved-from pairs hold an
+                // empty, terminated key
+                BOOST_TEST(c1.key() == "");
+                BOOST_TEST(*c2.key_c_str() == 0);
+            }
+            BOOST_TEST(mr.nalloc == 0);
+        }
+
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
         auto const [kc, vc] = v1;
         static_assert(std::is_same<decltype(kc), string_view const>::value);
@@ -2397,6 +2470,159 @@ public:
         BOOST_TEST( ss.rdstate() == std::ios::failbit );
     }
 
+    void
+    testFreeze()
+    {
+        // incremental insertion leaves slack,
+        // which the frozen copy discards
+        {
+            value jv = array{};
+            auto& a = jv.as_array();
+            for(int i = 0; i < 100; ++i)
+                a.push_back(i);
+            BOOST_TEST(a.capacity() > a.size());
+
+            value const jv2 = jv.freeze();
+            BOOST_TEST(jv2 == jv);
+            BOOST_TEST(jv2.as_array().capacity() ==
+                jv2.as_array().size());
+        }
+        {
+            value jv = object{};
+            auto& o = jv.as_object();
+            for(int i = 0; i < 100; ++i)
+                o.emplace(std::to_string(i), i);
+            BOOST_TEST(o.capacity() > o.size());
+
+            value const jv2 = jv.freeze();
+            BOOST_TEST(jv2 == jv);
+            BOOST_TEST(jv2.as_object().capacity() ==
+                jv2.as_object().size());
+        }
+
+        // the copy lives in the given resource,
+        // and all allocations are balanced
+        {
+            value jv = {
+                {"k", {1, 2, 3}},
+                {"s", "a string long enough to "
+                    "require a dynamic allocation"}};
+            fail_resource mr;
+            {
+                value const jv2 = jv.freeze(&mr);
+                BOOST_TEST(jv2 == jv);
+                BOOST_TEST(*jv2.storage() == mr);
+                BOOST_TEST(mr.bytes > 0);
+            }
+            BOOST_TEST(mr.bytes == 0);
+        }
+    }
+
+    void
+    testCloneCompact()
+    {
+        // the copy is equal and owns
+        // storage distinct from the original
+        {
+            value jv = {
+                {"k", {1, 2, 3}},
+                {"s", "a string long enough to "
+                    "require a dynamic allocation"}};
+            value const jv2 = jv.clone_compact();
+            BOOST_TEST(jv2 == jv);
+            BOOST_TEST(*jv2.storage() != *jv.storage());
+        }
+
+        // the copy outlives the original
+        {
+            value jv2;
+            {
+                value jv = array{};
+                for(int i = 0; i < 100; ++i)
+                    jv.as_array().push_back(
+                        value(string_view(
+                            "string number " +
+                            std::to_string(i) +
+                            " with dynamic storage")));
+                jv2 = jv.clone_compact();
+            }
+            BOOST_TEST(jv2.as_array().size() == 100);
+            BOOST_TEST(jv2.as_array()[99].as_string() ==
+                "string number 99 with dynamic storage");
+        }
+
+        // with a sufficient reserve the copy is
+        // packed into one block in pre-order:
+        // each string's characters sit at a
+        // higher address than the last
+        {
+            value jv = array{};
+            for(int i = 0; i < 10; ++i)
+                jv.as_array().push_back(
+                    value(string_view(
+                        "another string long enough to "
+                        "require allocation #" +
+                        std::to_string(i))));
+            value const jv2 =
+                jv.clone_compact(1 << 16);
+            auto const& a = jv2.as_array();
+            for(std::size_t i = 1; i < a.size(); ++i)
+                BOOST_TEST(
+                    a[i].as_string().data() >
+                    a[i - 1].as_string().data());
+        }
+    }
+
+    void
+    testRelocate()
+    {
+        // same resource: no work,
+        // all statistics zero
+        {
+            value jv = { 1, 2, 3 };
+            auto const st =
+                jv.relocate(jv.storage());
+            BOOST_TEST(! st.relocated);
+            BOOST_TEST(st.values == 0);
+            BOOST_TEST(st.string_bytes == 0);
+            BOOST_TEST((
+                jv == value{ 1, 2, 3 }));
+        }
+
+        // different resource: the copy is
+        // counted and ownership moves
+        {
+            value jv = {
+                { "key", { "abc", 1,
+                    true, nullptr } },
+                { "s", "xy" } };
+            value const expect = jv;
+            monotonic_resource mr;
+            auto const st = jv.relocate(&mr);
+            BOOST_TEST(st.relocated);
+            BOOST_TEST(*jv.storage() == mr);
+            BOOST_TEST(jv == expect);
+            // root, the array, its four
+            // elements, and "xy"
+            BOOST_TEST(st.values == 7);
+            // "abc" + "xy" + keys
+            // "key" and "s"
+            BOOST_TEST(st.string_bytes == 9);
+        }
+
+        // scalars relocate without
+        // copying characters
+        {
+            monotonic_resource mr;
+            value jv = 42;
+            auto const st = jv.relocate(&mr);
+            BOOST_TEST(st.relocated);
+            BOOST_TEST(st.values == 1);
+            BOOST_TEST(st.string_bytes == 0);
+            BOOST_TEST(jv.as_int64() == 42);
+        }
+    }
+
     //------------------------------------------------------
 
     void
@@ -2414,12 +2640,16 @@ public:
         testAs();
         testGet();
         testAt();
+        testExtract();
         testKeyValuePair();
         testStdConstruction();
         testInitList();
         testEquality();
         testHash();
         testIstream();
+        testFreeze();
+        testCloneCompact();
+        testRelocate();
     }
 };
 
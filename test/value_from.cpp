@@ -12,6 +12,7 @@
 #include <boost/json/value_from.hpp>
 
 #include <boost/json/value.hpp> // prevent intellisense bugs
+#include <boost/json/monotonic_resource.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/describe/class.hpp>
@@ -20,6 +21,7 @@
 #include "test_suite.hpp"
 
 #include <array>
+#include <list>
 #include <string>
 #include <vector>
 #include <tuple>
@@ -392,6 +394,62 @@ public:
         }
     }
 
+    template< class... Context >
+    static
+    void
+    testScalarSequence( Context const& ... ctx )
+    {
+        // contiguous buffers of doubles and
+        // 64-bit integers take the bulk append
+        // path without a context; the result
+        // must not depend on which path ran
+        {
+            std::vector<double> a{1.5, -2.25, 3.0};
+            value b;
+            array& b_arr = b.emplace_array();
+            for( double d : a )
+                b_arr.emplace_back(d);
+            BOOST_TEST(value_from( a, ctx... ) == b);
+        }
+        {
+            std::vector<std::int64_t> a{-1, 2, 3};
+            value b{-1, 2, 3};
+            BOOST_TEST(value_from( a, ctx... ) == b);
+        }
+        {
+            std::vector<std::uint64_t> a{1, 2, 3};
+            value b{1, 2, 3};
+            BOOST_TEST(value_from( a, ctx... ) == b);
+        }
+        {
+            std::vector<double> a;
+            value c = value_from( a, ctx... );
+            BOOST_TEST(c.is_array());
+            BOOST_TEST(c.as_array().empty());
+        }
+
+        // non-contiguous and differently
+        // typed sequences use the
+        // element-wise path
+        {
+            std::list<double> a{1.5, 2.5};
+            value b{1.5, 2.5};
+            BOOST_TEST(value_from( a, ctx... ) == b);
+        }
+
+        // the storage propagates to the
+        // elements
+        {
+            std::vector<double> a{1.5, 2.5};
+            monotonic_resource mr;
+            value c = value_from(
+                a, ctx..., storage_ptr(&mr) );
+            BOOST_TEST(*c.storage() == mr);
+            BOOST_TEST(
+                *c.as_array().front().storage() == mr);
+        }
+    }
+
     template< class... Context >
     static
     void
@@ -593,6 +651,7 @@ public:
         {
             testValueCtors( Context()... );
             testGeneral( Context()... );
+            testScalarSequence( Context()... );
             testAssociative( Context()... );
             testPreferUserCustomizations( Context()... );
             testDescribed( Context()... );
@@ -10,9 +10,11 @@
 // Test that header file is self-contained.
 #include <boost/json/value_stack.hpp>
 
+#include <boost/json/monotonic_resource.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/json/static_resource.hpp>
 
+#include "test.hpp"
 #include "test_suite.hpp"
 
 namespace boost {
@@ -116,10 +118,394 @@ public:
 
     }
 
+    void
+    testKeyReuse()
+    {
+        // with a trivial-deallocate resource,
+        // repeated keys too long for inline
+        // storage share one allocation
+        {
+            monotonic_resource mr;
+            value_stack st;
+            st.reset(&mr);
+            st.push_key("alpha.bravo.charlie");
+            st.push_int64(1);
+            st.push_object(1);
+            st.push_key("alpha.bravo.charlie");
+            st.push_int64(2);
+            st.push_object(1);
+            st.push_array(2);
+            value jv = st.release();
+
+            auto const& o1 = jv.at(0).as_object();
+            auto const& o2 = jv.at(1).as_object();
+            BOOST_TEST(o1.begin()->key() ==
+                "alpha.bravo.charlie");
+            BOOST_TEST(o2.begin()->key() ==
+                "alpha.bravo.charlie");
+            BOOST_TEST(
+                o1.begin()->key().data() ==
+                o2.begin()->key().data());
+        }
+
+        // short keys are stored inside their
+        // elements, so nothing is shared even
+        // when the resource would allow it
+        {
+            monotonic_resource mr;
+            value_stack st;
+            st.reset(&mr);
+            st.push_key("alpha");
+            st.push_int64(1);
+            st.push_object(1);
+            st.push_key("alpha");
+            st.push_int64(2);
+            st.push_object(1);
+            st.push_array(2);
+            value jv = st.release();
+
+            auto const& o1 = jv.at(0).as_object();
+            auto const& o2 = jv.at(1).as_object();
+            BOOST_TEST(o1.begin()->key() == "alpha");
+            BOOST_TEST(o2.begin()->key() == "alpha");
+            BOOST_TEST(
+                o1.begin()->key().data() !=
+                o2.begin()->key().data());
+        }
+
+        // with the default resource, keys
+        // are owned by their elements
+        {
+            value_stack st;
+            st.reset();
+            st.push_key("alpha.bravo.charlie");
+            st.push_int64(1);
+            st.push_object(1);
+            st.push_key("alpha.bravo.charlie");
+            st.push_int64(2);
+            st.push_object(1);
+            st.push_array(2);
+            value jv = st.release();
+
+            auto const& o1 = jv.at(0).as_object();
+            auto const& o2 = jv.at(1).as_object();
+            BOOST_TEST(o1.begin()->key() ==
+                "alpha.bravo.charlie");
+            BOOST_TEST(
+                o1.begin()->key().data() !=
+                o2.begin()->key().data());
+        }
+    }
+
+    void
+    testReserve()
+    {
+        // after reserve, pushing the stated
+        // number of values does not reallocate
+        // the temporary storage
+        fail_resource mr;
+        {
+            value_stack st((storage_ptr(&mr)));
+            st.reset();
+            st.reserve(1000);
+            auto const n = mr.nalloc;
+            BOOST_TEST(n > 0);
+            for(int i = 0; i < 1000; ++i)
+                st.push_int64(i);
+            BOOST_TEST(mr.nalloc == n);
+            st.push_array(1000);
+            BOOST_TEST(mr.nalloc == n);
+            value jv = st.release();
+            BOOST_TEST(
+                jv.as_array().size() == 1000);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+    }
+
+    void
+    testReserveChars()
+    {
+        // after reserve_chars, accumulating a
+        // string of the stated size does not
+        // reallocate the temporary storage
+        fail_resource mr;
+        {
+            value_stack st((storage_ptr(&mr)));
+            st.reset();
+            std::string part(100, '*');
+            st.reserve_chars(1000);
+            auto const n = mr.nalloc;
+            BOOST_TEST(n > 0);
+            for(int i = 0; i < 9; ++i)
+                st.push_chars(part);
+            st.push_string(part);
+            BOOST_TEST(mr.nalloc == n);
+            st.push_array(1);
+            value jv = st.release();
+            BOOST_TEST(jv.at(0).get_string()
+                .size() == 1000);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+
+        // characters already pushed count
+        // towards the reservation
+        {
+            value_stack st((storage_ptr(&mr)));
+            st.reset();
+            std::string part(100, '*');
+            st.push_chars(part);
+            st.reserve_chars(1000);
+            auto const n = mr.nalloc;
+            for(int i = 0; i < 8; ++i)
+                st.push_chars(part);
+            st.push_key(part);
+            BOOST_TEST(mr.nalloc == n);
+            st.push_null();
+            st.push_object(1);
+            value jv = st.release();
+            BOOST_TEST(jv.as_object().begin()
+                ->key().size() == 1000);
+        }
+        BOOST_TEST(mr.nalloc == 0);
+    }
+
+    void
+    testPushValue()
+    {
+        // a subtree using the same resource
+        // is adopted without allocating
+        fail_resource mr;
+        {
+            value_stack st((storage_ptr()));
+            st.reset(&mr);
+            st.push_string(
+                "a string long enough "
+                "to allocate");
+            st.push_array(1);
+            value sub = st.release();
+
+            st.reset(&mr);
+            st.push_key("k");
+            auto const n = mr.nalloc;
+            st.push_value(std::move(sub));
+            BOOST_TEST(sub.is_null());
+            BOOST_TEST(mr.nalloc == n);
+            st.push_object(1);
+            value jv = st.release();
+            BOOST_TEST(serialize(jv) ==
+                "{\"k\":[\"a string long "
+                "enough to allocate\"]}");
+        }
+        BOOST_TEST(mr.nalloc == 0);
+
+        // a subtree using a different
+        // resource is copied and the
+        // source is left unchanged
+        {
+            monotonic_resource mr2;
+            value_stack st;
+            st.reset(&mr2);
+            value sub = { 1, 2, 3 };
+            st.push_value(std::move(sub));
+            st.push_array(1);
+            value jv = st.release();
+            BOOST_TEST(sub == value({ 1, 2, 3 }));
+            BOOST_TEST(serialize(jv) ==
+                "[[1,2,3]]");
+            BOOST_TEST(
+                jv.storage().get() == &mr2);
+            BOOST_TEST(jv.at(0).storage()
+                .get() == &mr2);
+        }
+    }
+
+    void
+    testSingleStorage()
+    {
+        // elements hold non-owning pointers;
+        // only the root owns the resource
+        {
+            auto sp = make_shared_resource<
+                monotonic_resource>();
+            value_stack st;
+            st.single_storage(true);
+            BOOST_TEST(st.single_storage());
+            st.reset(sp);
+            st.push_key("a");
+            st.push_int64(1);
+            st.push_key("b");
+            st.push_string(
+                "a string long enough to "
+                "require an allocation");
+            st.push_object(2);
+            value jv = st.release();
+            BOOST_TEST(
+                jv.storage().is_shared());
+            BOOST_TEST(! jv.at("b")
+                .storage().is_shared());
+            BOOST_TEST(jv.at("b").storage()
+                .get() == sp.get());
+
+            // the root keeps the resource
+            // alive after other copies of
+            // the pointer are gone
+            auto const* p = sp.get();
+            sp = {};
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":1,\"b\":\"a string "
+                "long enough to require an "
+                "allocation\"}");
+            BOOST_TEST(
+                jv.storage().get() == p);
+        }
+
+        // partial results may be abandoned;
+        // the stack still owns the resource
+        // while they are destroyed
+        {
+            value_stack st;
+            st.single_storage(true);
+            st.reset(make_shared_resource<
+                monotonic_resource>());
+            st.push_key("k");
+            st.push_string(
+                "a string long enough to "
+                "require an allocation");
+        }
+
+        // non-owning resources are
+        // unaffected by the mode
+        {
+            monotonic_resource mr;
+            value_stack st;
+            st.single_storage(true);
+            st.reset(&mr);
+            st.push_int64(1);
+            st.push_array(1);
+            value jv = st.release();
+            BOOST_TEST(
+                jv.storage().get() == &mr);
+            BOOST_TEST(jv.at(0).storage()
+                .get() == &mr);
+        }
+    }
+
+    void
+    testPairArrays()
+    {
+        auto const push_pair = [](
+            value_stack& st,
+            string_view k, std::int64_t v)
+        {
+            st.push_key("k");
+            st.push_string(k);
+            st.push_key("v");
+            st.push_int64(v);
+            st.push_object(2);
+        };
+
+        // a matching array becomes an object
+        {
+            value_stack st;
+            st.pair_arrays("k", "v");
+            BOOST_TEST(st.pair_arrays());
+            st.reset();
+            push_pair(st, "a", 1);
+            push_pair(st, "b", 2);
+            st.push_array(2);
+            value jv = st.release();
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":1,\"b\":2}");
+        }
+
+        // one non-matching element keeps
+        // the array
+        {
+            value_stack st;
+            st.pair_arrays("k", "v");
+            st.reset();
+            push_pair(st, "a", 1);
+            st.push_int64(2);
+            st.push_array(2);
+            value jv = st.release();
+            BOOST_TEST(serialize(jv) ==
+                "[{\"k\":\"a\",\"v\":1},2]");
+        }
+
+        // values are adopted without
+        // copying
+        {
+            monotonic_resource mr;
+            value_stack st;
+            st.pair_arrays("k", "v");
+            st.reset(&mr);
+            value pair(
+                { {"k", "a"},
+                  {"v", "a string long enough "
+                        "to require an "
+                        "allocation"} },
+                &mr);
+            auto const* p = pair.at("v")
+                .get_string().data();
+            st.push_value(std::move(pair));
+            st.push_array(1);
+            value jv = st.release();
+            BOOST_TEST(jv.at("a")
+                .get_string().data() == p);
+        }
+
+        // duplicates follow the policy
+        {
+            value_stack st;
+            st.pair_arrays("k", "v");
+            st.on_duplicate_key(
+                duplicate_keys::first);
+            st.reset();
+            push_pair(st, "a", 1);
+            push_pair(st, "a", 2);
+            st.push_array(2);
+            value jv = st.release();
+            BOOST_TEST(serialize(jv) ==
+                "{\"a\":1}");
+        }
+        {
+            value_stack st;
+            st.pair_arrays("k", "v");
+            st.on_duplicate_key(
+                duplicate_keys::error);
+            st.reset();
+            push_pair(st, "a", 1);
+            push_pair(st, "a", 2);
+            BOOST_TEST_THROWS(
+                st.push_array(2),
+                system_error);
+        }
+
+        // an empty name disables the
+        // transform
+        {
+            value_stack st;
+            st.pair_arrays("k", "v");
+            st.pair_arrays("", "");
+            BOOST_TEST(! st.pair_arrays());
+            st.reset();
+            push_pair(st, "a", 1);
+            st.push_array(1);
+            value jv = st.release();
+            BOOST_TEST(jv.is_array());
+        }
+    }
+
     void
     run()
     {
         testValueStack();
+        testKeyReuse();
+        testReserve();
+        testReserveChars();
+        testPushValue();
+        testSingleStorage();
+        testPairArrays();
     }
 };
 
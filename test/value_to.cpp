@@ -11,6 +11,7 @@
 #include <boost/json/value_to.hpp>
 
 #include <boost/json/value_from.hpp>
+#include <boost/json/parse.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/describe/class.hpp>
 #include <boost/describe/enum.hpp>
@@ -733,6 +734,33 @@ public:
             system_error);
     }
 
+    void
+    testNonOwning()
+    {
+        // views point into the source value
+        // and do not allocate
+        value const jv = parse(
+            R"(["first string","second string"])");
+        auto views = value_to<
+            std::vector<string_view>>(jv);
+        if(BOOST_TEST(views.size() == 2))
+        {
+            BOOST_TEST(views[0] == "first string");
+            BOOST_TEST(views[1] == "second string");
+            BOOST_TEST(views[0].data() ==
+                jv.at(0).get_string().data());
+        }
+
+        string_view sv =
+            value_to<string_view>(value("v"));
+        BOOST_TEST(sv == "v");
+
+        auto m = value_to<std::map<
+            std::string, string_view>>(
+                parse(R"({"k":"payload"})"));
+        BOOST_TEST(m["k"] == "payload");
+    }
+
     struct run_templated_tests
     {
         // this overload supports zero or one default constructible contexts
@@ -775,6 +803,7 @@ public:
 
         testContext();
         testContainerHelpers();
+        testNonOwning();
     }
 };
 
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/value_transaction.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class value_transaction_test
+{
+public:
+    void
+    testCommit()
+    {
+        monotonic_resource mr;
+        value jv = parse(
+            R"({"a":[1,2,3],"b":"keep"})", &mr);
+        value_transaction tx(mr);
+        BOOST_TEST(tx.active());
+        tx.modify(jv.at("a")) =
+            parse("[4,5]", &mr);
+        tx.commit();
+        BOOST_TEST(! tx.active());
+        BOOST_TEST(jv == parse(
+            R"({"a":[4,5],"b":"keep"})"));
+    }
+
+    void
+    testRollback()
+    {
+        // explicit rollback restores the
+        // document and reclaims the arena
+        {
+            monotonic_resource mr;
+            value jv = parse(
+                R"({"a":[1,2,3],"b":"keep"})", &mr);
+            auto const before = serialize(jv);
+            auto const cp = mr.mark();
+            value_transaction tx(mr);
+            tx.modify(jv.at("a")) = parse(
+                "[{\"k\":\"a string long enough to "
+                "require a dynamic allocation\"}]",
+                &mr);
+            tx.rollback();
+            BOOST_TEST(! tx.active());
+            BOOST_TEST(serialize(jv) == before);
+            // the arena is back at the mark
+            auto const p1 = mr.allocate(64, 1);
+            mr.rollback(cp);
+            BOOST_TEST(p1 == mr.allocate(64, 1));
+        }
+
+        // a transaction destroyed without
+        // committing rolls back
+        {
+            monotonic_resource mr;
+            value jv = parse(
+                R"({"a":[1,2,3]})", &mr);
+            {
+                value_transaction tx(mr);
+                tx.modify(jv.at("a")) = 42;
+            }
+            BOOST_TEST(jv == parse(
+                R"({"a":[1,2,3]})"));
+        }
+    }
+
+    void
+    testMultipleSlots()
+    {
+        // several slots, including nested ones
+        // and the same slot twice, are restored
+        monotonic_resource mr;
+        value jv = parse(
+            R"({"a":{"x":1},"b":[true,null]})", &mr);
+        value_transaction tx(mr);
+        tx.modify(jv.at("a").at("x")) =
+            parse(R"(["replaced"])", &mr);
+        tx.modify(jv.at("b")) = "gone";
+        tx.modify(jv.at("b")) = 3.14;
+        tx.rollback();
+        BOOST_TEST(jv == parse(
+            R"({"a":{"x":1},"b":[true,null]})"));
+    }
+
+    void
+    run()
+    {
+        testCommit();
+        testRollback();
+        testMultipleSlots();
+    }
+};
+
+TEST_SUITE(value_transaction_test, "boost.json.value_transaction");
+
+} // namespace json
+} // namespace boost
@@ -82,9 +82,81 @@ public:
         check_mutable(kind::object,  object_kind);
     }
 
+    void
+    testVisitAll()
+    {
+        // records the kind of each
+        // element, in visitation order
+        struct f
+        {
+            std::string& log;
+            void operator()(std::nullptr_t) { log += 'n'; }
+            void operator()(bool) { log += 'b'; }
+            void operator()(std::int64_t) { log += 'i'; }
+            void operator()(std::uint64_t) { log += 'u'; }
+            void operator()(double) { log += 'd'; }
+            void operator()(string const&) { log += 's'; }
+            void operator()(array const&) { log += 'a'; }
+            void operator()(object const&) { log += 'o'; }
+        };
+
+        // empty
+        {
+            std::string log;
+            array a;
+            visit_all(f{log}, a);
+            BOOST_TEST(log.empty());
+        }
+
+        // homogeneous runs of every kind
+        {
+            std::string log;
+            array const a = {
+                1, 2, 3,
+                "x", "y",
+                nullptr, nullptr,
+                true,
+                1.5, 2.5,
+                std::uint64_t(-1),
+                array{1, 2},
+                object{{"k", 1}}};
+            visit_all(f{log}, a);
+            BOOST_TEST(log == "iiissnnbdduao");
+        }
+
+        // mutable overload can
+        // modify the elements
+        {
+            array a = {1, 2, 3};
+            struct g
+            {
+                void operator()(std::int64_t& i) { i *= 2; }
+                void operator()(...) {}
+            };
+            visit_all(g{}, a);
+            BOOST_TEST(a == array({2, 4, 6}));
+        }
+
+        // the visitor sees the payloads
+        {
+            std::int64_t sum = 0;
+            struct g
+            {
+                std::int64_t& sum;
+                void operator()(std::int64_t i) { sum += i; }
+                void operator()(string const& s) { sum += s.size(); }
+                void operator()(...) {}
+            };
+            array const a = {1, 2, "abc", 4};
+            visit_all(g{sum}, a);
+            BOOST_TEST(sum == 10);
+        }
+    }
+
     void run()
     {
         testVisit();
+        testVisitAll();
     }
 };
 
@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/json
+//
+
+// Test that header file is self-contained.
+#include <boost/json/writer.hpp>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/json/serializer.hpp>
+
+#include <string>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace json {
+
+class writer_test
+{
+public:
+    // a sink backed by a std::string
+    struct string_sink
+    {
+        std::string s;
+
+        serializer::mutable_buffer
+        prepare(std::size_t n)
+        {
+            size_ = s.size();
+            s.resize(size_ + n);
+            return { &s[0] + size_, n };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            s.resize(size_ + n);
+        }
+
+    private:
+        std::size_t size_ = 0;
+    };
+
+    // a sink which yields one byte at a time
+    struct tiny_sink
+    {
+        std::string s;
+        char c;
+
+        serializer::mutable_buffer
+        prepare(std::size_t)
+        {
+            return { &c, 1 };
+        }
+
+        void
+        commit(std::size_t n)
+        {
+            if(n)
+                s.push_back(c);
+        }
+    };
+
+    void
+    testScalars()
+    {
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            BOOST_TEST(! w.done());
+            w.value(nullptr);
+            BOOST_TEST(w.done());
+            BOOST_TEST(sink.s == "null");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value(true);
+            BOOST_TEST(sink.s == "true");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value(false);
+            BOOST_TEST(sink.s == "false");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value(-42);
+            BOOST_TEST(sink.s == "-42");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value(UINT64_MAX);
+            BOOST_TEST(sink.s ==
+                "18446744073709551615");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value(1.5);
+            BOOST_TEST(sink.s ==
+                serialize(value(1.5)));
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.value("he\"llo\n");
+            BOOST_TEST(sink.s ==
+                "\"he\\\"llo\\n\"");
+        }
+    }
+
+    void
+    testStructured()
+    {
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.begin_object();
+            w.end_object();
+            BOOST_TEST(w.done());
+            BOOST_TEST(sink.s == "{}");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.begin_array();
+            w.end_array();
+            BOOST_TEST(sink.s == "[]");
+        }
+        {
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.begin_object();
+            w.key("a").value(1);
+            w.key("b").begin_array();
+            w.value(true).value(nullptr);
+            w.end_array();
+            w.key("c").begin_object();
+            w.key("d").value("e");
+            w.end_object();
+            w.end_object();
+            BOOST_TEST(w.done());
+            BOOST_TEST(sink.s ==
+                "{\"a\":1,\"b\":[true,null],"
+                "\"c\":{\"d\":\"e\"}}");
+        }
+        {
+            // the produced text matches the
+            // serializer for the same document
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.begin_array();
+            w.value(1).value(-2).value(3.25);
+            w.value("x,y").begin_array();
+            w.end_array();
+            w.end_array();
+            value const jv = parse(sink.s);
+            BOOST_TEST(sink.s == serialize(jv));
+        }
+    }
+
+    void
+    testPretty()
+    {
+        serialize_options opts;
+        opts.pretty = true;
+        string_sink sink;
+        writer<string_sink> w(sink, opts);
+        w.begin_object();
+        w.key("a").value(1);
+        w.key("b").begin_array();
+        w.value(2).value(3);
+        w.end_array();
+        w.end_object();
+        value const jv = parse(sink.s);
+        BOOST_TEST(sink.s == serialize(jv, opts));
+    }
+
+    void
+    testReset()
+    {
+        string_sink sink;
+        writer<string_sink> w(sink);
+        w.value(1);
+        BOOST_TEST(w.done());
+        w.reset();
+        BOOST_TEST(! w.done());
+        w.value(2);
+        BOOST_TEST(sink.s == "12");
+    }
+
+    void
+    testSmallSink()
+    {
+        // output is correct even when the
+        // sink only offers one byte at a time
+        tiny_sink sink;
+        writer<tiny_sink> w(sink);
+        w.begin_object();
+        w.key("text").value("a\\b");
+        w.key("n").value(12345);
+        w.end_object();
+        BOOST_TEST(sink.s ==
+            "{\"text\":\"a\\\\b\",\"n\":12345}");
+    }
+
+    void
+    testRawJson()
+    {
+        {
+            // a fragment as the whole document
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.raw_json("[1,2,3]");
+            BOOST_TEST(w.done());
+            BOOST_TEST(sink.s == "[1,2,3]");
+        }
+        {
+            // fragments embedded in a larger
+            // document are not escaped or
+            // re-walked
+            string_sink sink;
+            writer<string_sink> w(sink);
+            w.begin_object();
+            w.key("cached").raw_json(
+                "{\"a\":[1,\"x\\n\"]}");
+            w.key("fresh").value(1);
+            w.key("parts").begin_array();
+            w.raw_json("null");
+            w.raw_json("\"s\"");
+            w.end_array();
+            w.end_object();
+            BOOST_TEST(w.done());
+            BOOST_TEST(sink.s ==
+                "{\"cached\":{\"a\":[1,\"x\\n\"]}"
+                ",\"fresh\":1,"
+                "\"parts\":[null,\"s\"]}");
+        }
+    }
+
+    void
+    run()
+    {
+        testScalars();
+        testStructured();
+        testPretty();
+        testReset();
+        testSmallSink();
+        testRawJson();
+    }
+};
+
+TEST_SUITE(writer_test, "boost.json.writer");
+
+} // namespace json
+} // namespace boost